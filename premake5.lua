@@ -79,6 +79,9 @@ workspace "OpenAssetTools"
     filter "options:debug-techset"
         defines { "TECHSET_DEBUG" }
     filter {}
+    filter "options:disable-tracing"
+        defines { "TRACING_DISABLED" }
+    filter {}
 
 -- ========================
 -- ThirdParty
@@ -163,19 +166,25 @@ group ""
 -- ========================
 -- Tests
 -- ========================
+include "test/Benchmarks.lua"
+include "test/CryptoTests.lua"
 include "test/ObjCommonTests.lua"
 include "test/ObjLoadingTests.lua"
 include "test/ParserTestUtils.lua"
 include "test/ParserTests.lua"
 include "test/ZoneCodeGeneratorLibTests.lua"
 include "test/ZoneCommonTests.lua"
+include "test/ZoneTests.lua"
 
 -- Tests group: Unit test and other tests projects
 group "Tests"
+    Benchmarks:project()
+    CryptoTests:project()
     ObjCommonTests:project()
     ObjLoadingTests:project()
     ParserTestUtils:project()
     ParserTests:project()
     ZoneCodeGeneratorLibTests:project()
     ZoneCommonTests:project()
+    ZoneTests:project()
 group ""
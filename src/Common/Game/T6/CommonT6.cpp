@@ -73,6 +73,24 @@ GfxColor Common::Vec4PackGfxColor(const float (&in)[4])
     return GfxColor{pack32::Vec4PackGfxColor(in)};
 }
 
+void Common::Vec2PackTexCoords(const float* in, PackedTexCoords* out, const size_t count)
+{
+    static_assert(sizeof(PackedTexCoords) == sizeof(uint32_t));
+    pack32::Vec2PackTexCoordsUV(in, reinterpret_cast<uint32_t*>(out), count);
+}
+
+void Common::Vec3PackUnitVec(const float* in, PackedUnitVec* out, const size_t count)
+{
+    static_assert(sizeof(PackedUnitVec) == sizeof(uint32_t));
+    pack32::Vec3PackUnitVecThirdBased(in, reinterpret_cast<uint32_t*>(out), count);
+}
+
+void Common::Vec4PackGfxColor(const float* in, GfxColor* out, const size_t count)
+{
+    static_assert(sizeof(GfxColor) == sizeof(uint32_t));
+    pack32::Vec4PackGfxColor(in, reinterpret_cast<uint32_t*>(out), count);
+}
+
 void Common::Vec2UnpackTexCoords(const PackedTexCoords& in, float (&out)[2])
 {
     pack32::Vec2UnpackTexCoordsUV(in.packed, out);
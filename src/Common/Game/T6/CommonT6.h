@@ -44,6 +44,9 @@ namespace T6
         static PackedTexCoords Vec2PackTexCoords(const float (&in)[2]);
         static PackedUnitVec Vec3PackUnitVec(const float (&in)[3]);
         static GfxColor Vec4PackGfxColor(const float (&in)[4]);
+        static void Vec2PackTexCoords(const float* in, PackedTexCoords* out, size_t count);
+        static void Vec3PackUnitVec(const float* in, PackedUnitVec* out, size_t count);
+        static void Vec4PackGfxColor(const float* in, GfxColor* out, size_t count);
         static void Vec2UnpackTexCoords(const PackedTexCoords& in, float (&out)[2]);
         static void Vec3UnpackUnitVec(const PackedUnitVec& in, float (&out)[3]);
         static void Vec4UnpackGfxColor(const GfxColor& in, float (&out)[4]);
@@ -0,0 +1,569 @@
+#include "BlockCompression.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+using namespace block_compression;
+
+namespace
+{
+    constexpr auto ALPHA_BLOCK_SIZE = 8u;
+
+    // Pixels of BC1 blocks with an alpha below this value are encoded as transparent
+    constexpr auto PUNCH_THROUGH_ALPHA_THRESHOLD = 128u;
+
+    constexpr auto POWER_ITERATION_COUNT = 8u;
+
+    using Palette = std::array<std::array<int, 3>, 4>;
+    using ChannelValues = std::array<uint8_t, BLOCK_PIXEL_COUNT>;
+
+    uint16_t ReadUInt16(const uint8_t* data)
+    {
+        return static_cast<uint16_t>(data[0] | data[1] << 8);
+    }
+
+    void WriteUInt16(uint8_t* data, const uint16_t value)
+    {
+        data[0] = static_cast<uint8_t>(value);
+        data[1] = static_cast<uint8_t>(value >> 8);
+    }
+
+    uint64_t ReadBits(const uint8_t* data, const unsigned byteCount)
+    {
+        uint64_t result = 0u;
+        for (auto i = 0u; i < byteCount; i++)
+            result |= static_cast<uint64_t>(data[i]) << (i * 8u);
+
+        return result;
+    }
+
+    void WriteBits(uint8_t* data, const uint64_t value, const unsigned byteCount)
+    {
+        for (auto i = 0u; i < byteCount; i++)
+            data[i] = static_cast<uint8_t>(value >> (i * 8u));
+    }
+
+    std::array<int, 3> UnpackColor565(const uint16_t color)
+    {
+        const auto r = (color >> 11) & 0x1F;
+        const auto g = (color >> 5) & 0x3F;
+        const auto b = color & 0x1F;
+
+        return {r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2};
+    }
+
+    uint16_t PackColor565(const std::array<float, 3>& color)
+    {
+        const auto r = static_cast<unsigned>(std::lround(std::clamp(color[0], 0.0f, 255.0f) * 31.0f / 255.0f));
+        const auto g = static_cast<unsigned>(std::lround(std::clamp(color[1], 0.0f, 255.0f) * 63.0f / 255.0f));
+        const auto b = static_cast<unsigned>(std::lround(std::clamp(color[2], 0.0f, 255.0f) * 31.0f / 255.0f));
+
+        return static_cast<uint16_t>(r << 11 | g << 5 | b);
+    }
+
+    Palette GetColorPalette(const uint16_t color0, const uint16_t color1, const bool fourColors)
+    {
+        Palette palette{};
+        palette[0] = UnpackColor565(color0);
+        palette[1] = UnpackColor565(color1);
+
+        for (auto channel = 0u; channel < 3u; channel++)
+        {
+            if (fourColors)
+            {
+                palette[2][channel] = (2 * palette[0][channel] + palette[1][channel]) / 3;
+                palette[3][channel] = (palette[0][channel] + 2 * palette[1][channel]) / 3;
+            }
+            else
+            {
+                palette[2][channel] = (palette[0][channel] + palette[1][channel]) / 2;
+                palette[3][channel] = 0;
+            }
+        }
+
+        return palette;
+    }
+
+    std::array<uint8_t, 8> GetAlphaPalette(const uint8_t alpha0, const uint8_t alpha1)
+    {
+        std::array<uint8_t, 8> palette{};
+        palette[0] = alpha0;
+        palette[1] = alpha1;
+
+        if (alpha0 > alpha1)
+        {
+            for (auto i = 0; i < 6; i++)
+                palette[i + 2] = static_cast<uint8_t>(((6 - i) * alpha0 + (1 + i) * alpha1) / 7);
+        }
+        else
+        {
+            for (auto i = 0; i < 4; i++)
+                palette[i + 2] = static_cast<uint8_t>(((4 - i) * alpha0 + (1 + i) * alpha1) / 5);
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+
+        return palette;
+    }
+
+    void DecodeColorBlock(const uint8_t* block, BlockPixels& pixels, const bool isBc1)
+    {
+        const auto color0 = ReadUInt16(block);
+        const auto color1 = ReadUInt16(&block[2]);
+        const auto indices = ReadBits(&block[4], 4u);
+
+        // Only BC1 has a mode with three colors and transparency, the color blocks of other formats always have four colors
+        const auto fourColors = !isBc1 || color0 > color1;
+        const auto palette = GetColorPalette(color0, color1, fourColors);
+
+        for (auto pixel = 0u; pixel < BLOCK_PIXEL_COUNT; pixel++)
+        {
+            const auto index = static_cast<unsigned>(indices >> (pixel * 2u)) & 0x3u;
+            pixels[pixel * 4u + 0u] = static_cast<uint8_t>(palette[index][0]);
+            pixels[pixel * 4u + 1u] = static_cast<uint8_t>(palette[index][1]);
+            pixels[pixel * 4u + 2u] = static_cast<uint8_t>(palette[index][2]);
+            pixels[pixel * 4u + 3u] = !fourColors && index == 3u ? 0u : 255u;
+        }
+    }
+
+    void DecodeAlphaBlock(const uint8_t* block, BlockPixels& pixels, const unsigned channel)
+    {
+        const auto palette = GetAlphaPalette(block[0], block[1]);
+        const auto indices = ReadBits(&block[2], 6u);
+
+        for (auto pixel = 0u; pixel < BLOCK_PIXEL_COUNT; pixel++)
+            pixels[pixel * 4u + channel] = palette[static_cast<unsigned>(indices >> (pixel * 3u)) & 0x7u];
+    }
+
+    void DecodeExplicitAlphaBlock(const uint8_t* block, BlockPixels& pixels)
+    {
+        const auto alphas = ReadBits(block, 8u);
+
+        for (auto pixel = 0u; pixel < BLOCK_PIXEL_COUNT; pixel++)
+            pixels[pixel * 4u + 3u] = static_cast<uint8_t>(((alphas >> (pixel * 4u)) & 0xFu) * 17u);
+    }
+
+    /**
+     * \brief Chooses the closest palette entry for every pixel.
+     * \return The indices of all pixels with two bits per pixel and the total squared error.
+     */
+    std::pair<uint32_t, unsigned> GetColorIndices(const BlockPixels& pixels, const std::array<bool, BLOCK_PIXEL_COUNT>& transparent, const Palette& palette, const unsigned colorCount)
+    {
+        uint32_t indices = 0u;
+        unsigned totalError = 0u;
+
+        for (auto pixel = 0u; pixel < BLOCK_PIXEL_COUNT; pixel++)
+        {
+            if (transparent[pixel])
+            {
+                indices |= 3u << (pixel * 2u);
+                continue;
+            }
+
+            auto bestIndex = 0u;
+            auto bestError = std::numeric_limits<unsigned>::max();
+            for (auto index = 0u; index < colorCount; index++)
+            {
+                auto error = 0u;
+                for (auto channel = 0u; channel < 3u; channel++)
+                {
+                    const auto difference = static_cast<int>(pixels[pixel * 4u + channel]) - palette[index][channel];
+                    error += static_cast<unsigned>(difference * difference);
+                }
+
+                if (error < bestError)
+                {
+                    bestError = error;
+                    bestIndex = index;
+                }
+            }
+
+            indices |= bestIndex << (pixel * 2u);
+            totalError += bestError;
+        }
+
+        return {indices, totalError};
+    }
+
+    class ColorBlockCandidate
+    {
+    public:
+        uint16_t m_color0;
+        uint16_t m_color1;
+        uint32_t m_indices;
+        unsigned m_error;
+    };
+
+    ColorBlockCandidate CreateColorBlockCandidate(
+        const BlockPixels& pixels, const std::array<bool, BLOCK_PIXEL_COUNT>& transparent, uint16_t color0, uint16_t color1, const bool fourColors)
+    {
+        // Four color blocks need the first color to be bigger, three color blocks the second one
+        if (fourColors ? color0 < color1 : color0 > color1)
+            std::swap(color0, color1);
+
+        // Equal colors in four color blocks would be decoded as a three color block, all pixels using the first color decode the same in both modes
+        const auto colorCount = fourColors && color0 != color1 ? 4u : 3u;
+        const auto palette = GetColorPalette(color0, color1, colorCount == 4u);
+        const auto [indices, error] = GetColorIndices(pixels, transparent, palette, colorCount);
+
+        return ColorBlockCandidate{color0, color1, indices, error};
+    }
+
+    /**
+     * \brief Solves for the endpoints that minimize the error of the chosen indices.
+     * \return \c false if the indices do not determine the endpoints, which happens when all pixels use the same palette entry.
+     */
+    bool FitEndpointsLeastSquares(const BlockPixels& pixels,
+                                  const std::array<bool, BLOCK_PIXEL_COUNT>& transparent,
+                                  const uint32_t indices,
+                                  const bool fourColors,
+                                  std::array<float, 3>& endpoint0,
+                                  std::array<float, 3>& endpoint1)
+    {
+        constexpr float FOUR_COLOR_WEIGHTS[]{1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f};
+        constexpr float THREE_COLOR_WEIGHTS[]{1.0f, 0.0f, 0.5f, 0.0f};
+
+        auto alphaAlpha = 0.0f;
+        auto alphaBeta = 0.0f;
+        auto betaBeta = 0.0f;
+        std::array<float, 3> alphaX{};
+        std::array<float, 3> betaX{};
+
+        for (auto pixel = 0u; pixel < BLOCK_PIXEL_COUNT; pixel++)
+        {
+            if (transparent[pixel])
+                continue;
+
+            const auto index = (indices >> (pixel * 2u)) & 0x3u;
+            const auto alpha = fourColors ? FOUR_COLOR_WEIGHTS[index] : THREE_COLOR_WEIGHTS[index];
+            const auto beta = 1.0f - alpha;
+
+            alphaAlpha += alpha * alpha;
+            alphaBeta += alpha * beta;
+            betaBeta += beta * beta;
+
+            for (auto channel = 0u; channel < 3u; channel++)
+            {
+                const auto value = static_cast<float>(pixels[pixel * 4u + channel]);
+                alphaX[channel] += alpha * value;
+                betaX[channel] += beta * value;
+            }
+        }
+
+        const auto determinant = alphaAlpha * betaBeta - alphaBeta * alphaBeta;
+        if (std::abs(determinant) < 1e-6f)
+            return false;
+
+        const auto inverseDeterminant = 1.0f / determinant;
+        for (auto channel = 0u; channel < 3u; channel++)
+        {
+            endpoint0[channel] = (alphaX[channel] * betaBeta - betaX[channel] * alphaBeta) * inverseDeterminant;
+            endpoint1[channel] = (betaX[channel] * alphaAlpha - alphaX[channel] * alphaBeta) * inverseDeterminant;
+        }
+
+        return true;
+    }
+
+    void EncodeColorBlock(const BlockPixels& pixels, uint8_t* block, const bool allowPunchThroughAlpha)
+    {
+        std::array<bool, BLOCK_PIXEL_COUNT> transparent{};
+        auto opaqueCount = 0u;
+        for (auto pixel = 0u; pixel < BLOCK_PIXEL_COUNT; pixel++)
+        {
+            transparent[pixel] = allowPunchThroughAlpha && pixels[pixel * 4u + 3u] < PUNCH_THROUGH_ALPHA_THRESHOLD;
+            if (!transparent[pixel])
+                opaqueCount++;
+        }
+
+        const auto fourColors = opaqueCount == BLOCK_PIXEL_COUNT;
+        if (opaqueCount == 0u)
+        {
+            // Equal colors make a three color block with only transparent pixels
+            WriteUInt16(block, 0u);
+            WriteUInt16(&block[2], 0u);
+            WriteBits(&block[4], UINT32_MAX, 4u);
+            return;
+        }
+
+        std::array<float, 3> mean{};
+        std::array<float, 3> minimum{255.0f, 255.0f, 255.0f};
+        std::array<float, 3> maximum{};
+        for (auto pixel = 0u; pixel < BLOCK_PIXEL_COUNT; pixel++)
+        {
+            if (transparent[pixel])
+                continue;
+
+            for (auto channel = 0u; channel < 3u; channel++)
+            {
+                const auto value = static_cast<float>(pixels[pixel * 4u + channel]);
+                mean[channel] += value;
+                minimum[channel] = std::min(minimum[channel], value);
+                maximum[channel] = std::max(maximum[channel], value);
+            }
+        }
+
+        for (auto& value : mean)
+            value /= static_cast<float>(opaqueCount);
+
+        // The upper triangle of the covariance matrix of the colors
+        std::array<float, 6> covariance{};
+        for (auto pixel = 0u; pixel < BLOCK_PIXEL_COUNT; pixel++)
+        {
+            if (transparent[pixel])
+                continue;
+
+            const auto r = static_cast<float>(pixels[pixel * 4u + 0u]) - mean[0];
+            const auto g = static_cast<float>(pixels[pixel * 4u + 1u]) - mean[1];
+            const auto b = static_cast<float>(pixels[pixel * 4u + 2u]) - mean[2];
+            covariance[0] += r * r;
+            covariance[1] += r * g;
+            covariance[2] += r * b;
+            covariance[3] += g * g;
+            covariance[4] += g * b;
+            covariance[5] += b * b;
+        }
+
+        // The principal axis is the eigenvector with the biggest eigenvalue, which power iteration converges to
+        std::array<float, 3> axis{maximum[0] - minimum[0], maximum[1] - minimum[1], maximum[2] - minimum[2]};
+        if (axis[0] == 0.0f && axis[1] == 0.0f && axis[2] == 0.0f)
+            axis = {1.0f, 1.0f, 1.0f};
+
+        for (auto iteration = 0u; iteration < POWER_ITERATION_COUNT; iteration++)
+        {
+            const std::array<float, 3> nextAxis{
+                covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2],
+                covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2],
+                covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2],
+            };
+
+            const auto length = std::max({std::abs(nextAxis[0]), std::abs(nextAxis[1]), std::abs(nextAxis[2])});
+            if (length == 0.0f)
+                break;
+
+            axis = {nextAxis[0] / length, nextAxis[1] / length, nextAxis[2] / length};
+        }
+
+        const auto axisLengthSquared = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+        auto minimumProjection = std::numeric_limits<float>::max();
+        auto maximumProjection = std::numeric_limits<float>::lowest();
+        for (auto pixel = 0u; pixel < BLOCK_PIXEL_COUNT; pixel++)
+        {
+            if (transparent[pixel])
+                continue;
+
+            auto projection = 0.0f;
+            for (auto channel = 0u; channel < 3u; channel++)
+                projection += (static_cast<float>(pixels[pixel * 4u + channel]) - mean[channel]) * axis[channel];
+
+            projection /= axisLengthSquared;
+            minimumProjection = std::min(minimumProjection, projection);
+            maximumProjection = std::max(maximumProjection, projection);
+        }
+
+        std::array<float, 3> endpoint0{};
+        std::array<float, 3> endpoint1{};
+        for (auto channel = 0u; channel < 3u; channel++)
+        {
+            endpoint0[channel] = mean[channel] + axis[channel] * maximumProjection;
+            endpoint1[channel] = mean[channel] + axis[channel] * minimumProjection;
+        }
+
+        auto best = CreateColorBlockCandidate(pixels, transparent, PackColor565(endpoint0), PackColor565(endpoint1), fourColors);
+
+        // Refining the endpoints for the chosen indices usually lowers the error a bit further
+        for (auto iteration = 0u; iteration < 2u && best.m_error > 0u; iteration++)
+        {
+            if (!FitEndpointsLeastSquares(pixels, transparent, best.m_indices, best.m_color0 != best.m_color1 && fourColors, endpoint0, endpoint1))
+                break;
+
+            const auto candidate = CreateColorBlockCandidate(pixels, transparent, PackColor565(endpoint0), PackColor565(endpoint1), fourColors);
+            if (candidate.m_error >= best.m_error)
+                break;
+
+            best = candidate;
+        }
+
+        WriteUInt16(block, best.m_color0);
+        WriteUInt16(&block[2], best.m_color1);
+        WriteBits(&block[4], best.m_indices, 4u);
+    }
+
+    uint64_t GetAlphaIndices(const ChannelValues& values, const std::array<uint8_t, 8>& palette, unsigned& totalError)
+    {
+        uint64_t indices = 0u;
+        totalError = 0u;
+
+        for (auto pixel = 0u; pixel < BLOCK_PIXEL_COUNT; pixel++)
+        {
+            auto bestIndex = 0u;
+            auto bestError = std::numeric_limits<unsigned>::max();
+            for (auto index = 0u; index < palette.size(); index++)
+            {
+                const auto difference = static_cast<int>(values[pixel]) - static_cast<int>(palette[index]);
+                const auto error = static_cast<unsigned>(difference * difference);
+                if (error < bestError)
+                {
+                    bestError = error;
+                    bestIndex = index;
+                }
+            }
+
+            indices |= static_cast<uint64_t>(bestIndex) << (pixel * 3u);
+            totalError += bestError;
+        }
+
+        return indices;
+    }
+
+    void EncodeAlphaBlock(const ChannelValues& values, uint8_t* block)
+    {
+        const auto [minimumIt, maximumIt] = std::ranges::minmax_element(values);
+        const auto minimum = *minimumIt;
+        const auto maximum = *maximumIt;
+
+        // Interpolating between the extremes with eight values
+        auto alpha0 = maximum;
+        auto alpha1 = minimum;
+        unsigned error;
+        auto indices = GetAlphaIndices(values, GetAlphaPalette(alpha0, alpha1), error);
+
+        // Six interpolated values between all values except 0 and 255, which have their own palette entries in this mode
+        uint8_t innerMinimum = 255u;
+        uint8_t innerMaximum = 0u;
+        for (const auto value : values)
+        {
+            if (value != 0u && value != 255u)
+            {
+                innerMinimum = std::min(innerMinimum, value);
+                innerMaximum = std::max(innerMaximum, value);
+            }
+        }
+
+        if (error > 0u && innerMinimum <= innerMaximum)
+        {
+            unsigned innerError;
+            const auto innerIndices = GetAlphaIndices(values, GetAlphaPalette(innerMinimum, innerMaximum), innerError);
+            if (innerError < error)
+            {
+                alpha0 = innerMinimum;
+                alpha1 = innerMaximum;
+                indices = innerIndices;
+            }
+        }
+
+        block[0] = alpha0;
+        block[1] = alpha1;
+        WriteBits(&block[2], indices, 6u);
+    }
+
+    void EncodeExplicitAlphaBlock(const BlockPixels& pixels, uint8_t* block)
+    {
+        uint64_t alphas = 0u;
+        for (auto pixel = 0u; pixel < BLOCK_PIXEL_COUNT; pixel++)
+            alphas |= static_cast<uint64_t>((pixels[pixel * 4u + 3u] * 15u + 127u) / 255u) << (pixel * 4u);
+
+        WriteBits(block, alphas, 8u);
+    }
+
+    ChannelValues GetChannelValues(const BlockPixels& pixels, const unsigned channel)
+    {
+        ChannelValues values{};
+        for (auto pixel = 0u; pixel < BLOCK_PIXEL_COUNT; pixel++)
+            values[pixel] = pixels[pixel * 4u + channel];
+
+        return values;
+    }
+} // namespace
+
+namespace block_compression
+{
+    bool SupportsFormat(const ImageFormatId formatId)
+    {
+        switch (formatId)
+        {
+        case ImageFormatId::BC1:
+        case ImageFormatId::BC2:
+        case ImageFormatId::BC3:
+        case ImageFormatId::BC4:
+        case ImageFormatId::BC5:
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    void DecodeBlock(const ImageFormatId formatId, const uint8_t* block, BlockPixels& pixels)
+    {
+        switch (formatId)
+        {
+        case ImageFormatId::BC1:
+            DecodeColorBlock(block, pixels, true);
+            break;
+
+        case ImageFormatId::BC2:
+            DecodeColorBlock(&block[ALPHA_BLOCK_SIZE], pixels, false);
+            DecodeExplicitAlphaBlock(block, pixels);
+            break;
+
+        case ImageFormatId::BC3:
+            DecodeColorBlock(&block[ALPHA_BLOCK_SIZE], pixels, false);
+            DecodeAlphaBlock(block, pixels, 3u);
+            break;
+
+        case ImageFormatId::BC4:
+            pixels.fill(0u);
+            DecodeAlphaBlock(block, pixels, 0u);
+            for (auto pixel = 0u; pixel < BLOCK_PIXEL_COUNT; pixel++)
+                pixels[pixel * 4u + 3u] = 255u;
+            break;
+
+        case ImageFormatId::BC5:
+            pixels.fill(0u);
+            DecodeAlphaBlock(block, pixels, 0u);
+            DecodeAlphaBlock(&block[ALPHA_BLOCK_SIZE], pixels, 1u);
+            for (auto pixel = 0u; pixel < BLOCK_PIXEL_COUNT; pixel++)
+                pixels[pixel * 4u + 3u] = 255u;
+            break;
+
+        default:
+            assert(false);
+            break;
+        }
+    }
+
+    void EncodeBlock(const ImageFormatId formatId, const BlockPixels& pixels, uint8_t* block)
+    {
+        switch (formatId)
+        {
+        case ImageFormatId::BC1:
+            EncodeColorBlock(pixels, block, true);
+            break;
+
+        case ImageFormatId::BC2:
+            EncodeExplicitAlphaBlock(pixels, block);
+            EncodeColorBlock(pixels, &block[ALPHA_BLOCK_SIZE], false);
+            break;
+
+        case ImageFormatId::BC3:
+            EncodeAlphaBlock(GetChannelValues(pixels, 3u), block);
+            EncodeColorBlock(pixels, &block[ALPHA_BLOCK_SIZE], false);
+            break;
+
+        case ImageFormatId::BC4:
+            EncodeAlphaBlock(GetChannelValues(pixels, 0u), block);
+            break;
+
+        case ImageFormatId::BC5:
+            EncodeAlphaBlock(GetChannelValues(pixels, 0u), block);
+            EncodeAlphaBlock(GetChannelValues(pixels, 1u), &block[ALPHA_BLOCK_SIZE]);
+            break;
+
+        default:
+            assert(false);
+            break;
+        }
+    }
+} // namespace block_compression
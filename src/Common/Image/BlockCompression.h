@@ -0,0 +1,40 @@
+#pragma once
+
+#include "ImageFormat.h"
+
+#include <array>
+#include <cstdint>
+
+namespace block_compression
+{
+    constexpr unsigned BLOCK_SIZE = 4u;
+    constexpr unsigned BLOCK_PIXEL_COUNT = BLOCK_SIZE * BLOCK_SIZE;
+
+    // The pixels of a block row by row with the channels r, g, b and a of every pixel as one byte each
+    using BlockPixels = std::array<uint8_t, BLOCK_PIXEL_COUNT * 4u>;
+
+    /**
+     * \brief Returns whether blocks of the specified format can be decoded and encoded.
+     * \param formatId The id of the block compressed format.
+     * \return \c true for BC1 to BC5, otherwise \c false.
+     */
+    bool SupportsFormat(ImageFormatId formatId);
+
+    /**
+     * \brief Decodes a single block. Channels that the format does not store are decoded as \c 0 for colors and \c 255 for alpha.
+     * \param formatId The id of the block compressed format.
+     * \param block The data of the block.
+     * \param pixels The decoded pixels of the block.
+     */
+    void DecodeBlock(ImageFormatId formatId, const uint8_t* block, BlockPixels& pixels);
+
+    /**
+     * \brief Encodes a single block.
+     * Color endpoints are fit along the principal axis of the colors of the block and refined with a least squares fit.
+     * BC1 uses its punch through alpha mode for blocks with pixels whose alpha is below \c 128.
+     * \param formatId The id of the block compressed format.
+     * \param pixels The pixels of the block.
+     * \param block The buffer for the encoded block.
+     */
+    void EncodeBlock(ImageFormatId formatId, const BlockPixels& pixels, uint8_t* block);
+} // namespace block_compression
@@ -0,0 +1,495 @@
+#include "MipMapGenerator.h"
+
+#include "Utils/JobSystem.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <numbers>
+#include <vector>
+
+namespace
+{
+    // Mip levels with less output values than this are filtered on the calling thread since distributing them costs more than it saves
+    constexpr size_t PARALLEL_FILTER_MIN_SIZE = 0x40000;
+
+    // The amount of output values a single job filters
+    constexpr size_t FILTER_BAND_SIZE = 0x10000;
+
+    // The kaiser windowed sinc filter covers this many pixels of the smaller mip level in each direction
+    constexpr float KAISER_WIDTH = 3.0f;
+    constexpr float KAISER_ALPHA = 4.0f;
+
+    class FilterTap
+    {
+    public:
+        size_t m_source_index;
+        float m_weight;
+    };
+
+    // The taps of every output pixel when filtering along one axis
+    using AxisFilter = std::vector<std::vector<FilterTap>>;
+
+    class ChannelLayout
+    {
+    public:
+        unsigned m_byte_offset;
+        bool m_is_alpha;
+    };
+
+    class PixelLayout
+    {
+    public:
+        unsigned m_bytes_per_pixel;
+        std::vector<ChannelLayout> m_channels;
+    };
+
+    bool AddChannel(PixelLayout& layout, const unsigned offset, const unsigned size, const bool isAlpha)
+    {
+        if (size == 0)
+            return true;
+
+        if (size != 8 || offset % 8 != 0)
+            return false;
+
+        layout.m_channels.emplace_back(ChannelLayout{offset / 8, isAlpha});
+        return true;
+    }
+
+    bool GetPixelLayout(const ImageFormat* format, PixelLayout& layout)
+    {
+        // The float format is described as an unsigned one for now but cannot be filtered like one
+        if (format->GetType() != ImageFormatType::UNSIGNED || format->GetId() == ImageFormatId::R16_G16_B16_A16_FLOAT)
+            return false;
+
+        const auto* unsignedFormat = dynamic_cast<const ImageFormatUnsigned*>(format);
+        if (unsignedFormat->m_bits_per_pixel % 8 != 0)
+            return false;
+
+        layout.m_bytes_per_pixel = unsignedFormat->m_bits_per_pixel / 8;
+        layout.m_channels.clear();
+
+        return AddChannel(layout, unsignedFormat->m_r_offset, unsignedFormat->m_r_size, false)
+               && AddChannel(layout, unsignedFormat->m_g_offset, unsignedFormat->m_g_size, false)
+               && AddChannel(layout, unsignedFormat->m_b_offset, unsignedFormat->m_b_size, false)
+               && AddChannel(layout, unsignedFormat->m_a_offset, unsignedFormat->m_a_size, true) && !layout.m_channels.empty();
+    }
+
+    float SrgbToLinear(const float value)
+    {
+        if (value <= 0.04045f)
+            return value / 12.92f;
+
+        return std::pow((value + 0.055f) / 1.055f, 2.4f);
+    }
+
+    float LinearToSrgb(const float value)
+    {
+        if (value <= 0.0031308f)
+            return value * 12.92f;
+
+        return 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+    }
+
+    uint8_t QuantizeChannel(const float value)
+    {
+        return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+    }
+
+    float BesselI0(const float x)
+    {
+        const auto halfX = x * 0.5f;
+        auto sum = 1.0f;
+        auto term = 1.0f;
+
+        for (auto k = 1; k < 32; k++)
+        {
+            const auto factor = halfX / static_cast<float>(k);
+            term *= factor * factor;
+            sum += term;
+
+            if (term < sum * 1e-8f)
+                break;
+        }
+
+        return sum;
+    }
+
+    float Kaiser(const float x)
+    {
+        if (std::abs(x) >= KAISER_WIDTH)
+            return 0.0f;
+
+        const auto piX = std::numbers::pi_v<float> * x;
+        const auto sinc = std::abs(x) < 1e-6f ? 1.0f : std::sin(piX) / piX;
+        const auto t = x / KAISER_WIDTH;
+
+        return sinc * BesselI0(KAISER_ALPHA * std::sqrt(1.0f - t * t)) / BesselI0(KAISER_ALPHA);
+    }
+
+    AxisFilter CreateAxisFilter(const MipMapFilter filter, const size_t sourceSize, const size_t targetSize)
+    {
+        AxisFilter result(targetSize);
+        const auto scale = static_cast<float>(sourceSize) / static_cast<float>(targetSize);
+        const auto maxSourceIndex = static_cast<long long>(sourceSize) - 1;
+
+        for (auto targetIndex = 0u; targetIndex < targetSize; targetIndex++)
+        {
+            auto& taps = result[targetIndex];
+
+            if (filter == MipMapFilter::BOX)
+            {
+                // Every source pixel is weighted by how much of it the target pixel covers
+                const auto start = static_cast<float>(targetIndex) * scale;
+                const auto end = static_cast<float>(targetIndex + 1) * scale;
+                for (auto sourceIndex = static_cast<size_t>(start); sourceIndex < sourceSize && static_cast<float>(sourceIndex) < end; sourceIndex++)
+                {
+                    const auto coverage = std::min(end, static_cast<float>(sourceIndex + 1)) - std::max(start, static_cast<float>(sourceIndex));
+                    if (coverage > 0.0f)
+                        taps.emplace_back(FilterTap{sourceIndex, coverage});
+                }
+            }
+            else
+            {
+                const auto center = (static_cast<float>(targetIndex) + 0.5f) * scale;
+                const auto radius = KAISER_WIDTH * scale;
+                const auto first = static_cast<long long>(std::floor(center - radius));
+                const auto last = static_cast<long long>(std::ceil(center + radius));
+                for (auto sourceIndex = first; sourceIndex <= last; sourceIndex++)
+                {
+                    const auto weight = Kaiser((static_cast<float>(sourceIndex) + 0.5f - center) / scale);
+                    if (weight == 0.0f)
+                        continue;
+
+                    // Pixels outside of the mip level repeat its border
+                    const auto clampedIndex = static_cast<size_t>(std::clamp(sourceIndex, 0ll, maxSourceIndex));
+                    if (!taps.empty() && taps.back().m_source_index == clampedIndex)
+                        taps.back().m_weight += weight;
+                    else
+                        taps.emplace_back(FilterTap{clampedIndex, weight});
+                }
+            }
+
+            auto totalWeight = 0.0f;
+            for (const auto& tap : taps)
+                totalWeight += tap.m_weight;
+
+            if (totalWeight != 0.0f)
+            {
+                for (auto& tap : taps)
+                    tap.m_weight /= totalWeight;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * \brief Filters rows of pixels horizontally.
+     * The channel count is known at compile time which lets the compiler unroll and vectorize the loop over the channels for the target instruction set.
+     */
+    template<unsigned ChannelCount>
+    void FilterRowsHorizontally(const float* input, float* output, const size_t sourceWidth, const AxisFilter& filter, const size_t rowCount)
+    {
+        const auto targetWidth = filter.size();
+
+        for (size_t row = 0u; row < rowCount; row++)
+        {
+            const auto* inputRow = &input[row * sourceWidth * ChannelCount];
+            auto* outputRow = &output[row * targetWidth * ChannelCount];
+
+            for (size_t x = 0u; x < targetWidth; x++)
+            {
+                std::array<float, ChannelCount> value{};
+                for (const auto& tap : filter[x])
+                {
+                    const auto* inputPixel = &inputRow[tap.m_source_index * ChannelCount];
+                    for (auto channel = 0u; channel < ChannelCount; channel++)
+                        value[channel] += inputPixel[channel] * tap.m_weight;
+                }
+
+                for (auto channel = 0u; channel < ChannelCount; channel++)
+                    outputRow[x * ChannelCount + channel] = value[channel];
+            }
+        }
+    }
+
+    using horizontal_filter_func_t = void (*)(const float* input, float* output, size_t sourceWidth, const AxisFilter& filter, size_t rowCount);
+
+    horizontal_filter_func_t GetHorizontalFilterFunction(const size_t channelCount)
+    {
+        switch (channelCount)
+        {
+        case 1:
+            return &FilterRowsHorizontally<1>;
+        case 2:
+            return &FilterRowsHorizontally<2>;
+        case 3:
+            return &FilterRowsHorizontally<3>;
+        default:
+            assert(channelCount == 4);
+            return &FilterRowsHorizontally<4>;
+        }
+    }
+
+    /**
+     * \brief Filters vertically or along the depth by adding up whole rows or slices, which keeps the inner loop contiguous and vectorizable.
+     */
+    void CombineLines(const float* input, float* output, const size_t lineLength, const std::vector<FilterTap>& taps)
+    {
+        std::fill_n(output, lineLength, 0.0f);
+
+        for (const auto& tap : taps)
+        {
+            const auto* inputLine = &input[tap.m_source_index * lineLength];
+            const auto weight = tap.m_weight;
+
+            for (size_t i = 0u; i < lineLength; i++)
+                output[i] += inputLine[i] * weight;
+        }
+    }
+
+    /**
+     * \brief Runs jobs that do not depend on each other, in parallel if there is enough work to distribute.
+     * \param jobs The jobs to run.
+     * \param totalSize The amount of values all jobs produce together.
+     */
+    void RunJobs(const std::vector<std::function<void()>>& jobs, const size_t totalSize)
+    {
+        if (totalSize < PARALLEL_FILTER_MIN_SIZE || jobs.size() <= 1u)
+        {
+            for (const auto& job : jobs)
+                job();
+
+            return;
+        }
+
+        // Other generators may use the job system at the same time so only wait for the jobs of this one
+        JobSystem::TaskGroup group;
+        for (const auto& job : jobs)
+        {
+            group.Run(
+                [&job]
+                {
+                    job();
+                });
+        }
+
+        group.Wait();
+    }
+
+    size_t GetBandLineCount(const size_t lineLength)
+    {
+        return std::max<size_t>(FILTER_BAND_SIZE / std::max<size_t>(lineLength, 1u), 1u);
+    }
+} // namespace
+
+MipMapGenerator::MipMapGenerator(Texture* inputTexture, const MipMapFilter filter, const bool srgb)
+    : m_input_texture(inputTexture),
+      m_filter(filter),
+      m_srgb(srgb)
+{
+}
+
+bool MipMapGenerator::SupportsFormat(const ImageFormat* format)
+{
+    PixelLayout layout;
+    return GetPixelLayout(format, layout);
+}
+
+Texture* MipMapGenerator::Generate() const
+{
+    PixelLayout layout;
+    if (!GetPixelLayout(m_input_texture->GetFormat(), layout))
+        return nullptr;
+
+    Texture* outputTexture;
+    switch (m_input_texture->GetTextureType())
+    {
+    case TextureType::T_2D:
+        outputTexture = new Texture2D(m_input_texture->GetFormat(), m_input_texture->GetWidth(), m_input_texture->GetHeight(), true);
+        break;
+
+    case TextureType::T_CUBE:
+        outputTexture = new TextureCube(m_input_texture->GetFormat(), m_input_texture->GetWidth(), m_input_texture->GetHeight(), true);
+        break;
+
+    case TextureType::T_3D:
+        outputTexture =
+            new Texture3D(m_input_texture->GetFormat(), m_input_texture->GetWidth(), m_input_texture->GetHeight(), m_input_texture->GetDepth(), true);
+        break;
+
+    default:
+        assert(false);
+        return nullptr;
+    }
+
+    outputTexture->Allocate();
+
+    const auto faceCount = outputTexture->GetFaceCount();
+    const auto channelCount = layout.m_channels.size();
+    std::memcpy(outputTexture->GetBufferForMipLevel(0), m_input_texture->GetBufferForMipLevel(0), m_input_texture->GetSizeOfMipLevel(0) * faceCount);
+
+    std::array<float, 256> colorToLinear{};
+    std::array<float, 256> alphaToLinear{};
+    for (auto i = 0u; i < 256u; i++)
+    {
+        alphaToLinear[i] = static_cast<float>(i) / 255.0f;
+        colorToLinear[i] = m_srgb ? SrgbToLinear(alphaToLinear[i]) : alphaToLinear[i];
+    }
+
+    size_t width = m_input_texture->GetWidth();
+    size_t height = m_input_texture->GetHeight();
+    size_t depth = m_input_texture->GetDepth();
+
+    // Every face is filtered in linear floating point values, with the channels of a pixel next to each other
+    std::vector<std::vector<float>> faces(faceCount, std::vector<float>(width * height * depth * channelCount));
+    std::vector<std::function<void()>> jobs;
+    for (auto face = 0; face < faceCount; face++)
+    {
+        jobs.emplace_back(
+            [&, face]
+            {
+                const auto* input = m_input_texture->GetBufferForMipLevel(0, face);
+                auto* output = faces[face].data();
+                const auto pixelCount = width * height * depth;
+
+                for (size_t pixel = 0u; pixel < pixelCount; pixel++)
+                {
+                    const auto* inputPixel = &input[pixel * layout.m_bytes_per_pixel];
+                    for (auto channel = 0u; channel < channelCount; channel++)
+                    {
+                        const auto& channelLayout = layout.m_channels[channel];
+                        const auto& table = channelLayout.m_is_alpha ? alphaToLinear : colorToLinear;
+                        output[pixel * channelCount + channel] = table[inputPixel[channelLayout.m_byte_offset]];
+                    }
+                }
+            });
+    }
+    RunJobs(jobs, width * height * depth * channelCount * faceCount);
+
+    const auto filterHorizontally = GetHorizontalFilterFunction(channelCount);
+    const auto mipCount = outputTexture->GetMipMapCount();
+    for (auto mipLevel = 1; mipLevel < mipCount; mipLevel++)
+    {
+        const auto targetWidth = std::max<size_t>(m_input_texture->GetWidth() >> mipLevel, 1u);
+        const auto targetHeight = std::max<size_t>(m_input_texture->GetHeight() >> mipLevel, 1u);
+        const auto targetDepth = std::max<size_t>(m_input_texture->GetDepth() >> mipLevel, 1u);
+
+        if (targetWidth != width)
+        {
+            const auto filter = CreateAxisFilter(m_filter, width, targetWidth);
+            const auto rowCount = height * depth;
+            const auto bandRowCount = GetBandLineCount(targetWidth * channelCount);
+            std::vector<std::vector<float>> filteredFaces(faceCount, std::vector<float>(targetWidth * rowCount * channelCount));
+
+            jobs.clear();
+            for (auto face = 0; face < faceCount; face++)
+            {
+                for (size_t row = 0u; row < rowCount; row += bandRowCount)
+                {
+                    const auto* input = &faces[face][row * width * channelCount];
+                    auto* output = &filteredFaces[face][row * targetWidth * channelCount];
+                    const auto bandSize = std::min(bandRowCount, rowCount - row);
+                    jobs.emplace_back(
+                        [filterHorizontally, input, output, width, &filter, bandSize]
+                        {
+                            filterHorizontally(input, output, width, filter, bandSize);
+                        });
+                }
+            }
+            RunJobs(jobs, targetWidth * rowCount * channelCount * faceCount);
+
+            faces = std::move(filteredFaces);
+            width = targetWidth;
+        }
+
+        if (targetHeight != height)
+        {
+            const auto filter = CreateAxisFilter(m_filter, height, targetHeight);
+            const auto rowLength = width * channelCount;
+            const auto bandRowCount = GetBandLineCount(rowLength);
+            std::vector<std::vector<float>> filteredFaces(faceCount, std::vector<float>(rowLength * targetHeight * depth));
+
+            jobs.clear();
+            for (auto face = 0; face < faceCount; face++)
+            {
+                for (size_t slice = 0u; slice < depth; slice++)
+                {
+                    const auto* input = &faces[face][slice * height * rowLength];
+                    auto* output = &filteredFaces[face][slice * targetHeight * rowLength];
+                    for (size_t row = 0u; row < targetHeight; row += bandRowCount)
+                    {
+                        const auto bandEnd = std::min(row + bandRowCount, targetHeight);
+                        jobs.emplace_back(
+                            [input, output, rowLength, &filter, row, bandEnd]
+                            {
+                                for (auto targetRow = row; targetRow < bandEnd; targetRow++)
+                                    CombineLines(input, &output[targetRow * rowLength], rowLength, filter[targetRow]);
+                            });
+                    }
+                }
+            }
+            RunJobs(jobs, rowLength * targetHeight * depth * faceCount);
+
+            faces = std::move(filteredFaces);
+            height = targetHeight;
+        }
+
+        if (targetDepth != depth)
+        {
+            const auto filter = CreateAxisFilter(m_filter, depth, targetDepth);
+            const auto sliceLength = width * height * channelCount;
+            std::vector<std::vector<float>> filteredFaces(faceCount, std::vector<float>(sliceLength * targetDepth));
+
+            jobs.clear();
+            for (auto face = 0; face < faceCount; face++)
+            {
+                for (size_t slice = 0u; slice < targetDepth; slice++)
+                {
+                    const auto* input = faces[face].data();
+                    auto* output = &filteredFaces[face][slice * sliceLength];
+                    jobs.emplace_back(
+                        [input, output, sliceLength, &filter, slice]
+                        {
+                            CombineLines(input, output, sliceLength, filter[slice]);
+                        });
+                }
+            }
+            RunJobs(jobs, sliceLength * targetDepth * faceCount);
+
+            faces = std::move(filteredFaces);
+            depth = targetDepth;
+        }
+
+        jobs.clear();
+        for (auto face = 0; face < faceCount; face++)
+        {
+            jobs.emplace_back(
+                [&, face, mipLevel]
+                {
+                    const auto* input = faces[face].data();
+                    auto* output = outputTexture->GetBufferForMipLevel(mipLevel, face);
+                    const auto pixelCount = width * height * depth;
+
+                    for (size_t pixel = 0u; pixel < pixelCount; pixel++)
+                    {
+                        auto* outputPixel = &output[pixel * layout.m_bytes_per_pixel];
+                        for (auto channel = 0u; channel < channelCount; channel++)
+                        {
+                            const auto& channelLayout = layout.m_channels[channel];
+                            const auto value = input[pixel * channelCount + channel];
+                            outputPixel[channelLayout.m_byte_offset] =
+                                QuantizeChannel(m_srgb && !channelLayout.m_is_alpha ? LinearToSrgb(std::max(value, 0.0f)) : value);
+                        }
+                    }
+                });
+        }
+        RunJobs(jobs, width * height * depth * channelCount * faceCount);
+    }
+
+    return outputTexture;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Texture.h"
+
+enum class MipMapFilter
+{
+    BOX,
+    KAISER
+};
+
+class MipMapGenerator
+{
+    Texture* m_input_texture;
+    MipMapFilter m_filter;
+    bool m_srgb;
+
+public:
+    /**
+     * \brief Creates a generator for the mip levels of a texture.
+     * \param inputTexture The texture whose first mip level the other mip levels are generated from.
+     * \param filter The filter to downsample mip levels with.
+     * \param srgb Whether the color channels of the texture are sRGB encoded. They are filtered in linear space then, while alpha always is.
+     */
+    MipMapGenerator(Texture* inputTexture, MipMapFilter filter, bool srgb);
+
+    /**
+     * \brief Returns whether mip levels can be generated for textures of the specified format.
+     * Only uncompressed formats with 8 bit channels are supported.
+     * \param format The format to check.
+     * \return \c true if the format is supported, otherwise \c false.
+     */
+    static bool SupportsFormat(const ImageFormat* format);
+
+    /**
+     * \brief Creates a texture with a full chain of mip levels, which are generated from the first mip level of the input texture.
+     * Every mip level is filtered from the previous one. The faces of a mip level and bands of its pixels are filtered in parallel for large textures.
+     * \return The new texture, which must be deleted by the caller, or \c nullptr if the format of the input texture is not supported.
+     */
+    Texture* Generate() const;
+};
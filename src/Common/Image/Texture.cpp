@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <utility>
 
 // ==============================================
 // ================= Texture ====================
@@ -12,6 +13,7 @@ Texture::Texture(const ImageFormat* format, const bool mipMaps)
     m_format = format;
     m_has_mip_maps = mipMaps;
     m_data = nullptr;
+    m_owns_data = false;
 }
 
 Texture::Texture(Texture&& other) noexcept
@@ -19,8 +21,11 @@ Texture::Texture(Texture&& other) noexcept
     m_format = other.m_format;
     m_has_mip_maps = other.m_has_mip_maps;
     m_data = other.m_data;
+    m_owns_data = other.m_owns_data;
+    m_mip_level_offsets = std::move(other.m_mip_level_offsets);
 
     other.m_data = nullptr;
+    other.m_owns_data = false;
 }
 
 Texture& Texture::operator=(Texture&& other) noexcept
@@ -28,15 +33,19 @@ Texture& Texture::operator=(Texture&& other) noexcept
     m_format = other.m_format;
     m_has_mip_maps = other.m_has_mip_maps;
     m_data = other.m_data;
+    m_owns_data = other.m_owns_data;
+    m_mip_level_offsets = std::move(other.m_mip_level_offsets);
 
     other.m_data = nullptr;
+    other.m_owns_data = false;
 
     return *this;
 }
 
 Texture::~Texture()
 {
-    delete[] m_data;
+    if (m_owns_data)
+        delete[] m_data;
     m_data = nullptr;
 }
 
@@ -55,13 +64,38 @@ void Texture::Allocate()
         storageRequirement += GetSizeOfMipLevel(currentMipLevel) * GetFaceCount();
     }
 
+    m_mip_level_offsets.clear();
+
     if (storageRequirement > 0)
     {
         m_data = new uint8_t[storageRequirement];
+        m_owns_data = true;
         memset(m_data, 0, storageRequirement);
     }
 }
 
+void Texture::AttachData(uint8_t* data)
+{
+    if (m_owns_data)
+        delete[] m_data;
+
+    m_data = data;
+    m_owns_data = false;
+    m_mip_level_offsets.clear();
+}
+
+void Texture::AttachMipLevels(uint8_t* data, std::vector<size_t> mipLevelOffsets, const bool ownsData)
+{
+    assert(static_cast<int>(mipLevelOffsets.size()) == (m_has_mip_maps ? GetMipMapCount() : 1));
+
+    if (m_owns_data)
+        delete[] m_data;
+
+    m_data = data;
+    m_owns_data = ownsData;
+    m_mip_level_offsets = std::move(mipLevelOffsets);
+}
+
 bool Texture::Empty() const
 {
     return m_data == nullptr;
@@ -174,6 +208,9 @@ uint8_t* Texture2D::GetBufferForMipLevel(const int mipLevel, const int face)
     if (!m_data)
         return nullptr;
 
+    if (!m_mip_level_offsets.empty())
+        return &m_data[m_mip_level_offsets[mipLevel]];
+
     size_t bufferOffset = 0;
     for (int previousMipLevel = 0; previousMipLevel < mipLevel; previousMipLevel++)
     {
@@ -242,6 +279,9 @@ uint8_t* TextureCube::GetBufferForMipLevel(const int mipLevel, const int face)
     if (!m_data)
         return nullptr;
 
+    if (!m_mip_level_offsets.empty())
+        return &m_data[m_mip_level_offsets[mipLevel] + GetSizeOfMipLevel(mipLevel) * face];
+
     size_t bufferOffset = 0;
     for (int previousMipLevel = 0; previousMipLevel < mipLevel; previousMipLevel++)
     {
@@ -352,6 +392,9 @@ uint8_t* Texture3D::GetBufferForMipLevel(const int mipLevel, const int face)
     if (!m_data)
         return nullptr;
 
+    if (!m_mip_level_offsets.empty())
+        return &m_data[m_mip_level_offsets[mipLevel]];
+
     size_t bufferOffset = 0;
     for (int previousMipLevel = 0; previousMipLevel < mipLevel; previousMipLevel++)
     {
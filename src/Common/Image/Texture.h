@@ -1,7 +1,9 @@
 #pragma once
 #include "ImageFormat.h"
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 enum class TextureType
 {
@@ -16,6 +18,8 @@ protected:
     const ImageFormat* m_format;
     bool m_has_mip_maps;
     uint8_t* m_data;
+    bool m_owns_data;
+    std::vector<size_t> m_mip_level_offsets;
 
     Texture(const ImageFormat* format, bool mipMaps);
     Texture(Texture&& other) noexcept;
@@ -37,6 +41,22 @@ public:
     virtual int GetFaceCount() const = 0;
 
     void Allocate();
+
+    /**
+     * \brief Uses an existing buffer as the data of the texture instead of allocating and copying it.
+     * The buffer must be laid out the same way as an allocated one. It is not freed by the texture and must outlive it.
+     * \param data The buffer containing the data of all mip levels and faces.
+     */
+    void AttachData(uint8_t* data);
+
+    /**
+     * \brief Uses an existing buffer that contains the mip levels at arbitrary offsets as the data of the texture, for example the contents of an image file.
+     * The faces of a mip level must follow each other directly. Buffers of read only memory must not be written to through the texture.
+     * \param data The buffer containing the data of all mip levels.
+     * \param mipLevelOffsets The offset of every mip level inside the buffer, starting with mip level \c 0.
+     * \param ownsData If \c true the buffer was allocated with \c new[] and is freed by the texture, otherwise it must outlive the texture.
+     */
+    void AttachMipLevels(uint8_t* data, std::vector<size_t> mipLevelOffsets, bool ownsData);
     bool Empty() const;
 
     virtual size_t GetSizeOfMipLevel(int mipLevel) const = 0;
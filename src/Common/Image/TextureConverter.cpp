@@ -1,6 +1,197 @@
 #include "TextureConverter.h"
 
+#include "BlockCompression.h"
+#include "Utils/JobSystem.h"
+
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <vector>
+
+namespace
+{
+    // Textures smaller than this amount of bytes are converted on the calling thread since distributing them costs more than it saves
+    constexpr size_t PARALLEL_CONVERSION_MIN_SIZE = 0x100000;
+
+    // The amount of input bytes a single job converts
+    constexpr size_t CONVERSION_BAND_SIZE = 0x40000;
+
+    constexpr auto NO_SOURCE_BYTE = -1;
+
+    /**
+     * \brief Converts pixels whose channels are whole bytes by copying every output byte from a fixed input byte.
+     * The layout is known at compile time which lets the compiler unroll and vectorize the loop for the target instruction set.
+     * \tparam InputBytesPerPixel The size of an input pixel in bytes.
+     * \tparam SourceBytes For every output byte the input byte to copy from or \c NO_SOURCE_BYTE to set it to zero.
+     */
+    template<unsigned InputBytesPerPixel, int... SourceBytes> void ShufflePixelBytes(const uint8_t* input, uint8_t* output, const size_t pixelCount)
+    {
+        constexpr std::array<int, sizeof...(SourceBytes)> sourceBytes{SourceBytes...};
+        constexpr auto outputBytesPerPixel = sizeof...(SourceBytes);
+
+        for (size_t pixel = 0u; pixel < pixelCount; pixel++)
+        {
+            const auto* inputPixel = &input[pixel * InputBytesPerPixel];
+            auto* outputPixel = &output[pixel * outputBytesPerPixel];
+
+            for (auto outputByte = 0u; outputByte < outputBytesPerPixel; outputByte++)
+                outputPixel[outputByte] = sourceBytes[outputByte] == NO_SOURCE_BYTE ? 0u : inputPixel[sourceBytes[outputByte]];
+        }
+    }
+
+    class PixelShuffleKernel
+    {
+    public:
+        unsigned m_input_bytes_per_pixel;
+        std::vector<int> m_source_bytes;
+        void (*m_function)(const uint8_t* input, uint8_t* output, size_t pixelCount);
+    };
+
+    template<unsigned InputBytesPerPixel, int... SourceBytes> PixelShuffleKernel CreateKernel()
+    {
+        return PixelShuffleKernel{InputBytesPerPixel, {SourceBytes...}, &ShufflePixelBytes<InputBytesPerPixel, SourceBytes...>};
+    }
+
+    // Byte layouts of the conversions that are commonly done when dumping images
+    const PixelShuffleKernel PIXEL_SHUFFLE_KERNELS[]{
+        // B8_G8_R8_A8 <-> R8_G8_B8_A8
+        CreateKernel<4, 2, 1, 0, 3>(),
+        // R8_G8_B8 -> B8_G8_R8_X8
+        CreateKernel<3, 2, 1, 0, NO_SOURCE_BYTE>(),
+        // B8_G8_R8_X8 -> R8_G8_B8
+        CreateKernel<4, 2, 1, 0>(),
+    };
+
+    bool IsByteAlignedChannel(const unsigned offset, const unsigned size)
+    {
+        return size == 0 || (size == 8 && offset % 8 == 0);
+    }
+
+    bool IsByteAlignedFormat(const ImageFormatUnsigned* format)
+    {
+        return format->m_bits_per_pixel % 8 == 0 && format->m_bits_per_pixel <= 64 && IsByteAlignedChannel(format->m_r_offset, format->m_r_size)
+               && IsByteAlignedChannel(format->m_g_offset, format->m_g_size) && IsByteAlignedChannel(format->m_b_offset, format->m_b_size)
+               && IsByteAlignedChannel(format->m_a_offset, format->m_a_size);
+    }
+
+    /**
+     * \brief Determines from which input byte every output byte is copied when reordering channels that are whole bytes.
+     * \return The source byte for every output byte or an empty vector if the formats are not made up of whole byte channels.
+     */
+    std::vector<int> GetSourceBytes(const ImageFormatUnsigned* inputFormat, const ImageFormatUnsigned* outputFormat)
+    {
+        if (!IsByteAlignedFormat(inputFormat) || !IsByteAlignedFormat(outputFormat))
+            return {};
+
+        std::vector<int> sourceBytes(outputFormat->m_bits_per_pixel / 8, NO_SOURCE_BYTE);
+        const auto setSourceByte = [&sourceBytes](const unsigned inputOffset, const unsigned outputOffset, const unsigned inputSize, const unsigned outputSize)
+        {
+            if (inputSize > 0 && outputSize > 0)
+                sourceBytes[outputOffset / 8] = static_cast<int>(inputOffset / 8);
+        };
+
+        setSourceByte(inputFormat->m_r_offset, outputFormat->m_r_offset, inputFormat->m_r_size, outputFormat->m_r_size);
+        setSourceByte(inputFormat->m_g_offset, outputFormat->m_g_offset, inputFormat->m_g_size, outputFormat->m_g_size);
+        setSourceByte(inputFormat->m_b_offset, outputFormat->m_b_offset, inputFormat->m_b_size, outputFormat->m_b_size);
+        setSourceByte(inputFormat->m_a_offset, outputFormat->m_a_offset, inputFormat->m_a_size, outputFormat->m_a_size);
+
+        return sourceBytes;
+    }
+
+    /**
+     * \brief Runs the bands of a conversion, in parallel on the job system if the converted data is large enough.
+     * \param bands The jobs that each convert a part of the texture.
+     * \param totalSize The amount of input bytes of the whole conversion.
+     */
+    void RunBands(const std::vector<std::function<void()>>& bands, const size_t totalSize)
+    {
+        if (totalSize < PARALLEL_CONVERSION_MIN_SIZE || bands.size() <= 1u)
+        {
+            for (const auto& band : bands)
+                band();
+
+            return;
+        }
+
+        // Other conversions may use the job system at the same time so only wait for the bands of this one
+        JobSystem::TaskGroup group;
+        for (const auto& band : bands)
+        {
+            group.Run(
+                [&band]
+                {
+                    band();
+                });
+        }
+
+        group.Wait();
+    }
+
+    /**
+     * \brief Converts between the pixels of an uncompressed format and the r, g, b and a bytes block compression works with.
+     * Channels with less than 8 bits are scaled, channels the format does not have are read as \c 0 for colors and \c 255 for alpha.
+     */
+    class UnsignedPixelCodec
+    {
+    public:
+        explicit UnsignedPixelCodec(const ImageFormatUnsigned* format)
+            : m_bytes_per_pixel(format->m_bits_per_pixel / 8u),
+              m_offsets{format->m_r_offset, format->m_g_offset, format->m_b_offset, format->m_a_offset},
+              m_sizes{format->m_r_size, format->m_g_size, format->m_b_size, format->m_a_size}
+        {
+        }
+
+        void Read(const uint8_t* input, uint8_t* rgba) const
+        {
+            uint64_t pixel = 0u;
+            for (auto i = 0u; i < m_bytes_per_pixel; i++)
+                pixel |= static_cast<uint64_t>(input[i]) << (i * 8u);
+
+            for (auto channel = 0u; channel < 4u; channel++)
+            {
+                const auto size = m_sizes[channel];
+                if (size == 0u)
+                {
+                    rgba[channel] = channel == 3u ? 255u : 0u;
+                    continue;
+                }
+
+                const auto maxValue = MaxValue(size);
+                const auto value = (pixel >> m_offsets[channel]) & maxValue;
+                rgba[channel] = static_cast<uint8_t>(size == 8u ? value : (value * 255u + maxValue / 2u) / maxValue);
+            }
+        }
+
+        void Write(uint8_t* output, const uint8_t* rgba) const
+        {
+            uint64_t pixel = 0u;
+            for (auto channel = 0u; channel < 4u; channel++)
+            {
+                const auto size = m_sizes[channel];
+                if (size == 0u)
+                    continue;
+
+                const auto maxValue = MaxValue(size);
+                const uint64_t value = size == 8u ? rgba[channel] : (rgba[channel] * maxValue + 127u) / 255u;
+                pixel |= value << m_offsets[channel];
+            }
+
+            for (auto i = 0u; i < m_bytes_per_pixel; i++)
+                output[i] = static_cast<uint8_t>(pixel >> (i * 8u));
+        }
+
+        unsigned m_bytes_per_pixel;
+
+    private:
+        static uint64_t MaxValue(const unsigned size)
+        {
+            return size >= 64u ? UINT64_MAX : (1ull << size) - 1u;
+        }
+
+        std::array<unsigned, 4> m_offsets;
+        std::array<unsigned, 4> m_sizes;
+    };
+} // namespace
 
 constexpr uint64_t TextureConverter::Mask1(const unsigned length)
 {
@@ -42,7 +233,7 @@ void TextureConverter::SetPixelFunctions(const unsigned inBitCount, const unsign
             {
                 uint64_t result = 0;
 
-                for (auto pixelOffset = 0u; pixelOffset < bitCount; pixelOffset += 8)
+                for (size_t pixelOffset = 0u; pixelOffset < bitCount; pixelOffset += 8)
                 {
                     result |= (static_cast<uint64_t>(*(static_cast<const uint8_t*>(offset) + (pixelOffset / 8))) << pixelOffset);
                 }
@@ -89,7 +280,7 @@ void TextureConverter::SetPixelFunctions(const unsigned inBitCount, const unsign
         {
             m_write_pixel_func = [](void* offset, const uint64_t pixel, const unsigned bitCount)
             {
-                for (auto pixelOffset = 0u; pixelOffset < bitCount; pixelOffset += 8)
+                for (size_t pixelOffset = 0u; pixelOffset < bitCount; pixelOffset += 8)
                 {
                     *(static_cast<uint8_t*>(offset) + (pixelOffset / 8)) = static_cast<uint8_t>(pixel >> pixelOffset);
                 }
@@ -136,11 +327,126 @@ void TextureConverter::CreateOutputTexture()
     m_output_texture->Allocate();
 }
 
+void TextureConverter::ForEachPixelBand(const size_t inputBytesPerPixel,
+                                        const size_t outputBytesPerPixel,
+                                        const std::function<void(const uint8_t* input, uint8_t* output, size_t pixelCount)>& convert) const
+{
+    if (inputBytesPerPixel == 0u)
+        return;
+
+    // All faces of a mip level are stored consecutively so they are split into bands together
+    std::vector<std::function<void()>> bands;
+    size_t totalSize = 0u;
+    const auto mipCount = m_input_texture->HasMipMaps() ? m_input_texture->GetMipMapCount() : 1;
+    for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
+    {
+        const auto mipLevelSize = m_input_texture->GetSizeOfMipLevel(mipLevel) * m_input_texture->GetFaceCount();
+        const auto* inputBuffer = m_input_texture->GetBufferForMipLevel(mipLevel);
+        auto* outputBuffer = m_output_texture->GetBufferForMipLevel(mipLevel);
+        const auto pixelCount = mipLevelSize / inputBytesPerPixel;
+        const auto bandPixelCount = std::max<size_t>(CONVERSION_BAND_SIZE / inputBytesPerPixel, 1u);
+
+        for (size_t pixelOffset = 0u; pixelOffset < pixelCount; pixelOffset += bandPixelCount)
+        {
+            const auto* bandInput = &inputBuffer[pixelOffset * inputBytesPerPixel];
+            auto* bandOutput = &outputBuffer[pixelOffset * outputBytesPerPixel];
+            const auto bandSize = std::min(bandPixelCount, pixelCount - pixelOffset);
+            bands.emplace_back(
+                [&convert, bandInput, bandOutput, bandSize]
+                {
+                    convert(bandInput, bandOutput, bandSize);
+                });
+        }
+
+        totalSize += mipLevelSize;
+    }
+
+    RunBands(bands, totalSize);
+}
+
+void TextureConverter::ForEachBlockBand(const std::function<void(const BlockBand& band)>& convert) const
+{
+    const auto decoding = m_input_format->GetType() == ImageFormatType::BLOCK_COMPRESSED;
+    const auto* compressedFormat = dynamic_cast<const ImageFormatBlockCompressed*>(decoding ? m_input_format : m_output_format);
+    const auto* uncompressedFormat = dynamic_cast<const ImageFormatUnsigned*>(decoding ? m_output_format : m_input_format);
+    auto* compressedTexture = decoding ? m_input_texture : m_output_texture;
+    auto* uncompressedTexture = decoding ? m_output_texture : m_input_texture;
+
+    const auto blockBytes = compressedFormat->m_bits_per_block / 8u;
+    const auto bandBlockRowCount = std::max<size_t>(1u, CONVERSION_BAND_SIZE / (blockBytes * block_compression::BLOCK_PIXEL_COUNT * 4u));
+
+    // Blocks cover a single slice of a single face, so every slice of a 3D texture and every face of a cube is split into bands on its own
+    std::vector<std::function<void()>> bands;
+    size_t totalSize = 0u;
+    const auto mipCount = m_input_texture->HasMipMaps() ? m_input_texture->GetMipMapCount() : 1;
+    for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
+    {
+        const auto width = std::max(m_input_texture->GetWidth() >> mipLevel, 1u);
+        const auto height = std::max(m_input_texture->GetHeight() >> mipLevel, 1u);
+        const auto depth = std::max(m_input_texture->GetDepth() >> mipLevel, 1u);
+        const auto imageCount = static_cast<size_t>(depth) * static_cast<size_t>(m_input_texture->GetFaceCount());
+        const auto blocksPerRow = (width + block_compression::BLOCK_SIZE - 1u) / block_compression::BLOCK_SIZE;
+        const auto blockRowCount = (height + block_compression::BLOCK_SIZE - 1u) / block_compression::BLOCK_SIZE;
+        const auto compressedImageSize = static_cast<size_t>(blocksPerRow) * blockRowCount * blockBytes;
+        const auto uncompressedImageSize = static_cast<size_t>(width) * height * (uncompressedFormat->m_bits_per_pixel / 8u);
+
+        auto* compressedBuffer = compressedTexture->GetBufferForMipLevel(mipLevel);
+        auto* uncompressedBuffer = uncompressedTexture->GetBufferForMipLevel(mipLevel);
+
+        for (size_t image = 0u; image < imageCount; image++)
+        {
+            for (size_t firstBlockRow = 0u; firstBlockRow < blockRowCount; firstBlockRow += bandBlockRowCount)
+            {
+                const BlockBand band{
+                    &compressedBuffer[image * compressedImageSize],
+                    &uncompressedBuffer[image * uncompressedImageSize],
+                    width,
+                    height,
+                    static_cast<unsigned>(firstBlockRow),
+                    static_cast<unsigned>(std::min<size_t>(firstBlockRow + bandBlockRowCount, blockRowCount)),
+                };
+                bands.emplace_back(
+                    [&convert, band]
+                    {
+                        convert(band);
+                    });
+            }
+        }
+
+        totalSize += compressedImageSize * imageCount;
+    }
+
+    // Blocks are a lot more expensive to convert than pixels, so the compressed size is what decides whether to go parallel
+    RunBands(bands, totalSize);
+}
+
+bool TextureConverter::ReorderUnsignedToUnsignedWithKernel() const
+{
+    const auto* inputFormat = dynamic_cast<const ImageFormatUnsigned*>(m_input_format);
+    const auto* outputFormat = dynamic_cast<const ImageFormatUnsigned*>(m_output_format);
+
+    const auto sourceBytes = GetSourceBytes(inputFormat, outputFormat);
+    if (sourceBytes.empty())
+        return false;
+
+    const auto inputBytePerPixel = inputFormat->m_bits_per_pixel / 8;
+    const auto* kernel = std::ranges::find_if(PIXEL_SHUFFLE_KERNELS,
+                                              [inputBytePerPixel, &sourceBytes](const PixelShuffleKernel& kernelEntry)
+                                              {
+                                                  return kernelEntry.m_input_bytes_per_pixel == inputBytePerPixel && kernelEntry.m_source_bytes == sourceBytes;
+                                              });
+    if (kernel == std::end(PIXEL_SHUFFLE_KERNELS))
+        return false;
+
+    ForEachPixelBand(inputBytePerPixel, outputFormat->m_bits_per_pixel / 8, kernel->m_function);
+
+    return true;
+}
+
 void TextureConverter::ReorderUnsignedToUnsigned() const
 {
     const auto* inputFormat = dynamic_cast<const ImageFormatUnsigned*>(m_input_format);
     const auto* outputFormat = dynamic_cast<const ImageFormatUnsigned*>(m_output_format);
-    const auto mipCount = m_input_texture->HasMipMaps() ? m_input_texture->GetMipMapCount() : 1;
 
     const auto rInputMask = inputFormat->HasR() ? Mask1(inputFormat->m_r_size) << inputFormat->m_r_offset : 0;
     const auto gInputMask = inputFormat->HasG() ? Mask1(inputFormat->m_g_size) << inputFormat->m_g_offset : 0;
@@ -151,33 +457,30 @@ void TextureConverter::ReorderUnsignedToUnsigned() const
     const bool bConvert = bInputMask != 0 && outputFormat->m_b_size > 0;
     const bool aConvert = aInputMask != 0 && outputFormat->m_a_size > 0;
 
-    for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
-    {
-        const auto mipLevelSize = m_input_texture->GetSizeOfMipLevel(mipLevel) * m_input_texture->GetFaceCount();
-        const auto* inputBuffer = m_input_texture->GetBufferForMipLevel(mipLevel);
-        auto* outputBuffer = m_output_texture->GetBufferForMipLevel(mipLevel);
-
-        const auto inputBytePerPixel = inputFormat->m_bits_per_pixel / 8;
-        const auto outputBytePerPixel = outputFormat->m_bits_per_pixel / 8;
-
-        auto outputOffset = 0u;
-        for (auto inputOffset = 0u; inputOffset < mipLevelSize; inputOffset += inputBytePerPixel, outputOffset += outputBytePerPixel)
-        {
-            uint64_t outPixel = 0;
-            const auto inPixel = m_read_pixel_func(&inputBuffer[inputOffset], inputFormat->m_bits_per_pixel);
-
-            if (rConvert)
-                outPixel |= (inPixel & rInputMask) >> inputFormat->m_r_offset << outputFormat->m_r_offset;
-            if (gConvert)
-                outPixel |= (inPixel & gInputMask) >> inputFormat->m_g_offset << outputFormat->m_g_offset;
-            if (bConvert)
-                outPixel |= (inPixel & bInputMask) >> inputFormat->m_b_offset << outputFormat->m_b_offset;
-            if (aConvert)
-                outPixel |= (inPixel & aInputMask) >> inputFormat->m_a_offset << outputFormat->m_a_offset;
-
-            m_write_pixel_func(&outputBuffer[outputOffset], outPixel, outputFormat->m_bits_per_pixel);
-        }
-    }
+    const auto inputBytePerPixel = inputFormat->m_bits_per_pixel / 8;
+    const auto outputBytePerPixel = outputFormat->m_bits_per_pixel / 8;
+
+    ForEachPixelBand(inputBytePerPixel,
+                     outputBytePerPixel,
+                     [&](const uint8_t* inputBuffer, uint8_t* outputBuffer, const size_t pixelCount)
+                     {
+                         for (size_t pixel = 0u; pixel < pixelCount; pixel++)
+                         {
+                             uint64_t outPixel = 0;
+                             const auto inPixel = m_read_pixel_func(&inputBuffer[pixel * inputBytePerPixel], inputFormat->m_bits_per_pixel);
+
+                             if (rConvert)
+                                 outPixel |= (inPixel & rInputMask) >> inputFormat->m_r_offset << outputFormat->m_r_offset;
+                             if (gConvert)
+                                 outPixel |= (inPixel & gInputMask) >> inputFormat->m_g_offset << outputFormat->m_g_offset;
+                             if (bConvert)
+                                 outPixel |= (inPixel & bInputMask) >> inputFormat->m_b_offset << outputFormat->m_b_offset;
+                             if (aConvert)
+                                 outPixel |= (inPixel & aInputMask) >> inputFormat->m_a_offset << outputFormat->m_a_offset;
+
+                             m_write_pixel_func(&outputBuffer[pixel * outputBytePerPixel], outPixel, outputFormat->m_bits_per_pixel);
+                         }
+                     });
 }
 
 void TextureConverter::ConvertUnsignedToUnsigned()
@@ -193,7 +496,9 @@ void TextureConverter::ConvertUnsignedToUnsigned()
     if (inputFormat->m_r_size == outputFormat->m_r_size && inputFormat->m_g_size == outputFormat->m_g_size && inputFormat->m_b_size == outputFormat->m_b_size
         && inputFormat->m_a_size == outputFormat->m_a_size)
     {
-        ReorderUnsignedToUnsigned();
+        // Common layouts are converted without going through the generic per pixel functions
+        if (!ReorderUnsignedToUnsignedWithKernel())
+            ReorderUnsignedToUnsigned();
     }
     else
     {
@@ -202,6 +507,74 @@ void TextureConverter::ConvertUnsignedToUnsigned()
     }
 }
 
+void TextureConverter::DecodeBlockCompressedToUnsigned() const
+{
+    const auto formatId = m_input_format->GetId();
+    const auto blockBytes = dynamic_cast<const ImageFormatBlockCompressed*>(m_input_format)->m_bits_per_block / 8u;
+    const UnsignedPixelCodec codec(dynamic_cast<const ImageFormatUnsigned*>(m_output_format));
+
+    ForEachBlockBand(
+        [formatId, blockBytes, &codec](const BlockBand& band)
+        {
+            const auto blocksPerRow = (band.m_width + block_compression::BLOCK_SIZE - 1u) / block_compression::BLOCK_SIZE;
+            block_compression::BlockPixels pixels{};
+
+            for (auto blockRow = band.m_first_block_row; blockRow < band.m_end_block_row; blockRow++)
+            {
+                for (auto blockColumn = 0u; blockColumn < blocksPerRow; blockColumn++)
+                {
+                    block_compression::DecodeBlock(formatId, &band.m_compressed[(blockRow * blocksPerRow + blockColumn) * blockBytes], pixels);
+
+                    // Blocks at the right and bottom edge can extend beyond the image, those pixels are dropped
+                    const auto startX = blockColumn * block_compression::BLOCK_SIZE;
+                    const auto startY = blockRow * block_compression::BLOCK_SIZE;
+                    const auto countX = std::min(block_compression::BLOCK_SIZE, band.m_width - startX);
+                    const auto countY = std::min(block_compression::BLOCK_SIZE, band.m_height - startY);
+                    for (auto y = 0u; y < countY; y++)
+                    {
+                        auto* output = &band.m_uncompressed[(static_cast<size_t>(startY + y) * band.m_width + startX) * codec.m_bytes_per_pixel];
+                        for (auto x = 0u; x < countX; x++)
+                            codec.Write(&output[x * codec.m_bytes_per_pixel], &pixels[(y * block_compression::BLOCK_SIZE + x) * 4u]);
+                    }
+                }
+            }
+        });
+}
+
+void TextureConverter::EncodeUnsignedToBlockCompressed() const
+{
+    const auto formatId = m_output_format->GetId();
+    const auto blockBytes = dynamic_cast<const ImageFormatBlockCompressed*>(m_output_format)->m_bits_per_block / 8u;
+    const UnsignedPixelCodec codec(dynamic_cast<const ImageFormatUnsigned*>(m_input_format));
+
+    ForEachBlockBand(
+        [formatId, blockBytes, &codec](const BlockBand& band)
+        {
+            const auto blocksPerRow = (band.m_width + block_compression::BLOCK_SIZE - 1u) / block_compression::BLOCK_SIZE;
+            block_compression::BlockPixels pixels{};
+
+            for (auto blockRow = band.m_first_block_row; blockRow < band.m_end_block_row; blockRow++)
+            {
+                for (auto blockColumn = 0u; blockColumn < blocksPerRow; blockColumn++)
+                {
+                    // Blocks at the right and bottom edge repeat the last pixels of the image to not skew their endpoints
+                    for (auto y = 0u; y < block_compression::BLOCK_SIZE; y++)
+                    {
+                        const auto sourceY = std::min(blockRow * block_compression::BLOCK_SIZE + y, band.m_height - 1u);
+                        for (auto x = 0u; x < block_compression::BLOCK_SIZE; x++)
+                        {
+                            const auto sourceX = std::min(blockColumn * block_compression::BLOCK_SIZE + x, band.m_width - 1u);
+                            codec.Read(&band.m_uncompressed[(static_cast<size_t>(sourceY) * band.m_width + sourceX) * codec.m_bytes_per_pixel],
+                                       &pixels[(y * block_compression::BLOCK_SIZE + x) * 4u]);
+                        }
+                    }
+
+                    block_compression::EncodeBlock(formatId, pixels, &band.m_compressed[(blockRow * blocksPerRow + blockColumn) * blockBytes]);
+                }
+            }
+        });
+}
+
 Texture* TextureConverter::Convert()
 {
     CreateOutputTexture();
@@ -210,6 +583,16 @@ Texture* TextureConverter::Convert()
     {
         ConvertUnsignedToUnsigned();
     }
+    else if (m_input_format->GetType() == ImageFormatType::BLOCK_COMPRESSED && m_output_format->GetType() == ImageFormatType::UNSIGNED
+             && block_compression::SupportsFormat(m_input_format->GetId()))
+    {
+        DecodeBlockCompressedToUnsigned();
+    }
+    else if (m_input_format->GetType() == ImageFormatType::UNSIGNED && m_output_format->GetType() == ImageFormatType::BLOCK_COMPRESSED
+             && block_compression::SupportsFormat(m_output_format->GetId()))
+    {
+        EncodeUnsignedToBlockCompressed();
+    }
     else
     {
         // Unsupported as of now
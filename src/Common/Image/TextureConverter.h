@@ -6,6 +6,17 @@
 
 class TextureConverter
 {
+    class BlockBand
+    {
+    public:
+        uint8_t* m_compressed;
+        uint8_t* m_uncompressed;
+        unsigned m_width;
+        unsigned m_height;
+        unsigned m_first_block_row;
+        unsigned m_end_block_row;
+    };
+
     Texture* m_input_texture;
     Texture* m_output_texture;
     const ImageFormat* m_input_format;
@@ -19,8 +30,27 @@ class TextureConverter
 
     void CreateOutputTexture();
 
+    /**
+     * \brief Splits all mip levels and faces of the texture into bands of pixels and converts them, in parallel for large textures.
+     * \param inputBytesPerPixel The size of an input pixel in bytes.
+     * \param outputBytesPerPixel The size of an output pixel in bytes.
+     * \param convert The function to convert a band of consecutive pixels with. It is called concurrently for different bands.
+     */
+    void ForEachPixelBand(size_t inputBytesPerPixel,
+                          size_t outputBytesPerPixel,
+                          const std::function<void(const uint8_t* input, uint8_t* output, size_t pixelCount)>& convert) const;
+
+    /**
+     * \brief Splits every face and slice of all mip levels of a block compressed conversion into bands of block rows and converts them, in parallel for large textures.
+     * \param convert The function to convert a band of block rows with. It is called concurrently for different bands.
+     */
+    void ForEachBlockBand(const std::function<void(const BlockBand& band)>& convert) const;
+
+    bool ReorderUnsignedToUnsignedWithKernel() const;
     void ReorderUnsignedToUnsigned() const;
     void ConvertUnsignedToUnsigned();
+    void DecodeBlockCompressedToUnsigned() const;
+    void EncodeUnsignedToBlockCompressed() const;
 
 public:
     TextureConverter(Texture* inputTexture, const ImageFormat* targetFormat);
@@ -0,0 +1,91 @@
+#include "Base64.h"
+
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BASE64_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    constexpr char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    constexpr char PADDING = '=';
+
+    // Amount of input bytes that are converted to one vector of 16 characters
+    constexpr size_t BLOCK_INPUT_SIZE = 12u;
+    constexpr size_t BLOCK_OUTPUT_SIZE = 16u;
+
+    void SplitGroup(const uint8_t* in, uint8_t* indices)
+    {
+        const auto group = static_cast<uint32_t>(in[0]) << 16 | static_cast<uint32_t>(in[1]) << 8 | static_cast<uint32_t>(in[2]);
+        indices[0] = static_cast<uint8_t>(group >> 18 & 0x3F);
+        indices[1] = static_cast<uint8_t>(group >> 12 & 0x3F);
+        indices[2] = static_cast<uint8_t>(group >> 6 & 0x3F);
+        indices[3] = static_cast<uint8_t>(group & 0x3F);
+    }
+
+#ifdef BASE64_SSE2
+    // Maps 16 indices to their characters at once by adding the offset of the alphabet range each index falls into
+    __m128i MapIndices(const __m128i indices)
+    {
+        const auto lowercase = _mm_cmpgt_epi8(indices, _mm_set1_epi8(25));
+        const auto digits = _mm_cmpgt_epi8(indices, _mm_set1_epi8(51));
+        const auto symbols = _mm_cmpgt_epi8(indices, _mm_set1_epi8(61));
+        const auto slash = _mm_cmpeq_epi8(indices, _mm_set1_epi8(63));
+
+        auto offsets = _mm_set1_epi8('A');
+        offsets = _mm_add_epi8(offsets, _mm_and_si128(lowercase, _mm_set1_epi8('a' - 26 - 'A')));
+        offsets = _mm_add_epi8(offsets, _mm_and_si128(digits, _mm_set1_epi8('0' - 52 - ('a' - 26))));
+        offsets = _mm_add_epi8(offsets, _mm_and_si128(symbols, _mm_set1_epi8('+' - 62 - ('0' - 52))));
+        offsets = _mm_add_epi8(offsets, _mm_and_si128(slash, _mm_set1_epi8('/' - 63 - ('+' - 62))));
+
+        return _mm_add_epi8(indices, offsets);
+    }
+#endif
+} // namespace
+
+namespace base64
+{
+    void Encode(const void* in, const size_t inSize, char* out)
+    {
+        const auto* inBytes = static_cast<const uint8_t*>(in);
+        size_t inOffset = 0u;
+
+#ifdef BASE64_SSE2
+        alignas(16) uint8_t indices[BLOCK_OUTPUT_SIZE];
+        for (; inOffset + BLOCK_INPUT_SIZE <= inSize; inOffset += BLOCK_INPUT_SIZE)
+        {
+            SplitGroup(&inBytes[inOffset], &indices[0]);
+            SplitGroup(&inBytes[inOffset + 3u], &indices[4]);
+            SplitGroup(&inBytes[inOffset + 6u], &indices[8]);
+            SplitGroup(&inBytes[inOffset + 9u], &indices[12]);
+
+            const auto characters = MapIndices(_mm_load_si128(reinterpret_cast<const __m128i*>(indices)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), characters);
+            out += BLOCK_OUTPUT_SIZE;
+        }
+#endif
+
+        uint8_t groupIndices[4];
+        for (; inOffset + 3u <= inSize; inOffset += 3u)
+        {
+            SplitGroup(&inBytes[inOffset], groupIndices);
+            *out++ = ALPHABET[groupIndices[0]];
+            *out++ = ALPHABET[groupIndices[1]];
+            *out++ = ALPHABET[groupIndices[2]];
+            *out++ = ALPHABET[groupIndices[3]];
+        }
+
+        const auto remainingSize = inSize - inOffset;
+        if (remainingSize > 0u)
+        {
+            const uint8_t lastGroup[3]{inBytes[inOffset], remainingSize > 1u ? inBytes[inOffset + 1u] : static_cast<uint8_t>(0u), 0u};
+            SplitGroup(lastGroup, groupIndices);
+            *out++ = ALPHABET[groupIndices[0]];
+            *out++ = ALPHABET[groupIndices[1]];
+            *out++ = remainingSize > 1u ? ALPHABET[groupIndices[2]] : PADDING;
+            *out++ = PADDING;
+        }
+    }
+} // namespace base64
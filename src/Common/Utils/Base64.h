@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+
+namespace base64
+{
+    /**
+     * \brief Returns the amount of characters that encoding data of the specified size results in, including padding.
+     * \param dataSize The size of the data to encode.
+     * \return The length of the encoded data.
+     */
+    constexpr size_t GetEncodedLength(const size_t dataSize)
+    {
+        return 4u * ((dataSize + 2u) / 3u);
+    }
+
+    /**
+     * \brief Encodes data with the standard base64 alphabet and pads the result with '=' characters.
+     * Data can be encoded in multiple parts by encoding parts whose size is a multiple of three one after another.
+     * \param in The data to encode.
+     * \param inSize The size of the data to encode.
+     * \param out The encoded data. Must be able to hold \c GetEncodedLength(inSize) characters. No terminating zero is written.
+     */
+    void Encode(const void* in, size_t inSize, char* out);
+} // namespace base64
@@ -1,5 +1,10 @@
 #include "HalfFloat.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HALF_FLOAT_SSE2
+#include <emmintrin.h>
+#endif
+
 float HalfFloat::ToFloat(const half_float_t half)
 {
     if (half)
@@ -42,3 +47,37 @@ half_float_t HalfFloat::ToHalf(const float f)
 
     return (v3 & 0x3FFFu) | ((result.u >> 16) & 0xC000u);
 }
+
+void HalfFloat::ToHalf(const float* in, half_float_t* out, const size_t count)
+{
+    size_t index = 0u;
+
+#ifdef HALF_FLOAT_SSE2
+    // Does the same as the scalar conversion for four floats at once
+    const auto signBit = _mm_set1_epi32(static_cast<int>(0x80000000u));
+    const auto maxValue = _mm_set1_epi32(0x3FFF);
+    const auto minValue = _mm_set1_epi32(-16384);
+    const auto valueMask = _mm_set1_epi32(0x3FFF);
+    const auto signMask = _mm_set1_epi32(0xC000);
+
+    for (; index + 4u <= count; index += 4u)
+    {
+        const auto u = _mm_castps_si128(_mm_loadu_ps(&in[index]));
+
+        auto v = _mm_srai_epi32(_mm_xor_si128(_mm_add_epi32(u, u), signBit), 14);
+        const auto aboveMax = _mm_cmpgt_epi32(v, maxValue);
+        v = _mm_or_si128(_mm_andnot_si128(aboveMax, v), _mm_and_si128(aboveMax, maxValue));
+        const auto aboveMin = _mm_cmpgt_epi32(v, minValue);
+        v = _mm_or_si128(_mm_and_si128(aboveMin, v), _mm_andnot_si128(aboveMin, minValue));
+
+        auto result = _mm_or_si128(_mm_and_si128(v, valueMask), _mm_and_si128(_mm_srli_epi32(u, 16), signMask));
+
+        // Sign extend the halves to not have them saturated when packing them to 16bit
+        result = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(&out[index]), _mm_packs_epi32(result, result));
+    }
+#endif
+
+    for (; index < count; index++)
+        out[index] = ToHalf(in[index]);
+}
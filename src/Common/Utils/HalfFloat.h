@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 typedef uint16_t half_float_t;
@@ -11,4 +12,12 @@ class HalfFloat
 public:
     static float ToFloat(half_float_t half);
     static half_float_t ToHalf(float f);
+
+    /**
+     * \brief Converts multiple floats at once. The result is the same as converting each float on its own.
+     * \param in The floats to convert.
+     * \param out The converted halves. Must be able to hold \c count values.
+     * \param count The amount of floats to convert.
+     */
+    static void ToHalf(const float* in, half_float_t* out, size_t count);
 };
@@ -6,6 +6,11 @@
 #include <cassert>
 #include <limits>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PACK_SSE2
+#include <emmintrin.h>
+#endif
+
 union PackUtil32
 {
     uint32_t u;
@@ -15,6 +20,37 @@ union PackUtil32
     uint8_t uc[4];
 };
 
+namespace
+{
+    // Batches are converted in chunks to be able to use a buffer on the stack for intermediate results
+    constexpr size_t PACK_CHUNK_SIZE = 256u;
+
+    constexpr float UNIT_VEC_THIRD_BASED_OFFSET = -24624.0939334638f;
+    constexpr float UNIT_VEC_THIRD_BASED_SCALE = 0.0001218318939208984f;
+
+    void ScaleUnitVecThirdBased(const float* in, uint32_t* out, const size_t count)
+    {
+        size_t index = 0u;
+
+#ifdef PACK_SSE2
+        const auto offset = _mm_set1_ps(UNIT_VEC_THIRD_BASED_OFFSET);
+        const auto scale = _mm_set1_ps(UNIT_VEC_THIRD_BASED_SCALE);
+        for (; index + 4u <= count; index += 4u)
+        {
+            const auto scaled = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&in[index]), offset), scale);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[index]), _mm_castps_si128(scaled));
+        }
+#endif
+
+        for (; index < count; index++)
+        {
+            PackUtil32 value;
+            value.f = (in[index] - UNIT_VEC_THIRD_BASED_OFFSET) * UNIT_VEC_THIRD_BASED_SCALE;
+            out[index] = value.u;
+        }
+    }
+} // namespace
+
 namespace pack32
 {
     uint32_t Vec2PackTexCoordsUV(const float (&in)[2])
@@ -38,11 +74,11 @@ namespace pack32
     {
         // This is based on the game's reversed code, the original code may have made a bit more sense
         PackUtil32 x;
-        x.f = (in[0] - -24624.0939334638f) * 0.0001218318939208984f;
+        x.f = (in[0] - UNIT_VEC_THIRD_BASED_OFFSET) * UNIT_VEC_THIRD_BASED_SCALE;
         PackUtil32 y;
-        y.f = (in[1] - -24624.0939334638f) * 0.0001218318939208984f;
+        y.f = (in[1] - UNIT_VEC_THIRD_BASED_OFFSET) * UNIT_VEC_THIRD_BASED_SCALE;
         PackUtil32 z;
-        z.f = (in[2] - -24624.0939334638f) * 0.0001218318939208984f;
+        z.f = (in[2] - UNIT_VEC_THIRD_BASED_OFFSET) * UNIT_VEC_THIRD_BASED_SCALE;
 
         return x.u | y.u << 10u | z.u << 20u;
     }
@@ -57,6 +93,69 @@ namespace pack32
         // clang-format on
     }
 
+    void Vec2PackTexCoordsUV(const float* in, uint32_t* out, const size_t count)
+    {
+        half_float_t halves[PACK_CHUNK_SIZE * 2u];
+        for (size_t offset = 0u; offset < count; offset += PACK_CHUNK_SIZE)
+        {
+            const auto chunkCount = std::min(count - offset, PACK_CHUNK_SIZE);
+            HalfFloat::ToHalf(&in[offset * 2u], halves, chunkCount * 2u);
+
+            for (auto index = 0u; index < chunkCount; index++)
+                out[offset + index] = static_cast<uint32_t>(halves[index * 2u + 1u]) << 16 | halves[index * 2u];
+        }
+    }
+
+    void Vec2PackTexCoordsVU(const float* in, uint32_t* out, const size_t count)
+    {
+        half_float_t halves[PACK_CHUNK_SIZE * 2u];
+        for (size_t offset = 0u; offset < count; offset += PACK_CHUNK_SIZE)
+        {
+            const auto chunkCount = std::min(count - offset, PACK_CHUNK_SIZE);
+            HalfFloat::ToHalf(&in[offset * 2u], halves, chunkCount * 2u);
+
+            for (auto index = 0u; index < chunkCount; index++)
+                out[offset + index] = static_cast<uint32_t>(halves[index * 2u]) << 16 | halves[index * 2u + 1u];
+        }
+    }
+
+    void Vec3PackUnitVecThirdBased(const float* in, uint32_t* out, const size_t count)
+    {
+        uint32_t components[PACK_CHUNK_SIZE * 3u];
+        for (size_t offset = 0u; offset < count; offset += PACK_CHUNK_SIZE)
+        {
+            const auto chunkCount = std::min(count - offset, PACK_CHUNK_SIZE);
+            ScaleUnitVecThirdBased(&in[offset * 3u], components, chunkCount * 3u);
+
+            for (auto index = 0u; index < chunkCount; index++)
+                out[offset + index] = components[index * 3u] | components[index * 3u + 1u] << 10u | components[index * 3u + 2u] << 20u;
+        }
+    }
+
+    void Vec4PackGfxColor(const float* in, uint32_t* out, const size_t count)
+    {
+        size_t index = 0u;
+
+#ifdef PACK_SSE2
+        const auto zero = _mm_setzero_ps();
+        const auto one = _mm_set1_ps(1.0f);
+        const auto maxByte = _mm_set1_ps(255.0f);
+        for (; index < count; index++)
+        {
+            const auto clamped = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&in[index * 4u]), zero), one);
+            const auto bytes = _mm_cvttps_epi32(_mm_mul_ps(clamped, maxByte));
+            const auto packed = _mm_packus_epi16(_mm_packs_epi32(bytes, bytes), bytes);
+            out[index] = static_cast<uint32_t>(_mm_cvtsi128_si32(packed));
+        }
+#endif
+
+        for (; index < count; index++)
+        {
+            const float color[4]{in[index * 4u], in[index * 4u + 1u], in[index * 4u + 2u], in[index * 4u + 3u]};
+            out[index] = Vec4PackGfxColor(color);
+        }
+    }
+
     void Vec2UnpackTexCoordsUV(const uint32_t in, float (&out)[2])
     {
         const auto inHiDw = static_cast<half_float_t>((in >> 16) & std::numeric_limits<uint16_t>::max());
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace pack32
@@ -10,6 +11,17 @@ namespace pack32
     uint32_t Vec3PackUnitVecThirdBased(const float (&in)[3]);
     uint32_t Vec4PackGfxColor(const float (&in)[4]);
 
+    /**
+     * \brief Packs multiple values at once. The result is the same as packing each value on its own.
+     * \param in The values to pack, consisting of \c count vectors with their components next to each other.
+     * \param out The packed values. Must be able to hold \c count values.
+     * \param count The amount of vectors to pack.
+     */
+    void Vec2PackTexCoordsUV(const float* in, uint32_t* out, size_t count);
+    void Vec2PackTexCoordsVU(const float* in, uint32_t* out, size_t count);
+    void Vec3PackUnitVecThirdBased(const float* in, uint32_t* out, size_t count);
+    void Vec4PackGfxColor(const float* in, uint32_t* out, size_t count);
+
     void Vec2UnpackTexCoordsUV(uint32_t in, float (&out)[2]);
     void Vec2UnpackTexCoordsVU(uint32_t in, float (&out)[2]);
     void Vec3UnpackUnitVecScaleBased(uint32_t in, float (&out)[3]);
@@ -1,34 +1,49 @@
 #include "AlgorithmSHA1.h"
 
 #include "CryptoLibrary.h"
+#include "ShaExtensionsHash.h"
 
 #include <cstdint>
+#include <optional>
 
 class AlgorithmSHA1::AlgorithmSHA1Impl
 {
     hash_state m_state{};
+    std::optional<ShaExtensionsHash> m_accelerated;
 
 public:
     AlgorithmSHA1Impl()
     {
         CryptoLibrary::Init();
 
+        if (ShaExtensionsHash::IsSupported())
+            m_accelerated.emplace(ShaExtensionsHash::Algorithm::SHA1);
+
         Init();
     }
 
     void Init()
     {
-        sha1_init(&m_state);
+        if (m_accelerated)
+            m_accelerated->Init();
+        else
+            sha1_init(&m_state);
     }
 
     void Process(const void* input, const size_t inputSize)
     {
-        sha1_process(&m_state, static_cast<const uint8_t*>(input), inputSize);
+        if (m_accelerated)
+            m_accelerated->Process(input, inputSize);
+        else
+            sha1_process(&m_state, static_cast<const uint8_t*>(input), inputSize);
     }
 
     void Finish(void* hashBuffer)
     {
-        sha1_done(&m_state, static_cast<uint8_t*>(hashBuffer));
+        if (m_accelerated)
+            m_accelerated->Finish(hashBuffer);
+        else
+            sha1_done(&m_state, static_cast<uint8_t*>(hashBuffer));
     }
 };
 
@@ -1,34 +1,49 @@
 #include "AlgorithmSHA256.h"
 
 #include "CryptoLibrary.h"
+#include "ShaExtensionsHash.h"
 
 #include <cstdint>
+#include <optional>
 
 class AlgorithmSHA256::Impl
 {
     hash_state m_state{};
+    std::optional<ShaExtensionsHash> m_accelerated;
 
 public:
     Impl()
     {
         CryptoLibrary::Init();
 
+        if (ShaExtensionsHash::IsSupported())
+            m_accelerated.emplace(ShaExtensionsHash::Algorithm::SHA256);
+
         Init();
     }
 
     void Init()
     {
-        sha256_init(&m_state);
+        if (m_accelerated)
+            m_accelerated->Init();
+        else
+            sha256_init(&m_state);
     }
 
     void Process(const void* input, const size_t inputSize)
     {
-        sha256_process(&m_state, static_cast<const uint8_t*>(input), inputSize);
+        if (m_accelerated)
+            m_accelerated->Process(input, inputSize);
+        else
+            sha256_process(&m_state, static_cast<const uint8_t*>(input), inputSize);
     }
 
     void Finish(void* hashBuffer)
     {
-        sha256_done(&m_state, static_cast<uint8_t*>(hashBuffer));
+        if (m_accelerated)
+            m_accelerated->Finish(hashBuffer);
+        else
+            sha256_done(&m_state, static_cast<uint8_t*>(hashBuffer));
     }
 };
 
@@ -1,10 +1,259 @@
 #include "AlgorithmSalsa20.h"
 
+#include "CpuFeatures.h"
 #include "salsa20.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <stdexcept>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SALSA20_SSE2
+#include <emmintrin.h>
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#define SALSA20_AVX2_TARGET
+#else
+#define SALSA20_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace
+{
+    constexpr size_t SALSA20_BLOCK_SIZE = 64;
+    constexpr size_t SALSA20_WORD_COUNT = 16;
+
+    // The counter occupies the words 8 and 9 of the state
+    uint64_t GetCounter(const uint32_t* state)
+    {
+        return static_cast<uint64_t>(state[8]) | static_cast<uint64_t>(state[9]) << 32;
+    }
+
+    void SetCounter(uint32_t* state, const uint64_t counter)
+    {
+        state[8] = static_cast<uint32_t>(counter);
+        state[9] = static_cast<uint32_t>(counter >> 32);
+    }
+
+    uint32_t RotateLeft(const uint32_t value, const int count)
+    {
+        return value << count | value >> (32 - count);
+    }
+
+    void QuarterRound(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d)
+    {
+        b ^= RotateLeft(a + d, 7);
+        c ^= RotateLeft(b + a, 9);
+        d ^= RotateLeft(c + b, 13);
+        a ^= RotateLeft(d + c, 18);
+    }
+
+    void GenerateBlock(const uint32_t* state, uint8_t* keyStream)
+    {
+        uint32_t x[SALSA20_WORD_COUNT];
+        std::memcpy(x, state, sizeof(x));
+
+        for (auto round = 0; round < 20; round += 2)
+        {
+            QuarterRound(x[0], x[4], x[8], x[12]);
+            QuarterRound(x[5], x[9], x[13], x[1]);
+            QuarterRound(x[10], x[14], x[2], x[6]);
+            QuarterRound(x[15], x[3], x[7], x[11]);
+            QuarterRound(x[0], x[1], x[2], x[3]);
+            QuarterRound(x[5], x[6], x[7], x[4]);
+            QuarterRound(x[10], x[11], x[8], x[9]);
+            QuarterRound(x[15], x[12], x[13], x[14]);
+        }
+
+        for (auto i = 0u; i < SALSA20_WORD_COUNT; i++)
+            x[i] += state[i];
+
+        // All supported architectures are little endian which is the byte order of the key stream
+        std::memcpy(keyStream, x, sizeof(x));
+    }
+
+#ifdef SALSA20_SSE2
+    constexpr size_t SSE2_PARALLEL_BLOCKS = 4;
+    constexpr size_t AVX2_PARALLEL_BLOCKS = 8;
+
+    template<int Count> __m128i RotateLeftSse2(const __m128i value)
+    {
+        return _mm_or_si128(_mm_slli_epi32(value, Count), _mm_srli_epi32(value, 32 - Count));
+    }
+
+    void QuarterRoundSse2(__m128i& a, __m128i& b, __m128i& c, __m128i& d)
+    {
+        b = _mm_xor_si128(b, RotateLeftSse2<7>(_mm_add_epi32(a, d)));
+        c = _mm_xor_si128(c, RotateLeftSse2<9>(_mm_add_epi32(b, a)));
+        d = _mm_xor_si128(d, RotateLeftSse2<13>(_mm_add_epi32(c, b)));
+        a = _mm_xor_si128(a, RotateLeftSse2<18>(_mm_add_epi32(d, c)));
+    }
+
+    void TransposeSse2(__m128i& a, __m128i& b, __m128i& c, __m128i& d)
+    {
+        const auto ab0 = _mm_unpacklo_epi32(a, b);
+        const auto ab1 = _mm_unpackhi_epi32(a, b);
+        const auto cd0 = _mm_unpacklo_epi32(c, d);
+        const auto cd1 = _mm_unpackhi_epi32(c, d);
+
+        a = _mm_unpacklo_epi64(ab0, cd0);
+        b = _mm_unpackhi_epi64(ab0, cd0);
+        c = _mm_unpacklo_epi64(ab1, cd1);
+        d = _mm_unpackhi_epi64(ab1, cd1);
+    }
+
+    /**
+     * \brief Encrypts four consecutive blocks at once. Each vector holds the same word of all four blocks.
+     */
+    void ProcessBlocksSse2(uint32_t* state, const uint8_t* input, uint8_t* output)
+    {
+        const auto counter = GetCounter(state);
+
+        __m128i initial[SALSA20_WORD_COUNT];
+        for (auto i = 0u; i < SALSA20_WORD_COUNT; i++)
+            initial[i] = _mm_set1_epi32(static_cast<int>(state[i]));
+
+        uint32_t counterWords[2][SSE2_PARALLEL_BLOCKS];
+        for (auto block = 0u; block < SSE2_PARALLEL_BLOCKS; block++)
+        {
+            counterWords[0][block] = static_cast<uint32_t>(counter + block);
+            counterWords[1][block] = static_cast<uint32_t>((counter + block) >> 32);
+        }
+        initial[8] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(counterWords[0]));
+        initial[9] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(counterWords[1]));
+
+        __m128i x[SALSA20_WORD_COUNT];
+        for (auto i = 0u; i < SALSA20_WORD_COUNT; i++)
+            x[i] = initial[i];
+
+        for (auto round = 0; round < 20; round += 2)
+        {
+            QuarterRoundSse2(x[0], x[4], x[8], x[12]);
+            QuarterRoundSse2(x[5], x[9], x[13], x[1]);
+            QuarterRoundSse2(x[10], x[14], x[2], x[6]);
+            QuarterRoundSse2(x[15], x[3], x[7], x[11]);
+            QuarterRoundSse2(x[0], x[1], x[2], x[3]);
+            QuarterRoundSse2(x[5], x[6], x[7], x[4]);
+            QuarterRoundSse2(x[10], x[11], x[8], x[9]);
+            QuarterRoundSse2(x[15], x[12], x[13], x[14]);
+        }
+
+        for (auto i = 0u; i < SALSA20_WORD_COUNT; i++)
+            x[i] = _mm_add_epi32(x[i], initial[i]);
+
+        // After transposing a group of four words, the n-th vector holds these words of the n-th block
+        for (auto word = 0u; word < SALSA20_WORD_COUNT; word += 4)
+        {
+            TransposeSse2(x[word], x[word + 1], x[word + 2], x[word + 3]);
+
+            for (auto block = 0u; block < SSE2_PARALLEL_BLOCKS; block++)
+            {
+                const auto offset = block * SALSA20_BLOCK_SIZE + word * sizeof(uint32_t);
+                const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[offset]));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&output[offset]), _mm_xor_si128(data, x[word + block]));
+            }
+        }
+
+        SetCounter(state, counter + SSE2_PARALLEL_BLOCKS);
+    }
+
+    template<int Count> SALSA20_AVX2_TARGET __m256i RotateLeftAvx2(const __m256i value)
+    {
+        return _mm256_or_si256(_mm256_slli_epi32(value, Count), _mm256_srli_epi32(value, 32 - Count));
+    }
+
+    SALSA20_AVX2_TARGET void QuarterRoundAvx2(__m256i& a, __m256i& b, __m256i& c, __m256i& d)
+    {
+        b = _mm256_xor_si256(b, RotateLeftAvx2<7>(_mm256_add_epi32(a, d)));
+        c = _mm256_xor_si256(c, RotateLeftAvx2<9>(_mm256_add_epi32(b, a)));
+        d = _mm256_xor_si256(d, RotateLeftAvx2<13>(_mm256_add_epi32(c, b)));
+        a = _mm256_xor_si256(a, RotateLeftAvx2<18>(_mm256_add_epi32(d, c)));
+    }
+
+    SALSA20_AVX2_TARGET void TransposeAvx2(__m256i& a, __m256i& b, __m256i& c, __m256i& d)
+    {
+        // Unpacking works on both 128 bit lanes separately so this transposes the lower and the upper four blocks
+        const auto ab0 = _mm256_unpacklo_epi32(a, b);
+        const auto ab1 = _mm256_unpackhi_epi32(a, b);
+        const auto cd0 = _mm256_unpacklo_epi32(c, d);
+        const auto cd1 = _mm256_unpackhi_epi32(c, d);
+
+        a = _mm256_unpacklo_epi64(ab0, cd0);
+        b = _mm256_unpackhi_epi64(ab0, cd0);
+        c = _mm256_unpacklo_epi64(ab1, cd1);
+        d = _mm256_unpackhi_epi64(ab1, cd1);
+    }
+
+    /**
+     * \brief Encrypts eight consecutive blocks at once. Each vector holds the same word of all eight blocks.
+     */
+    SALSA20_AVX2_TARGET void ProcessBlocksAvx2(uint32_t* state, const uint8_t* input, uint8_t* output)
+    {
+        const auto counter = GetCounter(state);
+
+        __m256i initial[SALSA20_WORD_COUNT];
+        for (auto i = 0u; i < SALSA20_WORD_COUNT; i++)
+            initial[i] = _mm256_set1_epi32(static_cast<int>(state[i]));
+
+        uint32_t counterWords[2][AVX2_PARALLEL_BLOCKS];
+        for (auto block = 0u; block < AVX2_PARALLEL_BLOCKS; block++)
+        {
+            counterWords[0][block] = static_cast<uint32_t>(counter + block);
+            counterWords[1][block] = static_cast<uint32_t>((counter + block) >> 32);
+        }
+        initial[8] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(counterWords[0]));
+        initial[9] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(counterWords[1]));
+
+        __m256i x[SALSA20_WORD_COUNT];
+        for (auto i = 0u; i < SALSA20_WORD_COUNT; i++)
+            x[i] = initial[i];
+
+        for (auto round = 0; round < 20; round += 2)
+        {
+            QuarterRoundAvx2(x[0], x[4], x[8], x[12]);
+            QuarterRoundAvx2(x[5], x[9], x[13], x[1]);
+            QuarterRoundAvx2(x[10], x[14], x[2], x[6]);
+            QuarterRoundAvx2(x[15], x[3], x[7], x[11]);
+            QuarterRoundAvx2(x[0], x[1], x[2], x[3]);
+            QuarterRoundAvx2(x[5], x[6], x[7], x[4]);
+            QuarterRoundAvx2(x[10], x[11], x[8], x[9]);
+            QuarterRoundAvx2(x[15], x[12], x[13], x[14]);
+        }
+
+        for (auto i = 0u; i < SALSA20_WORD_COUNT; i++)
+            x[i] = _mm256_add_epi32(x[i], initial[i]);
+
+        for (auto word = 0u; word < SALSA20_WORD_COUNT; word += 4)
+            TransposeAvx2(x[word], x[word + 1], x[word + 2], x[word + 3]);
+
+        // Every vector now holds four words of block n in its lower and four words of block n + 4 in its upper lane
+        for (auto word = 0u; word < SALSA20_WORD_COUNT; word += 8)
+        {
+            for (auto block = 0u; block < 4u; block++)
+            {
+                const auto lowerWords = x[word + block];
+                const auto upperWords = x[word + 4 + block];
+
+                const auto lowerOffset = block * SALSA20_BLOCK_SIZE + word * sizeof(uint32_t);
+                const auto upperOffset = lowerOffset + 4 * SALSA20_BLOCK_SIZE;
+
+                const auto lowerData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&input[lowerOffset]));
+                const auto upperData = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&input[upperOffset]));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[lowerOffset]),
+                                    _mm256_xor_si256(lowerData, _mm256_permute2x128_si256(lowerWords, upperWords, 0x20)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[upperOffset]),
+                                    _mm256_xor_si256(upperData, _mm256_permute2x128_si256(lowerWords, upperWords, 0x31)));
+            }
+        }
+
+        SetCounter(state, counter + AVX2_PARALLEL_BLOCKS);
+    }
+#endif
+} // namespace
+
 class AlgorithmSalsa20::AlgorithmSalsa20Impl
 {
     salsa20_ctx m_context{};
@@ -35,9 +284,48 @@ public:
         Salsa20_IVSetup(&m_context, iv);
     }
 
+    void SetBlockCounter(const uint64_t blockCounter)
+    {
+        SetCounter(m_context.m_input, blockCounter);
+    }
+
+    // Behaves like Salsa20_Encrypt_Bytes: Every call starts a new block and a trailing partial block still advances the counter
     void Process(const void* plainText, void* cipherText, const size_t amount)
     {
-        Salsa20_Encrypt_Bytes(&m_context, static_cast<const uint8_t*>(plainText), static_cast<uint8_t*>(cipherText), amount);
+        const auto* input = static_cast<const uint8_t*>(plainText);
+        auto* output = static_cast<uint8_t*>(cipherText);
+        auto remaining = amount;
+
+#ifdef SALSA20_SSE2
+        if (CpuFeatures::HasAvx2())
+        {
+            constexpr auto AVX2_STEP_SIZE = AVX2_PARALLEL_BLOCKS * SALSA20_BLOCK_SIZE;
+            for (; remaining >= AVX2_STEP_SIZE; remaining -= AVX2_STEP_SIZE, input += AVX2_STEP_SIZE, output += AVX2_STEP_SIZE)
+                ProcessBlocksAvx2(m_context.m_input, input, output);
+        }
+
+        if (CpuFeatures::HasSse2())
+        {
+            constexpr auto SSE2_STEP_SIZE = SSE2_PARALLEL_BLOCKS * SALSA20_BLOCK_SIZE;
+            for (; remaining >= SSE2_STEP_SIZE; remaining -= SSE2_STEP_SIZE, input += SSE2_STEP_SIZE, output += SSE2_STEP_SIZE)
+                ProcessBlocksSse2(m_context.m_input, input, output);
+        }
+#endif
+
+        uint8_t keyStream[SALSA20_BLOCK_SIZE];
+        while (remaining > 0)
+        {
+            GenerateBlock(m_context.m_input, keyStream);
+            SetCounter(m_context.m_input, GetCounter(m_context.m_input) + 1);
+
+            const auto blockSize = std::min(remaining, SALSA20_BLOCK_SIZE);
+            for (auto i = 0u; i < blockSize; i++)
+                output[i] = input[i] ^ keyStream[i];
+
+            remaining -= blockSize;
+            input += blockSize;
+            output += blockSize;
+        }
     }
 };
 
@@ -83,6 +371,11 @@ void AlgorithmSalsa20::SetIV(const uint8_t* iv, const size_t ivSize)
     m_impl->SetIV(iv, ivSize);
 }
 
+void AlgorithmSalsa20::SetBlockCounter(const uint64_t blockCounter)
+{
+    m_impl->SetBlockCounter(blockCounter);
+}
+
 void AlgorithmSalsa20::Process(const void* plainText, void* cipherText, const size_t amount)
 {
     m_impl->Process(plainText, cipherText, amount);
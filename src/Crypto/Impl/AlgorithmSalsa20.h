@@ -17,5 +17,11 @@ public:
     AlgorithmSalsa20& operator=(AlgorithmSalsa20&& other) noexcept;
 
     void SetIV(const uint8_t* iv, size_t ivSize) override;
+
+    /**
+     * \brief Continues the key stream at the specified block. \c SetIV resets it to the first block.
+     */
+    void SetBlockCounter(uint64_t blockCounter);
+
     void Process(const void* plainText, void* cipherText, size_t amount) override;
 };
@@ -0,0 +1,129 @@
+#include "CpuFeatures.h"
+
+#include <atomic>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define CPU_FEATURES_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace
+{
+#ifdef CPU_FEATURES_X86
+    constexpr unsigned CPUID_1_EDX_SSE2 = 1u << 26;
+    constexpr unsigned CPUID_1_ECX_SSSE3 = 1u << 9;
+    constexpr unsigned CPUID_1_ECX_SSE41 = 1u << 19;
+    constexpr unsigned CPUID_1_ECX_OSXSAVE = 1u << 27;
+    constexpr unsigned CPUID_1_ECX_AVX = 1u << 28;
+    constexpr unsigned CPUID_7_EBX_AVX2 = 1u << 5;
+    constexpr unsigned CPUID_7_EBX_SHA = 1u << 29;
+
+    // The operating system has to save the xmm and ymm registers on context switches
+    constexpr unsigned long long XCR0_SSE_AND_AVX_STATE = 0x6u;
+
+    class Registers
+    {
+    public:
+        unsigned m_eax;
+        unsigned m_ebx;
+        unsigned m_ecx;
+        unsigned m_edx;
+    };
+
+    bool QueryCpuid(const unsigned leaf, Registers& registers)
+    {
+#ifdef _MSC_VER
+        int info[4];
+        __cpuid(info, 0);
+        if (static_cast<unsigned>(info[0]) < leaf)
+            return false;
+
+        __cpuidex(info, static_cast<int>(leaf), 0);
+        registers = Registers{static_cast<unsigned>(info[0]), static_cast<unsigned>(info[1]), static_cast<unsigned>(info[2]), static_cast<unsigned>(info[3])};
+        return true;
+#else
+        return __get_cpuid_count(leaf, 0, &registers.m_eax, &registers.m_ebx, &registers.m_ecx, &registers.m_edx) != 0;
+#endif
+    }
+
+    unsigned long long ReadXcr0()
+    {
+#ifdef _MSC_VER
+        return _xgetbv(0);
+#else
+        unsigned eax;
+        unsigned edx;
+        __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return static_cast<unsigned long long>(edx) << 32 | eax;
+#endif
+    }
+
+    class DetectedFeatures
+    {
+    public:
+        bool m_sse2 = false;
+        bool m_avx2 = false;
+        bool m_sha = false;
+
+        DetectedFeatures()
+        {
+            Registers leaf1{};
+            Registers leaf7{};
+            if (!QueryCpuid(1, leaf1) || !QueryCpuid(7, leaf7))
+                return;
+
+            m_sse2 = (leaf1.m_edx & CPUID_1_EDX_SSE2) != 0;
+            m_sha = (leaf7.m_ebx & CPUID_7_EBX_SHA) != 0 && (leaf1.m_ecx & CPUID_1_ECX_SSSE3) != 0 && (leaf1.m_ecx & CPUID_1_ECX_SSE41) != 0;
+
+            constexpr auto osxsaveAndAvx = CPUID_1_ECX_OSXSAVE | CPUID_1_ECX_AVX;
+            m_avx2 = (leaf1.m_ecx & osxsaveAndAvx) == osxsaveAndAvx && (ReadXcr0() & XCR0_SSE_AND_AVX_STATE) == XCR0_SSE_AND_AVX_STATE
+                     && (leaf7.m_ebx & CPUID_7_EBX_AVX2) != 0;
+        }
+    };
+#else
+    class DetectedFeatures
+    {
+    public:
+        bool m_sse2 = false;
+        bool m_avx2 = false;
+        bool m_sha = false;
+    };
+#endif
+
+    const DetectedFeatures& GetDetectedFeatures()
+    {
+        static const DetectedFeatures detectedFeatures;
+        return detectedFeatures;
+    }
+
+    std::atomic_uint disabledFeatures(0u);
+
+    bool IsEnabled(const unsigned feature)
+    {
+        return (disabledFeatures.load(std::memory_order_relaxed) & feature) == 0;
+    }
+} // namespace
+
+bool CpuFeatures::HasSse2()
+{
+    return GetDetectedFeatures().m_sse2 && IsEnabled(FEATURE_SSE2);
+}
+
+bool CpuFeatures::HasAvx2()
+{
+    return GetDetectedFeatures().m_avx2 && IsEnabled(FEATURE_AVX2);
+}
+
+bool CpuFeatures::HasShaExtensions()
+{
+    return GetDetectedFeatures().m_sha && IsEnabled(FEATURE_SHA);
+}
+
+void CpuFeatures::SetDisabledFeatures(const unsigned features)
+{
+    disabledFeatures.store(features, std::memory_order_relaxed);
+}
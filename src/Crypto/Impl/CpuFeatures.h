@@ -0,0 +1,34 @@
+#pragma once
+
+/**
+ * \brief Detects instruction set extensions of the executing CPU that accelerated algorithm implementations can make use of.
+ */
+class CpuFeatures
+{
+public:
+    static constexpr unsigned FEATURE_SSE2 = 1u << 0;
+    static constexpr unsigned FEATURE_AVX2 = 1u << 1;
+    static constexpr unsigned FEATURE_SHA = 1u << 2;
+
+    /**
+     * \return \c true if the CPU supports SSE2 instructions.
+     */
+    static bool HasSse2();
+
+    /**
+     * \return \c true if the CPU and the operating system support AVX2 instructions.
+     */
+    static bool HasAvx2();
+
+    /**
+     * \return \c true if the CPU supports the SHA extensions as well as SSSE3 and SSE4.1 which their implementations make use of.
+     */
+    static bool HasShaExtensions();
+
+    /**
+     * \brief Makes the specified features be reported as unavailable even if the CPU supports them.
+     * Allows testing every implementation of an algorithm on the same machine.
+     * \param features A combination of the \c FEATURE_ flags. \c 0 reports all detected features again.
+     */
+    static void SetDisabledFeatures(unsigned features);
+};
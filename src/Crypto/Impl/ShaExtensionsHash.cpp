@@ -0,0 +1,278 @@
+#include "ShaExtensionsHash.h"
+
+#include "CpuFeatures.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || (defined(__i386__) && defined(__SSE2__))
+#define SHA_EXTENSIONS_AVAILABLE
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#define SHA_EXTENSIONS_TARGET
+#else
+#define SHA_EXTENSIONS_TARGET __attribute__((target("sha,ssse3,sse4.1")))
+#endif
+#endif
+
+namespace
+{
+    constexpr uint32_t SHA1_INITIAL_STATE[]{0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+    constexpr uint32_t SHA256_INITIAL_STATE[]{0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19};
+
+    constexpr size_t SHA1_STATE_WORDS = std::extent_v<decltype(SHA1_INITIAL_STATE)>;
+    constexpr size_t SHA256_STATE_WORDS = std::extent_v<decltype(SHA256_INITIAL_STATE)>;
+
+#ifdef SHA_EXTENSIONS_AVAILABLE
+    constexpr uint32_t SHA256_ROUND_CONSTANTS[]{
+        0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5, 0xD807AA98, 0x12835B01, 0x243185BE,
+        0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174, 0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA,
+        0x5CB0A9DC, 0x76F988DA, 0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967, 0x27B70A85,
+        0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85, 0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
+        0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070, 0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F,
+        0x682E6FF3, 0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+    };
+
+    class Sha1Registers
+    {
+    public:
+        __m128i m_abcd;
+        // The value of abcd before the previous four rounds from which the next e is derived
+        __m128i m_previous_abcd;
+        __m128i m_schedule[4];
+    };
+
+    // Message words are big endian and the first word of each group of four has to be in the highest lane
+    SHA_EXTENSIONS_TARGET __m128i LoadSha1MessageWords(const uint8_t* data)
+    {
+        const auto byteOrder = _mm_set_epi64x(0x0001020304050607LL, 0x08090A0B0C0D0E0FLL);
+        return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), byteOrder);
+    }
+
+    /**
+     * \brief Performs the rounds 4 * Group to 4 * Group + 3 of a SHA1 block.
+     */
+    template<int Group> SHA_EXTENSIONS_TARGET void Sha1RoundGroup(Sha1Registers& registers, const uint8_t* data, const __m128i initialE)
+    {
+        auto& words = registers.m_schedule[Group % 4];
+        if constexpr (Group < 4)
+            words = LoadSha1MessageWords(data + Group * 16);
+        else
+        {
+            const auto partialWords =
+                _mm_xor_si128(_mm_sha1msg1_epu32(words, registers.m_schedule[(Group - 3) % 4]), registers.m_schedule[(Group - 2) % 4]);
+            words = _mm_sha1msg2_epu32(partialWords, registers.m_schedule[(Group - 1) % 4]);
+        }
+
+        __m128i e;
+        if constexpr (Group == 0)
+            e = _mm_add_epi32(initialE, words);
+        else
+            e = _mm_sha1nexte_epu32(registers.m_previous_abcd, words);
+
+        registers.m_previous_abcd = registers.m_abcd;
+        registers.m_abcd = _mm_sha1rnds4_epu32(registers.m_abcd, e, Group / 5);
+    }
+
+    template<int... Groups>
+    SHA_EXTENSIONS_TARGET void Sha1RoundGroups(Sha1Registers& registers, const uint8_t* data, const __m128i initialE, std::integer_sequence<int, Groups...>)
+    {
+        (Sha1RoundGroup<Groups>(registers, data, initialE), ...);
+    }
+
+    SHA_EXTENSIONS_TARGET void Sha1ProcessBlocks(uint32_t* state, const uint8_t* data, size_t blockCount)
+    {
+        Sha1Registers registers{};
+        registers.m_abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0x1B);
+        auto e = _mm_set_epi32(static_cast<int>(state[4]), 0, 0, 0);
+
+        for (; blockCount > 0; blockCount--, data += 64)
+        {
+            const auto initialAbcd = registers.m_abcd;
+
+            Sha1RoundGroups(registers, data, e, std::make_integer_sequence<int, 20>());
+
+            e = _mm_sha1nexte_epu32(registers.m_previous_abcd, e);
+            registers.m_abcd = _mm_add_epi32(registers.m_abcd, initialAbcd);
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_shuffle_epi32(registers.m_abcd, 0x1B));
+        state[4] = static_cast<uint32_t>(_mm_extract_epi32(e, 3));
+    }
+
+    class Sha256Registers
+    {
+    public:
+        __m128i m_abef;
+        __m128i m_cdgh;
+        __m128i m_schedule[4];
+    };
+
+    SHA_EXTENSIONS_TARGET __m128i LoadSha256MessageWords(const uint8_t* data)
+    {
+        const auto byteOrder = _mm_set_epi64x(0x0C0D0E0F08090A0BLL, 0x0405060700010203LL);
+        return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), byteOrder);
+    }
+
+    /**
+     * \brief Performs the rounds 4 * Group to 4 * Group + 3 of a SHA256 block.
+     */
+    template<int Group> SHA_EXTENSIONS_TARGET void Sha256RoundGroup(Sha256Registers& registers, const uint8_t* data)
+    {
+        auto& words = registers.m_schedule[Group % 4];
+        if constexpr (Group < 4)
+            words = LoadSha256MessageWords(data + Group * 16);
+        else
+        {
+            const auto& previousWords = registers.m_schedule[(Group - 1) % 4];
+            const auto partialWords = _mm_add_epi32(_mm_sha256msg1_epu32(words, registers.m_schedule[(Group - 3) % 4]),
+                                                    _mm_alignr_epi8(previousWords, registers.m_schedule[(Group - 2) % 4], 4));
+            words = _mm_sha256msg2_epu32(partialWords, previousWords);
+        }
+
+        auto roundInput = _mm_add_epi32(words, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&SHA256_ROUND_CONSTANTS[Group * 4])));
+        registers.m_cdgh = _mm_sha256rnds2_epu32(registers.m_cdgh, registers.m_abef, roundInput);
+        roundInput = _mm_shuffle_epi32(roundInput, 0x0E);
+        registers.m_abef = _mm_sha256rnds2_epu32(registers.m_abef, registers.m_cdgh, roundInput);
+    }
+
+    template<int... Groups>
+    SHA_EXTENSIONS_TARGET void Sha256RoundGroups(Sha256Registers& registers, const uint8_t* data, std::integer_sequence<int, Groups...>)
+    {
+        (Sha256RoundGroup<Groups>(registers, data), ...);
+    }
+
+    SHA_EXTENSIONS_TARGET void Sha256ProcessBlocks(uint32_t* state, const uint8_t* data, size_t blockCount)
+    {
+        // The round instructions expect the state words in the order ABEF and CDGH
+        const auto dcba = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0]));
+        const auto hgfe = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4]));
+        const auto cdab = _mm_shuffle_epi32(dcba, 0xB1);
+        const auto efgh = _mm_shuffle_epi32(hgfe, 0x1B);
+
+        Sha256Registers registers{};
+        registers.m_abef = _mm_alignr_epi8(cdab, efgh, 8);
+        registers.m_cdgh = _mm_blend_epi16(efgh, cdab, 0xF0);
+
+        for (; blockCount > 0; blockCount--, data += 64)
+        {
+            const auto initialAbef = registers.m_abef;
+            const auto initialCdgh = registers.m_cdgh;
+
+            Sha256RoundGroups(registers, data, std::make_integer_sequence<int, 16>());
+
+            registers.m_abef = _mm_add_epi32(registers.m_abef, initialAbef);
+            registers.m_cdgh = _mm_add_epi32(registers.m_cdgh, initialCdgh);
+        }
+
+        const auto feba = _mm_shuffle_epi32(registers.m_abef, 0x1B);
+        const auto dchg = _mm_shuffle_epi32(registers.m_cdgh, 0xB1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), _mm_blend_epi16(feba, dchg, 0xF0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), _mm_alignr_epi8(dchg, feba, 8));
+    }
+#endif
+} // namespace
+
+ShaExtensionsHash::ShaExtensionsHash(const Algorithm algorithm)
+    : m_algorithm(algorithm),
+      m_state{},
+      m_buffer{},
+      m_buffer_size(0u),
+      m_length(0u)
+{
+    Init();
+}
+
+bool ShaExtensionsHash::IsSupported()
+{
+#ifdef SHA_EXTENSIONS_AVAILABLE
+    return CpuFeatures::HasShaExtensions();
+#else
+    return false;
+#endif
+}
+
+void ShaExtensionsHash::Init()
+{
+    if (m_algorithm == Algorithm::SHA1)
+        std::memcpy(m_state, SHA1_INITIAL_STATE, sizeof(SHA1_INITIAL_STATE));
+    else
+        std::memcpy(m_state, SHA256_INITIAL_STATE, sizeof(SHA256_INITIAL_STATE));
+
+    m_buffer_size = 0u;
+    m_length = 0u;
+}
+
+void ShaExtensionsHash::ProcessBlocks(const uint8_t* data, const size_t blockCount)
+{
+#ifdef SHA_EXTENSIONS_AVAILABLE
+    if (m_algorithm == Algorithm::SHA1)
+        Sha1ProcessBlocks(m_state, data, blockCount);
+    else
+        Sha256ProcessBlocks(m_state, data, blockCount);
+#else
+    assert(false);
+#endif
+}
+
+void ShaExtensionsHash::Process(const void* input, size_t inputSize)
+{
+    const auto* data = static_cast<const uint8_t*>(input);
+    m_length += inputSize;
+
+    if (m_buffer_size > 0u)
+    {
+        const auto bufferedSize = std::min(inputSize, BLOCK_SIZE - m_buffer_size);
+        std::memcpy(&m_buffer[m_buffer_size], data, bufferedSize);
+        m_buffer_size += bufferedSize;
+        data += bufferedSize;
+        inputSize -= bufferedSize;
+
+        if (m_buffer_size < BLOCK_SIZE)
+            return;
+
+        ProcessBlocks(m_buffer, 1u);
+        m_buffer_size = 0u;
+    }
+
+    // Full blocks are hashed directly from the input
+    const auto blockCount = inputSize / BLOCK_SIZE;
+    if (blockCount > 0u)
+        ProcessBlocks(data, blockCount);
+
+    m_buffer_size = inputSize % BLOCK_SIZE;
+    std::memcpy(m_buffer, &data[blockCount * BLOCK_SIZE], m_buffer_size);
+}
+
+void ShaExtensionsHash::Finish(void* hashBuffer)
+{
+    const auto bitLength = m_length * 8u;
+
+    // Append a set bit and pad with zeros until there is just enough space left in the block for the big endian length
+    m_buffer[m_buffer_size++] = 0x80;
+    if (m_buffer_size > BLOCK_SIZE - sizeof(bitLength))
+    {
+        std::memset(&m_buffer[m_buffer_size], 0, BLOCK_SIZE - m_buffer_size);
+        ProcessBlocks(m_buffer, 1u);
+        m_buffer_size = 0u;
+    }
+
+    std::memset(&m_buffer[m_buffer_size], 0, BLOCK_SIZE - sizeof(bitLength) - m_buffer_size);
+    for (auto i = 0u; i < sizeof(bitLength); i++)
+        m_buffer[BLOCK_SIZE - 1u - i] = static_cast<uint8_t>(bitLength >> (i * 8u));
+    ProcessBlocks(m_buffer, 1u);
+
+    const auto stateWords = m_algorithm == Algorithm::SHA1 ? SHA1_STATE_WORDS : SHA256_STATE_WORDS;
+    auto* hash = static_cast<uint8_t*>(hashBuffer);
+    for (auto word = 0u; word < stateWords; word++)
+    {
+        hash[word * 4 + 0] = static_cast<uint8_t>(m_state[word] >> 24);
+        hash[word * 4 + 1] = static_cast<uint8_t>(m_state[word] >> 16);
+        hash[word * 4 + 2] = static_cast<uint8_t>(m_state[word] >> 8);
+        hash[word * 4 + 3] = static_cast<uint8_t>(m_state[word]);
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * \brief Computes SHA1 and SHA256 hashes using the SHA extensions of x86 CPUs.
+ * Must only be used when \c CpuFeatures::HasShaExtensions() reports them to be available.
+ */
+class ShaExtensionsHash
+{
+public:
+    enum class Algorithm
+    {
+        SHA1,
+        SHA256
+    };
+
+    explicit ShaExtensionsHash(Algorithm algorithm);
+
+    /**
+     * \return \c true if this implementation was compiled in and the executing CPU supports it.
+     */
+    static bool IsSupported();
+
+    void Init();
+    void Process(const void* input, size_t inputSize);
+    void Finish(void* hashBuffer);
+
+private:
+    static constexpr size_t BLOCK_SIZE = 64;
+    static constexpr size_t MAX_STATE_WORDS = 8;
+
+    void ProcessBlocks(const uint8_t* data, size_t blockCount);
+
+    Algorithm m_algorithm;
+    uint32_t m_state[MAX_STATE_WORDS];
+    uint8_t m_buffer[BLOCK_SIZE];
+    size_t m_buffer_size;
+    uint64_t m_length;
+};
@@ -0,0 +1,229 @@
+#include "BuildCache.h"
+
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr auto CACHE_FILE_HEADER = "OAT_BUILD_CACHE 1";
+    constexpr auto CACHE_KEY_ENVIRONMENT = "env";
+    constexpr auto CACHE_KEY_OUTPUT = "output";
+    constexpr auto CACHE_KEY_FILE = "file";
+    constexpr auto MISSING_FILE_HASH = "-";
+
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325u;
+    constexpr uint64_t FNV_PRIME = 0x100000001B3u;
+
+    std::string GetOutputFileState(const fs::path& outputFilePath)
+    {
+        std::error_code ec;
+        const auto fileSize = fs::file_size(outputFilePath, ec);
+        if (ec)
+            return {};
+
+        const auto lastWriteTime = fs::last_write_time(outputFilePath, ec);
+        if (ec)
+            return {};
+
+        return std::format("{} {}", fileSize, lastWriteTime.time_since_epoch().count());
+    }
+} // namespace
+
+class BuildCache::RecordingSearchPath final : public ISearchPath
+{
+public:
+    RecordingSearchPath(BuildCache& cache, std::string name, ISearchPath& searchPath)
+        : m_cache(cache),
+          m_name(std::move(name)),
+          m_search_path(searchPath)
+    {
+    }
+
+    SearchPathOpenFile Open(const std::string& fileName) override
+    {
+        // The file is opened separately for hashing to not need to keep it in memory
+        m_cache.RecordFile(m_name, fileName, HashFile(m_search_path, fileName));
+
+        return m_search_path.Open(fileName);
+    }
+
+    bool OpenMapped(const std::string& fileName, MemoryMappedFile& mappedFile) override
+    {
+        m_cache.RecordFile(m_name, fileName, HashFile(m_search_path, fileName));
+
+        return m_search_path.OpenMapped(fileName, mappedFile);
+    }
+
+    std::string GetPath() override
+    {
+        return m_search_path.GetPath();
+    }
+
+    void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override
+    {
+        m_cache.RecordSearch();
+        m_search_path.Find(options, callback);
+    }
+
+private:
+    BuildCache& m_cache;
+    std::string m_name;
+    ISearchPath& m_search_path;
+};
+
+BuildCache::BuildCache()
+    : m_is_cacheable(true)
+{
+}
+
+BuildCache::RecordedFile BuildCache::HashFile(ISearchPath& searchPath, const std::string& fileName)
+{
+    const auto file = searchPath.Open(fileName);
+    if (!file.IsOpen())
+        return RecordedFile{false, 0u};
+
+    auto hash = FNV_OFFSET_BASIS;
+    char buffer[0x10000];
+    while (!file.m_stream->eof())
+    {
+        file.m_stream->read(buffer, sizeof(buffer));
+        const auto readSize = static_cast<size_t>(file.m_stream->gcount());
+        if (readSize == 0)
+            break;
+
+        for (auto i = 0u; i < readSize; i++)
+        {
+            hash ^= static_cast<uint8_t>(buffer[i]);
+            hash *= FNV_PRIME;
+        }
+    }
+
+    return RecordedFile{true, hash};
+}
+
+void BuildCache::RecordFile(const std::string& searchPathName, const std::string& fileName, const RecordedFile& recordedFile)
+{
+    std::lock_guard lock(m_mutex);
+    m_recorded_files.try_emplace(std::make_pair(searchPathName, fileName), recordedFile);
+}
+
+void BuildCache::RecordSearch()
+{
+    // The result of a search cannot be verified later, so a build that searched can never be considered up to date
+    std::lock_guard lock(m_mutex);
+    m_is_cacheable = false;
+}
+
+std::unique_ptr<ISearchPath> BuildCache::Record(const std::string& name, ISearchPath& searchPath)
+{
+    m_search_paths[name] = &searchPath;
+
+    return std::make_unique<RecordingSearchPath>(*this, name, searchPath);
+}
+
+void BuildCache::AddEnvironment(std::string value)
+{
+    m_environment.emplace_back(std::move(value));
+}
+
+bool BuildCache::IsUpToDate(const fs::path& cacheFilePath, const fs::path& outputFilePath)
+{
+    std::ifstream stream(cacheFilePath);
+    if (!stream.is_open())
+        return false;
+
+    std::string line;
+    if (!std::getline(stream, line) || line != CACHE_FILE_HEADER)
+        return false;
+
+    std::vector<std::string> environment;
+    auto outputMatches = false;
+    while (std::getline(stream, line))
+    {
+        std::istringstream lineStream(line);
+        std::string key;
+        lineStream >> key;
+        lineStream.get();
+
+        std::string value;
+        if (key == CACHE_KEY_ENVIRONMENT)
+        {
+            std::getline(lineStream, value);
+            environment.emplace_back(std::move(value));
+        }
+        else if (key == CACHE_KEY_OUTPUT)
+        {
+            std::getline(lineStream, value);
+            const auto outputFileState = GetOutputFileState(outputFilePath);
+            if (outputFileState.empty() || outputFileState != value)
+                return false;
+
+            outputMatches = true;
+        }
+        else if (key == CACHE_KEY_FILE)
+        {
+            std::string searchPathName;
+            std::string hashValue;
+            lineStream >> searchPathName >> hashValue;
+            lineStream.get();
+            std::getline(lineStream, value);
+
+            const auto searchPath = m_search_paths.find(searchPathName);
+            if (searchPath == m_search_paths.end())
+                return false;
+
+            const auto recordedFile = HashFile(*searchPath->second, value);
+            const auto recordedHashValue = recordedFile.m_exists ? std::format("{:016x}", recordedFile.m_hash) : MISSING_FILE_HASH;
+            if (recordedHashValue != hashValue)
+                return false;
+        }
+        else
+            return false;
+    }
+
+    return outputMatches && environment == m_environment;
+}
+
+void BuildCache::Save(const fs::path& cacheFilePath, const fs::path& outputFilePath)
+{
+    std::error_code ec;
+    if (!m_is_cacheable)
+    {
+        fs::remove(cacheFilePath, ec);
+        return;
+    }
+
+    const auto outputFileState = GetOutputFileState(outputFilePath);
+    if (outputFileState.empty())
+        return;
+
+    fs::create_directories(cacheFilePath.parent_path(), ec);
+    std::ofstream stream(cacheFilePath, std::fstream::out | std::fstream::trunc);
+    if (!stream.is_open())
+    {
+        std::cerr << std::format("Could not write build cache \"{}\"\n", cacheFilePath.string());
+        return;
+    }
+
+    stream << CACHE_FILE_HEADER << '\n';
+    for (const auto& value : m_environment)
+        stream << CACHE_KEY_ENVIRONMENT << ' ' << value << '\n';
+
+    stream << CACHE_KEY_OUTPUT << ' ' << outputFileState << '\n';
+
+    std::lock_guard lock(m_mutex);
+    for (const auto& [key, recordedFile] : m_recorded_files)
+    {
+        const auto& [searchPathName, fileName] = key;
+        stream << CACHE_KEY_FILE << ' ' << searchPathName << ' ';
+        if (recordedFile.m_exists)
+            stream << std::format("{:016x}", recordedFile.m_hash);
+        else
+            stream << MISSING_FILE_HASH;
+        stream << ' ' << fileName << '\n';
+    }
+}
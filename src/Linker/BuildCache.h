@@ -0,0 +1,71 @@
+#pragma once
+
+#include "SearchPath/ISearchPath.h"
+#include "Utils/ClassUtils.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief Records all files a target reads while being built to be able to skip building it again when none of them changed.
+ */
+class BuildCache
+{
+    class RecordedFile
+    {
+    public:
+        bool m_exists;
+        uint64_t m_hash;
+    };
+
+    class RecordingSearchPath;
+
+    // Keyed by search path name and file name
+    std::map<std::pair<std::string, std::string>, RecordedFile> m_recorded_files;
+    std::map<std::string, ISearchPath*> m_search_paths;
+    std::vector<std::string> m_environment;
+    bool m_is_cacheable;
+    std::mutex m_mutex;
+
+    static RecordedFile HashFile(ISearchPath& searchPath, const std::string& fileName);
+    void RecordFile(const std::string& searchPathName, const std::string& fileName, const RecordedFile& recordedFile);
+    void RecordSearch();
+
+public:
+    BuildCache();
+
+    /**
+     * \brief Creates a search path that forwards to the specified search path and records every file that is opened through it.
+     * \param name The name to identify the search path with in the cache file.
+     * \param searchPath The search path to forward to. It must outlive the created search path.
+     * \return The recording search path.
+     */
+    std::unique_ptr<ISearchPath> Record(const std::string& name, ISearchPath& searchPath);
+
+    /**
+     * \brief Adds a value that influences the build output without being read from a search path, like the game or the tool version.
+     * \param value The value to add.
+     */
+    void AddEnvironment(std::string value);
+
+    /**
+     * \brief Checks whether a previous build recorded in the specified cache file is still up to date.
+     * \param cacheFilePath The path to the cache file of the previous build.
+     * \param outputFilePath The path to the output file of the previous build.
+     * \return \c true if the output file and all files read by the previous build are unchanged, otherwise \c false.
+     */
+    _NODISCARD bool IsUpToDate(const std::filesystem::path& cacheFilePath, const std::filesystem::path& outputFilePath);
+
+    /**
+     * \brief Saves all recorded files to the specified cache file. Nothing is saved when the recorded files do not fully describe the build.
+     * \param cacheFilePath The path to the cache file.
+     * \param outputFilePath The path to the output file of the build.
+     */
+    void Save(const std::filesystem::path& cacheFilePath, const std::filesystem::path& outputFilePath);
+};
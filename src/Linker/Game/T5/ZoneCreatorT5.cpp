@@ -83,6 +83,10 @@ std::unique_ptr<Zone> ZoneCreator::CreateZoneForDefinition(ZoneCreationContext&
     if (!CreateIgnoredAssetMap(context, assetLoadingContext->m_ignored_asset_map))
         return nullptr;
 
+    assetLoadingContext->m_previous_dependency_graph = context.m_previous_dependency_graph;
+
+    std::vector<std::pair<asset_type_t, std::string>> assets;
+    assets.reserve(context.m_definition->m_assets.size());
     for (const auto& assetEntry : context.m_definition->m_assets)
     {
         const auto foundAssetTypeEntry = m_asset_types_by_name.find(assetEntry.m_asset_type);
@@ -92,11 +96,17 @@ std::unique_ptr<Zone> ZoneCreator::CreateZoneForDefinition(ZoneCreationContext&
             return nullptr;
         }
 
-        if (!ObjLoading::LoadAssetForZone(assetLoadingContext.get(), foundAssetTypeEntry->second, assetEntry.m_asset_name))
-            return nullptr;
+        assets.emplace_back(foundAssetTypeEntry->second, assetEntry.m_asset_name);
     }
 
+    // Raw files are read in the background while assets are loaded one after another
+    ObjLoading::PrefetchAssetsForZone(assetLoadingContext.get(), assets);
+
+    if (!ObjLoading::LoadAssetsForZone(assetLoadingContext.get(), assets))
+        return nullptr;
+
     ObjLoading::FinalizeAssetsForZone(assetLoadingContext.get());
+    context.m_dependency_graph = std::move(assetLoadingContext->m_dependency_graph);
 
     return zone;
 }
@@ -1,22 +1,36 @@
 #include "Linker.h"
 
+#include "AssetLoading/LoadedAssetCache.h"
+#include "BuildCache.h"
 #include "Game/IW3/ZoneCreatorIW3.h"
 #include "Game/IW4/ZoneCreatorIW4.h"
 #include "Game/IW5/ZoneCreatorIW5.h"
 #include "Game/T5/ZoneCreatorT5.h"
 #include "Game/T6/ZoneCreatorT6.h"
+#include "GitVersion.h"
 #include "LinkerArgs.h"
 #include "LinkerSearchPaths.h"
 #include "ObjContainer/IPak/IPakWriter.h"
 #include "ObjContainer/IWD/IWD.h"
+#include "ObjContainer/IWD/IWDWriter.h"
+#include "Obj/Gdt/GdtCache.h"
 #include "ObjContainer/SoundBank/SoundBankWriter.h"
 #include "ObjLoading.h"
 #include "ObjWriting.h"
+#include "RawFile/RawFileCompressionCache.h"
 #include "SearchPath/SearchPaths.h"
+#include "Shader/ShaderInfoCache.h"
 #include "Utils/Arguments/ArgumentParser.h"
+#include "Utils/BenchmarkReport.h"
 #include "Utils/ClassUtils.h"
+#include "Utils/FileWatcher.h"
 #include "Utils/ObjFileStream.h"
+#include "Utils/ProcessMemory.h"
+#include "Utils/ProgressReporter.h"
 #include "Utils/StringUtils.h"
+#include "Utils/ThreadPool.h"
+#include "Utils/Tracing.h"
+#include "Utils/WorkClaims.h"
 #include "Zone/AssetList/AssetList.h"
 #include "Zone/AssetList/AssetListStream.h"
 #include "Zone/Definition/ZoneDefinitionStream.h"
@@ -25,12 +39,19 @@
 #include "ZoneLoading.h"
 #include "ZoneWriting.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <deque>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <iostream>
+#include <mutex>
 #include <regex>
 #include <set>
+#include <sstream>
+#include <thread>
 
 namespace fs = std::filesystem;
 
@@ -47,6 +68,7 @@ enum class ProjectType
     NONE,
     FASTFILE,
     IPAK,
+    IWD,
 
     MAX
 };
@@ -55,18 +77,40 @@ constexpr const char* PROJECT_TYPE_NAMES[static_cast<unsigned>(ProjectType::MAX)
     "none",
     "fastfile",
     "ipak",
+    "iwd",
 };
 
 class LinkerImpl final : public Linker
 {
+    static constexpr auto METADATA_COMPRESSION_LEVEL = "compression_level";
+    static constexpr auto METADATA_COMPRESSION_STRATEGY = "compression_strategy";
     static constexpr auto METADATA_GAME = "game";
     static constexpr auto METADATA_GDT = "gdt";
     static constexpr auto METADATA_NAME = "name";
     static constexpr auto METADATA_TYPE = "type";
 
+    static constexpr auto BUILD_CACHE_FOLDER = ".build_cache";
+
+    // Editors save files in multiple steps so changes are only built once files stopped changing for one interval
+    static constexpr auto WATCH_POLL_INTERVAL = std::chrono::milliseconds(250);
+
     LinkerArgs m_args;
     LinkerSearchPaths m_search_paths;
+    std::unique_ptr<LoadedAssetCache> m_loaded_assets;
     std::vector<std::unique_ptr<Zone>> m_loaded_zones;
+    std::vector<fs::file_time_type> m_loaded_zone_write_times;
+
+    // Zones are only loaded once the first target actually needs to be linked
+    bool m_zones_load_attempted = false;
+    bool m_zones_loaded = false;
+    std::unique_ptr<benchmarking::BenchmarkReport> m_benchmark_report;
+    std::ofstream m_progress_stream;
+    std::unique_ptr<progress::IProgressReporter> m_progress_reporter;
+    std::unique_ptr<WorkClaims> m_work_claims;
+    FileWatcher m_file_watcher;
+
+    // Guards search paths, obj containers and global asset pools when building multiple projects at once
+    std::mutex m_shared_state_mutex;
 
     bool IncludeAdditionalZoneDefinitions(const std::string& initialFileName, ZoneDefinition& zoneDefinition, ISearchPath* sourceSearchPath) const
     {
@@ -126,12 +170,7 @@ class LinkerImpl final : public Linker
             if (assetListStream.IsOpen())
             {
                 const AssetListInputStream stream(*assetListStream.m_stream);
-                AssetListEntry entry;
-
-                while (stream.NextEntry(entry))
-                {
-                    assetList.m_entries.emplace_back(std::move(entry));
-                }
+                stream.ReadAllEntries(assetList);
                 return true;
             }
         }
@@ -342,6 +381,71 @@ class LinkerImpl final : public Linker
         return true;
     }
 
+    static bool ParseCompressionLevel(int& compressionLevel, const std::string& value)
+    {
+        char* endPtr;
+        const auto parsedValue = strtoul(value.c_str(), &endPtr, 10);
+        if (value.empty() || *endPtr != '\0' || parsedValue > LinkerArgs::MAX_COMPRESSION_LEVEL)
+            return false;
+
+        compressionLevel = static_cast<int>(parsedValue);
+        return true;
+    }
+
+    bool GetWritingOptionsFromZoneDefinition(ZoneWritingOptions& options, const std::string& targetName, const ZoneDefinition& zoneDefinition) const
+    {
+        // The compression level of the zone definition takes precedence over the one specified on the command line
+        options.m_compression_level = m_args.m_compression_level;
+
+        auto firstCompressionLevelEntry = true;
+        const auto [rangeBegin, rangeEnd] = zoneDefinition.m_metadata_lookup.equal_range(METADATA_COMPRESSION_LEVEL);
+        for (auto i = rangeBegin; i != rangeEnd; ++i)
+        {
+            int compressionLevel;
+            if (!ParseCompressionLevel(compressionLevel, i->second->m_value))
+            {
+                std::cerr << std::format("Not a valid compression level in target \"{}\": \"{}\"\n", targetName, i->second->m_value);
+                return false;
+            }
+
+            if (!firstCompressionLevelEntry && options.m_compression_level != compressionLevel)
+            {
+                std::cerr << std::format(
+                    "Conflicting compression levels in target \"{}\": {} != {}\n", targetName, options.m_compression_level, compressionLevel);
+                return false;
+            }
+
+            options.m_compression_level = compressionLevel;
+            firstCompressionLevelEntry = false;
+        }
+
+        // Same for the compression strategy
+        options.m_compression_strategy = m_args.m_compression_strategy;
+
+        auto firstCompressionStrategyEntry = true;
+        const auto [strategyRangeBegin, strategyRangeEnd] = zoneDefinition.m_metadata_lookup.equal_range(METADATA_COMPRESSION_STRATEGY);
+        for (auto i = strategyRangeBegin; i != strategyRangeEnd; ++i)
+        {
+            CompressionStrategy compressionStrategy;
+            if (!ZoneWritingOptions::ParseCompressionStrategy(i->second->m_value, compressionStrategy))
+            {
+                std::cerr << std::format("Not a valid compression strategy in target \"{}\": \"{}\"\n", targetName, i->second->m_value);
+                return false;
+            }
+
+            if (!firstCompressionStrategyEntry && options.m_compression_strategy != compressionStrategy)
+            {
+                std::cerr << std::format("Conflicting compression strategies in target \"{}\"\n", targetName);
+                return false;
+            }
+
+            options.m_compression_strategy = compressionStrategy;
+            firstCompressionStrategyEntry = false;
+        }
+
+        return true;
+    }
+
     static bool LoadGdtFilesFromZoneDefinition(std::vector<std::unique_ptr<Gdt>>& gdtList, const ZoneDefinition& zoneDefinition, ISearchPath* gdtSearchPath)
     {
         const auto [rangeBegin, rangeEnd] = zoneDefinition.m_metadata_lookup.equal_range(METADATA_GDT);
@@ -354,9 +458,8 @@ class LinkerImpl final : public Linker
                 return false;
             }
 
-            GdtReader gdtReader(*gdtFile.m_stream);
-            auto gdt = std::make_unique<Gdt>();
-            if (!gdtReader.Read(*gdt))
+            auto gdt = GdtCache::Instance.ReadGdt(i->second->m_value, *gdtFile.m_stream);
+            if (!gdt)
             {
                 std::cerr << std::format("Failed to read gdt file \"{}\"\n", i->second->m_value);
                 return false;
@@ -372,7 +475,8 @@ class LinkerImpl final : public Linker
                                                   ZoneDefinition& zoneDefinition,
                                                   ISearchPath* assetSearchPath,
                                                   ISearchPath* gdtSearchPath,
-                                                  ISearchPath* sourceSearchPath) const
+                                                  ISearchPath* sourceSearchPath,
+                                                  const fs::path& dependencyGraphFilePath) const
     {
         const auto context = std::make_unique<ZoneCreationContext>(assetSearchPath, &zoneDefinition);
         if (!ProcessZoneDefinitionIgnores(targetName, *context, sourceSearchPath))
@@ -383,18 +487,49 @@ class LinkerImpl final : public Linker
         if (!LoadGdtFilesFromZoneDefinition(context->m_gdt_files, zoneDefinition, gdtSearchPath))
             return nullptr;
 
+        // The graph of the previous build tells which assets can be loaded ahead of time
+        AssetDependencyGraph previousDependencyGraph;
+        if (previousDependencyGraph.Load(dependencyGraphFilePath))
+            context->m_previous_dependency_graph = &previousDependencyGraph;
+
         for (const auto* zoneCreator : ZONE_CREATORS)
         {
-            if (zoneCreator->SupportsGame(context->m_game_name))
-                return zoneCreator->CreateZoneForDefinition(*context);
+            if (!zoneCreator->SupportsGame(context->m_game_name))
+                continue;
+
+            auto zone = zoneCreator->CreateZoneForDefinition(*context);
+            if (zone)
+                SaveDependencyGraph(context->m_dependency_graph, dependencyGraphFilePath, *zone);
+
+            return zone;
         }
 
         std::cerr << std::format("Unsupported game: {}\n", context->m_game_name);
         return nullptr;
     }
 
-    bool WriteZoneToFile(const std::string& projectName, Zone* zone) const
+    void SaveDependencyGraph(const AssetDependencyGraph& dependencyGraph, const fs::path& dependencyGraphFilePath, const Zone& zone) const
     {
+        if (m_args.m_verbose)
+        {
+            const auto levels = dependencyGraph.GetLevels();
+            std::cout << std::format("Dependency graph of zone \"{}\": {} assets in {} levels, {} without dependencies\n",
+                                     zone.m_name,
+                                     dependencyGraph.GetNodes().size(),
+                                     levels.size(),
+                                     levels.empty() ? 0u : levels[0].size());
+        }
+
+        if (!dependencyGraph.Save(dependencyGraphFilePath, *zone.m_pools))
+            std::cerr << std::format("Failed to save dependency graph \"{}\"\n", dependencyGraphFilePath.string());
+    }
+
+    bool WriteZoneToFile(const std::string& projectName, Zone* zone, const ZoneWritingOptions& writingOptions) const
+    {
+        TRACE_SCOPE("Linker", "WriteZone " + zone->m_name);
+        benchmarking::ScopedPhase benchmarkPhase(m_benchmark_report.get(), "write");
+        benchmarkPhase.AddAssets(zone->m_pools->GetTotalAssetCount());
+
         const fs::path zoneFolderPath(m_args.GetOutputFolderPathForProject(projectName));
         auto zoneFilePath(zoneFolderPath);
         zoneFilePath.append(zone->m_name + ".ff");
@@ -405,7 +540,7 @@ class LinkerImpl final : public Linker
         if (!stream.is_open())
             return false;
 
-        if (!ZoneWriting::WriteZone(stream, zone))
+        if (!ZoneWriting::WriteZone(stream, zone, writingOptions))
         {
             std::cerr << "Writing zone failed.\n";
             stream.close();
@@ -414,28 +549,69 @@ class LinkerImpl final : public Linker
 
         std::cout << std::format("Created zone \"{}\"\n", zoneFilePath.string());
 
+        const auto writtenBytes = static_cast<uint64_t>(stream.tellp());
+        benchmarkPhase.AddBytesWritten(writtenBytes);
         stream.close();
+
+        if (m_progress_reporter)
+            m_progress_reporter->OnFileWritten(zoneFilePath.string(), writtenBytes);
+
         return true;
     }
 
-    bool BuildFastFile(const std::string& projectName,
-                       const std::string& targetName,
-                       ZoneDefinition& zoneDefinition,
-                       SearchPaths& assetSearchPaths,
-                       SearchPaths& gdtSearchPaths,
-                       SearchPaths& sourceSearchPaths) const
+    static bool PrintZoneContentSizes(Zone* zone)
     {
-        SoundBankWriter::OutputPath = fs::path(m_args.GetOutputFolderPathForProject(projectName));
+        ZoneContentSizes sizes;
+        if (!ZoneWriting::CountZoneContentSizes(zone, sizes))
+        {
+            std::cerr << "Counting zone sizes failed.\n";
+            return false;
+        }
 
-        const auto zone = CreateZoneForDefinition(targetName, zoneDefinition, &assetSearchPaths, &gdtSearchPaths, &sourceSearchPaths);
-        auto result = zone != nullptr;
-        if (zone)
-            result = WriteZoneToFile(projectName, zone.get());
+        std::cout << std::format("Sizes of zone \"{}\":\n", zone->m_name);
+        for (const auto& blockSize : sizes.m_block_sizes)
+            std::cout << std::format("  Block {}: {}\n", blockSize.m_name, blockSize.m_size);
 
-        return result;
+        for (const auto& [assetType, size] : sizes.m_asset_type_sizes)
+            std::cout << std::format("  Asset type {}: {}\n", zone->m_pools->GetAssetTypeName(assetType), size);
+
+        return true;
+    }
+
+    static void PrintAssetMemoryUsage(const Zone* zone)
+    {
+        const auto* memory = zone->GetMemory();
+
+        std::cout << std::format("Memory of zone \"{}\":\n", zone->m_name);
+        for (const auto& [assetType, usage] : memory->GetAssetMemoryUsage())
+        {
+            std::cout << std::format(
+                "  Asset type {}: {} assets, {} heap bytes\n", zone->m_pools->GetAssetTypeName(assetType), usage.m_asset_count, usage.m_heap_size);
+        }
+
+        std::cout << std::format("  Total: {} heap bytes\n", memory->GetAllocatedSize());
+    }
+
+    void PrintPeakMemoryUsage(const std::string& phase) const
+    {
+        if (m_args.m_verbose)
+            std::cout << std::format("Peak memory usage after {}: {:.1f} MiB\n", phase, static_cast<double>(process_memory::GetPeakUsage()) / (1024.0 * 1024.0));
     }
 
-    bool BuildIPak(const std::string& projectName, const ZoneDefinition& zoneDefinition, SearchPaths& assetSearchPaths) const
+    std::unique_ptr<Zone> LinkFastFile(const std::string& projectName,
+                                       const std::string& targetName,
+                                       ZoneDefinition& zoneDefinition,
+                                       ISearchPath& assetSearchPaths,
+                                       ISearchPath& gdtSearchPaths,
+                                       ISearchPath& sourceSearchPaths,
+                                       const fs::path& dependencyGraphFilePath) const
+    {
+        SoundBankWriter::OutputPath = fs::path(m_args.GetOutputFolderPathForProject(projectName));
+
+        return CreateZoneForDefinition(targetName, zoneDefinition, &assetSearchPaths, &gdtSearchPaths, &sourceSearchPaths, dependencyGraphFilePath);
+    }
+
+    bool BuildIPak(const std::string& projectName, const ZoneDefinition& zoneDefinition, ISearchPath& assetSearchPaths) const
     {
         const fs::path ipakFolderPath(m_args.GetOutputFolderPathForProject(projectName));
         auto ipakFilePath(ipakFolderPath);
@@ -443,11 +619,22 @@ class LinkerImpl final : public Linker
 
         fs::create_directories(ipakFolderPath);
 
-        std::ofstream stream(ipakFilePath, std::fstream::out | std::fstream::binary);
+        // A previously built ipak is used as seed to avoid compressing images that did not change again.
+        // The new ipak is written next to it since the seed needs to stay readable while writing.
+        std::ifstream seedStream;
+        if (fs::is_regular_file(ipakFilePath))
+            seedStream.open(ipakFilePath, std::fstream::in | std::fstream::binary);
+
+        auto writtenFilePath(ipakFilePath);
+        if (seedStream.is_open())
+            writtenFilePath.replace_extension(".ipak.tmp");
+
+        std::ofstream stream(writtenFilePath, std::fstream::out | std::fstream::binary);
         if (!stream.is_open())
             return false;
 
-        const auto ipakWriter = IPakWriter::Create(stream, &assetSearchPaths);
+        const auto ipakWriter =
+            seedStream.is_open() ? IPakWriter::Create(stream, &assetSearchPaths, seedStream) : IPakWriter::Create(stream, &assetSearchPaths);
         for (const auto& assetEntry : zoneDefinition.m_assets)
         {
             if (assetEntry.m_is_reference)
@@ -457,16 +644,86 @@ class LinkerImpl final : public Linker
                 ipakWriter->AddImage(assetEntry.m_asset_name);
         }
 
-        if (!ipakWriter->Write())
+        const auto result = ipakWriter->Write();
+        const auto writtenBytes = static_cast<uint64_t>(stream.tellp());
+        stream.close();
+        seedStream.close();
+
+        if (!result)
         {
             std::cerr << "Writing ipak failed.\n";
-            stream.close();
+            if (writtenFilePath != ipakFilePath)
+                fs::remove(writtenFilePath);
             return false;
         }
 
+        if (writtenFilePath != ipakFilePath)
+        {
+            std::error_code ec;
+            fs::rename(writtenFilePath, ipakFilePath, ec);
+            if (ec)
+            {
+                std::cerr << std::format("Could not replace ipak \"{}\": {}\n", ipakFilePath.string(), ec.message());
+                return false;
+            }
+        }
+
         std::cout << std::format("Created ipak \"{}\"\n", ipakFilePath.string());
 
+        if (m_progress_reporter)
+            m_progress_reporter->OnFileWritten(ipakFilePath.string(), writtenBytes);
+
+        return true;
+    }
+
+    static std::string GetIWDFileNameForAsset(const ZoneDefinitionEntry& asset)
+    {
+        if (asset.m_asset_type == "image")
+            return std::format("images/{}.iwi", asset.m_asset_name);
+        if (asset.m_asset_type == "sound" || asset.m_asset_type == "loaded_sound")
+            return std::format("sound/{}", asset.m_asset_name);
+
+        // Any other entry names a file relative to the search paths like a rawfile does
+        return asset.m_asset_name;
+    }
+
+    bool BuildIWD(const std::string& projectName, const ZoneDefinition& zoneDefinition, ISearchPath& assetSearchPaths) const
+    {
+        const fs::path iwdFolderPath(m_args.GetOutputFolderPathForProject(projectName));
+        auto iwdFilePath(iwdFolderPath);
+        iwdFilePath.append(zoneDefinition.m_name + ".iwd");
+
+        fs::create_directories(iwdFolderPath);
+
+        std::ofstream stream(iwdFilePath, std::fstream::out | std::fstream::binary);
+        if (!stream.is_open())
+            return false;
+
+        const auto iwdWriter = IWDWriter::Create(stream, &assetSearchPaths);
+        for (const auto& assetEntry : zoneDefinition.m_assets)
+        {
+            if (assetEntry.m_is_reference)
+                continue;
+
+            iwdWriter->AddFile(GetIWDFileNameForAsset(assetEntry));
+        }
+
+        const auto result = iwdWriter->Write();
+        const auto writtenBytes = static_cast<uint64_t>(stream.tellp());
         stream.close();
+
+        if (!result)
+        {
+            std::cerr << "Writing iwd failed.\n";
+            fs::remove(iwdFilePath);
+            return false;
+        }
+
+        std::cout << std::format("Created iwd \"{}\"\n", iwdFilePath.string());
+
+        if (m_progress_reporter)
+            m_progress_reporter->OnFileWritten(iwdFilePath.string(), writtenBytes);
+
         return true;
     }
 
@@ -486,11 +743,94 @@ class LinkerImpl final : public Linker
                                    });
     }
 
+    fs::path GetOutputFilePath(const std::string& projectName, const ZoneDefinition& zoneDefinition, const ProjectType projectType) const
+    {
+        fs::path outputFilePath(m_args.GetOutputFolderPathForProject(projectName));
+        switch (projectType)
+        {
+        case ProjectType::IPAK:
+            outputFilePath.append(zoneDefinition.m_name + ".ipak");
+            break;
+        case ProjectType::IWD:
+            outputFilePath.append(zoneDefinition.m_name + ".iwd");
+            break;
+        default:
+            outputFilePath.append(zoneDefinition.m_name + ".ff");
+            break;
+        }
+
+        return outputFilePath;
+    }
+
+    static fs::path GetBuildCacheFilePath(const fs::path& outputFilePath)
+    {
+        auto cacheFilePath = outputFilePath.parent_path();
+        cacheFilePath.append(BUILD_CACHE_FOLDER);
+        cacheFilePath.append(outputFilePath.filename().string() + ".cache");
+
+        return cacheFilePath;
+    }
+
+    static fs::path GetDependencyGraphFilePath(const fs::path& outputFilePath)
+    {
+        auto graphFilePath = outputFilePath.parent_path();
+        graphFilePath.append(BUILD_CACHE_FOLDER);
+        graphFilePath.append(outputFilePath.filename().string() + ".deps");
+
+        return graphFilePath;
+    }
+
+    void AddBuildEnvironment(BuildCache& buildCache, const std::string& gameName, const ProjectType projectType) const
+    {
+        buildCache.AddEnvironment(std::format("version {}", GIT_VERSION));
+        buildCache.AddEnvironment(std::format("game {}", gameName));
+        buildCache.AddEnvironment(std::format("type {}", PROJECT_TYPE_NAMES[static_cast<unsigned>(projectType)]));
+        buildCache.AddEnvironment(std::format("menu {} {}", ObjLoading::Configuration.MenuPermissiveParsing, ObjLoading::Configuration.MenuNoOptimization));
+        buildCache.AddEnvironment(
+            std::format("xmodel {} {}", ObjLoading::Configuration.OptimizeModelMeshes, ObjLoading::Configuration.BuildModelCollisionTrees));
+
+        // Assets of loaded zones can be used when building so they are part of the build as well
+        for (const auto& zonePath : m_args.m_zones_to_load)
+        {
+            std::error_code ec;
+            const auto fileSize = fs::file_size(zonePath, ec);
+            const auto lastWriteTime = fs::last_write_time(zonePath, ec);
+            buildCache.AddEnvironment(std::format("load {} {} {}", fileSize, lastWriteTime.time_since_epoch().count(), zonePath));
+        }
+    }
+
+    /**
+     * \brief Watches search paths for changes when running in watch mode. Must be called while holding the shared state lock.
+     * \param searchPaths The search paths to watch.
+     */
+    void WatchSearchPaths(const std::set<std::string>& searchPaths)
+    {
+        if (!m_args.m_watch_mode)
+            return;
+
+        for (const auto& searchPath : searchPaths)
+            m_file_watcher.Watch(searchPath);
+    }
+
+    /**
+     * \brief Builds a single target of a project and all targets it references.
+     * Everything touching state that is shared between projects is done while holding the shared state lock so multiple projects can be built at once.
+     * \param projectName The name of the project to build.
+     * \param targetName The name of the target to build.
+     * \return \c true if building the target was successful, otherwise \c false.
+     */
     bool BuildProject(const std::string& projectName, const std::string& targetName)
     {
+        TRACE_SCOPE("Linker", "BuildProject " + targetName);
+
+        std::unique_lock sharedStateLock(m_shared_state_mutex);
+
+        BuildCache buildCache;
         auto sourceSearchPaths = m_search_paths.GetSourceSearchPathsForProject(projectName);
+        const auto recordedSourceSearchPaths = buildCache.Record("source", sourceSearchPaths);
+        WatchSearchPaths(m_args.GetSourceSearchPathsForProject(projectName));
 
-        const auto zoneDefinition = ReadZoneDefinition(targetName, &sourceSearchPaths);
+        const auto zoneDefinition = ReadZoneDefinition(targetName, recordedSourceSearchPaths.get());
         if (!zoneDefinition)
             return false;
 
@@ -499,6 +839,11 @@ class LinkerImpl final : public Linker
             return false;
 
         auto result = true;
+        auto shouldSaveBuildCache = false;
+        std::unique_ptr<Zone> zone;
+        ZoneWritingOptions writingOptions;
+        fs::path outputFilePath;
+        fs::path buildCacheFilePath;
         if (projectType != ProjectType::NONE)
         {
             std::string gameName;
@@ -506,33 +851,184 @@ class LinkerImpl final : public Linker
                 return false;
             utils::MakeStringLowerCase(gameName);
 
-            auto assetSearchPaths = m_search_paths.GetAssetSearchPathsForProject(gameName, projectName);
-            auto gdtSearchPaths = m_search_paths.GetGdtSearchPathsForProject(gameName, projectName);
-
-            switch (projectType)
+            SearchPaths assetSearchPaths;
+            SearchPaths gdtSearchPaths;
             {
-            case ProjectType::FASTFILE:
-                result = BuildFastFile(projectName, targetName, *zoneDefinition, assetSearchPaths, gdtSearchPaths, sourceSearchPaths);
-                break;
+                // Building the search paths of a project loads the obj containers inside them
+                benchmarking::ScopedPhase benchmarkPhase(m_benchmark_report.get(), "obj load");
+                assetSearchPaths = m_search_paths.GetAssetSearchPathsForProject(gameName, projectName);
+                gdtSearchPaths = m_search_paths.GetGdtSearchPathsForProject(gameName, projectName);
+            }
+            const auto recordedAssetSearchPaths = buildCache.Record("asset", assetSearchPaths);
+            const auto recordedGdtSearchPaths = buildCache.Record("gdt", gdtSearchPaths);
+            WatchSearchPaths(m_args.GetAssetSearchPathsForProject(gameName, projectName));
+            WatchSearchPaths(m_args.GetGdtSearchPathsForProject(gameName, projectName));
+            AddBuildEnvironment(buildCache, gameName, projectType);
 
-            case ProjectType::IPAK:
-                result = BuildIPak(projectName, *zoneDefinition, assetSearchPaths);
-                break;
+            if (!GetWritingOptionsFromZoneDefinition(writingOptions, targetName, *zoneDefinition))
+                return false;
+            buildCache.AddEnvironment(std::format("compression {}", writingOptions.m_compression_level));
+            buildCache.AddEnvironment(std::format("compression strategy {}", static_cast<int>(writingOptions.m_compression_strategy)));
+            buildCache.AddEnvironment(std::format("asset order {}", static_cast<unsigned>(ZoneWriting::Configuration.AssetOrder)));
+
+            outputFilePath = GetOutputFilePath(projectName, *zoneDefinition, projectType);
+            buildCacheFilePath = GetBuildCacheFilePath(outputFilePath);
 
-            default:
-                assert(false);
+            if (m_args.m_use_build_cache && buildCache.IsUpToDate(buildCacheFilePath, outputFilePath))
+            {
+                std::cout << std::format("Target \"{}\" is up to date\n", targetName);
+            }
+            else if (projectType == ProjectType::FASTFILE && !EnsureZonesLoaded())
+            {
                 result = false;
-                break;
+            }
+            else
+            {
+                benchmarking::ScopedPhase benchmarkPhase(m_benchmark_report.get(), "link");
+                switch (projectType)
+                {
+                case ProjectType::FASTFILE:
+                    zone = LinkFastFile(projectName,
+                                        targetName,
+                                        *zoneDefinition,
+                                        *recordedAssetSearchPaths,
+                                        *recordedGdtSearchPaths,
+                                        *recordedSourceSearchPaths,
+                                        GetDependencyGraphFilePath(outputFilePath));
+                    result = zone != nullptr;
+                    if (zone)
+                        benchmarkPhase.AddAssets(zone->m_pools->GetTotalAssetCount());
+                    break;
+
+                case ProjectType::IPAK:
+                    result = m_args.m_dry_run || BuildIPak(projectName, *zoneDefinition, *recordedAssetSearchPaths);
+                    break;
+
+                case ProjectType::IWD:
+                    result = m_args.m_dry_run || BuildIWD(projectName, *zoneDefinition, *recordedAssetSearchPaths);
+                    break;
+
+                default:
+                    assert(false);
+                    result = false;
+                    break;
+                }
+
+                shouldSaveBuildCache = result && m_args.m_use_build_cache;
             }
         }
 
         m_search_paths.UnloadProjectSpecificSearchPaths();
+        sharedStateLock.unlock();
+
+        // Writing the linked zone only touches the zone itself
+        if (zone)
+        {
+            if (m_args.m_verbose)
+                PrintAssetMemoryUsage(zone.get());
+
+            result = m_args.m_dry_run ? PrintZoneContentSizes(zone.get()) : WriteZoneToFile(projectName, zone.get(), writingOptions);
+            PrintPeakMemoryUsage(std::format("building \"{}\"", targetName));
+
+            sharedStateLock.lock();
+            zone.reset();
+            sharedStateLock.unlock();
+        }
+
+        if (result && shouldSaveBuildCache)
+            buildCache.Save(buildCacheFilePath, outputFilePath);
 
         result = result && BuildReferencedTargets(projectName, targetName, *zoneDefinition);
 
         return result;
     }
 
+    bool BuildProjectSpecifier(const std::string& projectSpecifier)
+    {
+        std::string projectName;
+        std::string targetName;
+        if (!GetProjectAndTargetFromProjectSpecifier(projectSpecifier, projectName, targetName))
+            return false;
+
+        return BuildProject(projectName, targetName);
+    }
+
+    /**
+     * \brief Checks whether this instance is responsible for building a project when sharing projects with other instances.
+     * \param projectSpecifier The project specifier as specified on the command line.
+     * \return \c CLAIMED if the project should be built by this instance, \c CLAIMED_BY_OTHER if another instance builds it
+     * or \c FAILED if it could not be claimed.
+     */
+    _NODISCARD WorkClaims::ClaimResult ClaimProject(const std::string& projectSpecifier) const
+    {
+        if (!m_work_claims)
+            return WorkClaims::ClaimResult::CLAIMED;
+
+        std::error_code ec;
+        const auto result = m_work_claims->Claim(projectSpecifier, ec);
+        if (result == WorkClaims::ClaimResult::CLAIMED_BY_OTHER && m_args.m_verbose)
+            std::cout << std::format("Project \"{}\" was claimed by another instance\n", projectSpecifier);
+        else if (result == WorkClaims::ClaimResult::FAILED)
+            std::cerr << std::format("Failed to claim project \"{}\": {}\n", projectSpecifier, ec.message());
+
+        return result;
+    }
+
+    bool BuildProjects()
+    {
+        const auto& projectSpecifiers = m_args.m_project_specifiers_to_build;
+        if (m_args.m_job_count <= 1u || projectSpecifiers.size() <= 1u)
+        {
+            return std::ranges::all_of(projectSpecifiers,
+                                       [this](const std::string& projectSpecifier)
+                                       {
+                                           const auto claimResult = ClaimProject(projectSpecifier);
+                                           if (claimResult == WorkClaims::ClaimResult::CLAIMED_BY_OTHER)
+                                               return true;
+
+                                           return claimResult == WorkClaims::ClaimResult::CLAIMED && BuildProjectSpecifier(projectSpecifier);
+                                       });
+        }
+
+        // Projects are started in order and no new projects are started after one failed, same as when building them one after another.
+        // Targets referenced by a project are built by the job of the project after the project itself.
+        std::atomic_bool failed = false;
+        {
+            ThreadPool jobs(std::min<size_t>(m_args.m_job_count, projectSpecifiers.size()));
+            for (const auto& projectSpecifier : projectSpecifiers)
+            {
+                jobs.Enqueue(
+                    [this, &projectSpecifier, &failed]
+                    {
+                        // Projects are claimed when a job starts working on them so idle instances take over the projects that are left
+                        if (failed)
+                            return;
+
+                        const auto claimResult = ClaimProject(projectSpecifier);
+                        if (claimResult == WorkClaims::ClaimResult::FAILED)
+                            failed = true;
+                        if (claimResult != WorkClaims::ClaimResult::CLAIMED)
+                            return;
+
+                        try
+                        {
+                            if (!BuildProjectSpecifier(projectSpecifier))
+                                failed = true;
+                        }
+                        catch (std::exception& e)
+                        {
+                            std::cerr << std::format("Failed to build project \"{}\": {}\n", projectSpecifier, e.what());
+                            failed = true;
+                        }
+                    });
+            }
+
+            jobs.WaitForIdle();
+        }
+
+        return !failed;
+    }
+
     bool LoadZones()
     {
         for (const auto& zonePath : m_args.m_zones_to_load)
@@ -548,12 +1044,19 @@ class LinkerImpl final : public Linker
                 zoneDirectory = fs::current_path();
             auto absoluteZoneDirectory = absolute(zoneDirectory).string();
 
+            benchmarking::ScopedPhase benchmarkPhase(m_benchmark_report.get(), "zone load");
+            std::error_code ec;
+            const auto zoneFileSize = fs::file_size(zonePath, ec);
+            if (!ec)
+                benchmarkPhase.AddBytesRead(zoneFileSize);
+
             auto zone = std::unique_ptr<Zone>(ZoneLoading::LoadZone(zonePath));
             if (zone == nullptr)
             {
                 std::cerr << std::format("Failed to load zone \"{}\".\n", zonePath);
                 return false;
             }
+            benchmarkPhase.AddAssets(zone->m_pools->GetTotalAssetCount());
 
             if (m_args.m_verbose)
             {
@@ -561,11 +1064,46 @@ class LinkerImpl final : public Linker
             }
 
             m_loaded_zones.emplace_back(std::move(zone));
+            m_loaded_zone_write_times.emplace_back(fs::last_write_time(zonePath, ec));
         }
 
         return true;
     }
 
+    /**
+     * \brief Loads the zones specified to be loaded if they were not loaded yet.
+     * Loading big zones takes a lot longer than checking whether a target is up to date, so builds without any outdated fastfile never load them.
+     * Must be called while holding the shared state lock.
+     * \return \c true if all zones are loaded, otherwise \c false.
+     */
+    bool EnsureZonesLoaded()
+    {
+        if (!m_zones_load_attempted)
+        {
+            m_zones_load_attempted = true;
+            m_zones_loaded = LoadZones();
+            PrintPeakMemoryUsage("loading zones");
+        }
+
+        return m_zones_loaded;
+    }
+
+    _NODISCARD bool LoadedZonesChanged() const
+    {
+        for (auto i = 0u; i < m_args.m_zones_to_load.size(); i++)
+        {
+            if (i >= m_loaded_zone_write_times.size())
+                return true;
+
+            std::error_code ec;
+            const auto writeTime = fs::last_write_time(m_args.m_zones_to_load[i], ec);
+            if (ec || writeTime != m_loaded_zone_write_times[i])
+                return true;
+        }
+
+        return false;
+    }
+
     void UnloadZones()
     {
         for (auto i = m_loaded_zones.rbegin(); i != m_loaded_zones.rend(); ++i)
@@ -579,6 +1117,96 @@ class LinkerImpl final : public Linker
                 std::cout << std::format("Unloaded zone \"{}\"\n", zoneName);
         }
         m_loaded_zones.clear();
+        m_loaded_zone_write_times.clear();
+        m_zones_load_attempted = false;
+        m_zones_loaded = false;
+    }
+
+    void SaveCaches() const
+    {
+        if (!m_args.m_shader_cache_file.empty() && !ShaderInfoCache::Instance.Save(m_args.m_shader_cache_file))
+            std::cerr << std::format("Failed to save shader cache \"{}\"\n", m_args.m_shader_cache_file);
+        if (!m_args.m_gdt_cache_file.empty() && !GdtCache::Instance.Save(m_args.m_gdt_cache_file))
+            std::cerr << std::format("Failed to save gdt cache \"{}\"\n", m_args.m_gdt_cache_file);
+        if (!m_args.m_rawfile_cache_file.empty() && !RawFileCompressionCache::Instance.Save(m_args.m_rawfile_cache_file))
+            std::cerr << std::format("Failed to save rawfile cache \"{}\"\n", m_args.m_rawfile_cache_file);
+    }
+
+    /**
+     * \brief Builds the projects of a single request of the server mode.
+     * Zones whose files changed since they were loaded are loaded again and files that were added to search paths are found.
+     * Parsed files are kept in their session caches, which detect changed files by their content.
+     * \param projectSpecifiers The projects to build.
+     * \return \c true if all projects could be built.
+     */
+    bool HandleBuildRequest(std::vector<std::string> projectSpecifiers)
+    {
+        // Changed zones are loaded again once a request needs them
+        if (LoadedZonesChanged())
+            UnloadZones();
+
+        m_search_paths.InvalidateProjectIndependentFileIndices();
+        m_args.m_project_specifiers_to_build = std::move(projectSpecifiers);
+
+        const auto result = BuildProjects();
+        SaveCaches();
+
+        return result;
+    }
+
+    void RunServer()
+    {
+        std::cout << "Waiting for build requests\n" << std::flush;
+
+        std::string request;
+        while (std::getline(std::cin, request))
+        {
+            std::istringstream requestStream(request);
+            std::vector<std::string> projectSpecifiers;
+            std::string projectSpecifier;
+            while (requestStream >> projectSpecifier)
+                projectSpecifiers.emplace_back(std::move(projectSpecifier));
+
+            if (projectSpecifiers.empty())
+                continue;
+            if (projectSpecifiers.size() == 1u && projectSpecifiers[0] == "exit")
+                break;
+
+            const auto result = HandleBuildRequest(std::move(projectSpecifiers));
+            std::cout << (result ? "Build succeeded\n" : "Build failed\n") << std::flush;
+        }
+    }
+
+    /**
+     * \brief Builds the specified projects again whenever a file in their search paths or a loaded zone changes.
+     * Search paths of projects are watched once the project was built the first time, including all targets it references.
+     */
+    void RunWatch()
+    {
+        WatchSearchPaths(m_args.GetProjectIndependentAssetSearchPaths());
+        WatchSearchPaths(m_args.GetProjectIndependentGdtSearchPaths());
+        WatchSearchPaths(m_args.GetProjectIndependentSourceSearchPaths());
+        for (const auto& zonePath : m_args.m_zones_to_load)
+            m_file_watcher.Watch(zonePath);
+
+        std::cout << std::format("Watching {} paths for changes\n", m_file_watcher.GetWatchedPathCount()) << std::flush;
+
+        while (true)
+        {
+            std::this_thread::sleep_for(WATCH_POLL_INTERVAL);
+            if (!m_file_watcher.Poll())
+                continue;
+
+            do
+                std::this_thread::sleep_for(WATCH_POLL_INTERVAL);
+            while (m_file_watcher.Poll());
+
+            std::cout << "Files changed, building again\n" << std::flush;
+            const auto startTime = std::chrono::steady_clock::now();
+            const auto result = HandleBuildRequest(m_args.m_project_specifiers_to_build);
+            const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+            std::cout << std::format("{} after {}ms\n", result ? "Build succeeded" : "Build failed", duration.count()) << std::flush;
+        }
     }
 
     static bool GetProjectAndTargetFromProjectSpecifier(const std::string& projectSpecifier, std::string& projectName, std::string& targetName)
@@ -615,6 +1243,29 @@ class LinkerImpl final : public Linker
         return true;
     }
 
+    bool CreateProgressReporter()
+    {
+        if (m_args.m_progress_format.empty())
+            return true;
+
+        std::ostream* stream = &std::cerr;
+        if (!m_args.m_progress_file.empty())
+        {
+            m_progress_stream.open(m_args.m_progress_file, std::fstream::out | std::fstream::binary);
+            if (!m_progress_stream.is_open())
+            {
+                std::cerr << std::format("Could not open progress file \"{}\"\n", m_args.m_progress_file);
+                return false;
+            }
+            stream = &m_progress_stream;
+        }
+
+        m_progress_reporter = progress::CreateProgressReporter(m_args.m_progress_format, *stream);
+        ZoneLoading::Configuration.ProgressReporter = m_progress_reporter.get();
+
+        return true;
+    }
+
 public:
     LinkerImpl()
         : m_search_paths(m_args)
@@ -630,31 +1281,92 @@ public:
         if (!shouldContinue)
             return true;
 
-        if (!m_search_paths.BuildProjectIndependentSearchPaths())
+        if (!m_args.m_trace_file.empty())
+            tracing::Tracer::Instance.Enable();
+
+        if (!CreateProgressReporter())
             return false;
 
-        if (!LoadZones())
+        if (!m_search_paths.BuildProjectIndependentSearchPaths())
             return false;
 
-        auto result = true;
-        for (const auto& projectSpecifier : m_args.m_project_specifiers_to_build)
+        if (!m_args.m_work_claims_folder.empty())
         {
-            std::string projectName;
-            std::string targetName;
-            if (!GetProjectAndTargetFromProjectSpecifier(projectSpecifier, projectName, targetName))
+            m_work_claims = std::make_unique<WorkClaims>(m_args.m_work_claims_folder);
+            if (!m_work_claims->IsUsable())
             {
-                result = false;
-                break;
+                std::cerr << std::format("Could not create work claim folder \"{}\"\n", m_args.m_work_claims_folder);
+                return false;
             }
+        }
+
+        // A missing or outdated shader cache is not an error, all shaders are simply analysed again
+        if (!m_args.m_shader_cache_file.empty())
+            ShaderInfoCache::Instance.Load(m_args.m_shader_cache_file);
+
+        // Same for the gdt cache, gdts that are not cached are parsed again
+        if (!m_args.m_gdt_cache_file.empty())
+            GdtCache::Instance.Load(m_args.m_gdt_cache_file);
+
+        // Compressed raw files are only kept when they are saved or can be reused by later builds of the same process
+        if (!m_args.m_rawfile_cache_file.empty() || m_args.m_server_mode || m_args.m_watch_mode)
+            RawFileCompressionCache::Instance.Enable();
+
+        // Same for the rawfile cache, raw files that are not cached are compressed again
+        if (!m_args.m_rawfile_cache_file.empty())
+            RawFileCompressionCache::Instance.Load(m_args.m_rawfile_cache_file);
+
+        if (m_args.m_benchmark_run_count > 0)
+            m_benchmark_report = std::make_unique<benchmarking::BenchmarkReport>("Linker");
 
-            if (!BuildProject(projectName, targetName))
+        auto result = true;
+        const auto runCount = std::max(m_args.m_benchmark_run_count, 1u);
+        for (auto run = 0u; run < runCount && result; run++)
+        {
+            if (m_benchmark_report)
+                m_benchmark_report->BeginRun(run);
+
+            // Every run starts without loaded assets to keep benchmark runs comparable
+            if (m_args.m_share_loaded_assets)
             {
-                result = false;
-                break;
+                m_loaded_assets = std::make_unique<LoadedAssetCache>();
+                ObjLoading::Configuration.LoadedAssets = m_loaded_assets.get();
             }
+
+            result = BuildProjects();
+
+            // The server and watch mode keep the zones of the last run loaded for later builds
+            if ((!m_args.m_server_mode && !m_args.m_watch_mode) || run + 1u < runCount)
+                UnloadZones();
         }
 
-        UnloadZones();
+        SaveCaches();
+
+        if (m_benchmark_report)
+        {
+            std::cout << std::format("Benchmark of {} runs:\n", runCount);
+            m_benchmark_report->PrintSummary(std::cout);
+            if (!m_args.m_benchmark_json_file.empty() && !m_benchmark_report->WriteJson(m_args.m_benchmark_json_file))
+                std::cerr << std::format("Failed to write benchmark results \"{}\"\n", m_args.m_benchmark_json_file);
+        }
+
+        // Failed requests are reported to the client and do not stop the server
+        if (m_args.m_server_mode)
+        {
+            RunServer();
+            UnloadZones();
+        }
+
+        // Watching only stops when the process is terminated, failed builds are fixed by changing files again
+        if (m_args.m_watch_mode)
+            RunWatch();
+
+        if (!m_args.m_trace_file.empty())
+        {
+            tracing::Tracer::Instance.PrintSummary(std::cout);
+            if (!tracing::Tracer::Instance.WriteChromeTrace(m_args.m_trace_file))
+                std::cerr << std::format("Failed to write trace \"{}\"\n", m_args.m_trace_file);
+        }
 
         return result;
     }
@@ -5,14 +5,34 @@
 #include "ObjWriting.h"
 #include "Utils/Arguments/UsageInformation.h"
 #include "Utils/FileUtils.h"
+#include "Utils/JobSystem.h"
+#include "Utils/StringUtils.h"
+#include "ZoneWriting.h"
 
 #include <filesystem>
 #include <iostream>
-#include <regex>
 #include <type_traits>
 
 namespace fs = std::filesystem;
 
+namespace
+{
+    // Placeholder indices of compiled search paths
+    constexpr size_t SEARCH_PATH_PROJECT = 0u;
+    constexpr size_t SEARCH_PATH_GAME = 1u;
+    constexpr size_t SEARCH_PATH_BASE = 2u;
+
+    std::vector<PathTemplate> CompileSearchPaths(const std::set<std::string>& searchPaths)
+    {
+        std::vector<PathTemplate> templates;
+        templates.reserve(searchPaths.size());
+        for (const auto& path : searchPaths)
+            templates.emplace_back(path, std::initializer_list<std::string_view>{LinkerArgs::PATTERN_PROJECT, LinkerArgs::PATTERN_GAME, LinkerArgs::PATTERN_BASE});
+
+        return templates;
+    }
+} // namespace
+
 // clang-format off
 const CommandLineOption* const OPTION_HELP =
     CommandLineOption::Builder::Create()
@@ -85,6 +105,14 @@ const CommandLineOption* const OPTION_MENU_PERMISSIVE =
     .WithDescription("Allows the usage of unknown script commands that can be compiled.")
     .Build();
 
+const CommandLineOption* const OPTION_MENU_PARSE_WORKERS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("menu-parse-workers")
+    .WithDescription("Specifies the amount of threads that parse the menu files of a menu list ahead of time. 0 parses all menu files one after another. "
+                        "Defaults to 4.")
+    .WithParameter("workerCount")
+    .Build();
+
 const CommandLineOption* const OPTION_MENU_NO_OPTIMIZATION =
     CommandLineOption::Builder::Create()
     .WithLongName("menu-no-optimization")
@@ -92,6 +120,167 @@ const CommandLineOption* const OPTION_MENU_NO_OPTIMIZATION =
                         "information when dumped though.)")
     .Build();
 
+const CommandLineOption* const OPTION_OPTIMIZE_MODEL_MESHES =
+    CommandLineOption::Builder::Create()
+    .WithLongName("optimize-model-meshes")
+    .WithDescription("Reorders the tris and vertices of model surfaces to make better use of the vertex cache and to reduce overdraw. (Increases the time it "
+                        "takes to load models.)")
+    .Build();
+
+const CommandLineOption* const OPTION_BUILD_MODEL_COLLISION_TREES =
+    CommandLineOption::Builder::Create()
+    .WithLongName("build-model-collision-trees")
+    .WithDescription("Builds collision trees over the tris of rigid model surfaces that speed up traces against them.")
+    .Build();
+
+const CommandLineOption* const OPTION_JOBS =
+    CommandLineOption::Builder::Create()
+    .WithShortName("j")
+    .WithLongName("jobs")
+    .WithDescription("Specifies the amount of projects that are built at the same time. Defaults to 1.")
+    .WithParameter("jobCount")
+    .Build();
+
+const CommandLineOption* const OPTION_THREADS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("threads")
+    .WithDescription("Specifies the amount of threads of the job system that all parallel features of a run share. Defaults to one per hardware thread.")
+    .WithParameter("threadCount")
+    .Build();
+
+const CommandLineOption* const OPTION_WORK_CLAIMS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("work-claims")
+    .WithDescription("Shares the specified projects with other Linker instances that use the same claim folder, for example on a network share. "
+                        "Each project is only built by the instance that claims it first. All instances must be started with the same project specifiers "
+                        "and the folder must not contain claims of earlier runs.")
+    .WithParameter("claimFolder")
+    .Build();
+
+const CommandLineOption* const OPTION_NO_BUILD_CACHE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("no-build-cache")
+    .WithDescription("Always builds all targets instead of skipping targets whose output is up to date with all files that were read to build it.")
+    .Build();
+
+const CommandLineOption* const OPTION_NO_ASSET_SHARING =
+    CommandLineOption::Builder::Create()
+    .WithLongName("no-asset-sharing")
+    .WithDescription("Loads raw assets again for every zone instead of sharing unchanged raw assets that were already loaded for another zone of the session.")
+    .Build();
+
+const CommandLineOption* const OPTION_SHADER_CACHE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("shader-cache")
+    .WithDescription("Specifies a file to keep the analysed info of shaders in to not analyse the same shaders again in later runs.")
+    .WithParameter("cacheFile")
+    .Build();
+
+const CommandLineOption* const OPTION_GDT_CACHE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("gdt-cache")
+    .WithDescription("Specifies a file to keep read gdt files in to not parse unchanged gdt files again in later runs.")
+    .WithParameter("cacheFile")
+    .Build();
+
+const CommandLineOption* const OPTION_RAWFILE_CACHE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("rawfile-cache")
+    .WithDescription("Specifies a file to keep compressed raw files in to not compress unchanged raw files again in later runs.")
+    .WithParameter("cacheFile")
+    .Build();
+
+const CommandLineOption* const OPTION_DRY_RUN =
+    CommandLineOption::Builder::Create()
+    .WithLongName("dry-run")
+    .WithDescription("Links fastfiles without writing them and prints the sizes of their blocks and asset types instead. IPaks are not built.")
+    .Build();
+
+const CommandLineOption* const OPTION_DEFLATE_WORKERS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("deflate-workers")
+    .WithDescription("Specifies the amount of threads that compress fastfiles using deflate. Slightly increases the size of compressed fastfiles. "
+                        "Defaults to compressing on a single thread.")
+    .WithParameter("workerCount")
+    .Build();
+
+const CommandLineOption* const OPTION_COMPRESSION_LEVEL =
+    CommandLineOption::Builder::Create()
+    .WithLongName("compression-level")
+    .WithDescription("Specifies the zlib compression level from 0 (no compression) to 9 (best compression) for fastfiles whose zone definition does not "
+                        "specify one. Defaults to the level the game uses.")
+    .WithParameter("level")
+    .Build();
+
+const CommandLineOption* const OPTION_COMPRESSION_STRATEGY =
+    CommandLineOption::Builder::Create()
+    .WithLongName("compression-strategy")
+    .WithDescription("Specifies the zlib compression strategy for fastfiles whose zone definition does not specify one. Valid strategies are: default, "
+                        "filtered, huffman-only, rle, fixed. Defaults to the default strategy of zlib.")
+    .WithParameter("strategy")
+    .Build();
+
+const CommandLineOption* const OPTION_ASSET_ORDER =
+    CommandLineOption::Builder::Create()
+    .WithLongName("asset-order")
+    .WithDescription("Specifies the order assets are written to fastfiles in. Valid orders are: definition, type, dependency. "
+                        "Dependencies are always written before the assets using them. Defaults to the order of the zone definition.")
+    .WithParameter("order")
+    .Build();
+
+const CommandLineOption* const OPTION_TRACE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("trace")
+    .WithDescription("Records how long loading, linking and writing takes and writes it to the specified file in the Chrome trace format. "
+                        "Also prints a summary of the recorded times.")
+    .WithParameter("traceFile")
+    .Build();
+
+const CommandLineOption* const OPTION_BENCHMARK =
+    CommandLineOption::Builder::Create()
+    .WithLongName("benchmark")
+    .WithDescription("Loads zones and builds all specified projects the specified amount of times without using the build cache. "
+                        "Prints the wall time, cpu time and throughput of each phase.")
+    .WithParameter("runCount")
+    .Build();
+
+const CommandLineOption* const OPTION_BENCHMARK_JSON =
+    CommandLineOption::Builder::Create()
+    .WithLongName("benchmark-json")
+    .WithDescription("Writes the measurements of --benchmark to the specified file as json.")
+    .WithParameter("jsonFile")
+    .Build();
+
+const CommandLineOption* const OPTION_PROGRESS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("progress")
+    .WithDescription("Reports the progress of loading and writing zones in the specified format. Valid formats are: text, json. "
+                        "The json format writes one object per line for other programs to read.")
+    .WithParameter("format")
+    .Build();
+
+const CommandLineOption* const OPTION_PROGRESS_FILE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("progress-file")
+    .WithDescription("Writes the progress of --progress to the specified file instead of stderr.")
+    .WithParameter("progressFile")
+    .Build();
+
+const CommandLineOption* const OPTION_SERVER =
+    CommandLineOption::Builder::Create()
+    .WithLongName("server")
+    .WithDescription("Keeps running after building the specified projects and reads further build requests from stdin, "
+                        "one line of project specifiers per request. Loaded zones and parsed files are kept between requests. "
+                        "Prints \"Build succeeded\" or \"Build failed\" after each request. Send \"exit\" to stop.")
+    .Build();
+
+const CommandLineOption* const OPTION_WATCH =
+    CommandLineOption::Builder::Create()
+    .WithLongName("watch")
+    .WithDescription("Keeps running after building the specified projects and builds them again whenever files in their search paths or loaded zones change. "
+                        "Only targets whose read files changed are built again. Loaded zones and parsed files are kept between builds.")
+    .Build();
+
 // clang-format on
 
 const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
@@ -105,17 +294,46 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_SOURCE_SEARCH_PATH,
     OPTION_LOAD,
     OPTION_MENU_PERMISSIVE,
+    OPTION_MENU_PARSE_WORKERS,
     OPTION_MENU_NO_OPTIMIZATION,
+    OPTION_OPTIMIZE_MODEL_MESHES,
+    OPTION_BUILD_MODEL_COLLISION_TREES,
+    OPTION_JOBS,
+    OPTION_THREADS,
+    OPTION_WORK_CLAIMS,
+    OPTION_NO_BUILD_CACHE,
+    OPTION_NO_ASSET_SHARING,
+    OPTION_SHADER_CACHE,
+    OPTION_GDT_CACHE,
+    OPTION_RAWFILE_CACHE,
+    OPTION_DRY_RUN,
+    OPTION_DEFLATE_WORKERS,
+    OPTION_COMPRESSION_LEVEL,
+    OPTION_COMPRESSION_STRATEGY,
+    OPTION_ASSET_ORDER,
+    OPTION_TRACE,
+    OPTION_BENCHMARK,
+    OPTION_BENCHMARK_JSON,
+    OPTION_PROGRESS,
+    OPTION_PROGRESS_FILE,
+    OPTION_SERVER,
+    OPTION_WATCH,
 };
 
 LinkerArgs::LinkerArgs()
     : m_argument_parser(COMMAND_LINE_OPTIONS, std::extent_v<decltype(COMMAND_LINE_OPTIONS)>),
-      m_base_pattern(R"(\?base\?)"),
-      m_game_pattern(R"(\?game\?)"),
-      m_project_pattern(R"(\?project\?)"),
       m_base_folder_depends_on_project(false),
       m_out_folder_depends_on_project(false),
-      m_verbose(false)
+      m_verbose(false),
+      m_job_count(1u),
+      m_use_build_cache(true),
+      m_share_loaded_assets(true),
+      m_benchmark_run_count(0u),
+      m_dry_run(false),
+      m_server_mode(false),
+      m_watch_mode(false),
+      m_compression_level(ZoneWritingOptions::DEFAULT_COMPRESSION_LEVEL),
+      m_compression_strategy(CompressionStrategy::DEFAULT)
 {
 }
 
@@ -146,9 +364,152 @@ void LinkerArgs::SetVerbose(const bool isVerbose)
     ObjWriting::Configuration.Verbose = isVerbose;
 }
 
+bool LinkerArgs::ParseJobCount()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_JOBS);
+
+    char* endPtr;
+    const auto parsedValue = strtoul(specifiedValue.c_str(), &endPtr, 10);
+    if (specifiedValue.empty() || *endPtr != '\0' || parsedValue == 0u)
+    {
+        std::cerr << "Illegal value: \"" << specifiedValue << "\" is not a valid job count. Use -? to see usage information.\n";
+        return false;
+    }
+
+    m_job_count = static_cast<unsigned>(parsedValue);
+    return true;
+}
+
+bool LinkerArgs::ParseProgressFormat()
+{
+    auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_PROGRESS);
+    utils::MakeStringLowerCase(specifiedValue);
+
+    if (specifiedValue == "text" || specifiedValue == "json")
+    {
+        m_progress_format = std::move(specifiedValue);
+        return true;
+    }
+
+    std::cerr << "Illegal value: \"" << specifiedValue << "\" is not a valid progress format. Use -? to see usage information.\n";
+    return false;
+}
+
+bool LinkerArgs::ParseBenchmarkRunCount()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_BENCHMARK);
+
+    char* endPtr;
+    const auto parsedValue = strtoul(specifiedValue.c_str(), &endPtr, 10);
+    if (specifiedValue.empty() || *endPtr != '\0' || parsedValue == 0u)
+    {
+        std::cerr << "Illegal value: \"" << specifiedValue << "\" is not a valid run count. Use -? to see usage information.\n";
+        return false;
+    }
+
+    m_benchmark_run_count = static_cast<unsigned>(parsedValue);
+    return true;
+}
+
+bool LinkerArgs::ParseThreadCount()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_THREADS);
+
+    char* endPtr;
+    const auto parsedValue = strtoul(specifiedValue.c_str(), &endPtr, 10);
+    if (specifiedValue.empty() || *endPtr != '\0' || parsedValue == 0u)
+    {
+        std::cerr << "Illegal value: \"" << specifiedValue << "\" is not a valid thread count. Use -? to see usage information.\n";
+        return false;
+    }
+
+    JobSystem::SetThreadCount(parsedValue);
+    return true;
+}
+
+bool LinkerArgs::ParseDeflateWorkerCount()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_DEFLATE_WORKERS);
+
+    char* endPtr;
+    const auto parsedValue = strtoul(specifiedValue.c_str(), &endPtr, 10);
+    if (specifiedValue.empty() || *endPtr != '\0' || parsedValue == 0u)
+    {
+        std::cerr << "Illegal value: \"" << specifiedValue << "\" is not a valid worker count. Use -? to see usage information.\n";
+        return false;
+    }
+
+    ZoneWriting::Configuration.DeflateWorkerCount = static_cast<unsigned>(parsedValue);
+    return true;
+}
+
+bool LinkerArgs::ParseMenuParseWorkerCount()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_MENU_PARSE_WORKERS);
+
+    char* endPtr;
+    const auto parsedValue = strtoul(specifiedValue.c_str(), &endPtr, 10);
+    if (specifiedValue.empty() || *endPtr != '\0')
+    {
+        std::cerr << "Illegal value: \"" << specifiedValue << "\" is not a valid worker count. Use -? to see usage information.\n";
+        return false;
+    }
+
+    ObjLoading::Configuration.MenuParseWorkerCount = static_cast<unsigned>(parsedValue);
+    return true;
+}
+
+bool LinkerArgs::ParseCompressionLevel()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_COMPRESSION_LEVEL);
+
+    char* endPtr;
+    const auto parsedValue = strtoul(specifiedValue.c_str(), &endPtr, 10);
+    if (specifiedValue.empty() || *endPtr != '\0' || parsedValue > MAX_COMPRESSION_LEVEL)
+    {
+        std::cerr << "Illegal value: \"" << specifiedValue << "\" is not a valid compression level. Use -? to see usage information.\n";
+        return false;
+    }
+
+    m_compression_level = static_cast<int>(parsedValue);
+    return true;
+}
+
+bool LinkerArgs::ParseCompressionStrategy()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_COMPRESSION_STRATEGY);
+    if (!ZoneWritingOptions::ParseCompressionStrategy(specifiedValue, m_compression_strategy))
+    {
+        std::cerr << "Illegal value: \"" << specifiedValue << "\" is not a valid compression strategy. Use -? to see usage information.\n";
+        return false;
+    }
+
+    return true;
+}
+
+bool LinkerArgs::ParseAssetOrder()
+{
+    auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_ASSET_ORDER);
+    utils::MakeStringLowerCase(specifiedValue);
+
+    if (specifiedValue == "definition")
+        ZoneWriting::Configuration.AssetOrder = AssetWriteOrderMode::DEFINITION;
+    else if (specifiedValue == "type")
+        ZoneWriting::Configuration.AssetOrder = AssetWriteOrderMode::TYPE;
+    else if (specifiedValue == "dependency")
+        ZoneWriting::Configuration.AssetOrder = AssetWriteOrderMode::DEPENDENCY;
+    else
+    {
+        std::cerr << "Illegal value: \"" << specifiedValue << "\" is not a valid asset order. Use -? to see usage information.\n";
+        return false;
+    }
+
+    return true;
+}
+
 std::string LinkerArgs::GetBasePathForProject(const std::string& projectName) const
 {
-    return std::regex_replace(m_base_folder, m_project_pattern, projectName);
+    return m_base_folder_template.Resolve({projectName});
 }
 
 void LinkerArgs::SetDefaultBasePath()
@@ -165,48 +526,45 @@ void LinkerArgs::SetDefaultBasePath()
     }
 }
 
-std::set<std::string> LinkerArgs::GetProjectIndependentSearchPaths(const std::set<std::string>& set) const
+void LinkerArgs::CompilePathTemplates()
+{
+    m_base_folder_template = PathTemplate(m_base_folder, {PATTERN_PROJECT});
+    m_out_folder_template = PathTemplate(m_out_folder, {PATTERN_PROJECT, PATTERN_BASE});
+    m_asset_search_path_templates = CompileSearchPaths(m_asset_search_paths);
+    m_gdt_search_path_templates = CompileSearchPaths(m_gdt_search_paths);
+    m_source_search_path_templates = CompileSearchPaths(m_source_search_paths);
+}
+
+std::set<std::string> LinkerArgs::GetProjectIndependentSearchPaths(const std::vector<PathTemplate>& searchPaths) const
 {
     std::set<std::string> out;
 
-    for (const auto& path : set)
+    for (const auto& path : searchPaths)
     {
-        if (path.find(PATTERN_GAME) != std::string::npos)
+        if (path.Uses(SEARCH_PATH_GAME) || path.Uses(SEARCH_PATH_PROJECT))
             continue;
-        if (path.find(PATTERN_PROJECT) != std::string::npos)
+
+        if (m_base_folder_depends_on_project && path.Uses(SEARCH_PATH_BASE))
             continue;
 
-        if (path.find(PATTERN_BASE) != std::string::npos)
-        {
-            if (m_base_folder_depends_on_project)
-                continue;
-
-            out.emplace(std::regex_replace(path, m_base_pattern, m_base_folder));
-        }
-        else
-        {
-            out.emplace(path);
-        }
+        out.emplace(path.Resolve({"", "", m_base_folder}));
     }
 
     return out;
 }
 
-std::set<std::string> LinkerArgs::GetSearchPathsForProject(const std::set<std::string>& set, const std::string& gameName, const std::string& projectName) const
+std::set<std::string>
+    LinkerArgs::GetSearchPathsForProject(const std::vector<PathTemplate>& searchPaths, const std::string& gameName, const std::string& projectName) const
 {
     std::set<std::string> out;
     const auto basePath = GetBasePathForProject(projectName);
 
-    for (const auto& path : set)
+    for (const auto& path : searchPaths)
     {
-        if (path.find(PATTERN_GAME) == std::string::npos && path.find(PATTERN_PROJECT) == std::string::npos
-            && (!m_base_folder_depends_on_project || path.find(PATTERN_BASE) == std::string::npos))
-        {
+        if (!path.Uses(SEARCH_PATH_GAME) && !path.Uses(SEARCH_PATH_PROJECT) && (!m_base_folder_depends_on_project || !path.Uses(SEARCH_PATH_BASE)))
             continue;
-        }
 
-        out.emplace(std::regex_replace(
-            std::regex_replace(std::regex_replace(path, m_project_pattern, projectName), m_game_pattern, gameName), m_base_pattern, basePath));
+        out.emplace(path.Resolve({projectName, gameName, basePath}));
     }
 
     return out;
@@ -237,8 +595,12 @@ bool LinkerArgs::ParseArgs(const int argc, const char** argv, bool& shouldContin
         return true;
     }
 
+    // --server
+    // Projects can also be requested once the server is running
+    m_server_mode = m_argument_parser.IsOptionSpecified(OPTION_SERVER);
+
     m_project_specifiers_to_build = m_argument_parser.GetArguments();
-    if (m_project_specifiers_to_build.empty())
+    if (m_project_specifiers_to_build.empty() && !m_server_mode)
     {
         // No projects to build specified...
         PrintUsage();
@@ -298,6 +660,8 @@ bool LinkerArgs::ParseArgs(const int argc, const char** argv, bool& shouldContin
             return false;
     }
 
+    CompilePathTemplates();
+
     // -l; --load
     if (m_argument_parser.IsOptionSpecified(OPTION_LOAD))
         m_zones_to_load = m_argument_parser.GetParametersForOption(OPTION_LOAD);
@@ -306,44 +670,153 @@ bool LinkerArgs::ParseArgs(const int argc, const char** argv, bool& shouldContin
     if (m_argument_parser.IsOptionSpecified(OPTION_MENU_PERMISSIVE))
         ObjLoading::Configuration.MenuPermissiveParsing = true;
 
+    // --menu-parse-workers
+    if (m_argument_parser.IsOptionSpecified(OPTION_MENU_PARSE_WORKERS) && !ParseMenuParseWorkerCount())
+        return false;
+
     // --menu-no-optimization
     if (m_argument_parser.IsOptionSpecified(OPTION_MENU_NO_OPTIMIZATION))
         ObjLoading::Configuration.MenuNoOptimization = true;
 
+    // --optimize-model-meshes
+    if (m_argument_parser.IsOptionSpecified(OPTION_OPTIMIZE_MODEL_MESHES))
+        ObjLoading::Configuration.OptimizeModelMeshes = true;
+
+    // --build-model-collision-trees
+    if (m_argument_parser.IsOptionSpecified(OPTION_BUILD_MODEL_COLLISION_TREES))
+        ObjLoading::Configuration.BuildModelCollisionTrees = true;
+
+    // -j; --jobs
+    if (m_argument_parser.IsOptionSpecified(OPTION_JOBS) && !ParseJobCount())
+        return false;
+
+    // --threads
+    if (m_argument_parser.IsOptionSpecified(OPTION_THREADS) && !ParseThreadCount())
+        return false;
+
+    // --work-claims
+    if (m_argument_parser.IsOptionSpecified(OPTION_WORK_CLAIMS))
+        m_work_claims_folder = m_argument_parser.GetValueForOption(OPTION_WORK_CLAIMS);
+
+    // --no-build-cache
+    m_use_build_cache = !m_argument_parser.IsOptionSpecified(OPTION_NO_BUILD_CACHE);
+
+    // --no-asset-sharing
+    m_share_loaded_assets = !m_argument_parser.IsOptionSpecified(OPTION_NO_ASSET_SHARING);
+
+    // --shader-cache
+    if (m_argument_parser.IsOptionSpecified(OPTION_SHADER_CACHE))
+        m_shader_cache_file = m_argument_parser.GetValueForOption(OPTION_SHADER_CACHE);
+
+    // --gdt-cache
+    if (m_argument_parser.IsOptionSpecified(OPTION_GDT_CACHE))
+        m_gdt_cache_file = m_argument_parser.GetValueForOption(OPTION_GDT_CACHE);
+
+    // --rawfile-cache
+    if (m_argument_parser.IsOptionSpecified(OPTION_RAWFILE_CACHE))
+        m_rawfile_cache_file = m_argument_parser.GetValueForOption(OPTION_RAWFILE_CACHE);
+
+    // --dry-run
+    // Targets are always built since there is no output to compare the build cache with
+    m_dry_run = m_argument_parser.IsOptionSpecified(OPTION_DRY_RUN);
+    if (m_dry_run)
+        m_use_build_cache = false;
+
+    // --deflate-workers
+    if (m_argument_parser.IsOptionSpecified(OPTION_DEFLATE_WORKERS) && !ParseDeflateWorkerCount())
+        return false;
+
+    // --compression-level
+    if (m_argument_parser.IsOptionSpecified(OPTION_COMPRESSION_LEVEL) && !ParseCompressionLevel())
+        return false;
+
+    // --compression-strategy
+    if (m_argument_parser.IsOptionSpecified(OPTION_COMPRESSION_STRATEGY) && !ParseCompressionStrategy())
+        return false;
+
+    // --asset-order
+    if (m_argument_parser.IsOptionSpecified(OPTION_ASSET_ORDER) && !ParseAssetOrder())
+        return false;
+
+    // --trace
+    if (m_argument_parser.IsOptionSpecified(OPTION_TRACE))
+        m_trace_file = m_argument_parser.GetValueForOption(OPTION_TRACE);
+
+    // --benchmark
+    if (m_argument_parser.IsOptionSpecified(OPTION_BENCHMARK) && !ParseBenchmarkRunCount())
+        return false;
+
+    // --benchmark-json
+    if (m_argument_parser.IsOptionSpecified(OPTION_BENCHMARK_JSON))
+    {
+        m_benchmark_json_file = m_argument_parser.GetValueForOption(OPTION_BENCHMARK_JSON);
+        if (m_benchmark_run_count == 0u)
+            m_benchmark_run_count = 1u;
+    }
+
+    // --progress
+    if (m_argument_parser.IsOptionSpecified(OPTION_PROGRESS) && !ParseProgressFormat())
+        return false;
+
+    // --progress-file
+    if (m_argument_parser.IsOptionSpecified(OPTION_PROGRESS_FILE))
+        m_progress_file = m_argument_parser.GetValueForOption(OPTION_PROGRESS_FILE);
+
+    // Every run needs to build all targets to be measured
+    if (m_benchmark_run_count > 0u)
+        m_use_build_cache = false;
+
+    // --watch
+    m_watch_mode = m_argument_parser.IsOptionSpecified(OPTION_WATCH);
+
+    // Claims are kept after a project was built so later runs and requests would not find any projects left to build
+    if (!m_work_claims_folder.empty() && (m_benchmark_run_count > 0u || m_server_mode || m_watch_mode))
+    {
+        std::cerr << "Work claims cannot be used when benchmarking or in server or watch mode. Use -? to see usage information.\n";
+        return false;
+    }
+
+    // Both modes keep running after the first build and there is only one thing to do next
+    if (m_watch_mode && (m_server_mode || m_benchmark_run_count > 0u))
+    {
+        std::cerr << "Watch mode cannot be used when benchmarking or in server mode. Use -? to see usage information.\n";
+        return false;
+    }
+
     return true;
 }
 
 std::string LinkerArgs::GetOutputFolderPathForProject(const std::string& projectName) const
 {
-    return std::regex_replace(std::regex_replace(m_out_folder, m_project_pattern, projectName), m_base_pattern, GetBasePathForProject(projectName));
+    return m_out_folder_template.Resolve({projectName, GetBasePathForProject(projectName)});
 }
 
 std::set<std::string> LinkerArgs::GetProjectIndependentAssetSearchPaths() const
 {
-    return GetProjectIndependentSearchPaths(m_asset_search_paths);
+    return GetProjectIndependentSearchPaths(m_asset_search_path_templates);
 }
 
 std::set<std::string> LinkerArgs::GetProjectIndependentGdtSearchPaths() const
 {
-    return GetProjectIndependentSearchPaths(m_gdt_search_paths);
+    return GetProjectIndependentSearchPaths(m_gdt_search_path_templates);
 }
 
 std::set<std::string> LinkerArgs::GetProjectIndependentSourceSearchPaths() const
 {
-    return GetProjectIndependentSearchPaths(m_source_search_paths);
+    return GetProjectIndependentSearchPaths(m_source_search_path_templates);
 }
 
 std::set<std::string> LinkerArgs::GetAssetSearchPathsForProject(const std::string& gameName, const std::string& projectName) const
 {
-    return GetSearchPathsForProject(m_asset_search_paths, gameName, projectName);
+    return GetSearchPathsForProject(m_asset_search_path_templates, gameName, projectName);
 }
 
 std::set<std::string> LinkerArgs::GetGdtSearchPathsForProject(const std::string& gameName, const std::string& projectName) const
 {
-    return GetSearchPathsForProject(m_gdt_search_paths, gameName, projectName);
+    return GetSearchPathsForProject(m_gdt_search_path_templates, gameName, projectName);
 }
 
 std::set<std::string> LinkerArgs::GetSourceSearchPathsForProject(const std::string& projectName) const
 {
-    return GetSearchPathsForProject(m_source_search_paths, "", projectName);
+    return GetSearchPathsForProject(m_source_search_path_templates, "", projectName);
 }
@@ -1,9 +1,10 @@
 #pragma once
 #include "Utils/Arguments/ArgumentParser.h"
 #include "Utils/ClassUtils.h"
+#include "Utils/PathTemplate.h"
+#include "Writing/ZoneWritingOptions.h"
 #include "Zone/Zone.h"
 
-#include <regex>
 #include <set>
 #include <vector>
 
@@ -21,11 +22,17 @@ public:
     static constexpr const char* DEFAULT_GDT_SEARCH_PATH = "?base?/source_data;?base?/zone_raw/?project?/source_data";
     static constexpr const char* DEFAULT_SOURCE_SEARCH_PATH = "?base?/zone_source;?base?/zone_raw/?project?/zone_source";
 
+    static constexpr unsigned long MAX_COMPRESSION_LEVEL = 9u;
+
 private:
     ArgumentParser m_argument_parser;
-    std::regex m_base_pattern;
-    std::regex m_game_pattern;
-    std::regex m_project_pattern;
+
+    // Compiled once after parsing since they are resolved for every project
+    PathTemplate m_base_folder_template;
+    PathTemplate m_out_folder_template;
+    std::vector<PathTemplate> m_asset_search_path_templates;
+    std::vector<PathTemplate> m_gdt_search_path_templates;
+    std::vector<PathTemplate> m_source_search_path_templates;
 
     /**
      * \brief Prints a command line usage help text for the Linker tool to stdout.
@@ -34,12 +41,22 @@ private:
     static void PrintVersion();
 
     void SetVerbose(bool isVerbose);
+    bool ParseJobCount();
+    bool ParseThreadCount();
+    bool ParseDeflateWorkerCount();
+    bool ParseMenuParseWorkerCount();
+    bool ParseCompressionLevel();
+    bool ParseCompressionStrategy();
+    bool ParseAssetOrder();
+    bool ParseBenchmarkRunCount();
+    bool ParseProgressFormat();
 
     _NODISCARD std::string GetBasePathForProject(const std::string& projectName) const;
     void SetDefaultBasePath();
-    _NODISCARD std::set<std::string> GetProjectIndependentSearchPaths(const std::set<std::string>& set) const;
+    void CompilePathTemplates();
+    _NODISCARD std::set<std::string> GetProjectIndependentSearchPaths(const std::vector<PathTemplate>& searchPaths) const;
     _NODISCARD std::set<std::string>
-        GetSearchPathsForProject(const std::set<std::string>& set, const std::string& gameName, const std::string& projectName) const;
+        GetSearchPathsForProject(const std::vector<PathTemplate>& searchPaths, const std::string& gameName, const std::string& projectName) const;
 
 public:
     std::vector<std::string> m_zones_to_load;
@@ -55,6 +72,27 @@ public:
     std::set<std::string> m_source_search_paths;
 
     bool m_verbose;
+    unsigned m_job_count;
+    std::string m_work_claims_folder;
+    bool m_use_build_cache;
+    bool m_share_loaded_assets;
+    std::string m_shader_cache_file;
+    std::string m_gdt_cache_file;
+    std::string m_rawfile_cache_file;
+    std::string m_trace_file;
+    unsigned m_benchmark_run_count;
+    std::string m_benchmark_json_file;
+    std::string m_progress_format;
+    std::string m_progress_file;
+    bool m_dry_run;
+    bool m_server_mode;
+    bool m_watch_mode;
+
+    // The compression level for zones that do not specify one in their zone definition
+    int m_compression_level;
+
+    // The compression strategy for zones that do not specify one in their zone definition
+    CompressionStrategy m_compression_strategy;
 
     LinkerArgs();
     bool ParseArgs(int argc, const char** argv, bool& shouldContinue);
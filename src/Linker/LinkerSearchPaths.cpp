@@ -5,12 +5,16 @@
 #include "SearchPath/SearchPathFilesystem.h"
 
 #include <filesystem>
+#include <initializer_list>
 #include <iostream>
 
 namespace fs = std::filesystem;
 
 LinkerSearchPaths::LinkerSearchPaths(const LinkerArgs& args)
-    : m_args(args)
+    : m_args(args),
+      m_asset_search_paths(true),
+      m_gdt_search_paths(true),
+      m_source_search_paths(true)
 {
 }
 
@@ -36,7 +40,7 @@ void LinkerSearchPaths::UnloadSearchPath(ISearchPath* searchPath) const
 
 SearchPaths LinkerSearchPaths::GetAssetSearchPathsForProject(const std::string& gameName, const std::string& projectName)
 {
-    SearchPaths searchPathsForProject;
+    SearchPaths searchPathsForProject(true);
 
     for (const auto& searchPathStr : m_args.GetAssetSearchPathsForProject(gameName, projectName))
     {
@@ -52,7 +56,7 @@ SearchPaths LinkerSearchPaths::GetAssetSearchPathsForProject(const std::string&
         if (m_args.m_verbose)
             std::cout << "Adding asset search path: " << absolutePath.string() << "\n";
 
-        auto searchPath = std::make_unique<SearchPathFilesystem>(searchPathStr);
+        auto searchPath = std::make_unique<SearchPathFilesystem>(searchPathStr, true);
         LoadSearchPath(searchPath.get());
         searchPathsForProject.IncludeSearchPath(searchPath.get());
         m_loaded_project_search_paths.emplace_back(std::move(searchPath));
@@ -70,7 +74,7 @@ SearchPaths LinkerSearchPaths::GetAssetSearchPathsForProject(const std::string&
 
 SearchPaths LinkerSearchPaths::GetGdtSearchPathsForProject(const std::string& gameName, const std::string& projectName)
 {
-    SearchPaths searchPathsForProject;
+    SearchPaths searchPathsForProject(true);
 
     for (const auto& searchPathStr : m_args.GetGdtSearchPathsForProject(gameName, projectName))
     {
@@ -86,7 +90,7 @@ SearchPaths LinkerSearchPaths::GetGdtSearchPathsForProject(const std::string& ga
         if (m_args.m_verbose)
             std::cout << "Adding gdt search path: " << absolutePath.string() << "\n";
 
-        searchPathsForProject.CommitSearchPath(std::make_unique<SearchPathFilesystem>(searchPathStr));
+        searchPathsForProject.CommitSearchPath(std::make_unique<SearchPathFilesystem>(searchPathStr, true));
     }
 
     searchPathsForProject.IncludeSearchPath(&m_gdt_search_paths);
@@ -96,7 +100,7 @@ SearchPaths LinkerSearchPaths::GetGdtSearchPathsForProject(const std::string& ga
 
 SearchPaths LinkerSearchPaths::GetSourceSearchPathsForProject(const std::string& projectName)
 {
-    SearchPaths searchPathsForProject;
+    SearchPaths searchPathsForProject(true);
 
     for (const auto& searchPathStr : m_args.GetSourceSearchPathsForProject(projectName))
     {
@@ -112,7 +116,7 @@ SearchPaths LinkerSearchPaths::GetSourceSearchPathsForProject(const std::string&
         if (m_args.m_verbose)
             std::cout << "Adding source search path: " << absolutePath.string() << "\n";
 
-        searchPathsForProject.CommitSearchPath(std::make_unique<SearchPathFilesystem>(searchPathStr));
+        searchPathsForProject.CommitSearchPath(std::make_unique<SearchPathFilesystem>(searchPathStr, true));
     }
 
     searchPathsForProject.IncludeSearchPath(&m_source_search_paths);
@@ -136,7 +140,7 @@ bool LinkerSearchPaths::BuildProjectIndependentSearchPaths()
         if (m_args.m_verbose)
             std::cout << "Adding asset search path: " << absolutePath.string() << "\n";
 
-        auto searchPath = std::make_unique<SearchPathFilesystem>(absolutePath.string());
+        auto searchPath = std::make_unique<SearchPathFilesystem>(absolutePath.string(), true);
         LoadSearchPath(searchPath.get());
         m_asset_search_paths.CommitSearchPath(std::move(searchPath));
     }
@@ -155,7 +159,7 @@ bool LinkerSearchPaths::BuildProjectIndependentSearchPaths()
         if (m_args.m_verbose)
             std::cout << "Adding gdt search path: " << absolutePath.string() << "\n";
 
-        m_gdt_search_paths.CommitSearchPath(std::make_unique<SearchPathFilesystem>(absolutePath.string()));
+        m_gdt_search_paths.CommitSearchPath(std::make_unique<SearchPathFilesystem>(absolutePath.string(), true));
     }
 
     for (const auto& path : m_args.GetProjectIndependentSourceSearchPaths())
@@ -172,7 +176,7 @@ bool LinkerSearchPaths::BuildProjectIndependentSearchPaths()
         if (m_args.m_verbose)
             std::cout << "Adding source search path: " << absolutePath.string() << "\n";
 
-        m_source_search_paths.CommitSearchPath(std::make_unique<SearchPathFilesystem>(absolutePath.string()));
+        m_source_search_paths.CommitSearchPath(std::make_unique<SearchPathFilesystem>(absolutePath.string(), true));
     }
 
     return true;
@@ -187,3 +191,17 @@ void LinkerSearchPaths::UnloadProjectSpecificSearchPaths()
 
     m_loaded_project_search_paths.clear();
 }
+
+void LinkerSearchPaths::InvalidateProjectIndependentFileIndices()
+{
+    for (auto* searchPaths : {&m_asset_search_paths, &m_gdt_search_paths, &m_source_search_paths})
+    {
+        for (auto* searchPath : *searchPaths)
+        {
+            if (auto* searchPathFilesystem = dynamic_cast<SearchPathFilesystem*>(searchPath))
+                searchPathFilesystem->InvalidateDirectoryIndex();
+        }
+
+        searchPaths->InvalidateFileIndex();
+    }
+}
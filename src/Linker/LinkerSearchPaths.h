@@ -36,6 +36,12 @@ public:
 
     void UnloadProjectSpecificSearchPaths();
 
+    /**
+     * \brief Discards the file indices of the project independent search paths so that files that were added or removed since are found.
+     * Must not be called while a project is being built.
+     */
+    void InvalidateProjectIndependentFileIndices();
+
 private:
     const LinkerArgs& m_args;
     std::vector<std::unique_ptr<ISearchPath>> m_loaded_project_search_paths;
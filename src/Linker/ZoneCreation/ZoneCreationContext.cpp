@@ -2,12 +2,14 @@
 
 ZoneCreationContext::ZoneCreationContext()
     : m_asset_search_path(nullptr),
-      m_definition(nullptr)
+      m_definition(nullptr),
+      m_previous_dependency_graph(nullptr)
 {
 }
 
 ZoneCreationContext::ZoneCreationContext(ISearchPath* assetSearchPath, ZoneDefinition* definition)
     : m_asset_search_path(assetSearchPath),
-      m_definition(definition)
+      m_definition(definition),
+      m_previous_dependency_graph(nullptr)
 {
 }
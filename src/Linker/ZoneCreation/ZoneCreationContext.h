@@ -1,4 +1,5 @@
 #pragma once
+#include "AssetLoading/AssetDependencyGraph.h"
 #include "Obj/Gdt/Gdt.h"
 #include "SearchPath/ISearchPath.h"
 #include "Zone/AssetList/AssetList.h"
@@ -16,6 +17,8 @@ public:
     ZoneDefinition* m_definition;
     std::vector<std::unique_ptr<Gdt>> m_gdt_files;
     AssetList m_ignored_assets;
+    const AssetDependencyGraph* m_previous_dependency_graph;
+    AssetDependencyGraph m_dependency_graph;
 
     ZoneCreationContext();
     ZoneCreationContext(ISearchPath* assetSearchPath, ZoneDefinition* definition);
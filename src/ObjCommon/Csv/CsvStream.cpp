@@ -1,8 +1,152 @@
 #include "CsvStream.h"
 
+#include "Utils/ClassUtils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
 #include <sstream>
+#include <string_view>
 
 constexpr char CSV_SEPARATOR = ',';
+constexpr char CSV_QUOTE = '"';
+
+namespace
+{
+    /**
+     * \brief Splits csv data that is completely in memory into cells.
+     * Rows without quotes are split with memchr which is a lot faster than looking at every character.
+     */
+    class CsvTokenizer
+    {
+    public:
+        explicit CsvTokenizer(const std::string& data)
+            : m_data(data),
+              m_pos(0u)
+        {
+        }
+
+        /**
+         * \brief Appends the cells of the next row.
+         * Views of cells are valid as long as the data and the tokenizer are alive.
+         * \return \c true if a row was read, \c false if there are no more rows.
+         */
+        bool NextRow(std::vector<std::string_view>& cells)
+        {
+            const auto size = m_data.size();
+            if (m_pos >= size)
+                return false;
+
+            const auto* data = m_data.data();
+            const auto* lineStart = &data[m_pos];
+            const auto* newLine = static_cast<const char*>(std::memchr(lineStart, '\n', size - m_pos));
+            const auto* lineEnd = newLine ? newLine : &data[size];
+
+            if (std::memchr(lineStart, CSV_QUOTE, static_cast<size_t>(lineEnd - lineStart)) != nullptr)
+            {
+                ReadRowWithQuotes(cells);
+                return true;
+            }
+
+            m_pos = newLine ? static_cast<size_t>(newLine - data) + 1u : size;
+            if (newLine && lineEnd > lineStart && lineEnd[-1] == '\r')
+                lineEnd--;
+
+            const auto* cellStart = lineStart;
+            while (true)
+            {
+                const auto* separator = static_cast<const char*>(std::memchr(cellStart, CSV_SEPARATOR, static_cast<size_t>(lineEnd - cellStart)));
+                if (!separator)
+                {
+                    cells.emplace_back(cellStart, static_cast<size_t>(lineEnd - cellStart));
+                    return true;
+                }
+
+                cells.emplace_back(cellStart, static_cast<size_t>(separator - cellStart));
+                cellStart = separator + 1;
+            }
+        }
+
+    private:
+        _NODISCARD size_t FindCellEnd(size_t pos) const
+        {
+            const auto size = m_data.size();
+            while (pos < size)
+            {
+                const auto c = m_data[pos];
+                if (c == CSV_SEPARATOR || c == '\n' || (c == '\r' && pos + 1 < size && m_data[pos + 1] == '\n'))
+                    break;
+
+                pos++;
+            }
+
+            return pos;
+        }
+
+        void ReadRowWithQuotes(std::vector<std::string_view>& cells)
+        {
+            const auto size = m_data.size();
+            auto pos = m_pos;
+
+            while (true)
+            {
+                if (pos < size && m_data[pos] == CSV_QUOTE)
+                {
+                    auto& value = m_unescaped_cells.emplace_back();
+                    pos++;
+
+                    while (pos < size)
+                    {
+                        if (m_data[pos] == CSV_QUOTE)
+                        {
+                            if (pos + 1 < size && m_data[pos + 1] == CSV_QUOTE)
+                            {
+                                value += CSV_QUOTE;
+                                pos += 2;
+                                continue;
+                            }
+
+                            pos++;
+                            break;
+                        }
+
+                        value += m_data[pos++];
+                    }
+
+                    // Anything between the closing quote and the end of the cell is kept as is
+                    const auto cellEnd = FindCellEnd(pos);
+                    value.append(m_data, pos, cellEnd - pos);
+                    pos = cellEnd;
+                    cells.emplace_back(value);
+                }
+                else
+                {
+                    const auto cellEnd = FindCellEnd(pos);
+                    cells.emplace_back(&m_data[pos], cellEnd - pos);
+                    pos = cellEnd;
+                }
+
+                if (pos >= size)
+                {
+                    m_pos = size;
+                    return;
+                }
+
+                if (m_data[pos] != CSV_SEPARATOR)
+                {
+                    m_pos = pos + (m_data[pos] == '\r' ? 2u : 1u);
+                    return;
+                }
+
+                pos++;
+            }
+        }
+
+        const std::string& m_data;
+        size_t m_pos;
+        std::deque<std::string> m_unescaped_cells;
+    };
+} // namespace
 
 CsvInputStream::CsvInputStream(std::istream& stream)
     : m_stream(stream)
@@ -73,6 +217,80 @@ bool CsvInputStream::EmitNextRow(const std::function<void(std::string)>& cb) con
     return !isEof;
 }
 
+std::string CsvInputStream::ReadRemainingData() const
+{
+    std::ostringstream data;
+    data << m_stream.rdbuf();
+
+    return std::move(data).str();
+}
+
+void CsvInputStream::ReadAllRows(std::vector<std::vector<std::string>>& out) const
+{
+    const auto data = ReadRemainingData();
+    CsvTokenizer tokenizer(data);
+    std::vector<std::string_view> cells;
+
+    while (tokenizer.NextRow(cells))
+    {
+        auto& row = out.emplace_back();
+        row.reserve(cells.size());
+        for (const auto& cell : cells)
+            row.emplace_back(cell);
+
+        cells.clear();
+    }
+}
+
+void CsvInputStream::ReadAllRows(CsvCells& out, MemoryManager& memory) const
+{
+    const auto data = ReadRemainingData();
+    CsvTokenizer tokenizer(data);
+    std::vector<std::string_view> cells;
+    std::vector<size_t> rowStarts;
+    size_t columnCount = 0u;
+
+    while (true)
+    {
+        const auto rowStart = cells.size();
+        if (!tokenizer.NextRow(cells))
+            break;
+
+        rowStarts.emplace_back(rowStart);
+        columnCount = std::max(columnCount, cells.size() - rowStart);
+    }
+
+    size_t textSize = 0u;
+    for (const auto& cell : cells)
+    {
+        if (!cell.empty())
+            textSize += cell.size() + 1u;
+    }
+
+    auto* text = textSize > 0u ? memory.Alloc<char>(textSize) : nullptr;
+
+    out.m_row_count = rowStarts.size();
+    out.m_column_count = columnCount;
+    out.m_cells.assign(out.m_row_count * columnCount, "");
+
+    for (auto row = 0u; row < rowStarts.size(); row++)
+    {
+        const auto rowStart = rowStarts[row];
+        const auto rowEnd = row + 1u < rowStarts.size() ? rowStarts[row + 1u] : cells.size();
+        for (auto cellIndex = rowStart; cellIndex < rowEnd; cellIndex++)
+        {
+            const auto& cell = cells[cellIndex];
+            if (cell.empty())
+                continue;
+
+            std::memcpy(text, cell.data(), cell.size());
+            text[cell.size()] = '\0';
+            out.m_cells[row * columnCount + (cellIndex - rowStart)] = text;
+            text += cell.size() + 1u;
+        }
+    }
+}
+
 CsvOutputStream::CsvOutputStream(std::ostream& stream)
     : m_stream(stream),
       m_column_count(0),
@@ -6,6 +6,18 @@
 #include <string>
 #include <vector>
 
+/**
+ * \brief The cells of all rows of a csv file.
+ * Cells are stored row by row. Rows with less cells than the widest row are padded with empty cells.
+ */
+class CsvCells
+{
+public:
+    std::vector<const char*> m_cells;
+    size_t m_row_count = 0u;
+    size_t m_column_count = 0u;
+};
+
 class CsvInputStream
 {
 public:
@@ -14,8 +26,24 @@ public:
     bool NextRow(std::vector<std::string>& out) const;
     bool NextRow(std::vector<const char*>& out, MemoryManager& memory) const;
 
+    /**
+     * \brief Reads all remaining rows at once.
+     * Cells starting with a quote are unescaped the same way the \c CsvOutputStream escapes them.
+     * \param out The rows that were read.
+     */
+    void ReadAllRows(std::vector<std::vector<std::string>>& out) const;
+
+    /**
+     * \brief Reads all remaining rows at once and copies the content of all non-empty cells into a single allocation of the memory manager.
+     * Cells starting with a quote are unescaped the same way the \c CsvOutputStream escapes them.
+     * \param out The cells that were read. Empty cells point to an empty string that is not owned by the memory manager.
+     * \param memory The memory manager to allocate the cell contents with.
+     */
+    void ReadAllRows(CsvCells& out, MemoryManager& memory) const;
+
 private:
     bool EmitNextRow(const std::function<void(std::string)>& cb) const;
+    std::string ReadRemainingData() const;
 
     std::istream& m_stream;
 };
@@ -45,13 +45,7 @@ float ParsedCsvRow::GetValueFloat(const std::string& header, const bool required
 ParsedCsv::ParsedCsv(const CsvInputStream& inputStream, const bool hasHeaders)
 {
     std::vector<std::vector<std::string>> csvLines;
-    std::vector<std::string> currentLine;
-
-    while (inputStream.NextRow(currentLine))
-    {
-        csvLines.emplace_back(std::move(currentLine));
-        currentLine = std::vector<std::string>();
-    }
+    inputStream.ReadAllRows(csvLines);
 
     if (hasHeaders)
     {
@@ -1,5 +1,8 @@
 #include "InfoString.h"
 
+#include "Utils/FileUtils.h"
+
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <sstream>
@@ -7,12 +10,12 @@
 
 const std::string InfoString::EMPTY_VALUE;
 
-bool InfoString::HasKey(const std::string& key) const
+bool InfoString::HasKey(const std::string_view key) const
 {
     return m_values.find(key) != m_values.end();
 }
 
-const std::string& InfoString::GetValueForKey(const std::string& key) const
+const std::string& InfoString::GetValueForKey(const std::string_view key) const
 {
     const auto& value = m_values.find(key);
 
@@ -22,7 +25,7 @@ const std::string& InfoString::GetValueForKey(const std::string& key) const
     return value->second;
 }
 
-const std::string& InfoString::GetValueForKey(const std::string& key, bool* foundValue) const
+const std::string& InfoString::GetValueForKey(const std::string_view key, bool* foundValue) const
 {
     const auto& value = m_values.find(key);
 
@@ -98,68 +101,85 @@ void InfoString::ToGdtProperties(const std::string& prefix, GdtEntry& gdtEntry)
     gdtEntry.m_properties[GDT_PREFIX_FIELD] = prefix;
 }
 
-class InfoStringInputStream
+namespace
 {
-    std::istream& m_stream;
-    int m_last_separator;
-
-public:
-    explicit InfoStringInputStream(std::istream& stream)
-        : m_stream(stream),
-          m_last_separator(EOF)
-    {
-    }
-
-    bool NextField(std::string& value)
+    // Splits an info string that was read completely into its fields without copying them
+    class InfoStringSplitter
     {
-        std::ostringstream str;
+        std::string_view m_data;
+        size_t m_offset;
+        bool m_ends_with_separator;
+
+    public:
+        explicit InfoStringSplitter(const std::string_view data)
+            : m_data(data),
+              m_offset(0u),
+              m_ends_with_separator(false)
+        {
+        }
 
-        auto c = m_stream.get();
-        if (c == EOF)
+        bool NextField(std::string_view& value)
         {
-            if (m_last_separator != EOF)
+            if (m_offset >= m_data.size())
             {
-                m_last_separator = EOF;
-                value = std::string();
-                return true;
+                // A separator at the end is followed by an empty field
+                if (m_ends_with_separator)
+                {
+                    m_ends_with_separator = false;
+                    value = std::string_view();
+                    return true;
+                }
+
+                return false;
             }
 
-            return false;
-        }
+            const auto separatorOffset = m_data.find('\\', m_offset);
+            if (separatorOffset == std::string_view::npos)
+            {
+                value = m_data.substr(m_offset);
+                m_offset = m_data.size();
+                m_ends_with_separator = false;
+            }
+            else
+            {
+                value = m_data.substr(m_offset, separatorOffset - m_offset);
+                m_offset = separatorOffset + 1u;
+                m_ends_with_separator = true;
+            }
 
-        while (c != EOF && c != '\\')
-        {
-            str << static_cast<char>(c);
-            c = m_stream.get();
+            return true;
         }
+    };
+} // namespace
 
-        m_last_separator = c;
-        value = str.str();
-        return true;
+void InfoString::SetValueFromView(const std::string_view key, const std::string_view value)
+{
+    const auto existingEntry = m_values.find(key);
+    if (existingEntry == m_values.end())
+    {
+        m_keys_by_insertion.emplace_back(key);
+        m_values.emplace(std::string(key), std::string(value));
+    }
+    else
+    {
+        existingEntry->second.assign(value);
     }
-};
+}
 
 bool InfoString::FromStream(std::istream& stream)
 {
-    InfoStringInputStream infoStream(stream);
+    const auto data = FileUtils::ReadStream(stream);
+    InfoStringSplitter splitter(data);
+    m_values.reserve(m_values.size() + static_cast<size_t>(std::count(data.begin(), data.end(), '\\')) / 2u + 1u);
 
-    std::string key;
-    while (infoStream.NextField(key))
+    std::string_view key;
+    while (splitter.NextField(key))
     {
-        std::string value;
-        if (!infoStream.NextField(value))
+        std::string_view value;
+        if (!splitter.NextField(value))
             return false;
 
-        const auto existingEntry = m_values.find(key);
-        if (existingEntry == m_values.end())
-        {
-            m_keys_by_insertion.push_back(key);
-            m_values.emplace(std::make_pair(key, value));
-        }
-        else
-        {
-            existingEntry->second = value;
-        }
+        SetValueFromView(key, value);
     }
 
     return true;
@@ -167,10 +187,11 @@ bool InfoString::FromStream(std::istream& stream)
 
 bool InfoString::FromStream(const std::string& prefix, std::istream& stream)
 {
-    InfoStringInputStream infoStream(stream);
+    const auto data = FileUtils::ReadStream(stream);
+    InfoStringSplitter splitter(data);
 
-    std::string readPrefix;
-    if (!infoStream.NextField(readPrefix))
+    std::string_view readPrefix;
+    if (!splitter.NextField(readPrefix))
     {
         std::cerr << "Invalid info string: Empty\n";
         return false;
@@ -182,8 +203,10 @@ bool InfoString::FromStream(const std::string& prefix, std::istream& stream)
         return false;
     }
 
-    std::string key;
-    while (infoStream.NextField(key))
+    m_values.reserve(m_values.size() + static_cast<size_t>(std::count(data.begin(), data.end(), '\\')) / 2u);
+
+    std::string_view key;
+    while (splitter.NextField(key))
     {
         if (key.empty())
         {
@@ -195,23 +218,14 @@ bool InfoString::FromStream(const std::string& prefix, std::istream& stream)
             return false;
         }
 
-        std::string value;
-        if (!infoStream.NextField(value))
+        std::string_view value;
+        if (!splitter.NextField(value))
         {
             std::cerr << "Invalid info string: Unexpected eof, no value for key \"" << key << "\"\n";
             return false;
         }
 
-        const auto existingEntry = m_values.find(key);
-        if (existingEntry == m_values.end())
-        {
-            m_keys_by_insertion.push_back(key);
-            m_values.emplace(std::make_pair(key, value));
-        }
-        else
-        {
-            existingEntry->second = value;
-        }
+        SetValueFromView(key, value);
     }
 
     return true;
@@ -236,18 +250,7 @@ bool InfoString::FromGdtProperties(const GdtEntry& gdtEntry)
         entryStack.pop();
 
         for (const auto& [key, value] : currentEntry->m_properties)
-        {
-            auto existingEntry = m_values.find(key);
-            if (existingEntry == m_values.end())
-            {
-                m_keys_by_insertion.push_back(key);
-                m_values.emplace(std::make_pair(key, value));
-            }
-            else
-            {
-                existingEntry->second = value;
-            }
-        }
+            SetValueFromView(key, value);
     }
 
     return true;
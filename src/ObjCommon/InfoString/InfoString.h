@@ -2,8 +2,11 @@
 #include "Obj/Gdt/GdtEntry.h"
 #include "Utils/ClassUtils.h"
 
+#include <cstddef>
+#include <functional>
 #include <istream>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -11,14 +14,28 @@ class InfoString
 {
     static constexpr const char* GDT_PREFIX_FIELD = "configstringFileType";
 
+    // Allows looking up keys without creating a string for them
+    class KeyHash
+    {
+    public:
+        using is_transparent = void;
+
+        size_t operator()(const std::string_view key) const noexcept
+        {
+            return std::hash<std::string_view>()(key);
+        }
+    };
+
     static const std::string EMPTY_VALUE;
-    std::unordered_map<std::string, std::string> m_values;
+    std::unordered_map<std::string, std::string, KeyHash, std::equal_to<>> m_values;
     std::vector<std::string> m_keys_by_insertion;
 
+    void SetValueFromView(std::string_view key, std::string_view value);
+
 public:
-    _NODISCARD bool HasKey(const std::string& key) const;
-    _NODISCARD const std::string& GetValueForKey(const std::string& key) const;
-    const std::string& GetValueForKey(const std::string& key, bool* foundValue) const;
+    _NODISCARD bool HasKey(std::string_view key) const;
+    _NODISCARD const std::string& GetValueForKey(std::string_view key) const;
+    const std::string& GetValueForKey(std::string_view key, bool* foundValue) const;
     void SetValueForKey(const std::string& key, std::string value);
     void RemoveKey(const std::string& key);
 
@@ -0,0 +1,12 @@
+#include "JsonInput.h"
+
+#include "Utils/FileUtils.h"
+
+namespace json_input
+{
+    nlohmann::json Parse(std::istream& stream)
+    {
+        const auto data = FileUtils::ReadStream(stream);
+        return nlohmann::json::parse(data.data(), data.data() + data.size());
+    }
+} // namespace json_input
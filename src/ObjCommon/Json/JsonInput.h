@@ -0,0 +1,17 @@
+#pragma once
+
+#include <istream>
+#include <nlohmann/json.hpp>
+
+namespace json_input
+{
+    /**
+     * \brief Reads the remaining contents of a stream into a single buffer and parses them as json.
+     * Parsing from contiguous memory does not need to go through the stream buffer for every single character,
+     * which is slow for streams that are not backed by a file like the entries of an IWD.
+     * \param stream The stream to read the json from.
+     * \return The parsed json.
+     * \throws nlohmann::json::parse_error When the contents are no valid json.
+     */
+    nlohmann::json Parse(std::istream& stream);
+} // namespace json_input
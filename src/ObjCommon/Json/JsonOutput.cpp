@@ -0,0 +1,36 @@
+#include "JsonOutput.h"
+
+#include <string>
+
+namespace
+{
+    constexpr auto INDENTATION = 4u;
+
+    std::string& SerializeToBuffer(const nlohmann::json& json)
+    {
+        // Dumping many assets on the same thread does not need to grow a new buffer for every one of them
+        thread_local std::string buffer;
+        buffer.clear();
+
+        nlohmann::detail::serializer<nlohmann::json> serializer(nlohmann::detail::output_adapter<char, std::string>(buffer), ' ');
+        serializer.dump(json, true, false, INDENTATION);
+
+        return buffer;
+    }
+} // namespace
+
+namespace json_output
+{
+    void Write(std::ostream& stream, const nlohmann::json& json)
+    {
+        const auto& buffer = SerializeToBuffer(json);
+        stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+
+    void WriteLine(std::ostream& stream, const nlohmann::json& json)
+    {
+        auto& buffer = SerializeToBuffer(json);
+        buffer += '\n';
+        stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+} // namespace json_output
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <ostream>
+
+namespace json_output
+{
+    /**
+     * \brief Serializes json with an indentation of four spaces like \c stream << std::setw(4) << json and writes it to the stream at once.
+     * The json is serialized into a buffer that is reused by the calling thread instead of being formatted through the stream.
+     * \param stream The stream to write the json to.
+     * \param json The json to write.
+     */
+    void Write(std::ostream& stream, const nlohmann::json& json);
+
+    /**
+     * \brief Same as \c Write but ends the written json with a new line.
+     * \param stream The stream to write the json to.
+     * \param json The json to write.
+     */
+    void WriteLine(std::ostream& stream, const nlohmann::json& json);
+} // namespace json_output
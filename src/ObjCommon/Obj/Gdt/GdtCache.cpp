@@ -0,0 +1,296 @@
+#include "GdtCache.h"
+
+#include "GdtStream.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <type_traits>
+#include <unordered_map>
+
+namespace fs = std::filesystem;
+
+GdtCache GdtCache::Instance;
+
+namespace
+{
+    constexpr char CACHE_FILE_MAGIC[]{'O', 'A', 'T', 'G', 'D', 'T', 'C', 'A'};
+    constexpr uint32_t CACHE_FILE_VERSION = 1u;
+
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325u;
+    constexpr uint64_t FNV_PRIME = 0x100000001B3u;
+
+    constexpr uint32_t NO_PARENT_INDEX = UINT32_MAX;
+
+    class CacheWriter
+    {
+    public:
+        explicit CacheWriter(std::ostream& stream)
+            : m_stream(stream)
+        {
+        }
+
+        template<typename T> void Write(const T value)
+        {
+            static_assert(std::is_arithmetic_v<T>);
+            m_stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        void Write(const std::string& value)
+        {
+            Write(static_cast<uint32_t>(value.size()));
+            m_stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+        }
+
+        void Write(const Gdt& gdt)
+        {
+            Write(gdt.m_version.m_game);
+            Write(static_cast<int32_t>(gdt.m_version.m_version));
+
+            std::unordered_map<const GdtEntry*, uint32_t> entryIndices;
+            Write(static_cast<uint32_t>(gdt.m_entries.size()));
+            for (const auto& entry : gdt.m_entries)
+            {
+                entryIndices.emplace(entry.get(), static_cast<uint32_t>(entryIndices.size()));
+
+                Write(entry->m_name);
+                Write(entry->m_gdf_name);
+
+                const auto parentIndex = entry->m_parent ? entryIndices.find(entry->m_parent) : entryIndices.end();
+                Write(parentIndex != entryIndices.end() ? parentIndex->second : NO_PARENT_INDEX);
+
+                Write(static_cast<uint32_t>(entry->m_properties.size()));
+                for (const auto& [key, value] : entry->m_properties)
+                {
+                    Write(key);
+                    Write(value);
+                }
+            }
+        }
+
+    private:
+        std::ostream& m_stream;
+    };
+
+    class CacheReader
+    {
+    public:
+        explicit CacheReader(std::istream& stream)
+            : m_stream(stream)
+        {
+        }
+
+        _NODISCARD bool Ok() const
+        {
+            return !m_stream.fail();
+        }
+
+        template<typename T> void Read(T& value)
+        {
+            static_assert(std::is_arithmetic_v<T>);
+            m_stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+        }
+
+        void Read(std::string& value)
+        {
+            uint32_t size = 0;
+            Read(size);
+
+            // Sizes of corrupted files must not cause huge allocations
+            value.clear();
+            while (Ok() && value.size() < size)
+            {
+                char buffer[256];
+                const auto readSize = std::min<size_t>(size - value.size(), sizeof(buffer));
+                m_stream.read(buffer, static_cast<std::streamsize>(readSize));
+                value.append(buffer, static_cast<size_t>(m_stream.gcount()));
+            }
+        }
+
+        void Read(Gdt& gdt)
+        {
+            int32_t version = 0;
+            Read(gdt.m_version.m_game);
+            Read(version);
+            gdt.m_version.m_version = version;
+
+            uint32_t entryCount = 0;
+            Read(entryCount);
+            for (auto i = 0u; i < entryCount && Ok(); i++)
+            {
+                auto entry = std::make_unique<GdtEntry>();
+                Read(entry->m_name);
+                Read(entry->m_gdf_name);
+
+                // Parents are always written before their children
+                uint32_t parentIndex = 0;
+                Read(parentIndex);
+                if (parentIndex != NO_PARENT_INDEX)
+                {
+                    if (parentIndex >= gdt.m_entries.size())
+                    {
+                        m_stream.setstate(std::ios::failbit);
+                        return;
+                    }
+
+                    entry->m_parent = gdt.m_entries[parentIndex].get();
+                }
+
+                uint32_t propertyCount = 0;
+                Read(propertyCount);
+                for (auto j = 0u; j < propertyCount && Ok(); j++)
+                {
+                    std::string key;
+                    std::string value;
+                    Read(key);
+                    Read(value);
+                    entry->m_properties.emplace(std::move(key), std::move(value));
+                }
+
+                gdt.m_entries.emplace_back(std::move(entry));
+            }
+        }
+
+    private:
+        std::istream& m_stream;
+    };
+
+    uint64_t HashData(const std::string& data)
+    {
+        auto hash = FNV_OFFSET_BASIS;
+        for (const auto c : data)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= FNV_PRIME;
+        }
+
+        return hash;
+    }
+
+    std::unique_ptr<Gdt> ReadCompiledGdt(const std::string& compiledGdt)
+    {
+        std::istringstream stream(compiledGdt);
+        CacheReader reader(stream);
+
+        auto gdt = std::make_unique<Gdt>();
+        reader.Read(*gdt);
+        if (!reader.Ok())
+            return nullptr;
+
+        return gdt;
+    }
+} // namespace
+
+GdtCache::GdtCache()
+    : m_modified(false)
+{
+}
+
+std::unique_ptr<Gdt> GdtCache::ReadGdt(const std::string& gdtName, std::istream& stream)
+{
+    // Reading the file is cheap compared to parsing it and allows detecting changed files without relying on file modification times
+    std::ostringstream data;
+    data << stream.rdbuf();
+    auto gdtData = std::move(data).str();
+    const auto hash = HashData(gdtData);
+    const auto size = gdtData.size();
+
+    {
+        std::lock_guard lock(m_mutex);
+        const auto cachedGdt = m_cached_gdts.find(gdtName);
+        if (cachedGdt != m_cached_gdts.end() && cachedGdt->second.m_hash == hash && cachedGdt->second.m_size == size)
+        {
+            auto gdt = ReadCompiledGdt(cachedGdt->second.m_compiled_gdt);
+            if (gdt)
+                return gdt;
+        }
+    }
+
+    std::istringstream gdtStream(std::move(gdtData));
+    GdtReader gdtReader(gdtStream);
+    auto gdt = std::make_unique<Gdt>();
+    if (!gdtReader.Read(*gdt))
+        return nullptr;
+
+    std::ostringstream compiledGdt;
+    CacheWriter writer(compiledGdt);
+    writer.Write(*gdt);
+
+    std::lock_guard lock(m_mutex);
+    m_cached_gdts.insert_or_assign(gdtName, CachedGdt{hash, size, std::move(compiledGdt).str()});
+    m_modified = true;
+
+    return gdt;
+}
+
+bool GdtCache::Load(const std::string& path)
+{
+    std::ifstream stream(path, std::fstream::in | std::fstream::binary);
+    if (!stream.is_open())
+        return false;
+
+    char magic[sizeof(CACHE_FILE_MAGIC)];
+    uint32_t version = 0;
+    stream.read(magic, sizeof(magic));
+    stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (stream.fail() || !std::equal(std::begin(magic), std::end(magic), std::begin(CACHE_FILE_MAGIC)) || version != CACHE_FILE_VERSION)
+        return false;
+
+    std::lock_guard lock(m_mutex);
+    CacheReader reader(stream);
+
+    uint32_t count = 0;
+    reader.Read(count);
+    for (auto i = 0u; i < count && reader.Ok(); i++)
+    {
+        std::string gdtName;
+        uint64_t hash = 0;
+        uint64_t size = 0;
+        std::string compiledGdt;
+        reader.Read(gdtName);
+        reader.Read(hash);
+        reader.Read(size);
+        reader.Read(compiledGdt);
+
+        if (reader.Ok())
+            m_cached_gdts.try_emplace(std::move(gdtName), CachedGdt{hash, static_cast<size_t>(size), std::move(compiledGdt)});
+    }
+
+    return reader.Ok();
+}
+
+bool GdtCache::Save(const std::string& path)
+{
+    std::lock_guard lock(m_mutex);
+    if (!m_modified)
+        return true;
+
+    std::error_code ec;
+    const auto parentPath = fs::path(path).parent_path();
+    if (!parentPath.empty())
+        fs::create_directories(parentPath, ec);
+
+    std::ofstream stream(path, std::fstream::out | std::fstream::binary | std::fstream::trunc);
+    if (!stream.is_open())
+        return false;
+
+    stream.write(CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC));
+    stream.write(reinterpret_cast<const char*>(&CACHE_FILE_VERSION), sizeof(CACHE_FILE_VERSION));
+
+    CacheWriter writer(stream);
+    writer.Write(static_cast<uint32_t>(m_cached_gdts.size()));
+    for (const auto& [gdtName, cachedGdt] : m_cached_gdts)
+    {
+        writer.Write(gdtName);
+        writer.Write(cachedGdt.m_hash);
+        writer.Write(static_cast<uint64_t>(cachedGdt.m_size));
+        writer.Write(cachedGdt.m_compiled_gdt);
+    }
+
+    if (!stream.good())
+        return false;
+
+    m_modified = false;
+    return true;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Gdt.h"
+#include "Utils/ClassUtils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * \brief Keeps gdt files in a compiled binary form that is a lot faster to read than parsing the text of the gdt.
+ * Gdt files are identified by their name and a hash of their content so changed files are parsed again.
+ * Can be used from multiple threads at once and can be saved to disk to skip parsing the same gdts in later runs.
+ */
+class GdtCache
+{
+    class CachedGdt
+    {
+    public:
+        uint64_t m_hash;
+        size_t m_size;
+        std::string m_compiled_gdt;
+    };
+
+    // Only the latest version of each gdt file is kept to not grow the cache with every change to a gdt
+    std::unordered_map<std::string, CachedGdt> m_cached_gdts;
+    bool m_modified;
+    std::mutex m_mutex;
+
+public:
+    static GdtCache Instance;
+
+    GdtCache();
+    ~GdtCache() = default;
+    GdtCache(const GdtCache& other) = delete;
+    GdtCache(GdtCache&& other) noexcept = delete;
+    GdtCache& operator=(const GdtCache& other) = delete;
+    GdtCache& operator=(GdtCache&& other) noexcept = delete;
+
+    /**
+     * \brief Reads a gdt, only parsing it if a gdt with the same name and content was not parsed before.
+     * \param gdtName The name of the gdt.
+     * \param stream The stream of the gdt file.
+     * \return The read gdt or \c nullptr if it could not be parsed.
+     */
+    _NODISCARD std::unique_ptr<Gdt> ReadGdt(const std::string& gdtName, std::istream& stream);
+
+    /**
+     * \brief Adds the gdts of a cache file that was saved by a previous run.
+     * \param path The path of the cache file.
+     * \return \c true if the file exists and could be read completely, \c false otherwise. Gdts before a read error are kept.
+     */
+    bool Load(const std::string& path);
+
+    /**
+     * \brief Saves all cached gdts to a file if any gdt was parsed since creating or loading the cache.
+     * \param path The path of the cache file.
+     * \return \c true if the file is up to date, \c false if it could not be written.
+     */
+    bool Save(const std::string& path);
+};
@@ -382,6 +382,19 @@ void GdtOutputStream::EndStream()
     }
 }
 
+GdtOutputStream GdtOutputStream::CreateFormattingStream(std::ostream& stream) const
+{
+    GdtOutputStream formattingStream(stream);
+    formattingStream.m_intendation_level = m_intendation_level;
+
+    return formattingStream;
+}
+
+void GdtOutputStream::WriteFormatted(const std::string_view formattedEntries) const
+{
+    m_stream.write(formattedEntries.data(), static_cast<std::streamsize>(formattedEntries.size()));
+}
+
 void GdtOutputStream::WriteGdt(const Gdt& gdt, std::ostream& stream)
 {
     GdtOutputStream out(stream);
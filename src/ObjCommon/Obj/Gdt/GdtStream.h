@@ -1,7 +1,9 @@
 #pragma once
 #include "Gdt.h"
+#include "Utils/ClassUtils.h"
 
 #include <iostream>
+#include <string_view>
 
 class GdtReader
 {
@@ -40,5 +42,18 @@ public:
     void WriteEntry(const GdtEntry& entry);
     void EndStream();
 
+    /**
+     * \brief Creates a stream that writes entries with the same indentation as this one into a different stream.
+     * Entries can be formatted into buffers this way and be added to this stream later with \c WriteFormatted.
+     * \param stream The stream to write the entries to.
+     */
+    _NODISCARD GdtOutputStream CreateFormattingStream(std::ostream& stream) const;
+
+    /**
+     * \brief Writes entries that were formatted by a stream created with \c CreateFormattingStream.
+     * \param formattedEntries The formatted entries.
+     */
+    void WriteFormatted(std::string_view formattedEntries) const;
+
     static void WriteGdt(const Gdt& gdt, std::ostream& stream);
 };
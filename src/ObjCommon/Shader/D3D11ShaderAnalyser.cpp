@@ -2,6 +2,7 @@
 
 #include "Utils/FileUtils.h"
 
+#include <cassert>
 #include <cstring>
 
 using namespace d3d11;
@@ -298,10 +299,18 @@ namespace d3d11
         return false;
     }
 
-    bool StringFitsInChunk(const char* str, const uint8_t* shaderByteCode, const size_t shaderByteCodeSize)
+    bool ReadChunkString(std::string_view& str, const uint8_t* chunk, const size_t chunkSize, const uint32_t offset)
     {
-        const auto strLen = strnlen(str, shaderByteCodeSize - (reinterpret_cast<const uint8_t*>(str) - shaderByteCode));
-        return str[strLen] == '\0';
+        if (offset >= chunkSize)
+            return false;
+
+        const auto* strStart = reinterpret_cast<const char*>(chunk + offset);
+        const auto strLen = strnlen(strStart, chunkSize - offset);
+        if (strLen >= chunkSize - offset)
+            return false;
+
+        str = std::string_view(strStart, strLen);
+        return true;
     }
 
     BoundResourceType GetType(const D3D_SHADER_INPUT_TYPE type)
@@ -425,18 +434,11 @@ namespace d3d11
         }
     }
 
-    bool PopulateBoundResource(BoundResource& boundResource,
-                               const FileBoundResource& fileBoundResource,
-                               const uint8_t* shaderByteCode,
-                               const size_t shaderByteCodeSize,
-                               const size_t chunkOffset)
+    bool ReadBoundResource(BoundResourceView& boundResource, const FileBoundResource& fileBoundResource, const uint8_t* chunk, const size_t chunkSize)
     {
-        const auto nameString = reinterpret_cast<const char*>(shaderByteCode + chunkOffset + fileBoundResource.nameOffset);
-
-        if (!StringFitsInChunk(nameString, shaderByteCode, shaderByteCodeSize))
+        if (!ReadChunkString(boundResource.m_name, chunk, chunkSize, fileBoundResource.nameOffset))
             return false;
 
-        boundResource.m_name = std::string(nameString);
         boundResource.m_type = GetType(fileBoundResource.type);
         boundResource.m_return_type = GetReturnType(fileBoundResource.returnType);
         boundResource.m_dimension = GetDimension(fileBoundResource.dimension);
@@ -448,19 +450,14 @@ namespace d3d11
         return true;
     }
 
-    bool PopulateConstantBufferVariable(ConstantBufferVariable& constantBufferVariable,
-                                        const FileConstantBufferVariable& fileConstantBufferVariable,
-                                        const uint8_t* shaderByteCode,
-                                        const size_t shaderByteCodeSize,
-                                        const size_t chunkOffset,
-                                        const size_t chunkSize)
+    bool ReadConstantBufferVariable(ConstantBufferVariableView& constantBufferVariable,
+                                    const FileConstantBufferVariable& fileConstantBufferVariable,
+                                    const uint8_t* chunk,
+                                    const size_t chunkSize)
     {
-        const auto nameString = reinterpret_cast<const char*>(shaderByteCode + chunkOffset + fileConstantBufferVariable.nameOffset);
-
-        if (!StringFitsInChunk(nameString, shaderByteCode, shaderByteCodeSize))
+        if (!ReadChunkString(constantBufferVariable.m_name, chunk, chunkSize, fileConstantBufferVariable.nameOffset))
             return false;
 
-        constantBufferVariable.m_name = std::string(nameString);
         constantBufferVariable.m_offset = fileConstantBufferVariable.startOffset;
         constantBufferVariable.m_size = fileConstantBufferVariable.size;
         constantBufferVariable.m_flags = fileConstantBufferVariable.flags;
@@ -491,129 +488,67 @@ namespace d3d11
         }
     }
 
-    bool PopulateConstantBuffer(ConstantBuffer& constantBuffer,
-                                const FileConstantBuffer& fileConstantBuffer,
-                                const uint8_t* shaderByteCode,
-                                const size_t shaderByteCodeSize,
-                                const size_t chunkOffset,
-                                const size_t chunkSize,
-                                const unsigned targetVersion)
+    size_t GetVariableStride(const unsigned targetVersion)
     {
-        const auto nameString = reinterpret_cast<const char*>(shaderByteCode + chunkOffset + fileConstantBuffer.nameOffset);
-
-        if (!StringFitsInChunk(nameString, shaderByteCode, shaderByteCodeSize))
-            return false;
-
-        constantBuffer.m_name = std::string(nameString);
+        return targetVersion < VERSION_5_0 ? sizeof(FileConstantBufferVariable) : sizeof(FileConstantBufferVariable_5_0);
+    }
 
-        constantBuffer.m_size = fileConstantBuffer.size;
-        constantBuffer.m_flags = fileConstantBuffer.flags;
-        constantBuffer.m_type = GetType(fileConstantBuffer.type);
+    size_t GetBoundResourceStride(const unsigned targetVersion)
+    {
+        return targetVersion < VERSION_5_1 ? sizeof(FileBoundResource) : sizeof(FileBoundResource_5_1);
+    }
 
-        if (targetVersion < VERSION_5_0)
-        {
-            const auto* variables = reinterpret_cast<const FileConstantBufferVariable*>(shaderByteCode + chunkOffset + fileConstantBuffer.variableOffset);
-            if (fileConstantBuffer.variableOffset + sizeof(FileConstantBufferVariable) * fileConstantBuffer.variableCount > chunkSize)
-                return false;
+    bool ArrayFitsInChunk(const size_t chunkSize, const uint32_t offset, const uint32_t count, const size_t stride)
+    {
+        return offset <= chunkSize && count <= (chunkSize - offset) / stride;
+    }
 
-            for (auto variableIndex = 0u; variableIndex < fileConstantBuffer.variableCount; variableIndex++)
-            {
-                const auto& fileVariable = variables[variableIndex];
-                ConstantBufferVariable variable;
+    bool ValidateConstantBuffer(const FileConstantBuffer& fileConstantBuffer, const uint8_t* chunk, const size_t chunkSize, const unsigned targetVersion)
+    {
+        std::string_view name;
+        if (!ReadChunkString(name, chunk, chunkSize, fileConstantBuffer.nameOffset))
+            return false;
 
-                if (!PopulateConstantBufferVariable(variable, fileVariable, shaderByteCode, shaderByteCodeSize, chunkOffset, chunkSize))
-                    return false;
+        const auto variableStride = GetVariableStride(targetVersion);
+        if (!ArrayFitsInChunk(chunkSize, fileConstantBuffer.variableOffset, fileConstantBuffer.variableCount, variableStride))
+            return false;
 
-                constantBuffer.m_variables.emplace_back(std::move(variable));
-            }
-        }
-        else
+        for (auto variableIndex = 0u; variableIndex < fileConstantBuffer.variableCount; variableIndex++)
         {
-            const auto* variables = reinterpret_cast<const FileConstantBufferVariable_5_0*>(shaderByteCode + chunkOffset + fileConstantBuffer.variableOffset);
-            if (fileConstantBuffer.variableOffset + sizeof(FileConstantBufferVariable_5_0) * fileConstantBuffer.variableCount > chunkSize)
-                return false;
-
-            for (auto variableIndex = 0u; variableIndex < fileConstantBuffer.variableCount; variableIndex++)
-            {
-                const auto& fileVariable = variables[variableIndex];
-                ConstantBufferVariable variable;
+            const auto& fileVariable =
+                *reinterpret_cast<const FileConstantBufferVariable*>(chunk + fileConstantBuffer.variableOffset + variableIndex * variableStride);
 
-                if (!PopulateConstantBufferVariable(variable, fileVariable, shaderByteCode, shaderByteCodeSize, chunkOffset, chunkSize))
-                    return false;
-
-                constantBuffer.m_variables.emplace_back(std::move(variable));
-            }
+            ConstantBufferVariableView variable;
+            if (!ReadConstantBufferVariable(variable, fileVariable, chunk, chunkSize))
+                return false;
         }
 
         return true;
     }
 
-    bool PopulateShaderInfoFromRdef(ShaderInfo& shaderInfo, const uint8_t* shaderByteCode, const size_t shaderByteCodeSize)
+    bool ValidateRdef(const uint8_t* chunk, const size_t chunkSize, const FileRdefHeader& header, const unsigned targetVersion)
     {
-        size_t chunkOffset, chunkSize;
-        if (!FindChunk(TAG_RDEF, shaderByteCode, shaderByteCodeSize, chunkOffset, chunkSize))
+        const auto boundResourceStride = GetBoundResourceStride(targetVersion);
+        if (!ArrayFitsInChunk(chunkSize, header.boundResourceOffset, header.boundResourceCount, boundResourceStride))
             return false;
 
-        if (sizeof(FileRdefHeader) > chunkSize)
-            return false;
-
-        const auto* header = reinterpret_cast<const FileRdefHeader*>(shaderByteCode + chunkOffset);
-
-        const auto targetVersion = header->target & TARGET_VERSION_MASK;
-        const auto creatorString = reinterpret_cast<const char*>(shaderByteCode + chunkOffset + header->creatorOffset);
-
-        if (!StringFitsInChunk(creatorString, shaderByteCode, shaderByteCodeSize))
-            return false;
-
-        shaderInfo.m_creator = std::string(creatorString);
-
-        if (targetVersion < VERSION_5_1)
+        for (auto boundResourceIndex = 0u; boundResourceIndex < header.boundResourceCount; boundResourceIndex++)
         {
-            const auto* boundResources = reinterpret_cast<const FileBoundResource*>(shaderByteCode + chunkOffset + header->boundResourceOffset);
-            if (header->boundResourceOffset + sizeof(FileBoundResource) * header->boundResourceCount > chunkSize)
-                return false;
-
-            for (auto boundResourceIndex = 0u; boundResourceIndex < header->boundResourceCount; boundResourceIndex++)
-            {
-                const auto& fileBoundResource = boundResources[boundResourceIndex];
-                BoundResource boundResource;
-
-                PopulateBoundResource(boundResource, fileBoundResource, shaderByteCode, shaderByteCodeSize, chunkOffset);
+            const auto& fileBoundResource = *reinterpret_cast<const FileBoundResource*>(chunk + header.boundResourceOffset + boundResourceIndex * boundResourceStride);
 
-                shaderInfo.m_bound_resources.emplace_back(std::move(boundResource));
-            }
-        }
-        else
-        {
-            const auto* boundResources = reinterpret_cast<const FileBoundResource_5_1*>(shaderByteCode + chunkOffset + header->boundResourceOffset);
-            if (header->boundResourceOffset + sizeof(FileBoundResource_5_1) * header->boundResourceCount > chunkSize)
+            BoundResourceView boundResource;
+            if (!ReadBoundResource(boundResource, fileBoundResource, chunk, chunkSize))
                 return false;
-
-            for (auto boundResourceIndex = 0u; boundResourceIndex < header->boundResourceCount; boundResourceIndex++)
-            {
-                const auto& fileBoundResource = boundResources[boundResourceIndex];
-                BoundResource boundResource;
-
-                if (!PopulateBoundResource(boundResource, fileBoundResource, shaderByteCode, shaderByteCodeSize, chunkOffset))
-                    return false;
-
-                shaderInfo.m_bound_resources.emplace_back(std::move(boundResource));
-            }
         }
 
-        const auto* constantBuffers = reinterpret_cast<const FileConstantBuffer*>(shaderByteCode + chunkOffset + header->constantBufferOffset);
-        if (header->constantBufferOffset + sizeof(FileConstantBuffer) * header->constantBufferCount > chunkSize)
+        if (!ArrayFitsInChunk(chunkSize, header.constantBufferOffset, header.constantBufferCount, sizeof(FileConstantBuffer)))
             return false;
 
-        for (auto constantBufferIndex = 0u; constantBufferIndex < header->constantBufferCount; constantBufferIndex++)
+        const auto* constantBuffers = reinterpret_cast<const FileConstantBuffer*>(chunk + header.constantBufferOffset);
+        for (auto constantBufferIndex = 0u; constantBufferIndex < header.constantBufferCount; constantBufferIndex++)
         {
-            const auto& fileConstantBuffer = constantBuffers[constantBufferIndex];
-            ConstantBuffer constantBuffer;
-
-            if (!PopulateConstantBuffer(constantBuffer, fileConstantBuffer, shaderByteCode, shaderByteCodeSize, chunkOffset, chunkSize, targetVersion))
+            if (!ValidateConstantBuffer(constantBuffers[constantBufferIndex], chunk, chunkSize, targetVersion))
                 return false;
-
-            shaderInfo.m_constant_buffers.emplace_back(std::move(constantBuffer));
         }
 
         return true;
@@ -640,7 +575,7 @@ namespace d3d11
         }
     }
 
-    bool PopulateShaderInfoFromShdr(ShaderInfo& shaderInfo, const uint8_t* shaderByteCode, const size_t shaderByteCodeSize)
+    bool PopulateShaderInfoFromShdr(ShaderInfoView& shaderInfo, const uint8_t* shaderByteCode, const size_t shaderByteCodeSize)
     {
         size_t chunkOffset, chunkSize;
         if (!FindChunk(TAG_SHDR, shaderByteCode, shaderByteCodeSize, chunkOffset, chunkSize))
@@ -658,28 +593,153 @@ namespace d3d11
 
         return true;
     }
+} // namespace d3d11
 
-    bool PopulateShaderInfoFromBytes(ShaderInfo& shaderInfo, const uint8_t* shaderByteCode, const size_t shaderByteCodeSize)
-    {
-        if (!PopulateShaderInfoFromRdef(shaderInfo, shaderByteCode, shaderByteCodeSize))
-            return false;
+size_t ConstantBufferView::GetVariableCount() const
+{
+    return m_variable_count;
+}
 
-        if (!PopulateShaderInfoFromShdr(shaderInfo, shaderByteCode, shaderByteCodeSize))
-            return false;
+ConstantBufferVariableView ConstantBufferView::GetVariable(const size_t index) const
+{
+    assert(index < m_variable_count);
 
-        return true;
-    }
-} // namespace d3d11
+    ConstantBufferVariableView variable;
+    ReadConstantBufferVariable(variable, *reinterpret_cast<const FileConstantBufferVariable*>(m_variables + index * m_variable_stride), m_chunk, m_chunk_size);
 
-std::unique_ptr<ShaderInfo> ShaderAnalyser::GetShaderInfo(const uint8_t* shader, const size_t shaderSize)
+    return variable;
+}
+
+size_t ShaderInfoView::GetConstantBufferCount() const
+{
+    return m_constant_buffer_count;
+}
+
+ConstantBufferView ShaderInfoView::GetConstantBuffer(const size_t index) const
+{
+    assert(index < m_constant_buffer_count);
+
+    const auto& fileConstantBuffer = reinterpret_cast<const FileConstantBuffer*>(m_constant_buffers)[index];
+
+    ConstantBufferView constantBuffer;
+    ReadChunkString(constantBuffer.m_name, m_chunk, m_chunk_size, fileConstantBuffer.nameOffset);
+    constantBuffer.m_size = fileConstantBuffer.size;
+    constantBuffer.m_flags = fileConstantBuffer.flags;
+    constantBuffer.m_type = GetType(fileConstantBuffer.type);
+    constantBuffer.m_chunk = m_chunk;
+    constantBuffer.m_chunk_size = m_chunk_size;
+    constantBuffer.m_variables = m_chunk + fileConstantBuffer.variableOffset;
+    constantBuffer.m_variable_count = fileConstantBuffer.variableCount;
+    constantBuffer.m_variable_stride = GetVariableStride(m_target_version);
+
+    return constantBuffer;
+}
+
+size_t ShaderInfoView::GetBoundResourceCount() const
+{
+    return m_bound_resource_count;
+}
+
+BoundResourceView ShaderInfoView::GetBoundResource(const size_t index) const
+{
+    assert(index < m_bound_resource_count);
+
+    BoundResourceView boundResource;
+    ReadBoundResource(boundResource, *reinterpret_cast<const FileBoundResource*>(m_bound_resources + index * m_bound_resource_stride), m_chunk, m_chunk_size);
+
+    return boundResource;
+}
+
+bool ShaderAnalyser::GetShaderInfoView(const uint8_t* shader, const size_t shaderSize, ShaderInfoView& view)
 {
+    view = ShaderInfoView();
     if (shader == nullptr || shaderSize == 0)
+        return false;
+
+    size_t chunkOffset, chunkSize;
+    if (!FindChunk(TAG_RDEF, shader, shaderSize, chunkOffset, chunkSize))
+        return false;
+
+    if (sizeof(FileRdefHeader) > chunkSize)
+        return false;
+
+    const auto* chunk = shader + chunkOffset;
+    const auto& header = *reinterpret_cast<const FileRdefHeader*>(chunk);
+    const auto targetVersion = header.target & TARGET_VERSION_MASK;
+
+    if (!ReadChunkString(view.m_creator, chunk, chunkSize, header.creatorOffset))
+        return false;
+
+    // Validate the whole chunk once for reading it from the view later on to not need any checks
+    if (!ValidateRdef(chunk, chunkSize, header, targetVersion))
+        return false;
+
+    view.m_chunk = chunk;
+    view.m_chunk_size = chunkSize;
+    view.m_target_version = targetVersion;
+    view.m_constant_buffers = chunk + header.constantBufferOffset;
+    view.m_constant_buffer_count = header.constantBufferCount;
+    view.m_bound_resources = chunk + header.boundResourceOffset;
+    view.m_bound_resource_count = header.boundResourceCount;
+    view.m_bound_resource_stride = GetBoundResourceStride(targetVersion);
+
+    return PopulateShaderInfoFromShdr(view, shader, shaderSize);
+}
+
+std::unique_ptr<ShaderInfo> ShaderAnalyser::GetShaderInfo(const uint8_t* shader, const size_t shaderSize)
+{
+    ShaderInfoView view;
+    if (!GetShaderInfoView(shader, shaderSize, view))
         return nullptr;
 
     auto shaderInfo = std::make_unique<ShaderInfo>();
+    shaderInfo->m_type = view.m_type;
+    shaderInfo->m_version_major = view.m_version_major;
+    shaderInfo->m_version_minor = view.m_version_minor;
+    shaderInfo->m_creator = view.m_creator;
+
+    const auto constantBufferCount = view.GetConstantBufferCount();
+    shaderInfo->m_constant_buffers.resize(constantBufferCount);
+    for (auto constantBufferIndex = 0u; constantBufferIndex < constantBufferCount; constantBufferIndex++)
+    {
+        const auto constantBufferView = view.GetConstantBuffer(constantBufferIndex);
+        auto& constantBuffer = shaderInfo->m_constant_buffers[constantBufferIndex];
 
-    if (!PopulateShaderInfoFromBytes(*shaderInfo, shader, shaderSize))
-        return nullptr;
+        constantBuffer.m_name = constantBufferView.m_name;
+        constantBuffer.m_size = constantBufferView.m_size;
+        constantBuffer.m_flags = constantBufferView.m_flags;
+        constantBuffer.m_type = constantBufferView.m_type;
+
+        const auto variableCount = constantBufferView.GetVariableCount();
+        constantBuffer.m_variables.resize(variableCount);
+        for (auto variableIndex = 0u; variableIndex < variableCount; variableIndex++)
+        {
+            const auto variableView = constantBufferView.GetVariable(variableIndex);
+            auto& variable = constantBuffer.m_variables[variableIndex];
+
+            variable.m_name = variableView.m_name;
+            variable.m_offset = variableView.m_offset;
+            variable.m_size = variableView.m_size;
+            variable.m_flags = variableView.m_flags;
+        }
+    }
+
+    const auto boundResourceCount = view.GetBoundResourceCount();
+    shaderInfo->m_bound_resources.resize(boundResourceCount);
+    for (auto boundResourceIndex = 0u; boundResourceIndex < boundResourceCount; boundResourceIndex++)
+    {
+        const auto boundResourceView = view.GetBoundResource(boundResourceIndex);
+        auto& boundResource = shaderInfo->m_bound_resources[boundResourceIndex];
+
+        boundResource.m_name = boundResourceView.m_name;
+        boundResource.m_type = boundResourceView.m_type;
+        boundResource.m_return_type = boundResourceView.m_return_type;
+        boundResource.m_dimension = boundResourceView.m_dimension;
+        boundResource.m_num_samples = boundResourceView.m_num_samples;
+        boundResource.m_bind_point = boundResourceView.m_bind_point;
+        boundResource.m_bind_count = boundResourceView.m_bind_count;
+        boundResource.m_flags = boundResourceView.m_flags;
+    }
 
     return shaderInfo;
 }
@@ -1,7 +1,12 @@
 #pragma once
 
+#include "Utils/ClassUtils.h"
+
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace d3d11
@@ -128,9 +133,92 @@ namespace d3d11
         std::vector<BoundResource> m_bound_resources;
     };
 
+    class ConstantBufferVariableView
+    {
+    public:
+        std::string_view m_name;
+        unsigned m_offset = 0;
+        unsigned m_size = 0;
+        unsigned m_flags = 0;
+    };
+
+    class ConstantBufferView
+    {
+        friend class ShaderInfoView;
+
+    public:
+        std::string_view m_name;
+        unsigned m_size = 0;
+        unsigned m_flags = 0;
+        ConstantBufferType m_type = ConstantBufferType::UNKNOWN;
+
+        _NODISCARD size_t GetVariableCount() const;
+        _NODISCARD ConstantBufferVariableView GetVariable(size_t index) const;
+
+    private:
+        const uint8_t* m_chunk = nullptr;
+        size_t m_chunk_size = 0;
+        const uint8_t* m_variables = nullptr;
+        size_t m_variable_count = 0;
+        size_t m_variable_stride = 0;
+    };
+
+    class BoundResourceView
+    {
+    public:
+        std::string_view m_name;
+        BoundResourceType m_type = BoundResourceType::UNKNOWN;
+        BoundResourceReturnType m_return_type = BoundResourceReturnType::UNKNOWN;
+        BoundResourceDimension m_dimension = BoundResourceDimension::UNKNOWN;
+        unsigned m_num_samples = 0;
+        unsigned m_bind_point = 0;
+        unsigned m_bind_count = 0;
+        unsigned m_flags = 0;
+    };
+
+    /**
+     * \brief The info of a shader that refers to its bytecode instead of copying names out of it.
+     * Reading it does not allocate. It is only valid for as long as the bytecode it was read from.
+     */
+    class ShaderInfoView
+    {
+        friend class ShaderAnalyser;
+
+    public:
+        ShaderType m_type = ShaderType::UNKNOWN;
+        unsigned m_version_major = 0;
+        unsigned m_version_minor = 0;
+        std::string_view m_creator;
+
+        _NODISCARD size_t GetConstantBufferCount() const;
+        _NODISCARD ConstantBufferView GetConstantBuffer(size_t index) const;
+        _NODISCARD size_t GetBoundResourceCount() const;
+        _NODISCARD BoundResourceView GetBoundResource(size_t index) const;
+
+    private:
+        const uint8_t* m_chunk = nullptr;
+        size_t m_chunk_size = 0;
+        unsigned m_target_version = 0;
+        const uint8_t* m_constant_buffers = nullptr;
+        size_t m_constant_buffer_count = 0;
+        const uint8_t* m_bound_resources = nullptr;
+        size_t m_bound_resource_count = 0;
+        size_t m_bound_resource_stride = 0;
+    };
+
     class ShaderAnalyser
     {
     public:
+        /**
+         * \brief Reads the info of a shader without copying anything out of its bytecode.
+         * The whole resource definition chunk is validated up front, so all parts of the view can be read without further checks.
+         * \param shader The bytecode of the shader.
+         * \param shaderSize The size of the bytecode in bytes.
+         * \param view The view to read the info into.
+         * \return \c true if the bytecode could be analysed, \c false otherwise.
+         */
+        static bool GetShaderInfoView(const uint8_t* shader, size_t shaderSize, ShaderInfoView& view);
+
         static std::unique_ptr<ShaderInfo> GetShaderInfo(const uint8_t* shader, size_t shaderSize);
     };
 } // namespace d3d11
@@ -61,7 +61,7 @@ namespace d3d9
         uint32_t TypeInfo;
     };
 
-    bool PopulateVersionInfo(ShaderInfo& shaderInfo, const uint32_t* shaderByteCode, const size_t shaderByteCodeSize)
+    bool PopulateVersionInfo(ShaderInfoView& shaderInfo, const uint32_t* shaderByteCode, const size_t shaderByteCodeSize)
     {
         if (shaderByteCodeSize < sizeof(uint32_t))
             return false;
@@ -125,24 +125,24 @@ namespace d3d9
         return false;
     }
 
-    bool StringFitsInComment(const char* str, const char* commentStart, const size_t commentSize)
+    bool ReadCommentString(std::string_view& str, const char* commentStart, const size_t commentSize, const uint32_t offset)
     {
-        const auto strLen = strnlen(str, commentSize - (str - commentStart));
-        return str[strLen] == '\0';
+        if (offset >= commentSize)
+            return false;
+
+        const auto* strStart = commentStart + offset;
+        const auto strLen = strnlen(strStart, commentSize - offset);
+        if (strLen >= commentSize - offset)
+            return false;
+
+        str = std::string_view(strStart, strLen);
+        return true;
     }
 
-    bool PopulateShaderConstantFromConstantInfo(ShaderConstant& shaderConstant,
-                                                const char* commentStart,
-                                                const size_t commentSize,
-                                                const ConstantInfo& constantInfo)
+    bool ReadShaderConstant(ShaderConstantView& shaderConstant, const char* commentStart, const size_t commentSize, const ConstantInfo& constantInfo)
     {
-        if (constantInfo.Name)
-        {
-            const auto* constantName = commentStart + constantInfo.Name;
-            if (!StringFitsInComment(constantName, commentStart, commentSize))
-                return false;
-            shaderConstant.m_name = std::string(constantName);
-        }
+        if (constantInfo.Name && !ReadCommentString(shaderConstant.m_name, commentStart, commentSize, constantInfo.Name))
+            return false;
 
         shaderConstant.m_register_set = static_cast<RegisterSet>(constantInfo.RegisterSet);
         if (shaderConstant.m_register_set >= RegisterSet::MAX)
@@ -153,8 +153,8 @@ namespace d3d9
 
         if (constantInfo.TypeInfo)
         {
-            assert(commentStart + constantInfo.TypeInfo + sizeof(TypeInfo) <= commentStart + commentSize);
-            if (commentStart + constantInfo.TypeInfo + sizeof(TypeInfo) > commentStart + commentSize)
+            assert(constantInfo.TypeInfo + sizeof(TypeInfo) <= commentSize);
+            if (constantInfo.TypeInfo + sizeof(TypeInfo) > commentSize)
                 return false;
 
             const auto* typeInfo = reinterpret_cast<const TypeInfo*>(commentStart + constantInfo.TypeInfo);
@@ -175,76 +175,115 @@ namespace d3d9
         return true;
     }
 
-    bool PopulateShaderInfoFromConstantTable(ShaderInfo& shaderInfo, const char* commentStart, const size_t commentSize, const ConstantTable& constantTable)
+    bool ReadConstantTable(ShaderInfoView& shaderInfo, const char* commentStart, const size_t commentSize, size_t& constantCount)
     {
+        const auto& constantTable = *reinterpret_cast<const ConstantTable*>(commentStart);
         if (constantTable.Size != sizeof(ConstantTable))
             return false;
 
-        if (constantTable.Creator)
-        {
-            const auto* creatorName = commentStart + constantTable.Creator;
-            if (!StringFitsInComment(creatorName, commentStart, commentSize))
-                return false;
-            shaderInfo.m_creator = std::string(creatorName);
-        }
+        if (constantTable.Creator && !ReadCommentString(shaderInfo.m_creator, commentStart, commentSize, constantTable.Creator))
+            return false;
 
-        if (constantTable.Target)
-        {
-            const auto* targetName = commentStart + constantTable.Target;
-            if (!StringFitsInComment(targetName, commentStart, commentSize))
-                return false;
-            shaderInfo.m_target = std::string(targetName);
-        }
+        if (constantTable.Target && !ReadCommentString(shaderInfo.m_target, commentStart, commentSize, constantTable.Target))
+            return false;
 
+        constantCount = 0;
         if (constantTable.Constants > 0 && constantTable.ConstantInfo)
         {
-            assert(commentStart + constantTable.ConstantInfo + sizeof(ConstantInfo) * constantTable.Constants <= commentStart + commentSize);
-            if (commentStart + constantTable.ConstantInfo + sizeof(ConstantInfo) * constantTable.Constants > commentStart + commentSize)
+            assert(constantTable.ConstantInfo + sizeof(ConstantInfo) * constantTable.Constants <= commentSize);
+            if (constantTable.ConstantInfo + sizeof(ConstantInfo) * constantTable.Constants > commentSize)
                 return false;
 
+            // Validate all constants once for reading them from the view later on to not need any checks
             const auto* constantInfos = reinterpret_cast<const ConstantInfo*>(commentStart + constantTable.ConstantInfo);
             for (auto constantInfoIndex = 0u; constantInfoIndex < constantTable.Constants; constantInfoIndex++)
             {
-                ShaderConstant constant;
-                if (!PopulateShaderConstantFromConstantInfo(constant, commentStart, commentSize, constantInfos[constantInfoIndex]))
+                ShaderConstantView constant;
+                if (!ReadShaderConstant(constant, commentStart, commentSize, constantInfos[constantInfoIndex]))
                     return false;
-                shaderInfo.m_constants.emplace_back(std::move(constant));
             }
+
+            constantCount = constantTable.Constants;
         }
 
         return true;
     }
+} // namespace d3d9
 
-    bool PopulateShaderInfoFromShaderByteCode(ShaderInfo& shaderInfo, const uint32_t* shaderByteCode, const size_t shaderByteCodeSize)
-    {
-        if (!PopulateVersionInfo(shaderInfo, shaderByteCode, shaderByteCodeSize))
-            return false;
+size_t ShaderInfoView::GetConstantCount() const
+{
+    return m_constant_count;
+}
 
-        const char* constantTableComment;
-        size_t constantTableCommentSize;
-        if (!FindComment(shaderByteCode, shaderByteCodeSize, FileUtils::MakeMagic32('C', 'T', 'A', 'B'), constantTableComment, constantTableCommentSize))
-            return false;
+ShaderConstantView ShaderInfoView::GetConstant(const size_t index) const
+{
+    assert(index < m_constant_count);
 
-        if (constantTableCommentSize < sizeof(ConstantTable))
-            return false;
+    const auto& constantTable = *reinterpret_cast<const ConstantTable*>(m_constant_table);
+    const auto* constantInfos = reinterpret_cast<const ConstantInfo*>(m_constant_table + constantTable.ConstantInfo);
 
-        const auto* constantTable = reinterpret_cast<const ConstantTable*>(constantTableComment);
-        if (!PopulateShaderInfoFromConstantTable(shaderInfo, constantTableComment, constantTableCommentSize, *constantTable))
-            return false;
+    ShaderConstantView constant;
+    ReadShaderConstant(constant, m_constant_table, m_constant_table_size, constantInfos[index]);
 
-        return true;
-    }
-} // namespace d3d9
+    return constant;
+}
 
-std::unique_ptr<ShaderInfo> ShaderAnalyser::GetShaderInfo(const uint32_t* shaderByteCode, const size_t shaderByteCodeSize)
+bool ShaderAnalyser::GetShaderInfoView(const uint32_t* shaderByteCode, const size_t shaderByteCodeSize, ShaderInfoView& view)
 {
+    view = ShaderInfoView();
     if (shaderByteCode == nullptr || shaderByteCodeSize == 0)
-        return nullptr;
+        return false;
 
-    auto shaderInfo = std::make_unique<ShaderInfo>();
+    if (!PopulateVersionInfo(view, shaderByteCode, shaderByteCodeSize))
+        return false;
 
-    if (!PopulateShaderInfoFromShaderByteCode(*shaderInfo, shaderByteCode, shaderByteCodeSize))
+    const char* constantTableComment;
+    size_t constantTableCommentSize;
+    if (!FindComment(shaderByteCode, shaderByteCodeSize, FileUtils::MakeMagic32('C', 'T', 'A', 'B'), constantTableComment, constantTableCommentSize))
+        return false;
+
+    if (constantTableCommentSize < sizeof(ConstantTable))
+        return false;
+
+    if (!ReadConstantTable(view, constantTableComment, constantTableCommentSize, view.m_constant_count))
+        return false;
+
+    view.m_constant_table = constantTableComment;
+    view.m_constant_table_size = constantTableCommentSize;
+
+    return true;
+}
+
+std::unique_ptr<ShaderInfo> ShaderAnalyser::GetShaderInfo(const uint32_t* shaderByteCode, const size_t shaderByteCodeSize)
+{
+    ShaderInfoView view;
+    if (!GetShaderInfoView(shaderByteCode, shaderByteCodeSize, view))
         return nullptr;
 
+    auto shaderInfo = std::make_unique<ShaderInfo>();
+    shaderInfo->m_type = view.m_type;
+    shaderInfo->m_version_major = view.m_version_major;
+    shaderInfo->m_version_minor = view.m_version_minor;
+    shaderInfo->m_creator = view.m_creator;
+    shaderInfo->m_target = view.m_target;
+
+    const auto constantCount = view.GetConstantCount();
+    shaderInfo->m_constants.resize(constantCount);
+    for (auto constantIndex = 0u; constantIndex < constantCount; constantIndex++)
+    {
+        const auto constantView = view.GetConstant(constantIndex);
+        auto& constant = shaderInfo->m_constants[constantIndex];
+
+        constant.m_name = constantView.m_name;
+        constant.m_register_set = constantView.m_register_set;
+        constant.m_register_index = constantView.m_register_index;
+        constant.m_register_count = constantView.m_register_count;
+        constant.m_class = constantView.m_class;
+        constant.m_type = constantView.m_type;
+        constant.m_type_rows = constantView.m_type_rows;
+        constant.m_type_columns = constantView.m_type_columns;
+        constant.m_type_elements = constantView.m_type_elements;
+    }
+
     return shaderInfo;
 }
@@ -1,7 +1,12 @@
 #pragma once
 
+#include "Utils/ClassUtils.h"
+
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace d3d9
@@ -92,9 +97,57 @@ namespace d3d9
         std::vector<ShaderConstant> m_constants;
     };
 
+    class ShaderConstantView
+    {
+    public:
+        std::string_view m_name;
+        RegisterSet m_register_set{};
+        unsigned m_register_index = 0;
+        unsigned m_register_count = 0;
+        ParameterClass m_class{};
+        ParameterType m_type{};
+        unsigned m_type_rows = 0;
+        unsigned m_type_columns = 0;
+        unsigned m_type_elements = 0;
+    };
+
+    /**
+     * \brief The info of a shader that refers to its bytecode instead of copying names out of it.
+     * Reading it does not allocate. It is only valid for as long as the bytecode it was read from.
+     */
+    class ShaderInfoView
+    {
+        friend class ShaderAnalyser;
+
+    public:
+        ShaderType m_type = ShaderType::UNKNOWN;
+        unsigned m_version_major = 0;
+        unsigned m_version_minor = 0;
+        std::string_view m_creator;
+        std::string_view m_target;
+
+        _NODISCARD size_t GetConstantCount() const;
+        _NODISCARD ShaderConstantView GetConstant(size_t index) const;
+
+    private:
+        const char* m_constant_table = nullptr;
+        size_t m_constant_table_size = 0;
+        size_t m_constant_count = 0;
+    };
+
     class ShaderAnalyser
     {
     public:
+        /**
+         * \brief Reads the info of a shader without copying anything out of its bytecode.
+         * The whole constant table is validated up front, so all constants of the view can be read without further checks.
+         * \param shaderByteCode The bytecode of the shader.
+         * \param shaderByteCodeSize The size of the bytecode in bytes.
+         * \param view The view to read the info into.
+         * \return \c true if the bytecode could be analysed, \c false otherwise.
+         */
+        static bool GetShaderInfoView(const uint32_t* shaderByteCode, size_t shaderByteCodeSize, ShaderInfoView& view);
+
         static std::unique_ptr<ShaderInfo> GetShaderInfo(const uint32_t* shaderByteCode, size_t shaderByteCodeSize);
     };
 } // namespace d3d9
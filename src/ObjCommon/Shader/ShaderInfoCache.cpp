@@ -0,0 +1,377 @@
+#include "ShaderInfoCache.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+
+namespace fs = std::filesystem;
+
+ShaderInfoCache ShaderInfoCache::Instance;
+
+namespace
+{
+    constexpr char CACHE_FILE_MAGIC[]{'O', 'A', 'T', 'S', 'H', 'D', 'R', 'C'};
+    constexpr uint32_t CACHE_FILE_VERSION = 1u;
+
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325u;
+    constexpr uint64_t FNV_PRIME = 0x100000001B3u;
+
+    class CacheWriter
+    {
+    public:
+        explicit CacheWriter(std::ostream& stream)
+            : m_stream(stream)
+        {
+        }
+
+        template<typename T> void Write(const T value)
+        {
+            if constexpr (std::is_enum_v<T>)
+            {
+                Write(static_cast<uint32_t>(value));
+            }
+            else
+            {
+                static_assert(std::is_arithmetic_v<T>);
+                m_stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+        }
+
+        void Write(const std::string& value)
+        {
+            Write(static_cast<uint32_t>(value.size()));
+            m_stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+        }
+
+        void Write(const d3d9::ShaderInfo& shaderInfo)
+        {
+            Write(shaderInfo.m_type);
+            Write(shaderInfo.m_version_major);
+            Write(shaderInfo.m_version_minor);
+            Write(shaderInfo.m_creator);
+            Write(shaderInfo.m_target);
+
+            Write(static_cast<uint32_t>(shaderInfo.m_constants.size()));
+            for (const auto& constant : shaderInfo.m_constants)
+            {
+                Write(constant.m_name);
+                Write(constant.m_register_set);
+                Write(constant.m_register_index);
+                Write(constant.m_register_count);
+                Write(constant.m_class);
+                Write(constant.m_type);
+                Write(constant.m_type_rows);
+                Write(constant.m_type_columns);
+                Write(constant.m_type_elements);
+            }
+        }
+
+        void Write(const d3d11::ShaderInfo& shaderInfo)
+        {
+            Write(shaderInfo.m_type);
+            Write(shaderInfo.m_version_major);
+            Write(shaderInfo.m_version_minor);
+            Write(shaderInfo.m_creator);
+
+            Write(static_cast<uint32_t>(shaderInfo.m_constant_buffers.size()));
+            for (const auto& constantBuffer : shaderInfo.m_constant_buffers)
+            {
+                Write(constantBuffer.m_name);
+                Write(constantBuffer.m_size);
+                Write(constantBuffer.m_flags);
+                Write(constantBuffer.m_type);
+
+                Write(static_cast<uint32_t>(constantBuffer.m_variables.size()));
+                for (const auto& variable : constantBuffer.m_variables)
+                {
+                    Write(variable.m_name);
+                    Write(variable.m_offset);
+                    Write(variable.m_size);
+                    Write(variable.m_flags);
+                }
+            }
+
+            Write(static_cast<uint32_t>(shaderInfo.m_bound_resources.size()));
+            for (const auto& boundResource : shaderInfo.m_bound_resources)
+            {
+                Write(boundResource.m_name);
+                Write(boundResource.m_type);
+                Write(boundResource.m_return_type);
+                Write(boundResource.m_dimension);
+                Write(boundResource.m_num_samples);
+                Write(boundResource.m_bind_point);
+                Write(boundResource.m_bind_count);
+                Write(boundResource.m_flags);
+            }
+        }
+
+    private:
+        std::ostream& m_stream;
+    };
+
+    class CacheReader
+    {
+    public:
+        explicit CacheReader(std::istream& stream)
+            : m_stream(stream)
+        {
+        }
+
+        _NODISCARD bool Ok() const
+        {
+            return !m_stream.fail();
+        }
+
+        template<typename T> void Read(T& value)
+        {
+            if constexpr (std::is_enum_v<T>)
+            {
+                uint32_t enumValue = 0;
+                Read(enumValue);
+                value = static_cast<T>(enumValue);
+            }
+            else
+            {
+                static_assert(std::is_arithmetic_v<T>);
+                m_stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+            }
+        }
+
+        void Read(std::string& value)
+        {
+            uint32_t size = 0;
+            Read(size);
+
+            // Sizes of corrupted files must not cause huge allocations
+            value.clear();
+            while (Ok() && value.size() < size)
+            {
+                char buffer[256];
+                const auto readSize = std::min<size_t>(size - value.size(), sizeof(buffer));
+                m_stream.read(buffer, static_cast<std::streamsize>(readSize));
+                value.append(buffer, static_cast<size_t>(m_stream.gcount()));
+            }
+        }
+
+        void Read(d3d9::ShaderInfo& shaderInfo)
+        {
+            Read(shaderInfo.m_type);
+            Read(shaderInfo.m_version_major);
+            Read(shaderInfo.m_version_minor);
+            Read(shaderInfo.m_creator);
+            Read(shaderInfo.m_target);
+
+            uint32_t constantCount = 0;
+            Read(constantCount);
+            for (auto i = 0u; i < constantCount && Ok(); i++)
+            {
+                auto& constant = shaderInfo.m_constants.emplace_back();
+                Read(constant.m_name);
+                Read(constant.m_register_set);
+                Read(constant.m_register_index);
+                Read(constant.m_register_count);
+                Read(constant.m_class);
+                Read(constant.m_type);
+                Read(constant.m_type_rows);
+                Read(constant.m_type_columns);
+                Read(constant.m_type_elements);
+            }
+        }
+
+        void Read(d3d11::ShaderInfo& shaderInfo)
+        {
+            Read(shaderInfo.m_type);
+            Read(shaderInfo.m_version_major);
+            Read(shaderInfo.m_version_minor);
+            Read(shaderInfo.m_creator);
+
+            uint32_t constantBufferCount = 0;
+            Read(constantBufferCount);
+            for (auto i = 0u; i < constantBufferCount && Ok(); i++)
+            {
+                auto& constantBuffer = shaderInfo.m_constant_buffers.emplace_back();
+                Read(constantBuffer.m_name);
+                Read(constantBuffer.m_size);
+                Read(constantBuffer.m_flags);
+                Read(constantBuffer.m_type);
+
+                uint32_t variableCount = 0;
+                Read(variableCount);
+                for (auto j = 0u; j < variableCount && Ok(); j++)
+                {
+                    auto& variable = constantBuffer.m_variables.emplace_back();
+                    Read(variable.m_name);
+                    Read(variable.m_offset);
+                    Read(variable.m_size);
+                    Read(variable.m_flags);
+                }
+            }
+
+            uint32_t boundResourceCount = 0;
+            Read(boundResourceCount);
+            for (auto i = 0u; i < boundResourceCount && Ok(); i++)
+            {
+                auto& boundResource = shaderInfo.m_bound_resources.emplace_back();
+                Read(boundResource.m_name);
+                Read(boundResource.m_type);
+                Read(boundResource.m_return_type);
+                Read(boundResource.m_dimension);
+                Read(boundResource.m_num_samples);
+                Read(boundResource.m_bind_point);
+                Read(boundResource.m_bind_count);
+                Read(boundResource.m_flags);
+            }
+        }
+
+    private:
+        std::istream& m_stream;
+    };
+
+    template<typename TMap> void WriteShaderInfos(CacheWriter& writer, const TMap& shaderInfos)
+    {
+        writer.Write(static_cast<uint32_t>(shaderInfos.size()));
+        for (const auto& [key, shaderInfo] : shaderInfos)
+        {
+            writer.Write(key.m_hash);
+            writer.Write(static_cast<uint64_t>(key.m_size));
+            writer.Write(*shaderInfo);
+        }
+    }
+
+    template<typename TShaderInfo, typename TKey, typename TMap> bool ReadShaderInfos(CacheReader& reader, TMap& shaderInfos)
+    {
+        uint32_t count = 0;
+        reader.Read(count);
+        for (auto i = 0u; i < count && reader.Ok(); i++)
+        {
+            uint64_t hash = 0;
+            uint64_t size = 0;
+            auto shaderInfo = std::make_shared<TShaderInfo>();
+            reader.Read(hash);
+            reader.Read(size);
+            reader.Read(*shaderInfo);
+
+            if (reader.Ok())
+                shaderInfos.try_emplace(TKey{hash, static_cast<size_t>(size)}, std::move(shaderInfo));
+        }
+
+        return reader.Ok();
+    }
+} // namespace
+
+size_t ShaderInfoCache::KeyHasher::operator()(const Key& key) const noexcept
+{
+    return static_cast<size_t>(key.m_hash ^ key.m_size);
+}
+
+ShaderInfoCache::ShaderInfoCache()
+    : m_modified(false)
+{
+}
+
+ShaderInfoCache::Key ShaderInfoCache::CreateKey(const void* shaderByteCode, const size_t shaderByteCodeSize)
+{
+    const auto* bytes = static_cast<const uint8_t*>(shaderByteCode);
+
+    auto hash = FNV_OFFSET_BASIS;
+    for (auto i = 0u; i < shaderByteCodeSize; i++)
+    {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+
+    return Key{hash, shaderByteCodeSize};
+}
+
+std::shared_ptr<const d3d9::ShaderInfo> ShaderInfoCache::GetShaderInfo(const uint32_t* shaderByteCode, const size_t shaderByteCodeSize)
+{
+    if (shaderByteCode == nullptr || shaderByteCodeSize == 0)
+        return nullptr;
+
+    const auto key = CreateKey(shaderByteCode, shaderByteCodeSize);
+    {
+        std::lock_guard lock(m_mutex);
+        const auto existingShaderInfo = m_d3d9_shader_infos.find(key);
+        if (existingShaderInfo != m_d3d9_shader_infos.end())
+            return existingShaderInfo->second;
+    }
+
+    // Shaders are analysed without holding the lock for other threads to not wait on it
+    std::shared_ptr<const d3d9::ShaderInfo> shaderInfo = d3d9::ShaderAnalyser::GetShaderInfo(shaderByteCode, shaderByteCodeSize);
+    if (!shaderInfo)
+        return nullptr;
+
+    std::lock_guard lock(m_mutex);
+    m_modified = true;
+    return m_d3d9_shader_infos.try_emplace(key, std::move(shaderInfo)).first->second;
+}
+
+std::shared_ptr<const d3d11::ShaderInfo> ShaderInfoCache::GetShaderInfo(const uint8_t* shader, const size_t shaderSize)
+{
+    if (shader == nullptr || shaderSize == 0)
+        return nullptr;
+
+    const auto key = CreateKey(shader, shaderSize);
+    {
+        std::lock_guard lock(m_mutex);
+        const auto existingShaderInfo = m_d3d11_shader_infos.find(key);
+        if (existingShaderInfo != m_d3d11_shader_infos.end())
+            return existingShaderInfo->second;
+    }
+
+    std::shared_ptr<const d3d11::ShaderInfo> shaderInfo = d3d11::ShaderAnalyser::GetShaderInfo(shader, shaderSize);
+    if (!shaderInfo)
+        return nullptr;
+
+    std::lock_guard lock(m_mutex);
+    m_modified = true;
+    return m_d3d11_shader_infos.try_emplace(key, std::move(shaderInfo)).first->second;
+}
+
+bool ShaderInfoCache::Load(const std::string& path)
+{
+    std::ifstream stream(path, std::fstream::in | std::fstream::binary);
+    if (!stream.is_open())
+        return false;
+
+    char magic[sizeof(CACHE_FILE_MAGIC)];
+    uint32_t version = 0;
+    stream.read(magic, sizeof(magic));
+    stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (stream.fail() || !std::equal(std::begin(magic), std::end(magic), std::begin(CACHE_FILE_MAGIC)) || version != CACHE_FILE_VERSION)
+        return false;
+
+    std::lock_guard lock(m_mutex);
+    CacheReader reader(stream);
+    return ReadShaderInfos<d3d9::ShaderInfo, Key>(reader, m_d3d9_shader_infos) && ReadShaderInfos<d3d11::ShaderInfo, Key>(reader, m_d3d11_shader_infos);
+}
+
+bool ShaderInfoCache::Save(const std::string& path)
+{
+    std::lock_guard lock(m_mutex);
+    if (!m_modified)
+        return true;
+
+    std::error_code ec;
+    const auto parentPath = fs::path(path).parent_path();
+    if (!parentPath.empty())
+        fs::create_directories(parentPath, ec);
+
+    std::ofstream stream(path, std::fstream::out | std::fstream::binary | std::fstream::trunc);
+    if (!stream.is_open())
+        return false;
+
+    stream.write(CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC));
+    stream.write(reinterpret_cast<const char*>(&CACHE_FILE_VERSION), sizeof(CACHE_FILE_VERSION));
+
+    CacheWriter writer(stream);
+    WriteShaderInfos(writer, m_d3d9_shader_infos);
+    WriteShaderInfos(writer, m_d3d11_shader_infos);
+
+    if (!stream.good())
+        return false;
+
+    m_modified = false;
+    return true;
+}
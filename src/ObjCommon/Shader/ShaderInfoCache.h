@@ -0,0 +1,81 @@
+#pragma once
+
+#include "D3D11ShaderAnalyser.h"
+#include "D3D9ShaderAnalyser.h"
+#include "Utils/ClassUtils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * \brief Caches the results of analysing shader bytecode for the whole session, keyed by a hash of the bytecode.
+ * Can be used from multiple threads at once and can be saved to disk to skip analysing the same shaders in later runs.
+ */
+class ShaderInfoCache
+{
+    class Key
+    {
+    public:
+        uint64_t m_hash;
+        size_t m_size;
+
+        friend bool operator==(const Key& lhs, const Key& rhs) = default;
+    };
+
+    class KeyHasher
+    {
+    public:
+        size_t operator()(const Key& key) const noexcept;
+    };
+
+    std::unordered_map<Key, std::shared_ptr<const d3d9::ShaderInfo>, KeyHasher> m_d3d9_shader_infos;
+    std::unordered_map<Key, std::shared_ptr<const d3d11::ShaderInfo>, KeyHasher> m_d3d11_shader_infos;
+    bool m_modified;
+    std::mutex m_mutex;
+
+    static Key CreateKey(const void* shaderByteCode, size_t shaderByteCodeSize);
+
+public:
+    static ShaderInfoCache Instance;
+
+    ShaderInfoCache();
+    ~ShaderInfoCache() = default;
+    ShaderInfoCache(const ShaderInfoCache& other) = delete;
+    ShaderInfoCache(ShaderInfoCache&& other) noexcept = delete;
+    ShaderInfoCache& operator=(const ShaderInfoCache& other) = delete;
+    ShaderInfoCache& operator=(ShaderInfoCache&& other) noexcept = delete;
+
+    /**
+     * \brief Returns the info of a d3d9 shader, only analysing its bytecode if the same bytecode was not analysed before.
+     * \param shaderByteCode The bytecode of the shader.
+     * \param shaderByteCodeSize The size of the bytecode in bytes.
+     * \return The info of the shader or \c nullptr if the bytecode could not be analysed.
+     */
+    _NODISCARD std::shared_ptr<const d3d9::ShaderInfo> GetShaderInfo(const uint32_t* shaderByteCode, size_t shaderByteCodeSize);
+
+    /**
+     * \brief Returns the info of a d3d11 shader, only analysing its bytecode if the same bytecode was not analysed before.
+     * \param shader The bytecode of the shader.
+     * \param shaderSize The size of the bytecode in bytes.
+     * \return The info of the shader or \c nullptr if the bytecode could not be analysed.
+     */
+    _NODISCARD std::shared_ptr<const d3d11::ShaderInfo> GetShaderInfo(const uint8_t* shader, size_t shaderSize);
+
+    /**
+     * \brief Adds the shader infos of a cache file that was saved by a previous run.
+     * \param path The path of the cache file.
+     * \return \c true if the file exists and could be read completely, \c false otherwise. Entries before a read error are kept.
+     */
+    bool Load(const std::string& path);
+
+    /**
+     * \brief Saves all cached shader infos to a file if any shader was analysed since creating or loading the cache.
+     * \param path The path of the cache file.
+     * \return \c true if the file is up to date, \c false if it could not be written.
+     */
+    bool Save(const std::string& path);
+};
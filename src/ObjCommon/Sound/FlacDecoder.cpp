@@ -2,12 +2,14 @@
 
 #include "Utils/Alignment.h"
 #include "Utils/ClassUtils.h"
-#include "Utils/Endianness.h"
 #include "Utils/FileUtils.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstring>
 #include <iostream>
-#include <sstream>
+#include <optional>
 
 namespace
 {
@@ -31,7 +33,8 @@ namespace
         uint32_t blockLength;
     };
 
-    constexpr auto STREAM_INFO_BLOCK_SIZE = 34;
+    constexpr auto METADATA_BLOCK_HEADER_SIZE = 4u;
+    constexpr auto STREAM_INFO_BLOCK_SIZE = 34u;
 
     class FlacReadingException final : public std::exception
     {
@@ -50,120 +53,244 @@ namespace
         std::string m_message;
     };
 
+    /**
+     * \brief Reads bits from flac data in memory, starting with the most significant bit of each byte.
+     */
     class FlacBitReader
     {
     public:
-        explicit FlacBitReader(std::istream& stream)
-            : m_stream(stream),
-              m_last_byte(0u),
-              m_remaining_bits_last_byte(0u)
+        FlacBitReader(const void* data, const size_t dataSize)
+            : m_data(static_cast<const uint8_t*>(data)),
+              m_data_size(dataSize),
+              m_bit_offset(0u)
         {
         }
 
         template<typename T> T ReadBits(const size_t bitCount)
         {
-            union
+            assert(bitCount <= sizeof(T) * 8u);
+            if (bitCount > m_data_size * 8u - m_bit_offset)
+                throw FlacReadingException("Unexpected eof");
+
+            uint64_t result = 0u;
+            auto remainingBits = bitCount;
+            while (remainingBits > 0u)
             {
-                uint8_t buffer[sizeof(T)];
-                T result;
-            } data{};
+                const auto bitOffsetInByte = m_bit_offset % 8u;
+                const auto curBits = std::min(8u - bitOffsetInByte, remainingBits);
+                const auto byteValue = static_cast<unsigned>(m_data[m_bit_offset / 8u]);
+                const auto bits = (byteValue >> (8u - bitOffsetInByte - curBits)) & ((1u << curBits) - 1u);
 
-            const auto byteCount = utils::Align(bitCount, 8u) / 8u;
-            assert(byteCount <= sizeof(T));
+                result = result << curBits | bits;
+                remainingBits -= curBits;
+                m_bit_offset += curBits;
+            }
 
-            const auto shiftCount = (8u - bitCount % 8) % 8;
+            return static_cast<T>(result);
+        }
 
-            auto remainingBits = bitCount;
+        void ReadBuffer(void* buffer, const size_t bitCount)
+        {
+            assert(m_bit_offset % 8u == 0u);
+            assert(bitCount % 8u == 0u);
 
-#if HOST_ENDIANNESS == LITTLE_ENDIAN_ENDIANNESS
-            auto offset = byteCount - 1;
-#else
-            auto offset = 0u;
-#endif
+            if (bitCount > m_data_size * 8u - m_bit_offset)
+                throw FlacReadingException("Unexpected eof");
 
-            while (remainingBits > 0)
-            {
-                const auto curBits = static_cast<uint8_t>(std::min(remainingBits, 8u));
+            std::memcpy(buffer, &m_data[m_bit_offset / 8u], bitCount / 8u);
+            m_bit_offset += bitCount;
+        }
 
-                if (m_remaining_bits_last_byte > 0)
-                {
-                    if (m_remaining_bits_last_byte < curBits)
-                    {
-                        const auto bitsFromFirstByte = m_remaining_bits_last_byte;
-                        data.buffer[offset] = static_cast<uint8_t>(m_last_byte << (8u - bitsFromFirstByte));
-
-                        m_stream.read(reinterpret_cast<char*>(&m_last_byte), sizeof(m_last_byte));
-                        if (m_stream.gcount() != sizeof(m_last_byte))
-                            throw FlacReadingException("Unexpected eof");
-
-                        const auto bitsFromSecondByte = static_cast<uint8_t>(curBits - m_remaining_bits_last_byte);
-                        m_remaining_bits_last_byte = 8u - bitsFromSecondByte;
-                        const auto maskForSecondByte = static_cast<uint8_t>(0xFF << (8u - bitsFromSecondByte));
-                        data.buffer[offset] |= (m_last_byte & maskForSecondByte) >> bitsFromFirstByte;
-                    }
-                    else if (m_remaining_bits_last_byte == curBits)
-                    {
-                        data.buffer[offset] = static_cast<uint8_t>(m_last_byte << (8u - curBits));
-                        m_remaining_bits_last_byte = 0u;
-                    }
-                    else // m_remaining_bits_last_byte > curBits
-                    {
-                        const auto maskForCurBits = 0xFF >> (8u - curBits);
-                        const auto maskForCurBitsInRemainingBits = static_cast<uint8_t>(maskForCurBits << (m_remaining_bits_last_byte - curBits));
-                        const auto selectedData = static_cast<uint8_t>(m_last_byte & maskForCurBitsInRemainingBits);
-                        data.buffer[offset] = static_cast<uint8_t>(selectedData << (8u - m_remaining_bits_last_byte));
-                        m_remaining_bits_last_byte -= curBits;
-                    }
-                }
-                else if (curBits >= 8u)
-                {
-                    m_stream.read(reinterpret_cast<char*>(&data.buffer[offset]), sizeof(uint8_t));
-                    if (m_stream.gcount() != sizeof(uint8_t))
-                        throw FlacReadingException("Unexpected eof");
-                }
-                else
-                {
-                    m_stream.read(reinterpret_cast<char*>(&m_last_byte), sizeof(m_last_byte));
-                    if (m_stream.gcount() != sizeof(m_last_byte))
-                        throw FlacReadingException("Unexpected eof");
+        void Seek(const size_t bitCount)
+        {
+            assert(m_bit_offset % 8u == 0u);
 
-                    data.buffer[offset] = m_last_byte & (0xFF << (8u - curBits));
-                    m_remaining_bits_last_byte = static_cast<uint8_t>(8u - curBits);
-                }
+            if (bitCount > m_data_size * 8u - m_bit_offset)
+                throw FlacReadingException("Unexpected eof");
 
-                remainingBits -= curBits;
-#if HOST_ENDIANNESS == LITTLE_ENDIAN_ENDIANNESS
-                --offset;
-#else
-                ++offset;
-#endif
+            m_bit_offset += bitCount;
+        }
+
+        _NODISCARD size_t GetByteOffset() const
+        {
+            return utils::Align(m_bit_offset, static_cast<size_t>(8u)) / 8u;
+        }
+
+    private:
+        const uint8_t* m_data;
+        size_t m_data_size;
+        size_t m_bit_offset;
+    };
+
+    template<typename T, T Polynomial> constexpr std::array<T, 256> MakeCrcTable()
+    {
+        std::array<T, 256> table{};
+        for (auto i = 0u; i < table.size(); i++)
+        {
+            auto crc = static_cast<T>(i << (sizeof(T) * 8u - 8u));
+            for (auto bit = 0u; bit < 8u; bit++)
+            {
+                constexpr auto topBit = static_cast<T>(1u << (sizeof(T) * 8u - 1u));
+                crc = static_cast<T>((crc & topBit) ? (crc << 1u) ^ Polynomial : crc << 1u);
             }
 
-            data.result >>= shiftCount;
-            return data.result;
+            table[i] = crc;
         }
 
-        void ReadBuffer(void* buffer, const size_t bitCount)
+        return table;
+    }
+
+    constexpr auto CRC8_TABLE = MakeCrcTable<uint8_t, 0x07>();
+    constexpr auto CRC16_TABLE = MakeCrcTable<uint16_t, 0x8005>();
+
+    uint8_t UpdateCrc8(const uint8_t crc, const uint8_t value)
+    {
+        return CRC8_TABLE[crc ^ value];
+    }
+
+    uint16_t UpdateCrc16(const uint16_t crc, const uint8_t value)
+    {
+        return static_cast<uint16_t>(crc << 8u) ^ CRC16_TABLE[(crc >> 8u) ^ value];
+    }
+
+    MetaDataBlockHeader ReadMetaDataBlockHeader(FlacBitReader& reader)
+    {
+        return MetaDataBlockHeader{
+            reader.ReadBits<uint8_t>(1),
+            static_cast<MetaDataBlockType>(reader.ReadBits<uint8_t>(7)),
+            reader.ReadBits<uint32_t>(24),
+        };
+    }
+
+    void ReadStreamInfo(FlacBitReader& reader, flac::FlacMetaData& metaData)
+    {
+        metaData.m_minimum_block_size = reader.ReadBits<uint16_t>(16);
+        metaData.m_maximum_block_size = reader.ReadBits<uint16_t>(16);
+        metaData.m_minimum_frame_size = reader.ReadBits<uint32_t>(24);
+        metaData.m_maximum_frame_size = reader.ReadBits<uint32_t>(24);
+        metaData.m_sample_rate = reader.ReadBits<uint32_t>(20);
+        metaData.m_number_of_channels = static_cast<uint8_t>(reader.ReadBits<uint8_t>(3) + 1);
+        metaData.m_bits_per_sample = static_cast<uint8_t>(reader.ReadBits<uint8_t>(5) + 1);
+        metaData.m_total_samples = reader.ReadBits<uint64_t>(36);
+        reader.ReadBuffer(metaData.m_md5_signature, 128);
+    }
+
+    void VerifyMagic(const uint32_t magic)
+    {
+        if (magic != FLAC_MAGIC)
+            throw FlacReadingException("Invalid flac magic");
+    }
+
+    /**
+     * \brief Reads the metadata blocks of flac data in memory.
+     * \param untilFirstFrame Whether to read all metadata blocks to find the first frame instead of stopping at the stream info.
+     * \return The offset after the last read metadata block.
+     */
+    size_t ReadMetaDataBlocks(const void* data, const size_t dataSize, flac::FlacMetaData& metaData, const bool untilFirstFrame)
+    {
+        FlacBitReader reader(data, dataSize);
+        uint32_t magic;
+        reader.ReadBuffer(&magic, sizeof(magic) * 8u);
+        VerifyMagic(magic);
+
+        auto foundStreamInfo = false;
+        while (true)
         {
-            assert(m_remaining_bits_last_byte == 0);
-            assert(bitCount % 8 == 0);
+            const auto header = ReadMetaDataBlockHeader(reader);
+
+            if (header.blockType == MetaDataBlockType::STREAMINFO)
+            {
+                if (header.blockLength != STREAM_INFO_BLOCK_SIZE)
+                    throw FlacReadingException("Flac stream info block size invalid");
+
+                ReadStreamInfo(reader, metaData);
+                foundStreamInfo = true;
 
-            m_remaining_bits_last_byte = 0;
-            m_stream.read(static_cast<char*>(buffer), bitCount / 8);
+                if (!untilFirstFrame)
+                    break;
+            }
+            else
+                reader.Seek(header.blockLength * 8u);
+
+            if (header.isLastMetaDataBlock)
+                break;
         }
 
-        void Seek(const size_t offset)
+        if (!foundStreamInfo)
+            throw FlacReadingException("Missing flac stream info block");
+
+        return reader.GetByteOffset();
+    }
+
+    /**
+     * \brief Parses a frame header to check whether a frame starts at the specified offset.
+     * \return The amount of samples per channel in the frame or \c std::nullopt if there is no valid frame header at the offset.
+     */
+    std::optional<uint32_t> ReadFrameHeader(const uint8_t* data, const size_t dataSize, const size_t offset)
+    {
+        // Sync code, a reserved bit and the blocking strategy, block size and sample rate, channels and sample size, at least one byte frame number, crc
+        constexpr auto minimumHeaderSize = 6u;
+        if (dataSize - offset < minimumHeaderSize)
+            return std::nullopt;
+
+        const auto* header = &data[offset];
+        if (header[0] != 0xFF || (header[1] & 0xFE) != 0xF8)
+            return std::nullopt;
+
+        const auto blockSizeCode = header[2] >> 4u;
+        const auto sampleRateCode = header[2] & 0xFu;
+        const auto channelAssignment = header[3] >> 4u;
+        const auto sampleSizeCode = (header[3] >> 1u) & 0x7u;
+        if (blockSizeCode == 0u || sampleRateCode == 0xFu || channelAssignment > 10u || sampleSizeCode == 3u || (header[3] & 0x1u) != 0u)
+            return std::nullopt;
+
+        // The frame or sample number is encoded like UTF-8
+        auto headerSize = 4u;
+        auto numberLength = 1u;
+        if (header[4] >= 0x80u)
         {
-            assert(m_remaining_bits_last_byte == 0);
-            m_remaining_bits_last_byte = 0;
-            m_stream.seekg(offset, std::ios::cur);
+            if ((header[4] & 0xC0u) != 0xC0u || header[4] == 0xFFu)
+                return std::nullopt;
+
+            while (header[4] & (0x80u >> numberLength))
+                numberLength++;
         }
 
-    private:
-        std::istream& m_stream;
-        uint8_t m_last_byte;
-        uint8_t m_remaining_bits_last_byte;
-    };
+        const auto blockSizeLength = blockSizeCode == 6u ? 1u : blockSizeCode == 7u ? 2u : 0u;
+        const auto sampleRateLength = sampleRateCode == 12u ? 1u : sampleRateCode >= 13u ? 2u : 0u;
+        const auto fullHeaderSize = headerSize + numberLength + blockSizeLength + sampleRateLength + 1u;
+        if (dataSize - offset < fullHeaderSize)
+            return std::nullopt;
+
+        for (auto i = 1u; i < numberLength; i++)
+        {
+            if ((header[headerSize + i] & 0xC0u) != 0x80u)
+                return std::nullopt;
+        }
+        headerSize += numberLength;
+
+        uint32_t sampleCount;
+        if (blockSizeCode == 1u)
+            sampleCount = 192u;
+        else if (blockSizeCode <= 5u)
+            sampleCount = 576u << (blockSizeCode - 2u);
+        else if (blockSizeCode == 6u)
+            sampleCount = header[headerSize] + 1u;
+        else if (blockSizeCode == 7u)
+            sampleCount = (static_cast<uint32_t>(header[headerSize]) << 8u | header[headerSize + 1u]) + 1u;
+        else
+            sampleCount = 256u << (blockSizeCode - 8u);
+        headerSize += blockSizeLength + sampleRateLength;
+
+        uint8_t crc = 0u;
+        for (auto i = 0u; i < headerSize; i++)
+            crc = UpdateCrc8(crc, header[i]);
+
+        if (crc != header[headerSize])
+            return std::nullopt;
+
+        return sampleCount;
+    }
 } // namespace
 
 namespace flac
@@ -181,17 +308,11 @@ namespace flac
     {
     }
 
-    void FlacReadStreamInfo(FlacBitReader& reader, FlacMetaData& metaData)
+    FlacFrame::FlacFrame(const size_t offset, const size_t size, const uint32_t sampleCount)
+        : m_offset(offset),
+          m_size(size),
+          m_sample_count(sampleCount)
     {
-        metaData.m_minimum_block_size = reader.ReadBits<uint16_t>(16);
-        metaData.m_maximum_block_size = reader.ReadBits<uint16_t>(16);
-        metaData.m_minimum_frame_size = reader.ReadBits<uint32_t>(24);
-        metaData.m_maximum_frame_size = reader.ReadBits<uint32_t>(24);
-        metaData.m_sample_rate = reader.ReadBits<uint32_t>(20);
-        metaData.m_number_of_channels = static_cast<uint8_t>(reader.ReadBits<uint8_t>(3) + 1);
-        metaData.m_bits_per_sample = static_cast<uint8_t>(reader.ReadBits<uint8_t>(5) + 1);
-        metaData.m_total_samples = reader.ReadBits<uint64_t>(36);
-        reader.ReadBuffer(metaData.m_md5_signature, 128);
     }
 
     bool GetFlacMetaData(std::istream& stream, FlacMetaData& metaData)
@@ -200,29 +321,37 @@ namespace flac
         {
             uint32_t readMagic;
             stream.read(reinterpret_cast<char*>(&readMagic), sizeof(readMagic));
-            if (stream.gcount() != sizeof(readMagic) || readMagic != FLAC_MAGIC)
-                throw FlacReadingException("Invalid flac magic");
+            if (stream.gcount() != sizeof(readMagic))
+                throw FlacReadingException("Unexpected eof");
+            VerifyMagic(readMagic);
 
-            FlacBitReader reader(stream);
+            // Only the headers and the stream info are read, all other blocks are skipped
             while (true)
             {
-                const MetaDataBlockHeader header{
+                uint8_t headerData[METADATA_BLOCK_HEADER_SIZE];
+                stream.read(reinterpret_cast<char*>(headerData), sizeof(headerData));
+                if (stream.gcount() != sizeof(headerData))
+                    throw FlacReadingException("Unexpected eof");
 
-                    reader.ReadBits<uint8_t>(1),
-                    static_cast<MetaDataBlockType>(reader.ReadBits<uint8_t>(7)),
-                    reader.ReadBits<uint32_t>(24),
-                };
+                FlacBitReader headerReader(headerData, sizeof(headerData));
+                const auto header = ReadMetaDataBlockHeader(headerReader);
 
                 if (header.blockType == MetaDataBlockType::STREAMINFO)
                 {
                     if (header.blockLength != STREAM_INFO_BLOCK_SIZE)
                         throw FlacReadingException("Flac stream info block size invalid");
 
-                    FlacReadStreamInfo(reader, metaData);
+                    uint8_t streamInfoData[STREAM_INFO_BLOCK_SIZE];
+                    stream.read(reinterpret_cast<char*>(streamInfoData), sizeof(streamInfoData));
+                    if (stream.gcount() != sizeof(streamInfoData))
+                        throw FlacReadingException("Unexpected eof");
+
+                    FlacBitReader streamInfoReader(streamInfoData, sizeof(streamInfoData));
+                    ReadStreamInfo(streamInfoReader, metaData);
                     return true;
                 }
 
-                reader.Seek(header.blockLength * 8u);
+                stream.seekg(header.blockLength, std::ios::cur);
 
                 if (header.isLastMetaDataBlock)
                     break;
@@ -240,7 +369,71 @@ namespace flac
 
     bool GetFlacMetaData(const void* data, const size_t dataSize, FlacMetaData& metaData)
     {
-        std::istringstream ss(std::string(static_cast<const char*>(data), dataSize));
-        return GetFlacMetaData(ss, metaData);
+        try
+        {
+            ReadMetaDataBlocks(data, dataSize, metaData, false);
+            return true;
+        }
+        catch (const FlacReadingException& e)
+        {
+            std::cerr << e.what() << "\n";
+        }
+
+        return false;
+    }
+
+    bool GetFlacFrames(const void* data, const size_t dataSize, FlacMetaData& metaData, std::vector<FlacFrame>& frames)
+    {
+        size_t firstFrameOffset;
+        try
+        {
+            firstFrameOffset = ReadMetaDataBlocks(data, dataSize, metaData, true);
+        }
+        catch (const FlacReadingException& e)
+        {
+            std::cerr << e.what() << "\n";
+            return false;
+        }
+
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        auto frameOffset = firstFrameOffset;
+        auto frameSampleCount = ReadFrameHeader(bytes, dataSize, frameOffset);
+        if (!frameSampleCount)
+        {
+            // Flac data without any frame is valid
+            if (frameOffset == dataSize)
+                return true;
+
+            std::cerr << "Invalid flac frame header\n";
+            return false;
+        }
+
+        // Sync codes can appear within the audio data as well, so a frame only ends where the data before the next frame header matches the frame crc.
+        // The crc over the entire frame including the checksum at its end is zero.
+        uint16_t crc = 0u;
+        for (auto offset = frameOffset; offset < dataSize; offset++)
+        {
+            if (offset > frameOffset && crc == 0u)
+            {
+                const auto nextFrameSampleCount = ReadFrameHeader(bytes, dataSize, offset);
+                if (nextFrameSampleCount)
+                {
+                    frames.emplace_back(frameOffset, offset - frameOffset, *frameSampleCount);
+                    frameOffset = offset;
+                    frameSampleCount = nextFrameSampleCount;
+                }
+            }
+
+            crc = UpdateCrc16(crc, bytes[offset]);
+        }
+
+        if (crc != 0u)
+        {
+            std::cerr << "Invalid flac frame checksum\n";
+            return false;
+        }
+
+        frames.emplace_back(frameOffset, dataSize - frameOffset, *frameSampleCount);
+        return true;
     }
 } // namespace flac
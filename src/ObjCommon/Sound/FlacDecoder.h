@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <istream>
+#include <vector>
 
 namespace flac
 {
@@ -21,6 +23,26 @@ namespace flac
         FlacMetaData();
     };
 
+    class FlacFrame
+    {
+    public:
+        size_t m_offset;
+        size_t m_size;
+        uint32_t m_sample_count;
+
+        FlacFrame(size_t offset, size_t size, uint32_t sampleCount);
+    };
+
     bool GetFlacMetaData(std::istream& stream, FlacMetaData& metaData);
     bool GetFlacMetaData(const void* data, size_t dataSize, FlacMetaData& metaData);
+
+    /**
+     * \brief Reads the metadata of flac data in memory and lists all of its frames without decoding them.
+     * \param data The flac data.
+     * \param dataSize The size of the flac data in bytes.
+     * \param metaData The metadata that is read.
+     * \param frames The list to add the frames to in order of their appearance.
+     * \return \c true if the data could be read, otherwise \c false.
+     */
+    bool GetFlacFrames(const void* data, size_t dataSize, FlacMetaData& metaData, std::vector<FlacFrame>& frames);
 } // namespace flac
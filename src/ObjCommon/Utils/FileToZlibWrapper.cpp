@@ -1,6 +1,8 @@
 #include "FileToZlibWrapper.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <fstream>
 
 voidpf Wrapper_Zlib_FileOpen(voidpf opaque, const char*, int)
@@ -117,6 +119,174 @@ int Wrapper_Zlib_FileError(voidpf opaque, voidpf stream)
     return 0;
 }
 
+template<typename T> uLong Wrapper_Zlib_InputRead(voidpf opaque, voidpf stream, void* buf, const uLong size)
+{
+    return static_cast<T*>(stream)->Read(buf, size);
+}
+
+template<typename T> long Wrapper_Zlib_InputTell(voidpf opaque, voidpf stream)
+{
+    return static_cast<T*>(stream)->Tell();
+}
+
+template<typename T> long Wrapper_Zlib_InputSeek(voidpf opaque, voidpf stream, const uLong offset, const int origin)
+{
+    return static_cast<T*>(stream)->Seek(offset, origin);
+}
+
+int Wrapper_Zlib_InputClose(voidpf opaque, voidpf stream)
+{
+    return 0;
+}
+
+BufferedZlibInput::BufferedZlibInput(std::istream& stream, const size_t bufferSize)
+    : m_stream(stream),
+      m_buffer(bufferSize),
+      m_buffer_offset(0),
+      m_buffered_size(0u),
+      m_position(0),
+      m_size(-1)
+{
+}
+
+bool BufferedZlibInput::FillBuffer()
+{
+    // A previous read might have hit the end of the stream which would make seeking fail
+    m_stream.clear();
+    m_stream.seekg(m_position, std::ios_base::beg);
+    m_stream.read(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+
+    m_buffer_offset = m_position;
+    m_buffered_size = static_cast<size_t>(m_stream.gcount());
+
+    return m_buffered_size > 0u;
+}
+
+int64_t BufferedZlibInput::GetSize()
+{
+    if (m_size < 0)
+    {
+        m_stream.clear();
+        m_stream.seekg(0, std::ios_base::end);
+        m_size = static_cast<int64_t>(m_stream.tellg());
+    }
+
+    return m_size;
+}
+
+uLong BufferedZlibInput::Read(void* buffer, const uLong size)
+{
+    auto* out = static_cast<char*>(buffer);
+    uLong totalRead = 0u;
+
+    while (totalRead < size)
+    {
+        const auto remaining = size - totalRead;
+        const auto bufferEnd = m_buffer_offset + static_cast<int64_t>(m_buffered_size);
+        if (m_position >= m_buffer_offset && m_position < bufferEnd)
+        {
+            const auto toCopy = std::min<int64_t>(bufferEnd - m_position, remaining);
+            std::memcpy(&out[totalRead], &m_buffer[static_cast<size_t>(m_position - m_buffer_offset)], static_cast<size_t>(toCopy));
+            m_position += toCopy;
+            totalRead += static_cast<uLong>(toCopy);
+            continue;
+        }
+
+        // Large reads like compressed entry data go straight into the caller's memory
+        if (remaining >= m_buffer.size())
+        {
+            m_stream.clear();
+            m_stream.seekg(m_position, std::ios_base::beg);
+            m_stream.read(&out[totalRead], static_cast<std::streamsize>(remaining));
+
+            const auto readSize = static_cast<uLong>(m_stream.gcount());
+            m_position += readSize;
+            totalRead += readSize;
+            break;
+        }
+
+        if (!FillBuffer())
+            break;
+    }
+
+    return totalRead;
+}
+
+long BufferedZlibInput::Tell() const
+{
+    return static_cast<long>(m_position);
+}
+
+long BufferedZlibInput::Seek(const uLong offset, const int origin)
+{
+    switch (origin)
+    {
+    case ZLIB_FILEFUNC_SEEK_CUR:
+        m_position += static_cast<int64_t>(offset);
+        break;
+
+    case ZLIB_FILEFUNC_SEEK_END:
+        m_position = GetSize() + static_cast<int64_t>(offset);
+        break;
+
+    case ZLIB_FILEFUNC_SEEK_SET:
+        m_position = static_cast<int64_t>(offset);
+        break;
+
+    default:
+        return -1;
+    }
+
+    return 0;
+}
+
+MemoryZlibInput::MemoryZlibInput(const void* data, const size_t size)
+    : m_data(static_cast<const char*>(data)),
+      m_size(size),
+      m_position(0u)
+{
+}
+
+uLong MemoryZlibInput::Read(void* buffer, const uLong size)
+{
+    if (m_position >= m_size)
+        return 0u;
+
+    const auto toCopy = std::min<size_t>(m_size - m_position, size);
+    std::memcpy(buffer, &m_data[m_position], toCopy);
+    m_position += toCopy;
+
+    return static_cast<uLong>(toCopy);
+}
+
+long MemoryZlibInput::Tell() const
+{
+    return static_cast<long>(m_position);
+}
+
+long MemoryZlibInput::Seek(const uLong offset, const int origin)
+{
+    switch (origin)
+    {
+    case ZLIB_FILEFUNC_SEEK_CUR:
+        m_position += offset;
+        break;
+
+    case ZLIB_FILEFUNC_SEEK_END:
+        m_position = m_size + offset;
+        break;
+
+    case ZLIB_FILEFUNC_SEEK_SET:
+        m_position = offset;
+        break;
+
+    default:
+        return -1;
+    }
+
+    return 0;
+}
+
 zlib_filefunc_def FileToZlibWrapper::CreateFunctions32ForFile(std::iostream* stream)
 {
     return zlib_filefunc_def_s{
@@ -158,3 +328,31 @@ zlib_filefunc_def FileToZlibWrapper::CreateFunctions32ForFile(std::ostream* stre
         stream,
     };
 }
+
+zlib_filefunc_def FileToZlibWrapper::CreateFunctions32ForFile(BufferedZlibInput* input)
+{
+    return zlib_filefunc_def_s{
+        Wrapper_Zlib_FileOpen,
+        Wrapper_Zlib_InputRead<BufferedZlibInput>,
+        Wrapper_Zlib_NoFileWrite,
+        Wrapper_Zlib_InputTell<BufferedZlibInput>,
+        Wrapper_Zlib_InputSeek<BufferedZlibInput>,
+        Wrapper_Zlib_InputClose,
+        Wrapper_Zlib_FileError,
+        input,
+    };
+}
+
+zlib_filefunc_def FileToZlibWrapper::CreateFunctions32ForFile(MemoryZlibInput* input)
+{
+    return zlib_filefunc_def_s{
+        Wrapper_Zlib_FileOpen,
+        Wrapper_Zlib_InputRead<MemoryZlibInput>,
+        Wrapper_Zlib_NoFileWrite,
+        Wrapper_Zlib_InputTell<MemoryZlibInput>,
+        Wrapper_Zlib_InputSeek<MemoryZlibInput>,
+        Wrapper_Zlib_InputClose,
+        Wrapper_Zlib_FileError,
+        input,
+    };
+}
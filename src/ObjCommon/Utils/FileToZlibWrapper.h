@@ -2,10 +2,58 @@
 
 #include "ObjStream.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <ioapi.h>
 #include <iostream>
 #include <istream>
 #include <ostream>
+#include <vector>
+
+/**
+ * \brief Reads from a stream through a read-ahead buffer.
+ * Minizip reads headers and the central directory with many small reads and seeks that can be served from the buffer without touching the stream.
+ */
+class BufferedZlibInput
+{
+public:
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 0x10000u;
+
+    explicit BufferedZlibInput(std::istream& stream, size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+    uLong Read(void* buffer, uLong size);
+    _NODISCARD long Tell() const;
+    long Seek(uLong offset, int origin);
+
+private:
+    bool FillBuffer();
+    int64_t GetSize();
+
+    std::istream& m_stream;
+    std::vector<char> m_buffer;
+    int64_t m_buffer_offset;
+    size_t m_buffered_size;
+    int64_t m_position;
+    int64_t m_size;
+};
+
+/**
+ * \brief Reads from data that is available in memory entirely, like a memory mapped file.
+ */
+class MemoryZlibInput
+{
+public:
+    MemoryZlibInput(const void* data, size_t size);
+
+    uLong Read(void* buffer, uLong size);
+    _NODISCARD long Tell() const;
+    long Seek(uLong offset, int origin);
+
+private:
+    const char* m_data;
+    size_t m_size;
+    size_t m_position;
+};
 
 class FileToZlibWrapper
 {
@@ -13,4 +61,6 @@ public:
     static zlib_filefunc_def CreateFunctions32ForFile(std::iostream* stream);
     static zlib_filefunc_def CreateFunctions32ForFile(std::istream* stream);
     static zlib_filefunc_def CreateFunctions32ForFile(std::ostream* stream);
+    static zlib_filefunc_def CreateFunctions32ForFile(BufferedZlibInput* input);
+    static zlib_filefunc_def CreateFunctions32ForFile(MemoryZlibInput* input);
 };
@@ -1,8 +1,105 @@
 #include "XModelCommon.h"
 
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <tuple>
+#include <unordered_map>
+
+namespace
+{
+    // Positions are in game units, everything else is roughly normalized
+    constexpr float WELD_POSITION_STEPS_PER_UNIT = 10000.0f;
+    constexpr float WELD_ATTRIBUTE_STEPS_PER_UNIT = 65536.0f;
+    constexpr auto WELD_QUANTISED_ATTRIBUTE_COUNT = 12u;
+
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325u;
+    constexpr uint64_t FNV_PRIME = 0x100000001B3u;
+
+    int64_t Quantise(const float value, const float stepsPerUnit)
+    {
+        return std::llround(static_cast<double>(value) * stepsPerUnit);
+    }
+
+    class WeldedVertexKey
+    {
+    public:
+        int64_t m_attributes[WELD_QUANTISED_ATTRIBUTE_COUNT];
+        const XModelBoneWeight* m_weights;
+        unsigned m_weight_count;
+
+        WeldedVertexKey(const XModelVertex& vertex, const XModelBoneWeight* weights, const unsigned weightCount)
+            : m_attributes{
+                  Quantise(vertex.coordinates[0], WELD_POSITION_STEPS_PER_UNIT),
+                  Quantise(vertex.coordinates[1], WELD_POSITION_STEPS_PER_UNIT),
+                  Quantise(vertex.coordinates[2], WELD_POSITION_STEPS_PER_UNIT),
+                  Quantise(vertex.normal[0], WELD_ATTRIBUTE_STEPS_PER_UNIT),
+                  Quantise(vertex.normal[1], WELD_ATTRIBUTE_STEPS_PER_UNIT),
+                  Quantise(vertex.normal[2], WELD_ATTRIBUTE_STEPS_PER_UNIT),
+                  Quantise(vertex.color[0], WELD_ATTRIBUTE_STEPS_PER_UNIT),
+                  Quantise(vertex.color[1], WELD_ATTRIBUTE_STEPS_PER_UNIT),
+                  Quantise(vertex.color[2], WELD_ATTRIBUTE_STEPS_PER_UNIT),
+                  Quantise(vertex.color[3], WELD_ATTRIBUTE_STEPS_PER_UNIT),
+                  Quantise(vertex.uv[0], WELD_ATTRIBUTE_STEPS_PER_UNIT),
+                  Quantise(vertex.uv[1], WELD_ATTRIBUTE_STEPS_PER_UNIT),
+              },
+              m_weights(weights),
+              m_weight_count(weightCount)
+        {
+        }
+
+        friend bool operator==(const WeldedVertexKey& lhs, const WeldedVertexKey& rhs)
+        {
+            for (auto i = 0u; i < WELD_QUANTISED_ATTRIBUTE_COUNT; i++)
+            {
+                if (lhs.m_attributes[i] != rhs.m_attributes[i])
+                    return false;
+            }
+
+            if (lhs.m_weight_count != rhs.m_weight_count)
+                return false;
+
+            for (auto i = 0u; i < lhs.m_weight_count; i++)
+            {
+                if (lhs.m_weights[i].boneIndex != rhs.m_weights[i].boneIndex
+                    || Quantise(lhs.m_weights[i].weight, WELD_ATTRIBUTE_STEPS_PER_UNIT) != Quantise(rhs.m_weights[i].weight, WELD_ATTRIBUTE_STEPS_PER_UNIT))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    class WeldedVertexKeyHash
+    {
+    public:
+        static void HashValue(uint64_t& hash, const uint64_t value)
+        {
+            for (auto i = 0u; i < sizeof(value); i++)
+            {
+                hash ^= (value >> (i * 8u)) & 0xFFu;
+                hash *= FNV_PRIME;
+            }
+        }
+
+        std::size_t operator()(const WeldedVertexKey& key) const noexcept
+        {
+            auto hash = FNV_OFFSET_BASIS;
+            for (const auto attribute : key.m_attributes)
+                HashValue(hash, static_cast<uint64_t>(attribute));
+
+            for (auto i = 0u; i < key.m_weight_count; i++)
+            {
+                HashValue(hash, key.m_weights[i].boneIndex);
+                HashValue(hash, static_cast<uint64_t>(Quantise(key.m_weights[i].weight, WELD_ATTRIBUTE_STEPS_PER_UNIT)));
+            }
+
+            return static_cast<std::size_t>(hash);
+        }
+    };
+} // namespace
 
 void XModelMaterial::ApplyDefaults()
 {
@@ -47,6 +144,61 @@ void XModelMaterial::ApplyDefaults()
     phong = -1;
 }
 
+void XModelCommon::WeldVertices()
+{
+    // Bone weights can only be kept in sync with the vertices when there is one entry per vertex
+    const auto hasBoneWeights = !m_vertex_bone_weights.empty();
+    if (hasBoneWeights && m_vertex_bone_weights.size() != m_vertices.size())
+        return;
+
+    std::unordered_map<WeldedVertexKey, unsigned, WeldedVertexKeyHash> weldedIndexByKey;
+    weldedIndexByKey.reserve(m_vertices.size());
+
+    std::vector<unsigned> weldedIndexByVertex(m_vertices.size());
+    std::vector<XModelVertex> weldedVertices;
+    std::vector<XModelVertexBoneWeights> weldedVertexBoneWeights;
+
+    for (auto vertexIndex = 0u; vertexIndex < m_vertices.size(); vertexIndex++)
+    {
+        const XModelBoneWeight* weights = nullptr;
+        auto weightCount = 0u;
+        if (hasBoneWeights)
+        {
+            const auto& vertexBoneWeights = m_vertex_bone_weights[vertexIndex];
+            weightCount = vertexBoneWeights.weightCount;
+            if (weightCount > 0u)
+                weights = &m_bone_weight_data.weights[vertexBoneWeights.weightOffset];
+        }
+
+        const auto [existingEntry, isNew] =
+            weldedIndexByKey.try_emplace(WeldedVertexKey(m_vertices[vertexIndex], weights, weightCount), static_cast<unsigned>(weldedVertices.size()));
+        if (isNew)
+        {
+            weldedVertices.emplace_back(m_vertices[vertexIndex]);
+            if (hasBoneWeights)
+                weldedVertexBoneWeights.emplace_back(m_vertex_bone_weights[vertexIndex]);
+        }
+
+        weldedIndexByVertex[vertexIndex] = existingEntry->second;
+    }
+
+    if (weldedVertices.size() == m_vertices.size())
+        return;
+
+    m_vertices = std::move(weldedVertices);
+    if (hasBoneWeights)
+        m_vertex_bone_weights = std::move(weldedVertexBoneWeights);
+
+    for (auto& object : m_objects)
+    {
+        for (auto& face : object.m_faces)
+        {
+            for (auto& vertexIndex : face.vertexIndex)
+                vertexIndex = weldedIndexByVertex[vertexIndex];
+        }
+    }
+}
+
 bool operator==(const VertexMergerPos& lhs, const VertexMergerPos& rhs)
 {
     const auto coordinatesMatch = std::fabs(lhs.x - rhs.x) < std::numeric_limits<float>::epsilon()
@@ -111,6 +111,12 @@ struct XModelCommon
     std::vector<XModelVertex> m_vertices;
     std::vector<XModelVertexBoneWeights> m_vertex_bone_weights;
     XModelVertexBoneWeightCollection m_bone_weight_data;
+
+    /**
+     * \brief Merges vertices that have the same position, normal, color, uv and bone weights after quantising them and updates the faces accordingly.
+     * Runs in linear time of the amount of vertices.
+     */
+    void WeldVertices();
 };
 
 struct VertexMergerPos
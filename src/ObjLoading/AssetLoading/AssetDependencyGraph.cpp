@@ -0,0 +1,165 @@
+#include "AssetDependencyGraph.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+    constexpr auto GRAPH_FILE_HEADER = "OAT asset dependency graph 1";
+    constexpr auto GRAPH_KEY_ASSET = "asset";
+    constexpr auto GRAPH_KEY_DEPENDENCY = "dependency";
+} // namespace
+
+size_t AssetDependencyGraph::AddAsset(const asset_type_t assetType, const std::string& assetName)
+{
+    const auto [existingNode, inserted] = m_node_indices.try_emplace(std::make_pair(assetType, assetName), m_nodes.size());
+    if (inserted)
+        m_nodes.emplace_back(Node{assetType, assetName, {}});
+
+    return existingNode->second;
+}
+
+void AssetDependencyGraph::AddDependency(const asset_type_t assetType,
+                                         const std::string& assetName,
+                                         const asset_type_t dependencyType,
+                                         const std::string& dependencyName)
+{
+    const auto assetIndex = AddAsset(assetType, assetName);
+    const auto dependencyIndex = AddAsset(dependencyType, dependencyName);
+
+    auto& dependencies = m_nodes[assetIndex].m_dependencies;
+    if (std::ranges::find(dependencies, dependencyIndex) == dependencies.end())
+        dependencies.push_back(dependencyIndex);
+}
+
+const std::vector<AssetDependencyGraph::Node>& AssetDependencyGraph::GetNodes() const
+{
+    return m_nodes;
+}
+
+std::vector<std::vector<size_t>> AssetDependencyGraph::GetLevels() const
+{
+    // Counts the dependencies of every node that are not assigned to a level yet and collects which nodes depend on each node
+    std::vector<size_t> remainingDependencyCounts(m_nodes.size());
+    std::vector<std::vector<size_t>> dependents(m_nodes.size());
+    for (auto nodeIndex = 0u; nodeIndex < m_nodes.size(); nodeIndex++)
+    {
+        remainingDependencyCounts[nodeIndex] = m_nodes[nodeIndex].m_dependencies.size();
+        for (const auto dependencyIndex : m_nodes[nodeIndex].m_dependencies)
+            dependents[dependencyIndex].push_back(nodeIndex);
+    }
+
+    std::vector<std::vector<size_t>> levels;
+    std::vector<size_t> currentLevel;
+    for (auto nodeIndex = 0u; nodeIndex < m_nodes.size(); nodeIndex++)
+    {
+        if (remainingDependencyCounts[nodeIndex] == 0u)
+            currentLevel.push_back(nodeIndex);
+    }
+
+    auto assignedCount = 0u;
+    while (!currentLevel.empty())
+    {
+        std::vector<size_t> nextLevel;
+        for (const auto nodeIndex : currentLevel)
+        {
+            for (const auto dependentIndex : dependents[nodeIndex])
+            {
+                if (--remainingDependencyCounts[dependentIndex] == 0u)
+                    nextLevel.push_back(dependentIndex);
+            }
+        }
+
+        assignedCount += currentLevel.size();
+        levels.emplace_back(std::move(currentLevel));
+        currentLevel = std::move(nextLevel);
+    }
+
+    if (assignedCount < m_nodes.size())
+    {
+        std::vector<size_t> cyclicNodes;
+        for (auto nodeIndex = 0u; nodeIndex < m_nodes.size(); nodeIndex++)
+        {
+            if (remainingDependencyCounts[nodeIndex] > 0u)
+                cyclicNodes.push_back(nodeIndex);
+        }
+        levels.emplace_back(std::move(cyclicNodes));
+    }
+
+    return levels;
+}
+
+bool AssetDependencyGraph::Save(const std::filesystem::path& filePath, const ZoneAssetPools& pools) const
+{
+    std::error_code ec;
+    std::filesystem::create_directories(filePath.parent_path(), ec);
+
+    std::ofstream stream(filePath, std::fstream::out | std::fstream::trunc);
+    if (!stream.is_open())
+        return false;
+
+    stream << GRAPH_FILE_HEADER << '\n';
+    for (const auto& node : m_nodes)
+    {
+        const auto* typeName = node.m_type < pools.GetAssetTypeCount() ? pools.GetAssetTypeName(node.m_type) : nullptr;
+        stream << GRAPH_KEY_ASSET << ' ' << node.m_type << ' ' << (typeName ? typeName : "unknown") << ' ' << node.m_name << '\n';
+    }
+
+    for (auto nodeIndex = 0u; nodeIndex < m_nodes.size(); nodeIndex++)
+    {
+        for (const auto dependencyIndex : m_nodes[nodeIndex].m_dependencies)
+            stream << GRAPH_KEY_DEPENDENCY << ' ' << nodeIndex << ' ' << dependencyIndex << '\n';
+    }
+
+    return stream.good();
+}
+
+bool AssetDependencyGraph::Load(const std::filesystem::path& filePath)
+{
+    std::ifstream stream(filePath);
+    if (!stream.is_open())
+        return false;
+
+    std::string line;
+    if (!std::getline(stream, line) || line != GRAPH_FILE_HEADER)
+        return false;
+
+    AssetDependencyGraph graph;
+    while (std::getline(stream, line))
+    {
+        std::istringstream lineStream(line);
+        std::string key;
+        lineStream >> key;
+
+        if (key == GRAPH_KEY_ASSET)
+        {
+            asset_type_t assetType;
+            std::string typeName;
+            lineStream >> assetType >> typeName;
+            lineStream.get();
+
+            std::string assetName;
+            std::getline(lineStream, assetName);
+            if (lineStream.fail() || assetName.empty())
+                return false;
+
+            graph.AddAsset(assetType, assetName);
+        }
+        else if (key == GRAPH_KEY_DEPENDENCY)
+        {
+            size_t assetIndex;
+            size_t dependencyIndex;
+            lineStream >> assetIndex >> dependencyIndex;
+            if (lineStream.fail() || assetIndex >= graph.m_nodes.size() || dependencyIndex >= graph.m_nodes.size())
+                return false;
+
+            graph.m_nodes[assetIndex].m_dependencies.push_back(dependencyIndex);
+        }
+        else
+            return false;
+    }
+
+    *this = std::move(graph);
+    return true;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Pool/ZoneAssetPools.h"
+#include "Utils/ClassUtils.h"
+#include "Zone/ZoneTypes.h"
+
+#include <filesystem>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief The assets that were loaded for a zone and which assets each of them requested while loading.
+ * Recorded while loading a zone and saved to be able to load assets without dependencies ahead of time when building the zone again.
+ */
+class AssetDependencyGraph
+{
+public:
+    class Node
+    {
+    public:
+        asset_type_t m_type;
+        std::string m_name;
+        std::vector<size_t> m_dependencies;
+    };
+
+    /**
+     * \brief Adds an asset to the graph if it is not part of it yet.
+     * \param assetType The type of the asset.
+     * \param assetName The name of the asset.
+     * \return The index of the node of the asset.
+     */
+    size_t AddAsset(asset_type_t assetType, const std::string& assetName);
+
+    /**
+     * \brief Adds both assets to the graph if they are not part of it yet and records that the first one requested the second one.
+     */
+    void AddDependency(asset_type_t assetType, const std::string& assetName, asset_type_t dependencyType, const std::string& dependencyName);
+
+    _NODISCARD const std::vector<Node>& GetNodes() const;
+
+    /**
+     * \brief Groups the assets by the length of the longest chain of dependencies below them.
+     * All assets of a level only depend on assets of lower levels, so the first level contains all assets without dependencies.
+     * Assets that are part of a dependency cycle are put into the last level.
+     * \return The indices of the nodes of each level.
+     */
+    _NODISCARD std::vector<std::vector<size_t>> GetLevels() const;
+
+    /**
+     * \brief Writes the graph to a text file that can be read again with \c Load and is meant to be readable for analysing builds.
+     * Every asset is written as a line "asset <typeIndex> <typeName> <name>", every dependency as "dependency <assetIndex> <dependencyIndex>".
+     * \param filePath The path of the file to write.
+     * \param pools The pools of the zone to name the asset types with.
+     * \return \c true if the file could be written, otherwise \c false.
+     */
+    bool Save(const std::filesystem::path& filePath, const ZoneAssetPools& pools) const;
+
+    /**
+     * \brief Reads a graph that was written with \c Save.
+     * \param filePath The path of the file to read.
+     * \return \c true if the file exists and is valid, otherwise \c false.
+     */
+    bool Load(const std::filesystem::path& filePath);
+
+private:
+    std::vector<Node> m_nodes;
+    std::map<std::pair<asset_type_t, std::string>, size_t> m_node_indices;
+};
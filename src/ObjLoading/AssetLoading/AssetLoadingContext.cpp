@@ -1,8 +1,11 @@
 #include "AssetLoadingContext.h"
 
+#include "ObjLoading.h"
+
 AssetLoadingContext::AssetLoadingContext(Zone* zone, ISearchPath* rawSearchPath, std::vector<Gdt*> gdtFiles)
-    : m_zone(zone),
-      m_raw_search_path(rawSearchPath),
+    : m_raw_prefetch_search_path(rawSearchPath ? std::make_unique<SearchPathPrefetch>(rawSearchPath, ObjLoading::Configuration.RawPrefetchWorkerCount) : nullptr),
+      m_zone(zone),
+      m_raw_search_path(m_raw_prefetch_search_path ? m_raw_prefetch_search_path.get() : rawSearchPath),
       m_gdt_files(std::move(gdtFiles))
 {
     BuildGdtEntryCache();
@@ -34,6 +37,12 @@ void AssetLoadingContext::BuildGdtEntryCache()
     }
 }
 
+void AssetLoadingContext::PrefetchRawFiles(const std::vector<std::string>& fileNames) const
+{
+    if (m_raw_prefetch_search_path)
+        m_raw_prefetch_search_path->Prefetch(fileNames);
+}
+
 GdtEntry* AssetLoadingContext::GetGdtEntryByGdfAndName(const std::string& gdfName, const std::string& entryName)
 {
     const auto foundGdtMap = m_entries_by_gdf_and_by_name.find(gdfName);
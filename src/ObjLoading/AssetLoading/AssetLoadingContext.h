@@ -1,11 +1,16 @@
 #pragma once
 
+#include "AssetDependencyGraph.h"
 #include "IGdtQueryable.h"
 #include "IZoneAssetLoaderState.h"
 #include "Obj/Gdt/Gdt.h"
 #include "SearchPath/ISearchPath.h"
+#include "SearchPath/SearchPathPrefetch.h"
 #include "Zone/Zone.h"
 
+#include <memory>
+#include <mutex>
+#include <string>
 #include <type_traits>
 #include <typeindex>
 #include <unordered_map>
@@ -14,6 +19,8 @@ class AssetLoadingContext final : public IGdtQueryable
 {
     std::unordered_map<std::string, std::unordered_map<std::string, GdtEntry*>> m_entries_by_gdf_and_by_name;
     std::unordered_map<std::type_index, std::unique_ptr<IZoneAssetLoaderState>> m_zone_asset_loader_states;
+    std::mutex m_zone_asset_loader_states_mutex;
+    std::unique_ptr<SearchPathPrefetch> m_raw_prefetch_search_path;
 
     void BuildGdtEntryCache();
 
@@ -23,14 +30,29 @@ public:
     const std::vector<Gdt*> m_gdt_files;
     std::unordered_map<std::string, asset_type_t> m_ignored_asset_map;
 
+    // Records which assets requested which other assets while loading the zone
+    AssetDependencyGraph m_dependency_graph;
+
+    // The graph that was recorded when the zone was built the last time, if known.
+    // Assets that did not have any dependencies in it are loaded ahead of time in parallel.
+    const AssetDependencyGraph* m_previous_dependency_graph = nullptr;
+
     AssetLoadingContext(Zone* zone, ISearchPath* rawSearchPath, std::vector<Gdt*> gdtFiles);
     GdtEntry* GetGdtEntryByGdfAndName(const std::string& gdfName, const std::string& entryName) override;
 
+    /**
+     * \brief Starts reading the specified files of the raw search path in the background so loading assets does not need to wait for them.
+     * \param fileNames The relative paths of the files to read.
+     */
+    void PrefetchRawFiles(const std::vector<std::string>& fileNames) const;
+
     template<typename T> T* GetZoneAssetLoaderState()
     {
         static_assert(std::is_base_of_v<IZoneAssetLoaderState, T>, "T must inherit IZoneAssetLoaderState");
         // T must also have a public default constructor
 
+        // Assets that are loaded in parallel may request states at the same time
+        std::lock_guard lock(m_zone_asset_loader_states_mutex);
         const auto foundEntry = m_zone_asset_loader_states.find(typeid(T));
         if (foundEntry != m_zone_asset_loader_states.end())
             return dynamic_cast<T*>(foundEntry->second.get());
@@ -1,23 +1,371 @@
 #include "AssetLoadingManager.h"
 
+#include "ObjLoading.h"
 #include "Utils/StringUtils.h"
+#include "Utils/ThreadPool.h"
+#include "Utils/Tracing.h"
 
 #include <algorithm>
 #include <format>
+#include <future>
 #include <iostream>
+#include <set>
+#include <utility>
+
+namespace
+{
+    /**
+     * \brief A loading manager for loading an asset concurrently to other assets.
+     * Added assets are collected to add them to the zone afterwards. Requesting any dependency makes the asset be loaded normally instead.
+     */
+    class CollectingAssetLoadingManager final : public IAssetLoadingManager
+    {
+    public:
+        explicit CollectingAssetLoadingManager(AssetLoadingContext& context)
+            : m_requested_dependency(false),
+              m_context(context)
+        {
+        }
+
+        [[nodiscard]] AssetLoadingContext* GetAssetLoadingContext() const override
+        {
+            return &m_context;
+        }
+
+        XAssetInfoGeneric* AddAsset(std::unique_ptr<XAssetInfoGeneric> xAssetInfo) override
+        {
+            return m_added_assets.emplace_back(std::move(xAssetInfo)).get();
+        }
+
+        XAssetInfoGeneric* LoadDependency(const asset_type_t assetType, const std::string& assetName) override
+        {
+            m_requested_dependency = true;
+            return nullptr;
+        }
+
+        IndirectAssetReference LoadIndirectAssetReference(const asset_type_t assetType, const std::string& assetName) override
+        {
+            m_requested_dependency = true;
+            return IndirectAssetReference(assetType, assetName);
+        }
+
+        std::vector<std::unique_ptr<XAssetInfoGeneric>> m_added_assets;
+        bool m_requested_dependency;
+
+    private:
+        AssetLoadingContext& m_context;
+    };
+} // namespace
+
+class AssetLoadingManager::ParallelLoadResult
+{
+public:
+    bool m_loaded = false;
+    std::unique_ptr<MemoryManager> m_memory;
+    std::vector<std::unique_ptr<XAssetInfoGeneric>> m_added_assets;
+
+    // Set when the loaded assets are owned by the session's loaded asset cache
+    const LoadedAssetCache::Entry* m_cached_entry = nullptr;
+};
 
 AssetLoadingManager::AssetLoadingManager(const std::map<asset_type_t, std::unique_ptr<IAssetLoader>>& assetLoadersByType, AssetLoadingContext& context)
     : m_asset_loaders_by_type(assetLoadersByType),
       m_context(context),
-      m_last_dependency_loaded(nullptr)
+      m_last_dependency_loaded(nullptr),
+      m_dependency_allocated_size(0u)
 {
 }
 
+void AssetLoadingManager::PrefetchAssets(const std::vector<std::pair<asset_type_t, std::string>>& assets) const
+{
+    std::vector<std::string> fileNames;
+    for (const auto& [assetType, assetName] : assets)
+    {
+        const auto ignoreEntry = m_context.m_ignored_asset_map.find(assetName);
+        if (ignoreEntry != m_context.m_ignored_asset_map.end() && ignoreEntry->second == assetType)
+            continue;
+
+        const auto loader = m_asset_loaders_by_type.find(assetType);
+        if (loader == m_asset_loaders_by_type.end() || !loader->second->CanLoadFromRaw())
+            continue;
+
+        auto fileName = loader->second->GetRawFileName(assetName);
+        if (!fileName.empty())
+            fileNames.emplace_back(std::move(fileName));
+    }
+
+    m_context.PrefetchRawFiles(fileNames);
+}
+
 bool AssetLoadingManager::LoadAssetFromLoader(const asset_type_t assetType, const std::string& assetName)
 {
     return LoadDependency(assetType, assetName) != nullptr;
 }
 
+bool AssetLoadingManager::CanLoadAssetInParallel(const asset_type_t assetType, const std::string& assetName, const IAssetLoader* loader) const
+{
+    if (!loader->CanLoadFromRaw() || !loader->CanLoadFromRawInParallel() || m_context.m_raw_search_path == nullptr)
+        return false;
+
+    // Assets that could be loaded from a gdt are loaded normally to keep gdt entries taking precedence
+    if (loader->CanLoadFromGdt() && !m_context.m_gdt_files.empty())
+        return false;
+
+    const auto ignoreEntry = m_context.m_ignored_asset_map.find(assetName);
+    return ignoreEntry == m_context.m_ignored_asset_map.end() || ignoreEntry->second != assetType;
+}
+
+std::unique_ptr<AssetLoadingManager::ParallelLoadResult> AssetLoadingManager::LoadAssetInParallel(const std::string& assetName,
+                                                                                          const IAssetLoader* loader) const
+{
+    const auto assetType = loader->GetHandlingAssetType();
+    TRACE_SCOPE("ObjLoading", std::format("LoadInParallel {}", m_context.m_zone->m_pools->GetAssetTypeName(assetType)));
+
+    auto result = std::make_unique<ParallelLoadResult>();
+
+    auto* loadedAssets = loader->CanShareLoadedRawAssets() ? ObjLoading::Configuration.LoadedAssets : nullptr;
+    if (loadedAssets)
+    {
+        result->m_cached_entry = loadedAssets->Find(m_context.m_zone->m_game, assetType, assetName, *m_context.m_raw_search_path);
+        if (result->m_cached_entry)
+        {
+            result->m_loaded = true;
+            return result;
+        }
+    }
+
+    result->m_memory = std::make_unique<MemoryManager>();
+
+    try
+    {
+        CollectingAssetLoadingManager collectingManager(m_context);
+        LoadedAssetCache::RecordingSearchPath recordingSearchPath(*m_context.m_raw_search_path);
+        auto* searchPath = loadedAssets ? &recordingSearchPath : m_context.m_raw_search_path;
+
+        result->m_loaded = loader->LoadFromRaw(assetName, searchPath, result->m_memory.get(), &collectingManager, m_context.m_zone)
+                           && !collectingManager.m_requested_dependency && !collectingManager.m_added_assets.empty();
+        result->m_added_assets = std::move(collectingManager.m_added_assets);
+
+        // Script strings are indices into the script strings of a single zone so assets using them cannot be shared
+        const auto usesScriptStrings = std::ranges::any_of(result->m_added_assets,
+                                                           [](const std::unique_ptr<XAssetInfoGeneric>& addedAsset)
+                                                           {
+                                                               return !addedAsset->m_used_script_strings.empty();
+                                                           });
+
+        if (result->m_loaded && loadedAssets && recordingSearchPath.IsCacheable() && !usesScriptStrings)
+        {
+            auto entry = std::make_unique<LoadedAssetCache::Entry>();
+            entry->m_files = std::move(recordingSearchPath.m_files);
+            entry->m_memory = std::move(result->m_memory);
+            entry->m_assets = std::move(result->m_added_assets);
+
+            result->m_cached_entry = loadedAssets->Add(m_context.m_zone->m_game, assetType, assetName, std::move(entry));
+        }
+    }
+    catch (...)
+    {
+        // The asset is loaded again normally which reports the error to the caller
+        result->m_loaded = false;
+    }
+
+    return result;
+}
+
+XAssetInfoGeneric* AssetLoadingManager::AddParallelLoadResult(ParallelLoadResult& result)
+{
+    XAssetInfoGeneric* lastAddedAsset = nullptr;
+
+    if (result.m_cached_entry)
+    {
+        // The memory of cached assets stays with the cache and is shared by all zones using them
+        for (const auto& cachedAsset : result.m_cached_entry->m_assets)
+        {
+            lastAddedAsset = AddAsset(std::make_unique<XAssetInfoGeneric>(*cachedAsset));
+            if (lastAddedAsset == nullptr)
+                break;
+        }
+
+        m_last_dependency_loaded = nullptr;
+        return lastAddedAsset;
+    }
+
+    auto* memory = m_context.m_zone->GetMemory();
+    if (!result.m_added_assets.empty())
+        memory->AddAssetMemoryUsage(result.m_added_assets.back()->m_type, 0u, result.m_memory->GetAllocatedSize());
+
+    memory->TakeOwnership(*result.m_memory);
+
+    for (auto& addedAsset : result.m_added_assets)
+    {
+        lastAddedAsset = AddAsset(std::move(addedAsset));
+        if (lastAddedAsset == nullptr)
+            break;
+    }
+
+    m_last_dependency_loaded = nullptr;
+    return lastAddedAsset;
+}
+
+bool AssetLoadingManager::LoadAssetsFromLoader(const std::vector<std::pair<asset_type_t, std::string>>& assets)
+{
+    std::vector<std::future<std::unique_ptr<ParallelLoadResult>>> parallelResults(assets.size());
+    std::unique_ptr<ThreadPool> workerPool;
+
+    std::set<std::pair<asset_type_t, std::string>> parallelAssets;
+    const auto workerCount = ObjLoading::Configuration.RawParallelLoadWorkerCount;
+
+    // Assets that are already part of the zone are looked up all at once instead of one after another
+    std::vector<XAssetInfoGeneric*> existingAssets;
+    if (workerCount > 0u)
+        existingAssets = m_context.m_zone->m_pools->GetAssetsOrAssetReferences(assets);
+
+    for (auto i = 0u; workerCount > 0u && i < assets.size(); i++)
+    {
+        const auto& [assetType, assetName] = assets[i];
+        const auto loader = m_asset_loaders_by_type.find(assetType);
+        if (existingAssets[i] != nullptr || loader == m_asset_loaders_by_type.end() || !CanLoadAssetInParallel(assetType, assetName, loader->second.get())
+            || !parallelAssets.emplace(assetType, assetName).second)
+            continue;
+
+        if (!workerPool)
+            workerPool = std::make_unique<ThreadPool>(workerCount);
+
+        auto task = std::make_shared<std::packaged_task<std::unique_ptr<ParallelLoadResult>()>>(
+            [this, &assetName, loader = loader->second.get()]
+            {
+                return LoadAssetInParallel(assetName, loader);
+            });
+
+        parallelResults[i] = task->get_future();
+        workerPool->Enqueue(
+            [task]
+            {
+                (*task)();
+            });
+    }
+
+    if (workerCount > 0u && m_context.m_previous_dependency_graph)
+    {
+        if (!workerPool)
+            workerPool = std::make_unique<ThreadPool>(workerCount);
+
+        PrefetchIndependentDependencies(*workerPool, parallelAssets);
+    }
+
+    const auto result = LoadAssetsInOrder(assets, parallelResults);
+
+    // Workers may still load dependencies that were not requested in the end
+    workerPool.reset();
+    m_prefetched_dependencies.clear();
+
+    return result;
+}
+
+bool AssetLoadingManager::LoadAssetsInOrder(const std::vector<std::pair<asset_type_t, std::string>>& assets,
+                                            std::vector<std::future<std::unique_ptr<ParallelLoadResult>>>& parallelResults)
+{
+    // Assets are added in the specified order to create the same zone as when loading them one after another
+    for (auto i = 0u; i < assets.size(); i++)
+    {
+        const auto& [assetType, assetName] = assets[i];
+        if (parallelResults[i].valid())
+        {
+            const auto result = parallelResults[i].get();
+
+            // The asset might have already been loaded as a dependency of a previous asset
+            if (result->m_loaded && !m_context.m_zone->m_pools->GetAssetOrAssetReference(assetType, assetName))
+            {
+                if (AddParallelLoadResult(*result) == nullptr)
+                    return false;
+
+                m_context.m_dependency_graph.AddAsset(assetType, assetName);
+                continue;
+            }
+        }
+
+        if (!LoadAssetFromLoader(assetType, assetName))
+            return false;
+    }
+
+    return true;
+}
+
+void AssetLoadingManager::PrefetchIndependentDependencies(ThreadPool& workerPool, const std::set<std::pair<asset_type_t, std::string>>& parallelAssets)
+{
+    const auto& previousNodes = m_context.m_previous_dependency_graph->GetNodes();
+
+    // Only assets that can be loaded without requesting any dependency can be loaded ahead of time
+    std::vector<const AssetDependencyGraph::Node*> candidateNodes;
+    std::vector<std::pair<asset_type_t, std::string>> candidateAssets;
+    for (const auto& node : previousNodes)
+    {
+        if (!node.m_dependencies.empty() || parallelAssets.contains(std::make_pair(node.m_type, node.m_name)))
+            continue;
+
+        candidateNodes.emplace_back(&node);
+        candidateAssets.emplace_back(node.m_type, node.m_name);
+    }
+
+    const auto existingAssets = m_context.m_zone->m_pools->GetAssetsOrAssetReferences(candidateAssets);
+    for (auto i = 0u; i < candidateNodes.size(); i++)
+    {
+        const auto& node = *candidateNodes[i];
+        const auto loader = m_asset_loaders_by_type.find(node.m_type);
+        if (existingAssets[i] != nullptr || loader == m_asset_loaders_by_type.end() || !CanLoadAssetInParallel(node.m_type, node.m_name, loader->second.get()))
+            continue;
+
+        auto task = std::make_shared<std::packaged_task<std::unique_ptr<ParallelLoadResult>()>>(
+            [this, &node, loader = loader->second.get()]
+            {
+                return LoadAssetInParallel(node.m_name, loader);
+            });
+
+        m_prefetched_dependencies.emplace(std::make_pair(node.m_type, node.m_name), task->get_future());
+        workerPool.Enqueue(
+            [task]
+            {
+                (*task)();
+            });
+    }
+}
+
+XAssetInfoGeneric* AssetLoadingManager::AddPrefetchedDependency(const asset_type_t assetType, const std::string& assetName)
+{
+    const auto prefetchedDependency = m_prefetched_dependencies.find(std::make_pair(assetType, assetName));
+    if (prefetchedDependency == m_prefetched_dependencies.end())
+        return nullptr;
+
+    const auto result = prefetchedDependency->second.get();
+    m_prefetched_dependencies.erase(prefetchedDependency);
+
+    // Dependencies that could not be loaded on their own anymore are loaded normally
+    if (!result->m_loaded)
+        return nullptr;
+
+    // The memory of the dependency is attributed to the dependency and not to the asset requesting it
+    auto* memory = m_context.m_zone->GetMemory();
+    const auto allocatedSizeBefore = memory->GetAllocatedSize();
+
+    auto* asset = AddParallelLoadResult(*result);
+
+    m_dependency_allocated_size += memory->GetAllocatedSize() - allocatedSizeBefore;
+
+    return asset;
+}
+
+void AssetLoadingManager::RecordDependency(const asset_type_t assetType, const std::string& assetName)
+{
+    if (m_loading_assets.empty())
+    {
+        m_context.m_dependency_graph.AddAsset(assetType, assetName);
+        return;
+    }
+
+    const auto& [loadingAssetType, loadingAssetName] = m_loading_assets.back();
+    m_context.m_dependency_graph.AddDependency(loadingAssetType, *loadingAssetName, assetType, assetName);
+}
+
 AssetLoadingContext* AssetLoadingManager::GetAssetLoadingContext() const
 {
     return &m_context;
@@ -31,6 +379,8 @@ XAssetInfoGeneric* AssetLoadingManager::AddAssetInternal(std::unique_ptr<XAssetI
     m_last_dependency_loaded = m_context.m_zone->m_pools->AddAsset(std::move(xAssetInfo));
     if (m_last_dependency_loaded == nullptr)
         std::cerr << "Failed to add asset of type \"" << m_context.m_zone->m_pools->GetAssetTypeName(assetType) << "\" to pool: \"" << pAssetName << "\"\n";
+    else
+        TRACE_COUNTER(std::format("Added {}", m_context.m_zone->m_pools->GetAssetTypeName(assetType)), 1);
 
     return m_last_dependency_loaded;
 }
@@ -38,7 +388,16 @@ XAssetInfoGeneric* AssetLoadingManager::AddAssetInternal(std::unique_ptr<XAssetI
 XAssetInfoGeneric* AssetLoadingManager::AddAsset(std::unique_ptr<XAssetInfoGeneric> xAssetInfo)
 {
     xAssetInfo->m_zone = m_context.m_zone;
-    return AddAssetInternal(std::move(xAssetInfo));
+    auto* assetInfo = AddAssetInternal(std::move(xAssetInfo));
+
+    if (assetInfo)
+    {
+        const auto loader = m_asset_loaders_by_type.find(assetInfo->m_type);
+        if (loader != m_asset_loaders_by_type.end())
+            loader->second->OnAssetAdded(*assetInfo, &m_context);
+    }
+
+    return assetInfo;
 }
 
 XAssetInfoGeneric* AssetLoadingManager::LoadIgnoredDependency(const asset_type_t assetType, const std::string& assetName, IAssetLoader* loader)
@@ -70,6 +429,26 @@ XAssetInfoGeneric* AssetLoadingManager::LoadIgnoredDependency(const asset_type_t
 }
 
 XAssetInfoGeneric* AssetLoadingManager::LoadAssetDependency(const asset_type_t assetType, const std::string& assetName, const IAssetLoader* loader)
+{
+    // Memory allocated while loading dependencies is attributed to the dependencies and not to the asset requesting them
+    auto* memory = m_context.m_zone->GetMemory();
+    const auto allocatedSizeBefore = memory->GetAllocatedSize();
+    const auto outerDependencyAllocatedSize = std::exchange(m_dependency_allocated_size, 0u);
+
+    m_loading_assets.emplace_back(assetType, &assetName);
+    auto* asset = LoadAssetDependencyFromLoader(assetType, assetName, loader);
+    m_loading_assets.pop_back();
+
+    const auto allocatedSize = memory->GetAllocatedSize() - allocatedSizeBefore;
+    if (asset)
+        memory->AddAssetMemoryUsage(assetType, 0u, allocatedSize - m_dependency_allocated_size);
+
+    m_dependency_allocated_size = outerDependencyAllocatedSize + allocatedSize;
+
+    return asset;
+}
+
+XAssetInfoGeneric* AssetLoadingManager::LoadAssetDependencyFromLoader(const asset_type_t assetType, const std::string& assetName, const IAssetLoader* loader)
 {
     if (loader->CanLoadFromGdt() && !m_context.m_gdt_files.empty()
         && loader->LoadFromGdt(assetName, &m_context, m_context.m_zone->GetMemory(), this, m_context.m_zone))
@@ -131,10 +510,18 @@ XAssetInfoGeneric* AssetLoadingManager::LoadAssetDependency(const asset_type_t a
 
 XAssetInfoGeneric* AssetLoadingManager::LoadDependency(const asset_type_t assetType, const std::string& assetName)
 {
+    RecordDependency(assetType, assetName);
+
     auto* alreadyLoadedAsset = m_context.m_zone->m_pools->GetAssetOrAssetReference(assetType, assetName);
     if (alreadyLoadedAsset)
         return alreadyLoadedAsset;
 
+    auto* prefetchedAsset = AddPrefetchedDependency(assetType, assetName);
+    if (prefetchedAsset)
+        return prefetchedAsset;
+
+    TRACE_SCOPE("ObjLoading", std::format("LoadDependency {}", m_context.m_zone->m_pools->GetAssetTypeName(assetType)));
+
     const auto loader = m_asset_loaders_by_type.find(assetType);
     if (loader != m_asset_loaders_by_type.end())
     {
@@ -155,6 +542,8 @@ XAssetInfoGeneric* AssetLoadingManager::LoadDependency(const asset_type_t assetT
 
 IndirectAssetReference AssetLoadingManager::LoadIndirectAssetReference(const asset_type_t assetType, const std::string& assetName)
 {
+    RecordDependency(assetType, assetName);
+
     const auto* alreadyLoadedAsset = m_context.m_zone->m_pools->GetAssetOrAssetReference(assetType, assetName);
     if (alreadyLoadedAsset)
         return IndirectAssetReference(assetType, assetName);
@@ -163,6 +552,9 @@ IndirectAssetReference AssetLoadingManager::LoadIndirectAssetReference(const ass
     if (ignoreEntry != m_context.m_ignored_asset_map.end() && ignoreEntry->second == assetType)
         return IndirectAssetReference(assetType, assetName);
 
+    if (AddPrefetchedDependency(assetType, assetName))
+        return IndirectAssetReference(assetType, assetName);
+
     const auto loader = m_asset_loaders_by_type.find(assetType);
     if (loader != m_asset_loaders_by_type.end())
     {
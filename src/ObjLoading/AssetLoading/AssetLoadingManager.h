@@ -3,16 +3,32 @@
 #include "AssetLoadingContext.h"
 #include "IAssetLoader.h"
 #include "IAssetLoadingManager.h"
+#include "Utils/ThreadPool.h"
 
+#include <cstddef>
+#include <future>
 #include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
 
 class AssetLoadingManager final : public IAssetLoadingManager
 {
 public:
     AssetLoadingManager(const std::map<asset_type_t, std::unique_ptr<IAssetLoader>>& assetLoadersByType, AssetLoadingContext& context);
 
+    void PrefetchAssets(const std::vector<std::pair<asset_type_t, std::string>>& assets) const;
     bool LoadAssetFromLoader(asset_type_t assetType, const std::string& assetName);
 
+    /**
+     * \brief Loads all specified assets. Raw assets whose loader supports it are loaded in parallel but added to the zone in the specified order.
+     * \param assets The types and names of the assets to load.
+     * \return \c true if all assets could be loaded, otherwise \c false.
+     */
+    bool LoadAssetsFromLoader(const std::vector<std::pair<asset_type_t, std::string>>& assets);
+
     [[nodiscard]] AssetLoadingContext* GetAssetLoadingContext() const override;
 
     XAssetInfoGeneric* AddAsset(std::unique_ptr<XAssetInfoGeneric> xAssetInfo) override;
@@ -20,12 +36,32 @@ public:
     IndirectAssetReference LoadIndirectAssetReference(asset_type_t assetType, const std::string& assetName) override;
 
 private:
+    class ParallelLoadResult;
+
+    [[nodiscard]] bool CanLoadAssetInParallel(asset_type_t assetType, const std::string& assetName, const IAssetLoader* loader) const;
+    std::unique_ptr<ParallelLoadResult> LoadAssetInParallel(const std::string& assetName, const IAssetLoader* loader) const;
+    XAssetInfoGeneric* AddParallelLoadResult(ParallelLoadResult& result);
+    bool LoadAssetsInOrder(const std::vector<std::pair<asset_type_t, std::string>>& assets,
+                           std::vector<std::future<std::unique_ptr<ParallelLoadResult>>>& parallelResults);
+
+    void PrefetchIndependentDependencies(ThreadPool& workerPool, const std::set<std::pair<asset_type_t, std::string>>& parallelAssets);
+    XAssetInfoGeneric* AddPrefetchedDependency(asset_type_t assetType, const std::string& assetName);
+    void RecordDependency(asset_type_t assetType, const std::string& assetName);
+
     XAssetInfoGeneric* LoadIgnoredDependency(asset_type_t assetType, const std::string& assetName, IAssetLoader* loader);
     XAssetInfoGeneric* LoadAssetDependency(asset_type_t assetType, const std::string& assetName, const IAssetLoader* loader);
+    XAssetInfoGeneric* LoadAssetDependencyFromLoader(asset_type_t assetType, const std::string& assetName, const IAssetLoader* loader);
 
     XAssetInfoGeneric* AddAssetInternal(std::unique_ptr<XAssetInfoGeneric> xAssetInfo);
 
     const std::map<asset_type_t, std::unique_ptr<IAssetLoader>>& m_asset_loaders_by_type;
     AssetLoadingContext& m_context;
     XAssetInfoGeneric* m_last_dependency_loaded;
+    size_t m_dependency_allocated_size;
+
+    // The assets that are currently being loaded, the innermost one last
+    std::vector<std::pair<asset_type_t, const std::string*>> m_loading_assets;
+
+    // Dependencies without dependencies of their own in the previous build that are loaded ahead of time until they are requested
+    std::map<std::pair<asset_type_t, std::string>, std::future<std::unique_ptr<ParallelLoadResult>>> m_prefetched_dependencies;
 };
@@ -36,6 +36,26 @@ public:
         return false;
     }
 
+    /**
+     * \brief Returns whether \c LoadFromRaw can run concurrently with loading other assets.
+     * This requires it to only read its own file and allocate from the specified memory, without loading dependencies or modifying the zone.
+     * \return \c true if raw assets of this type can be loaded in parallel, otherwise \c false.
+     */
+    _NODISCARD virtual bool CanLoadFromRawInParallel() const
+    {
+        return false;
+    }
+
+    /**
+     * \brief Returns whether assets loaded in parallel by \c LoadFromRaw only depend on the files they read and not on the zone they are loaded for.
+     * Assets like this can be added to other zones of the same session without loading them again as long as their files are unchanged.
+     * \return \c true if raw assets of this type can be shared between zones, otherwise \c false.
+     */
+    _NODISCARD virtual bool CanShareLoadedRawAssets() const
+    {
+        return CanLoadFromRawInParallel();
+    }
+
     virtual bool LoadFromGdt(const std::string& assetName, IGdtQueryable* gdtQueryable, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
     {
         return false;
@@ -46,6 +66,27 @@ public:
         return false;
     }
 
+    /**
+     * \brief Returns the name of the file \c LoadFromRaw reads for the specified asset to be able to read it ahead of time.
+     * \param assetName The name of the asset.
+     * \return The relative path of the file or an empty string if it is not known ahead of time.
+     */
+    _NODISCARD virtual std::string GetRawFileName(const std::string& assetName) const
+    {
+        return {};
+    }
+
+    /**
+     * \brief Called on the loading thread whenever an asset of this loader was added to the zone.
+     * Assets are added in the order they are specified in, even when they were loaded in parallel, so this can report issues that depend on that order.
+     * \param assetInfo The added asset.
+     * \param context The context of the zone the asset was added to.
+     */
+    virtual void OnAssetAdded(const XAssetInfoGeneric& assetInfo, AssetLoadingContext* context) const
+    {
+        // Do nothing by default
+    }
+
     virtual void FinalizeAssetsForZone(AssetLoadingContext* context) const
     {
         // Do nothing by default
@@ -0,0 +1,150 @@
+#include "LoadedAssetCache.h"
+
+#include <sstream>
+
+namespace
+{
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325u;
+    constexpr uint64_t FNV_PRIME = 0x100000001B3u;
+
+    void HashData(uint64_t& hash, const char* data, const size_t dataSize)
+    {
+        for (auto i = 0u; i < dataSize; i++)
+        {
+            hash ^= static_cast<uint8_t>(data[i]);
+            hash *= FNV_PRIME;
+        }
+    }
+} // namespace
+
+LoadedAssetCache::RecordingSearchPath::RecordingSearchPath(ISearchPath& searchPath)
+    : m_search_path(searchPath),
+      m_is_cacheable(true)
+{
+}
+
+SearchPathOpenFile LoadedAssetCache::RecordingSearchPath::Open(const std::string& fileName)
+{
+    const auto file = m_search_path.Open(fileName);
+    if (!file.IsOpen())
+    {
+        m_files.emplace_back(RecordedFile{fileName, false, 0u});
+        return {};
+    }
+
+    // The file is read completely to hash it and to serve the loader from memory without reading it twice
+    std::string data;
+    if (file.m_length > 0)
+        data.reserve(static_cast<size_t>(file.m_length));
+
+    char buffer[0x10000];
+    while (!file.m_stream->eof())
+    {
+        file.m_stream->read(buffer, sizeof(buffer));
+        const auto readSize = static_cast<size_t>(file.m_stream->gcount());
+        if (readSize == 0)
+            break;
+
+        data.append(buffer, readSize);
+    }
+
+    auto hash = FNV_OFFSET_BASIS;
+    HashData(hash, data.data(), data.size());
+    m_files.emplace_back(RecordedFile{fileName, true, hash});
+
+    const auto length = static_cast<int64_t>(data.size());
+    return SearchPathOpenFile(std::make_unique<std::istringstream>(std::move(data)), length);
+}
+
+std::string LoadedAssetCache::RecordingSearchPath::GetPath()
+{
+    return m_search_path.GetPath();
+}
+
+void LoadedAssetCache::RecordingSearchPath::Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback)
+{
+    m_is_cacheable = false;
+    m_search_path.Find(options, callback);
+}
+
+bool LoadedAssetCache::RecordingSearchPath::IsCacheable() const
+{
+    return m_is_cacheable;
+}
+
+LoadedAssetCache::RecordedFile LoadedAssetCache::HashFile(ISearchPath& searchPath, const std::string& fileName)
+{
+    const auto file = searchPath.Open(fileName);
+    if (!file.IsOpen())
+        return RecordedFile{fileName, false, 0u};
+
+    auto hash = FNV_OFFSET_BASIS;
+    char buffer[0x10000];
+    while (!file.m_stream->eof())
+    {
+        file.m_stream->read(buffer, sizeof(buffer));
+        const auto readSize = static_cast<size_t>(file.m_stream->gcount());
+        if (readSize == 0)
+            break;
+
+        HashData(hash, buffer, readSize);
+    }
+
+    return RecordedFile{fileName, true, hash};
+}
+
+bool LoadedAssetCache::HasSameFiles(const Entry& entry, const std::vector<RecordedFile>& files)
+{
+    if (entry.m_files.size() != files.size())
+        return false;
+
+    for (auto i = 0u; i < files.size(); i++)
+    {
+        const auto& cachedFile = entry.m_files[i];
+        const auto& file = files[i];
+        if (cachedFile.m_name != file.m_name || cachedFile.m_exists != file.m_exists || cachedFile.m_hash != file.m_hash)
+            return false;
+    }
+
+    return true;
+}
+
+const LoadedAssetCache::Entry* LoadedAssetCache::Find(const IGame* game, const asset_type_t assetType, const std::string& assetName, ISearchPath& searchPath)
+{
+    const Entry* entry;
+    {
+        std::lock_guard lock(m_mutex);
+        const auto foundEntry = m_entries.find(std::make_tuple(game, assetType, assetName));
+        if (foundEntry == m_entries.end())
+            return nullptr;
+
+        entry = foundEntry->second.get();
+    }
+
+    // Entries are never freed while the cache exists so the files can be hashed without holding the lock
+    for (const auto& cachedFile : entry->m_files)
+    {
+        const auto file = HashFile(searchPath, cachedFile.m_name);
+        if (file.m_exists != cachedFile.m_exists || file.m_hash != cachedFile.m_hash)
+            return nullptr;
+    }
+
+    return entry;
+}
+
+const LoadedAssetCache::Entry* LoadedAssetCache::Add(const IGame* game, const asset_type_t assetType, const std::string& assetName, std::unique_ptr<Entry> entry)
+{
+    std::lock_guard lock(m_mutex);
+
+    auto& cachedEntry = m_entries[std::make_tuple(game, assetType, assetName)];
+    if (cachedEntry)
+    {
+        if (HasSameFiles(*cachedEntry, entry->m_files))
+            return cachedEntry.get();
+
+        m_replaced_entries.emplace_back(std::move(cachedEntry));
+    }
+
+    cachedEntry = std::move(entry);
+    return cachedEntry.get();
+}
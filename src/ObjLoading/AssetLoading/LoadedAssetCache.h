@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Game/IGame.h"
+#include "Pool/XAssetInfo.h"
+#include "SearchPath/ISearchPath.h"
+#include "Utils/ClassUtils.h"
+#include "Utils/MemoryManager.h"
+#include "Zone/ZoneTypes.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/**
+ * \brief Keeps raw assets that were loaded without any dependencies for a whole session so other zones can add them without loading them again.
+ * A cached asset is only used again when all files that were read for loading it are unchanged.
+ */
+class LoadedAssetCache
+{
+public:
+    class RecordedFile
+    {
+    public:
+        std::string m_name;
+        bool m_exists;
+        uint64_t m_hash;
+    };
+
+    class Entry
+    {
+    public:
+        std::vector<RecordedFile> m_files;
+        std::unique_ptr<MemoryManager> m_memory;
+        std::vector<std::unique_ptr<XAssetInfoGeneric>> m_assets;
+    };
+
+    /**
+     * \brief A search path that forwards to another search path and hashes every file that is opened through it to be able to cache the loaded asset.
+     */
+    class RecordingSearchPath final : public ISearchPath
+    {
+    public:
+        explicit RecordingSearchPath(ISearchPath& searchPath);
+
+        SearchPathOpenFile Open(const std::string& fileName) override;
+        std::string GetPath() override;
+        void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
+
+        /**
+         * \brief Returns whether the opened files fully describe what was read. Searching for files makes the result depend on the search path as well.
+         * \return \c true if the loaded asset can be cached, otherwise \c false.
+         */
+        _NODISCARD bool IsCacheable() const;
+
+        std::vector<RecordedFile> m_files;
+
+    private:
+        ISearchPath& m_search_path;
+        bool m_is_cacheable;
+    };
+
+    LoadedAssetCache() = default;
+    ~LoadedAssetCache() = default;
+    LoadedAssetCache(const LoadedAssetCache& other) = delete;
+    LoadedAssetCache(LoadedAssetCache&& other) noexcept = delete;
+    LoadedAssetCache& operator=(const LoadedAssetCache& other) = delete;
+    LoadedAssetCache& operator=(LoadedAssetCache&& other) noexcept = delete;
+
+    /**
+     * \brief Searches for a cached asset whose files are unchanged.
+     * \param game The game the asset is loaded for.
+     * \param assetType The type of the asset.
+     * \param assetName The name of the asset.
+     * \param searchPath The search path to check the files of the cached asset with.
+     * \return The cached entry or \c nullptr if the asset is not cached or any of its files changed.
+     */
+    const Entry* Find(const IGame* game, asset_type_t assetType, const std::string& assetName, ISearchPath& searchPath);
+
+    /**
+     * \brief Adds a loaded asset to the cache. The cache keeps its memory for the rest of the session.
+     * \param game The game the asset was loaded for.
+     * \param assetType The type of the asset.
+     * \param assetName The name of the asset.
+     * \param entry The files that were read for loading the asset, its memory and all assets that were added when loading it.
+     * \return The cached entry. When the same files were already cached concurrently the previously cached entry is returned instead.
+     */
+    const Entry* Add(const IGame* game, asset_type_t assetType, const std::string& assetName, std::unique_ptr<Entry> entry);
+
+private:
+    static RecordedFile HashFile(ISearchPath& searchPath, const std::string& fileName);
+    static bool HasSameFiles(const Entry& entry, const std::vector<RecordedFile>& files);
+
+    std::map<std::tuple<const IGame*, asset_type_t, std::string>, std::unique_ptr<Entry>> m_entries;
+
+    // Zones may still use assets of entries that were replaced because their files changed
+    std::vector<std::unique_ptr<Entry>> m_replaced_entries;
+    std::mutex m_mutex;
+};
@@ -7,6 +7,8 @@
 
 #include <cstring>
 #include <iostream>
+#include <memory>
+#include <span>
 
 using namespace IW3;
 
@@ -23,13 +25,17 @@ bool AssetLoaderGfxImage::CanLoadFromRaw() const
     return true;
 }
 
-bool AssetLoaderGfxImage::LoadFromRaw(
-    const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
+bool AssetLoaderGfxImage::CanLoadFromRawInParallel() const
+{
+    return true;
+}
+
+std::string AssetLoaderGfxImage::GetRawFileName(const std::string& assetName) const
 {
     // Do not load any GfxImages from raw for now that are not loaded
     // TODO: Load iwis and add streaming info to asset
     if (assetName.empty() || assetName[0] != '*')
-        return false;
+        return {};
 
     std::string safeAssetName = assetName;
     for (auto& c : safeAssetName)
@@ -45,12 +51,33 @@ bool AssetLoaderGfxImage::LoadFromRaw(
         }
     }
 
-    const auto file = searchPath->Open("images/" + safeAssetName + ".dds");
+    return "images/" + safeAssetName + ".dds";
+}
+
+bool AssetLoaderGfxImage::LoadFromRaw(
+    const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
+{
+    const auto fileName = GetRawFileName(assetName);
+    if (fileName.empty())
+        return false;
+
+    const auto file = searchPath->Open(fileName);
     if (!file.IsOpen())
         return false;
 
-    const DdsLoader ddsLoader(zone->GetMemory());
-    auto* texture = ddsLoader.LoadDds(*file.m_stream);
+    // Images can be loaded in parallel so everything that is allocated must come from the specified memory instead of the zone
+    const auto fileSize = static_cast<size_t>(file.m_length);
+    const auto fileData = std::make_unique<uint8_t[]>(fileSize);
+    file.m_stream->read(reinterpret_cast<char*>(fileData.get()), static_cast<std::streamsize>(fileSize));
+    if (file.m_stream->gcount() != static_cast<std::streamsize>(fileSize))
+    {
+        std::cout << "Failed to read dds file for image asset \"" << assetName << "\"\n";
+        return false;
+    }
+
+    MemoryManager tempMemory;
+    const DdsLoader ddsLoader(&tempMemory);
+    const std::unique_ptr<Texture> texture(ddsLoader.LoadDds(std::span<const uint8_t>(fileData.get(), fileSize)));
 
     if (texture == nullptr)
     {
@@ -99,7 +126,7 @@ bool AssetLoaderGfxImage::LoadFromRaw(
     for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
         dataSize += texture->GetSizeOfMipLevel(mipLevel) * faceCount;
 
-    auto* loadDef = static_cast<GfxImageLoadDef*>(zone->GetMemory()->AllocRaw(offsetof(GfxImageLoadDef, data) + dataSize));
+    auto* loadDef = static_cast<GfxImageLoadDef*>(memory->AllocRaw(offsetof(GfxImageLoadDef, data) + dataSize));
     image->texture.loadDef = loadDef;
     loadDef->levelCount = static_cast<char>(mipCount);
     loadDef->flags = 0;
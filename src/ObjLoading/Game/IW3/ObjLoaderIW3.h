@@ -26,12 +26,14 @@ namespace IW3
 
         bool SupportsZone(Zone* zone) const override;
 
-        void LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone) const override;
+        void LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad) const override;
         void UnloadContainersOfZone(Zone* zone) const override;
 
-        void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone) const override;
+        void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad) const override;
 
+        void PrefetchAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets) const override;
         bool LoadAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName) const override;
+        bool LoadAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets) const override;
         void FinalizeAssetsForZone(AssetLoadingContext* context) const override;
     };
 } // namespace IW3
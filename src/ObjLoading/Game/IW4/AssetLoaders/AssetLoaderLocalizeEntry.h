@@ -13,7 +13,10 @@ namespace IW4
         _NODISCARD XAssetInfoGeneric* LoadFromGlobalAssetPools(const std::string& assetName) const override;
         _NODISCARD void* CreateEmptyAsset(const std::string& assetName, MemoryManager* memory) override;
         _NODISCARD bool CanLoadFromRaw() const override;
+        _NODISCARD bool CanLoadFromRawInParallel() const override;
+        _NODISCARD bool CanShareLoadedRawAssets() const override;
         bool
             LoadFromRaw(const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const override;
+        void OnAssetAdded(const XAssetInfoGeneric& assetInfo, AssetLoadingContext* context) const override;
     };
 } // namespace IW4
@@ -7,11 +7,12 @@
 #include "Game/IW4/MaterialConstantsIW4.h"
 #include "Game/IW4/ObjConstantsIW4.h"
 #include "Game/IW4/TechsetConstantsIW4.h"
+#include "Material/MaterialTablePool.h"
 #include "ObjLoading.h"
 #include "Pool/GlobalAssetPool.h"
 #include "StateMap/StateMapFromTechniqueExtractor.h"
 #include "StateMap/StateMapHandler.h"
-#include "Techset/TechniqueFileReader.h"
+#include "Techset/TechniqueDefinition.h"
 
 #include <cmath>
 #include <cstring>
@@ -35,6 +36,8 @@ namespace IW4
               m_search_path(searchPath),
               m_manager(manager),
               m_state_map_cache(manager->GetAssetLoadingContext()->GetZoneAssetLoaderState<techset::TechniqueStateMapCache>()),
+              m_constant_table_pool(manager->GetAssetLoadingContext()->GetZoneAssetLoaderState<material::MaterialTablePool<MaterialConstantDef>>()),
+              m_state_bits_table_pool(manager->GetAssetLoadingContext()->GetZoneAssetLoaderState<material::MaterialTablePool<GfxStateBits>>()),
               m_material(nullptr),
               m_base_state_bits{}
         {
@@ -889,14 +892,13 @@ namespace IW4
             if (preloadedStateMap)
                 return preloadedStateMap;
 
-            const auto techniqueFileName = AssetLoaderTechniqueSet::GetTechniqueFileName(techniqueName);
-            const auto file = m_search_path->Open(techniqueFileName);
-            if (!file.IsOpen())
+            const auto techniqueDefinition = AssetLoaderTechniqueSet::LoadTechniqueDefinition(techniqueName, m_search_path);
+            if (!techniqueDefinition)
                 return nullptr;
 
             state_map::StateMapFromTechniqueExtractor extractor;
-            const techset::TechniqueFileReader reader(*file.m_stream, techniqueFileName, &extractor);
-            if (!reader.ReadTechniqueDefinition())
+            std::string errorMessage;
+            if (!techniqueDefinition->Replay(extractor, errorMessage))
             {
                 m_state_map_cache->SetTechniqueUsesStateMap(techniqueName, nullptr);
                 return nullptr;
@@ -1296,29 +1298,12 @@ namespace IW4
                 m_material->textureCount = 0u;
             }
 
-            if (!m_constants.empty())
-            {
-                m_material->constantTable = m_memory->Alloc<MaterialConstantDef>(m_constants.size());
-                m_material->constantCount = static_cast<unsigned char>(m_constants.size());
-                memcpy(m_material->constantTable, m_constants.data(), sizeof(MaterialConstantDef) * m_constants.size());
-            }
-            else
-            {
-                m_material->constantTable = nullptr;
-                m_material->constantCount = 0u;
-            }
+            // Materials with identical tables share them which makes the zone writer only write them once
+            m_material->constantTable = m_constant_table_pool->GetTable(*m_memory, m_constants.data(), m_constants.size());
+            m_material->constantCount = static_cast<unsigned char>(m_constants.size());
 
-            if (!m_state_bits.empty())
-            {
-                m_material->stateBitsTable = m_memory->Alloc<GfxStateBits>(m_state_bits.size());
-                m_material->stateBitsCount = static_cast<unsigned char>(m_state_bits.size());
-                memcpy(m_material->stateBitsTable, m_state_bits.data(), sizeof(GfxStateBits) * m_state_bits.size());
-            }
-            else
-            {
-                m_material->stateBitsTable = nullptr;
-                m_material->stateBitsCount = 0u;
-            }
+            m_material->stateBitsTable = m_state_bits_table_pool->GetTable(*m_memory, m_state_bits.data(), m_state_bits.size());
+            m_material->stateBitsCount = static_cast<unsigned char>(m_state_bits.size());
         }
 
         static size_t
@@ -1344,6 +1329,8 @@ namespace IW4
         ISearchPath* m_search_path;
         IAssetLoadingManager* m_manager;
         techset::TechniqueStateMapCache* m_state_map_cache;
+        material::MaterialTablePool<MaterialConstantDef>* m_constant_table_pool;
+        material::MaterialTablePool<GfxStateBits>* m_state_bits_table_pool;
         std::unordered_map<const state_map::StateMapDefinition*, GfxStateBits> m_state_bits_per_state_map;
         std::vector<XAssetInfoGeneric*> m_dependencies;
 
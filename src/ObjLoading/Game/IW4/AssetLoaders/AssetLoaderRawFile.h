@@ -8,11 +8,11 @@ namespace IW4
 {
     class AssetLoaderRawFile final : public BasicAssetLoader<AssetRawFile>
     {
-        static constexpr size_t COMPRESSED_BUFFER_SIZE_PADDING = 64;
-
     public:
         _NODISCARD void* CreateEmptyAsset(const std::string& assetName, MemoryManager* memory) override;
         _NODISCARD bool CanLoadFromRaw() const override;
+        _NODISCARD bool CanLoadFromRawInParallel() const override;
+        _NODISCARD std::string GetRawFileName(const std::string& assetName) const override;
         bool
             LoadFromRaw(const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const override;
     };
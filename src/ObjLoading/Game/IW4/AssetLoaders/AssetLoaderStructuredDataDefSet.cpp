@@ -23,6 +23,11 @@ bool AssetLoaderStructuredDataDefSet::CanLoadFromRaw() const
     return true;
 }
 
+bool AssetLoaderStructuredDataDefSet::CanLoadFromRawInParallel() const
+{
+    return true;
+}
+
 StructuredDataType AssetLoaderStructuredDataDefSet::ConvertType(CommonStructuredDataType inputType)
 {
     switch (inputType.m_category)
@@ -7,10 +7,12 @@
 #include "ObjLoading.h"
 #include "Pool/GlobalAssetPool.h"
 #include "Shader/D3D9ShaderAnalyser.h"
+#include "Shader/ShaderInfoCache.h"
 #include "StateMap/StateMapReader.h"
 #include "Techset/TechniqueFileReader.h"
 #include "Techset/TechniqueStateMapCache.h"
 #include "Techset/TechsetDefinitionCache.h"
+#include "Techset/TechsetFileCache.h"
 #include "Techset/TechsetFileReader.h"
 #include "Utils/Alignment.h"
 #include "Utils/ClassUtils.h"
@@ -85,7 +87,7 @@ namespace IW4
 
     class ShaderInfoFromFileSystemCacheState final : public IZoneAssetLoaderState
     {
-        std::unordered_map<std::string, std::unique_ptr<d3d9::ShaderInfo>> m_cached_shader_info;
+        std::unordered_map<std::string, std::shared_ptr<const d3d9::ShaderInfo>> m_cached_shader_info;
 
     public:
         _NODISCARD const d3d9::ShaderInfo* LoadShaderInfoFromDisk(ISearchPath* searchPath, const std::string& fileName)
@@ -109,7 +111,8 @@ namespace IW4
             const auto shaderData = std::make_unique<char[]>(shaderSize);
             file.m_stream->read(shaderData.get(), shaderSize);
 
-            auto shaderInfo = d3d9::ShaderAnalyser::GetShaderInfo(reinterpret_cast<const uint32_t*>(shaderData.get()), shaderSize);
+            // Shaders with the same bytecode are only analysed once per session, or not at all if they are in the persisted shader info cache
+            auto shaderInfo = ShaderInfoCache::Instance.GetShaderInfo(reinterpret_cast<const uint32_t*>(shaderData.get()), shaderSize);
             if (!shaderInfo)
                 return nullptr;
 
@@ -178,13 +181,13 @@ namespace IW4
         {
             XAssetInfo<MaterialVertexShader>* m_vertex_shader;
             const d3d9::ShaderInfo* m_vertex_shader_info;
-            std::unique_ptr<d3d9::ShaderInfo> m_vertex_shader_info_unq;
+            std::shared_ptr<const d3d9::ShaderInfo> m_vertex_shader_info_cached;
             std::vector<size_t> m_vertex_shader_argument_handled_offset;
             std::vector<bool> m_handled_vertex_shader_arguments;
 
             XAssetInfo<MaterialPixelShader>* m_pixel_shader;
             const d3d9::ShaderInfo* m_pixel_shader_info;
-            std::unique_ptr<d3d9::ShaderInfo> m_pixel_shader_info_unq;
+            std::shared_ptr<const d3d9::ShaderInfo> m_pixel_shader_info_cached;
             std::vector<size_t> m_pixel_shader_argument_handled_offset;
             std::vector<bool> m_handled_pixel_shader_arguments;
 
@@ -482,8 +485,8 @@ namespace IW4
             else
             {
                 const auto& shaderLoadDef = pass.m_vertex_shader->Asset()->prog.loadDef;
-                pass.m_vertex_shader_info_unq = d3d9::ShaderAnalyser::GetShaderInfo(shaderLoadDef.program, shaderLoadDef.programSize * sizeof(uint32_t));
-                pass.m_vertex_shader_info = pass.m_vertex_shader_info_unq.get();
+                pass.m_vertex_shader_info_cached = ShaderInfoCache::Instance.GetShaderInfo(shaderLoadDef.program, shaderLoadDef.programSize * sizeof(uint32_t));
+                pass.m_vertex_shader_info = pass.m_vertex_shader_info_cached.get();
             }
 
             if (!pass.m_vertex_shader_info)
@@ -522,8 +525,8 @@ namespace IW4
             else
             {
                 const auto& shaderLoadDef = pass.m_pixel_shader->Asset()->prog.loadDef;
-                pass.m_pixel_shader_info_unq = d3d9::ShaderAnalyser::GetShaderInfo(shaderLoadDef.program, shaderLoadDef.programSize * sizeof(uint32_t));
-                pass.m_pixel_shader_info = pass.m_pixel_shader_info_unq.get();
+                pass.m_pixel_shader_info_cached = ShaderInfoCache::Instance.GetShaderInfo(shaderLoadDef.program, shaderLoadDef.programSize * sizeof(uint32_t));
+                pass.m_pixel_shader_info = pass.m_pixel_shader_info_cached.get();
             }
 
             if (!pass.m_pixel_shader_info)
@@ -1234,15 +1237,17 @@ namespace IW4
 
         MaterialTechnique* LoadTechniqueFromRaw(const std::string& techniqueName, std::vector<XAssetInfoGeneric*>& dependencies) const
         {
-            const auto techniqueFileName = AssetLoaderTechniqueSet::GetTechniqueFileName(techniqueName);
-            const auto file = m_search_path->Open(techniqueFileName);
-            if (!file.IsOpen())
+            const auto techniqueDefinition = AssetLoaderTechniqueSet::LoadTechniqueDefinition(techniqueName, m_search_path);
+            if (!techniqueDefinition)
                 return nullptr;
 
             TechniqueCreator creator(techniqueName, m_search_path, m_memory, m_manager, m_zone_state, m_shader_info_cache, m_state_map_cache);
-            const techset::TechniqueFileReader reader(*file.m_stream, techniqueFileName, &creator);
-            if (!reader.ReadTechniqueDefinition())
+            std::string errorMessage;
+            if (!techniqueDefinition->Replay(creator, errorMessage))
+            {
+                std::cout << "Loading technique \"" << techniqueName << "\" failed: " << errorMessage << "\n";
                 return nullptr;
+            }
 
             return ConvertTechnique(techniqueName, creator.m_passes, dependencies);
         }
@@ -1334,27 +1339,54 @@ bool AssetLoaderTechniqueSet::CreateTechsetFromDefinition(
     return true;
 }
 
-techset::TechsetDefinition*
+const techset::TechsetDefinition*
     AssetLoaderTechniqueSet::LoadTechsetDefinition(const std::string& assetName, ISearchPath* searchPath, techset::TechsetDefinitionCache* definitionCache)
 {
-    auto* cachedTechsetDefinition = definitionCache->GetCachedTechsetDefinition(assetName);
+    const auto* cachedTechsetDefinition = definitionCache->GetCachedTechsetDefinition(assetName);
     if (cachedTechsetDefinition)
         return cachedTechsetDefinition;
 
+    // Techset files are only parsed once per session and shared with all zones using them
+    static techset::TechsetFileCache<techset::TechsetDefinition> techsetFileCache;
+
     const auto techsetFileName = GetTechsetFileName(assetName);
-    const auto file = searchPath->Open(techsetFileName);
-    if (!file.IsOpen())
+    auto techsetDefinition = techsetFileCache.GetDefinition(searchPath,
+                                                            techsetFileName,
+                                                            [&techsetFileName](std::istream& stream)
+                                                            {
+                                                                const techset::TechsetFileReader reader(
+                                                                    stream, techsetFileName, techniqueTypeNames, std::extent_v<decltype(techniqueTypeNames)>);
+                                                                return reader.ReadTechsetDefinition();
+                                                            });
+    if (!techsetDefinition)
         return nullptr;
 
-    const techset::TechsetFileReader reader(*file.m_stream, techsetFileName, techniqueTypeNames, std::extent_v<decltype(techniqueTypeNames)>);
-    auto techsetDefinition = reader.ReadTechsetDefinition();
-    auto* techsetDefinitionPtr = techsetDefinition.get();
+    const auto* techsetDefinitionPtr = techsetDefinition.get();
 
     definitionCache->AddTechsetDefinitionToCache(assetName, std::move(techsetDefinition));
 
     return techsetDefinitionPtr;
 }
 
+std::shared_ptr<const techset::TechniqueDefinition> AssetLoaderTechniqueSet::LoadTechniqueDefinition(const std::string& techniqueName, ISearchPath* searchPath)
+{
+    // Technique files are only parsed once per session, materialising them for a zone replays the parsed definition
+    static techset::TechsetFileCache<techset::TechniqueDefinition> techniqueFileCache;
+
+    const auto techniqueFileName = GetTechniqueFileName(techniqueName);
+    return techniqueFileCache.GetDefinition(searchPath,
+                                            techniqueFileName,
+                                            [&techniqueFileName](std::istream& stream) -> std::unique_ptr<techset::TechniqueDefinition>
+                                            {
+                                                auto techniqueDefinition = std::make_unique<techset::TechniqueDefinition>();
+                                                const techset::TechniqueFileReader reader(stream, techniqueFileName, techniqueDefinition.get());
+                                                if (!reader.ReadTechniqueDefinition())
+                                                    return nullptr;
+
+                                                return techniqueDefinition;
+                                            });
+}
+
 const state_map::StateMapDefinition*
     AssetLoaderTechniqueSet::LoadStateMapDefinition(const std::string& stateMapName, ISearchPath* searchPath, techset::TechniqueStateMapCache* stateMapCache)
 {
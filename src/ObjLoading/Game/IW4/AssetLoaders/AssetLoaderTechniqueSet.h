@@ -4,6 +4,7 @@
 #include "Game/IW4/IW4.h"
 #include "SearchPath/ISearchPath.h"
 #include "StateMap/StateMapDefinition.h"
+#include "Techset/TechniqueDefinition.h"
 #include "Techset/TechniqueStateMapCache.h"
 #include "Techset/TechsetDefinition.h"
 #include "Techset/TechsetDefinitionCache.h"
@@ -23,8 +24,9 @@ namespace IW4
         static std::string GetTechniqueFileName(const std::string& techniqueName);
         static std::string GetStateMapFileName(const std::string& stateMapName);
 
-        static techset::TechsetDefinition*
+        static const techset::TechsetDefinition*
             LoadTechsetDefinition(const std::string& assetName, ISearchPath* searchPath, techset::TechsetDefinitionCache* definitionCache);
+        static std::shared_ptr<const techset::TechniqueDefinition> LoadTechniqueDefinition(const std::string& techniqueName, ISearchPath* searchPath);
         static const state_map::StateMapDefinition*
             LoadStateMapDefinition(const std::string& stateMapName, ISearchPath* searchPath, techset::TechniqueStateMapCache* stateMapCache);
 
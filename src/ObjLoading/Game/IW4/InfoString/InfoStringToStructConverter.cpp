@@ -206,7 +206,7 @@ bool InfoStringToStructConverter::Convert()
         assert(field.iFieldType >= 0);
 
         auto foundValue = false;
-        const auto& value = m_info_string.GetValueForKey(std::string(field.szName), &foundValue);
+        const auto& value = m_info_string.GetValueForKey(field.szName, &foundValue);
 
         if (foundValue)
         {
@@ -4,6 +4,8 @@
 #include "Game/IW4/IW4.h"
 
 #include <map>
+#include <string>
+#include <unordered_map>
 
 namespace IW4
 {
@@ -19,6 +21,8 @@ namespace IW4
         std::vector<const char*> m_strings;
         std::map<std::string, const char*> m_strings_by_value;
 
+        std::unordered_map<std::string, Statement_s*> m_statements_by_entries;
+
     public:
         std::map<std::string, std::vector<XAssetInfo<menuDef_t>*>> m_menus_by_filename;
         ExpressionSupportingData* m_supporting_data;
@@ -32,6 +36,20 @@ namespace IW4
         size_t AddStaticDvar(const std::string& dvarName);
         const char* AddString(const std::string& str);
 
+        /**
+         * \brief Searches for a statement that was added before and has the same entries and supporting data.
+         * \param statement The statement to search an equal statement for.
+         * \return The equal statement or \c nullptr if there is none.
+         */
+        Statement_s* FindStatement(const Statement_s& statement) const;
+
+        /**
+         * \brief Makes a statement available for being shared with equal statements.
+         * The statement must not be changed afterwards.
+         * \param statement The statement to share.
+         */
+        void AddStatement(Statement_s* statement);
+
         void AddLoadedFile(std::string loadedFileName, std::vector<XAssetInfo<menuDef_t>*> menusOfFile);
 
         void FinalizeSupportingData() const;
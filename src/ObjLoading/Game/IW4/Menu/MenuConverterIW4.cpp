@@ -218,7 +218,8 @@ namespace IW4
                 if (foundCommonFunction == m_parsing_zone_state->m_functions_by_name.end())
                     throw MenuConversionException("Failed to find definition for custom function \"" + functionCall->m_function_name + "\"", menu, item);
 
-                functionStatement = ConvertExpression(foundCommonFunction->second->m_value.get(), menu, item);
+                // Every function is listed in the supporting data, so each needs a statement of its own
+                functionStatement = ConvertStatement(foundCommonFunction->second->m_value.get(), menu, item, false);
                 functionStatement = m_conversion_zone_state->AddFunction(foundCommonFunction->second->m_name, functionStatement);
             }
 
@@ -411,18 +412,32 @@ namespace IW4
             }
         }
 
-        _NODISCARD Statement_s* ConvertExpression(const ISimpleExpression* expression, const CommonMenuDef* menu, const CommonItemDef* item = nullptr) const
+        _NODISCARD Statement_s* ConvertStatement(const ISimpleExpression* expression,
+                                                 const CommonMenuDef* menu,
+                                                 const CommonItemDef* item,
+                                                 const bool shareWithEqualStatements) const
         {
-            if (!expression)
-                return nullptr;
+            Statement_s convertedStatement{};
+            convertedStatement.supportingData = nullptr; // Supporting data is set upon using it
+
+            std::vector<expressionEntry> expressionEntries;
+            ConvertExpressionEntry(&convertedStatement, expressionEntries, expression, menu, item);
+
+            convertedStatement.entries = expressionEntries.data();
+            convertedStatement.numEntries = static_cast<int>(expressionEntries.size());
+
+            // Statements with the same entries always evaluate to the same result, so all menus of the zone can use the same one
+            if (shareWithEqualStatements)
+            {
+                auto* equalStatement = m_conversion_zone_state->FindStatement(convertedStatement);
+                if (equalStatement)
+                    return equalStatement;
+            }
 
             auto* statement = m_memory->Create<Statement_s>();
             statement->lastResult = Operand{};
             statement->lastExecuteTime = 0;
-            statement->supportingData = nullptr; // Supporting data is set upon using it
-
-            std::vector<expressionEntry> expressionEntries;
-            ConvertExpressionEntry(statement, expressionEntries, expression, menu, item);
+            statement->supportingData = convertedStatement.supportingData;
 
             auto* outputExpressionEntries = m_memory->Alloc<expressionEntry>(expressionEntries.size());
             memcpy(outputExpressionEntries, expressionEntries.data(), sizeof(expressionEntry) * expressionEntries.size());
@@ -430,9 +445,20 @@ namespace IW4
             statement->entries = outputExpressionEntries;
             statement->numEntries = static_cast<int>(expressionEntries.size());
 
+            if (shareWithEqualStatements)
+                m_conversion_zone_state->AddStatement(statement);
+
             return statement;
         }
 
+        _NODISCARD Statement_s* ConvertExpression(const ISimpleExpression* expression, const CommonMenuDef* menu, const CommonItemDef* item = nullptr) const
+        {
+            if (!expression)
+                return nullptr;
+
+            return ConvertStatement(expression, menu, item, !m_disable_optimizations);
+        }
+
         _NODISCARD Statement_s* ConvertOrApplyStatement(float& staticValue,
                                                         const ISimpleExpression* expression,
                                                         const CommonMenuDef* menu,
@@ -42,10 +42,13 @@
 #include "Image/Dx9TextureLoader.h"
 #include "Image/IwiLoader.h"
 #include "Image/IwiTypes.h"
+#include "Image/ParallelTextureLoader.h"
 #include "Image/Texture.h"
 #include "ObjContainer/IPak/IPak.h"
 #include "ObjLoading.h"
 
+#include <vector>
+
 using namespace IW4;
 
 ObjLoader::ObjLoader()
@@ -112,10 +115,20 @@ bool ObjLoader::IsZmZone(Zone* zone)
     return zone->m_name.compare(0, 3, "zm_") == 0 || zone->m_name.compare(zone->m_name.length() - 3, 3, "_zm") == 0;
 }
 
-void ObjLoader::LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone) const {}
+void ObjLoader::LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad) const {}
 
 void ObjLoader::UnloadContainersOfZone(Zone* zone) const {}
 
+void ObjLoader::AttachTextureToImage(GfxImage* image, Texture* texture)
+{
+    image->texture.texture = texture;
+    image->cardMemory.platform[0] = 0;
+
+    const auto textureMipCount = texture->GetMipMapCount();
+    for (auto mipLevel = 0; mipLevel < textureMipCount; mipLevel++)
+        image->cardMemory.platform[0] += static_cast<int>(texture->GetSizeOfMipLevel(mipLevel) * texture->GetFaceCount());
+}
+
 void ObjLoader::LoadImageFromLoadDef(GfxImage* image, Zone* zone)
 {
     const auto* loadDef = image->texture.loadDef;
@@ -132,47 +145,21 @@ void ObjLoader::LoadImageFromLoadDef(GfxImage* image, Zone* zone)
 
     textureLoader.Format(static_cast<oat::D3DFORMAT>(loadDef->format));
     textureLoader.HasMipMaps(!(loadDef->flags & iwi8::IMG_FLAG_NOMIPMAPS));
-    Texture* loadedTexture = textureLoader.LoadTexture(image->texture.loadDef->data);
+    Texture* loadedTexture = textureLoader.LoadTextureInPlace(image->texture.loadDef->data);
 
     if (loadedTexture != nullptr)
-    {
-        image->texture.texture = loadedTexture;
-        image->cardMemory.platform[0] = 0;
-
-        const auto textureMipCount = loadedTexture->GetMipMapCount();
-        for (auto mipLevel = 0; mipLevel < textureMipCount; mipLevel++)
-            image->cardMemory.platform[0] += static_cast<int>(loadedTexture->GetSizeOfMipLevel(mipLevel) * loadedTexture->GetFaceCount());
-    }
+        AttachTextureToImage(image, loadedTexture);
 }
 
-void ObjLoader::LoadImageFromIwi(GfxImage* image, ISearchPath* searchPath, Zone* zone)
+Texture* ObjLoader::LoadImageFromIwi(const GfxImage* image, ISearchPath* searchPath, MemoryManager* memory)
 {
-    Texture* loadedTexture = nullptr;
-    IwiLoader loader(zone->GetMemory());
-
     const auto imageFileName = "images/" + std::string(image->name) + ".iwi";
+    const auto filePathImage = searchPath->Open(imageFileName);
+    if (!filePathImage.IsOpen())
+        return nullptr;
 
-    {
-        const auto filePathImage = searchPath->Open(imageFileName);
-        if (filePathImage.IsOpen())
-        {
-            loadedTexture = loader.LoadIwi(*filePathImage.m_stream);
-        }
-    }
-
-    if (loadedTexture != nullptr)
-    {
-        image->texture.texture = loadedTexture;
-        image->cardMemory.platform[0] = 0;
-
-        const auto textureMipCount = loadedTexture->GetMipMapCount();
-        for (auto mipLevel = 0; mipLevel < textureMipCount; mipLevel++)
-            image->cardMemory.platform[0] += static_cast<int>(loadedTexture->GetSizeOfMipLevel(mipLevel) * loadedTexture->GetFaceCount());
-    }
-    else
-    {
-        printf("Could not find data for image \"%s\"\n", image->name);
-    }
+    IwiLoader loader(memory);
+    return loader.LoadIwi(*filePathImage.m_stream);
 }
 
 void ObjLoader::LoadImageData(ISearchPath* searchPath, Zone* zone)
@@ -181,6 +168,7 @@ void ObjLoader::LoadImageData(ISearchPath* searchPath, Zone* zone)
 
     if (assetPool && assetPool->m_image != nullptr)
     {
+        std::vector<GfxImage*> imagesToLoad;
         for (auto* imageEntry : *assetPool->m_image)
         {
             auto* image = imageEntry->Asset();
@@ -202,15 +190,38 @@ void ObjLoader::LoadImageData(ISearchPath* searchPath, Zone* zone)
             }
             else
             {
-                LoadImageFromIwi(image, searchPath, zone);
+                imagesToLoad.emplace_back(image);
             }
         }
+
+        parallel_texture_loader::LoadTextures(
+            *zone->GetMemory(),
+            imagesToLoad.size(),
+            [&imagesToLoad, searchPath](const size_t index, MemoryManager& memory)
+            {
+                return LoadImageFromIwi(imagesToLoad[index], searchPath, &memory);
+            },
+            [&imagesToLoad](const size_t index, Texture* texture)
+            {
+                auto* image = imagesToLoad[index];
+                if (texture != nullptr)
+                    AttachTextureToImage(image, texture);
+                else
+                    printf("Could not find data for image \"%s\"\n", image->name);
+            });
     }
 }
 
-void ObjLoader::LoadObjDataForZone(ISearchPath* searchPath, Zone* zone) const
+void ObjLoader::LoadObjDataForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad) const
 {
-    LoadImageData(searchPath, zone);
+    if (ObjLoading::ShouldLoadAssetType(assetTypesToLoad, ASSET_TYPE_IMAGE))
+        LoadImageData(searchPath, zone);
+}
+
+void ObjLoader::PrefetchAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets) const
+{
+    const AssetLoadingManager assetLoadingManager(m_asset_loaders_by_type, *context);
+    assetLoadingManager.PrefetchAssets(assets);
 }
 
 bool ObjLoader::LoadAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName) const
@@ -219,6 +230,12 @@ bool ObjLoader::LoadAssetForZone(AssetLoadingContext* context, asset_type_t asse
     return assetLoadingManager.LoadAssetFromLoader(assetType, assetName);
 }
 
+bool ObjLoader::LoadAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets) const
+{
+    AssetLoadingManager assetLoadingManager(m_asset_loaders_by_type, *context);
+    return assetLoadingManager.LoadAssetsFromLoader(assets);
+}
+
 void ObjLoader::FinalizeAssetsForZone(AssetLoadingContext* context) const
 {
     for (const auto& [type, loader] : m_asset_loaders_by_type)
@@ -4,6 +4,7 @@
 #include "Game/IW5/Menu/MenuConversionZoneStateIW5.h"
 #include "Game/IW5/Menu/MenuConverterIW5.h"
 #include "ObjLoading.h"
+#include "Parsing/Menu/MenuFileParallelReader.h"
 #include "Parsing/Menu/MenuFileReader.h"
 #include "Pool/GlobalAssetPool.h"
 
@@ -93,7 +94,7 @@ namespace IW5
         }
 
         static std::unique_ptr<menu::ParsingResult>
-            ParseMenuFile(const std::string& menuFileName, ISearchPath* searchPath, const menu::MenuAssetZoneState* zoneState)
+            ParseMenuFile(const std::string& menuFileName, ISearchPath* searchPath, menu::MenuAssetZoneState* zoneState, std::ostream& errorStream)
         {
             const auto file = searchPath->Open(menuFileName);
             if (!file.IsOpen())
@@ -109,10 +110,12 @@ namespace IW5
                                                 return nullptr;
 
                                             return std::move(foundFileToInclude.m_stream);
-                                        });
+                                        },
+                                        &zoneState->m_include_cache);
 
             reader.IncludeZoneState(zoneState);
             reader.SetPermissiveMode(ObjLoading::Configuration.MenuPermissiveParsing);
+            reader.SetErrorStream(errorStream);
 
             return reader.ReadMenuFile();
         }
@@ -146,7 +149,7 @@ bool BuildMenuFileQueue(std::deque<std::string>& menuLoadQueue,
 
     if (alreadyLoadedMenuListFileMenus == conversionState->m_menus_by_filename.end())
     {
-        const auto menuListResult = MenuLoader::ParseMenuFile(menuListAssetName, searchPath, zoneState);
+        const auto menuListResult = MenuLoader::ParseMenuFile(menuListAssetName, searchPath, zoneState, std::cerr);
         if (menuListResult)
         {
             MenuLoader::ProcessParsedResults(
@@ -165,6 +168,7 @@ bool BuildMenuFileQueue(std::deque<std::string>& menuLoadQueue,
 }
 
 void LoadMenuFileFromQueue(const std::string& menuFilePath,
+                           menu::MenuFileParallelReader& reader,
                            ISearchPath* searchPath,
                            MemoryManager* memory,
                            IAssetLoadingManager* manager,
@@ -185,7 +189,7 @@ void LoadMenuFileFromQueue(const std::string& menuFilePath,
         return;
     }
 
-    const auto menuFileResult = MenuLoader::ParseMenuFile(menuFilePath, searchPath, zoneState);
+    const auto menuFileResult = reader.ReadMenuFile(menuFilePath);
     if (menuFileResult)
     {
         MenuLoader::ProcessParsedResults(
@@ -210,11 +214,28 @@ bool AssetLoaderMenuList::LoadFromRaw(
     if (!BuildMenuFileQueue(menuLoadQueue, assetName, searchPath, memory, manager, zoneState, conversionState, menus, menuListDependencies))
         return false;
 
+    // The menu files are parsed ahead of time but are still loaded in the order of the menu list
+    menu::MenuFileParallelReader reader(
+        zoneState,
+        [searchPath, zoneState](const std::string& menuFileName, std::ostream& errorStream)
+        {
+            return MenuLoader::ParseMenuFile(menuFileName, searchPath, zoneState, errorStream);
+        },
+        ObjLoading::Configuration.MenuParseWorkerCount);
+
+    std::vector<std::string> menuFilesToParse;
+    for (const auto& menuFileToLoad : menuLoadQueue)
+    {
+        if (!conversionState->m_menus_by_filename.contains(menuFileToLoad))
+            menuFilesToParse.emplace_back(menuFileToLoad);
+    }
+    reader.Start(menuFilesToParse);
+
     while (!menuLoadQueue.empty())
     {
         const auto& menuFileToLoad = menuLoadQueue.front();
 
-        LoadMenuFileFromQueue(menuFileToLoad, searchPath, memory, manager, zoneState, conversionState, menus, menuListDependencies);
+        LoadMenuFileFromQueue(menuFileToLoad, reader, searchPath, memory, manager, zoneState, conversionState, menus, menuListDependencies);
 
         menuLoadQueue.pop_front();
     }
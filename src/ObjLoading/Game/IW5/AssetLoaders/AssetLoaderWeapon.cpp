@@ -7,6 +7,7 @@
 #include "InfoString/InfoString.h"
 #include "ObjLoading.h"
 #include "Pool/GlobalAssetPool.h"
+#include "Utils/AllocationLayout.h"
 #include "Utils/StringUtils.h"
 #include "Weapon/AccuracyGraphLoader.h"
 
@@ -69,13 +70,24 @@ namespace
                 return true;
             }
 
-            *perSurfaceTypeSound = m_memory->Alloc<SndAliasCustom>(SURF_TYPE_COUNT);
+            // The sound of every surface type has its own name, which are all allocated together with the sounds
+            std::string soundNames[SURF_TYPE_COUNT];
+            AllocationLayout layout;
+            layout.Reserve<SndAliasCustom>(SURF_TYPE_COUNT);
+            layout.Reserve<snd_alias_list_name>(SURF_TYPE_COUNT);
             for (auto i = 0u; i < SURF_TYPE_COUNT; i++)
             {
-                const auto currentPerSurfaceTypeSound = value + surfaceTypeSoundSuffixes[i];
+                soundNames[i] = value + surfaceTypeSoundSuffixes[i];
+                layout.ReserveString(soundNames[i]);
+            }
+            layout.Allocate(*m_memory);
 
-                (*perSurfaceTypeSound)[i].name = m_memory->Alloc<snd_alias_list_name>();
-                (*perSurfaceTypeSound)[i].name->soundName = m_memory->Dup(currentPerSurfaceTypeSound.c_str());
+            *perSurfaceTypeSound = layout.Take<SndAliasCustom>(SURF_TYPE_COUNT);
+            auto* names = layout.Take<snd_alias_list_name>(SURF_TYPE_COUNT);
+            for (auto i = 0u; i < SURF_TYPE_COUNT; i++)
+            {
+                names[i].soundName = layout.TakeString(soundNames[i]);
+                (*perSurfaceTypeSound)[i].name = &names[i];
             }
 
             return true;
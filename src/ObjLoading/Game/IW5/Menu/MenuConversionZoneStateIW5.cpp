@@ -4,6 +4,55 @@
 
 using namespace IW5;
 
+namespace
+{
+    std::string GetStatementKey(const Statement_s& statement)
+    {
+        std::string key;
+        const auto appendValue = [&key](const auto& value)
+        {
+            key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+        };
+
+        // Entries are added field by field to not compare padding or unused parts of the unions
+        appendValue(statement.supportingData);
+        for (auto i = 0; i < statement.numEntries; i++)
+        {
+            const auto& entry = statement.entries[i];
+            appendValue(entry.type);
+
+            if (entry.type == EET_OPERATOR)
+            {
+                appendValue(entry.data.op);
+                continue;
+            }
+
+            const auto& operand = entry.data.operand;
+            appendValue(operand.dataType);
+            switch (operand.dataType)
+            {
+            case VAL_INT:
+                appendValue(operand.internals.intVal);
+                break;
+            case VAL_FLOAT:
+                appendValue(operand.internals.floatVal);
+                break;
+            case VAL_STRING:
+                // Strings are deduplicated, so equal strings have the same address
+                appendValue(operand.internals.stringVal.string);
+                break;
+            case VAL_FUNCTION:
+                appendValue(operand.internals.function);
+                break;
+            default:
+                break;
+            }
+        }
+
+        return key;
+    }
+} // namespace
+
 MenuConversionZoneState::MenuConversionZoneState()
     : m_zone(nullptr),
       m_supporting_data(nullptr)
@@ -73,6 +122,21 @@ const char* MenuConversionZoneState::AddString(const std::string& str)
     return strDuped;
 }
 
+Statement_s* MenuConversionZoneState::FindStatement(const Statement_s& statement) const
+{
+    const auto foundStatement = m_statements_by_entries.find(GetStatementKey(statement));
+
+    if (foundStatement != m_statements_by_entries.end())
+        return foundStatement->second;
+
+    return nullptr;
+}
+
+void MenuConversionZoneState::AddStatement(Statement_s* statement)
+{
+    m_statements_by_entries.emplace(GetStatementKey(*statement), statement);
+}
+
 void MenuConversionZoneState::AddLoadedFile(std::string loadedFileName, std::vector<XAssetInfo<menuDef_t>*> menusOfFile)
 {
     m_menus_by_filename.emplace(std::make_pair(std::move(loadedFileName), std::move(menusOfFile)));
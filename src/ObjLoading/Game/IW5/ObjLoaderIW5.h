@@ -3,7 +3,9 @@
 #include "AssetLoading/IAssetLoader.h"
 #include "Game/IW5/IW5.h"
 #include "IObjLoader.h"
+#include "Image/Texture.h"
 #include "SearchPath/ISearchPath.h"
+#include "Utils/MemoryManager.h"
 
 #include <map>
 #include <memory>
@@ -14,7 +16,8 @@ namespace IW5
     {
         std::map<asset_type_t, std::unique_ptr<IAssetLoader>> m_asset_loaders_by_type;
 
-        static void LoadImageFromIwi(GfxImage* image, ISearchPath* searchPath, Zone* zone);
+        static void AttachTextureToImage(GfxImage* image, Texture* texture);
+        static Texture* LoadImageFromIwi(const GfxImage* image, ISearchPath* searchPath, MemoryManager* memory);
         static void LoadImageFromLoadDef(GfxImage* image, Zone* zone);
         static void LoadImageData(ISearchPath* searchPath, Zone* zone);
 
@@ -26,12 +29,14 @@ namespace IW5
 
         bool SupportsZone(Zone* zone) const override;
 
-        void LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone) const override;
+        void LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad) const override;
         void UnloadContainersOfZone(Zone* zone) const override;
 
-        void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone) const override;
+        void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad) const override;
 
+        void PrefetchAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets) const override;
         bool LoadAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName) const override;
+        bool LoadAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets) const override;
         void FinalizeAssetsForZone(AssetLoadingContext* context) const override;
     };
 } // namespace IW5
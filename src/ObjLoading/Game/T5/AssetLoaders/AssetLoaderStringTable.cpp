@@ -23,6 +23,16 @@ bool AssetLoaderStringTable::CanLoadFromRaw() const
     return true;
 }
 
+bool AssetLoaderStringTable::CanLoadFromRawInParallel() const
+{
+    return true;
+}
+
+std::string AssetLoaderStringTable::GetRawFileName(const std::string& assetName) const
+{
+    return assetName;
+}
+
 bool AssetLoaderStringTable::LoadFromRaw(
     const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
 {
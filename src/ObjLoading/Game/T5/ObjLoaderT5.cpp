@@ -75,7 +75,7 @@ bool ObjLoader::IsZmZone(Zone* zone)
     return zone->m_name.compare(0, 3, "zm_") == 0 || zone->m_name.compare(zone->m_name.length() - 3, 3, "_zm") == 0;
 }
 
-void ObjLoader::LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone) const {}
+void ObjLoader::LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad) const {}
 
 void ObjLoader::UnloadContainersOfZone(Zone* zone) const {}
 
@@ -95,7 +95,7 @@ void ObjLoader::LoadImageFromLoadDef(GfxImage* image, Zone* zone)
 
     textureLoader.Format(static_cast<oat::D3DFORMAT>(loadDef->format));
     textureLoader.HasMipMaps(!(loadDef->flags & iwi13::IMG_FLAG_NOMIPMAPS));
-    Texture* loadedTexture = textureLoader.LoadTexture(image->texture.loadDef->data);
+    Texture* loadedTexture = textureLoader.LoadTextureInPlace(image->texture.loadDef->data);
 
     if (loadedTexture != nullptr)
     {
@@ -171,9 +171,16 @@ void ObjLoader::LoadImageData(ISearchPath* searchPath, Zone* zone)
     }
 }
 
-void ObjLoader::LoadObjDataForZone(ISearchPath* searchPath, Zone* zone) const
+void ObjLoader::LoadObjDataForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad) const
 {
-    LoadImageData(searchPath, zone);
+    if (ObjLoading::ShouldLoadAssetType(assetTypesToLoad, ASSET_TYPE_IMAGE))
+        LoadImageData(searchPath, zone);
+}
+
+void ObjLoader::PrefetchAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets) const
+{
+    const AssetLoadingManager assetLoadingManager(m_asset_loaders_by_type, *context);
+    assetLoadingManager.PrefetchAssets(assets);
 }
 
 bool ObjLoader::LoadAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName) const
@@ -182,6 +189,12 @@ bool ObjLoader::LoadAssetForZone(AssetLoadingContext* context, asset_type_t asse
     return assetLoadingManager.LoadAssetFromLoader(assetType, assetName);
 }
 
+bool ObjLoader::LoadAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets) const
+{
+    AssetLoadingManager assetLoadingManager(m_asset_loaders_by_type, *context);
+    return assetLoadingManager.LoadAssetsFromLoader(assets);
+}
+
 void ObjLoader::FinalizeAssetsForZone(AssetLoadingContext* context) const
 {
     for (const auto& [type, loader] : m_asset_loaders_by_type)
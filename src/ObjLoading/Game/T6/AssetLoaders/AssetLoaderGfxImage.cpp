@@ -7,7 +7,7 @@
 
 #include <cstring>
 #include <iostream>
-#include <sstream>
+#include <span>
 #include <zlib.h>
 
 using namespace T6;
@@ -25,10 +25,20 @@ bool AssetLoaderGfxImage::CanLoadFromRaw() const
     return true;
 }
 
+bool AssetLoaderGfxImage::CanLoadFromRawInParallel() const
+{
+    return true;
+}
+
+std::string AssetLoaderGfxImage::GetRawFileName(const std::string& assetName) const
+{
+    return "images/" + assetName + ".iwi";
+}
+
 bool AssetLoaderGfxImage::LoadFromRaw(
     const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
 {
-    const auto fileName = "images/" + assetName + ".iwi";
+    const auto fileName = GetRawFileName(assetName);
     const auto file = searchPath->Open(fileName);
     if (!file.IsOpen())
         return false;
@@ -40,8 +50,7 @@ bool AssetLoaderGfxImage::LoadFromRaw(
 
     MemoryManager tempMemory;
     IwiLoader iwiLoader(&tempMemory);
-    std::istringstream ss(std::string(fileData.get(), fileSize));
-    const auto texture = iwiLoader.LoadIwi(ss);
+    const auto texture = iwiLoader.LoadIwi(std::span(reinterpret_cast<const uint8_t*>(fileData.get()), fileSize));
     if (!texture)
     {
         std::cerr << "Failed to load texture from: " << fileName << "\n";
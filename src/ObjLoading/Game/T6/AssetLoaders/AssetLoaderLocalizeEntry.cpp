@@ -1,6 +1,7 @@
 #include "AssetLoaderLocalizeEntry.h"
 
 #include "Localize/LocalizeCommonAssetLoader.h"
+#include "Localize/LocalizeReadingZoneState.h"
 
 using namespace T6;
 
@@ -19,18 +20,35 @@ bool AssetLoaderLocalizeEntry::CanLoadFromRaw() const
     return true;
 }
 
+bool AssetLoaderLocalizeEntry::CanLoadFromRawInParallel() const
+{
+    return true;
+}
+
+bool AssetLoaderLocalizeEntry::CanShareLoadedRawAssets() const
+{
+    // Duplicate keys are checked against all localize files of the zone
+    return false;
+}
+
 bool AssetLoaderLocalizeEntry::LoadFromRaw(
     const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager, Zone* zone) const
 {
+    auto* zoneState = manager->GetAssetLoadingContext()->GetZoneAssetLoaderState<LocalizeReadingZoneState>();
     const LocalizeCommonAssetLoader commonLoader(
-        [memory, manager](const CommonLocalizeEntry& entry)
+        [memory, manager, zoneState](const CommonLocalizeEntry& entry)
         {
             auto* localizeEntry = memory->Create<LocalizeEntry>();
-            localizeEntry->name = memory->Dup(entry.m_key.c_str());
-            localizeEntry->value = memory->Dup(entry.m_value.c_str());
+            localizeEntry->name = zoneState->InternString(entry.m_key);
+            localizeEntry->value = zoneState->InternString(entry.m_value);
 
             manager->AddAsset<AssetLocalize>(entry.m_key, localizeEntry);
         });
 
     return commonLoader.LoadLocalizeAsset(assetName, searchPath, manager, zone);
 }
+
+void AssetLoaderLocalizeEntry::OnAssetAdded(const XAssetInfoGeneric& assetInfo, AssetLoadingContext* context) const
+{
+    LocalizeCommonAssetLoader::CheckForDuplicateEntry(assetInfo.m_name, context);
+}
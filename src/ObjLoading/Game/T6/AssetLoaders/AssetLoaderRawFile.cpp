@@ -26,6 +26,16 @@ bool AssetLoaderRawFile::CanLoadFromRaw() const
     return true;
 }
 
+bool AssetLoaderRawFile::CanLoadFromRawInParallel() const
+{
+    return true;
+}
+
+std::string AssetLoaderRawFile::GetRawFileName(const std::string& assetName) const
+{
+    return assetName;
+}
+
 bool AssetLoaderRawFile::LoadAnimtree(
     const SearchPathOpenFile& file, const std::string& assetName, ISearchPath* searchPath, MemoryManager* memory, IAssetLoadingManager* manager)
 {
@@ -4,6 +4,7 @@
 #include "Game/T6/CommonT6.h"
 #include "Game/T6/SoundConstantsT6.h"
 #include "Game/T6/T6.h"
+#include "Json/JsonInput.h"
 #include "ObjContainer/SoundBank/SoundBankWriter.h"
 #include "Pool/GlobalAssetPool.h"
 #include "Utils/StringUtils.h"
@@ -402,7 +403,7 @@ bool LoadSoundDuckList(ISearchPath* searchPath, MemoryManager* memory, SndBank*
             strncpy(duck->name, name.data(), 32);
             duck->id = Common::SND_HashName(name.data());
 
-            auto duckJson = nlohmann::json::parse(*duckFile.m_stream);
+            auto duckJson = json_input::Parse(*duckFile.m_stream);
             duck->fadeIn = duckJson["fadeIn"].get<float>();
             duck->fadeOut = duckJson["fadeOut"].get<float>();
             duck->startDelay = duckJson["startDelay"].get<float>();
@@ -2,10 +2,13 @@
 
 #include "Game/T6/CommonT6.h"
 #include "Game/T6/Json/JsonMaterial.h"
+#include "Json/JsonInput.h"
+#include "Material/MaterialTablePool.h"
 
 #include <format>
 #include <iostream>
 #include <nlohmann/json.hpp>
+#include <vector>
 
 using namespace nlohmann;
 using namespace T6;
@@ -26,21 +29,21 @@ namespace
 
         bool Load(Material& material) const
         {
-            const auto jRoot = json::parse(m_stream);
-            std::string type;
-            unsigned version;
+            try
+            {
+                const auto jRoot = json_input::Parse(m_stream);
+                std::string type;
+                unsigned version;
 
-            jRoot.at("_type").get_to(type);
-            jRoot.at("_version").get_to(version);
+                jRoot.at("_type").get_to(type);
+                jRoot.at("_version").get_to(version);
 
-            if (type != "material" || version != 1u)
-            {
-                std::cerr << "Tried to load material \"" << material.info.name << "\" but did not find expected type material of version 1\n";
-                return false;
-            }
+                if (type != "material" || version != 1u)
+                {
+                    std::cerr << "Tried to load material \"" << material.info.name << "\" but did not find expected type material of version 1\n";
+                    return false;
+                }
 
-            try
-            {
                 const auto jMaterial = jRoot.get<JsonMaterial>();
                 return CreateMaterialFromJson(jMaterial, material);
             }
@@ -310,39 +313,28 @@ namespace
                 material.textureTable = nullptr;
             }
 
-            if (!jMaterial.constants.empty())
-            {
-                material.constantCount = static_cast<unsigned char>(jMaterial.constants.size());
-                material.constantTable = m_memory.Alloc<MaterialConstantDef>(material.constantCount);
-
-                for (auto i = 0u; i < material.constantCount; i++)
-                {
-                    if (!CreateConstantDefFromJson(jMaterial.constants[i], material.constantTable[i], material))
-                        return false;
-                }
-            }
-            else
+            // Materials with identical tables share them which makes the zone writer only write them once
+            std::vector<MaterialConstantDef> constants(jMaterial.constants.size());
+            for (auto i = 0u; i < constants.size(); i++)
             {
-                material.constantCount = 0;
-                material.constantTable = nullptr;
+                if (!CreateConstantDefFromJson(jMaterial.constants[i], constants[i], material))
+                    return false;
             }
+            material.constantCount = static_cast<unsigned char>(constants.size());
+            material.constantTable = m_manager.GetAssetLoadingContext()
+                                         ->GetZoneAssetLoaderState<material::MaterialTablePool<MaterialConstantDef>>()
+                                         ->GetTable(m_memory, constants.data(), constants.size());
 
-            if (!jMaterial.stateBits.empty())
+            std::vector<GfxStateBitsTable> stateBits(jMaterial.stateBits.size());
+            for (auto i = 0u; i < stateBits.size(); i++)
             {
-                material.stateBitsCount = static_cast<unsigned char>(jMaterial.stateBits.size());
-                material.stateBitsTable = m_memory.Alloc<GfxStateBitsTable>(material.stateBitsCount);
-
-                for (auto i = 0u; i < material.stateBitsCount; i++)
-                {
-                    if (!CreateStateBitsTableEntryFromJson(jMaterial.stateBits[i], material.stateBitsTable[i], material))
-                        return false;
-                }
-            }
-            else
-            {
-                material.stateBitsCount = 0;
-                material.stateBitsTable = nullptr;
+                if (!CreateStateBitsTableEntryFromJson(jMaterial.stateBits[i], stateBits[i], material))
+                    return false;
             }
+            material.stateBitsCount = static_cast<unsigned char>(stateBits.size());
+            material.stateBitsTable = m_manager.GetAssetLoadingContext()
+                                          ->GetZoneAssetLoaderState<material::MaterialTablePool<GfxStateBitsTable>>()
+                                          ->GetTable(m_memory, stateBits.data(), stateBits.size());
 
             if (jMaterial.thermalMaterial)
             {
@@ -28,11 +28,13 @@
 #include "Image/Dx12TextureLoader.h"
 #include "Image/IwiLoader.h"
 #include "Image/IwiTypes.h"
+#include "Image/ParallelTextureLoader.h"
 #include "Image/Texture.h"
 #include "ObjContainer/IPak/IPak.h"
 #include "ObjLoading.h"
 
 #include <sstream>
+#include <vector>
 
 namespace T6
 {
@@ -129,28 +131,39 @@ namespace T6
             return existingSoundBank;
         }
 
-        auto file = searchPath->Open(soundBankFileName);
-        if (file.IsOpen())
+        // Mapped sound banks allow dumping their entries from multiple threads at once
+        std::unique_ptr<SoundBank> sndBank;
+        MemoryMappedFile mappedFile;
+        if (searchPath->OpenMapped(soundBankFileName, mappedFile))
         {
-            auto sndBank = std::make_unique<SoundBank>(soundBankFileName, std::move(file.m_stream), file.m_length);
-            auto* sndBankPtr = sndBank.get();
-
-            if (!sndBank->Initialize())
+            sndBank = std::make_unique<SoundBank>(soundBankFileName, std::move(mappedFile));
+        }
+        else
+        {
+            auto file = searchPath->Open(soundBankFileName);
+            if (!file.IsOpen())
             {
                 std::cout << "Failed to load sound bank '" << soundBankFileName << "'\n";
                 return nullptr;
             }
 
-            SoundBank::Repository.AddContainer(std::move(sndBank), zone);
+            sndBank = std::make_unique<SoundBank>(soundBankFileName, std::move(file.m_stream), file.m_length);
+        }
 
-            if (ObjLoading::Configuration.Verbose)
-                std::cout << "Found and loaded sound bank '" << soundBankFileName << "'\n";
+        auto* sndBankPtr = sndBank.get();
 
-            return sndBankPtr;
+        if (!sndBank->Initialize())
+        {
+            std::cout << "Failed to load sound bank '" << soundBankFileName << "'\n";
+            return nullptr;
         }
 
-        std::cout << "Failed to load sound bank '" << soundBankFileName << "'\n";
-        return nullptr;
+        SoundBank::Repository.AddContainer(std::move(sndBank), zone);
+
+        if (ObjLoading::Configuration.Verbose)
+            std::cout << "Found and loaded sound bank '" << soundBankFileName << "'\n";
+
+        return sndBankPtr;
     }
 
     void ObjLoader::LoadSoundBankFromLinkedInfo(ISearchPath* searchPath,
@@ -300,14 +313,19 @@ namespace T6
         }
     }
 
-    void ObjLoader::LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone) const
+    void ObjLoader::LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad) const
     {
         auto* assetPoolT6 = dynamic_cast<GameAssetPoolT6*>(zone->m_pools.get());
         const auto zoneNameHash = Common::Com_HashKey(zone->m_name.c_str(), 64);
 
-        LoadCommonIPaks(searchPath, zone);
+        // IPaks only contain image data and sound banks only sounds, so they do not need to be opened when these assets are not handled
+        const auto loadIPaks = ObjLoading::ShouldLoadAssetType(assetTypesToLoad, ASSET_TYPE_IMAGE);
+        const auto loadSoundBanks = ObjLoading::ShouldLoadAssetType(assetTypesToLoad, ASSET_TYPE_SOUND);
 
-        if (assetPoolT6->m_key_value_pairs != nullptr)
+        if (loadIPaks)
+            LoadCommonIPaks(searchPath, zone);
+
+        if (loadIPaks && assetPoolT6->m_key_value_pairs != nullptr)
         {
             for (auto* keyValuePairsEntry : *assetPoolT6->m_key_value_pairs)
             {
@@ -324,7 +342,7 @@ namespace T6
             }
         }
 
-        if (assetPoolT6->m_sound_bank != nullptr)
+        if (loadSoundBanks && assetPoolT6->m_sound_bank != nullptr)
         {
             std::set<std::string> loadedSoundBanksForZone;
 
@@ -340,6 +358,16 @@ namespace T6
         IPak::Repository.RemoveContainerReferences(zone);
     }
 
+    void ObjLoader::AttachTextureToImage(GfxImage* image, Texture* texture)
+    {
+        image->texture.texture = texture;
+        image->loadedSize = 0;
+
+        const auto textureMipCount = texture->GetMipMapCount();
+        for (auto mipLevel = 0; mipLevel < textureMipCount; mipLevel++)
+            image->loadedSize += static_cast<int>(texture->GetSizeOfMipLevel(mipLevel) * texture->GetFaceCount());
+    }
+
     void ObjLoader::LoadImageFromLoadDef(GfxImage* image, Zone* zone)
     {
         const auto* loadDef = image->texture.loadDef;
@@ -356,70 +384,86 @@ namespace T6
 
         textureLoader.Format(static_cast<oat::DXGI_FORMAT>(loadDef->format));
         textureLoader.HasMipMaps(!(loadDef->flags & iwi27::IMG_FLAG_NOMIPMAPS));
-        Texture* loadedTexture = textureLoader.LoadTexture(image->texture.loadDef->data);
+        Texture* loadedTexture = textureLoader.LoadTextureInPlace(image->texture.loadDef->data);
 
         if (loadedTexture != nullptr)
-        {
-            image->texture.texture = loadedTexture;
-            image->loadedSize = 0;
+            AttachTextureToImage(image, loadedTexture);
+    }
+
+    IPak* ObjLoader::FindIPakWithImageData(const GfxImage* image)
+    {
+        if (image->streamedPartCount <= 0)
+            return nullptr;
 
-            const auto textureMipCount = loadedTexture->GetMipMapCount();
-            for (auto mipLevel = 0; mipLevel < textureMipCount; mipLevel++)
-                image->loadedSize += static_cast<int>(loadedTexture->GetSizeOfMipLevel(mipLevel) * loadedTexture->GetFaceCount());
+        const auto ipakLock = IPak::Repository.Lock();
+        for (auto* ipak : IPak::Repository)
+        {
+            if (ipak->HasEntry(image->hash, image->streamedParts[0].hash))
+                return ipak;
         }
+
+        return nullptr;
     }
 
-    void ObjLoader::LoadImageFromIwi(GfxImage* image, ISearchPath* searchPath, Zone* zone)
+    Texture* ObjLoader::LoadImageFromIPak(const GfxImage* image, const IPak* ipak, MemoryManager* memory)
     {
-        Texture* loadedTexture = nullptr;
-        IwiLoader loader(zone->GetMemory());
+        const auto ipakStream = ipak->GetEntryStream(image->hash, image->streamedParts[0].hash);
+        if (!ipakStream)
+            return nullptr;
 
-        if (image->streamedPartCount > 0)
-        {
-            for (auto* ipak : IPak::Repository)
-            {
-                auto ipakStream = ipak->GetEntryStream(image->hash, image->streamedParts[0].hash);
+        IwiLoader loader(memory);
+        auto* loadedTexture = loader.LoadIwi(*ipakStream);
+        ipakStream->close();
 
-                if (ipakStream)
-                {
-                    loadedTexture = loader.LoadIwi(*ipakStream);
+        return loadedTexture;
+    }
 
-                    ipakStream->close();
+    bool ObjLoader::CanLoadImageDataOnDemand(const GfxImage* image)
+    {
+        if (!ObjLoading::Configuration.LoadImageDataOnDemand || image->loadedSize > 0)
+            return false;
 
-                    if (loadedTexture != nullptr)
-                    {
-                        break;
-                    }
-                }
-            }
-        }
+        // Linked assets are not loaded
+        if (image->name && image->name[0] == ',')
+            return false;
+
+        return FindIPakWithImageData(image) != nullptr;
+    }
 
-        if (loadedTexture == nullptr)
+    Texture* ObjLoader::LoadImageDataOnDemand(const GfxImage* image, Zone* zone, MemoryManager* memory)
+    {
+        IPak* ipak;
         {
-            const auto imageFileName = "images/" + std::string(image->name) + ".iwi";
+            const auto ipakLock = IPak::Repository.Lock();
+            ipak = FindIPakWithImageData(image);
+            if (ipak == nullptr)
+                return nullptr;
 
-            {
-                const auto filePathImage = searchPath->Open(imageFileName);
-                if (filePathImage.IsOpen())
-                {
-                    loadedTexture = loader.LoadIwi(*filePathImage.m_stream);
-                }
-            }
+            // Referencing the ipak keeps it loaded until the zone is unloaded, so it can be read without holding the lock while other zones are unloaded
+            IPak::Repository.AddContainerReference(ipak, zone);
         }
 
-        if (loadedTexture != nullptr)
-        {
-            image->texture.texture = loadedTexture;
-            image->loadedSize = 0;
+        return LoadImageFromIPak(image, ipak, memory);
+    }
 
-            const auto textureMipCount = loadedTexture->GetMipMapCount();
-            for (auto mipLevel = 0; mipLevel < textureMipCount; mipLevel++)
-                image->loadedSize += loadedTexture->GetSizeOfMipLevel(mipLevel) * loadedTexture->GetFaceCount();
-        }
-        else
+    Texture* ObjLoader::LoadImageFromIwi(const GfxImage* image, ISearchPath* searchPath, MemoryManager* memory)
+    {
+        // The ipak is found with a lookup in the index of every ipak instead of opening an entry stream of each of them
+        const auto* ipak = FindIPakWithImageData(image);
+        if (ipak != nullptr)
         {
-            printf("Could not find data for image \"%s\"\n", image->name);
+            auto* loadedTexture = LoadImageFromIPak(image, ipak, memory);
+            if (loadedTexture != nullptr)
+                return loadedTexture;
         }
+
+        const auto imageFileName = "images/" + std::string(image->name) + ".iwi";
+        const auto filePathImage = searchPath->Open(imageFileName);
+        if (!filePathImage.IsOpen())
+            return nullptr;
+
+        IwiLoader loader(memory);
+        return loader.LoadIwi(*filePathImage.m_stream);
     }
 
     void ObjLoader::LoadImageData(ISearchPath* searchPath, Zone* zone)
@@ -428,6 +472,7 @@ namespace T6
 
         if (assetPoolT6 && assetPoolT6->m_image != nullptr)
         {
+            std::vector<GfxImage*> imagesToLoad;
             for (auto* imageEntry : *assetPoolT6->m_image)
             {
                 auto* image = imageEntry->Asset();
@@ -445,19 +490,49 @@ namespace T6
 
                 if (image->texture.loadDef && image->texture.loadDef->resourceSize > 0)
                 {
+                    // Images with data inside the zone are used in place and do not take up additional memory
                     LoadImageFromLoadDef(image, zone);
                 }
+                else if (CanLoadImageDataOnDemand(image))
+                {
+                    // Decoding the data of every image of the zone up front would keep all of them in memory until the zone is unloaded.
+                    // The image dumper loads them one at a time instead and releases them after dumping.
+                    continue;
+                }
                 else
                 {
-                    LoadImageFromIwi(image, searchPath, zone);
+                    imagesToLoad.emplace_back(image);
                 }
             }
+
+            parallel_texture_loader::LoadTextures(
+                *zone->GetMemory(),
+                imagesToLoad.size(),
+                [&imagesToLoad, searchPath](const size_t index, MemoryManager& memory)
+                {
+                    return LoadImageFromIwi(imagesToLoad[index], searchPath, &memory);
+                },
+                [&imagesToLoad](const size_t index, Texture* texture)
+                {
+                    auto* image = imagesToLoad[index];
+                    if (texture != nullptr)
+                        AttachTextureToImage(image, texture);
+                    else
+                        printf("Could not find data for image \"%s\"\n", image->name);
+                });
         }
     }
 
-    void ObjLoader::LoadObjDataForZone(ISearchPath* searchPath, Zone* zone) const
+    void ObjLoader::LoadObjDataForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad) const
     {
-        LoadImageData(searchPath, zone);
+        if (ObjLoading::ShouldLoadAssetType(assetTypesToLoad, ASSET_TYPE_IMAGE))
+            LoadImageData(searchPath, zone);
+    }
+
+    void ObjLoader::PrefetchAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets) const
+    {
+        const AssetLoadingManager assetLoadingManager(m_asset_loaders_by_type, *context);
+        assetLoadingManager.PrefetchAssets(assets);
     }
 
     bool ObjLoader::LoadAssetForZone(AssetLoadingContext* context, const asset_type_t assetType, const std::string& assetName) const
@@ -466,6 +541,12 @@ namespace T6
         return assetLoadingManager.LoadAssetFromLoader(assetType, assetName);
     }
 
+    bool ObjLoader::LoadAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets) const
+    {
+        AssetLoadingManager assetLoadingManager(m_asset_loaders_by_type, *context);
+        return assetLoadingManager.LoadAssetsFromLoader(assets);
+    }
+
     void ObjLoader::FinalizeAssetsForZone(AssetLoadingContext* context) const
     {
         for (const auto& [type, loader] : m_asset_loaders_by_type)
@@ -3,8 +3,11 @@
 #include "AssetLoading/IAssetLoader.h"
 #include "Game/T6/T6.h"
 #include "IObjLoader.h"
+#include "Image/Texture.h"
+#include "ObjContainer/IPak/IPak.h"
 #include "ObjContainer/SoundBank/SoundBank.h"
 #include "SearchPath/ISearchPath.h"
+#include "Utils/MemoryManager.h"
 
 #include <map>
 #include <memory>
@@ -33,7 +36,10 @@ namespace T6
 
         static void LoadIPakForZone(ISearchPath* searchPath, const std::string& ipakName, Zone* zone);
 
-        static void LoadImageFromIwi(GfxImage* image, ISearchPath* searchPath, Zone* zone);
+        static void AttachTextureToImage(GfxImage* image, Texture* texture);
+        static IPak* FindIPakWithImageData(const GfxImage* image);
+        static Texture* LoadImageFromIPak(const GfxImage* image, const IPak* ipak, MemoryManager* memory);
+        static Texture* LoadImageFromIwi(const GfxImage* image, ISearchPath* searchPath, MemoryManager* memory);
         static void LoadImageFromLoadDef(GfxImage* image, Zone* zone);
         static void LoadImageData(ISearchPath* searchPath, Zone* zone);
 
@@ -44,14 +50,32 @@ namespace T6
     public:
         ObjLoader();
 
+        /**
+         * \brief Checks whether the data of an image was left to be loaded on demand when loading the obj data of its zone.
+         * \param image The image to check.
+         * \return \c true if the data of the image can be loaded with \c LoadImageDataOnDemand, \c false otherwise.
+         */
+        static bool CanLoadImageDataOnDemand(const GfxImage* image);
+
+        /**
+         * \brief Loads the data of an image from the ipak that contains it. Can be called from multiple threads at once.
+         * \param image The image to load the data of.
+         * \param zone The zone of the image. The ipak is kept loaded until the zone is unloaded.
+         * \param memory The memory to allocate the texture in. The texture is released together with the memory.
+         * \return The texture of the image or \c nullptr if it could not be loaded.
+         */
+        static Texture* LoadImageDataOnDemand(const GfxImage* image, Zone* zone, MemoryManager* memory);
+
         bool SupportsZone(Zone* zone) const override;
 
-        void LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone) const override;
+        void LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad) const override;
         void UnloadContainersOfZone(Zone* zone) const override;
 
-        void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone) const override;
+        void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad) const override;
 
+        void PrefetchAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets) const override;
         bool LoadAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName) const override;
+        bool LoadAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets) const override;
         void FinalizeAssetsForZone(AssetLoadingContext* context) const override;
     };
 } // namespace T6
@@ -2,6 +2,7 @@
 
 #include "Game/T6/CommonT6.h"
 #include "Game/T6/Json/JsonWeaponCamo.h"
+#include "Json/JsonInput.h"
 
 #include <format>
 #include <iostream>
@@ -26,21 +27,21 @@ namespace
 
         bool Load(WeaponCamo& weaponCamo) const
         {
-            const auto jRoot = json::parse(m_stream);
-            std::string type;
-            unsigned version;
+            try
+            {
+                const auto jRoot = json_input::Parse(m_stream);
+                std::string type;
+                unsigned version;
 
-            jRoot.at("_type").get_to(type);
-            jRoot.at("_version").get_to(version);
+                jRoot.at("_type").get_to(type);
+                jRoot.at("_version").get_to(version);
 
-            if (type != "weaponCamo" || version != 1u)
-            {
-                std::cerr << "Tried to load weapon camo \"" << weaponCamo.name << "\" but did not find expected type weaponCamo of version 1\n";
-                return false;
-            }
+                if (type != "weaponCamo" || version != 1u)
+                {
+                    std::cerr << "Tried to load weapon camo \"" << weaponCamo.name << "\" but did not find expected type weaponCamo of version 1\n";
+                    return false;
+                }
 
-            try
-            {
                 const auto jWeaponCamo = jRoot.get<JsonWeaponCamo>();
                 return CreateWeaponCamoFromJson(jWeaponCamo, weaponCamo);
             }
@@ -3,12 +3,18 @@
 #include "Csv/CsvStream.h"
 #include "Game/T6/CommonT6.h"
 #include "Game/T6/Json/JsonXModel.h"
+#include "Json/JsonInput.h"
 #include "ObjLoading.h"
+#include "Utils/AllocationLayout.h"
+#include "Utils/JobSystem.h"
+#include "Utils/MemoryMappedFile.h"
 #include "Utils/QuatInt16.h"
 #include "Utils/StringUtils.h"
 #include "XModel/Gltf/GltfBinInput.h"
 #include "XModel/Gltf/GltfLoader.h"
 #include "XModel/Gltf/GltfTextInput.h"
+#include "XModel/MeshOptimizer.h"
+#include "XModel/XModelBounds.h"
 #include "XModel/XModelCommon.h"
 
 #pragma warning(push, 0)
@@ -18,9 +24,11 @@
 #include "XModel/Tangentspace.h"
 
 #include <algorithm>
+#include <cmath>
 #include <filesystem>
 #include <format>
 #include <iostream>
+#include <limits>
 #include <nlohmann/json.hpp>
 #include <numeric>
 #include <vector>
@@ -59,6 +67,13 @@ namespace
     };
     static_assert(std::extent_v<decltype(HITLOC_NAMES)> == HITLOC_COUNT);
 
+    // The amount of vertices whose weights are processed by a single job
+    constexpr size_t VERTICES_PER_WEIGHT_CHUNK = 16384u;
+    constexpr size_t MAX_VERTEX_WEIGHT_COUNT = std::extent_v<decltype(XSurfaceVertexInfo::vertCount)>;
+
+    // The amount of tris of a collision tree leaf that are not split any further
+    constexpr size_t MAX_TRIS_PER_COLLISION_LEAF = 16u;
+
     class PartClassificationState final : public IZoneAssetLoaderState
     {
         // TODO: Use MP part classifications when building an mp fastfile
@@ -205,21 +220,21 @@ namespace
 
         bool Load(XModel& xmodel)
         {
-            const auto jRoot = json::parse(m_stream);
-            std::string type;
-            unsigned version;
+            try
+            {
+                const auto jRoot = json_input::Parse(m_stream);
+                std::string type;
+                unsigned version;
 
-            jRoot.at("_type").get_to(type);
-            jRoot.at("_version").get_to(version);
+                jRoot.at("_type").get_to(type);
+                jRoot.at("_version").get_to(version);
 
-            if (type != "xmodel" || version != 1u)
-            {
-                std::cerr << std::format("Tried to load xmodel \"{}\" but did not find expected type material of version 1\n", xmodel.name);
-                return false;
-            }
+                if (type != "xmodel" || version != 1u)
+                {
+                    std::cerr << std::format("Tried to load xmodel \"{}\" but did not find expected type material of version 1\n", xmodel.name);
+                    return false;
+                }
 
-            try
-            {
                 const auto jXModel = jRoot.get<JsonXModel>();
                 return CreateXModelFromJson(jXModel, xmodel);
             }
@@ -237,6 +252,16 @@ namespace
             std::cerr << std::format("Cannot load xmodel \"{}\": {}\n", xmodel.name, message);
         }
 
+        static std::unique_ptr<XModelCommon> LoadMappedGlb(const MemoryMappedFile& mappedFile)
+        {
+            gltf::BinInput input;
+            if (!input.ReadGltfData(mappedFile.GetData(), mappedFile.GetSize()))
+                return nullptr;
+
+            const auto loader = gltf::Loader::CreateLoader(&input);
+            return loader->Load();
+        }
+
         static std::unique_ptr<XModelCommon> LoadModelByExtension(std::istream& stream, const std::string& extension)
         {
             if (extension == ".glb")
@@ -284,43 +309,55 @@ namespace
             }
         }
 
-        static void CalculateBoneBounds(XBoneInfo& info, const unsigned boneIndex, const XModelCommon& common)
+        static std::vector<xmodel_bounds::Aabb> CalculateBoneBounds(const XModelCommon& common)
         {
-            if (common.m_bone_weight_data.weights.empty())
-                return;
-
-            info.bounds[0].x = 0.0f;
-            info.bounds[0].y = 0.0f;
-            info.bounds[0].z = 0.0f;
-            info.bounds[1].x = 0.0f;
-            info.bounds[1].y = 0.0f;
-            info.bounds[1].z = 0.0f;
-            info.offset.x = 0.0f;
-            info.offset.y = 0.0f;
-            info.offset.z = 0.0f;
-            info.radiusSquared = 0.0f;
-
+            // Bounds of every bone contain the origin. All bones are calculated in a single pass over the vertices, every chunk of vertices on its own.
+            const auto boneCount = common.m_bones.size();
             const auto vertexCount = common.m_vertex_bone_weights.size();
-            for (auto vertexIndex = 0u; vertexIndex < vertexCount; vertexIndex++)
-            {
-                const auto& vertex = common.m_vertices[vertexIndex];
-                const auto& vertexWeights = common.m_vertex_bone_weights[vertexIndex];
-                const auto* weights = &common.m_bone_weight_data.weights[vertexWeights.weightOffset];
-                for (auto weightIndex = 0u; weightIndex < vertexWeights.weightCount; weightIndex++)
+            const auto chunkCount = (vertexCount + VERTICES_PER_WEIGHT_CHUNK - 1u) / VERTICES_PER_WEIGHT_CHUNK;
+            std::vector<xmodel_bounds::Aabb> chunkBoneBounds(std::max<size_t>(chunkCount, 1u) * boneCount, xmodel_bounds::Aabb{});
+            JobSystem::Instance().ParallelFor(
+                chunkCount,
+                1u,
+                [&common, &chunkBoneBounds, boneCount, vertexCount](const size_t begin, const size_t end)
                 {
-                    const auto& weight = weights[weightIndex];
-                    if (weight.boneIndex != boneIndex)
-                        continue;
-
-                    info.bounds[0].x = std::min(info.bounds[0].x, vertex.coordinates[0]);
-                    info.bounds[0].y = std::min(info.bounds[0].y, vertex.coordinates[1]);
-                    info.bounds[0].z = std::min(info.bounds[0].z, vertex.coordinates[2]);
-                    info.bounds[1].x = std::max(info.bounds[1].x, vertex.coordinates[0]);
-                    info.bounds[1].y = std::max(info.bounds[1].y, vertex.coordinates[1]);
-                    info.bounds[1].z = std::max(info.bounds[1].z, vertex.coordinates[2]);
-                }
+                    for (auto chunkIndex = begin; chunkIndex < end; chunkIndex++)
+                    {
+                        auto* boneBounds = &chunkBoneBounds[chunkIndex * boneCount];
+                        const auto chunkEnd = std::min(vertexCount, (chunkIndex + 1u) * VERTICES_PER_WEIGHT_CHUNK);
+                        for (auto vertexIndex = chunkIndex * VERTICES_PER_WEIGHT_CHUNK; vertexIndex < chunkEnd; vertexIndex++)
+                        {
+                            const auto& vertex = common.m_vertices[vertexIndex];
+                            const auto& vertexWeights = common.m_vertex_bone_weights[vertexIndex];
+                            const auto* weights = &common.m_bone_weight_data.weights[vertexWeights.weightOffset];
+                            for (auto weightIndex = 0u; weightIndex < vertexWeights.weightCount; weightIndex++)
+                            {
+                                if (weights[weightIndex].boneIndex < boneCount)
+                                    boneBounds[weights[weightIndex].boneIndex].Add(vertex.coordinates);
+                            }
+                        }
+                    }
+                });
+
+            std::vector<xmodel_bounds::Aabb> boneBounds(chunkBoneBounds.begin(), chunkBoneBounds.begin() + static_cast<ptrdiff_t>(boneCount));
+            for (auto chunkIndex = 1u; chunkIndex < chunkCount; chunkIndex++)
+            {
+                for (auto boneIndex = 0u; boneIndex < boneCount; boneIndex++)
+                    boneBounds[boneIndex].Add(chunkBoneBounds[chunkIndex * boneCount + boneIndex]);
             }
 
+            return boneBounds;
+        }
+
+        static void ApplyBoneBounds(XBoneInfo& info, const xmodel_bounds::Aabb& bounds)
+        {
+            info.bounds[0].x = bounds.mins[0];
+            info.bounds[0].y = bounds.mins[1];
+            info.bounds[0].z = bounds.mins[2];
+            info.bounds[1].x = bounds.maxs[0];
+            info.bounds[1].y = bounds.maxs[1];
+            info.bounds[1].z = bounds.maxs[2];
+
             const Eigen::Vector3f minEigen(info.bounds[0].x, info.bounds[0].y, info.bounds[0].z);
             const Eigen::Vector3f maxEigen(info.bounds[1].x, info.bounds[1].y, info.bounds[1].z);
             const Eigen::Vector3f boundsCenter = (minEigen + maxEigen) * 0.5f;
@@ -359,18 +396,33 @@ namespace
                 xmodel.numBones++;
             }
 
-            xmodel.boneNames = m_memory.Alloc<ScriptString>(xmodel.numBones);
-            xmodel.partClassification = m_memory.Alloc<unsigned char>(xmodel.numBones);
-            xmodel.baseMat = m_memory.Alloc<DObjAnimMat>(xmodel.numBones);
-            xmodel.boneInfo = m_memory.Alloc<XBoneInfo>(xmodel.numBones);
+            // All bone arrays are allocated at once
+            const auto childBoneCount = static_cast<size_t>(xmodel.numBones - xmodel.numRootBones);
+            AllocationLayout boneLayout;
+            boneLayout.Reserve<ScriptString>(xmodel.numBones);
+            boneLayout.Reserve<unsigned char>(xmodel.numBones);
+            boneLayout.Reserve<DObjAnimMat>(xmodel.numBones);
+            boneLayout.Reserve<XBoneInfo>(xmodel.numBones);
+            if (childBoneCount > 0u)
+            {
+                boneLayout.Reserve<unsigned char>(childBoneCount);
+                boneLayout.Reserve<float>(childBoneCount * 4u);
+                boneLayout.Reserve<XModelQuat>(childBoneCount);
+            }
+            boneLayout.Allocate(m_memory);
 
-            if (xmodel.numBones > xmodel.numRootBones)
+            xmodel.boneNames = boneLayout.Take<ScriptString>(xmodel.numBones);
+            xmodel.partClassification = boneLayout.Take<unsigned char>(xmodel.numBones);
+            xmodel.baseMat = boneLayout.Take<DObjAnimMat>(xmodel.numBones);
+            xmodel.boneInfo = boneLayout.Take<XBoneInfo>(xmodel.numBones);
+
+            if (childBoneCount > 0u)
             {
-                xmodel.parentList = m_memory.Alloc<unsigned char>(xmodel.numBones - xmodel.numRootBones);
+                xmodel.parentList = boneLayout.Take<unsigned char>(childBoneCount);
 
                 // For some reason Treyarch games allocate for a vec4 here. it is treated as a vec3 though?
-                xmodel.trans = m_memory.Alloc<float>((xmodel.numBones - xmodel.numRootBones) * 4u);
-                xmodel.quats = m_memory.Alloc<XModelQuat>(xmodel.numBones - xmodel.numRootBones);
+                xmodel.trans = boneLayout.Take<float>(childBoneCount * 4u);
+                xmodel.quats = boneLayout.Take<XModelQuat>(childBoneCount);
             }
             else
             {
@@ -379,6 +431,11 @@ namespace
                 xmodel.quats = nullptr;
             }
 
+            const auto hasBoneWeights = !common.m_bone_weight_data.weights.empty();
+            std::vector<xmodel_bounds::Aabb> boneBounds;
+            if (hasBoneWeights)
+                boneBounds = CalculateBoneBounds(common);
+
             for (auto boneIndex = 0u; boneIndex < boneCount; boneIndex++)
             {
                 const auto& bone = common.m_bones[boneIndex];
@@ -386,7 +443,8 @@ namespace
                 xmodel.partClassification[boneIndex] = static_cast<unsigned char>(m_part_classification_state.GetPartClassificationForBoneName(bone.name));
 
                 ApplyBasePose(xmodel.baseMat[boneIndex], bone);
-                CalculateBoneBounds(xmodel.boneInfo[boneIndex], boneIndex, common);
+                if (hasBoneWeights)
+                    ApplyBoneBounds(xmodel.boneInfo[boneIndex], boneBounds[boneIndex]);
 
                 // Other boneInfo data is filled when calculating bone bounds
                 xmodel.boneInfo[boneIndex].collmap = -1;
@@ -454,19 +512,55 @@ namespace
             return true;
         }
 
-        static void
-            CreateVertex(GfxPackedVertex& vertex, const XModelVertex& commonVertex, const std::array<float, 3>& tangent, const std::array<float, 3>& binormal)
+        static void CreateVertices(XSurface& surface,
+                                   const std::vector<size_t>& xmodelToCommonVertexIndexLookup,
+                                   const XModelCommon& common,
+                                   const std::vector<std::array<float, 3>>& tangents,
+                                   const std::vector<std::array<float, 3>>& binormals)
         {
-            float tangent_[]{tangent[0], tangent[1], tangent[2]};
+            const auto vertexCount = static_cast<size_t>(surface.vertCount);
+
+            // The vertex data is gathered first to be able to pack all vertices of the surface at once
+            std::vector<float> colors(vertexCount * 4u);
+            std::vector<float> uvs(vertexCount * 2u);
+            std::vector<float> normals(vertexCount * 3u);
+            std::vector<float> tangentVectors(vertexCount * 3u);
+            for (auto vertexIndex = 0u; vertexIndex < vertexCount; vertexIndex++)
+            {
+                const auto commonVertexIndex = xmodelToCommonVertexIndexLookup[vertexIndex];
+                const auto& commonVertex = common.m_vertices[commonVertexIndex];
+                const auto& tangent = tangents[commonVertexIndex];
 
-            vertex.xyz.x = commonVertex.coordinates[0];
-            vertex.xyz.y = commonVertex.coordinates[1];
-            vertex.xyz.z = commonVertex.coordinates[2];
-            vertex.binormalSign = binormal[0] > 0.0f ? 1.0f : -1.0f;
-            vertex.color = Common::Vec4PackGfxColor(commonVertex.color);
-            vertex.texCoord = Common::Vec2PackTexCoords(commonVertex.uv);
-            vertex.normal = Common::Vec3PackUnitVec(commonVertex.normal);
-            vertex.tangent = Common::Vec3PackUnitVec(tangent_);
+                std::copy_n(commonVertex.color, 4u, &colors[vertexIndex * 4u]);
+                std::copy_n(commonVertex.uv, 2u, &uvs[vertexIndex * 2u]);
+                std::copy_n(commonVertex.normal, 3u, &normals[vertexIndex * 3u]);
+                std::copy_n(tangent.data(), 3u, &tangentVectors[vertexIndex * 3u]);
+            }
+
+            std::vector<GfxColor> packedColors(vertexCount);
+            std::vector<PackedTexCoords> packedUvs(vertexCount);
+            std::vector<PackedUnitVec> packedNormals(vertexCount);
+            std::vector<PackedUnitVec> packedTangents(vertexCount);
+            Common::Vec4PackGfxColor(colors.data(), packedColors.data(), vertexCount);
+            Common::Vec2PackTexCoords(uvs.data(), packedUvs.data(), vertexCount);
+            Common::Vec3PackUnitVec(normals.data(), packedNormals.data(), vertexCount);
+            Common::Vec3PackUnitVec(tangentVectors.data(), packedTangents.data(), vertexCount);
+
+            for (auto vertexIndex = 0u; vertexIndex < vertexCount; vertexIndex++)
+            {
+                const auto commonVertexIndex = xmodelToCommonVertexIndexLookup[vertexIndex];
+                const auto& commonVertex = common.m_vertices[commonVertexIndex];
+                auto& vertex = surface.verts0[vertexIndex];
+
+                vertex.xyz.x = commonVertex.coordinates[0];
+                vertex.xyz.y = commonVertex.coordinates[1];
+                vertex.xyz.z = commonVertex.coordinates[2];
+                vertex.binormalSign = binormals[commonVertexIndex][0] > 0.0f ? 1.0f : -1.0f;
+                vertex.color = packedColors[vertexIndex];
+                vertex.texCoord = packedUvs[vertexIndex];
+                vertex.normal = packedNormals[vertexIndex];
+                vertex.tangent = packedTangents[vertexIndex];
+            }
         }
 
         static size_t GetRigidBoneForVertex(const size_t vertexIndex, const XModelCommon& common)
@@ -549,7 +643,7 @@ namespace
                 boneVertList.boneOffset = static_cast<uint16_t>(boneIndex * sizeof(DObjSkelMat));
 
                 auto currentVertexHead = currentVertexTail;
-                while (currentVertexHead < vertexCount && GetRigidBoneForVertex(currentVertexHead, common) == boneIndex)
+                while (currentVertexHead < vertexCount && GetRigidBoneForVertex(vertexIndices[currentVertexHead], common) == boneIndex)
                     currentVertexHead++;
 
                 auto currentTriHead = currentTriTail;
@@ -562,7 +656,7 @@ namespace
 
                 if (boneVertList.triCount > 0 || boneVertList.vertCount > 0)
                 {
-                    boneVertList.collisionTree = nullptr; // TODO
+                    boneVertList.collisionTree = nullptr;
                     vertLists.emplace_back(boneVertList);
 
                     currentVertexTail = currentVertexHead;
@@ -586,34 +680,79 @@ namespace
             // TODO
         }
 
+        static size_t GetVertexWeightSortKey(const XModelVertexBoneWeights& vertexWeights, const XModelCommon& common)
+        {
+            // Vertices without weights come first, followed by rigid vertices grouped by their bone and then the vertices of every other weight count
+            if (vertexWeights.weightCount == 0u)
+                return 0u;
+            if (vertexWeights.weightCount == 1u)
+                return 1u + common.m_bone_weight_data.weights[vertexWeights.weightOffset].boneIndex;
+
+            return 1u + common.m_bones.size() + std::min<size_t>(vertexWeights.weightCount, MAX_VERTEX_WEIGHT_COUNT) - 2u;
+        }
+
         static void ReorderVerticesByWeightCount(std::vector<size_t>& vertexIndices, XSurface& surface, const XModelCommon& common)
         {
             if (common.m_bone_weight_data.weights.empty())
                 return;
 
+            // Vertices are partitioned with a counting sort that is stable, so every chunk of vertices can be counted and moved on its own
             const auto vertexCount = vertexIndices.size();
-            std::vector<size_t> reorderLookup(vertexCount);
-            std::iota(reorderLookup.begin(), reorderLookup.end(), 0);
-
-            std::ranges::sort(reorderLookup,
-                              [&common, &vertexIndices](const size_t& i0, const size_t& i1)
-                              {
-                                  const auto& weights0 = common.m_vertex_bone_weights[vertexIndices[i0]];
-                                  const auto& weights1 = common.m_vertex_bone_weights[vertexIndices[i1]];
-
-                                  if (weights0.weightCount < weights1.weightCount)
-                                      return true;
+            const auto keyCount = 1u + common.m_bones.size() + MAX_VERTEX_WEIGHT_COUNT - 1u;
+            const auto chunkCount = (vertexCount + VERTICES_PER_WEIGHT_CHUNK - 1u) / VERTICES_PER_WEIGHT_CHUNK;
+
+            std::vector<uint32_t> sortKeys(vertexCount);
+            std::vector<size_t> chunkKeyOffsets(chunkCount * keyCount, 0u);
+            JobSystem::Instance().ParallelFor(
+                chunkCount,
+                1u,
+                [&vertexIndices, &common, &sortKeys, &chunkKeyOffsets, vertexCount, keyCount](const size_t begin, const size_t end)
+                {
+                    for (auto chunkIndex = begin; chunkIndex < end; chunkIndex++)
+                    {
+                        auto* keyCounts = &chunkKeyOffsets[chunkIndex * keyCount];
+                        const auto chunkEnd = std::min(vertexCount, (chunkIndex + 1u) * VERTICES_PER_WEIGHT_CHUNK);
+                        for (auto vertexIndex = chunkIndex * VERTICES_PER_WEIGHT_CHUNK; vertexIndex < chunkEnd; vertexIndex++)
+                        {
+                            const auto key = GetVertexWeightSortKey(common.m_vertex_bone_weights[vertexIndices[vertexIndex]], common);
+                            sortKeys[vertexIndex] = static_cast<uint32_t>(key);
+                            keyCounts[key]++;
+                        }
+                    }
+                });
 
-                                  // If there is only one weight, make sure all vertices of the same bone follow another
-                                  if (weights0.weightCount == 1)
-                                  {
-                                      const auto bone0 = common.m_bone_weight_data.weights[weights0.weightOffset].boneIndex;
-                                      const auto bone1 = common.m_bone_weight_data.weights[weights1.weightOffset].boneIndex;
-                                      return bone0 < bone1;
-                                  }
+            // Turn counts into offsets where the vertices of a chunk with the same key are placed after the ones of all previous chunks
+            size_t currentOffset = 0u;
+            for (auto key = 0u; key < keyCount; key++)
+            {
+                for (auto chunkIndex = 0u; chunkIndex < chunkCount; chunkIndex++)
+                {
+                    auto& keyOffset = chunkKeyOffsets[chunkIndex * keyCount + key];
+                    const auto count = keyOffset;
+                    keyOffset = currentOffset;
+                    currentOffset += count;
+                }
+            }
 
-                                  return false;
-                              });
+            std::vector<size_t> reorderLookup(vertexCount);
+            std::vector<size_t> sortedVertexIndices(vertexCount);
+            JobSystem::Instance().ParallelFor(
+                chunkCount,
+                1u,
+                [&vertexIndices, &sortKeys, &chunkKeyOffsets, &reorderLookup, &sortedVertexIndices, vertexCount, keyCount](const size_t begin, const size_t end)
+                {
+                    for (auto chunkIndex = begin; chunkIndex < end; chunkIndex++)
+                    {
+                        auto* keyOffsets = &chunkKeyOffsets[chunkIndex * keyCount];
+                        const auto chunkEnd = std::min(vertexCount, (chunkIndex + 1u) * VERTICES_PER_WEIGHT_CHUNK);
+                        for (auto vertexIndex = chunkIndex * VERTICES_PER_WEIGHT_CHUNK; vertexIndex < chunkEnd; vertexIndex++)
+                        {
+                            const auto newVertexIndex = keyOffsets[sortKeys[vertexIndex]]++;
+                            reorderLookup[vertexIndex] = newVertexIndex;
+                            sortedVertexIndices[newVertexIndex] = vertexIndices[vertexIndex];
+                        }
+                    }
+                });
 
             for (auto triIndex = 0u; triIndex < surface.triCount; triIndex++)
             {
@@ -624,10 +763,42 @@ namespace
                 triIndices.i[2] = static_cast<uint16_t>(reorderLookup[triIndices.i[2]]);
             }
 
-            for (auto& entry : reorderLookup)
-                entry = vertexIndices[entry];
+            vertexIndices = std::move(sortedVertexIndices);
+        }
 
-            vertexIndices = std::move(reorderLookup);
+        static void NormalizeVertexWeights(XModelCommon& common)
+        {
+            // The weights of every vertex are sorted by descending weight and add up to one
+            JobSystem::Instance().ParallelFor(
+                common.m_vertex_bone_weights.size(),
+                VERTICES_PER_WEIGHT_CHUNK,
+                [&common](const size_t begin, const size_t end)
+                {
+                    for (auto vertexIndex = begin; vertexIndex < end; vertexIndex++)
+                    {
+                        const auto& vertexWeights = common.m_vertex_bone_weights[vertexIndex];
+                        auto* weights = &common.m_bone_weight_data.weights[vertexWeights.weightOffset];
+
+                        // Insertion sort since there are no more than a few weights per vertex
+                        auto weightSum = 0.0f;
+                        for (auto weightIndex = 0u; weightIndex < vertexWeights.weightCount; weightIndex++)
+                        {
+                            const auto weight = weights[weightIndex];
+                            auto insertIndex = weightIndex;
+                            for (; insertIndex > 0u && weights[insertIndex - 1u].weight < weight.weight; insertIndex--)
+                                weights[insertIndex] = weights[insertIndex - 1u];
+                            weights[insertIndex] = weight;
+
+                            weightSum += weight.weight;
+                        }
+
+                        if (weightSum <= 0.0f)
+                            continue;
+
+                        for (auto weightIndex = 0u; weightIndex < vertexWeights.weightCount; weightIndex++)
+                            weights[weightIndex].weight /= weightSum;
+                    }
+                });
         }
 
         bool CreateXSurface(
@@ -668,12 +839,7 @@ namespace
             surface.verts0 = m_memory.Alloc<GfxPackedVertex>(surface.vertCount);
             vertexOffset += surface.vertCount;
 
-            for (auto vertexIndex = 0u; vertexIndex < surface.vertCount; vertexIndex++)
-            {
-                const auto commonVertexIndex = xmodelToCommonVertexIndexLookup[vertexIndex];
-                const auto& commonVertex = common.m_vertices[commonVertexIndex];
-                CreateVertex(surface.verts0[vertexIndex], commonVertex, tangentData.m_binormals[commonVertexIndex], tangentData.m_binormals[commonVertexIndex]);
-            }
+            CreateVertices(surface, xmodelToCommonVertexIndexLookup, common, tangentData.m_binormals, tangentData.m_binormals);
 
             if (!common.m_bone_weight_data.weights.empty())
             {
@@ -696,23 +862,37 @@ namespace
 
         bool LoadLod(const JsonXModelLod& jLod, XModel& xmodel, unsigned lodNumber)
         {
-            const auto file = m_manager.GetAssetLoadingContext()->m_raw_search_path->Open(jLod.file);
-            if (!file.IsOpen())
+            auto* searchPath = m_manager.GetAssetLoadingContext()->m_raw_search_path;
+            auto extension = fs::path(jLod.file).extension().string();
+            utils::MakeStringLowerCase(extension);
+
+            // GLB files are mapped into memory if possible to be able to use their binary data without copying it
+            std::unique_ptr<XModelCommon> common;
+            MemoryMappedFile mappedFile;
+            if (extension == ".glb" && searchPath->OpenMapped(jLod.file, mappedFile))
             {
-                PrintError(xmodel, std::format("Failed to open file for lod {}: \"{}\"", lodNumber, jLod.file));
-                return false;
+                common = LoadMappedGlb(mappedFile);
             }
+            else
+            {
+                const auto file = searchPath->Open(jLod.file);
+                if (!file.IsOpen())
+                {
+                    PrintError(xmodel, std::format("Failed to open file for lod {}: \"{}\"", lodNumber, jLod.file));
+                    return false;
+                }
 
-            auto extension = fs::path(jLod.file).extension().string();
-            utils::MakeStringLowerCase(extension);
+                common = LoadModelByExtension(*file.m_stream, extension);
+            }
 
-            const auto common = LoadModelByExtension(*file.m_stream, extension);
             if (!common)
             {
                 PrintError(xmodel, std::format("Failure while trying to load model for lod {}: \"{}\"", lodNumber, jLod.file));
                 return false;
             }
 
+            NormalizeVertexWeights(*common);
+
             if (lodNumber == 0u)
             {
                 if (!ApplyCommonBonesToXModel(jLod, xmodel, lodNumber, *common))
@@ -772,11 +952,185 @@ namespace
             return true;
         }
 
+        static void OptimizeTris(XSurfaceTri* tris, const size_t triCount, const XSurface& surface)
+        {
+            static_assert(sizeof(XSurfaceTri) == sizeof(uint16_t) * 3u);
+            auto* triData = reinterpret_cast<uint16_t*>(tris);
+
+            mesh_optimizer::OptimizeVertexCache(triData, triCount, surface.vertCount);
+            mesh_optimizer::OptimizeOverdraw(triData, triCount, &surface.verts0[0].xyz, sizeof(GfxPackedVertex));
+        }
+
+        static void OptimizeSurface(XSurface& surface)
+        {
+            if (surface.triCount == 0u || surface.vertCount == 0u)
+                return;
+
+            // Tris and vertices of rigid surfaces are grouped by bone, so they can only be reordered within the range of their bone
+            std::vector<size_t> vertexRangeEnds;
+            auto groupedTriCount = 0u;
+            if (surface.vertList)
+            {
+                auto vertexRangeEnd = 0u;
+                for (auto vertListIndex = 0u; vertListIndex < surface.vertListCount; vertListIndex++)
+                {
+                    const auto& vertList = surface.vertList[vertListIndex];
+                    OptimizeTris(&surface.triIndices[vertList.triOffset], vertList.triCount, surface);
+
+                    vertexRangeEnd += vertList.vertCount;
+                    vertexRangeEnds.emplace_back(vertexRangeEnd);
+                    groupedTriCount = std::max(groupedTriCount, static_cast<unsigned>(vertList.triOffset + vertList.triCount));
+                }
+            }
+
+            if (groupedTriCount < surface.triCount)
+                OptimizeTris(&surface.triIndices[groupedTriCount], surface.triCount - groupedTriCount, surface);
+
+            const auto* triData = reinterpret_cast<const uint16_t*>(surface.triIndices);
+            const auto vertexOrder = mesh_optimizer::CreateVertexFetchOrder(triData, surface.triCount, surface.vertCount, vertexRangeEnds);
+
+            std::vector<GfxPackedVertex> sortedVertices(surface.vertCount);
+            std::vector<uint16_t> reorderLookup(surface.vertCount);
+            for (auto vertexIndex = 0u; vertexIndex < surface.vertCount; vertexIndex++)
+            {
+                sortedVertices[vertexIndex] = surface.verts0[vertexOrder[vertexIndex]];
+                reorderLookup[vertexOrder[vertexIndex]] = static_cast<uint16_t>(vertexIndex);
+            }
+            std::ranges::copy(sortedVertices, surface.verts0);
+
+            for (auto triIndex = 0u; triIndex < surface.triCount; triIndex++)
+            {
+                auto& triIndices = surface.triIndices[triIndex];
+
+                triIndices.i[0] = reorderLookup[triIndices.i[0]];
+                triIndices.i[1] = reorderLookup[triIndices.i[1]];
+                triIndices.i[2] = reorderLookup[triIndices.i[2]];
+            }
+        }
+
+        void OptimizeSurfaces()
+        {
+            // Surfaces do not share any data, so all surfaces of all lods are optimised in parallel
+            JobSystem::Instance().ParallelFor(m_surfaces.size(),
+                                              1u,
+                                              [this](const size_t begin, const size_t end)
+                                              {
+                                                  for (auto surfaceIndex = begin; surfaceIndex < end; surfaceIndex++)
+                                                      OptimizeSurface(m_surfaces[surfaceIndex]);
+                                              });
+        }
+
+        XSurfaceCollisionTree* CreateCollisionTree(const std::vector<xmodel_bounds::CollisionTreeNode>& nodes)
+        {
+            if (nodes.empty())
+                return nullptr;
+
+            // Leafs are sorted by their first tri, so every leaf ends where the next one begins
+            std::vector<size_t> leafNodeIndices;
+            for (auto nodeIndex = 0u; nodeIndex < nodes.size(); nodeIndex++)
+            {
+                if (nodes[nodeIndex].childCount == 0u)
+                    leafNodeIndices.emplace_back(nodeIndex);
+            }
+            std::ranges::sort(leafNodeIndices,
+                              [&nodes](const size_t nodeIndex0, const size_t nodeIndex1)
+                              {
+                                  return nodes[nodeIndex0].firstIndex < nodes[nodeIndex1].firstIndex;
+                              });
+
+            std::vector<size_t> leafIndexForNode(nodes.size());
+            for (auto leafIndex = 0u; leafIndex < leafNodeIndices.size(); leafIndex++)
+                leafIndexForNode[leafNodeIndices[leafIndex]] = leafIndex;
+
+            AllocationLayout treeLayout;
+            treeLayout.Reserve<XSurfaceCollisionTree>();
+            treeLayout.Reserve<XSurfaceCollisionNode>(nodes.size());
+            treeLayout.Reserve<XSurfaceCollisionLeaf>(leafNodeIndices.size());
+            treeLayout.Allocate(m_memory);
+            auto* tree = treeLayout.Take<XSurfaceCollisionTree>();
+            tree->nodeCount = static_cast<unsigned>(nodes.size());
+            tree->nodes = treeLayout.Take<XSurfaceCollisionNode>(nodes.size());
+            tree->leafCount = static_cast<unsigned>(leafNodeIndices.size());
+            tree->leafs = treeLayout.Take<XSurfaceCollisionLeaf>(leafNodeIndices.size());
+
+            // Node bounds are quantised to the bounds of the root node
+            const auto& rootBounds = nodes[0].bounds;
+            for (auto axis = 0u; axis < 3u; axis++)
+            {
+                const auto extent = rootBounds.maxs[axis] - rootBounds.mins[axis];
+                tree->trans.v[axis] = -rootBounds.mins[axis];
+                tree->scale.v[axis] = extent > 0.0f ? static_cast<float>(std::numeric_limits<uint16_t>::max()) / extent : 1.0f;
+            }
+
+            for (auto nodeIndex = 0u; nodeIndex < nodes.size(); nodeIndex++)
+            {
+                const auto& node = nodes[nodeIndex];
+                auto& collisionNode = tree->nodes[nodeIndex];
+                for (auto axis = 0u; axis < 3u; axis++)
+                {
+                    const auto quantisedMin = std::floor((node.bounds.mins[axis] + tree->trans.v[axis]) * tree->scale.v[axis]);
+                    const auto quantisedMax = std::ceil((node.bounds.maxs[axis] + tree->trans.v[axis]) * tree->scale.v[axis]);
+                    collisionNode.aabb.mins[axis] = static_cast<uint16_t>(std::clamp(quantisedMin, 0.0f, 65535.0f));
+                    collisionNode.aabb.maxs[axis] = static_cast<uint16_t>(std::clamp(quantisedMax, 0.0f, 65535.0f));
+                }
+
+                if (node.childCount > 0u)
+                {
+                    collisionNode.childBeginIndex = static_cast<uint16_t>(node.firstIndex);
+                    collisionNode.childCount = static_cast<uint16_t>(node.childCount);
+                }
+                else
+                {
+                    collisionNode.childBeginIndex = static_cast<uint16_t>(leafIndexForNode[nodeIndex]);
+                    collisionNode.childCount = 0u;
+                }
+            }
+
+            for (auto leafIndex = 0u; leafIndex < leafNodeIndices.size(); leafIndex++)
+                tree->leafs[leafIndex].triangleBeginIndex = static_cast<uint16_t>(nodes[leafNodeIndices[leafIndex]].firstIndex);
+
+            return tree;
+        }
+
+        void CreateCollisionTrees()
+        {
+            std::vector<std::pair<const XSurface*, XRigidVertList*>> vertLists;
+            for (const auto& surface : m_surfaces)
+            {
+                for (auto vertListIndex = 0u; surface.vertList && vertListIndex < surface.vertListCount; vertListIndex++)
+                    vertLists.emplace_back(&surface, &surface.vertList[vertListIndex]);
+            }
+
+            // The trees of all vert lists are built in parallel, only the game structures are allocated one after another
+            std::vector<std::vector<xmodel_bounds::CollisionTreeNode>> trees(vertLists.size());
+            JobSystem::Instance().ParallelFor(
+                vertLists.size(),
+                1u,
+                [&vertLists, &trees](const size_t begin, const size_t end)
+                {
+                    for (auto vertListIndex = begin; vertListIndex < end; vertListIndex++)
+                    {
+                        const auto& [surface, vertList] = vertLists[vertListIndex];
+                        auto* triData = reinterpret_cast<uint16_t*>(&surface->triIndices[vertList->triOffset]);
+                        trees[vertListIndex] = xmodel_bounds::BuildCollisionTree(
+                            triData, vertList->triCount, &surface->verts0[0].xyz, sizeof(GfxPackedVertex), MAX_TRIS_PER_COLLISION_LEAF);
+                    }
+                });
+
+            for (auto vertListIndex = 0u; vertListIndex < vertLists.size(); vertListIndex++)
+                vertLists[vertListIndex].second->collisionTree = CreateCollisionTree(trees[vertListIndex]);
+        }
+
         static void CalculateModelBounds(XModel& xmodel)
         {
             if (!xmodel.surfs)
                 return;
 
+            // Model bounds contain the origin
+            xmodel_bounds::Aabb modelBounds{
+                {xmodel.mins.x, xmodel.mins.y, xmodel.mins.z},
+                {xmodel.maxs.x, xmodel.maxs.y, xmodel.maxs.z},
+            };
             for (auto surfaceIndex = 0u; surfaceIndex < xmodel.lodInfo[0].numsurfs; surfaceIndex++)
             {
                 const auto& surface = xmodel.surfs[surfaceIndex + xmodel.lodInfo[0].surfIndex];
@@ -784,19 +1138,16 @@ namespace
                 if (!surface.verts0)
                     continue;
 
-                for (auto vertIndex = 0u; vertIndex < surface.vertCount; vertIndex++)
-                {
-                    const auto& vertex = surface.verts0[vertIndex];
-
-                    xmodel.mins.x = std::min(xmodel.mins.x, vertex.xyz.v[0]);
-                    xmodel.mins.y = std::min(xmodel.mins.y, vertex.xyz.v[1]);
-                    xmodel.mins.z = std::min(xmodel.mins.z, vertex.xyz.v[2]);
-                    xmodel.maxs.x = std::max(xmodel.maxs.x, vertex.xyz.v[0]);
-                    xmodel.maxs.y = std::max(xmodel.maxs.y, vertex.xyz.v[1]);
-                    xmodel.maxs.z = std::max(xmodel.maxs.z, vertex.xyz.v[2]);
-                }
+                modelBounds.Add(xmodel_bounds::CalculateVertexBounds(&surface.verts0[0].xyz, sizeof(GfxPackedVertex), surface.vertCount));
             }
 
+            xmodel.mins.x = modelBounds.mins[0];
+            xmodel.mins.y = modelBounds.mins[1];
+            xmodel.mins.z = modelBounds.mins[2];
+            xmodel.maxs.x = modelBounds.maxs[0];
+            xmodel.maxs.y = modelBounds.maxs[1];
+            xmodel.maxs.z = modelBounds.maxs[2];
+
             const auto maxX = std::max(std::abs(xmodel.mins.x), std::abs(xmodel.maxs.x));
             const auto maxY = std::max(std::abs(xmodel.mins.y), std::abs(xmodel.maxs.y));
             const auto maxZ = std::max(std::abs(xmodel.mins.z), std::abs(xmodel.maxs.z));
@@ -813,9 +1164,19 @@ namespace
             }
             xmodel.numLods = static_cast<uint16_t>(jXModel.lods.size());
 
+            if (ObjLoading::Configuration.OptimizeModelMeshes)
+                OptimizeSurfaces();
+
+            if (ObjLoading::Configuration.BuildModelCollisionTrees)
+                CreateCollisionTrees();
+
             xmodel.numsurfs = static_cast<unsigned char>(m_surfaces.size());
-            xmodel.surfs = m_memory.Alloc<XSurface>(xmodel.numsurfs);
-            xmodel.materialHandles = m_memory.Alloc<Material*>(xmodel.numsurfs);
+            AllocationLayout surfaceLayout;
+            surfaceLayout.Reserve<XSurface>(xmodel.numsurfs);
+            surfaceLayout.Reserve<Material*>(xmodel.numsurfs);
+            surfaceLayout.Allocate(m_memory);
+            xmodel.surfs = surfaceLayout.Take<XSurface>(xmodel.numsurfs);
+            xmodel.materialHandles = surfaceLayout.Take<Material*>(xmodel.numsurfs);
             memcpy(xmodel.surfs, m_surfaces.data(), sizeof(XSurface) * xmodel.numsurfs);
             memcpy(xmodel.materialHandles, m_materials.data(), sizeof(Material*) * xmodel.numsurfs);
 
@@ -4,6 +4,10 @@
 #include "SearchPath/ISearchPath.h"
 #include "Zone/Zone.h"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 class IObjLoader
 {
 public:
@@ -20,8 +24,9 @@ public:
      * \brief Loads all containers that are referenced by a specified zone.
      * \param searchPath The search path object to use to find the referenced containers.
      * \param zone The zone to check for referenced containers.
+     * \param assetTypesToLoad The asset types to load containers for. Asset types that are not covered are always loaded.
      */
-    virtual void LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone) const = 0;
+    virtual void LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad) const = 0;
 
     /**
      * \brief Unloads all containers of a specified zone. If a container is also loaded by another zone it will only be unloaded when all referencing zones are
@@ -33,9 +38,12 @@ public:
      * \brief Loads the obj data for all assets of a specified zone.
      * \param searchPath The search path object to use to find obj files.
      * \param zone The zone of the assets to load the obj data for.
+     * \param assetTypesToLoad The asset types to load obj data for. Asset types that are not covered are always loaded.
      */
-    virtual void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone) const = 0;
+    virtual void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad) const = 0;
 
+    virtual void PrefetchAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets) const = 0;
     virtual bool LoadAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName) const = 0;
+    virtual bool LoadAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets) const = 0;
     virtual void FinalizeAssetsForZone(AssetLoadingContext* context) const = 0;
 };
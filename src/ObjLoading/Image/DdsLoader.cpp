@@ -4,14 +4,19 @@
 #include "Utils/ClassUtils.h"
 #include "Utils/FileUtils.h"
 
+#include <cstring>
 #include <iostream>
+#include <vector>
 
 class DdsLoaderInternal
 {
     static constexpr auto DDS_MAGIC = FileUtils::MakeMagic32('D', 'D', 'S', ' ');
 
     MemoryManager* m_memory_manager;
-    std::istream& m_stream;
+    std::istream* m_stream;
+    std::span<const uint8_t> m_data;
+    size_t m_data_offset;
+    bool m_take_ownership;
 
     TextureType m_texture_type;
     bool m_has_mip_maps;
@@ -20,11 +25,26 @@ class DdsLoaderInternal
     size_t m_depth;
     const ImageFormat* m_format;
 
-    _NODISCARD bool ReadMagic() const
+    _NODISCARD bool Read(void* buffer, const size_t size)
+    {
+        if (m_stream)
+        {
+            m_stream->read(static_cast<char*>(buffer), static_cast<std::streamsize>(size));
+            return m_stream->gcount() == static_cast<std::streamsize>(size);
+        }
+
+        if (m_data.size() - m_data_offset < size)
+            return false;
+
+        std::memcpy(buffer, &m_data[m_data_offset], size);
+        m_data_offset += size;
+        return true;
+    }
+
+    _NODISCARD bool ReadMagic()
     {
         uint32_t magic;
-        m_stream.read(reinterpret_cast<char*>(&magic), sizeof(magic));
-        if (m_stream.gcount() != sizeof(magic))
+        if (!Read(&magic, sizeof(magic)))
         {
             std::cout << "Failed to read dds data\n";
             return false;
@@ -42,8 +62,7 @@ class DdsLoaderInternal
     _NODISCARD bool ReadDxt10Header()
     {
         DDS_HEADER_DXT10 headerDx10{};
-        m_stream.read(reinterpret_cast<char*>(&headerDx10), sizeof(headerDx10));
-        if (m_stream.gcount() != sizeof(headerDx10))
+        if (!Read(&headerDx10, sizeof(headerDx10)))
         {
             std::cout << "Failed to read dds data\n";
             return false;
@@ -171,8 +190,7 @@ class DdsLoaderInternal
     _NODISCARD bool ReadHeader()
     {
         DDS_HEADER header{};
-        m_stream.read(reinterpret_cast<char*>(&header), sizeof(header));
-        if (m_stream.gcount() != sizeof(header))
+        if (!Read(&header, sizeof(header)))
         {
             std::cout << "Failed to read dds data\n";
             return false;
@@ -193,7 +211,29 @@ class DdsLoaderInternal
         return ReadPixelFormat(header.ddspf);
     }
 
-    _NODISCARD Texture* ReadTextureData() const
+    _NODISCARD Texture* AttachTextureData(Texture* texture, const int mipMapCount, const int faceCount) const
+    {
+        // The mip levels follow the header from the biggest to the smallest one with the faces of each mip level following each other
+        std::vector<size_t> mipLevelOffsets(mipMapCount);
+        auto currentOffset = m_data_offset;
+        for (auto mipLevel = 0; mipLevel < mipMapCount; mipLevel++)
+        {
+            mipLevelOffsets[mipLevel] = currentOffset;
+            currentOffset += texture->GetSizeOfMipLevel(mipLevel) * faceCount;
+        }
+
+        if (currentOffset > m_data.size())
+        {
+            std::cout << "Failed to read texture data from dds\n";
+            delete texture;
+            return nullptr;
+        }
+
+        texture->AttachMipLevels(const_cast<uint8_t*>(m_data.data()), std::move(mipLevelOffsets), m_take_ownership);
+        return texture;
+    }
+
+    _NODISCARD Texture* ReadTextureData()
     {
         Texture* result;
 
@@ -218,6 +258,9 @@ class DdsLoaderInternal
         const auto mipMapCount = m_has_mip_maps ? result->GetMipMapCount() : 1;
         const auto faceCount = m_texture_type == TextureType::T_CUBE ? 6 : 1;
 
+        if (!m_stream)
+            return AttachTextureData(result, mipMapCount, faceCount);
+
         result->Allocate();
 
         for (auto mipLevel = 0; mipLevel < mipMapCount; mipLevel++)
@@ -226,9 +269,7 @@ class DdsLoaderInternal
 
             for (auto face = 0; face < faceCount; face++)
             {
-                m_stream.read(reinterpret_cast<char*>(result->GetBufferForMipLevel(mipLevel, face)), mipSize);
-
-                if (m_stream.gcount() != mipSize)
+                if (!Read(result->GetBufferForMipLevel(mipLevel, face), mipSize))
                 {
                     std::cout << "Failed to read texture data from dds\n";
                     delete result;
@@ -243,7 +284,24 @@ class DdsLoaderInternal
 public:
     DdsLoaderInternal(MemoryManager* memoryManager, std::istream& stream)
         : m_memory_manager(memoryManager),
-          m_stream(stream),
+          m_stream(&stream),
+          m_data_offset(0u),
+          m_take_ownership(false),
+          m_texture_type(TextureType::T_2D),
+          m_has_mip_maps(false),
+          m_width(0u),
+          m_height(0u),
+          m_depth(0u),
+          m_format(nullptr)
+    {
+    }
+
+    DdsLoaderInternal(MemoryManager* memoryManager, const std::span<const uint8_t> data, const bool takeOwnership)
+        : m_memory_manager(memoryManager),
+          m_stream(nullptr),
+          m_data(data),
+          m_data_offset(0u),
+          m_take_ownership(takeOwnership),
           m_texture_type(TextureType::T_2D),
           m_has_mip_maps(false),
           m_width(0u),
@@ -274,3 +332,21 @@ Texture* DdsLoader::LoadDds(std::istream& stream) const
     DdsLoaderInternal internal(m_memory_manager, stream);
     return internal.LoadDds();
 }
+
+Texture* DdsLoader::LoadDds(const std::span<const uint8_t> data) const
+{
+    DdsLoaderInternal internal(m_memory_manager, data, false);
+    return internal.LoadDds();
+}
+
+Texture* DdsLoader::LoadDds(std::unique_ptr<uint8_t[]> data, const size_t dataSize) const
+{
+    DdsLoaderInternal internal(m_memory_manager, std::span<const uint8_t>(data.get(), dataSize), true);
+    auto* texture = internal.LoadDds();
+
+    // The texture frees the buffer from now on
+    if (texture != nullptr)
+        data.release();
+
+    return texture;
+}
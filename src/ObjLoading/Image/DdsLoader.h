@@ -3,7 +3,11 @@
 #include "Image/Texture.h"
 #include "Utils/MemoryManager.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <istream>
+#include <memory>
+#include <span>
 
 class DdsLoader
 {
@@ -13,4 +17,20 @@ public:
     explicit DdsLoader(MemoryManager* memoryManager);
 
     Texture* LoadDds(std::istream& stream) const;
+
+    /**
+     * \brief Loads a dds from a buffer holding the entire file without copying its pixel data.
+     * The texture reads its mip levels from the buffer directly, so the buffer must outlive the texture.
+     * \param data The contents of the dds file.
+     * \return The loaded texture or \c nullptr if the dds is invalid.
+     */
+    Texture* LoadDds(std::span<const uint8_t> data) const;
+
+    /**
+     * \brief Loads a dds from a buffer holding the entire file without copying its pixel data and hands the buffer to the texture.
+     * \param data The contents of the dds file. It is freed with the texture or right away if the dds is invalid.
+     * \param dataSize The size of the dds file.
+     * \return The loaded texture or \c nullptr if the dds is invalid.
+     */
+    Texture* LoadDds(std::unique_ptr<uint8_t[]> data, size_t dataSize) const;
 };
@@ -20,6 +20,7 @@ class Dx12TextureLoader
     size_t m_depth;
 
     _NODISCARD const ImageFormat* GetFormatForDx12Format() const;
+    _NODISCARD Texture* CreateTexture() const;
 
 public:
     explicit Dx12TextureLoader(MemoryManager* memoryManager);
@@ -32,4 +33,11 @@ public:
     Dx12TextureLoader& Depth(size_t depth);
 
     Texture* LoadTexture(const void* data);
+
+    /**
+     * \brief Creates a texture that uses the specified data directly instead of copying it.
+     * \param data The data of all mip levels and faces. It must outlive the texture.
+     * \return The texture or \c nullptr if the format is not supported.
+     */
+    Texture* LoadTextureInPlace(void* data);
 };
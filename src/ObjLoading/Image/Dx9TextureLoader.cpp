@@ -60,7 +60,7 @@ Dx9TextureLoader& Dx9TextureLoader::Depth(const size_t depth)
     return *this;
 }
 
-Texture* Dx9TextureLoader::LoadTexture(const void* data)
+Texture* Dx9TextureLoader::CreateTexture() const
 {
     const auto* format = GetFormatForDx9Format();
 
@@ -86,6 +86,15 @@ Texture* Dx9TextureLoader::LoadTexture(const void* data)
         return nullptr;
     }
 
+    return texture;
+}
+
+Texture* Dx9TextureLoader::LoadTexture(const void* data)
+{
+    auto* texture = CreateTexture();
+    if (texture == nullptr)
+        return nullptr;
+
     texture->Allocate();
     const auto mipMapCount = m_has_mip_maps ? texture->GetMipMapCount() : 1;
     const auto faceCount = m_type == TextureType::T_CUBE ? 6 : 1;
@@ -103,3 +112,15 @@ Texture* Dx9TextureLoader::LoadTexture(const void* data)
 
     return texture;
 }
+
+Texture* Dx9TextureLoader::LoadTextureInPlace(void* data)
+{
+    auto* texture = CreateTexture();
+    if (texture == nullptr)
+        return nullptr;
+
+    // The data is already laid out like the texture expects it so it can be used without copying it
+    texture->AttachData(static_cast<uint8_t*>(data));
+
+    return texture;
+}
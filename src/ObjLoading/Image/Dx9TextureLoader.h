@@ -18,6 +18,7 @@ class Dx9TextureLoader
     size_t m_depth;
 
     _NODISCARD const ImageFormat* GetFormatForDx9Format() const;
+    _NODISCARD Texture* CreateTexture() const;
 
 public:
     explicit Dx9TextureLoader(MemoryManager* memoryManager);
@@ -30,4 +31,11 @@ public:
     Dx9TextureLoader& Depth(size_t depth);
 
     Texture* LoadTexture(const void* data);
+
+    /**
+     * \brief Creates a texture that uses the specified data directly instead of copying it.
+     * \param data The data of all mip levels and faces. It must outlive the texture.
+     * \return The texture or \c nullptr if the format is not supported.
+     */
+    Texture* LoadTextureInPlace(void* data);
 };
@@ -3,8 +3,61 @@
 #include "Image/IwiTypes.h"
 
 #include <cassert>
+#include <cstring>
 #include <type_traits>
 
+namespace
+{
+    /**
+     * \brief Calculates the offset of every mip level inside the iwi file and validates them against the file sizes of the header.
+     * Mip levels are stored from the smallest to the biggest one after the header.
+     */
+    template<typename HeaderType> bool GetMipLevelOffsets(const Texture& texture, const HeaderType& header, std::vector<size_t>& mipLevelOffsets)
+    {
+        const auto mipMapCount = texture.HasMipMaps() ? texture.GetMipMapCount() : 1;
+        mipLevelOffsets.resize(mipMapCount);
+
+        auto currentFileSize = sizeof(HeaderType) + sizeof(IwiVersion);
+        for (auto currentMipLevel = mipMapCount - 1; currentMipLevel >= 0; currentMipLevel--)
+        {
+            mipLevelOffsets[currentMipLevel] = currentFileSize;
+            currentFileSize += texture.GetSizeOfMipLevel(currentMipLevel) * texture.GetFaceCount();
+
+            if (currentMipLevel < static_cast<int>(std::extent_v<decltype(HeaderType::fileSizeForPicmip)>)
+                && currentFileSize != header.fileSizeForPicmip[currentMipLevel])
+            {
+                printf("Iwi has invalid file size for picmip %i\n", currentMipLevel);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool IsValidIwiVersion(const IwiVersion& iwiVersion)
+    {
+        if (iwiVersion.tag[0] != 'I' || iwiVersion.tag[1] != 'W' || iwiVersion.tag[2] != 'i')
+        {
+            printf("Invalid IWI magic\n");
+        }
+
+        switch (iwiVersion.version)
+        {
+        case 6:
+        case 8:
+        case 13:
+        case 27:
+            return true;
+
+        default:
+            break;
+        }
+
+        printf("Unknown IWI version %i\n", iwiVersion.version);
+        return false;
+    }
+} // namespace
+
 IwiLoader::IwiLoader(MemoryManager* memoryManager)
 {
     m_memory_manager = memoryManager;
@@ -47,14 +100,8 @@ const ImageFormat* IwiLoader::GetFormat6(int8_t format)
     return nullptr;
 }
 
-Texture* IwiLoader::LoadIwi6(std::istream& stream) const
+Texture* IwiLoader::CreateTexture(const iwi6::IwiHeader& header) const
 {
-    iwi6::IwiHeader header{};
-
-    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
-    if (stream.gcount() != sizeof(header))
-        return nullptr;
-
     const auto* format = GetFormat6(header.format);
     if (format == nullptr)
         return nullptr;
@@ -78,35 +125,6 @@ Texture* IwiLoader::LoadIwi6(std::istream& stream) const
         texture = m_memory_manager->Create<Texture2D>(format, width, height, hasMipMaps);
     }
 
-    texture->Allocate();
-
-    auto currentFileSize = sizeof(iwi6::IwiHeader) + sizeof(IwiVersion);
-    const auto mipMapCount = hasMipMaps ? texture->GetMipMapCount() : 1;
-
-    for (auto currentMipLevel = mipMapCount - 1; currentMipLevel >= 0; currentMipLevel--)
-    {
-        const auto sizeOfMipLevel = texture->GetSizeOfMipLevel(currentMipLevel) * texture->GetFaceCount();
-        currentFileSize += sizeOfMipLevel;
-
-        if (currentMipLevel < static_cast<int>(std::extent_v<decltype(iwi6::IwiHeader::fileSizeForPicmip)>)
-            && currentFileSize != header.fileSizeForPicmip[currentMipLevel])
-        {
-            printf("Iwi has invalid file size for picmip %i\n", currentMipLevel);
-
-            m_memory_manager->Delete(texture);
-            return nullptr;
-        }
-
-        stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
-        if (stream.gcount() != sizeOfMipLevel)
-        {
-            printf("Unexpected eof of iwi in mip level %i\n", currentMipLevel);
-
-            m_memory_manager->Delete(texture);
-            return nullptr;
-        }
-    }
-
     return texture;
 }
 
@@ -155,14 +173,8 @@ const ImageFormat* IwiLoader::GetFormat8(int8_t format)
     return nullptr;
 }
 
-Texture* IwiLoader::LoadIwi8(std::istream& stream) const
+Texture* IwiLoader::CreateTexture(const iwi8::IwiHeader& header) const
 {
-    iwi8::IwiHeader header{};
-
-    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
-    if (stream.gcount() != sizeof(header))
-        return nullptr;
-
     const auto* format = GetFormat8(header.format);
     if (format == nullptr)
         return nullptr;
@@ -196,35 +208,6 @@ Texture* IwiLoader::LoadIwi8(std::istream& stream) const
         return nullptr;
     }
 
-    texture->Allocate();
-
-    auto currentFileSize = sizeof(iwi8::IwiHeader) + sizeof(IwiVersion);
-    const auto mipMapCount = hasMipMaps ? texture->GetMipMapCount() : 1;
-
-    for (auto currentMipLevel = mipMapCount - 1; currentMipLevel >= 0; currentMipLevel--)
-    {
-        const auto sizeOfMipLevel = texture->GetSizeOfMipLevel(currentMipLevel) * texture->GetFaceCount();
-        currentFileSize += sizeOfMipLevel;
-
-        if (currentMipLevel < static_cast<int>(std::extent_v<decltype(iwi8::IwiHeader::fileSizeForPicmip)>)
-            && currentFileSize != header.fileSizeForPicmip[currentMipLevel])
-        {
-            printf("Iwi has invalid file size for picmip %i\n", currentMipLevel);
-
-            m_memory_manager->Delete(texture);
-            return nullptr;
-        }
-
-        stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
-        if (stream.gcount() != sizeOfMipLevel)
-        {
-            printf("Unexpected eof of iwi in mip level %i\n", currentMipLevel);
-
-            m_memory_manager->Delete(texture);
-            return nullptr;
-        }
-    }
-
     return texture;
 }
 
@@ -270,14 +253,8 @@ const ImageFormat* IwiLoader::GetFormat13(int8_t format)
     return nullptr;
 }
 
-Texture* IwiLoader::LoadIwi13(std::istream& stream) const
+Texture* IwiLoader::CreateTexture(const iwi13::IwiHeader& header) const
 {
-    iwi13::IwiHeader header{};
-
-    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
-    if (stream.gcount() != sizeof(header))
-        return nullptr;
-
     const auto* format = GetFormat6(header.format);
     if (format == nullptr)
         return nullptr;
@@ -301,35 +278,6 @@ Texture* IwiLoader::LoadIwi13(std::istream& stream) const
         texture = m_memory_manager->Create<Texture2D>(format, width, height, hasMipMaps);
     }
 
-    texture->Allocate();
-
-    auto currentFileSize = sizeof(iwi13::IwiHeader) + sizeof(IwiVersion);
-    const auto mipMapCount = hasMipMaps ? texture->GetMipMapCount() : 1;
-
-    for (auto currentMipLevel = mipMapCount - 1; currentMipLevel >= 0; currentMipLevel--)
-    {
-        const auto sizeOfMipLevel = texture->GetSizeOfMipLevel(currentMipLevel) * texture->GetFaceCount();
-        currentFileSize += sizeOfMipLevel;
-
-        if (currentMipLevel < static_cast<int>(std::extent_v<decltype(iwi13::IwiHeader::fileSizeForPicmip)>)
-            && currentFileSize != header.fileSizeForPicmip[currentMipLevel])
-        {
-            printf("Iwi has invalid file size for picmip %i\n", currentMipLevel);
-
-            m_memory_manager->Delete(texture);
-            return nullptr;
-        }
-
-        stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
-        if (stream.gcount() != sizeOfMipLevel)
-        {
-            printf("Unexpected eof of iwi in mip level %i\n", currentMipLevel);
-
-            m_memory_manager->Delete(texture);
-            return nullptr;
-        }
-    }
-
     return texture;
 }
 
@@ -377,14 +325,8 @@ const ImageFormat* IwiLoader::GetFormat27(int8_t format)
     return nullptr;
 }
 
-Texture* IwiLoader::LoadIwi27(std::istream& stream) const
+Texture* IwiLoader::CreateTexture(const iwi27::IwiHeader& header) const
 {
-    iwi27::IwiHeader header{};
-
-    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
-    if (stream.gcount() != sizeof(header))
-        return nullptr;
-
     const auto* format = GetFormat27(header.format);
     if (format == nullptr)
         return nullptr;
@@ -408,24 +350,33 @@ Texture* IwiLoader::LoadIwi27(std::istream& stream) const
         texture = m_memory_manager->Create<Texture2D>(format, width, height, hasMipMaps);
     }
 
-    texture->Allocate();
+    return texture;
+}
+
+template<typename HeaderType> Texture* IwiLoader::LoadIwiVersionFromStream(std::istream& stream) const
+{
+    HeaderType header{};
 
-    auto currentFileSize = sizeof(iwi27::IwiHeader) + sizeof(IwiVersion);
-    const auto mipMapCount = hasMipMaps ? texture->GetMipMapCount() : 1;
+    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (stream.gcount() != sizeof(header))
+        return nullptr;
+
+    auto* texture = CreateTexture(header);
+    if (texture == nullptr)
+        return nullptr;
 
-    for (auto currentMipLevel = mipMapCount - 1; currentMipLevel >= 0; currentMipLevel--)
+    std::vector<size_t> mipLevelOffsets;
+    if (!GetMipLevelOffsets(*texture, header, mipLevelOffsets))
     {
-        const auto sizeOfMipLevel = texture->GetSizeOfMipLevel(currentMipLevel) * texture->GetFaceCount();
-        currentFileSize += sizeOfMipLevel;
+        m_memory_manager->Delete(texture);
+        return nullptr;
+    }
 
-        if (currentMipLevel < static_cast<int>(std::extent_v<decltype(iwi27::IwiHeader::fileSizeForPicmip)>)
-            && currentFileSize != header.fileSizeForPicmip[currentMipLevel])
-        {
-            printf("Iwi has invalid file size for picmip %i\n", currentMipLevel);
+    texture->Allocate();
 
-            m_memory_manager->Delete(texture);
-            return nullptr;
-        }
+    for (auto currentMipLevel = static_cast<int>(mipLevelOffsets.size()) - 1; currentMipLevel >= 0; currentMipLevel--)
+    {
+        const auto sizeOfMipLevel = texture->GetSizeOfMipLevel(currentMipLevel) * texture->GetFaceCount();
 
         stream.read(reinterpret_cast<char*>(texture->GetBufferForMipLevel(currentMipLevel)), sizeOfMipLevel);
         if (stream.gcount() != sizeOfMipLevel)
@@ -440,6 +391,70 @@ Texture* IwiLoader::LoadIwi27(std::istream& stream) const
     return texture;
 }
 
+template<typename HeaderType> Texture* IwiLoader::LoadIwiVersionFromBuffer(const std::span<const uint8_t> data, const bool takeOwnership) const
+{
+    HeaderType header{};
+
+    if (data.size() < sizeof(IwiVersion) + sizeof(header))
+        return nullptr;
+
+    std::memcpy(&header, &data[sizeof(IwiVersion)], sizeof(header));
+
+    auto* texture = CreateTexture(header);
+    if (texture == nullptr)
+        return nullptr;
+
+    std::vector<size_t> mipLevelOffsets;
+    if (!GetMipLevelOffsets(*texture, header, mipLevelOffsets))
+    {
+        m_memory_manager->Delete(texture);
+        return nullptr;
+    }
+
+    // The biggest mip level is stored last
+    if (mipLevelOffsets[0] + texture->GetSizeOfMipLevel(0) * texture->GetFaceCount() > data.size())
+    {
+        printf("Unexpected eof of iwi in mip level %i\n", 0);
+
+        m_memory_manager->Delete(texture);
+        return nullptr;
+    }
+
+    texture->AttachMipLevels(const_cast<uint8_t*>(data.data()), std::move(mipLevelOffsets), takeOwnership);
+
+    return texture;
+}
+
+Texture* IwiLoader::LoadIwiFromBuffer(const std::span<const uint8_t> data, const bool takeOwnership) const
+{
+    IwiVersion iwiVersion{};
+
+    if (data.size() < sizeof(iwiVersion))
+        return nullptr;
+
+    std::memcpy(&iwiVersion, data.data(), sizeof(iwiVersion));
+    if (!IsValidIwiVersion(iwiVersion))
+        return nullptr;
+
+    switch (iwiVersion.version)
+    {
+    case 6:
+        return LoadIwiVersionFromBuffer<iwi6::IwiHeader>(data, takeOwnership);
+
+    case 8:
+        return LoadIwiVersionFromBuffer<iwi8::IwiHeader>(data, takeOwnership);
+
+    case 13:
+        return LoadIwiVersionFromBuffer<iwi13::IwiHeader>(data, takeOwnership);
+
+    case 27:
+        return LoadIwiVersionFromBuffer<iwi27::IwiHeader>(data, takeOwnership);
+
+    default:
+        return nullptr;
+    }
+}
+
 Texture* IwiLoader::LoadIwi(std::istream& stream)
 {
     IwiVersion iwiVersion{};
@@ -448,29 +463,40 @@ Texture* IwiLoader::LoadIwi(std::istream& stream)
     if (stream.gcount() != sizeof(iwiVersion))
         return nullptr;
 
-    if (iwiVersion.tag[0] != 'I' || iwiVersion.tag[1] != 'W' || iwiVersion.tag[2] != 'i')
-    {
-        printf("Invalid IWI magic\n");
-    }
+    if (!IsValidIwiVersion(iwiVersion))
+        return nullptr;
 
     switch (iwiVersion.version)
     {
     case 6:
-        return LoadIwi6(stream);
+        return LoadIwiVersionFromStream<iwi6::IwiHeader>(stream);
 
     case 8:
-        return LoadIwi8(stream);
+        return LoadIwiVersionFromStream<iwi8::IwiHeader>(stream);
 
     case 13:
-        return LoadIwi13(stream);
+        return LoadIwiVersionFromStream<iwi13::IwiHeader>(stream);
 
     case 27:
-        return LoadIwi27(stream);
+        return LoadIwiVersionFromStream<iwi27::IwiHeader>(stream);
 
     default:
-        break;
+        return nullptr;
     }
+}
 
-    printf("Unknown IWI version %i\n", iwiVersion.version);
-    return nullptr;
+Texture* IwiLoader::LoadIwi(const std::span<const uint8_t> data)
+{
+    return LoadIwiFromBuffer(data, false);
+}
+
+Texture* IwiLoader::LoadIwi(std::unique_ptr<uint8_t[]> data, const size_t dataSize)
+{
+    auto* texture = LoadIwiFromBuffer(std::span(data.get(), dataSize), true);
+
+    // The texture frees the buffer from now on
+    if (texture != nullptr)
+        data.release();
+
+    return texture;
 }
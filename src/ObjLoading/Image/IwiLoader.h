@@ -1,28 +1,53 @@
 #pragma once
 
+#include "Image/IwiTypes.h"
 #include "Image/Texture.h"
 #include "Utils/MemoryManager.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <istream>
+#include <memory>
+#include <span>
 
 class IwiLoader
 {
     MemoryManager* m_memory_manager;
 
     static const ImageFormat* GetFormat6(int8_t format);
-    Texture* LoadIwi6(std::istream& stream) const;
+    Texture* CreateTexture(const iwi6::IwiHeader& header) const;
 
     static const ImageFormat* GetFormat8(int8_t format);
-    Texture* LoadIwi8(std::istream& stream) const;
+    Texture* CreateTexture(const iwi8::IwiHeader& header) const;
 
     static const ImageFormat* GetFormat13(int8_t format);
-    Texture* LoadIwi13(std::istream& stream) const;
+    Texture* CreateTexture(const iwi13::IwiHeader& header) const;
 
     static const ImageFormat* GetFormat27(int8_t format);
-    Texture* LoadIwi27(std::istream& stream) const;
+    Texture* CreateTexture(const iwi27::IwiHeader& header) const;
+
+    template<typename HeaderType> Texture* LoadIwiVersionFromStream(std::istream& stream) const;
+    template<typename HeaderType> Texture* LoadIwiVersionFromBuffer(std::span<const uint8_t> data, bool takeOwnership) const;
+    Texture* LoadIwiFromBuffer(std::span<const uint8_t> data, bool takeOwnership) const;
 
 public:
     explicit IwiLoader(MemoryManager* memoryManager);
 
     Texture* LoadIwi(std::istream& stream);
+
+    /**
+     * \brief Loads an iwi from a buffer holding the entire file without copying its pixel data.
+     * The texture reads its mip levels from the buffer directly, so the buffer must outlive the texture.
+     * \param data The contents of the iwi file.
+     * \return The loaded texture or \c nullptr if the iwi is invalid.
+     */
+    Texture* LoadIwi(std::span<const uint8_t> data);
+
+    /**
+     * \brief Loads an iwi from a buffer holding the entire file without copying its pixel data and hands the buffer to the texture.
+     * \param data The contents of the iwi file. It is freed with the texture or right away if the iwi is invalid.
+     * \param dataSize The size of the iwi file.
+     * \return The loaded texture or \c nullptr if the iwi is invalid.
+     */
+    Texture* LoadIwi(std::unique_ptr<uint8_t[]> data, size_t dataSize);
 };
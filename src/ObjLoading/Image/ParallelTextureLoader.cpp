@@ -0,0 +1,45 @@
+#include "ParallelTextureLoader.h"
+
+#include "ObjLoading.h"
+#include "Utils/ThreadPool.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace parallel_texture_loader
+{
+    void LoadTextures(MemoryManager& memory, const size_t count, const load_func_t& load, const loaded_func_t& loaded)
+    {
+        const auto workerCount = std::min(static_cast<size_t>(ObjLoading::Configuration.ImageLoadWorkerCount), count);
+        if (workerCount <= 1u)
+        {
+            for (auto index = 0u; index < count; index++)
+                loaded(index, load(index, memory));
+            return;
+        }
+
+        // Memory managers are not thread safe, so every texture is loaded into memory of its own that is handed over after loading
+        std::vector<MemoryManager> textureMemory(count);
+        std::vector<Texture*> textures(count, nullptr);
+
+        {
+            ThreadPool workerPool(workerCount);
+            for (auto index = 0u; index < count; index++)
+            {
+                workerPool.Enqueue(
+                    [&load, &textureMemory, &textures, index]
+                    {
+                        textures[index] = load(index, textureMemory[index]);
+                    });
+            }
+
+            workerPool.WaitForIdle();
+        }
+
+        for (auto index = 0u; index < count; index++)
+        {
+            memory.TakeOwnership(textureMemory[index]);
+            loaded(index, textures[index]);
+        }
+    }
+} // namespace parallel_texture_loader
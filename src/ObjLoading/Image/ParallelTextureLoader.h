@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Image/Texture.h"
+#include "Utils/MemoryManager.h"
+
+#include <cstddef>
+#include <functional>
+
+namespace parallel_texture_loader
+{
+    /**
+     * \brief Loads the texture of an element. Runs on a worker thread, so it must only allocate from the specified memory.
+     * \param index The index of the element to load the texture of.
+     * \param memory The memory to allocate the texture in.
+     * \return The loaded texture or \c nullptr if it could not be loaded.
+     */
+    using load_func_t = std::function<Texture*(size_t index, MemoryManager& memory)>;
+
+    /**
+     * \brief Receives the texture of an element on the calling thread.
+     * \param index The index of the element.
+     * \param texture The loaded texture or \c nullptr if it could not be loaded.
+     */
+    using loaded_func_t = std::function<void(size_t index, Texture* texture)>;
+
+    /**
+     * \brief Loads the textures of the elements [0, count), on worker threads when multiple image load workers are configured.
+     * The textures are handed to the callback in order of the elements once all of them were loaded and live as long as the specified memory.
+     * \param memory The memory the loaded textures are owned by.
+     * \param count The amount of elements to load the textures of.
+     * \param load Loads the texture of an element. Must be safe to call from multiple threads for different elements at once.
+     * \param loaded Receives the texture of an element.
+     */
+    void LoadTextures(MemoryManager& memory, size_t count, const load_func_t& load, const loaded_func_t& loaded);
+} // namespace parallel_texture_loader
@@ -4,6 +4,7 @@
 #include "Localize/LocalizeReadingZoneState.h"
 #include "Localize/Parsing/LocalizeFileReader.h"
 
+#include <iostream>
 #include <sstream>
 
 LocalizeCommonAssetLoader::LocalizeCommonAssetLoader(std::function<void(const CommonLocalizeEntry&)> entryCallback)
@@ -26,17 +27,22 @@ bool LocalizeCommonAssetLoader::LoadLocalizeAsset(const std::string& assetName,
     if (!file.IsOpen())
         return false;
 
-    auto* zoneState = manager->GetAssetLoadingContext()->GetZoneAssetLoaderState<LocalizeReadingZoneState>();
-    LocalizeFileReader reader(*file.m_stream, assetName, zone->m_language, zoneState);
+    LocalizeFileReader reader(*file.m_stream, assetName, zone->m_language);
 
     std::vector<CommonLocalizeEntry> localizeEntries;
     if (!reader.ReadLocalizeFile(localizeEntries))
         return false;
 
+    // Duplicate keys are checked when the entries are added to the zone, since files loaded in parallel are parsed in any order
     for (const auto& entry : localizeEntries)
-    {
         m_entry_callback(entry);
-    }
 
     return true;
 }
+
+void LocalizeCommonAssetLoader::CheckForDuplicateEntry(const std::string& key, AssetLoadingContext* context)
+{
+    auto* zoneState = context->GetZoneAssetLoaderState<LocalizeReadingZoneState>();
+    if (!zoneState->DoLocalizeEntryDuplicateCheck(key))
+        std::cout << "Localize: a value for reference \"" << key << "\" was already defined\n";
+}
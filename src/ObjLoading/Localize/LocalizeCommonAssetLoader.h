@@ -15,6 +15,13 @@ public:
 
     bool LoadLocalizeAsset(const std::string& assetName, ISearchPath* searchPath, IAssetLoadingManager* manager, Zone* zone) const;
 
+    /**
+     * \brief Reports a localize entry whose key was already added to the zone. Must be called in the order the entries are added to the zone.
+     * \param key The key of the added localize entry.
+     * \param context The context of the zone the entry was added to.
+     */
+    static void CheckForDuplicateEntry(const std::string& key, AssetLoadingContext* context);
+
 private:
     std::string GetFileName(const std::string& assetName, Zone* zone) const;
 
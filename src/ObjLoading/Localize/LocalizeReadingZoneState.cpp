@@ -1,7 +1,31 @@
 #include "LocalizeReadingZoneState.h"
 
+namespace
+{
+    constexpr size_t STRING_MEMORY_ARENA_BLOCK_SIZE = 0x10000;
+} // namespace
+
+LocalizeReadingZoneState::LocalizeReadingZoneState()
+    : m_zone(nullptr),
+      m_string_memory(STRING_MEMORY_ARENA_BLOCK_SIZE)
+{
+}
+
+LocalizeReadingZoneState::~LocalizeReadingZoneState()
+{
+    // The state only lives as long as loading the zone while the interned strings are referenced by its assets
+    if (m_zone)
+        m_zone->GetMemory()->TakeOwnership(m_string_memory);
+}
+
+void LocalizeReadingZoneState::SetZone(Zone* zone)
+{
+    m_zone = zone;
+}
+
 bool LocalizeReadingZoneState::DoLocalizeEntryDuplicateCheck(const std::string& key)
 {
+    std::lock_guard lock(m_mutex);
     const auto existingEntry = m_keys.find(key);
     if (existingEntry != m_keys.end())
         return false;
@@ -9,3 +33,16 @@ bool LocalizeReadingZoneState::DoLocalizeEntryDuplicateCheck(const std::string&
     m_keys.emplace(key);
     return true;
 }
+
+const char* LocalizeReadingZoneState::InternString(const std::string& str)
+{
+    std::lock_guard lock(m_mutex);
+    const auto existingString = m_strings.find(str);
+    if (existingString != m_strings.end())
+        return existingString->data();
+
+    const auto* internedString = m_string_memory.Dup(str.c_str());
+    m_strings.emplace(internedString, str.size());
+
+    return internedString;
+}
@@ -1,13 +1,28 @@
 #pragma once
 
 #include "AssetLoading/IZoneAssetLoaderState.h"
+#include "Utils/MemoryManager.h"
 
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 
+/**
+ * \brief Keeps track of the localize keys of a zone. Can be used from multiple threads at once since localize files are loaded in parallel.
+ */
 class LocalizeReadingZoneState final : public IZoneAssetLoaderState
 {
 public:
+    LocalizeReadingZoneState();
+    ~LocalizeReadingZoneState() override;
+    LocalizeReadingZoneState(const LocalizeReadingZoneState& other) = delete;
+    LocalizeReadingZoneState(LocalizeReadingZoneState&& other) noexcept = delete;
+    LocalizeReadingZoneState& operator=(const LocalizeReadingZoneState& other) = delete;
+    LocalizeReadingZoneState& operator=(LocalizeReadingZoneState&& other) noexcept = delete;
+
+    void SetZone(Zone* zone) override;
+
     /**
      * Checks whether a localize key was already added.
      * Inserts key if it was not added yet.
@@ -17,6 +32,20 @@ public:
      */
     bool DoLocalizeEntryDuplicateCheck(const std::string& key);
 
+    /**
+     * \brief Returns a copy of a localize string that lives as long as the zone.
+     * Identical strings are only stored once per zone, which saves memory for values that are the same for many keys.
+     * \param str The string to copy.
+     * \return The stored copy of the string.
+     */
+    const char* InternString(const std::string& str);
+
 private:
+    Zone* m_zone;
     std::unordered_set<std::string> m_keys;
+
+    // Interned strings are kept in memory of this state until it hands it over to the zone, since parallel loads cannot use the zone memory
+    MemoryManager m_string_memory;
+    std::unordered_set<std::string_view> m_strings;
+    std::mutex m_mutex;
 };
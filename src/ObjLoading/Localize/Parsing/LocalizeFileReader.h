@@ -2,7 +2,6 @@
 
 #include "Game/GameLanguage.h"
 #include "Localize/CommonLocalizeEntry.h"
-#include "Localize/LocalizeReadingZoneState.h"
 #include "Parsing/IParserLineStream.h"
 
 #include <map>
@@ -16,13 +15,12 @@ class LocalizeFileReader
     IParserLineStream* m_stream;
     std::vector<std::unique_ptr<IParserLineStream>> m_open_streams;
     GameLanguage m_language;
-    LocalizeReadingZoneState* m_zone_state;
 
     bool OpenBaseStream(std::istream& stream);
     void SetupStreamProxies();
 
 public:
-    LocalizeFileReader(std::istream& stream, std::string fileName, GameLanguage language, LocalizeReadingZoneState* zoneState);
+    LocalizeFileReader(std::istream& stream, std::string fileName, GameLanguage language);
 
     bool ReadLocalizeFile(std::vector<CommonLocalizeEntry>& entries);
 };
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "AssetLoading/IZoneAssetLoaderState.h"
+#include "Utils/ClassUtils.h"
+#include "Utils/MemoryManager.h"
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+namespace material
+{
+    /**
+     * \brief Keeps the tables of materials that were created for a zone so that materials with identical tables can point to the same memory.
+     * The zone writer only writes tables that are marked as reusable once per pointer, so sharing tables makes zones smaller.
+     * \tparam T The type of the table entries. Tables are compared by their bytes so entries must not contain anything but plain data.
+     */
+    template<typename T> class MaterialTablePool final : public IZoneAssetLoaderState
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+    public:
+        /**
+         * \brief Returns a table in zone memory with the specified entries.
+         * If a table with the same entries was already requested for this zone, it is returned instead of allocating a new one.
+         * Returned tables can be shared between materials and must not be modified.
+         * \param memory The memory of the zone.
+         * \param entries The entries of the table.
+         * \param entryCount The amount of entries of the table.
+         * \return The table or \c nullptr if \p entryCount is \c 0.
+         */
+        _NODISCARD T* GetTable(MemoryManager& memory, const T* entries, const size_t entryCount)
+        {
+            if (entryCount == 0u)
+                return nullptr;
+
+            std::string key(reinterpret_cast<const char*>(entries), sizeof(T) * entryCount);
+            const auto existingTable = m_tables.find(key);
+            if (existingTable != m_tables.end())
+                return existingTable->second;
+
+            auto* table = memory.Alloc<T>(entryCount);
+            std::memcpy(table, entries, sizeof(T) * entryCount);
+            m_tables.emplace(std::move(key), table);
+
+            return table;
+        }
+
+    private:
+        std::unordered_map<std::string, T*> m_tables;
+    };
+} // namespace material
@@ -6,7 +6,9 @@
 #include "Utils/FileUtils.h"
 #include "zlib.h"
 
+#include <algorithm>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <sstream>
 #include <vector>
@@ -170,26 +172,34 @@ public:
         return true;
     }
 
-    std::unique_ptr<iobjstream> GetEntryData(const Hash nameHash, const Hash dataHash)
+    const IPakIndexEntry* FindEntry(const Hash nameHash, const Hash dataHash) const
     {
         IPakIndexEntryKey wantedKey{};
         wantedKey.nameHash = nameHash;
         wantedKey.dataHash = dataHash;
 
-        for (auto& entry : m_index_entries)
-        {
-            if (entry.key.combinedKey == wantedKey.combinedKey)
-            {
-                return m_stream_manager.OpenStream(static_cast<int64_t>(m_data_section->offset) + entry.offset, entry.size);
-            }
-            else if (entry.key.combinedKey > wantedKey.combinedKey)
-            {
-                // The index entries are sorted so if the current entry is higher than the wanted entry we can cancel here
-                return nullptr;
-            }
-        }
+        // The index entries are sorted by their key when loading the index
+        const auto foundEntry = std::ranges::lower_bound(m_index_entries,
+                                                         wantedKey.combinedKey,
+                                                         std::less(),
+                                                         [](const IPakIndexEntry& entry)
+                                                         {
+                                                             return entry.key.combinedKey;
+                                                         });
+
+        if (foundEntry == m_index_entries.end() || foundEntry->key.combinedKey != wantedKey.combinedKey)
+            return nullptr;
 
-        return nullptr;
+        return &*foundEntry;
+    }
+
+    std::unique_ptr<iobjstream> GetEntryData(const Hash nameHash, const Hash dataHash)
+    {
+        const auto* foundEntry = FindEntry(nameHash, dataHash);
+        if (foundEntry == nullptr)
+            return nullptr;
+
+        return m_stream_manager.OpenStream(static_cast<int64_t>(m_data_section->offset) + foundEntry->offset, foundEntry->size);
     }
 
     static Hash HashString(const std::string& str)
@@ -224,6 +234,11 @@ bool IPak::Initialize()
     return m_impl->Initialize();
 }
 
+bool IPak::HasEntry(const Hash nameHash, const Hash dataHash) const
+{
+    return m_impl->FindEntry(nameHash, dataHash) != nullptr;
+}
+
 std::unique_ptr<iobjstream> IPak::GetEntryStream(const Hash nameHash, const Hash dataHash) const
 {
     return m_impl->GetEntryData(nameHash, dataHash);
@@ -24,6 +24,14 @@ public:
     std::string GetName() override;
 
     bool Initialize();
+
+    /**
+     * \brief Checks whether the ipak contains an entry without opening it.
+     * \param nameHash The hash of the name of the entry.
+     * \param dataHash The hash of the data of the entry.
+     * \return \c true if the ipak contains the entry, \c false otherwise.
+     */
+    _NODISCARD bool HasEntry(Hash nameHash, Hash dataHash) const;
     _NODISCARD std::unique_ptr<iobjstream> GetEntryStream(Hash nameHash, Hash dataHash) const;
 
     static Hash HashString(const std::string& str);
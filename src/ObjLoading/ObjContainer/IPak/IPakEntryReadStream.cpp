@@ -38,15 +38,7 @@ IPakEntryReadStream::~IPakEntryReadStream()
 
 size_t IPakEntryReadStream::ReadChunks(uint8_t* buffer, const int64_t startPos, const size_t chunkCount) const
 {
-    m_stream_manager_actions->StartReading();
-
-    m_stream.seekg(startPos);
-    m_stream.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(chunkCount) * IPAK_CHUNK_SIZE);
-    const auto readSize = static_cast<size_t>(m_stream.gcount());
-
-    m_stream_manager_actions->StopReading();
-
-    return readSize / IPAK_CHUNK_SIZE;
+    return m_stream_manager_actions->ReadChunks(buffer, startPos, chunkCount);
 }
 
 bool IPakEntryReadStream::SetChunkBufferWindow(const int64_t startPos, size_t chunkCount)
@@ -2,8 +2,13 @@
 
 #include "IPakEntryReadStream.h"
 #include "ObjContainer/IPak/IPakTypes.h"
+#include "ObjLoading.h"
 
 #include <algorithm>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 using namespace ipak_consts;
@@ -32,6 +37,13 @@ class IPakStreamManager::Impl final : public IPakStreamManagerActions
         }
     };
 
+    class CachedChunk
+    {
+    public:
+        int64_t m_chunk_index;
+        std::unique_ptr<uint8_t[]> m_data;
+    };
+
     std::istream& m_stream;
 
     std::mutex m_read_mutex;
@@ -40,9 +52,69 @@ class IPakStreamManager::Impl final : public IPakStreamManagerActions
     std::vector<ManagedStream> m_open_streams;
     std::vector<ChunkBuffer*> m_chunk_buffers;
 
+    // Chunks read from disk are kept in least recently used order since neighbouring entries often share chunks
+    std::mutex m_cache_mutex;
+    size_t m_cache_capacity;
+    std::list<CachedChunk> m_cached_chunks;
+    std::unordered_map<int64_t, std::list<CachedChunk>::iterator> m_cached_chunk_lookup;
+
+    bool TakeChunkFromCache(const int64_t chunkIndex, uint8_t* buffer)
+    {
+        std::lock_guard lock(m_cache_mutex);
+
+        const auto foundChunk = m_cached_chunk_lookup.find(chunkIndex);
+        if (foundChunk == m_cached_chunk_lookup.end())
+            return false;
+
+        m_cached_chunks.splice(m_cached_chunks.begin(), m_cached_chunks, foundChunk->second);
+        memcpy(buffer, foundChunk->second->m_data.get(), IPAK_CHUNK_SIZE);
+
+        return true;
+    }
+
+    _NODISCARD bool IsChunkCached(const int64_t chunkIndex)
+    {
+        std::lock_guard lock(m_cache_mutex);
+        return m_cached_chunk_lookup.find(chunkIndex) != m_cached_chunk_lookup.end();
+    }
+
+    void AddChunkToCache(const int64_t chunkIndex, const uint8_t* buffer)
+    {
+        std::lock_guard lock(m_cache_mutex);
+
+        if (m_cached_chunk_lookup.find(chunkIndex) != m_cached_chunk_lookup.end())
+            return;
+
+        // Reuse the memory of the least recently used chunk when the cache is full
+        std::unique_ptr<uint8_t[]> data;
+        if (m_cached_chunks.size() >= m_cache_capacity)
+        {
+            data = std::move(m_cached_chunks.back().m_data);
+            m_cached_chunk_lookup.erase(m_cached_chunks.back().m_chunk_index);
+            m_cached_chunks.pop_back();
+        }
+        else
+            data = std::make_unique<uint8_t[]>(IPAK_CHUNK_SIZE);
+
+        memcpy(data.get(), buffer, IPAK_CHUNK_SIZE);
+        m_cached_chunks.emplace_front(CachedChunk{chunkIndex, std::move(data)});
+        m_cached_chunk_lookup.emplace(chunkIndex, m_cached_chunks.begin());
+    }
+
+    size_t ReadChunksFromDisk(uint8_t* buffer, const int64_t startPos, const size_t chunkCount)
+    {
+        std::lock_guard lock(m_read_mutex);
+
+        m_stream.seekg(startPos);
+        m_stream.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(chunkCount) * IPAK_CHUNK_SIZE);
+
+        return static_cast<size_t>(m_stream.gcount()) / IPAK_CHUNK_SIZE;
+    }
+
 public:
     explicit Impl(std::istream& stream)
-        : m_stream(stream)
+        : m_stream(stream),
+          m_cache_capacity(ObjLoading::Configuration.IPakChunkCacheSize / IPAK_CHUNK_SIZE)
     {
         m_chunk_buffers.push_back(new ChunkBuffer());
     }
@@ -96,14 +168,39 @@ public:
         return std::make_unique<iobjstream>(std::move(ipakEntryStream));
     }
 
-    void StartReading() override
+    size_t ReadChunks(uint8_t* buffer, const int64_t startPos, const size_t chunkCount) override
     {
-        m_read_mutex.lock();
-    }
+        if (m_cache_capacity == 0)
+            return ReadChunksFromDisk(buffer, startPos, chunkCount);
 
-    void StopReading() override
-    {
-        m_read_mutex.unlock();
+        const auto firstChunkIndex = startPos / static_cast<int64_t>(IPAK_CHUNK_SIZE);
+        size_t chunkOffset = 0;
+
+        while (chunkOffset < chunkCount)
+        {
+            if (TakeChunkFromCache(firstChunkIndex + static_cast<int64_t>(chunkOffset), &buffer[chunkOffset * IPAK_CHUNK_SIZE]))
+            {
+                chunkOffset++;
+                continue;
+            }
+
+            // Read all consecutive chunks that are missing from the cache at once
+            auto missingChunkCount = 1u;
+            while (chunkOffset + missingChunkCount < chunkCount && !IsChunkCached(firstChunkIndex + static_cast<int64_t>(chunkOffset + missingChunkCount)))
+                missingChunkCount++;
+
+            auto* missingChunkBuffer = &buffer[chunkOffset * IPAK_CHUNK_SIZE];
+            const auto readChunkCount = ReadChunksFromDisk(missingChunkBuffer, startPos + static_cast<int64_t>(chunkOffset * IPAK_CHUNK_SIZE), missingChunkCount);
+
+            for (auto readChunk = 0u; readChunk < readChunkCount; readChunk++)
+                AddChunkToCache(firstChunkIndex + static_cast<int64_t>(chunkOffset + readChunk), &missingChunkBuffer[readChunk * IPAK_CHUNK_SIZE]);
+
+            chunkOffset += readChunkCount;
+            if (readChunkCount < missingChunkCount)
+                break;
+        }
+
+        return chunkOffset;
     }
 
     void CloseStream(objbuf* stream) override
@@ -10,8 +10,14 @@
 class IPakStreamManagerActions
 {
 public:
-    virtual void StartReading() = 0;
-    virtual void StopReading() = 0;
+    /**
+     * \brief Reads the specified chunks, either from the chunk cache shared by all streams of the ipak or from disk.
+     * \param buffer The location to write the chunk data to. Must be able to hold the specified amount of chunks.
+     * \param startPos The file offset of the first chunk. Must be aligned to the chunk size.
+     * \param chunkCount The amount of chunks to read.
+     * \return The amount of chunks that could be successfully read.
+     */
+    virtual size_t ReadChunks(uint8_t* buffer, int64_t startPos, size_t chunkCount) = 0;
 
     virtual void CloseStream(objbuf* stream) = 0;
 };
@@ -2,18 +2,81 @@
 
 #include "ObjLoading.h"
 #include "Utils/FileToZlibWrapper.h"
+#include "Utils/MemoryMappedFile.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
-#include <map>
 #include <memory>
+#include <mutex>
+#include <ranges>
+#include <unordered_map>
 #include <unzip.h>
+#include <vector>
 
 namespace fs = std::filesystem;
 
 ObjContainerRepository<IWD, ISearchPath> IWD::Repository;
 
+namespace
+{
+    class IWDEntry
+    {
+    public:
+        int64_t m_size{};
+        unz_file_pos m_file_pos{};
+    };
+
+    class IWDIndex
+    {
+    public:
+        std::unordered_map<std::string, IWDEntry> m_entries;
+
+        // Files are listed in alphabetical order independent of how the entries are hashed
+        std::vector<const std::string*> m_sorted_names;
+    };
+
+    /**
+     * \brief Keeps the central directory index of every IWD that was opened during the session.
+     * Search paths are loaded and unloaded for every project, so the same IWDs would otherwise be scanned again for each of them.
+     * An index is only used again when the size and the last write time of its IWD did not change.
+     */
+    class IWDIndexCache
+    {
+        class CachedIndex
+        {
+        public:
+            uintmax_t m_file_size;
+            fs::file_time_type m_last_write_time;
+            std::shared_ptr<const IWDIndex> m_index;
+        };
+
+        std::unordered_map<std::string, CachedIndex> m_indices;
+        std::mutex m_mutex;
+
+    public:
+        std::shared_ptr<const IWDIndex> Find(const std::string& path, const uintmax_t fileSize, const fs::file_time_type lastWriteTime)
+        {
+            std::lock_guard lock(m_mutex);
+            const auto foundIndex = m_indices.find(path);
+            if (foundIndex == m_indices.end() || foundIndex->second.m_file_size != fileSize || foundIndex->second.m_last_write_time != lastWriteTime)
+                return nullptr;
+
+            return foundIndex->second.m_index;
+        }
+
+        void Add(const std::string& path, const uintmax_t fileSize, const fs::file_time_type lastWriteTime, std::shared_ptr<const IWDIndex> index)
+        {
+            std::lock_guard lock(m_mutex);
+            m_indices[path] = CachedIndex{fileSize, lastWriteTime, std::move(index)};
+        }
+    };
+
+    IWDIndexCache indexCache;
+} // namespace
+
 class IWDFile final : public objbuf
 {
 public:
@@ -22,16 +85,37 @@ public:
     public:
         virtual ~IParent() = default;
 
-        virtual void OnIWDFileClose() = 0;
+        virtual void OnIWDFileClose(unzFile container) = 0;
     };
 
 private:
+    static constexpr size_t BUFFER_SIZE = 0x10000;
+
     IParent* m_parent;
     bool m_open;
     int64_t m_size;
     unzFile m_container;
-    bool m_peeked;
-    int_type m_peek_symbol;
+    std::unique_ptr<char[]> m_buffer;
+
+    _NODISCARD int64_t CurrentPos() const
+    {
+        // The container is ahead of the reader by the amount of bytes that are still buffered
+        return static_cast<int64_t>(unztell64(m_container)) - static_cast<int64_t>(egptr() - gptr());
+    }
+
+    bool FillBuffer()
+    {
+        const auto result = unzReadCurrentFile(m_container, m_buffer.get(), static_cast<unsigned>(BUFFER_SIZE));
+
+        if (result <= 0)
+        {
+            setg(m_buffer.get(), m_buffer.get(), m_buffer.get());
+            return false;
+        }
+
+        setg(m_buffer.get(), m_buffer.get(), m_buffer.get() + result);
+        return true;
+    }
 
 public:
     IWDFile(IParent* parent, const unzFile container, const int64_t size)
@@ -39,9 +123,9 @@ public:
           m_open(true),
           m_size(size),
           m_container(container),
-          m_peeked(false),
-          m_peek_symbol(0)
+          m_buffer(std::make_unique<char[]>(BUFFER_SIZE))
     {
+        setg(m_buffer.get(), m_buffer.get(), m_buffer.get());
     }
 
     ~IWDFile() override
@@ -55,49 +139,61 @@ public:
 protected:
     int_type underflow() override
     {
-        if (m_peeked)
-            return m_peek_symbol;
+        if (gptr() < egptr())
+            return traits_type::to_int_type(*gptr());
 
-        const auto result = unzReadCurrentFile(m_container, &m_peek_symbol, 1u);
+        if (!FillBuffer())
+            return EOF;
 
-        if (result >= 0)
-        {
-            m_peeked = true;
-            return static_cast<int_type>(m_peek_symbol);
-        }
-
-        return EOF;
+        return traits_type::to_int_type(*gptr());
     }
 
-    int_type uflow() override
+    std::streamsize xsgetn(char* ptr, std::streamsize count) override
     {
-        if (m_peeked)
+        std::streamsize totalRead = 0;
+
+        const auto buffered = std::min<std::streamsize>(egptr() - gptr(), count);
+        if (buffered > 0)
         {
-            m_peeked = false;
-            return m_peek_symbol;
+            memcpy(ptr, gptr(), static_cast<size_t>(buffered));
+            gbump(static_cast<int>(buffered));
+            totalRead += buffered;
         }
 
-        const auto result = unzReadCurrentFile(m_container, &m_peek_symbol, 1u);
-        return result >= 0 ? static_cast<int_type>(m_peek_symbol) : EOF;
-    }
-
-    std::streamsize xsgetn(char* ptr, std::streamsize count) override
-    {
-        if (m_peeked && count >= 1)
+        while (totalRead < count)
         {
-            *ptr = static_cast<char>(m_peek_symbol);
-            ptr++;
-            count--;
-        }
+            const auto remaining = count - totalRead;
 
-        const auto result = unzReadCurrentFile(m_container, ptr, static_cast<unsigned>(count));
+            // Large reads go straight into the caller's memory, small ones go through the buffer
+            if (remaining >= static_cast<std::streamsize>(BUFFER_SIZE))
+            {
+                // The buffer no longer holds the data right before the container position, so it must not be used for seeking
+                setg(m_buffer.get(), m_buffer.get(), m_buffer.get());
+
+                const auto result = unzReadCurrentFile(m_container, &ptr[totalRead], static_cast<unsigned>(std::min<std::streamsize>(remaining, UINT32_MAX)));
+                if (result <= 0)
+                    break;
+
+                totalRead += result;
+            }
+            else
+            {
+                if (!FillBuffer())
+                    break;
 
-        return result >= 0 ? static_cast<std::streamsize>(result) : 0;
+                const auto toCopy = std::min<std::streamsize>(egptr() - gptr(), remaining);
+                memcpy(&ptr[totalRead], gptr(), static_cast<size_t>(toCopy));
+                gbump(static_cast<int>(toCopy));
+                totalRead += toCopy;
+            }
+        }
+
+        return totalRead;
     }
 
     pos_type seekoff(const off_type off, const std::ios_base::seekdir dir, const std::ios_base::openmode mode) override
     {
-        const auto currentPos = unztell64(m_container);
+        const auto currentPos = CurrentPos();
 
         pos_type targetPos;
         if (dir == std::ios_base::beg)
@@ -118,28 +214,35 @@ protected:
 
     pos_type seekpos(const pos_type pos, const std::ios_base::openmode mode) override
     {
-        const auto currentPos = unztell64(m_container);
+        const auto containerPos = static_cast<int64_t>(unztell64(m_container));
+        const auto bufferStartPos = containerPos - static_cast<int64_t>(egptr() - eback());
+        const auto targetPos = static_cast<int64_t>(pos);
 
-        if (static_cast<pos_type>(currentPos) < pos)
+        // Seeking within the buffered data does not require touching the container
+        if (targetPos >= bufferStartPos && targetPos <= containerPos)
         {
-            auto skipAmount = pos - static_cast<pos_type>(currentPos);
+            setg(eback(), eback() + (targetPos - bufferStartPos), egptr());
+            return pos;
+        }
+
+        if (containerPos < targetPos)
+        {
+            setg(m_buffer.get(), m_buffer.get(), m_buffer.get());
+
+            auto skipAmount = targetPos - containerPos;
             while (skipAmount > 0)
             {
-                char temp[1024];
-                const auto toRead = skipAmount > sizeof(temp) ? sizeof(temp) : static_cast<size_t>(skipAmount);
-                unzReadCurrentFile(m_container, temp, toRead);
-                skipAmount -= toRead;
+                const auto toRead = static_cast<unsigned>(std::min<int64_t>(skipAmount, BUFFER_SIZE));
+                const auto result = unzReadCurrentFile(m_container, m_buffer.get(), toRead);
+                if (result <= 0)
+                    return std::streampos(-1);
+
+                skipAmount -= result;
             }
 
             return pos;
         }
 
-        if (currentPos == pos)
-        {
-            // This is fine
-            return currentPos;
-        }
-
         return std::streampos(-1);
     }
 
@@ -154,7 +257,7 @@ public:
         unzCloseCurrentFile(m_container);
         m_open = false;
 
-        m_parent->OnIWDFileClose();
+        m_parent->OnIWDFileClose(m_container);
 
         return true;
     }
@@ -162,61 +265,110 @@ public:
 
 class IWD::Impl : public ISearchPath, public IObjContainer, public IWDFile::IParent
 {
-    class IWDEntry
+    // Every open entry needs its own container handle since a unzFile can only read a single entry at a time
+    class ReadHandle
     {
     public:
-        int64_t m_size{};
-        unz_file_pos m_file_pos{};
+        std::unique_ptr<std::istream> m_stream;
+        std::unique_ptr<BufferedZlibInput> m_buffered_input;
+        std::unique_ptr<MemoryZlibInput> m_memory_input;
+        unzFile m_unz_file;
+
+        explicit ReadHandle(std::unique_ptr<std::istream> stream)
+            : m_stream(std::move(stream)),
+              m_buffered_input(std::make_unique<BufferedZlibInput>(*m_stream)),
+              m_unz_file(nullptr)
+        {
+        }
+
+        explicit ReadHandle(const MemoryMappedFile& mappedFile)
+            : m_memory_input(std::make_unique<MemoryZlibInput>(mappedFile.GetData(), mappedFile.GetSize())),
+              m_unz_file(nullptr)
+        {
+        }
+
+        ~ReadHandle()
+        {
+            if (m_unz_file != nullptr)
+            {
+                unzClose(m_unz_file);
+                m_unz_file = nullptr;
+            }
+        }
+
+        ReadHandle(const ReadHandle& other) = delete;
+        ReadHandle(ReadHandle&& other) noexcept = delete;
+        ReadHandle& operator=(const ReadHandle& other) = delete;
+        ReadHandle& operator=(ReadHandle&& other) noexcept = delete;
+
+        bool Open()
+        {
+            auto ioFunctions = m_memory_input ? FileToZlibWrapper::CreateFunctions32ForFile(m_memory_input.get())
+                                              : FileToZlibWrapper::CreateFunctions32ForFile(m_buffered_input.get());
+            m_unz_file = unzOpen2("", &ioFunctions);
+
+            return m_unz_file != nullptr;
+        }
     };
 
     std::string m_path;
     std::unique_ptr<std::istream> m_stream;
-    unzFile m_unz_file;
+    bool m_initialized;
 
-    IWDFile* m_last_file;
+    // Handles read from the mapped file directly if the IWD could be mapped
+    MemoryMappedFile m_mapped_file;
 
-    std::map<std::string, IWDEntry> m_entry_map;
+    std::mutex m_handle_mutex;
+    std::vector<std::unique_ptr<ReadHandle>> m_handles;
+    std::vector<ReadHandle*> m_free_handles;
 
-public:
-    Impl(std::string path, std::unique_ptr<std::istream> stream)
-        : m_path(std::move(path)),
-          m_stream(std::move(stream)),
-          m_unz_file(nullptr),
-          m_last_file(nullptr)
-    {
-    }
+    std::shared_ptr<const IWDIndex> m_index;
 
-    ~Impl() override
+    ReadHandle* AcquireHandle()
     {
-        if (m_unz_file != nullptr)
+        std::lock_guard lock(m_handle_mutex);
+
+        if (!m_free_handles.empty())
         {
-            unzClose(m_unz_file);
-            m_unz_file = nullptr;
+            auto* handle = m_free_handles.back();
+            m_free_handles.pop_back();
+            return handle;
         }
-    }
-
-    Impl(const Impl& other) = delete;
-    Impl(Impl&& other) noexcept = default;
-    Impl& operator=(const Impl& other) = delete;
-    Impl& operator=(Impl&& other) noexcept = default;
-
-    bool Initialize()
-    {
-        auto ioFunctions = FileToZlibWrapper::CreateFunctions32ForFile(m_stream.get());
-        m_unz_file = unzOpen2("", &ioFunctions);
 
-        if (m_unz_file == nullptr)
+        // All existing handles are busy so open the file another time to be able to read concurrently
+        std::unique_ptr<ReadHandle> handle;
+        if (m_mapped_file.IsOpen())
         {
-            printf("Could not open IWD \"%s\"\n", m_path.c_str());
-            return false;
+            handle = std::make_unique<ReadHandle>(m_mapped_file);
+        }
+        else
+        {
+            auto stream = std::make_unique<std::ifstream>(m_path, std::fstream::in | std::fstream::binary);
+            if (!stream->is_open())
+                throw std::runtime_error("Could not open additional read handle for IWD \"" + m_path + "\".");
+
+            handle = std::make_unique<ReadHandle>(std::move(stream));
         }
 
-        auto ret = unzGoToFirstFile(m_unz_file);
+        if (!handle->Open())
+            throw std::runtime_error("Could not open additional read handle for IWD \"" + m_path + "\".");
+
+        auto* result = handle.get();
+        m_handles.emplace_back(std::move(handle));
+
+        return result;
+    }
+
+    static std::shared_ptr<const IWDIndex> ReadIndex(const unzFile unzHandle)
+    {
+        auto index = std::make_shared<IWDIndex>();
+
+        auto ret = unzGoToFirstFile(unzHandle);
         while (ret == Z_OK)
         {
             unz_file_info64 info;
             char fileNameBuffer[256];
-            unzGetCurrentFileInfo64(m_unz_file, &info, fileNameBuffer, sizeof(fileNameBuffer), nullptr, 0, nullptr, 0);
+            unzGetCurrentFileInfo64(unzHandle, &info, fileNameBuffer, sizeof(fileNameBuffer), nullptr, 0, nullptr, 0);
 
             std::string fileName(fileNameBuffer);
             std::filesystem::path path(fileName);
@@ -225,24 +377,97 @@ public:
             {
                 IWDEntry entry;
                 entry.m_size = info.uncompressed_size;
-                unzGetFilePos(m_unz_file, &entry.m_file_pos);
-                m_entry_map.emplace(std::move(fileName), entry);
+                unzGetFilePos(unzHandle, &entry.m_file_pos);
+                index->m_entries.emplace(std::move(fileName), entry);
             }
 
-            ret = unzGoToNextFile(m_unz_file);
+            ret = unzGoToNextFile(unzHandle);
+        }
+
+        index->m_sorted_names.reserve(index->m_entries.size());
+        for (const auto& entryName : index->m_entries | std::views::keys)
+            index->m_sorted_names.emplace_back(&entryName);
+
+        std::ranges::sort(index->m_sorted_names,
+                          [](const std::string* name1, const std::string* name2)
+                          {
+                              return *name1 < *name2;
+                          });
+
+        return index;
+    }
+
+public:
+    Impl(std::string path, std::unique_ptr<std::istream> stream)
+        : m_path(std::move(path)),
+          m_stream(std::move(stream)),
+          m_initialized(false)
+    {
+    }
+
+    ~Impl() override = default;
+
+    Impl(const Impl& other) = delete;
+    Impl(Impl&& other) noexcept = delete;
+    Impl& operator=(const Impl& other) = delete;
+    Impl& operator=(Impl&& other) noexcept = delete;
+
+    bool Initialize()
+    {
+        std::unique_ptr<ReadHandle> primaryHandle;
+        if (ObjLoading::Configuration.MapIWDFiles && m_mapped_file.Open(m_path))
+        {
+            primaryHandle = std::make_unique<ReadHandle>(m_mapped_file);
+            m_stream.reset();
+        }
+        else
+        {
+            primaryHandle = std::make_unique<ReadHandle>(std::move(m_stream));
+        }
+
+        if (!primaryHandle->Open())
+        {
+            printf("Could not open IWD \"%s\"\n", m_path.c_str());
+            return false;
+        }
+
+        const auto unzHandle = primaryHandle->m_unz_file;
+        m_free_handles.emplace_back(primaryHandle.get());
+        m_handles.emplace_back(std::move(primaryHandle));
+
+        // The positions of the entries are valid for every handle of the same file, so a cached index can be used as is
+        std::error_code ec;
+        const auto indexPath = fs::absolute(m_path, ec).lexically_normal().string();
+        const auto fileSize = fs::file_size(m_path, ec);
+        const auto lastWriteTime = ec ? fs::file_time_type() : fs::last_write_time(m_path, ec);
+        const auto canCacheIndex = !ec;
+
+        auto indexWasCached = false;
+        if (canCacheIndex)
+        {
+            m_index = indexCache.Find(indexPath, fileSize, lastWriteTime);
+            indexWasCached = m_index != nullptr;
+        }
+
+        if (!m_index)
+        {
+            m_index = ReadIndex(unzHandle);
+            if (canCacheIndex)
+                indexCache.Add(indexPath, fileSize, lastWriteTime, m_index);
         }
 
         if (ObjLoading::Configuration.Verbose)
         {
-            printf("Loaded IWD \"%s\" with %u entries\n", m_path.c_str(), m_entry_map.size());
+            printf("Loaded IWD \"%s\" with %u entries%s\n", m_path.c_str(), m_index->m_entries.size(), indexWasCached ? " from cached index" : "");
         }
 
+        m_initialized = true;
         return true;
     }
 
     SearchPathOpenFile Open(const std::string& fileName) override
     {
-        if (m_unz_file == nullptr)
+        if (!m_initialized)
         {
             return SearchPathOpenFile();
         }
@@ -250,25 +475,23 @@ public:
         auto iwdFilename = fileName;
         std::ranges::replace(iwdFilename, '\\', '/');
 
-        const auto iwdEntry = m_entry_map.find(iwdFilename);
+        const auto iwdEntry = m_index->m_entries.find(iwdFilename);
 
-        if (iwdEntry != m_entry_map.end())
+        if (iwdEntry != m_index->m_entries.end())
         {
-            if (m_last_file != nullptr)
-            {
-                throw std::runtime_error("Trying to open new IWD file while last one was not yet closed.");
-            }
+            auto* handle = AcquireHandle();
 
             auto pos = iwdEntry->second.m_file_pos;
-            unzGoToFilePos(m_unz_file, &pos);
+            unzGoToFilePos(handle->m_unz_file, &pos);
 
-            if (unzOpenCurrentFile(m_unz_file) == UNZ_OK)
+            if (unzOpenCurrentFile(handle->m_unz_file) == UNZ_OK)
             {
-                auto result = std::make_unique<IWDFile>(this, m_unz_file, iwdEntry->second.m_size);
-                m_last_file = result.get();
+                auto result = std::make_unique<IWDFile>(this, handle->m_unz_file, iwdEntry->second.m_size);
                 return SearchPathOpenFile(std::make_unique<iobjstream>(std::move(result)), iwdEntry->second.m_size);
             }
 
+            std::lock_guard lock(m_handle_mutex);
+            m_free_handles.emplace_back(handle);
             return SearchPathOpenFile();
         }
 
@@ -292,9 +515,9 @@ public:
             return;
         }
 
-        for (auto& [entryName, entry] : m_entry_map)
+        for (const auto* entryName : m_index->m_sorted_names)
         {
-            std::filesystem::path entryPath(entryName);
+            std::filesystem::path entryPath(*entryName);
 
             if (!options.m_should_include_subdirectories && entryPath.has_parent_path())
                 continue;
@@ -302,13 +525,30 @@ public:
             if (options.m_filter_extensions && options.m_extension != entryPath.extension().string())
                 continue;
 
-            callback(entryName);
+            callback(*entryName);
         }
     }
 
-    void OnIWDFileClose() override
+    bool ListFiles(const std::function<void(const std::string&)>& callback) override
     {
-        m_last_file = nullptr;
+        for (const auto* entryName : m_index->m_sorted_names)
+            callback(*entryName);
+
+        return true;
+    }
+
+    void OnIWDFileClose(const unzFile container) override
+    {
+        std::lock_guard lock(m_handle_mutex);
+        const auto handle = std::ranges::find_if(m_handles,
+                                                 [container](const std::unique_ptr<ReadHandle>& existingHandle)
+                                                 {
+                                                     return existingHandle->m_unz_file == container;
+                                                 });
+
+        assert(handle != m_handles.end());
+        if (handle != m_handles.end())
+            m_free_handles.emplace_back(handle->get());
     }
 };
 
@@ -361,3 +601,8 @@ void IWD::Find(const SearchPathSearchOptions& options, const std::function<void(
 {
     return m_impl->Find(options, callback);
 }
+
+bool IWD::ListFiles(const std::function<void(const std::string&)>& callback)
+{
+    return m_impl->ListFiles(callback);
+}
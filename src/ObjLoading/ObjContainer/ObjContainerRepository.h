@@ -4,21 +4,31 @@
 #include "Utils/TransformIterator.h"
 
 #include <algorithm>
+#include <functional>
+#include <list>
 #include <memory>
-#include <set>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 template<typename ContainerType, typename ReferencerType> class ObjContainerRepository
 {
+public:
+    using container_callback_t = std::function<void(ContainerType* container)>;
+
+private:
     class ObjContainerEntry
     {
     public:
         std::unique_ptr<ContainerType> m_container;
-        std::set<ReferencerType*> m_references;
+        std::string m_name;
+        std::unordered_set<ReferencerType*> m_references;
 
         explicit ObjContainerEntry(std::unique_ptr<ContainerType> container)
-            : m_container(std::move(container))
+            : m_container(std::move(container)),
+              m_name(m_container->GetName())
         {
         }
 
@@ -29,95 +39,154 @@ template<typename ContainerType, typename ReferencerType> class ObjContainerRepo
         ObjContainerEntry& operator=(ObjContainerEntry&& other) noexcept = default;
     };
 
-    std::vector<ObjContainerEntry> m_containers;
+    using entry_iterator_t = typename std::list<ObjContainerEntry>::iterator;
+
+    // A list keeps the iterators stored in the indices valid when other containers are removed
+    std::list<ObjContainerEntry> m_containers;
+    std::unordered_map<ContainerType*, entry_iterator_t> m_containers_by_pointer;
+
+    // Containers with the same name are kept in the order they were added in, the first one is the one found by name
+    std::unordered_map<std::string, std::vector<entry_iterator_t>> m_containers_by_name;
+    std::unordered_map<ReferencerType*, std::unordered_set<ContainerType*>> m_containers_by_referencer;
+    std::recursive_mutex m_mutex;
+
+    container_callback_t m_on_container_added;
+    container_callback_t m_on_container_removed;
+
+    void AddReference(ObjContainerEntry& entry, ReferencerType* referencer)
+    {
+        if (entry.m_references.emplace(referencer).second)
+            m_containers_by_referencer[referencer].emplace(entry.m_container.get());
+    }
+
+    void RemoveEntry(const entry_iterator_t entry)
+    {
+        if (m_on_container_removed)
+            m_on_container_removed(entry->m_container.get());
+
+        const auto byName = m_containers_by_name.find(entry->m_name);
+        if (byName != m_containers_by_name.end())
+        {
+            auto& entriesWithName = byName->second;
+            entriesWithName.erase(std::find(entriesWithName.begin(), entriesWithName.end(), entry));
+            if (entriesWithName.empty())
+                m_containers_by_name.erase(byName);
+        }
+
+        m_containers_by_pointer.erase(entry->m_container.get());
+        m_containers.erase(entry);
+    }
 
 public:
     ObjContainerRepository() = default;
+
+    /**
+     * \brief Creates a repository that notifies about containers being added and removed, for example to maintain indices over the contents of all containers.
+     * Callbacks are called while holding the repository lock.
+     * \param onContainerAdded Called after a container was added.
+     * \param onContainerRemoved Called before a container is removed while it is still part of the repository.
+     */
+    ObjContainerRepository(container_callback_t onContainerAdded, container_callback_t onContainerRemoved)
+        : m_on_container_added(std::move(onContainerAdded)),
+          m_on_container_removed(std::move(onContainerRemoved))
+    {
+    }
+
     ~ObjContainerRepository() = default;
     ObjContainerRepository(const ObjContainerRepository& other) = delete;
-    ObjContainerRepository(ObjContainerRepository&& other) noexcept = default;
+    ObjContainerRepository(ObjContainerRepository&& other) noexcept = delete;
     ObjContainerRepository& operator=(const ObjContainerRepository& other) = delete;
-    ObjContainerRepository& operator=(ObjContainerRepository&& other) noexcept = default;
+    ObjContainerRepository& operator=(ObjContainerRepository&& other) noexcept = delete;
+
+    /**
+     * \brief Locks the repository for the calling thread.
+     * Adding and removing containers locks on its own but iterating the repository while other threads might modify it requires holding this lock.
+     * \return The lock that is held until it is destroyed.
+     */
+    std::unique_lock<std::recursive_mutex> Lock()
+    {
+        return std::unique_lock(m_mutex);
+    }
 
     void AddContainer(std::unique_ptr<ContainerType> container, ReferencerType* referencer)
     {
-        ObjContainerEntry entry(std::move(container));
-        entry.m_references.insert(referencer);
-        m_containers.emplace_back(std::move(entry));
+        std::lock_guard lock(m_mutex);
+        auto* containerPtr = container.get();
+        const auto entry = m_containers.emplace(m_containers.end(), std::move(container));
+
+        m_containers_by_pointer.emplace(containerPtr, entry);
+        m_containers_by_name[entry->m_name].emplace_back(entry);
+        AddReference(*entry, referencer);
+
+        if (m_on_container_added)
+            m_on_container_added(containerPtr);
     }
 
     bool AddContainerReference(ContainerType* container, ReferencerType* referencer)
     {
-        auto firstEntry = std::find_if(m_containers.begin(),
-                                       m_containers.end(),
-                                       [container](const ObjContainerEntry& entry)
-                                       {
-                                           return entry.m_container.get() == container;
-                                       });
-
-        if (firstEntry != m_containers.end())
-        {
-            firstEntry->m_references.insert(referencer);
-            return true;
-        }
+        std::lock_guard lock(m_mutex);
+        const auto foundEntry = m_containers_by_pointer.find(container);
+        if (foundEntry == m_containers_by_pointer.end())
+            return false;
 
-        return false;
+        AddReference(*foundEntry->second, referencer);
+        return true;
     }
 
+    /**
+     * \brief Removes all references of the specified referencer and removes all containers that are no longer referenced afterwards.
+     * Only touches the containers that are referenced by the referencer.
+     * \param referencer The referencer to remove the references of.
+     */
     void RemoveContainerReferences(ReferencerType* referencer)
     {
-        for (auto iEntry = m_containers.begin(); iEntry != m_containers.end();)
+        std::lock_guard lock(m_mutex);
+        const auto referencedContainers = m_containers_by_referencer.find(referencer);
+        if (referencedContainers == m_containers_by_referencer.end())
+            return;
+
+        for (auto* container : referencedContainers->second)
         {
-            auto foundReference = iEntry->m_references.find(referencer);
-
-            if (foundReference != iEntry->m_references.end())
-            {
-                iEntry->m_references.erase(foundReference);
-            }
-
-            if (iEntry->m_references.empty())
-            {
-                iEntry = m_containers.erase(iEntry);
-            }
-            else
-            {
-                ++iEntry;
-            }
+            const auto foundEntry = m_containers_by_pointer.find(container);
+            if (foundEntry == m_containers_by_pointer.end())
+                continue;
+
+            const auto entry = foundEntry->second;
+            entry->m_references.erase(referencer);
+            if (entry->m_references.empty())
+                RemoveEntry(entry);
         }
+
+        m_containers_by_referencer.erase(referencedContainers);
     }
 
     ContainerType* GetContainerByName(const std::string& name)
     {
-        auto foundEntry = std::find_if(m_containers.begin(),
-                                       m_containers.end(),
-                                       [name](ObjContainerEntry& entry)
-                                       {
-                                           return entry.m_container->GetName() == name;
-                                       });
-
-        if (foundEntry != m_containers.end())
+        std::lock_guard lock(m_mutex);
+        const auto foundEntry = m_containers_by_name.find(name);
+        if (foundEntry != m_containers_by_name.end())
         {
-            return foundEntry->m_container.get();
+            return foundEntry->second.front()->m_container.get();
         }
 
         return nullptr;
     }
 
-    TransformIterator<typename std::vector<ObjContainerEntry>::iterator, ObjContainerEntry&, ContainerType*> begin()
+    TransformIterator<entry_iterator_t, ObjContainerEntry&, ContainerType*> begin()
     {
-        return TransformIterator<typename std::vector<ObjContainerEntry>::iterator, ObjContainerEntry&, ContainerType*>(m_containers.begin(),
-                                                                                                                        [](ObjContainerEntry& entry)
-                                                                                                                        {
-                                                                                                                            return entry.m_container.get();
-                                                                                                                        });
+        return TransformIterator<entry_iterator_t, ObjContainerEntry&, ContainerType*>(m_containers.begin(),
+                                                                                        [](ObjContainerEntry& entry)
+                                                                                        {
+                                                                                            return entry.m_container.get();
+                                                                                        });
     }
 
-    TransformIterator<typename std::vector<ObjContainerEntry>::iterator, ObjContainerEntry&, ContainerType*> end()
+    TransformIterator<entry_iterator_t, ObjContainerEntry&, ContainerType*> end()
     {
-        return TransformIterator<typename std::vector<ObjContainerEntry>::iterator, ObjContainerEntry&, ContainerType*>(m_containers.end(),
-                                                                                                                        [](ObjContainerEntry& entry)
-                                                                                                                        {
-                                                                                                                            return entry.m_container.get();
-                                                                                                                        });
+        return TransformIterator<entry_iterator_t, ObjContainerEntry&, ContainerType*>(m_containers.end(),
+                                                                                        [](ObjContainerEntry& entry)
+                                                                                        {
+                                                                                            return entry.m_container.get();
+                                                                                        });
     }
 };
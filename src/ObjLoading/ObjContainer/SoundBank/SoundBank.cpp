@@ -8,7 +8,14 @@
 #include <sstream>
 #include <vector>
 
-ObjContainerRepository<SoundBank, Zone> SoundBank::Repository;
+// The index is defined before the repository that maintains it so it is constructed first
+std::unordered_map<unsigned int, SoundBank::IndexedEntry> SoundBank::EntriesById;
+ObjContainerRepository<SoundBank, Zone> SoundBank::Repository(AddToEntryIndex, RemoveFromEntryIndex);
+
+namespace
+{
+    constexpr size_t ENTRY_COPY_BUFFER_SIZE = 0x100000u;
+}
 
 class SoundBankInputBuffer final : public objbuf
 {
@@ -109,14 +116,70 @@ public:
     }
 };
 
+class SoundBankMemoryBuffer final : public objbuf
+{
+    bool m_open;
+
+protected:
+    pos_type seekoff(const off_type off, const std::ios_base::seekdir dir, const std::ios_base::openmode mode) override
+    {
+        if (dir == std::ios_base::beg)
+            return seekpos(off, mode);
+
+        if (dir == std::ios_base::end)
+            return seekpos(egptr() - eback() + off, mode);
+
+        return seekpos(gptr() - eback() + off, mode);
+    }
+
+    pos_type seekpos(const pos_type pos, std::ios_base::openmode mode) override
+    {
+        if (pos < 0 || pos > egptr() - eback())
+            return pos_type(-1);
+
+        setg(eback(), eback() + static_cast<off_type>(pos), egptr());
+        return pos;
+    }
+
+public:
+    SoundBankMemoryBuffer(const uint8_t* data, const size_t size)
+        : m_open(true)
+    {
+        // The get area is only ever read from
+        auto* begin = const_cast<char*>(reinterpret_cast<const char*>(data));
+        setg(begin, begin, begin + size);
+    }
+
+    _NODISCARD bool is_open() const override
+    {
+        return m_open;
+    }
+
+    bool close() override
+    {
+        const auto result = m_open;
+        m_open = false;
+        return result;
+    }
+};
+
 SoundBankEntryInputStream::SoundBankEntryInputStream()
-    : m_entry{}
+    : m_entry{},
+      m_mapped_data(nullptr)
 {
 }
 
 SoundBankEntryInputStream::SoundBankEntryInputStream(std::unique_ptr<std::istream> stream, SoundAssetBankEntry entry)
     : m_stream(std::move(stream)),
-      m_entry(entry)
+      m_entry(entry),
+      m_mapped_data(nullptr)
+{
+}
+
+SoundBankEntryInputStream::SoundBankEntryInputStream(const uint8_t* mappedData, SoundAssetBankEntry entry)
+    : m_stream(std::make_unique<iobjstream>(std::make_unique<SoundBankMemoryBuffer>(mappedData, entry.size))),
+      m_entry(entry),
+      m_mapped_data(mappedData)
 {
 }
 
@@ -125,10 +188,60 @@ bool SoundBankEntryInputStream::IsOpen() const
     return m_stream.get() != nullptr;
 }
 
+bool SoundBankEntryInputStream::CopyTo(std::ostream& stream) const
+{
+    if (!m_stream)
+        return false;
+
+    if (m_mapped_data)
+    {
+        const auto position = static_cast<std::streamoff>(m_stream->tellg());
+        if (position < 0 || position > m_entry.size)
+            return false;
+
+        // The pages of the entry are read by the operating system while writing them, no buffer is needed
+        stream.write(reinterpret_cast<const char*>(m_mapped_data + position), static_cast<std::streamsize>(m_entry.size - position));
+        m_stream->seekg(0, std::ios::end);
+
+        return stream.good();
+    }
+
+    // Entries can be dumped from multiple threads so every thread reuses its own buffer instead of allocating one per entry
+    thread_local std::vector<char> buffer(ENTRY_COPY_BUFFER_SIZE);
+
+    while (true)
+    {
+        m_stream->read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        const auto readSize = m_stream->gcount();
+        if (readSize <= 0)
+            break;
+
+        stream.write(buffer.data(), readSize);
+    }
+
+    return !m_stream->bad() && stream.good();
+}
+
+bool SoundBank::ReadAt(const int64_t offset, void* data, const size_t size) const
+{
+    // Mapped sound banks are copied from the mapping directly instead of going through a stream
+    if (m_mapped_file.IsOpen())
+    {
+        if (offset < 0 || static_cast<size_t>(offset) > m_mapped_file.GetSize() || size > m_mapped_file.GetSize() - static_cast<size_t>(offset))
+            return false;
+
+        std::memcpy(data, m_mapped_file.GetData() + offset, size);
+        return true;
+    }
+
+    m_stream->seekg(offset);
+    m_stream->read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+    return m_stream->gcount() == static_cast<std::streamsize>(size);
+}
+
 bool SoundBank::ReadHeader()
 {
-    m_stream->read(reinterpret_cast<char*>(&m_header), sizeof(m_header));
-    if (m_stream->gcount() != sizeof(m_header))
+    if (!ReadAt(0, &m_header, sizeof(m_header)))
     {
         printf("Unexpected eof when trying to load sndbank header.\n");
         return false;
@@ -192,26 +305,23 @@ bool SoundBank::ReadHeader()
 
 bool SoundBank::ReadEntries()
 {
-    m_stream->seekg(m_header.entryOffset);
-
-    for (auto i = 0u; i < m_header.entryCount; i++)
+    m_entries.resize(m_header.entryCount);
+    if (!ReadAt(m_header.entryOffset, m_entries.data(), sizeof(SoundAssetBankEntry) * m_entries.size()))
     {
-        SoundAssetBankEntry entry{};
-        m_stream->read(reinterpret_cast<char*>(&entry), sizeof(entry));
-
-        if (m_stream->gcount() != sizeof(entry))
-        {
-            std::cout << "Failed to read sound bank entry at index " << i << "\n";
-            return false;
-        }
+        std::cout << "Failed to read sound bank entries\n";
+        return false;
+    }
 
+    m_entries_by_id.reserve(m_entries.size());
+    for (auto i = 0u; i < m_entries.size(); i++)
+    {
+        const auto& entry = m_entries[i];
         if (entry.offset == 0 || entry.offset + entry.size >= m_file_size)
         {
             std::cout << "Invalid sound bank entry data offset " << entry.offset << " (filesize is " << m_header.fileSize << ")\n";
             return false;
         }
 
-        m_entries.push_back(entry);
         m_entries_by_id.emplace(std::make_pair(entry.id, i));
     }
 
@@ -220,23 +330,60 @@ bool SoundBank::ReadEntries()
 
 bool SoundBank::ReadChecksums()
 {
-    m_stream->seekg(m_header.entryOffset);
+    m_checksums.resize(m_header.entryCount);
+    if (!ReadAt(m_header.checksumOffset, m_checksums.data(), sizeof(SoundAssetBankChecksum) * m_checksums.size()))
+    {
+        std::cout << "Failed to read sound bank checksums\n";
+        return false;
+    }
+
+    return true;
+}
+
+void SoundBank::AddToEntryIndex(SoundBank* soundBank)
+{
+    EntriesById.reserve(EntriesById.size() + soundBank->m_entries_by_id.size());
+    for (const auto& [id, entryIndex] : soundBank->m_entries_by_id)
+        EntriesById.emplace(id, IndexedEntry{soundBank, entryIndex});
+}
 
-    for (auto i = 0u; i < m_header.entryCount; i++)
+void SoundBank::RemoveFromEntryIndex(SoundBank* soundBank)
+{
+    for (const auto& [id, entryIndex] : soundBank->m_entries_by_id)
     {
-        SoundAssetBankChecksum checksum{};
-        m_stream->read(reinterpret_cast<char*>(&checksum), sizeof(checksum));
+        const auto indexedEntry = EntriesById.find(id);
+        if (indexedEntry == EntriesById.end() || indexedEntry->second.m_sound_bank != soundBank)
+            continue;
 
-        if (m_stream->gcount() != sizeof(checksum))
+        EntriesById.erase(indexedEntry);
+
+        // Ids are rarely part of multiple sound banks so the next sound bank containing it is only searched for when removing a sound bank
+        for (auto* otherSoundBank : Repository)
         {
-            std::cout << "Failed to read sound bank checksum at index " << i << "\n";
-            return false;
+            if (otherSoundBank == soundBank)
+                continue;
+
+            const auto otherEntry = otherSoundBank->m_entries_by_id.find(id);
+            if (otherEntry != otherSoundBank->m_entries_by_id.end())
+            {
+                EntriesById.emplace(id, IndexedEntry{otherSoundBank, otherEntry->second});
+                break;
+            }
         }
+    }
+}
 
-        m_checksums.push_back(checksum);
+SoundBankEntryInputStream SoundBank::FindEntryStream(const unsigned id, const SoundBank*& soundBank)
+{
+    const auto indexedEntry = EntriesById.find(id);
+    if (indexedEntry == EntriesById.end())
+    {
+        soundBank = nullptr;
+        return SoundBankEntryInputStream();
     }
 
-    return true;
+    soundBank = indexedEntry->second.m_sound_bank;
+    return soundBank->OpenEntryStream(soundBank->m_entries[indexedEntry->second.m_entry_index]);
 }
 
 std::string SoundBank::GetFileNameForDefinition(const bool streamed, const char* zone, const char* language)
@@ -268,6 +415,16 @@ SoundBank::SoundBank(std::string fileName, std::unique_ptr<std::istream> stream,
 {
 }
 
+SoundBank::SoundBank(std::string fileName, MemoryMappedFile mappedFile)
+    : m_file_name(std::move(fileName)),
+      m_mapped_file(std::move(mappedFile)),
+      m_stream(std::make_unique<iobjstream>(std::make_unique<SoundBankMemoryBuffer>(m_mapped_file.GetData(), m_mapped_file.GetSize()))),
+      m_file_size(static_cast<int64_t>(m_mapped_file.GetSize())),
+      m_initialized(false),
+      m_header{}
+{
+}
+
 std::string SoundBank::GetName()
 {
     return m_file_name;
@@ -295,18 +452,32 @@ bool SoundBank::VerifyChecksum(const SoundAssetBankChecksum& checksum) const
     return m_initialized && memcmp(checksum.checksumBytes, m_header.checksumChecksum.checksumBytes, sizeof(SoundAssetBankChecksum)) == 0;
 }
 
+SoundBankEntryInputStream SoundBank::OpenEntryStream(const SoundAssetBankEntry& entry) const
+{
+    if (m_mapped_file.IsOpen())
+    {
+        if (static_cast<size_t>(entry.offset) + entry.size > m_mapped_file.GetSize())
+            return SoundBankEntryInputStream();
+
+        return SoundBankEntryInputStream(m_mapped_file.GetData() + entry.offset, entry);
+    }
+
+    m_stream->seekg(entry.offset);
+
+    return SoundBankEntryInputStream(std::make_unique<iobjstream>(std::make_unique<SoundBankInputBuffer>(*m_stream, entry.offset, entry.size)), entry);
+}
+
 SoundBankEntryInputStream SoundBank::GetEntryStream(const unsigned id) const
 {
     const auto foundEntry = m_entries_by_id.find(id);
 
     if (foundEntry != m_entries_by_id.end())
-    {
-        const auto& entry = m_entries[foundEntry->second];
-
-        m_stream->seekg(entry.offset);
-
-        return SoundBankEntryInputStream(std::make_unique<iobjstream>(std::make_unique<SoundBankInputBuffer>(*m_stream, entry.offset, entry.size)), entry);
-    }
+        return OpenEntryStream(m_entries[foundEntry->second]);
 
     return SoundBankEntryInputStream();
 }
+
+bool SoundBank::CanReadEntriesConcurrently() const
+{
+    return m_mapped_file.IsOpen();
+}
@@ -6,10 +6,13 @@
 #include "SearchPath/ISearchPath.h"
 #include "Utils/ClassUtils.h"
 #include "Utils/FileUtils.h"
+#include "Utils/MemoryMappedFile.h"
 #include "Utils/ObjStream.h"
 #include "Zone/Zone.h"
 
 #include <istream>
+#include <ostream>
+#include <unordered_map>
 
 class SoundBankEntryInputStream
 {
@@ -17,10 +20,28 @@ public:
     std::unique_ptr<std::istream> m_stream;
     SoundAssetBankEntry m_entry;
 
+    // The data of the entry inside of the mapped sound bank file or nullptr if the sound bank is not mapped
+    const uint8_t* m_mapped_data;
+
     SoundBankEntryInputStream();
     SoundBankEntryInputStream(std::unique_ptr<std::istream> stream, SoundAssetBankEntry entry);
 
+    /**
+     * \brief Creates an entry stream that is a view of the entry data inside of a mapped sound bank file.
+     * \param mappedData The data of the entry inside of the mapping, which must stay mapped while the stream is used.
+     * \param entry The entry.
+     */
+    SoundBankEntryInputStream(const uint8_t* mappedData, SoundAssetBankEntry entry);
+
     _NODISCARD bool IsOpen() const;
+
+    /**
+     * \brief Copies the remaining data of the entry to the specified stream in large blocks.
+     * Entries of mapped sound banks are written directly from the mapping without copying them into a buffer first.
+     * \param stream The stream to write the entry data to.
+     * \return \c true if all data of the entry could be copied, \c false otherwise.
+     */
+    bool CopyTo(std::ostream& stream) const;
 };
 
 class SoundBank final : public ObjContainerReferenceable
@@ -29,6 +50,7 @@ class SoundBank final : public ObjContainerReferenceable
     static constexpr uint32_t VERSION = 14u;
 
     std::string m_file_name;
+    MemoryMappedFile m_mapped_file;
     std::unique_ptr<std::istream> m_stream;
     int64_t m_file_size;
 
@@ -39,16 +61,48 @@ class SoundBank final : public ObjContainerReferenceable
     std::vector<SoundAssetBankChecksum> m_checksums;
     std::unordered_map<unsigned int, size_t> m_entries_by_id;
 
+    struct IndexedEntry
+    {
+        SoundBank* m_sound_bank;
+        size_t m_entry_index;
+    };
+
+    // Entries of all sound banks of the repository by their id. Ids that are part of multiple sound banks refer to the first added sound bank.
+    static std::unordered_map<unsigned int, IndexedEntry> EntriesById;
+
+    static void AddToEntryIndex(SoundBank* soundBank);
+    static void RemoveFromEntryIndex(SoundBank* soundBank);
+
     bool ReadHeader();
     bool ReadEntries();
     bool ReadChecksums();
+    bool ReadAt(int64_t offset, void* data, size_t size) const;
+
+    _NODISCARD SoundBankEntryInputStream OpenEntryStream(const SoundAssetBankEntry& entry) const;
 
 public:
     static ObjContainerRepository<SoundBank, Zone> Repository;
 
     static std::string GetFileNameForDefinition(bool streamed, const char* zone, const char* language);
 
+    /**
+     * \brief Opens the entry with the specified id of the first added sound bank of the repository that contains it.
+     * The entry is looked up in an index over the entries of all sound banks of the repository. The repository lock must be held.
+     * \param id The id of the entry.
+     * \param soundBank Receives the sound bank that contains the entry or \c nullptr if no sound bank contains it.
+     * \return The entry stream, which is not open when no sound bank contains the entry.
+     */
+    static SoundBankEntryInputStream FindEntryStream(unsigned int id, const SoundBank*& soundBank);
+
     SoundBank(std::string fileName, std::unique_ptr<std::istream> stream, int64_t fileSize);
+
+    /**
+     * \brief Creates a sound bank that reads its data from a file that is mapped into memory.
+     * Entry streams of such a sound bank do not share any state and can be read from multiple threads at once.
+     * \param fileName The name of the sound bank file.
+     * \param mappedFile The mapped sound bank file.
+     */
+    SoundBank(std::string fileName, MemoryMappedFile mappedFile);
     ~SoundBank() override = default;
     SoundBank(const SoundBank& other) = delete;
     SoundBank(SoundBank&& other) noexcept = default;
@@ -62,4 +116,10 @@ public:
 
     _NODISCARD bool VerifyChecksum(const SoundAssetBankChecksum& checksum) const;
     _NODISCARD SoundBankEntryInputStream GetEntryStream(unsigned int id) const;
+
+    /**
+     * \brief Whether entry streams of this sound bank can be read while other entry streams of it are in use.
+     * Otherwise all entry streams read from the same underlying stream and must be used one at a time while holding the repository lock.
+     */
+    _NODISCARD bool CanReadEntriesConcurrently() const;
 };
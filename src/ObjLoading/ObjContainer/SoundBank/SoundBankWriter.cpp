@@ -2,16 +2,22 @@
 
 #include "Crypto.h"
 #include "ObjContainer/SoundBank/SoundBankTypes.h"
+#include "ObjLoading.h"
 #include "Sound/FlacDecoder.h"
 #include "Sound/WavTypes.h"
 #include "Utils/FileUtils.h"
+#include "Utils/ThreadPool.h"
 
+#include <algorithm>
 #include <cstring>
+#include <deque>
 #include <filesystem>
+#include <future>
 #include <iostream>
 #include <unordered_map>
+#include <vector>
 
-std::unordered_map<unsigned int, unsigned char> INDEX_FOR_FRAMERATE{
+const std::unordered_map<unsigned int, unsigned char> INDEX_FOR_FRAMERATE{
     {8000,   0},
     {12000,  1},
     {16000,  2},
@@ -23,6 +29,18 @@ std::unordered_map<unsigned int, unsigned char> INDEX_FOR_FRAMERATE{
     {192000, 8},
 };
 
+namespace
+{
+    unsigned char GetFrameRateIndex(const unsigned int frameRate)
+    {
+        const auto foundFrameRate = INDEX_FOR_FRAMERATE.find(frameRate);
+        if (foundFrameRate != INDEX_FOR_FRAMERATE.end())
+            return foundFrameRate->second;
+
+        return 0u;
+    }
+} // namespace
+
 class SoundBankWriterImpl : public SoundBankWriter
 {
     static constexpr char BRANDING[] = "Created with OAT - OpenAssetTools";
@@ -30,8 +48,54 @@ class SoundBankWriterImpl : public SoundBankWriter
     static constexpr uint32_t MAGIC = FileUtils::MakeMagic32('2', 'U', 'X', '#');
     static constexpr uint32_t VERSION = 14u;
 
+    // Limits how many sounds are kept in memory while waiting to be written
+    static constexpr size_t MAX_SOUNDS_AHEAD_PER_WORKER = 2u;
+
     inline static const std::string PAD_DATA = std::string(16, '\x00');
 
+    class SoundBankEntryInfo
+    {
+    public:
+        SoundBankEntryInfo()
+            : m_sound_id(0u),
+              m_looping(false),
+              m_streamed(false)
+        {
+        }
+
+        SoundBankEntryInfo(std::string filePath, const unsigned int soundId, const bool looping, const bool streamed)
+            : m_file_path(std::move(filePath)),
+              m_sound_id(soundId),
+              m_looping(looping),
+              m_streamed(streamed)
+        {
+        }
+
+        std::string m_file_path;
+        unsigned int m_sound_id;
+        bool m_looping;
+        bool m_streamed;
+    };
+
+    class LoadedSound
+    {
+    public:
+        LoadedSound()
+            : m_loaded(false),
+              m_entry{},
+              m_checksum{},
+              m_data_size(0u)
+        {
+        }
+
+        bool m_loaded;
+        std::string m_error;
+        SoundAssetBankEntry m_entry;
+        SoundAssetBankChecksum m_checksum;
+        std::unique_ptr<char[]> m_data;
+        size_t m_data_size;
+    };
+
 public:
     explicit SoundBankWriterImpl(std::string fileName, std::ostream& stream, ISearchPath* assetSearchPath)
         : m_file_name(std::move(fileName)),
@@ -118,104 +182,154 @@ public:
         Write(&header, sizeof(header));
     }
 
-    bool WriteEntries()
+    _NODISCARD LoadedSound LoadSound(const SoundBankEntryInfo& sound) const
     {
-        GoTo(DATA_OFFSET);
-
-        for (auto& sound : m_sounds)
-        {
-            const auto& soundFilePath = sound.m_file_path;
-            const auto soundId = sound.m_sound_id;
+        const auto& soundFilePath = sound.m_file_path;
+        const auto soundId = sound.m_sound_id;
 
-            size_t soundSize;
-            std::unique_ptr<char[]> soundData;
+        LoadedSound loadedSound;
 
-            // try to find a wav file for the sound path
-            const auto wavFile = m_asset_search_path->Open(soundFilePath + ".wav");
-            if (wavFile.IsOpen())
-            {
-                WavHeader header{};
-                wavFile.m_stream->read(reinterpret_cast<char*>(&header), sizeof(WavHeader));
-
-                soundSize = static_cast<size_t>(wavFile.m_length - sizeof(WavHeader));
-                const auto frameCount = soundSize / (header.formatChunk.nChannels * (header.formatChunk.wBitsPerSample / 8));
-                const auto frameRateIndex = INDEX_FOR_FRAMERATE[header.formatChunk.nSamplesPerSec];
-
-                SoundAssetBankEntry entry{
-                    soundId,
-                    soundSize,
-                    static_cast<size_t>(m_current_offset),
-                    frameCount,
-                    frameRateIndex,
-                    static_cast<unsigned char>(header.formatChunk.nChannels),
-                    sound.m_looping,
-                    0,
-                };
-
-                m_entries.push_back(entry);
-
-                soundData = std::make_unique<char[]>(soundSize);
-                wavFile.m_stream->read(soundData.get(), soundSize);
-            }
-            else
+        // try to find a wav file for the sound path
+        const auto wavFile = m_asset_search_path->Open(soundFilePath + ".wav");
+        if (wavFile.IsOpen())
+        {
+            WavHeader header{};
+            wavFile.m_stream->read(reinterpret_cast<char*>(&header), sizeof(WavHeader));
+
+            loadedSound.m_data_size = static_cast<size_t>(wavFile.m_length - sizeof(WavHeader));
+            const auto frameCount = loadedSound.m_data_size / (header.formatChunk.nChannels * (header.formatChunk.wBitsPerSample / 8));
+            const auto frameRateIndex = GetFrameRateIndex(header.formatChunk.nSamplesPerSec);
+
+            loadedSound.m_entry = SoundAssetBankEntry{
+                soundId,
+                loadedSound.m_data_size,
+                0,
+                frameCount,
+                frameRateIndex,
+                static_cast<unsigned char>(header.formatChunk.nChannels),
+                sound.m_looping,
+                0,
+            };
+
+            loadedSound.m_data = std::make_unique<char[]>(loadedSound.m_data_size);
+            wavFile.m_stream->read(loadedSound.m_data.get(), loadedSound.m_data_size);
+        }
+        else
+        {
+            // if there is no wav file, try flac file
+            const auto flacFile = m_asset_search_path->Open(soundFilePath + ".flac");
+            if (flacFile.IsOpen())
             {
-                // if there is no wav file, try flac file
-                const auto flacFile = m_asset_search_path->Open(soundFilePath + ".flac");
-                if (flacFile.IsOpen())
-                {
-                    soundSize = static_cast<size_t>(flacFile.m_length);
+                loadedSound.m_data_size = static_cast<size_t>(flacFile.m_length);
 
-                    soundData = std::make_unique<char[]>(soundSize);
-                    flacFile.m_stream->read(soundData.get(), soundSize);
+                loadedSound.m_data = std::make_unique<char[]>(loadedSound.m_data_size);
+                flacFile.m_stream->read(loadedSound.m_data.get(), loadedSound.m_data_size);
 
-                    flac::FlacMetaData metaData;
-                    if (flac::GetFlacMetaData(soundData.get(), soundSize, metaData))
-                    {
-                        const auto frameRateIndex = INDEX_FOR_FRAMERATE[metaData.m_sample_rate];
-                        SoundAssetBankEntry entry{
-                            soundId,
-                            soundSize,
-                            static_cast<size_t>(m_current_offset),
-                            static_cast<unsigned>(metaData.m_total_samples),
-                            frameRateIndex,
-                            metaData.m_number_of_channels,
-                            sound.m_looping,
-                            8,
-                        };
-
-                        m_entries.push_back(entry);
-                    }
-                    else
+                flac::FlacMetaData metaData;
+                if (flac::GetFlacMetaData(loadedSound.m_data.get(), loadedSound.m_data_size, metaData))
+                {
+                    // The total amount of samples in the stream info is optional, so it needs to be counted from the frames when it is missing
+                    std::vector<flac::FlacFrame> frames;
+                    if (metaData.m_total_samples == 0u && flac::GetFlacFrames(loadedSound.m_data.get(), loadedSound.m_data_size, metaData, frames))
                     {
-                        std::cerr << "Unable to decode .flac file for sound " << soundFilePath << "\n";
-                        return false;
+                        for (const auto& frame : frames)
+                            metaData.m_total_samples += frame.m_sample_count;
                     }
+
+                    const auto frameRateIndex = GetFrameRateIndex(metaData.m_sample_rate);
+                    loadedSound.m_entry = SoundAssetBankEntry{
+                        soundId,
+                        loadedSound.m_data_size,
+                        0,
+                        static_cast<unsigned>(metaData.m_total_samples),
+                        frameRateIndex,
+                        metaData.m_number_of_channels,
+                        sound.m_looping,
+                        8,
+                    };
                 }
                 else
                 {
-                    std::cerr << "Unable to find a compatible file for sound " << soundFilePath << "\n";
-                    return false;
+                    loadedSound.m_error = "Unable to decode .flac file for sound " + soundFilePath;
+                    return loadedSound;
                 }
             }
+            else
+            {
+                loadedSound.m_error = "Unable to find a compatible file for sound " + soundFilePath;
+                return loadedSound;
+            }
+        }
+
+        // calculate checksum
+        const auto md5Crypt = Crypto::CreateMD5();
+        md5Crypt->Process(loadedSound.m_data.get(), loadedSound.m_data_size);
+        md5Crypt->Finish(loadedSound.m_checksum.checksumBytes);
+
+        loadedSound.m_loaded = true;
+        return loadedSound;
+    }
+
+    bool WriteEntries()
+    {
+        GoTo(DATA_OFFSET);
 
-            const auto lastEntry = m_entries.rbegin();
-            if (!sound.m_streamed && lastEntry->frameRateIndex != 6)
+        // Sounds are read and hashed by the workers ahead of time while the data is written in order to produce the same file regardless of the worker count
+        const auto workerCount = static_cast<size_t>(ObjLoading::Configuration.SoundBankWorkerCount);
+        const auto maxSoundsAhead = workerCount * MAX_SOUNDS_AHEAD_PER_WORKER;
+        std::deque<std::future<LoadedSound>> loadingSounds;
+        std::unique_ptr<ThreadPool> workerPool;
+        if (workerCount > 0u && m_sounds.size() > 1u)
+            workerPool = std::make_unique<ThreadPool>(workerCount);
+
+        auto nextSoundToLoad = 0u;
+        for (auto soundIndex = 0u; soundIndex < m_sounds.size(); soundIndex++)
+        {
+            const auto& sound = m_sounds[soundIndex];
+
+            LoadedSound loadedSound;
+            if (workerPool)
             {
-                std::cout << "WARNING: Loaded sound \"" << soundFilePath
-                          << "\" should have a framerate of 48000 but doesn't. This sound may not work on all games!\n";
+                for (; nextSoundToLoad < m_sounds.size() && nextSoundToLoad < soundIndex + maxSoundsAhead; nextSoundToLoad++)
+                {
+                    auto task = std::make_shared<std::packaged_task<LoadedSound()>>(
+                        [this, &soundToLoad = m_sounds[nextSoundToLoad]]
+                        {
+                            return LoadSound(soundToLoad);
+                        });
+
+                    loadingSounds.emplace_back(task->get_future());
+                    workerPool->Enqueue(
+                        [task]
+                        {
+                            (*task)();
+                        });
+                }
+
+                loadedSound = loadingSounds.front().get();
+                loadingSounds.pop_front();
             }
+            else
+                loadedSound = LoadSound(sound);
 
-            // calculate checksum
-            SoundAssetBankChecksum checksum{};
+            if (!loadedSound.m_loaded)
+            {
+                std::cerr << loadedSound.m_error << "\n";
+                return false;
+            }
 
-            const auto md5Crypt = Crypto::CreateMD5();
-            md5Crypt->Process(soundData.get(), soundSize);
-            md5Crypt->Finish(checksum.checksumBytes);
+            loadedSound.m_entry.offset = static_cast<unsigned>(m_current_offset);
+            m_entries.push_back(loadedSound.m_entry);
+            m_checksums.push_back(loadedSound.m_checksum);
 
-            m_checksums.push_back(checksum);
+            if (!sound.m_streamed && loadedSound.m_entry.frameRateIndex != 6)
+            {
+                std::cout << "WARNING: Loaded sound \"" << sound.m_file_path
+                          << "\" should have a framerate of 48000 but doesn't. This sound may not work on all games!\n";
+            }
 
             // write data
-            Write(soundData.get(), soundSize);
+            Write(loadedSound.m_data.get(), loadedSound.m_data_size);
         }
 
         return true;
@@ -278,30 +392,6 @@ public:
     }
 
 private:
-    class SoundBankEntryInfo
-    {
-    public:
-        SoundBankEntryInfo()
-            : m_sound_id(0u),
-              m_looping(false),
-              m_streamed(false)
-        {
-        }
-
-        SoundBankEntryInfo(std::string filePath, const unsigned int soundId, const bool looping, const bool streamed)
-            : m_file_path(std::move(filePath)),
-              m_sound_id(soundId),
-              m_looping(looping),
-              m_streamed(streamed)
-        {
-        }
-
-        std::string m_file_path;
-        unsigned int m_sound_id;
-        bool m_looping;
-        bool m_streamed;
-    };
-
     std::string m_file_name;
     std::ostream& m_stream;
     ISearchPath* m_asset_search_path;
@@ -22,30 +22,40 @@ const IObjLoader* const OBJ_LOADERS[]{
     new T6::ObjLoader(),
 };
 
-void ObjLoading::LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone)
+void ObjLoading::LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad)
 {
     for (const auto* loader : OBJ_LOADERS)
     {
         if (loader->SupportsZone(zone))
         {
-            loader->LoadReferencedContainersForZone(searchPath, zone);
+            loader->LoadReferencedContainersForZone(searchPath, zone, assetTypesToLoad);
             return;
         }
     }
 }
 
-void ObjLoading::LoadObjDataForZone(ISearchPath* searchPath, Zone* zone)
+void ObjLoading::LoadObjDataForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad)
 {
     for (const auto* loader : OBJ_LOADERS)
     {
         if (loader->SupportsZone(zone))
         {
-            loader->LoadObjDataForZone(searchPath, zone);
+            loader->LoadObjDataForZone(searchPath, zone, assetTypesToLoad);
             return;
         }
     }
 }
 
+bool ObjLoading::ShouldLoadAssetType(const std::vector<bool>& assetTypesToLoad, const asset_type_t assetType)
+{
+    if (assetType < 0)
+        return false;
+    if (static_cast<size_t>(assetType) >= assetTypesToLoad.size())
+        return true;
+
+    return assetTypesToLoad[assetType];
+}
+
 void ObjLoading::UnloadContainersOfZone(Zone* zone)
 {
     for (const auto* loader : OBJ_LOADERS)
@@ -84,7 +94,7 @@ void ObjLoading::UnloadIWDsInSearchPath(ISearchPath* searchPath)
 
 SearchPaths ObjLoading::GetIWDSearchPaths()
 {
-    SearchPaths iwdPaths;
+    SearchPaths iwdPaths(true);
 
     for (auto* iwd : IWD::Repository)
     {
@@ -94,6 +104,18 @@ SearchPaths ObjLoading::GetIWDSearchPaths()
     return iwdPaths;
 }
 
+void ObjLoading::PrefetchAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets)
+{
+    for (const auto* loader : OBJ_LOADERS)
+    {
+        if (loader->SupportsZone(context->m_zone))
+        {
+            loader->PrefetchAssetsForZone(context, assets);
+            return;
+        }
+    }
+}
+
 bool ObjLoading::LoadAssetForZone(AssetLoadingContext* context, const asset_type_t assetType, const std::string& assetName)
 {
     for (const auto* loader : OBJ_LOADERS)
@@ -107,6 +129,19 @@ bool ObjLoading::LoadAssetForZone(AssetLoadingContext* context, const asset_type
     return false;
 }
 
+bool ObjLoading::LoadAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets)
+{
+    for (const auto* loader : OBJ_LOADERS)
+    {
+        if (loader->SupportsZone(context->m_zone))
+        {
+            return loader->LoadAssetsForZone(context, assets);
+        }
+    }
+
+    return false;
+}
+
 void ObjLoading::FinalizeAssetsForZone(AssetLoadingContext* context)
 {
     for (const auto* loader : OBJ_LOADERS)
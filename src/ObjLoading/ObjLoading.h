@@ -1,10 +1,15 @@
 #pragma once
 
 #include "AssetLoading/AssetLoadingContext.h"
+#include "AssetLoading/LoadedAssetCache.h"
 #include "SearchPath/ISearchPath.h"
 #include "SearchPath/SearchPaths.h"
 #include "Zone/Zone.h"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 class ObjLoading
 {
 public:
@@ -14,14 +19,48 @@ public:
         bool Verbose = false;
         bool MenuPermissiveParsing = false;
         bool MenuNoOptimization = false;
+
+        // The maximum amount of bytes of raw chunk data each ipak keeps in memory to avoid reading shared chunks multiple times
+        size_t IPakChunkCacheSize = 0x2000000;
+
+        // Whether IWDs are read from memory mapped files instead of through a buffered stream. Mapped IWDs take up address space, so only 64-bit builds map them.
+        bool MapIWDFiles = sizeof(void*) >= 8u;
+
+        // The amount of threads reading and decoding image files in parallel when loading the obj data of a zone. 0 loads all images one after another.
+        unsigned ImageLoadWorkerCount = 4u;
+
+        // Whether image data that is streamed from ipaks is only loaded when dumping the image instead of with the obj data of its zone
+        bool LoadImageDataOnDemand = true;
+
+        // The amount of threads reading raw asset files ahead of time when loading assets for a zone. 0 disables reading ahead of time.
+        unsigned RawPrefetchWorkerCount = 4u;
+
+        // The amount of threads loading raw assets that support it in parallel when loading assets for a zone. 0 loads all assets one after another.
+        unsigned RawParallelLoadWorkerCount = 4u;
+
+        // The cache to share raw assets that were loaded in parallel with other zones of the same session. nullptr loads them again for every zone.
+        LoadedAssetCache* LoadedAssets = nullptr;
+
+        // The amount of threads parsing the menu files of a menu list ahead of time. 0 parses all menu files one after another.
+        unsigned MenuParseWorkerCount = 4u;
+
+        // Whether the tris and vertices of model surfaces are reordered to make better use of the vertex cache and to reduce overdraw
+        bool OptimizeModelMeshes = false;
+
+        // Whether a bounding volume hierarchy over the tris of every rigid vert list of model surfaces is built for traces
+        bool BuildModelCollisionTrees = false;
+
+        // The amount of threads reading and hashing sound files ahead of them being written to a sound bank. 0 reads all sounds one after another.
+        unsigned SoundBankWorkerCount = 4u;
     } Configuration;
 
     /**
      * \brief Loads all containers that are being referenced by the specified zone.
      * \param searchPath The search path to use to find the referenced containers.
      * \param zone The zone to load all referenced containers of.
+     * \param assetTypesToLoad The asset types to load containers for. Asset types that are not covered are always loaded.
      */
-    static void LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone);
+    static void LoadReferencedContainersForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad);
 
     /**
      * \brief Unloads all containers that were referenced by a specified zone. If referenced by more than one zone a container will only be unloaded once all
@@ -51,9 +90,33 @@ public:
      * \brief Loads the obj data for all assets of a zone.
      * \param searchPath The search path to use to search for all obj data files.
      * \param zone The zone of the assets to load the obj data for.
+     * \param assetTypesToLoad The asset types to load obj data for. Asset types that are not covered are always loaded.
+     */
+    static void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone, const std::vector<bool>& assetTypesToLoad);
+
+    /**
+     * \brief Checks whether containers and obj data are loaded for an asset type.
+     * \param assetTypesToLoad The asset types to load. Asset types that are not covered are always loaded.
+     * \param assetType The asset type to check.
+     * \return \c true if containers and obj data of the asset type should be loaded.
+     */
+    static bool ShouldLoadAssetType(const std::vector<bool>& assetTypesToLoad, asset_type_t assetType);
+
+    /**
+     * \brief Starts reading the raw files of the specified assets in the background so loading them afterwards does not need to wait for them.
+     * \param context The context the assets are going to be loaded with.
+     * \param assets The types and names of the assets that are going to be loaded.
      */
-    static void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone);
+    static void PrefetchAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets);
 
     static bool LoadAssetForZone(AssetLoadingContext* context, asset_type_t assetType, const std::string& assetName);
+
+    /**
+     * \brief Loads all specified assets for a zone. Raw assets that support it are loaded in parallel but are added to the zone in the specified order.
+     * \param context The context to load the assets with.
+     * \param assets The types and names of the assets to load.
+     * \return \c true if all assets could be loaded, otherwise \c false.
+     */
+    static bool LoadAssetsForZone(AssetLoadingContext* context, const std::vector<std::pair<asset_type_t, std::string>>& assets);
     static void FinalizeAssetsForZone(AssetLoadingContext* context);
 };
@@ -52,35 +52,36 @@ const std::map<std::string, size_t>& MenuExpressionMatchers::GetBaseFunctionMapF
 {
     if (featureLevel == FeatureLevel::IW4)
     {
-        static std::map<std::string, size_t> iw4FunctionMap;
-        static bool iw4FunctionMapInitialized = false;
-
-        if (!iw4FunctionMapInitialized)
+        // Function local statics are initialized once even when parsing on multiple threads
+        static const auto iw4FunctionMap = []
         {
+            std::map<std::string, size_t> functionMap;
             for (size_t i = IW4::expressionFunction_e::EXP_FUNC_DYN_START; i < std::extent_v<decltype(IW4::g_expFunctionNames)>; i++)
             {
                 std::string functionName(IW4::g_expFunctionNames[i]);
                 utils::MakeStringLowerCase(functionName);
-                iw4FunctionMap.emplace(std::make_pair(functionName, i));
+                functionMap.emplace(std::make_pair(std::move(functionName), i));
             }
-        }
+
+            return functionMap;
+        }();
 
         return iw4FunctionMap;
     }
     if (featureLevel == FeatureLevel::IW5)
     {
-        static std::map<std::string, size_t> iw5FunctionMap;
-        static bool iw5FunctionMapInitialized = false;
-
-        if (!iw5FunctionMapInitialized)
+        static const auto iw5FunctionMap = []
         {
+            std::map<std::string, size_t> functionMap;
             for (size_t i = IW5::expressionFunction_e::EXP_FUNC_DYN_START; i < std::extent_v<decltype(IW5::g_expFunctionNames)>; i++)
             {
                 std::string functionName(IW5::g_expFunctionNames[i]);
                 utils::MakeStringLowerCase(functionName);
-                iw5FunctionMap.emplace(std::make_pair(std::move(functionName), i));
+                functionMap.emplace(std::make_pair(std::move(functionName), i));
             }
-        }
+
+            return functionMap;
+        }();
 
         return iw5FunctionMap;
     }
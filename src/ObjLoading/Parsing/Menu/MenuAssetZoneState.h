@@ -3,6 +3,7 @@
 #include "AssetLoading/IZoneAssetLoaderState.h"
 #include "Domain/CommonFunctionDef.h"
 #include "Domain/CommonMenuDef.h"
+#include "Parsing/Impl/ParserLineCache.h"
 
 #include <string>
 
@@ -18,6 +19,9 @@ namespace menu
 
         std::map<std::string, std::vector<std::string>> m_menus_to_load_by_menu;
 
+        // Files like ui/menudefinition.h are included by most menu files of a zone and only need to be read once
+        ParserLineCache m_include_cache;
+
         MenuAssetZoneState() = default;
 
         void AddFunction(std::unique_ptr<CommonFunctionDef> function);
@@ -0,0 +1,126 @@
+#include "MenuFileParallelReader.h"
+
+#include "Utils/StringUtils.h"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+using namespace menu;
+
+MenuFileParallelReader::MenuFileParallelReader(const MenuAssetZoneState* zoneState, parse_callback_t parseCallback, const size_t workerCount)
+    : m_zone_state(zoneState),
+      m_parse_callback(std::move(parseCallback)),
+      m_worker_count(workerCount),
+      m_start_function_count(0u),
+      m_checked_menu_count(0u)
+{
+}
+
+MenuFileParallelReader::~MenuFileParallelReader()
+{
+    // Jobs reference the zone state and the parse callback
+    if (m_worker_pool)
+        m_worker_pool->WaitForIdle();
+}
+
+MenuFileParallelReader::ParsedFile MenuFileParallelReader::ParseMenuFile(const std::string& fileName) const
+{
+    // The result may not be used in the end, so errors are only reported when it is
+    std::ostringstream errorStream;
+
+    try
+    {
+        auto result = m_parse_callback(fileName, errorStream);
+        return ParsedFile{std::move(result), std::move(errorStream).str(), true};
+    }
+    catch (...)
+    {
+        // The file is parsed again when reading it which reports the error to the caller
+        return ParsedFile{nullptr, std::string(), false};
+    }
+}
+
+void MenuFileParallelReader::Start(const std::vector<std::string>& fileNames)
+{
+    if (m_worker_count == 0u || fileNames.empty())
+        return;
+
+    if (!m_worker_pool)
+        m_worker_pool = std::make_unique<ThreadPool>(m_worker_count);
+
+    m_start_function_count = m_zone_state->m_functions.size();
+
+    for (const auto& fileName : fileNames)
+    {
+        if (m_parsed_files.contains(fileName))
+            continue;
+
+        auto task = std::make_shared<std::packaged_task<ParsedFile()>>(
+            [this, fileName]
+            {
+                return ParseMenuFile(fileName);
+            });
+
+        m_parsed_files.emplace(fileName, task->get_future());
+        m_worker_pool->Enqueue(
+            [task]
+            {
+                (*task)();
+            });
+    }
+}
+
+bool MenuFileParallelReader::CanUseParsedFile(const ParsedFile& parsedFile)
+{
+    if (!parsedFile.m_parsed)
+        return false;
+
+    // Files only fail to parse with more functions when they call functions that were unknown before
+    if (!parsedFile.m_result)
+        return m_zone_state->m_functions.size() == m_start_function_count;
+
+    // Functions and menus that were added since starting were unknown while parsing.
+    // Parsing normally would have either merged a definition with the same name or rejected it.
+    for (const auto& function : parsedFile.m_result->m_functions)
+    {
+        std::string lowerCaseFunctionName(function->m_name);
+        utils::MakeStringLowerCase(lowerCaseFunctionName);
+        if (m_zone_state->m_functions_by_name.contains(lowerCaseFunctionName))
+            return false;
+    }
+
+    for (; m_checked_menu_count < m_zone_state->m_menus.size(); m_checked_menu_count++)
+        m_loaded_menu_names.emplace(m_zone_state->m_menus[m_checked_menu_count]->m_name);
+
+    return std::ranges::none_of(parsedFile.m_result->m_menus,
+                                [this](const std::unique_ptr<CommonMenuDef>& menu)
+                                {
+                                    return m_loaded_menu_names.contains(menu->m_name);
+                                });
+}
+
+std::unique_ptr<ParsingResult> MenuFileParallelReader::ReadMenuFile(const std::string& fileName)
+{
+    // The zone state changes with the results that are being loaded, so no file can still be parsing at this point
+    if (m_worker_pool)
+    {
+        m_worker_pool->WaitForIdle();
+        m_worker_pool.reset();
+    }
+
+    const auto foundFile = m_parsed_files.find(fileName);
+    if (foundFile != m_parsed_files.end())
+    {
+        auto parsedFile = foundFile->second.get();
+        m_parsed_files.erase(foundFile);
+
+        if (CanUseParsedFile(parsedFile))
+        {
+            std::cerr << parsedFile.m_errors;
+            return std::move(parsedFile.m_result);
+        }
+    }
+
+    return m_parse_callback(fileName, std::cerr);
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Domain/MenuParsingResult.h"
+#include "MenuAssetZoneState.h"
+#include "Utils/ClassUtils.h"
+#include "Utils/ThreadPool.h"
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <ostream>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace menu
+{
+    /**
+     * \brief Parses the menu files of a menu list on worker threads ahead of them being loaded one after another.
+     * Files are parsed with the zone state at the time of starting, so a result is only handed out when parsing the file at the time of loading it would
+     * have produced the same result. Otherwise the file is parsed again.
+     * Errors of parsing ahead of time are only reported when its result is handed out.
+     */
+    class MenuFileParallelReader
+    {
+    public:
+        using parse_callback_t = std::function<std::unique_ptr<ParsingResult>(const std::string& fileName, std::ostream& errorStream)>;
+
+        /**
+         * \brief Creates a reader for the menu files of a menu list.
+         * \param zoneState The zone state the files are parsed with.
+         * \param parseCallback The callback that parses a single menu file with the zone state and reports errors to the specified stream.
+         * \param workerCount The amount of threads that parse files ahead of time. A value of \c 0 parses all files when reading them.
+         */
+        MenuFileParallelReader(const MenuAssetZoneState* zoneState, parse_callback_t parseCallback, size_t workerCount);
+        ~MenuFileParallelReader();
+
+        MenuFileParallelReader(const MenuFileParallelReader& other) = delete;
+        MenuFileParallelReader(MenuFileParallelReader&& other) noexcept = delete;
+        MenuFileParallelReader& operator=(const MenuFileParallelReader& other) = delete;
+        MenuFileParallelReader& operator=(MenuFileParallelReader&& other) noexcept = delete;
+
+        /**
+         * \brief Starts parsing the specified files on the worker threads.
+         * The zone state must not change until the first file is read.
+         * \param fileNames The names of the menu files to parse.
+         */
+        void Start(const std::vector<std::string>& fileNames);
+
+        /**
+         * \brief Returns the result of parsing a menu file with the current zone state.
+         * \param fileName The name of the menu file.
+         * \return The parsing result or \c nullptr if the file could not be parsed.
+         */
+        std::unique_ptr<ParsingResult> ReadMenuFile(const std::string& fileName);
+
+    private:
+        class ParsedFile
+        {
+        public:
+            std::unique_ptr<ParsingResult> m_result;
+            std::string m_errors;
+            bool m_parsed;
+        };
+
+        _NODISCARD ParsedFile ParseMenuFile(const std::string& fileName) const;
+        bool CanUseParsedFile(const ParsedFile& parsedFile);
+
+        const MenuAssetZoneState* m_zone_state;
+        parse_callback_t m_parse_callback;
+        size_t m_worker_count;
+        std::unique_ptr<ThreadPool> m_worker_pool;
+        std::unordered_map<std::string, std::future<ParsedFile>> m_parsed_files;
+
+        size_t m_start_function_count;
+        size_t m_checked_menu_count;
+        std::set<std::string> m_loaded_menu_names;
+    };
+} // namespace menu
@@ -9,16 +9,25 @@
 #include "Parsing/Impl/ParserSingleInputStream.h"
 #include "Parsing/Simple/SimpleLexer.h"
 
+#include <iostream>
+
 using namespace menu;
 
 MenuFileReader::MenuFileReader(std::istream& stream, std::string fileName, const FeatureLevel featureLevel, include_callback_t includeCallback)
+    : MenuFileReader(stream, std::move(fileName), featureLevel, std::move(includeCallback), nullptr)
+{
+}
+
+MenuFileReader::MenuFileReader(
+    std::istream& stream, std::string fileName, const FeatureLevel featureLevel, include_callback_t includeCallback, ParserLineCache* includeCache)
     : m_feature_level(featureLevel),
       m_file_name(std::move(fileName)),
       m_stream(nullptr),
       m_zone_state(nullptr),
-      m_permissive_mode(false)
+      m_permissive_mode(false),
+      m_error_stream(&std::cerr)
 {
-    OpenBaseStream(stream, std::move(includeCallback));
+    OpenBaseStream(stream, std::move(includeCallback), includeCache);
     SetupStreamProxies();
     m_stream = m_open_streams.back().get();
 }
@@ -28,17 +37,18 @@ MenuFileReader::MenuFileReader(std::istream& stream, std::string fileName, const
       m_file_name(std::move(fileName)),
       m_stream(nullptr),
       m_zone_state(nullptr),
-      m_permissive_mode(false)
+      m_permissive_mode(false),
+      m_error_stream(&std::cerr)
 {
-    OpenBaseStream(stream, nullptr);
+    OpenBaseStream(stream, nullptr, nullptr);
     SetupStreamProxies();
     m_stream = m_open_streams.back().get();
 }
 
-bool MenuFileReader::OpenBaseStream(std::istream& stream, include_callback_t includeCallback)
+bool MenuFileReader::OpenBaseStream(std::istream& stream, include_callback_t includeCallback, ParserLineCache* includeCache)
 {
     if (includeCallback)
-        m_open_streams.emplace_back(std::make_unique<ParserMultiInputStream>(stream, m_file_name, std::move(includeCallback)));
+        m_open_streams.emplace_back(std::make_unique<ParserMultiInputStream>(stream, m_file_name, std::move(includeCallback), includeCache));
     else
         m_open_streams.emplace_back(std::make_unique<ParserSingleInputStream>(stream, m_file_name));
 
@@ -79,25 +89,25 @@ bool MenuFileReader::IsValidEndState(const MenuFileParserState* state) const
 {
     if (state->m_current_item)
     {
-        std::cerr << "In \"" << m_file_name << "\": Unclosed item at end of file!\n";
+        *m_error_stream << "In \"" << m_file_name << "\": Unclosed item at end of file!\n";
         return false;
     }
 
     if (state->m_current_menu)
     {
-        std::cerr << "In \"" << m_file_name << "\": Unclosed menu at end of file!\n";
+        *m_error_stream << "In \"" << m_file_name << "\": Unclosed menu at end of file!\n";
         return false;
     }
 
     if (state->m_current_function)
     {
-        std::cerr << "In \"" << m_file_name << "\": Unclosed function at end of file!\n";
+        *m_error_stream << "In \"" << m_file_name << "\": Unclosed function at end of file!\n";
         return false;
     }
 
     if (state->m_in_global_scope)
     {
-        std::cerr << "In \"" << m_file_name << "\": Did not close global scope!\n";
+        *m_error_stream << "In \"" << m_file_name << "\": Did not close global scope!\n";
         return false;
     }
 
@@ -124,6 +134,11 @@ void MenuFileReader::SetPermissiveMode(const bool usePermissiveMode)
     m_permissive_mode = usePermissiveMode;
 }
 
+void MenuFileReader::SetErrorStream(std::ostream& errorStream)
+{
+    m_error_stream = &errorStream;
+}
+
 std::unique_ptr<ParsingResult> MenuFileReader::ReadMenuFile()
 {
     SimpleLexer::Config lexerConfig;
@@ -136,14 +151,15 @@ std::unique_ptr<ParsingResult> MenuFileReader::ReadMenuFile()
 
     const auto lexer = std::make_unique<SimpleLexer>(m_stream, std::move(lexerConfig));
     const auto parser = std::make_unique<MenuFileParser>(lexer.get(), m_feature_level, m_permissive_mode, m_zone_state);
+    parser->SetErrorStream(*m_error_stream);
 
     if (!parser->Parse())
     {
-        std::cerr << "Parsing menu file failed!\n";
+        *m_error_stream << "Parsing menu file failed!\n";
 
         const auto* parserEndState = parser->GetState();
         if (parserEndState->m_current_event_handler_set && !parserEndState->m_permissive_mode)
-            std::cerr << "You can use the --menu-permissive option to try to compile the event handler script anyway.\n";
+            *m_error_stream << "You can use the --menu-permissive option to try to compile the event handler script anyway.\n";
         return nullptr;
     }
 
@@ -5,8 +5,10 @@
 #include "MenuAssetZoneState.h"
 #include "MenuFileParserState.h"
 #include "Parsing/IParserLineStream.h"
+#include "Parsing/Impl/ParserLineCache.h"
 
 #include <memory>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -26,8 +28,9 @@ namespace menu
 
         const MenuAssetZoneState* m_zone_state;
         bool m_permissive_mode;
+        std::ostream* m_error_stream;
 
-        bool OpenBaseStream(std::istream& stream, include_callback_t includeCallback);
+        bool OpenBaseStream(std::istream& stream, include_callback_t includeCallback, ParserLineCache* includeCache);
         void SetupDefinesProxy();
         void SetupStreamProxies();
 
@@ -37,10 +40,18 @@ namespace menu
     public:
         MenuFileReader(std::istream& stream, std::string fileName, FeatureLevel featureLevel);
         MenuFileReader(std::istream& stream, std::string fileName, FeatureLevel featureLevel, include_callback_t includeCallback);
+        MenuFileReader(
+            std::istream& stream, std::string fileName, FeatureLevel featureLevel, include_callback_t includeCallback, ParserLineCache* includeCache);
 
         void IncludeZoneState(const MenuAssetZoneState* zoneState);
         void SetPermissiveMode(bool usePermissiveMode);
 
+        /**
+         * \brief Sets the stream that errors of parsing the menu file are reported to instead of stderr.
+         * \param errorStream The stream to report errors to. Must outlive the reader.
+         */
+        void SetErrorStream(std::ostream& errorStream);
+
         std::unique_ptr<ParsingResult> ReadMenuFile();
     };
 } // namespace menu
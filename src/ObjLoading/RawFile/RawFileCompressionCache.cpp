@@ -0,0 +1,228 @@
+#include "RawFileCompressionCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <zlib.h>
+
+namespace fs = std::filesystem;
+
+RawFileCompressionCache RawFileCompressionCache::Instance;
+
+namespace
+{
+    constexpr char CACHE_FILE_MAGIC[]{'O', 'A', 'T', 'R', 'A', 'W', 'C', 'A'};
+    constexpr uint32_t CACHE_FILE_VERSION = 1u;
+
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325u;
+    constexpr uint64_t FNV_PRIME = 0x100000001B3u;
+
+    uint64_t HashData(const char* data, const size_t dataSize)
+    {
+        auto hash = FNV_OFFSET_BASIS;
+        for (auto i = 0u; i < dataSize; i++)
+        {
+            hash ^= static_cast<uint8_t>(data[i]);
+            hash *= FNV_PRIME;
+        }
+
+        return hash;
+    }
+
+    bool Deflate(const char* data, const size_t dataSize, std::string& compressedData)
+    {
+        z_stream_s zs{};
+        if (deflateInit(&zs, Z_DEFAULT_COMPRESSION) != Z_OK)
+            return false;
+
+        compressedData.resize(deflateBound(&zs, static_cast<uLong>(dataSize)));
+        zs.avail_in = static_cast<uInt>(dataSize);
+        zs.next_in = reinterpret_cast<const Bytef*>(data);
+        zs.avail_out = static_cast<uInt>(compressedData.size());
+        zs.next_out = reinterpret_cast<Bytef*>(compressedData.data());
+
+        const auto ret = deflate(&zs, Z_FINISH);
+        compressedData.resize(compressedData.size() - zs.avail_out);
+        deflateEnd(&zs);
+
+        return ret == Z_STREAM_END;
+    }
+
+    const char* CopyCompressedData(const std::string& compressedData, MemoryManager& memory, size_t& compressedSize)
+    {
+        auto* result = memory.Alloc<char>(std::max<size_t>(compressedData.size(), 1u));
+        std::memcpy(result, compressedData.data(), compressedData.size());
+        compressedSize = compressedData.size();
+
+        return result;
+    }
+
+    template<typename T> void Write(std::ostream& stream, const T value)
+    {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void Write(std::ostream& stream, const std::string& value)
+    {
+        Write(stream, static_cast<uint32_t>(value.size()));
+        stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+
+    template<typename T> void Read(std::istream& stream, T& value)
+    {
+        stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    }
+
+    void Read(std::istream& stream, std::string& value)
+    {
+        uint32_t size = 0;
+        Read(stream, size);
+
+        // Sizes of corrupted files must not cause huge allocations
+        value.clear();
+        while (!stream.fail() && value.size() < size)
+        {
+            char buffer[4096];
+            const auto readSize = std::min<size_t>(size - value.size(), sizeof(buffer));
+            stream.read(buffer, static_cast<std::streamsize>(readSize));
+            value.append(buffer, static_cast<size_t>(stream.gcount()));
+        }
+    }
+} // namespace
+
+RawFileCompressionCache::RawFileCompressionCache()
+    : m_enabled(false),
+      m_max_compressed_data_size(0u),
+      m_compressed_data_size(0u),
+      m_modified(false)
+{
+}
+
+void RawFileCompressionCache::Enable(const size_t maxCompressedDataSize)
+{
+    std::lock_guard lock(m_mutex);
+    m_enabled = true;
+    m_max_compressed_data_size = maxCompressedDataSize;
+}
+
+size_t RawFileCompressionCache::GetCompressedDataSize()
+{
+    std::lock_guard lock(m_mutex);
+    return m_compressed_data_size;
+}
+
+void RawFileCompressionCache::KeepCompressedRawFile(const std::string& rawFileName, CompressedRawFile compressedRawFile)
+{
+    // An outdated version of the raw file is dropped even if the new one does not fit
+    const auto existingRawFile = m_compressed_raw_files.find(rawFileName);
+    if (existingRawFile != m_compressed_raw_files.end())
+    {
+        m_compressed_data_size -= existingRawFile->second.m_compressed_data.size();
+        m_compressed_raw_files.erase(existingRawFile);
+    }
+
+    if (compressedRawFile.m_compressed_data.size() > m_max_compressed_data_size - m_compressed_data_size)
+        return;
+
+    m_compressed_data_size += compressedRawFile.m_compressed_data.size();
+    m_compressed_raw_files.emplace(rawFileName, std::move(compressedRawFile));
+}
+
+const char* RawFileCompressionCache::Compress(
+    const std::string& rawFileName, const char* data, const size_t dataSize, MemoryManager& memory, size_t& compressedSize)
+{
+    const auto hash = HashData(data, dataSize);
+
+    if (m_enabled)
+    {
+        std::lock_guard lock(m_mutex);
+        const auto compressedRawFile = m_compressed_raw_files.find(rawFileName);
+        if (compressedRawFile != m_compressed_raw_files.end() && compressedRawFile->second.m_hash == hash && compressedRawFile->second.m_size == dataSize)
+            return CopyCompressedData(compressedRawFile->second.m_compressed_data, memory, compressedSize);
+    }
+
+    // Compressing happens outside the lock so multiple raw files can be compressed at once
+    std::string compressedData;
+    if (!Deflate(data, dataSize, compressedData))
+        return nullptr;
+
+    const auto* result = CopyCompressedData(compressedData, memory, compressedSize);
+    if (!m_enabled)
+        return result;
+
+    std::lock_guard lock(m_mutex);
+    KeepCompressedRawFile(rawFileName, CompressedRawFile{hash, dataSize, std::move(compressedData)});
+    m_modified = true;
+
+    return result;
+}
+
+bool RawFileCompressionCache::Load(const std::string& path)
+{
+    std::ifstream stream(path, std::fstream::in | std::fstream::binary);
+    if (!stream.is_open())
+        return false;
+
+    char magic[sizeof(CACHE_FILE_MAGIC)];
+    uint32_t version = 0;
+    stream.read(magic, sizeof(magic));
+    Read(stream, version);
+    if (stream.fail() || !std::equal(std::begin(magic), std::end(magic), std::begin(CACHE_FILE_MAGIC)) || version != CACHE_FILE_VERSION)
+        return false;
+
+    std::lock_guard lock(m_mutex);
+
+    uint32_t count = 0;
+    Read(stream, count);
+    for (auto i = 0u; i < count && !stream.fail(); i++)
+    {
+        std::string rawFileName;
+        uint64_t hash = 0;
+        uint64_t size = 0;
+        std::string compressedData;
+        Read(stream, rawFileName);
+        Read(stream, hash);
+        Read(stream, size);
+        Read(stream, compressedData);
+
+        if (!stream.fail() && !m_compressed_raw_files.contains(rawFileName))
+            KeepCompressedRawFile(rawFileName, CompressedRawFile{hash, static_cast<size_t>(size), std::move(compressedData)});
+    }
+
+    return !stream.fail();
+}
+
+bool RawFileCompressionCache::Save(const std::string& path)
+{
+    std::lock_guard lock(m_mutex);
+    if (!m_modified)
+        return true;
+
+    std::error_code ec;
+    const auto parentPath = fs::path(path).parent_path();
+    if (!parentPath.empty())
+        fs::create_directories(parentPath, ec);
+
+    std::ofstream stream(path, std::fstream::out | std::fstream::binary | std::fstream::trunc);
+    if (!stream.is_open())
+        return false;
+
+    stream.write(CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC));
+    Write(stream, CACHE_FILE_VERSION);
+
+    Write(stream, static_cast<uint32_t>(m_compressed_raw_files.size()));
+    for (const auto& [rawFileName, compressedRawFile] : m_compressed_raw_files)
+    {
+        Write(stream, rawFileName);
+        Write(stream, compressedRawFile.m_hash);
+        Write(stream, static_cast<uint64_t>(compressedRawFile.m_size));
+        Write(stream, compressedRawFile.m_compressed_data);
+    }
+
+    if (!stream.good())
+        return false;
+
+    m_modified = false;
+    return true;
+}
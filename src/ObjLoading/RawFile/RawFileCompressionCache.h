@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Utils/ClassUtils.h"
+#include "Utils/MemoryManager.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * \brief Compresses the data of raw files with deflate and keeps the compressed data to not compress unchanged raw files again.
+ * Raw files are identified by their name and a hash of their content so changed files are compressed again.
+ * Can be used from multiple threads at once and can be saved to disk to skip compressing the same raw files in later runs.
+ * Raw files are only kept once the cache is enabled and only as long as the compressed data of all kept raw files stays within a limit.
+ */
+class RawFileCompressionCache
+{
+    class CompressedRawFile
+    {
+    public:
+        uint64_t m_hash;
+        size_t m_size;
+        std::string m_compressed_data;
+    };
+
+    // Only the latest version of each raw file is kept to not grow the cache with every change to a raw file
+    std::unordered_map<std::string, CompressedRawFile> m_compressed_raw_files;
+    bool m_enabled;
+    size_t m_max_compressed_data_size;
+    size_t m_compressed_data_size;
+    bool m_modified;
+    std::mutex m_mutex;
+
+    void KeepCompressedRawFile(const std::string& rawFileName, CompressedRawFile compressedRawFile);
+
+public:
+    static constexpr size_t DEFAULT_MAX_COMPRESSED_DATA_SIZE = 256u * 1024u * 1024u;
+
+    static RawFileCompressionCache Instance;
+
+    RawFileCompressionCache();
+    ~RawFileCompressionCache() = default;
+    RawFileCompressionCache(const RawFileCompressionCache& other) = delete;
+    RawFileCompressionCache(RawFileCompressionCache&& other) noexcept = delete;
+    RawFileCompressionCache& operator=(const RawFileCompressionCache& other) = delete;
+    RawFileCompressionCache& operator=(RawFileCompressionCache&& other) noexcept = delete;
+
+    /**
+     * \brief Starts keeping compressed raw files. Until then raw files are compressed every time. Must be called before the cache is used.
+     * \param maxCompressedDataSize The maximum size of the compressed data of all kept raw files. Raw files that do not fit anymore are not kept.
+     */
+    void Enable(size_t maxCompressedDataSize = DEFAULT_MAX_COMPRESSED_DATA_SIZE);
+
+    /**
+     * \return The size of the compressed data of all kept raw files.
+     */
+    _NODISCARD size_t GetCompressedDataSize();
+
+    /**
+     * \brief Compresses the data of a raw file, only running deflate if a raw file with the same name and content was not compressed before.
+     * \param rawFileName The name of the raw file.
+     * \param data The uncompressed data of the raw file.
+     * \param dataSize The size of the uncompressed data.
+     * \param memory The memory to allocate the compressed data with.
+     * \param compressedSize The size of the compressed data.
+     * \return The compressed data or \c nullptr if compressing failed.
+     */
+    _NODISCARD const char* Compress(const std::string& rawFileName, const char* data, size_t dataSize, MemoryManager& memory, size_t& compressedSize);
+
+    /**
+     * \brief Adds the compressed raw files of a cache file that was saved by a previous run.
+     * \param path The path of the cache file.
+     * \return \c true if the file exists and could be read completely, \c false otherwise. Raw files before a read error are kept.
+     */
+    bool Load(const std::string& path);
+
+    /**
+     * \brief Saves all compressed raw files to a file if any raw file was compressed since creating or loading the cache.
+     * \param path The path of the cache file.
+     * \return \c true if the file is up to date, \c false if it could not be written.
+     */
+    bool Save(const std::string& path);
+};
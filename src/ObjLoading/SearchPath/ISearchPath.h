@@ -8,6 +8,8 @@
 #include <istream>
 #include <memory>
 
+class MemoryMappedFile;
+
 class SearchPathOpenFile
 {
 public:
@@ -38,6 +40,18 @@ public:
      */
     virtual SearchPathOpenFile Open(const std::string& fileName) = 0;
 
+    /**
+     * \brief Maps a file relative to the search path into memory to be able to read it without copying.
+     * \param fileName The relative path to the file to map.
+     * \param mappedFile The mapped file to open.
+     * \return \c true if the file could be mapped, \c false if it could not be found or the search path is not able to map it.
+     * Files that cannot be mapped may still be opened with \c Open.
+     */
+    virtual bool OpenMapped(const std::string& fileName, MemoryMappedFile& mappedFile)
+    {
+        return false;
+    }
+
     /**
      * \brief Returns the path to the search path.
      * \return The path to the search path.
@@ -51,6 +65,17 @@ public:
      */
     virtual void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) = 0;
 
+    /**
+     * \brief Lists all files that can be opened from the search path to be able to index them.
+     * \param callback The callback to call for each file with the name it can be opened with.
+     * \return \c true if the listed files are all files that can be opened, \c false if the search path cannot list its files.
+     * When returning \c false the callback is not called.
+     */
+    virtual bool ListFiles(const std::function<void(const std::string&)>& callback)
+    {
+        return false;
+    }
+
     /**
      * \brief Iterates through all files of the search path.
      * \param callback The callback to call for each found file with it's path relative to the search path.
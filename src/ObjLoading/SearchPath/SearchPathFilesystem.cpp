@@ -1,15 +1,93 @@
 #include "SearchPathFilesystem.h"
 
+#include "Pool/XAssetInfo.h"
+#include "Utils/MemoryMappedFile.h"
 #include "Utils/ObjFileStream.h"
 
 #include <filesystem>
 #include <fstream>
+#include <iostream>
+#include <ranges>
 
 namespace fs = std::filesystem;
 
 SearchPathFilesystem::SearchPathFilesystem(std::string path)
+    : SearchPathFilesystem(std::move(path), false)
 {
-    m_path = std::move(path);
+}
+
+SearchPathFilesystem::SearchPathFilesystem(std::string path, const bool useDirectoryIndex)
+    : m_path(std::move(path)),
+      m_use_directory_index(useDirectoryIndex),
+      m_directory_index_built(false),
+      m_directory_index_complete(false)
+{
+}
+
+void SearchPathFilesystem::BuildDirectoryIndex()
+{
+    m_directory_index.clear();
+    m_directory_index_built = true;
+    m_directory_index_complete = false;
+
+    try
+    {
+        const fs::path rootPath(m_path);
+        fs::recursive_directory_iterator iterator(rootPath, fs::directory_options::follow_directory_symlink | fs::directory_options::skip_permission_denied);
+        for (const auto& entry : iterator)
+        {
+            std::error_code ec;
+            if (!entry.is_regular_file(ec))
+                continue;
+
+            auto relativePath = entry.path().lexically_relative(rootPath).generic_string();
+            auto normalizedPath = XAssetInfoGeneric::NormalizeAssetName(relativePath);
+
+            // Keep the result independent of the iteration order when multiple files only differ in casing
+            const auto existingEntry = m_directory_index.find(normalizedPath);
+            if (existingEntry == m_directory_index.end())
+                m_directory_index.emplace(std::move(normalizedPath), std::move(relativePath));
+            else if (relativePath < existingEntry->second)
+                existingEntry->second = std::move(relativePath);
+        }
+
+        m_directory_index_complete = true;
+    }
+    catch (fs::filesystem_error& e)
+    {
+        std::cerr << "Failed to index search path \"" << m_path << "\": " << e.what() << "\n";
+        m_directory_index.clear();
+    }
+}
+
+bool SearchPathFilesystem::FindInDirectoryIndex(const std::string& fileName, std::string& indexedFileName)
+{
+    const auto normalizedFileName = XAssetInfoGeneric::NormalizeAssetName(fs::path(fileName).lexically_normal().generic_string());
+
+    std::lock_guard lock(m_directory_index_mutex);
+    if (!m_directory_index_built)
+        BuildDirectoryIndex();
+
+    // Without a complete index the file is looked up on disk
+    if (!m_directory_index_complete)
+    {
+        indexedFileName = fileName;
+        return true;
+    }
+
+    const auto foundEntry = m_directory_index.find(normalizedFileName);
+    if (foundEntry == m_directory_index.end())
+        return false;
+
+    indexedFileName = foundEntry->second;
+    return true;
+}
+
+void SearchPathFilesystem::InvalidateDirectoryIndex()
+{
+    std::lock_guard lock(m_directory_index_mutex);
+    m_directory_index_built = false;
+    m_directory_index.clear();
 }
 
 std::string SearchPathFilesystem::GetPath()
@@ -17,19 +95,46 @@ std::string SearchPathFilesystem::GetPath()
     return m_path;
 }
 
+bool SearchPathFilesystem::GetFilePath(const std::string& fileName, std::string& filePath)
+{
+    const fs::path fileNamePath(fileName);
+
+    // Paths that leave the search path cannot be found in the index
+    std::string indexedFileName;
+    const auto canUseIndex = m_use_directory_index && fileNamePath.is_relative() && !fileNamePath.lexically_normal().generic_string().starts_with("..");
+    if (canUseIndex && !FindInDirectoryIndex(fileName, indexedFileName))
+        return false;
+
+    filePath = fs::path(m_path).append(canUseIndex ? indexedFileName : fileName).string();
+    return true;
+}
+
 SearchPathOpenFile SearchPathFilesystem::Open(const std::string& fileName)
 {
-    const auto filePath = fs::path(m_path).append(fileName);
-    std::ifstream file(filePath.string(), std::fstream::in | std::fstream::binary);
+    std::string filePath;
+    if (!GetFilePath(fileName, filePath))
+        return SearchPathOpenFile();
+
+    std::ifstream file(filePath, std::fstream::in | std::fstream::binary);
 
     if (file.is_open())
     {
-        return SearchPathOpenFile(std::make_unique<std::ifstream>(std::move(file)), static_cast<int64_t>(file_size(filePath)));
+        return SearchPathOpenFile(std::make_unique<std::ifstream>(std::move(file)), static_cast<int64_t>(fs::file_size(filePath)));
     }
 
     return SearchPathOpenFile();
 }
 
+bool SearchPathFilesystem::OpenMapped(const std::string& fileName, MemoryMappedFile& mappedFile)
+{
+    std::string filePath;
+    if (!GetFilePath(fileName, filePath))
+        return false;
+
+    std::error_code ec;
+    return fs::is_regular_file(filePath, ec) && mappedFile.Open(filePath);
+}
+
 void SearchPathFilesystem::Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback)
 {
     try
@@ -62,3 +167,21 @@ void SearchPathFilesystem::Find(const SearchPathSearchOptions& options, const st
         printf("Directory Iterator threw error when trying to find files: \"%s\"\n", e.what());
     }
 }
+
+bool SearchPathFilesystem::ListFiles(const std::function<void(const std::string&)>& callback)
+{
+    if (!m_use_directory_index)
+        return false;
+
+    std::lock_guard lock(m_directory_index_mutex);
+    if (!m_directory_index_built)
+        BuildDirectoryIndex();
+
+    if (!m_directory_index_complete)
+        return false;
+
+    for (const auto& fileName : m_directory_index | std::views::values)
+        callback(fileName);
+
+    return true;
+}
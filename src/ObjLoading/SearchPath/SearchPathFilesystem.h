@@ -2,16 +2,44 @@
 
 #include "ISearchPath.h"
 
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 class SearchPathFilesystem final : public ISearchPath
 {
     std::string m_path;
 
+    bool m_use_directory_index;
+    bool m_directory_index_built;
+    bool m_directory_index_complete;
+    // Maps normalized relative file paths to the relative paths of the files on disk
+    std::unordered_map<std::string, std::string> m_directory_index;
+    std::mutex m_directory_index_mutex;
+
+    void BuildDirectoryIndex();
+    _NODISCARD bool FindInDirectoryIndex(const std::string& fileName, std::string& indexedFileName);
+    _NODISCARD bool GetFilePath(const std::string& fileName, std::string& filePath);
+
 public:
     explicit SearchPathFilesystem(std::string path);
 
+    /**
+     * \brief Creates a search path for a directory on disk.
+     * \param path The path to the directory.
+     * \param useDirectoryIndex Whether to list all files of the directory once when first opening a file instead of asking the OS for every file.
+     * Files are then matched case-insensitively the same way asset names are. Files that are added afterwards are not found until the index is invalidated.
+     */
+    SearchPathFilesystem(std::string path, bool useDirectoryIndex);
+
     SearchPathOpenFile Open(const std::string& fileName) override;
+    bool OpenMapped(const std::string& fileName, MemoryMappedFile& mappedFile) override;
     std::string GetPath() override;
     void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
+    bool ListFiles(const std::function<void(const std::string&)>& callback) override;
+
+    /**
+     * \brief Discards the directory index so it is built again the next time a file is opened.
+     */
+    void InvalidateDirectoryIndex();
 };
@@ -0,0 +1,109 @@
+#include "SearchPathPrefetch.h"
+
+#include <sstream>
+
+SearchPathPrefetch::SearchPathPrefetch(ISearchPath* searchPath, const size_t workerCount)
+    : m_search_path(searchPath),
+      m_worker_count(workerCount)
+{
+}
+
+SearchPathPrefetch::~SearchPathPrefetch()
+{
+    // Jobs reference the forwarded search path which might not outlive this one
+    if (m_worker_pool)
+        m_worker_pool->WaitForIdle();
+}
+
+SearchPathPrefetch::PrefetchedFile SearchPathPrefetch::ReadFile(ISearchPath* searchPath, const std::string& fileName)
+{
+    const auto file = searchPath->Open(fileName);
+    if (!file.IsOpen() || file.m_length < 0)
+        return PrefetchedFile{false, {}};
+
+    PrefetchedFile prefetchedFile{true, std::string(static_cast<size_t>(file.m_length), '\0')};
+    file.m_stream->read(prefetchedFile.m_data.data(), file.m_length);
+    if (file.m_stream->gcount() != file.m_length)
+        return PrefetchedFile{false, {}};
+
+    return prefetchedFile;
+}
+
+void SearchPathPrefetch::Prefetch(const std::vector<std::string>& fileNames)
+{
+    if (m_worker_count == 0u || fileNames.empty())
+        return;
+
+    std::lock_guard lock(m_mutex);
+    if (!m_worker_pool)
+        m_worker_pool = std::make_unique<ThreadPool>(m_worker_count);
+
+    for (const auto& fileName : fileNames)
+    {
+        if (m_prefetched_files.contains(fileName))
+            continue;
+
+        auto task = std::make_shared<std::packaged_task<PrefetchedFile()>>(
+            [searchPath = m_search_path, fileName]
+            {
+                try
+                {
+                    return ReadFile(searchPath, fileName);
+                }
+                catch (...)
+                {
+                    // The file is read again when opening it which reports the error to the caller
+                    return PrefetchedFile{false, {}};
+                }
+            });
+
+        m_prefetched_files.emplace(fileName, task->get_future());
+        m_worker_pool->Enqueue(
+            [task]
+            {
+                (*task)();
+            });
+    }
+}
+
+SearchPathOpenFile SearchPathPrefetch::Open(const std::string& fileName)
+{
+    std::future<PrefetchedFile> prefetchedFileResult;
+    {
+        std::lock_guard lock(m_mutex);
+        const auto foundFile = m_prefetched_files.find(fileName);
+        if (foundFile != m_prefetched_files.end())
+        {
+            prefetchedFileResult = std::move(foundFile->second);
+            m_prefetched_files.erase(foundFile);
+        }
+    }
+
+    if (prefetchedFileResult.valid())
+    {
+        // Files that could not be read ahead of time are opened normally to behave the same as without reading ahead
+        auto prefetchedFile = prefetchedFileResult.get();
+        if (prefetchedFile.m_exists)
+        {
+            const auto length = static_cast<int64_t>(prefetchedFile.m_data.size());
+            return SearchPathOpenFile(std::make_unique<std::istringstream>(std::move(prefetchedFile.m_data)), length);
+        }
+    }
+
+    return m_search_path->Open(fileName);
+}
+
+bool SearchPathPrefetch::OpenMapped(const std::string& fileName, MemoryMappedFile& mappedFile)
+{
+    return m_search_path->OpenMapped(fileName, mappedFile);
+}
+
+std::string SearchPathPrefetch::GetPath()
+{
+    return m_search_path->GetPath();
+}
+
+void SearchPathPrefetch::Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback)
+{
+    m_search_path->Find(options, callback);
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "ISearchPath.h"
+#include "Utils/ThreadPool.h"
+
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \brief A search path that forwards to another search path and is able to read files ahead of time in the background.
+ * A file that was read ahead of time is served from memory the first time it is opened.
+ */
+class SearchPathPrefetch final : public ISearchPath
+{
+    class PrefetchedFile
+    {
+    public:
+        bool m_exists;
+        std::string m_data;
+    };
+
+    ISearchPath* m_search_path;
+    size_t m_worker_count;
+    std::unique_ptr<ThreadPool> m_worker_pool;
+    std::unordered_map<std::string, std::future<PrefetchedFile>> m_prefetched_files;
+    std::mutex m_mutex;
+
+    static PrefetchedFile ReadFile(ISearchPath* searchPath, const std::string& fileName);
+
+public:
+    /**
+     * \brief Creates a search path that is able to read files of another search path ahead of time.
+     * \param searchPath The search path to forward to.
+     * \param workerCount The amount of threads that read files ahead of time. A value of \c 0 disables reading ahead of time.
+     */
+    SearchPathPrefetch(ISearchPath* searchPath, size_t workerCount);
+    ~SearchPathPrefetch() override;
+
+    SearchPathPrefetch(const SearchPathPrefetch& other) = delete;
+    SearchPathPrefetch(SearchPathPrefetch&& other) noexcept = delete;
+    SearchPathPrefetch& operator=(const SearchPathPrefetch& other) = delete;
+    SearchPathPrefetch& operator=(SearchPathPrefetch&& other) noexcept = delete;
+
+    /**
+     * \brief Starts reading the specified files in the background.
+     * \param fileNames The relative paths of the files to read.
+     */
+    void Prefetch(const std::vector<std::string>& fileNames);
+
+    SearchPathOpenFile Open(const std::string& fileName) override;
+    bool OpenMapped(const std::string& fileName, MemoryMappedFile& mappedFile) override;
+    std::string GetPath() override;
+    void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
+};
@@ -1,20 +1,162 @@
 #include "SearchPaths.h"
 
+#include "Pool/XAssetInfo.h"
+
 #include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
 
-SearchPathOpenFile SearchPaths::Open(const std::string& fileName)
+namespace fs = std::filesystem;
+
+class SearchPaths::FileIndex
 {
-    for (auto* searchPathEntry : m_search_paths)
+public:
+    class IndexedFile
     {
-        auto file = searchPathEntry->Open(fileName);
+    public:
+        ISearchPath* m_search_path;
+        std::string m_file_name;
+    };
 
-        if (file.IsOpen())
+    /**
+     * \brief A range of consecutive search paths. Either all files of the range are indexed or it consists of a single search path that cannot be indexed.
+     */
+    class Segment
+    {
+    public:
+        ISearchPath* m_unindexed_search_path = nullptr;
+        std::unordered_map<std::string, IndexedFile> m_files;
+    };
+
+    std::mutex m_mutex;
+    bool m_built = false;
+    std::vector<Segment> m_segments;
+
+    void Build(const std::vector<ISearchPath*>& searchPaths)
+    {
+        m_segments.clear();
+        for (auto* searchPath : searchPaths)
         {
-            return file;
+            std::vector<std::string> fileNames;
+            const auto canBeIndexed = searchPath->ListFiles(
+                [&fileNames](const std::string& fileName)
+                {
+                    fileNames.emplace_back(fileName);
+                });
+
+            if (!canBeIndexed)
+            {
+                m_segments.emplace_back().m_unindexed_search_path = searchPath;
+                continue;
+            }
+
+            if (m_segments.empty() || m_segments.back().m_unindexed_search_path != nullptr)
+                m_segments.emplace_back();
+
+            // Search paths that come first take precedence so existing entries are never replaced
+            auto& files = m_segments.back().m_files;
+            for (auto& fileName : fileNames)
+            {
+                auto normalizedFileName = NormalizeFileName(fileName);
+                files.try_emplace(std::move(normalizedFileName), IndexedFile{searchPath, std::move(fileName)});
+            }
         }
+
+        m_built = true;
     }
 
-    return SearchPathOpenFile();
+    static std::string NormalizeFileName(const std::string& fileName)
+    {
+        return XAssetInfoGeneric::NormalizeAssetName(fs::path(fileName).lexically_normal().generic_string());
+    }
+};
+
+SearchPaths::SearchPaths()
+    : SearchPaths(false)
+{
+}
+
+SearchPaths::SearchPaths(const bool useFileIndex)
+    : m_file_index(useFileIndex ? std::make_unique<FileIndex>() : nullptr)
+{
+}
+
+SearchPaths::~SearchPaths() = default;
+SearchPaths::SearchPaths(SearchPaths&& other) noexcept = default;
+SearchPaths& SearchPaths::operator=(SearchPaths&& other) noexcept = default;
+
+const SearchPaths::FileIndex& SearchPaths::GetBuiltFileIndex()
+{
+    std::lock_guard lock(m_file_index->m_mutex);
+    if (!m_file_index->m_built)
+        m_file_index->Build(m_search_paths);
+
+    return *m_file_index;
+}
+
+void SearchPaths::VisitFile(const std::string& fileName, const std::function<bool(ISearchPath& searchPath, const std::string& searchPathFileName)>& visitor)
+{
+    // Paths that leave the search paths cannot be found in the index
+    const fs::path fileNamePath(fileName);
+    if (m_file_index && fileNamePath.is_relative() && !fileNamePath.lexically_normal().generic_string().starts_with(".."))
+    {
+        const auto& fileIndex = GetBuiltFileIndex();
+        const auto normalizedFileName = FileIndex::NormalizeFileName(fileName);
+        for (const auto& segment : fileIndex.m_segments)
+        {
+            if (segment.m_unindexed_search_path)
+            {
+                if (visitor(*segment.m_unindexed_search_path, fileName))
+                    return;
+
+                continue;
+            }
+
+            const auto indexedFile = segment.m_files.find(normalizedFileName);
+            if (indexedFile != segment.m_files.end())
+            {
+                if (visitor(*indexedFile->second.m_search_path, indexedFile->second.m_file_name))
+                    return;
+            }
+        }
+
+        return;
+    }
+
+    for (auto* searchPathEntry : m_search_paths)
+    {
+        if (visitor(*searchPathEntry, fileName))
+            return;
+    }
+}
+
+SearchPathOpenFile SearchPaths::Open(const std::string& fileName)
+{
+    SearchPathOpenFile file;
+    VisitFile(fileName,
+              [&file](ISearchPath& searchPath, const std::string& searchPathFileName)
+              {
+                  file = searchPath.Open(searchPathFileName);
+                  return file.IsOpen();
+              });
+
+    return file;
+}
+
+bool SearchPaths::OpenMapped(const std::string& fileName, MemoryMappedFile& mappedFile)
+{
+    // The first search path that contains the file decides whether it can be mapped to not pick up the file of another search path
+    auto isMapped = false;
+    VisitFile(fileName,
+              [&mappedFile, &isMapped](ISearchPath& searchPath, const std::string& searchPathFileName)
+              {
+                  isMapped = searchPath.OpenMapped(searchPathFileName, mappedFile);
+                  return isMapped || searchPath.Open(searchPathFileName).IsOpen();
+              });
+
+    return isMapped;
 }
 
 std::string SearchPaths::GetPath()
@@ -30,19 +172,54 @@ void SearchPaths::Find(const SearchPathSearchOptions& options, const std::functi
     }
 }
 
+bool SearchPaths::ListFiles(const std::function<void(const std::string&)>& callback)
+{
+    // Only list files when all search paths can list theirs, otherwise some files would be missing
+    std::vector<std::string> fileNames;
+    for (auto* searchPathEntry : m_search_paths)
+    {
+        const auto canBeListed = searchPathEntry->ListFiles(
+            [&fileNames](const std::string& fileName)
+            {
+                fileNames.emplace_back(fileName);
+            });
+
+        if (!canBeListed)
+            return false;
+    }
+
+    for (const auto& fileName : fileNames)
+        callback(fileName);
+
+    return true;
+}
+
+void SearchPaths::InvalidateFileIndex()
+{
+    if (!m_file_index)
+        return;
+
+    std::lock_guard lock(m_file_index->m_mutex);
+    m_file_index->m_built = false;
+    m_file_index->m_segments.clear();
+}
+
 void SearchPaths::CommitSearchPath(std::unique_ptr<ISearchPath> searchPath)
 {
+    InvalidateFileIndex();
     m_search_paths.push_back(searchPath.get());
     m_owned_search_paths.emplace_back(std::move(searchPath));
 }
 
 void SearchPaths::IncludeSearchPath(ISearchPath* searchPath)
 {
+    InvalidateFileIndex();
     m_search_paths.push_back(searchPath);
 }
 
 void SearchPaths::RemoveSearchPath(ISearchPath* searchPath)
 {
+    InvalidateFileIndex();
     for (auto i = m_search_paths.begin(); i != m_search_paths.end(); ++i)
     {
         if (*i == searchPath)
@@ -2,27 +2,51 @@
 
 #include "ISearchPath.h"
 
+#include <functional>
+#include <memory>
 #include <vector>
 
 class SearchPaths final : public ISearchPath
 {
+    class FileIndex;
+
     std::vector<ISearchPath*> m_search_paths;
     std::vector<std::unique_ptr<ISearchPath>> m_owned_search_paths;
+    std::unique_ptr<FileIndex> m_file_index;
+
+    const FileIndex& GetBuiltFileIndex();
+
+    /**
+     * \brief Calls the visitor for the search paths that may contain the file in order of precedence until it returns \c true.
+     * \param fileName The relative path to the file.
+     * \param visitor The visitor to call with a search path and the name of the file in it. Returns whether the file was found.
+     */
+    void VisitFile(const std::string& fileName, const std::function<bool(ISearchPath& searchPath, const std::string& searchPathFileName)>& visitor);
 
 public:
     using iterator = std::vector<ISearchPath*>::iterator;
 
-    SearchPaths() = default;
-    ~SearchPaths() override = default;
+    SearchPaths();
+
+    /**
+     * \brief Creates an empty \c SearchPaths object.
+     * \param useFileIndex Whether to index the files of all search paths that can list them when first opening a file.
+     * Opening a file then only needs a single lookup for all indexed search paths instead of asking each of them in order.
+     * Files are matched case-insensitively the same way asset names are.
+     */
+    explicit SearchPaths(bool useFileIndex);
+    ~SearchPaths() override;
 
     SearchPathOpenFile Open(const std::string& fileName) override;
+    bool OpenMapped(const std::string& fileName, MemoryMappedFile& mappedFile) override;
     std::string GetPath() override;
     void Find(const SearchPathSearchOptions& options, const std::function<void(const std::string&)>& callback) override;
+    bool ListFiles(const std::function<void(const std::string&)>& callback) override;
 
     SearchPaths(const SearchPaths& other) = delete;
-    SearchPaths(SearchPaths&& other) noexcept = default;
+    SearchPaths(SearchPaths&& other) noexcept;
     SearchPaths& operator=(const SearchPaths& other) = delete;
-    SearchPaths& operator=(SearchPaths&& other) noexcept = default;
+    SearchPaths& operator=(SearchPaths&& other) noexcept;
 
     /**
      * \brief Adds a search path that gets deleted upon destruction of the \c SearchPaths object.
@@ -42,6 +66,12 @@ public:
      */
     void RemoveSearchPath(ISearchPath* searchPath);
 
+    /**
+     * \brief Discards the file index so it is built again the next time a file is opened.
+     * Must be called when the files of any included search path changed. It must not be called while files are being opened.
+     */
+    void InvalidateFileIndex();
+
     iterator begin();
     iterator end();
 };
@@ -8,6 +8,11 @@ StateMapRule::StateMapRule()
 {
 }
 
+bool StateMapEntryDecisionTable::IsCompiled() const
+{
+    return !m_rule_indices.empty();
+}
+
 StateMapEntry::StateMapEntry()
     : m_default_index(0u)
 {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Parsing/Simple/Expression/ISimpleExpression.h"
+#include "Utils/ClassUtils.h"
 
 #include <memory>
 #include <string>
@@ -18,11 +19,28 @@ namespace state_map
         StateMapRule();
     };
 
+    /**
+     * \brief The index of the rule that applies to a state map entry for every combination of values of the vars its conditions reference.
+     * Only valid for the layout the state map was read with.
+     */
+    class StateMapEntryDecisionTable
+    {
+    public:
+        // The indices of the referenced layout vars and by how much their value index advances the table index.
+        // A value index equal to the amount of values of a var means the var has none of its values.
+        std::vector<size_t> m_var_indices;
+        std::vector<size_t> m_var_strides;
+        std::vector<size_t> m_rule_indices;
+
+        _NODISCARD bool IsCompiled() const;
+    };
+
     class StateMapEntry
     {
     public:
         size_t m_default_index;
         std::vector<std::unique_ptr<StateMapRule>> m_rules;
+        StateMapEntryDecisionTable m_decision_table;
 
         StateMapEntry();
     };
@@ -1,11 +1,52 @@
 #include "StateMapHandler.h"
 
+#include "Parsing/Simple/Expression/SimpleExpressionBinaryOperation.h"
+#include "Parsing/Simple/Expression/SimpleExpressionConditionalOperator.h"
+#include "Parsing/Simple/Expression/SimpleExpressionScopeValue.h"
+#include "Parsing/Simple/Expression/SimpleExpressionUnaryOperation.h"
+
 #include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <optional>
+#include <set>
 
 using namespace state_map;
 
+namespace
+{
+    // Entries whose referenced vars have more value combinations than this are evaluated when applying the state map instead
+    constexpr size_t MAX_DECISION_TABLE_SIZE = 4096u;
+
+    bool CollectReferencedVars(const ISimpleExpression* expression, std::set<std::string>& varNames)
+    {
+        if (dynamic_cast<const SimpleExpressionValue*>(expression))
+            return true;
+
+        if (const auto* scopeValue = dynamic_cast<const SimpleExpressionScopeValue*>(expression))
+        {
+            varNames.emplace(scopeValue->m_value_name);
+            return true;
+        }
+
+        if (const auto* unaryOperation = dynamic_cast<const SimpleExpressionUnaryOperation*>(expression))
+            return CollectReferencedVars(unaryOperation->m_operand.get(), varNames);
+
+        if (const auto* binaryOperation = dynamic_cast<const SimpleExpressionBinaryOperation*>(expression))
+            return CollectReferencedVars(binaryOperation->m_operand1.get(), varNames) && CollectReferencedVars(binaryOperation->m_operand2.get(), varNames);
+
+        if (const auto* conditionalOperator = dynamic_cast<const SimpleExpressionConditionalOperator*>(expression))
+        {
+            return CollectReferencedVars(conditionalOperator->m_condition.get(), varNames)
+                   && CollectReferencedVars(conditionalOperator->m_true_value.get(), varNames)
+                   && CollectReferencedVars(conditionalOperator->m_false_value.get(), varNames);
+        }
+
+        // Unknown expressions might depend on anything so their entry cannot be compiled
+        return false;
+    }
+} // namespace
+
 void StateMapVars::AddValue(std::string key, std::string value)
 {
     m_vars.emplace(std::make_pair(std::move(key), std::move(value)));
@@ -32,7 +73,10 @@ void StateMapHandler::ApplyStateMap(const uint32_t* baseStateBits, uint32_t* out
     assert(baseStateBits != nullptr);
     assert(outStateBits != nullptr);
 
-    const auto vars = BuildVars(baseStateBits);
+    const auto varValueIndices = GetVarValueIndices(baseStateBits);
+
+    // Vars are only needed for entries without decision table
+    std::optional<StateMapVars> vars;
 
     for (auto i = 0u; i < m_state_map_layout.m_state_bits_count; i++)
         outStateBits[i] = baseStateBits[i];
@@ -40,32 +84,98 @@ void StateMapHandler::ApplyStateMap(const uint32_t* baseStateBits, uint32_t* out
     for (auto entryIndex = 0u; entryIndex < m_state_map.m_state_map_entries.size(); entryIndex++)
     {
         const auto& entry = m_state_map.m_state_map_entries[entryIndex];
-        const auto matchingRule = std::ranges::find_if(entry.m_rules,
-                                                       [&vars](const std::unique_ptr<StateMapRule>& rule)
-                                                       {
-                                                           const auto matchingCondition =
-                                                               std::ranges::find_if(rule->m_conditions,
-                                                                                    [&vars](std::unique_ptr<ISimpleExpression>& condition)
-                                                                                    {
-                                                                                        return condition->EvaluateNonStatic(&vars).IsTruthy();
-                                                                                    });
-
-                                                           return matchingCondition != rule->m_conditions.end();
-                                                       });
-
-        if (matchingRule != entry.m_rules.end())
-            ApplyRule(m_state_map_layout.m_entry_layout.m_entries[entryIndex], **matchingRule, outStateBits);
+
+        size_t ruleIndex;
+        if (entry.m_decision_table.IsCompiled())
+        {
+            const auto& decisionTable = entry.m_decision_table;
+            auto tableIndex = 0u;
+            for (auto i = 0u; i < decisionTable.m_var_indices.size(); i++)
+                tableIndex += varValueIndices[decisionTable.m_var_indices[i]] * decisionTable.m_var_strides[i];
+
+            ruleIndex = decisionTable.m_rule_indices[tableIndex];
+        }
         else
-            ApplyRule(m_state_map_layout.m_entry_layout.m_entries[entryIndex], *entry.m_rules[entry.m_default_index], outStateBits);
+        {
+            if (!vars)
+                vars = BuildVars(varValueIndices);
+
+            ruleIndex = FindMatchingRule(entry, *vars);
+        }
+
+        ApplyRule(m_state_map_layout.m_entry_layout.m_entries[entryIndex], *entry.m_rules[ruleIndex], outStateBits);
     }
 }
 
-StateMapVars StateMapHandler::BuildVars(const uint32_t* baseStateBits) const
+void StateMapHandler::CompileDecisionTables(const StateMapLayout& stateMapLayout, StateMapDefinition& stateMap)
 {
-    StateMapVars result;
+    const auto& layoutVars = stateMapLayout.m_var_layout.m_vars;
 
-    for (const auto& var : m_state_map_layout.m_var_layout.m_vars)
+    for (auto& entry : stateMap.m_state_map_entries)
     {
+        std::set<std::string> referencedVarNames;
+        const auto canCompile = std::ranges::all_of(entry.m_rules,
+                                                    [&referencedVarNames](const std::unique_ptr<StateMapRule>& rule)
+                                                    {
+                                                        return std::ranges::all_of(rule->m_conditions,
+                                                                                   [&referencedVarNames](const std::unique_ptr<ISimpleExpression>& condition)
+                                                                                   {
+                                                                                       return CollectReferencedVars(condition.get(), referencedVarNames);
+                                                                                   });
+                                                    });
+        if (!canCompile)
+            continue;
+
+        StateMapEntryDecisionTable decisionTable;
+        auto tableSize = 1u;
+        auto tableTooLarge = false;
+        for (auto varIndex = 0u; varIndex < layoutVars.size(); varIndex++)
+        {
+            if (!referencedVarNames.contains(layoutVars[varIndex].m_name))
+                continue;
+
+            const auto varValueCount = layoutVars[varIndex].m_values.size() + 1u;
+            if (tableSize > MAX_DECISION_TABLE_SIZE / varValueCount)
+            {
+                tableTooLarge = true;
+                break;
+            }
+
+            decisionTable.m_var_indices.emplace_back(varIndex);
+            decisionTable.m_var_strides.emplace_back(tableSize);
+            tableSize *= varValueCount;
+        }
+
+        if (tableTooLarge)
+            continue;
+
+        decisionTable.m_rule_indices.resize(tableSize);
+        for (auto tableIndex = 0u; tableIndex < tableSize; tableIndex++)
+        {
+            StateMapVars vars;
+            for (auto i = 0u; i < decisionTable.m_var_indices.size(); i++)
+            {
+                const auto& var = layoutVars[decisionTable.m_var_indices[i]];
+                const auto valueIndex = tableIndex / decisionTable.m_var_strides[i] % (var.m_values.size() + 1u);
+                if (valueIndex < var.m_values.size())
+                    vars.AddValue(var.m_name, var.m_values[valueIndex].m_name);
+            }
+
+            decisionTable.m_rule_indices[tableIndex] = FindMatchingRule(entry, vars);
+        }
+
+        entry.m_decision_table = std::move(decisionTable);
+    }
+}
+
+std::vector<size_t> StateMapHandler::GetVarValueIndices(const uint32_t* baseStateBits) const
+{
+    const auto& layoutVars = m_state_map_layout.m_var_layout.m_vars;
+    std::vector<size_t> result(layoutVars.size());
+
+    for (auto varIndex = 0u; varIndex < layoutVars.size(); varIndex++)
+    {
+        const auto& var = layoutVars[varIndex];
         const auto baseStateBitField = baseStateBits[var.m_state_bits_index];
         const auto matchingValue = std::ranges::find_if(var.m_values,
                                                         [&baseStateBitField](const StateMapLayoutVarValue& value)
@@ -73,15 +183,50 @@ StateMapVars StateMapHandler::BuildVars(const uint32_t* baseStateBits) const
                                                             return (baseStateBitField & value.m_state_bits_mask) == value.m_state_bits_mask;
                                                         });
 
-        if (matchingValue != var.m_values.end())
-            result.AddValue(var.m_name, matchingValue->m_name);
-        else
+        result[varIndex] = static_cast<size_t>(matchingValue - var.m_values.begin());
+        if (matchingValue == var.m_values.end())
             std::cerr << "Could not find base value for state map var \"" << var.m_name << "\"\n";
     }
 
     return result;
 }
 
+StateMapVars StateMapHandler::BuildVars(const std::vector<size_t>& varValueIndices) const
+{
+    StateMapVars result;
+
+    const auto& layoutVars = m_state_map_layout.m_var_layout.m_vars;
+    for (auto varIndex = 0u; varIndex < layoutVars.size(); varIndex++)
+    {
+        const auto& var = layoutVars[varIndex];
+        if (varValueIndices[varIndex] < var.m_values.size())
+            result.AddValue(var.m_name, var.m_values[varValueIndices[varIndex]].m_name);
+    }
+
+    return result;
+}
+
+size_t StateMapHandler::FindMatchingRule(const StateMapEntry& entry, const StateMapVars& vars)
+{
+    const auto matchingRule = std::ranges::find_if(entry.m_rules,
+                                                   [&vars](const std::unique_ptr<StateMapRule>& rule)
+                                                   {
+                                                       const auto matchingCondition =
+                                                           std::ranges::find_if(rule->m_conditions,
+                                                                                [&vars](const std::unique_ptr<ISimpleExpression>& condition)
+                                                                                {
+                                                                                    return condition->EvaluateNonStatic(&vars).IsTruthy();
+                                                                                });
+
+                                                       return matchingCondition != rule->m_conditions.end();
+                                                   });
+
+    if (matchingRule != entry.m_rules.end())
+        return static_cast<size_t>(matchingRule - entry.m_rules.begin());
+
+    return entry.m_default_index;
+}
+
 void StateMapHandler::ApplyRule(const StateMapLayoutEntry& entry, const StateMapRule& rule, uint32_t* outStateBits)
 {
     if (rule.m_passthrough)
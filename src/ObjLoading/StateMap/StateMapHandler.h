@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <unordered_map>
+#include <vector>
 
 namespace state_map
 {
@@ -26,8 +27,19 @@ namespace state_map
 
         void ApplyStateMap(const uint32_t* baseStateBits, uint32_t* outStateBits) const;
 
+        /**
+         * \brief Precomputes which rule applies to each entry for all combinations of the vars the entry references.
+         * Applying the state map then only needs to look up the rule instead of evaluating conditions.
+         * Entries that reference too many var combinations are left to be evaluated when applying the state map.
+         * \param stateMapLayout The layout the state map was read with.
+         * \param stateMap The state map to compile.
+         */
+        static void CompileDecisionTables(const StateMapLayout& stateMapLayout, StateMapDefinition& stateMap);
+
     private:
-        StateMapVars BuildVars(const uint32_t* baseStateBits) const;
+        _NODISCARD std::vector<size_t> GetVarValueIndices(const uint32_t* baseStateBits) const;
+        _NODISCARD StateMapVars BuildVars(const std::vector<size_t>& varValueIndices) const;
+        static size_t FindMatchingRule(const StateMapEntry& entry, const StateMapVars& vars);
         static void ApplyRule(const StateMapLayoutEntry& entry, const StateMapRule& rule, uint32_t* outStateBits);
 
         const StateMapLayout& m_state_map_layout;
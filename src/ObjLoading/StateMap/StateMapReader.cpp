@@ -4,6 +4,7 @@
 #include "Parsing/Impl/ParserSingleInputStream.h"
 #include "Parsing/Matcher/StateMapExpressionMatchers.h"
 #include "Parsing/StateMapParser.h"
+#include "StateMapHandler.h"
 
 #include <iostream>
 
@@ -67,5 +68,8 @@ std::unique_ptr<StateMapDefinition> StateMapReader::ReadStateMapDefinition() con
     if (!IsValidEndState(parserEndState))
         return nullptr;
 
-    return parser->GetStateMapDefinition();
+    auto stateMapDefinition = parser->GetStateMapDefinition();
+    StateMapHandler::CompileDecisionTables(m_state_map_layout, *stateMapDefinition);
+
+    return stateMapDefinition;
 }
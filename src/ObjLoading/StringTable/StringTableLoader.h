@@ -29,39 +29,20 @@ namespace string_table
             auto* stringTable = memory.Create<StringTableType>();
             stringTable->name = memory.Dup(assetName.c_str());
 
-            std::vector<std::vector<std::string>> csvLines;
-            std::vector<std::string> currentLine;
-            auto maxCols = 0u;
+            CsvCells csvCells;
             const CsvInputStream csv(stream);
+            csv.ReadAllRows(csvCells, memory);
 
-            while (csv.NextRow(currentLine))
-            {
-                if (currentLine.size() > maxCols)
-                    maxCols = currentLine.size();
-                csvLines.emplace_back(std::move(currentLine));
-                currentLine = std::vector<std::string>();
-            }
-
-            stringTable->columnCount = static_cast<int>(maxCols);
-            stringTable->rowCount = static_cast<int>(csvLines.size());
+            stringTable->columnCount = static_cast<int>(csvCells.m_column_count);
+            stringTable->rowCount = static_cast<int>(csvCells.m_row_count);
             const auto cellCount = static_cast<unsigned>(stringTable->rowCount) * static_cast<unsigned>(stringTable->columnCount);
 
             if (cellCount)
             {
                 stringTable->values = memory.Alloc<CellType>(cellCount);
 
-                for (auto row = 0u; row < csvLines.size(); row++)
-                {
-                    const auto& rowValues = csvLines[row];
-                    for (auto col = 0u; col < maxCols; col++)
-                    {
-                        auto& cell = stringTable->values[row * maxCols + col];
-                        if (col >= rowValues.size() || rowValues[col].empty())
-                            SetCellContent(cell, "");
-                        else
-                            SetCellContent(cell, memory.Dup(rowValues[col].c_str()));
-                    }
-                }
+                for (auto i = 0u; i < cellCount; i++)
+                    SetCellContent(stringTable->values[i], csvCells.m_cells[i]);
             }
             else
             {
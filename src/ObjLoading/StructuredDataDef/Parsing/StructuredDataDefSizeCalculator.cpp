@@ -92,16 +92,25 @@ class StructuredDataDefSizeCalculatorInternal
         m_type_stack.pop_back();
     }
 
-    void CalculateForIndexedArray(CommonStructuredDataIndexedArray& indexedArray)
+    void CalculateForIndexedArray(const size_t index, CommonStructuredDataIndexedArray& indexedArray)
     {
+        // Arrays are referenced by every property using them so they are only calculated once
+        if (m_indexed_array_calculated[index])
+            return;
+
         CalculateForType(indexedArray.m_array_type);
         indexedArray.m_element_size_in_bits = indexedArray.m_array_type.GetSizeInBits(m_def);
+        m_indexed_array_calculated[index] = true;
     }
 
-    void CalculateForEnumedArray(CommonStructuredDataEnumedArray& enumedArray)
+    void CalculateForEnumedArray(const size_t index, CommonStructuredDataEnumedArray& enumedArray)
     {
+        if (m_enumed_array_calculated[index])
+            return;
+
         CalculateForType(enumedArray.m_array_type);
         enumedArray.m_element_size_in_bits = enumedArray.m_array_type.GetSizeInBits(m_def);
+        m_enumed_array_calculated[index] = true;
     }
 
     void CalculateForType(const CommonStructuredDataType type)
@@ -114,11 +123,11 @@ class StructuredDataDefSizeCalculatorInternal
             break;
         case CommonStructuredDataTypeCategory::INDEXED_ARRAY:
             assert(type.m_info.type_index < m_def.m_indexed_arrays.size());
-            CalculateForIndexedArray(m_def.m_indexed_arrays[type.m_info.type_index]);
+            CalculateForIndexedArray(type.m_info.type_index, m_def.m_indexed_arrays[type.m_info.type_index]);
             break;
         case CommonStructuredDataTypeCategory::ENUM_ARRAY:
             assert(type.m_info.type_index < m_def.m_enumed_arrays.size());
-            CalculateForEnumedArray(m_def.m_enumed_arrays[type.m_info.type_index]);
+            CalculateForEnumedArray(type.m_info.type_index, m_def.m_enumed_arrays[type.m_info.type_index]);
             break;
         default:
             break;
@@ -140,10 +149,12 @@ public:
         auto index = 0u;
         for (auto& _struct : m_def.m_structs)
             CalculateForStruct(index++, *_struct);
+        index = 0u;
         for (auto& indexedArray : m_def.m_indexed_arrays)
-            CalculateForIndexedArray(indexedArray);
+            CalculateForIndexedArray(index++, indexedArray);
+        index = 0u;
         for (auto& enumedArray : m_def.m_enumed_arrays)
-            CalculateForEnumedArray(enumedArray);
+            CalculateForEnumedArray(index++, enumedArray);
     }
 };
 
@@ -0,0 +1,138 @@
+#include "TechniqueDefinition.h"
+
+using namespace techset;
+
+bool TechniqueDefinition::Replay(ITechniqueDefinitionAcceptor& acceptor, std::string& errorMessage) const
+{
+    for (const auto& recordedCall : m_recorded_calls)
+    {
+        if (!recordedCall(acceptor, errorMessage))
+            return false;
+    }
+
+    return true;
+}
+
+void TechniqueDefinition::AcceptNextPass()
+{
+    m_recorded_calls.emplace_back(
+        [](ITechniqueDefinitionAcceptor& acceptor, std::string&)
+        {
+            acceptor.AcceptNextPass();
+            return true;
+        });
+}
+
+bool TechniqueDefinition::AcceptEndPass(std::string& errorMessage)
+{
+    m_recorded_calls.emplace_back(
+        [](ITechniqueDefinitionAcceptor& acceptor, std::string& replayErrorMessage)
+        {
+            return acceptor.AcceptEndPass(replayErrorMessage);
+        });
+
+    return true;
+}
+
+bool TechniqueDefinition::AcceptStateMap(const std::string& stateMapName, std::string& errorMessage)
+{
+    m_recorded_calls.emplace_back(
+        [stateMapName](ITechniqueDefinitionAcceptor& acceptor, std::string& replayErrorMessage)
+        {
+            return acceptor.AcceptStateMap(stateMapName, replayErrorMessage);
+        });
+
+    return true;
+}
+
+bool TechniqueDefinition::AcceptVertexShader(const std::string& vertexShaderName, std::string& errorMessage)
+{
+    m_recorded_calls.emplace_back(
+        [vertexShaderName](ITechniqueDefinitionAcceptor& acceptor, std::string& replayErrorMessage)
+        {
+            return acceptor.AcceptVertexShader(vertexShaderName, replayErrorMessage);
+        });
+
+    return true;
+}
+
+bool TechniqueDefinition::AcceptPixelShader(const std::string& pixelShaderName, std::string& errorMessage)
+{
+    m_recorded_calls.emplace_back(
+        [pixelShaderName](ITechniqueDefinitionAcceptor& acceptor, std::string& replayErrorMessage)
+        {
+            return acceptor.AcceptPixelShader(pixelShaderName, replayErrorMessage);
+        });
+
+    return true;
+}
+
+bool TechniqueDefinition::AcceptShaderConstantArgument(const ShaderSelector shader,
+                                                       ShaderArgument shaderArgument,
+                                                       ShaderArgumentCodeSource source,
+                                                       std::string& errorMessage)
+{
+    m_recorded_calls.emplace_back(
+        [shader, shaderArgument = std::move(shaderArgument), source = std::move(source)](ITechniqueDefinitionAcceptor& acceptor,
+                                                                                          std::string& replayErrorMessage)
+        {
+            return acceptor.AcceptShaderConstantArgument(shader, shaderArgument, source, replayErrorMessage);
+        });
+
+    return true;
+}
+
+bool TechniqueDefinition::AcceptShaderSamplerArgument(const ShaderSelector shader,
+                                                      ShaderArgument shaderArgument,
+                                                      ShaderArgumentCodeSource source,
+                                                      std::string& errorMessage)
+{
+    m_recorded_calls.emplace_back(
+        [shader, shaderArgument = std::move(shaderArgument), source = std::move(source)](ITechniqueDefinitionAcceptor& acceptor,
+                                                                                          std::string& replayErrorMessage)
+        {
+            return acceptor.AcceptShaderSamplerArgument(shader, shaderArgument, source, replayErrorMessage);
+        });
+
+    return true;
+}
+
+bool TechniqueDefinition::AcceptShaderLiteralArgument(const ShaderSelector shader,
+                                                      ShaderArgument shaderArgument,
+                                                      const ShaderArgumentLiteralSource source,
+                                                      std::string& errorMessage)
+{
+    m_recorded_calls.emplace_back(
+        [shader, shaderArgument = std::move(shaderArgument), source](ITechniqueDefinitionAcceptor& acceptor, std::string& replayErrorMessage)
+        {
+            return acceptor.AcceptShaderLiteralArgument(shader, shaderArgument, source, replayErrorMessage);
+        });
+
+    return true;
+}
+
+bool TechniqueDefinition::AcceptShaderMaterialArgument(const ShaderSelector shader,
+                                                       ShaderArgument shaderArgument,
+                                                       ShaderArgumentMaterialSource source,
+                                                       std::string& errorMessage)
+{
+    m_recorded_calls.emplace_back(
+        [shader, shaderArgument = std::move(shaderArgument), source = std::move(source)](ITechniqueDefinitionAcceptor& acceptor,
+                                                                                          std::string& replayErrorMessage)
+        {
+            return acceptor.AcceptShaderMaterialArgument(shader, shaderArgument, source, replayErrorMessage);
+        });
+
+    return true;
+}
+
+bool TechniqueDefinition::AcceptVertexStreamRouting(const std::string& destination, const std::string& source, std::string& errorMessage)
+{
+    m_recorded_calls.emplace_back(
+        [destination, source](ITechniqueDefinitionAcceptor& acceptor, std::string& replayErrorMessage)
+        {
+            return acceptor.AcceptVertexStreamRouting(destination, source, replayErrorMessage);
+        });
+
+    return true;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "TechniqueDefinitionAcceptor.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace techset
+{
+    /**
+     * \brief A parsed technique file that does not depend on any zone.
+     * It records everything it accepts from a TechniqueFileReader and can pass it on to any number of other acceptors
+     * to materialise the technique in different zones without parsing the technique file again.
+     */
+    class TechniqueDefinition final : public ITechniqueDefinitionAcceptor
+    {
+        std::vector<std::function<bool(ITechniqueDefinitionAcceptor& acceptor, std::string& errorMessage)>> m_recorded_calls;
+
+    public:
+        /**
+         * \brief Passes everything this definition accepted on to the specified acceptor in the same order.
+         * \param acceptor The acceptor to pass the definition on to.
+         * \param errorMessage The error message of the acceptor if it did not accept the definition.
+         * \return \c true if the acceptor accepted everything, \c false otherwise.
+         */
+        bool Replay(ITechniqueDefinitionAcceptor& acceptor, std::string& errorMessage) const;
+
+        void AcceptNextPass() override;
+        bool AcceptEndPass(std::string& errorMessage) override;
+
+        bool AcceptStateMap(const std::string& stateMapName, std::string& errorMessage) override;
+
+        bool AcceptVertexShader(const std::string& vertexShaderName, std::string& errorMessage) override;
+        bool AcceptPixelShader(const std::string& pixelShaderName, std::string& errorMessage) override;
+
+        bool AcceptShaderConstantArgument(ShaderSelector shader,
+                                          ShaderArgument shaderArgument,
+                                          ShaderArgumentCodeSource source,
+                                          std::string& errorMessage) override;
+        bool AcceptShaderSamplerArgument(ShaderSelector shader,
+                                         ShaderArgument shaderArgument,
+                                         ShaderArgumentCodeSource source,
+                                         std::string& errorMessage) override;
+        bool AcceptShaderLiteralArgument(ShaderSelector shader,
+                                         ShaderArgument shaderArgument,
+                                         ShaderArgumentLiteralSource source,
+                                         std::string& errorMessage) override;
+        bool AcceptShaderMaterialArgument(ShaderSelector shader,
+                                          ShaderArgument shaderArgument,
+                                          ShaderArgumentMaterialSource source,
+                                          std::string& errorMessage) override;
+
+        bool AcceptVertexStreamRouting(const std::string& destination, const std::string& source, std::string& errorMessage) override;
+    };
+} // namespace techset
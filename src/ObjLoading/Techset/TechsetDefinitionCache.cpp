@@ -2,7 +2,7 @@
 
 using namespace techset;
 
-TechsetDefinition* TechsetDefinitionCache::GetCachedTechsetDefinition(const std::string& techsetName) const
+const TechsetDefinition* TechsetDefinitionCache::GetCachedTechsetDefinition(const std::string& techsetName) const
 {
     const auto foundTechset = m_cache.find(techsetName);
 
@@ -12,7 +12,7 @@ TechsetDefinition* TechsetDefinitionCache::GetCachedTechsetDefinition(const std:
     return nullptr;
 }
 
-void TechsetDefinitionCache::AddTechsetDefinitionToCache(std::string name, std::unique_ptr<TechsetDefinition> definition)
+void TechsetDefinitionCache::AddTechsetDefinitionToCache(std::string name, std::shared_ptr<const TechsetDefinition> definition)
 {
     m_cache.emplace(std::make_pair(std::move(name), std::move(definition)));
 }
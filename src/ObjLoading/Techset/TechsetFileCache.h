@@ -0,0 +1,98 @@
+#pragma once
+
+#include "SearchPath/ISearchPath.h"
+#include "Utils/ClassUtils.h"
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+namespace techset
+{
+    /**
+     * \brief Keeps parsed techset related files for the whole session so that zones using the same files do not need to parse them again.
+     * Files are identified by their name and content, so a file that changed or that is found at a different location for another zone is parsed again.
+     * Can be used from multiple threads at once.
+     * \tparam T The type of the parsed definitions. Definitions are shared between zones and must not be modified after parsing.
+     */
+    template<typename T> class TechsetFileCache
+    {
+        static constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325u;
+        static constexpr uint64_t FNV_PRIME = 0x100000001B3u;
+
+        class CachedFile
+        {
+        public:
+            uint64_t m_hash;
+            size_t m_size;
+            std::shared_ptr<const T> m_definition;
+        };
+
+        std::unordered_map<std::string, CachedFile> m_cached_files;
+        std::mutex m_mutex;
+
+        static uint64_t HashData(const std::string& data)
+        {
+            auto hash = FNV_OFFSET_BASIS;
+            for (const auto c : data)
+            {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= FNV_PRIME;
+            }
+
+            return hash;
+        }
+
+    public:
+        TechsetFileCache() = default;
+        ~TechsetFileCache() = default;
+        TechsetFileCache(const TechsetFileCache& other) = delete;
+        TechsetFileCache(TechsetFileCache&& other) noexcept = delete;
+        TechsetFileCache& operator=(const TechsetFileCache& other) = delete;
+        TechsetFileCache& operator=(TechsetFileCache&& other) noexcept = delete;
+
+        /**
+         * \brief Returns the definition of a file, only parsing it when a file with the same name and content has not been parsed before.
+         * \param searchPath The search path to read the file from.
+         * \param fileName The name of the file.
+         * \param parse Parses the file from the specified stream. Returns \c nullptr when the file could not be parsed.
+         * \return The parsed definition or \c nullptr if the file does not exist or could not be parsed.
+         */
+        std::shared_ptr<const T>
+            GetDefinition(ISearchPath* searchPath, const std::string& fileName, const std::function<std::unique_ptr<T>(std::istream& stream)>& parse)
+        {
+            const auto file = searchPath->Open(fileName);
+            if (!file.IsOpen())
+                return nullptr;
+
+            // Reading the file is cheap compared to parsing it and allows detecting changed files without relying on file modification times
+            std::ostringstream data;
+            data << file.m_stream->rdbuf();
+            auto fileData = std::move(data).str();
+            const auto hash = HashData(fileData);
+            const auto size = fileData.size();
+
+            {
+                std::lock_guard lock(m_mutex);
+                const auto cachedFile = m_cached_files.find(fileName);
+                if (cachedFile != m_cached_files.end() && cachedFile->second.m_hash == hash && cachedFile->second.m_size == size)
+                    return cachedFile->second.m_definition;
+            }
+
+            std::istringstream stream(std::move(fileData));
+            std::shared_ptr<const T> definition = parse(stream);
+            if (!definition)
+                return nullptr;
+
+            std::lock_guard lock(m_mutex);
+            m_cached_files.insert_or_assign(fileName, CachedFile{hash, size, definition});
+
+            return definition;
+        }
+    };
+} // namespace techset
@@ -2,7 +2,9 @@
 
 #include "GltfInput.h"
 
+#include <cstdint>
 #include <istream>
+#include <memory>
 
 namespace gltf
 {
@@ -12,15 +14,26 @@ namespace gltf
         BinInput();
 
         bool ReadGltfData(std::istream& stream) override;
+
+        /**
+         * \brief Reads GLB data that is already in memory. The binary chunk is used in place instead of being copied.
+         * \param data The GLB data. It must stay valid for as long as the embedded buffer is used.
+         * \param dataSize The size of the GLB data in bytes.
+         * \return \c true if the data could be read, otherwise \c false.
+         */
+        bool ReadGltfData(const void* data, size_t dataSize);
         bool GetEmbeddedBuffer(const void*& buffer, size_t& bufferSize) const override;
         [[nodiscard]] const nlohmann::json& GetJson() const override;
 
     private:
         static bool Read(std::istream& stream, void* dest, size_t dataSize, const char* readTypeName, bool errorWhenFailed = true);
         static void Skip(std::istream& stream, size_t skipLength);
+        static bool VerifyHeader(uint32_t magic, uint32_t version);
+        bool ParseJson(const uint8_t* jsonData, size_t jsonSize);
 
         std::unique_ptr<nlohmann::json> m_json;
-        std::unique_ptr<uint8_t[]> m_buffer;
+        std::unique_ptr<uint8_t[]> m_owned_buffer;
+        const uint8_t* m_buffer;
         size_t m_buffer_size;
     };
 } // namespace gltf
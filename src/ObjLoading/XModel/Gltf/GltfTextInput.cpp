@@ -1,5 +1,7 @@
 #include "GltfTextInput.h"
 
+#include "Json/JsonInput.h"
+
 #include <exception>
 #include <format>
 #include <iostream>
@@ -35,7 +37,7 @@ bool TextInput::ReadGltfData(std::istream& stream)
 {
     try
     {
-        m_json = std::make_unique<nlohmann::json>(nlohmann::json::parse(stream));
+        m_json = std::make_unique<nlohmann::json>(json_input::Parse(stream));
 
         return true;
     }
@@ -0,0 +1,325 @@
+#include "MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace mesh_optimizer
+{
+    constexpr size_t VERTEX_CACHE_SIZE = 32u;
+    constexpr float CACHE_DECAY_POWER = 1.5f;
+    constexpr float LAST_TRI_SCORE = 0.75f;
+    constexpr float VALENCE_BOOST_SCALE = 2.0f;
+    constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+    constexpr auto NOT_IN_CACHE = std::numeric_limits<size_t>::max();
+    constexpr auto NO_TRI = std::numeric_limits<size_t>::max();
+
+    typedef float tvec3[3];
+
+    float CalculateVertexScore(const size_t cachePosition, const uint32_t remainingTris)
+    {
+        // Vertices without tris left to add do not matter anymore
+        if (remainingTris == 0u)
+            return -1.0f;
+
+        auto score = 0.0f;
+        if (cachePosition != NOT_IN_CACHE)
+        {
+            // The vertices of the last tri get a fixed score to not favour using the same vertices in a row to make sure tris are added in strips
+            if (cachePosition < 3u)
+                score = LAST_TRI_SCORE;
+            else
+            {
+                const auto scaler = 1.0f / static_cast<float>(VERTEX_CACHE_SIZE - 3u);
+                score = std::pow(1.0f - static_cast<float>(cachePosition - 3u) * scaler, CACHE_DECAY_POWER);
+            }
+        }
+
+        // Vertices with few tris left are preferred to get rid of them early instead of leaving single tris behind
+        score += VALENCE_BOOST_SCALE * std::pow(static_cast<float>(remainingTris), -VALENCE_BOOST_POWER);
+
+        return score;
+    }
+
+    const tvec3& GetVec3(const void* data, const size_t index, const size_t stride)
+    {
+        return *reinterpret_cast<const tvec3*>(static_cast<const char*>(data) + stride * index);
+    }
+
+    void OptimizeVertexCache(uint16_t* triData, const size_t triCount, const size_t vertexCount)
+    {
+        if (triCount == 0u)
+            return;
+
+        const auto indexCount = triCount * 3u;
+
+        std::vector<uint32_t> remainingTris(vertexCount, 0u);
+        for (auto i = 0u; i < indexCount; i++)
+            remainingTris[triData[i]]++;
+
+        // The tris of every vertex that were not added yet are kept at the start of its range of the adjacency
+        std::vector<size_t> adjacencyOffsets(vertexCount + 1u, 0u);
+        std::inclusive_scan(remainingTris.begin(), remainingTris.end(), adjacencyOffsets.begin() + 1);
+
+        std::vector<size_t> adjacency(indexCount);
+        {
+            std::vector<size_t> adjacencyTails(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+            for (auto i = 0u; i < indexCount; i++)
+                adjacency[adjacencyTails[triData[i]]++] = i / 3u;
+        }
+
+        std::vector<size_t> cachePositions(vertexCount, NOT_IN_CACHE);
+        std::vector<float> vertexScores(vertexCount);
+        for (auto vertexIndex = 0u; vertexIndex < vertexCount; vertexIndex++)
+            vertexScores[vertexIndex] = CalculateVertexScore(NOT_IN_CACHE, remainingTris[vertexIndex]);
+
+        std::vector<float> triScores(triCount);
+        std::vector<bool> triAdded(triCount, false);
+        auto bestTri = NO_TRI;
+        auto bestScore = -1.0f;
+        for (auto triIndex = 0u; triIndex < triCount; triIndex++)
+        {
+            const auto* tri = &triData[triIndex * 3u];
+            triScores[triIndex] = vertexScores[tri[0]] + vertexScores[tri[1]] + vertexScores[tri[2]];
+            if (triScores[triIndex] > bestScore)
+            {
+                bestScore = triScores[triIndex];
+                bestTri = triIndex;
+            }
+        }
+
+        std::vector<uint16_t> sortedTris;
+        sortedTris.reserve(indexCount);
+        std::vector<uint16_t> cache;
+        std::vector<uint16_t> newCache;
+        cache.reserve(VERTEX_CACHE_SIZE + 3u);
+        newCache.reserve(VERTEX_CACHE_SIZE + 3u);
+
+        size_t nextUnaddedTri = 0u;
+        for (auto addedTriCount = 0u; addedTriCount < triCount; addedTriCount++)
+        {
+            // When no tri uses a vertex of the cache anymore, the next tri in source order is used
+            if (bestTri == NO_TRI)
+            {
+                while (triAdded[nextUnaddedTri])
+                    nextUnaddedTri++;
+                bestTri = nextUnaddedTri;
+            }
+
+            triAdded[bestTri] = true;
+            const auto* tri = &triData[bestTri * 3u];
+            sortedTris.insert(sortedTris.end(), tri, tri + 3u);
+
+            newCache.clear();
+            for (auto triVertexIndex = 0u; triVertexIndex < 3u; triVertexIndex++)
+            {
+                const auto vertexIndex = tri[triVertexIndex];
+
+                const auto adjacencyBegin = adjacency.begin() + static_cast<ptrdiff_t>(adjacencyOffsets[vertexIndex]);
+                const auto adjacencyEnd = adjacencyBegin + remainingTris[vertexIndex];
+                const auto addedTriEntry = std::find(adjacencyBegin, adjacencyEnd, bestTri);
+                std::iter_swap(addedTriEntry, adjacencyEnd - 1);
+                remainingTris[vertexIndex]--;
+
+                if (std::ranges::find(newCache, vertexIndex) == newCache.end())
+                    newCache.push_back(vertexIndex);
+            }
+
+            const auto triVertexCount = newCache.size();
+            for (const auto cachedVertexIndex : cache)
+            {
+                if (std::find(newCache.begin(), newCache.begin() + static_cast<ptrdiff_t>(triVertexCount), cachedVertexIndex)
+                    == newCache.begin() + static_cast<ptrdiff_t>(triVertexCount))
+                    newCache.push_back(cachedVertexIndex);
+            }
+
+            for (auto cachePosition = 0u; cachePosition < newCache.size(); cachePosition++)
+            {
+                const auto vertexIndex = newCache[cachePosition];
+                cachePositions[vertexIndex] = cachePosition < VERTEX_CACHE_SIZE ? cachePosition : NOT_IN_CACHE;
+                vertexScores[vertexIndex] = CalculateVertexScore(cachePositions[vertexIndex], remainingTris[vertexIndex]);
+            }
+
+            // Only tris of vertices whose score changed need to be scored again, which includes vertices that were just evicted from the cache
+            bestTri = NO_TRI;
+            bestScore = -1.0f;
+            for (const auto vertexIndex : newCache)
+            {
+                const auto adjacencyOffset = adjacencyOffsets[vertexIndex];
+                for (auto adjacencyIndex = 0u; adjacencyIndex < remainingTris[vertexIndex]; adjacencyIndex++)
+                {
+                    const auto triIndex = adjacency[adjacencyOffset + adjacencyIndex];
+                    const auto* adjacentTri = &triData[triIndex * 3u];
+                    triScores[triIndex] = vertexScores[adjacentTri[0]] + vertexScores[adjacentTri[1]] + vertexScores[adjacentTri[2]];
+
+                    if (triScores[triIndex] > bestScore)
+                    {
+                        bestScore = triScores[triIndex];
+                        bestTri = triIndex;
+                    }
+                }
+            }
+
+            if (newCache.size() > VERTEX_CACHE_SIZE)
+                newCache.resize(VERTEX_CACHE_SIZE);
+            std::swap(cache, newCache);
+        }
+
+        std::ranges::copy(sortedTris, triData);
+    }
+
+    void OptimizeOverdraw(uint16_t* triData, const size_t triCount, const void* positionData, const size_t positionDataStride)
+    {
+        if (triCount < 2u)
+            return;
+
+        // A cluster starts whenever a tri misses the cache with all of its vertices, so moving clusters around does not cost additional cache misses
+        std::vector<size_t> clusterStarts;
+        std::vector<uint16_t> cache;
+        cache.reserve(VERTEX_CACHE_SIZE + 3u);
+        for (auto triIndex = 0u; triIndex < triCount; triIndex++)
+        {
+            const auto* tri = &triData[triIndex * 3u];
+
+            auto cacheMisses = 0u;
+            for (auto triVertexIndex = 0u; triVertexIndex < 3u; triVertexIndex++)
+            {
+                const auto existingEntry = std::ranges::find(cache, tri[triVertexIndex]);
+                if (existingEntry == cache.end())
+                    cacheMisses++;
+                else
+                    cache.erase(existingEntry);
+                cache.insert(cache.begin(), tri[triVertexIndex]);
+            }
+
+            if (cache.size() > VERTEX_CACHE_SIZE)
+                cache.resize(VERTEX_CACHE_SIZE);
+
+            if (cacheMisses == 3u)
+                clusterStarts.push_back(triIndex);
+        }
+
+        const auto clusterCount = clusterStarts.size();
+        if (clusterCount < 2u)
+            return;
+        clusterStarts.push_back(triCount);
+
+        // Centroids and normals are weighted by the area of the tris
+        std::vector<float> clusterCentroids(clusterCount * 3u, 0.0f);
+        std::vector<float> clusterNormals(clusterCount * 3u, 0.0f);
+        std::vector<float> clusterAreas(clusterCount, 0.0f);
+        tvec3 meshCentroid{0.0f, 0.0f, 0.0f};
+        auto meshArea = 0.0f;
+        for (auto clusterIndex = 0u; clusterIndex < clusterCount; clusterIndex++)
+        {
+            auto* centroid = &clusterCentroids[clusterIndex * 3u];
+            auto* normal = &clusterNormals[clusterIndex * 3u];
+            for (auto triIndex = clusterStarts[clusterIndex]; triIndex < clusterStarts[clusterIndex + 1u]; triIndex++)
+            {
+                const auto& p0 = GetVec3(positionData, triData[triIndex * 3u + 0u], positionDataStride);
+                const auto& p1 = GetVec3(positionData, triData[triIndex * 3u + 1u], positionDataStride);
+                const auto& p2 = GetVec3(positionData, triData[triIndex * 3u + 2u], positionDataStride);
+
+                const tvec3 edge0{p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+                const tvec3 edge1{p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]};
+                const tvec3 cross{
+                    edge0[1] * edge1[2] - edge0[2] * edge1[1],
+                    edge0[2] * edge1[0] - edge0[0] * edge1[2],
+                    edge0[0] * edge1[1] - edge0[1] * edge1[0],
+                };
+                const auto area = std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]) * 0.5f;
+
+                for (auto axis = 0u; axis < 3u; axis++)
+                {
+                    centroid[axis] += (p0[axis] + p1[axis] + p2[axis]) / 3.0f * area;
+                    normal[axis] += cross[axis];
+                }
+                clusterAreas[clusterIndex] += area;
+            }
+
+            for (auto axis = 0u; axis < 3u; axis++)
+                meshCentroid[axis] += centroid[axis];
+            meshArea += clusterAreas[clusterIndex];
+
+            if (clusterAreas[clusterIndex] > 0.0f)
+            {
+                for (auto axis = 0u; axis < 3u; axis++)
+                    centroid[axis] /= clusterAreas[clusterIndex];
+            }
+        }
+
+        if (meshArea <= 0.0f)
+            return;
+
+        for (auto& axis : meshCentroid)
+            axis /= meshArea;
+
+        // Clusters that face away from the center are likely to be in front of other clusters of the same mesh
+        std::vector<float> clusterSortKeys(clusterCount);
+        for (auto clusterIndex = 0u; clusterIndex < clusterCount; clusterIndex++)
+        {
+            const auto* centroid = &clusterCentroids[clusterIndex * 3u];
+            const auto* normal = &clusterNormals[clusterIndex * 3u];
+            const auto normalLength = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+            if (normalLength <= 0.0f)
+            {
+                clusterSortKeys[clusterIndex] = 0.0f;
+                continue;
+            }
+
+            auto sortKey = 0.0f;
+            for (auto axis = 0u; axis < 3u; axis++)
+                sortKey += (centroid[axis] - meshCentroid[axis]) * normal[axis];
+            clusterSortKeys[clusterIndex] = sortKey / normalLength;
+        }
+
+        std::vector<size_t> clusterOrder(clusterCount);
+        std::iota(clusterOrder.begin(), clusterOrder.end(), 0u);
+        std::ranges::stable_sort(clusterOrder,
+                                 [&clusterSortKeys](const size_t clusterIndex0, const size_t clusterIndex1)
+                                 {
+                                     return clusterSortKeys[clusterIndex0] > clusterSortKeys[clusterIndex1];
+                                 });
+
+        std::vector<uint16_t> sortedTris;
+        sortedTris.reserve(triCount * 3u);
+        for (const auto clusterIndex : clusterOrder)
+            sortedTris.insert(sortedTris.end(), &triData[clusterStarts[clusterIndex] * 3u], &triData[clusterStarts[clusterIndex + 1u] * 3u]);
+
+        std::ranges::copy(sortedTris, triData);
+    }
+
+    std::vector<size_t>
+        CreateVertexFetchOrder(const uint16_t* triData, const size_t triCount, const size_t vertexCount, const std::span<const size_t> vertexRangeEnds)
+    {
+        std::vector<size_t> vertexRanges(vertexCount, vertexRangeEnds.size());
+        size_t rangeBegin = 0u;
+        for (auto rangeIndex = 0u; rangeIndex < vertexRangeEnds.size(); rangeIndex++)
+        {
+            const auto rangeEnd = std::min(vertexRangeEnds[rangeIndex], vertexCount);
+            for (auto vertexIndex = rangeBegin; vertexIndex < rangeEnd; vertexIndex++)
+                vertexRanges[vertexIndex] = rangeIndex;
+            rangeBegin = std::max(rangeBegin, rangeEnd);
+        }
+
+        // Vertices that are not used by any tri keep their order at the end of their range
+        std::vector<size_t> firstUses(vertexCount, std::numeric_limits<size_t>::max());
+        for (auto i = triCount * 3u; i > 0u; i--)
+            firstUses[triData[i - 1u]] = i - 1u;
+
+        std::vector<size_t> vertexOrder(vertexCount);
+        std::iota(vertexOrder.begin(), vertexOrder.end(), 0u);
+        std::ranges::stable_sort(vertexOrder,
+                                 [&vertexRanges, &firstUses](const size_t vertexIndex0, const size_t vertexIndex1)
+                                 {
+                                     if (vertexRanges[vertexIndex0] != vertexRanges[vertexIndex1])
+                                         return vertexRanges[vertexIndex0] < vertexRanges[vertexIndex1];
+
+                                     return firstUses[vertexIndex0] < firstUses[vertexIndex1];
+                                 });
+
+        return vertexOrder;
+    }
+} // namespace mesh_optimizer
@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include <cstdlib>
+#include <span>
+#include <vector>
+
+namespace mesh_optimizer
+{
+    /**
+     * \brief Reorders tris to make use of the post transform vertex cache of the gpu as much as possible using Tom Forsyth's linear speed vertex cache
+     * optimisation. The vertices of a tri keep their order so its winding does not change.
+     * \param triData The three vertex indices of every tri.
+     * \param triCount The amount of tris to reorder.
+     * \param vertexCount The amount of vertices the tris refer to.
+     */
+    void OptimizeVertexCache(uint16_t* triData, size_t triCount, size_t vertexCount);
+
+    /**
+     * \brief Reorders clusters of tris that were optimised for the vertex cache, so tris facing away from the center of the mesh are drawn first and occlude
+     * tris behind them. Clusters start at tris that do not hit the vertex cache at all, so the vertex cache efficiency is kept.
+     * \param triData The three vertex indices of every tri.
+     * \param triCount The amount of tris to reorder.
+     * \param positionData The position of the first vertex as three floats.
+     * \param positionDataStride The amount of bytes between the positions of two vertices.
+     */
+    void OptimizeOverdraw(uint16_t* triData, size_t triCount, const void* positionData, size_t positionDataStride);
+
+    /**
+     * \brief Creates an order of vertices in which they are first used by the tris, so the gpu fetches vertex data as linearly as possible.
+     * \param triData The three vertex indices of every tri.
+     * \param triCount The amount of tris.
+     * \param vertexCount The amount of vertices.
+     * \param vertexRangeEnds The exclusive ends of consecutive ranges of vertices. Vertices are only moved within their range. Vertices after the last range
+     * are treated as one more range.
+     * \return The index of the vertex that should be moved to each position.
+     */
+    std::vector<size_t> CreateVertexFetchOrder(const uint16_t* triData, size_t triCount, size_t vertexCount, std::span<const size_t> vertexRangeEnds);
+} // namespace mesh_optimizer
@@ -1,12 +1,19 @@
 #include "Tangentspace.h"
 
+#include "Utils/JobSystem.h"
+
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <functional>
+#include <memory>
 #include <numbers>
+#include <vector>
 
 namespace tangent_space
 {
-    constexpr float NULL_VEC3[3]{0, 0, 0};
+    constexpr size_t TRIS_PER_ACCUMULATION_CHUNK = 16384u;
+    constexpr size_t MIN_VERTICES_PER_FINALIZE_JOB = 4096u;
 
     typedef float tvec2[2];
     typedef float tvec3[3];
@@ -167,16 +174,52 @@ namespace tangent_space
         Vec3_Normalize(a2);
     }
 
-    void CalculateTangentSpace(const VertexData& vertexData, const size_t triCount, const size_t vertexCount)
+    /**
+     * \brief Sums of the weighted tangents and binormals of the triangles adjacent to each vertex.
+     * Each component is kept in its own array to allow merging and finalizing vertices in vectorized loops.
+     */
+    class TangentAccumulator
     {
-        // Set tangents and binormals to 0
-        for (auto vertexIndex = 0u; vertexIndex < vertexCount; vertexIndex++)
+    public:
+        explicit TangentAccumulator(const size_t vertexCount)
+            : m_tangent{std::vector<float>(vertexCount), std::vector<float>(vertexCount), std::vector<float>(vertexCount)},
+              m_binormal{std::vector<float>(vertexCount), std::vector<float>(vertexCount), std::vector<float>(vertexCount)}
+        {
+        }
+
+        void Add(const uint16_t index, const tvec3& tangent, const tvec3& binormal, const float exteriorAngle)
+        {
+            for (auto component = 0u; component < 3u; component++)
+            {
+                m_tangent[component][index] = tangent[component] * exteriorAngle + m_tangent[component][index];
+                m_binormal[component][index] = binormal[component] * exteriorAngle + m_binormal[component][index];
+            }
+        }
+
+        void Merge(const TangentAccumulator& other, const size_t vertexBegin, const size_t vertexEnd)
         {
-            SetVec3(vertexData.tangentData, vertexIndex, vertexData.tangentDataStride, NULL_VEC3);
-            SetVec3(vertexData.binormalData, vertexIndex, vertexData.binormalDataStride, NULL_VEC3);
+            for (auto component = 0u; component < 3u; component++)
+            {
+                auto* tangent = m_tangent[component].data();
+                auto* binormal = m_binormal[component].data();
+                const auto* otherTangent = other.m_tangent[component].data();
+                const auto* otherBinormal = other.m_binormal[component].data();
+
+                for (auto vertexIndex = vertexBegin; vertexIndex < vertexEnd; vertexIndex++)
+                {
+                    tangent[vertexIndex] += otherTangent[vertexIndex];
+                    binormal[vertexIndex] += otherBinormal[vertexIndex];
+                }
+            }
         }
 
-        for (auto triIndex = 0u; triIndex < triCount; triIndex++)
+        std::vector<float> m_tangent[3];
+        std::vector<float> m_binormal[3];
+    };
+
+    void AccumulateTriangles(const VertexData& vertexData, TangentAccumulator& accumulator, const size_t triBegin, const size_t triEnd)
+    {
+        for (auto triIndex = triBegin; triIndex < triEnd; triIndex++)
         {
             const auto i0 = vertexData.triData[triIndex * 3u + 0u];
             const auto i1 = vertexData.triData[triIndex * 3u + 1u];
@@ -185,19 +228,24 @@ namespace tangent_space
             tvec3 vector, cross, exteriorAngles;
             sub_10022E80(vertexData, i0, i1, i2, vector, cross);
             GetExteriorAnglesOfTri(vertexData, exteriorAngles, i0, i1, i2);
-            sub_10022CA0(i0, vertexData.tangentData, vector, exteriorAngles[0], vertexData.tangentDataStride);
-            sub_10022CA0(i1, vertexData.tangentData, vector, exteriorAngles[1], vertexData.tangentDataStride);
-            sub_10022CA0(i2, vertexData.tangentData, vector, exteriorAngles[2], vertexData.tangentDataStride);
-            sub_10022CA0(i0, vertexData.binormalData, cross, exteriorAngles[0], vertexData.binormalDataStride);
-            sub_10022CA0(i1, vertexData.binormalData, cross, exteriorAngles[1], vertexData.binormalDataStride);
-            sub_10022CA0(i2, vertexData.binormalData, cross, exteriorAngles[2], vertexData.binormalDataStride);
+            accumulator.Add(i0, vector, cross, exteriorAngles[0]);
+            accumulator.Add(i1, vector, cross, exteriorAngles[1]);
+            accumulator.Add(i2, vector, cross, exteriorAngles[2]);
         }
+    }
+
+    void FinalizeVertices(const VertexData& vertexData, std::vector<TangentAccumulator>& accumulators, const size_t vertexBegin, const size_t vertexEnd)
+    {
+        // Chunks are always merged in the same order to not make the result depend on the amount of threads
+        auto& sum = accumulators[0];
+        for (auto chunkIndex = 1u; chunkIndex < accumulators.size(); chunkIndex++)
+            sum.Merge(accumulators[chunkIndex], vertexBegin, vertexEnd);
 
-        for (auto vertexIndex = 0u; vertexIndex < vertexCount; vertexIndex++)
+        for (auto vertexIndex = vertexBegin; vertexIndex < vertexEnd; vertexIndex++)
         {
             const auto& normal = GetVec3(vertexData.normalData, vertexIndex, vertexData.normalDataStride);
-            auto& tangent = GetVec3(vertexData.tangentData, vertexIndex, vertexData.tangentDataStride);
-            auto& binormal = GetVec3(vertexData.binormalData, vertexIndex, vertexData.binormalDataStride);
+            tvec3 tangent{sum.m_tangent[0][vertexIndex], sum.m_tangent[1][vertexIndex], sum.m_tangent[2][vertexIndex]};
+            tvec3 binormal{sum.m_binormal[0][vertexIndex], sum.m_binormal[1][vertexIndex], sum.m_binormal[2][vertexIndex]};
 
             const auto dot_normal_tangent = normal[0] * tangent[0] + normal[1] * tangent[1] + normal[2] * tangent[2];
 
@@ -226,6 +274,64 @@ namespace tangent_space
                 binormal[1] = -cross[1];
                 binormal[2] = -cross[2];
             }
+
+            SetVec3(vertexData.tangentData, vertexIndex, vertexData.tangentDataStride, tangent);
+            SetVec3(vertexData.binormalData, vertexIndex, vertexData.binormalDataStride, binormal);
+        }
+    }
+
+    void RunJobs(const size_t jobCount, const std::function<void(size_t jobIndex)>& job)
+    {
+        if (jobCount <= 1u)
+        {
+            for (auto jobIndex = 0u; jobIndex < jobCount; jobIndex++)
+                job(jobIndex);
+            return;
+        }
+
+        // Jobs only do arithmetic on memory that was allocated beforehand, so they cannot throw
+        JobSystem::TaskGroup group;
+        for (auto jobIndex = 0u; jobIndex < jobCount; jobIndex++)
+        {
+            group.Run(
+                [&job, jobIndex]
+                {
+                    job(jobIndex);
+                });
         }
+
+        group.Wait();
+    }
+
+    void CalculateTangentSpace(const VertexData& vertexData, const size_t triCount, const size_t vertexCount)
+    {
+        if (vertexCount == 0u)
+            return;
+
+        // The triangles are split into chunks of a fixed size that each sum up into their own accumulator.
+        // The chunk size must not depend on the amount of threads to always produce the same result.
+        const auto chunkCount = std::max<size_t>(1u, (triCount + TRIS_PER_ACCUMULATION_CHUNK - 1u) / TRIS_PER_ACCUMULATION_CHUNK);
+        const auto finalizeJobCount = std::min(JobSystem::Instance().GetThreadCount(), std::max<size_t>(1u, vertexCount / MIN_VERTICES_PER_FINALIZE_JOB));
+
+        std::vector<TangentAccumulator> accumulators;
+        accumulators.reserve(chunkCount);
+        for (auto chunkIndex = 0u; chunkIndex < chunkCount; chunkIndex++)
+            accumulators.emplace_back(vertexCount);
+
+        RunJobs(chunkCount,
+                [&vertexData, &accumulators, triCount](const size_t chunkIndex)
+                {
+                    const auto triBegin = chunkIndex * TRIS_PER_ACCUMULATION_CHUNK;
+                    const auto triEnd = std::min(triBegin + TRIS_PER_ACCUMULATION_CHUNK, triCount);
+                    AccumulateTriangles(vertexData, accumulators[chunkIndex], triBegin, triEnd);
+                });
+
+        RunJobs(finalizeJobCount,
+                [&vertexData, &accumulators, vertexCount, finalizeJobCount](const size_t jobIndex)
+                {
+                    const auto vertexBegin = vertexCount * jobIndex / finalizeJobCount;
+                    const auto vertexEnd = vertexCount * (jobIndex + 1u) / finalizeJobCount;
+                    FinalizeVertices(vertexData, accumulators, vertexBegin, vertexEnd);
+                });
     }
 } // namespace tangent_space
@@ -0,0 +1,227 @@
+#include "XModelBounds.h"
+
+#include "Utils/JobSystem.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace xmodel_bounds
+{
+    constexpr size_t VERTICES_PER_BOUNDS_CHUNK = 16384u;
+    constexpr size_t SAH_BIN_COUNT = 12u;
+
+    typedef float tvec3[3];
+
+    const tvec3& GetVec3(const void* data, const size_t index, const size_t stride)
+    {
+        return *reinterpret_cast<const tvec3*>(static_cast<const char*>(data) + stride * index);
+    }
+
+    void Aabb::Add(const float (&point)[3])
+    {
+        for (auto axis = 0u; axis < 3u; axis++)
+        {
+            mins[axis] = std::min(mins[axis], point[axis]);
+            maxs[axis] = std::max(maxs[axis], point[axis]);
+        }
+    }
+
+    void Aabb::Add(const Aabb& other)
+    {
+        for (auto axis = 0u; axis < 3u; axis++)
+        {
+            mins[axis] = std::min(mins[axis], other.mins[axis]);
+            maxs[axis] = std::max(maxs[axis], other.maxs[axis]);
+        }
+    }
+
+    float Aabb::GetSurfaceArea() const
+    {
+        const auto x = std::max(maxs[0] - mins[0], 0.0f);
+        const auto y = std::max(maxs[1] - mins[1], 0.0f);
+        const auto z = std::max(maxs[2] - mins[2], 0.0f);
+
+        return 2.0f * (x * y + y * z + z * x);
+    }
+
+    Aabb CreateEmptyBounds()
+    {
+        constexpr auto max = std::numeric_limits<float>::max();
+        return Aabb{
+            {max,  max,  max },
+            {-max, -max, -max},
+        };
+    }
+
+    Aabb CalculateVertexBounds(const void* positionData, const size_t positionDataStride, const size_t vertexCount)
+    {
+        // Every chunk is reduced on its own, the loops over plain floats are simple enough to be vectorised by the compiler
+        const auto chunkCount = (vertexCount + VERTICES_PER_BOUNDS_CHUNK - 1u) / VERTICES_PER_BOUNDS_CHUNK;
+        std::vector<Aabb> chunkBounds(chunkCount, CreateEmptyBounds());
+        JobSystem::Instance().ParallelFor(chunkCount,
+                                          1u,
+                                          [positionData, positionDataStride, vertexCount, &chunkBounds](const size_t begin, const size_t end)
+                                          {
+                                              for (auto chunkIndex = begin; chunkIndex < end; chunkIndex++)
+                                              {
+                                                  auto& bounds = chunkBounds[chunkIndex];
+                                                  const auto chunkEnd = std::min(vertexCount, (chunkIndex + 1u) * VERTICES_PER_BOUNDS_CHUNK);
+                                                  for (auto vertexIndex = chunkIndex * VERTICES_PER_BOUNDS_CHUNK; vertexIndex < chunkEnd; vertexIndex++)
+                                                      bounds.Add(GetVec3(positionData, vertexIndex, positionDataStride));
+                                              }
+                                          });
+
+        auto bounds = CreateEmptyBounds();
+        for (const auto& chunk : chunkBounds)
+            bounds.Add(chunk);
+
+        return bounds;
+    }
+
+    size_t GetSahBinIndex(const float centroid, const float centroidMin, const float binScale)
+    {
+        return std::min(static_cast<size_t>((centroid - centroidMin) * binScale), SAH_BIN_COUNT - 1u);
+    }
+
+    class SahBin
+    {
+    public:
+        Aabb m_bounds = CreateEmptyBounds();
+        size_t m_tri_count = 0u;
+    };
+
+    class SahSplit
+    {
+    public:
+        float m_cost = std::numeric_limits<float>::max();
+        size_t m_axis = 0u;
+        size_t m_bin = 0u;
+    };
+
+    std::vector<CollisionTreeNode> BuildCollisionTree(
+        uint16_t* triData, const size_t triCount, const void* positionData, const size_t positionDataStride, const size_t maxTrisPerLeaf)
+    {
+        std::vector<CollisionTreeNode> nodes;
+        if (triCount == 0u)
+            return nodes;
+
+        std::vector<Aabb> triBounds(triCount, CreateEmptyBounds());
+        std::vector<float> triCentroids(triCount * 3u);
+        for (auto triIndex = 0u; triIndex < triCount; triIndex++)
+        {
+            auto& bounds = triBounds[triIndex];
+            for (auto triVertexIndex = 0u; triVertexIndex < 3u; triVertexIndex++)
+                bounds.Add(GetVec3(positionData, triData[triIndex * 3u + triVertexIndex], positionDataStride));
+
+            for (auto axis = 0u; axis < 3u; axis++)
+                triCentroids[triIndex * 3u + axis] = (bounds.mins[axis] + bounds.maxs[axis]) * 0.5f;
+        }
+
+        std::vector<size_t> triOrder(triCount);
+        std::iota(triOrder.begin(), triOrder.end(), 0u);
+
+        nodes.emplace_back(CollisionTreeNode{CreateEmptyBounds(), 0u, 0u, triCount});
+
+        // Nodes that still need to be split are leafs with more tris than wanted
+        std::vector<size_t> pendingNodes{0u};
+        while (!pendingNodes.empty())
+        {
+            const auto nodeIndex = pendingNodes.back();
+            pendingNodes.pop_back();
+
+            const auto triBegin = nodes[nodeIndex].firstIndex;
+            const auto triEnd = triBegin + nodes[nodeIndex].triCount;
+
+            auto nodeBounds = CreateEmptyBounds();
+            auto centroidBounds = CreateEmptyBounds();
+            for (auto orderIndex = triBegin; orderIndex < triEnd; orderIndex++)
+            {
+                const auto triIndex = triOrder[orderIndex];
+                nodeBounds.Add(triBounds[triIndex]);
+                centroidBounds.Add(*reinterpret_cast<const tvec3*>(&triCentroids[triIndex * 3u]));
+            }
+            nodes[nodeIndex].bounds = nodeBounds;
+
+            if (triEnd - triBegin <= maxTrisPerLeaf)
+                continue;
+
+            SahSplit bestSplit;
+            for (auto axis = 0u; axis < 3u; axis++)
+            {
+                const auto centroidExtent = centroidBounds.maxs[axis] - centroidBounds.mins[axis];
+                if (centroidExtent <= 0.0f)
+                    continue;
+
+                SahBin bins[SAH_BIN_COUNT];
+                const auto binScale = static_cast<float>(SAH_BIN_COUNT) / centroidExtent;
+                for (auto orderIndex = triBegin; orderIndex < triEnd; orderIndex++)
+                {
+                    const auto triIndex = triOrder[orderIndex];
+                    const auto binIndex = GetSahBinIndex(triCentroids[triIndex * 3u + axis], centroidBounds.mins[axis], binScale);
+                    bins[binIndex].m_bounds.Add(triBounds[triIndex]);
+                    bins[binIndex].m_tri_count++;
+                }
+
+                // The cost of splitting after every bin is the surface area of both sides weighted by their amount of tris
+                float rightCosts[SAH_BIN_COUNT];
+                auto rightBounds = CreateEmptyBounds();
+                auto rightTriCount = 0u;
+                for (auto binIndex = SAH_BIN_COUNT - 1u; binIndex > 0u; binIndex--)
+                {
+                    rightBounds.Add(bins[binIndex].m_bounds);
+                    rightTriCount += bins[binIndex].m_tri_count;
+                    rightCosts[binIndex - 1u] = rightBounds.GetSurfaceArea() * static_cast<float>(rightTriCount);
+                }
+
+                auto leftBounds = CreateEmptyBounds();
+                auto leftTriCount = 0u;
+                for (auto binIndex = 0u; binIndex < SAH_BIN_COUNT - 1u; binIndex++)
+                {
+                    leftBounds.Add(bins[binIndex].m_bounds);
+                    leftTriCount += bins[binIndex].m_tri_count;
+                    if (leftTriCount == 0u || leftTriCount == triEnd - triBegin)
+                        continue;
+
+                    const auto cost = leftBounds.GetSurfaceArea() * static_cast<float>(leftTriCount) + rightCosts[binIndex];
+                    if (cost < bestSplit.m_cost)
+                        bestSplit = SahSplit{cost, axis, binIndex};
+                }
+            }
+
+            // Tris whose centroids are all in the same spot cannot be split
+            if (bestSplit.m_cost == std::numeric_limits<float>::max())
+                continue;
+
+            const auto splitAxis = bestSplit.m_axis;
+            const auto binScale = static_cast<float>(SAH_BIN_COUNT) / (centroidBounds.maxs[splitAxis] - centroidBounds.mins[splitAxis]);
+            const auto splitPoint = std::stable_partition(triOrder.begin() + static_cast<ptrdiff_t>(triBegin),
+                                                          triOrder.begin() + static_cast<ptrdiff_t>(triEnd),
+                                                          [&triCentroids, &centroidBounds, &bestSplit, splitAxis, binScale](const size_t triIndex)
+                                                          {
+                                                              const auto centroid = triCentroids[triIndex * 3u + splitAxis];
+                                                              return GetSahBinIndex(centroid, centroidBounds.mins[splitAxis], binScale) <= bestSplit.m_bin;
+                                                          });
+            const auto triMiddle = static_cast<size_t>(splitPoint - triOrder.begin());
+
+            const auto childIndex = nodes.size();
+            nodes.emplace_back(CollisionTreeNode{CreateEmptyBounds(), triBegin, 0u, triMiddle - triBegin});
+            nodes.emplace_back(CollisionTreeNode{CreateEmptyBounds(), triMiddle, 0u, triEnd - triMiddle});
+
+            auto& node = nodes[nodeIndex];
+            node.firstIndex = childIndex;
+            node.childCount = 2u;
+            node.triCount = 0u;
+
+            pendingNodes.emplace_back(childIndex + 1u);
+            pendingNodes.emplace_back(childIndex);
+        }
+
+        std::vector<uint16_t> sortedTris(triCount * 3u);
+        for (auto orderIndex = 0u; orderIndex < triCount; orderIndex++)
+            std::copy_n(&triData[triOrder[orderIndex] * 3u], 3u, &sortedTris[orderIndex * 3u]);
+        std::ranges::copy(sortedTris, triData);
+
+        return nodes;
+    }
+} // namespace xmodel_bounds
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Utils/ClassUtils.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace xmodel_bounds
+{
+    struct Aabb
+    {
+        float mins[3];
+        float maxs[3];
+
+        void Add(const float (&point)[3]);
+        void Add(const Aabb& other);
+        _NODISCARD float GetSurfaceArea() const;
+    };
+
+    struct CollisionTreeNode
+    {
+        Aabb bounds;
+
+        // The index of the first child node for inner nodes or the index of the first tri for leafs
+        size_t firstIndex;
+
+        // The amount of child nodes for inner nodes, 0 for leafs
+        size_t childCount;
+
+        // The amount of tris of leafs, 0 for inner nodes
+        size_t triCount;
+    };
+
+    /**
+     * \brief Creates bounds that contain no point at all. Adding the first point makes them the bounds of that point.
+     */
+    Aabb CreateEmptyBounds();
+
+    /**
+     * \brief Calculates the bounds of vertex positions. Large amounts of vertices are reduced in parallel.
+     * \param positionData The position of the first vertex as three floats.
+     * \param positionDataStride The amount of bytes between the positions of two vertices.
+     * \param vertexCount The amount of vertices.
+     * \return The bounds of all vertices. Empty bounds when there are no vertices.
+     */
+    Aabb CalculateVertexBounds(const void* positionData, size_t positionDataStride, size_t vertexCount);
+
+    /**
+     * \brief Builds a bounding volume hierarchy over tris that is split using the surface area heuristic.
+     * Tris are reordered to make the tris of every leaf follow another. The relative order of tris within a leaf is kept.
+     * \param triData The three vertex indices of every tri.
+     * \param triCount The amount of tris.
+     * \param positionData The position of the first vertex as three floats.
+     * \param positionDataStride The amount of bytes between the positions of two vertices.
+     * \param maxTrisPerLeaf The amount of tris that are put into a leaf without trying to split them further.
+     * \return The nodes of the tree with the root node first. The children of an inner node follow another. Empty when there are no tris.
+     */
+    std::vector<CollisionTreeNode>
+        BuildCollisionTree(uint16_t* triData, size_t triCount, const void* positionData, size_t positionDataStride, size_t maxTrisPerLeaf);
+} // namespace xmodel_bounds
@@ -1,28 +1,139 @@
 #pragma once
 
+#include "AssetDumpManifest.h"
+#include "AssetNameFilter.h"
 #include "IAssetDumper.h"
+#include "Pool/AssetClosure.h"
+
+#include <exception>
+#include <mutex>
 
 template<class T> class AbstractAssetDumper : public IAssetDumper<T>
 {
+    void DumpPoolParallel(AssetDumpingContext& context, AssetPool<T>* pool)
+    {
+        std::mutex exceptionMutex;
+        std::exception_ptr exception;
+
+        for (auto assetInfo : *pool)
+        {
+            if (!ShouldDumpAsset(context, assetInfo))
+            {
+                continue;
+            }
+
+            if (IsUnchangedSinceLastDump(context, assetInfo))
+            {
+                context.ReportAssetDumped(assetInfo->m_name);
+                continue;
+            }
+
+            context.m_worker_pool->Enqueue(
+                [this, &context, assetInfo, &exceptionMutex, &exception]
+                {
+                    try
+                    {
+                        DumpAsset(context, assetInfo);
+                        context.ReportAssetDumped(assetInfo->m_name);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard lock(exceptionMutex);
+                        if (!exception)
+                            exception = std::current_exception();
+                    }
+                });
+        }
+
+        context.m_worker_pool->WaitForIdle();
+
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+    bool ShouldDumpAsset(const AssetDumpingContext& context, XAssetInfo<T>* asset)
+    {
+        // References to assets of other zones are never dumped
+        if (asset->m_name[0] == ',')
+            return false;
+
+        if (context.m_asset_name_filter && !context.m_asset_name_filter->ShouldDump(asset->m_name))
+            return false;
+
+        if (context.m_asset_closure && !context.m_asset_closure->Contains(asset))
+            return false;
+
+        return ShouldDump(asset);
+    }
+
+    bool IsUnchangedSinceLastDump(AssetDumpingContext& context, XAssetInfo<T>* asset)
+    {
+        // Only dumpers that can dump in parallel write files that depend on nothing but the asset itself.
+        // All others contribute to output that is shared with other assets. The gdt is shared as well and written again on every dump.
+        return context.m_dump_manifest && CanDumpAssetsInParallel() && OnlyDependsOnOwnAsset() && !(context.m_gdt && DumpsIntoGdt())
+               && context.m_dump_manifest->IsUnchanged(*asset);
+    }
+
 protected:
     virtual bool ShouldDump(XAssetInfo<T>* asset)
     {
         return true;
     }
 
+    /**
+     * \brief Whether assets of this type can be dumped from multiple threads at once.
+     * Dumpers must only opt in when dumping an asset does not touch any state shared with other assets,
+     * like the dumper itself or zone asset dumper states. Writing gdt entries is allowed.
+     * State that is shared anyway must be thread safe and zone asset dumper states must be created before dumping the pool.
+     */
+    virtual bool CanDumpAssetsInParallel()
+    {
+        return false;
+    }
+
+    /**
+     * \brief Whether the files written for an asset only depend on the asset itself, even when the dumper can dump assets in parallel.
+     * Only assets of dumpers that return \c true are skipped when they are unchanged since the last dump.
+     */
+    virtual bool OnlyDependsOnOwnAsset()
+    {
+        return true;
+    }
+
+    /**
+     * \brief Whether assets of this type are written as gdt entries instead of files when a gdt is available.
+     */
+    virtual bool DumpsIntoGdt()
+    {
+        return false;
+    }
+
     virtual void DumpAsset(AssetDumpingContext& context, XAssetInfo<T>* asset) = 0;
 
 public:
     void DumpPool(AssetDumpingContext& context, AssetPool<T>* pool) override
     {
+        if (context.m_worker_pool && CanDumpAssetsInParallel())
+        {
+            DumpPoolParallel(context, pool);
+            return;
+        }
+
         for (auto assetInfo : *pool)
         {
-            if (assetInfo->m_name[0] == ',' || !ShouldDump(assetInfo))
+            if (!ShouldDumpAsset(context, assetInfo))
+            {
+                continue;
+            }
+
+            if (IsUnchangedSinceLastDump(context, assetInfo))
             {
+                context.ReportAssetDumped(assetInfo->m_name);
                 continue;
             }
 
             DumpAsset(context, assetInfo);
+            context.ReportAssetDumped(assetInfo->m_name);
         }
     }
 };
@@ -0,0 +1,127 @@
+#include "AssetDumpManifest.h"
+
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr auto MANIFEST_FILE_HEADER = "OAT_DUMP_MANIFEST 1";
+    constexpr auto MANIFEST_KEY_ENVIRONMENT = "env";
+    constexpr auto MANIFEST_KEY_ASSET = "asset";
+} // namespace
+
+AssetDumpManifest::AssetDumpManifest()
+    : m_checked_count(0u),
+      m_unchanged_count(0u)
+{
+}
+
+void AssetDumpManifest::AddEnvironment(std::string value)
+{
+    m_environment.emplace_back(std::move(value));
+}
+
+bool AssetDumpManifest::Load(const fs::path& manifestFilePath)
+{
+    std::ifstream stream(manifestFilePath);
+    if (!stream.is_open())
+        return false;
+
+    std::string line;
+    if (!std::getline(stream, line) || line != MANIFEST_FILE_HEADER)
+        return false;
+
+    std::vector<std::string> environment;
+    std::map<std::pair<asset_type_t, std::string>, uint64_t> hashes;
+    while (std::getline(stream, line))
+    {
+        std::istringstream lineStream(line);
+        std::string key;
+        lineStream >> key;
+        lineStream.get();
+
+        std::string value;
+        if (key == MANIFEST_KEY_ENVIRONMENT)
+        {
+            std::getline(lineStream, value);
+            environment.emplace_back(std::move(value));
+        }
+        else if (key == MANIFEST_KEY_ASSET)
+        {
+            asset_type_t assetType;
+            uint64_t hash;
+            lineStream >> assetType >> std::hex >> hash;
+            lineStream.get();
+            std::getline(lineStream, value);
+
+            if (lineStream.fail() || value.empty())
+                return false;
+
+            hashes.insert_or_assign(std::make_pair(assetType, std::move(value)), hash);
+        }
+        else
+            return false;
+    }
+
+    if (environment != m_environment)
+        return false;
+
+    std::lock_guard lock(m_mutex);
+    m_previous_hashes = std::move(hashes);
+    return true;
+}
+
+bool AssetDumpManifest::IsUnchanged(const XAssetInfoGeneric& asset)
+{
+    m_checked_count++;
+
+    // Assets that were not hashed when loading the zone can never be considered unchanged
+    if (asset.m_content_hash == 0u)
+        return false;
+
+    auto key = std::make_pair(asset.m_type, asset.m_name);
+
+    std::lock_guard lock(m_mutex);
+    const auto previousHash = m_previous_hashes.find(key);
+    const auto isUnchanged = previousHash != m_previous_hashes.end() && previousHash->second == asset.m_content_hash;
+    m_current_hashes.insert_or_assign(std::move(key), asset.m_content_hash);
+
+    if (isUnchanged)
+        m_unchanged_count++;
+
+    return isUnchanged;
+}
+
+bool AssetDumpManifest::Save(const fs::path& manifestFilePath)
+{
+    std::error_code ec;
+    fs::create_directories(manifestFilePath.parent_path(), ec);
+    std::ofstream stream(manifestFilePath, std::fstream::out | std::fstream::trunc);
+    if (!stream.is_open())
+    {
+        std::cerr << std::format("Could not write dump manifest \"{}\"\n", manifestFilePath.string());
+        return false;
+    }
+
+    stream << MANIFEST_FILE_HEADER << '\n';
+    for (const auto& value : m_environment)
+        stream << MANIFEST_KEY_ENVIRONMENT << ' ' << value << '\n';
+
+    std::lock_guard lock(m_mutex);
+    for (const auto& [key, hash] : m_current_hashes)
+    {
+        const auto& [assetType, assetName] = key;
+        stream << std::format("{} {} {:016x} {}\n", MANIFEST_KEY_ASSET, assetType, hash, assetName);
+    }
+
+    return stream.good();
+}
+
+void AssetDumpManifest::PrintSummary(std::ostream& stream) const
+{
+    stream << std::format("Skipped {} of {} assets that were unchanged since the last dump\n", m_unchanged_count.load(), m_checked_count.load());
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Pool/XAssetInfo.h"
+#include "Utils/ClassUtils.h"
+#include "Zone/ZoneTypes.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * \brief Records the content hash of every asset of a zone that was dumped to be able to skip dumping assets that did not change when dumping the zone again.
+ * Assets are only considered unchanged when the environment of the previous dump, like the tool version and the output options, is the same as well.
+ * Can be used from multiple threads at once.
+ */
+class AssetDumpManifest
+{
+    // Keyed by asset type and asset name
+    std::map<std::pair<asset_type_t, std::string>, uint64_t> m_previous_hashes;
+    std::map<std::pair<asset_type_t, std::string>, uint64_t> m_current_hashes;
+    std::vector<std::string> m_environment;
+    std::mutex m_mutex;
+
+    std::atomic_size_t m_checked_count;
+    std::atomic_size_t m_unchanged_count;
+
+public:
+    AssetDumpManifest();
+
+    /**
+     * \brief Adds a value that influences the dumped files without being part of the zone, like the tool version or an output format.
+     * Must be called before loading a previous manifest.
+     * \param value The value to add.
+     */
+    void AddEnvironment(std::string value);
+
+    /**
+     * \brief Loads the hashes of a previous dump. They are discarded when the environment of the previous dump differs.
+     * \param manifestFilePath The path to the manifest file of the previous dump.
+     * \return \c true if the hashes of the previous dump can be used, otherwise \c false.
+     */
+    bool Load(const std::filesystem::path& manifestFilePath);
+
+    /**
+     * \brief Records the content hash of an asset that is about to be dumped and checks whether it is the same as in the previous dump.
+     * \param asset The asset to check.
+     * \return \c true if the asset was dumped before with the same content hash and does not need to be dumped again, otherwise \c false.
+     */
+    bool IsUnchanged(const XAssetInfoGeneric& asset);
+
+    /**
+     * \brief Saves the content hashes of all assets that were checked to the specified manifest file.
+     * \param manifestFilePath The path to the manifest file.
+     * \return \c true if the manifest could be written, otherwise \c false.
+     */
+    bool Save(const std::filesystem::path& manifestFilePath);
+
+    /**
+     * \brief Prints how many of the checked assets were skipped because they were unchanged.
+     * \param stream The stream to print to.
+     */
+    void PrintSummary(std::ostream& stream) const;
+};
@@ -1,23 +1,158 @@
 #include "AssetDumpingContext.h"
 
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+    class CountingFileStream final : public std::ofstream
+    {
+    public:
+        CountingFileStream(const std::filesystem::path& path, std::atomic_uint64_t& writtenByteCount)
+            : std::ofstream(path, std::fstream::out | std::fstream::binary),
+              m_written_byte_count(writtenByteCount)
+        {
+        }
+
+        ~CountingFileStream() override
+        {
+            const auto pos = tellp();
+            if (pos > 0)
+                m_written_byte_count += static_cast<uint64_t>(pos);
+        }
+
+        CountingFileStream(const CountingFileStream& other) = delete;
+        CountingFileStream(CountingFileStream&& other) noexcept = delete;
+        CountingFileStream& operator=(const CountingFileStream& other) = delete;
+        CountingFileStream& operator=(CountingFileStream&& other) noexcept = delete;
+
+    private:
+        std::atomic_uint64_t& m_written_byte_count;
+    };
+
+    // Files at least this big are not queued on the file writer
+    constexpr size_t MAX_ASYNC_FILE_SIZE = 0x400000;
+
+    // Keeps the contents of a file in memory and hands them over when the stream is closed, seeking is supported the same way as with files
+    class BufferedFileStream final : public std::ostream
+    {
+    public:
+        explicit BufferedFileStream(std::function<void(std::string data)> onClose)
+            : std::ostream(nullptr),
+              m_buffer(std::ios::out | std::ios::binary),
+              m_on_close(std::move(onClose))
+        {
+            rdbuf(&m_buffer);
+        }
+
+        ~BufferedFileStream() override
+        {
+            m_on_close(std::move(m_buffer).str());
+        }
+
+        BufferedFileStream(const BufferedFileStream& other) = delete;
+        BufferedFileStream(BufferedFileStream&& other) noexcept = delete;
+        BufferedFileStream& operator=(const BufferedFileStream& other) = delete;
+        BufferedFileStream& operator=(BufferedFileStream&& other) noexcept = delete;
+
+    private:
+        std::stringbuf m_buffer;
+        std::function<void(std::string data)> m_on_close;
+    };
+
+    void WriteFileDirectly(const std::filesystem::path& path, const std::string& data, std::atomic_uint64_t& writtenByteCount)
+    {
+        std::ofstream file(path, std::fstream::out | std::fstream::binary);
+        if (!file.is_open())
+        {
+            std::cout << "Failed to open file '" << path.string() << "' to write it\n";
+            return;
+        }
+
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+        writtenByteCount += data.size();
+    }
+} // namespace
 
 AssetDumpingContext::AssetDumpingContext()
-    : m_zone(nullptr)
+    : m_written_byte_count(0u),
+      m_zone(nullptr),
+      m_progress_reporter(nullptr),
+      m_image_dump_cache(nullptr),
+      m_dump_manifest(nullptr),
+      m_asset_name_filter(nullptr),
+      m_asset_closure(nullptr)
+{
+}
+
+void AssetDumpingContext::CreateFolder(const std::filesystem::path& folder) const
 {
+    const auto folderString = folder.string();
+    {
+        std::lock_guard lock(m_created_folders_mutex);
+        if (m_created_folders.contains(folderString))
+            return;
+    }
+
+    // Other threads may create the same folders at the same time, failing to create them shows when opening the file
+    std::error_code ec;
+    create_directories(folder, ec);
+
+    if (!ec)
+    {
+        std::lock_guard lock(m_created_folders_mutex);
+        m_created_folders.emplace(folderString);
+    }
 }
 
 std::unique_ptr<std::ostream> AssetDumpingContext::OpenAssetFile(const std::string& fileName) const
 {
+    return OpenAssetFile(fileName, true);
+}
+
+std::unique_ptr<std::ostream> AssetDumpingContext::OpenAssetFileUnbuffered(const std::string& fileName) const
+{
+    return OpenAssetFile(fileName, false);
+}
+
+std::unique_ptr<std::ostream> AssetDumpingContext::OpenAssetFile(const std::string& fileName, const bool allowFileWriter) const
+{
+    if (m_archive_writer)
+    {
+        return std::make_unique<BufferedFileStream>(
+            [this, fileName](std::string data)
+            {
+                m_written_byte_count += data.size();
+                if (!m_archive_writer->AddFile(fileName, std::vector<uint8_t>(data.begin(), data.end())))
+                    std::cout << "Failed to add file '" << fileName << "' to archive\n";
+            });
+    }
+
     std::filesystem::path assetFilePath(m_base_path);
     assetFilePath.append(fileName);
 
     auto assetFileFolder(assetFilePath);
     assetFileFolder.replace_filename("");
-    create_directories(assetFileFolder);
+    CreateFolder(assetFileFolder);
 
-    auto file = std::make_unique<std::ofstream>(assetFilePath, std::fstream::out | std::fstream::binary);
+    if (m_file_writer && allowFileWriter)
+    {
+        return std::make_unique<BufferedFileStream>(
+            [this, assetFilePath](std::string data)
+            {
+                // Big files are written directly since they are not dominated by the latency of creating them
+                if (data.size() < MAX_ASYNC_FILE_SIZE)
+                    m_file_writer->Write(assetFilePath, std::move(data));
+                else
+                    WriteFileDirectly(assetFilePath, data, m_written_byte_count);
+            });
+    }
+
+    auto file = std::make_unique<CountingFileStream>(assetFilePath, m_written_byte_count);
 
     if (!file->is_open())
     {
@@ -27,3 +162,96 @@ std::unique_ptr<std::ostream> AssetDumpingContext::OpenAssetFile(const std::stri
 
     return std::move(file);
 }
+
+void AssetDumpingContext::RunJobs(const std::vector<std::function<void()>>& jobs) const
+{
+    if (!m_worker_pool || jobs.size() <= 1u)
+    {
+        for (const auto& job : jobs)
+            job();
+
+        return;
+    }
+
+    std::mutex exceptionMutex;
+    std::exception_ptr exception;
+
+    for (const auto& job : jobs)
+    {
+        m_worker_pool->Enqueue(
+            [&job, &exceptionMutex, &exception]
+            {
+                try
+                {
+                    job();
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(exceptionMutex);
+                    if (!exception)
+                        exception = std::current_exception();
+                }
+            });
+    }
+
+    m_worker_pool->WaitForIdle();
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+void AssetDumpingContext::ReportAssetDumped(const std::string& assetName) const
+{
+    if (m_progress_reporter)
+        m_progress_reporter->OnAssetDumped(m_zone->m_name, assetName);
+}
+
+void AssetDumpingContext::EnableAsyncFileWrites(const size_t maxPendingSize)
+{
+    m_file_writer = std::make_unique<AsyncFileWriter>(m_written_byte_count, maxPendingSize);
+}
+
+void AssetDumpingContext::FlushFiles() const
+{
+    if (m_file_writer)
+        m_file_writer->Flush();
+}
+
+bool AssetDumpingContext::OpenArchive(const std::string& archivePath, const unsigned workerCount)
+{
+    const std::filesystem::path path(archivePath);
+    if (path.has_parent_path())
+    {
+        std::error_code ec;
+        create_directories(path.parent_path(), ec);
+    }
+
+    auto stream = std::make_unique<std::ofstream>(path, std::fstream::out | std::fstream::binary);
+    if (!stream->is_open())
+    {
+        std::cout << "Failed to open archive '" << archivePath << "'\n";
+        return false;
+    }
+
+    m_archive_stream = std::move(stream);
+    m_archive_writer = std::make_unique<ZipWriter>(*m_archive_stream, true, workerCount);
+
+    return true;
+}
+
+bool AssetDumpingContext::CloseArchive()
+{
+    if (!m_archive_writer)
+        return true;
+
+    const auto result = m_archive_writer->Finish();
+    m_archive_writer.reset();
+    m_archive_stream.reset();
+
+    return result;
+}
+
+uint64_t AssetDumpingContext::GetWrittenByteCount() const
+{
+    return m_written_byte_count.load();
+}
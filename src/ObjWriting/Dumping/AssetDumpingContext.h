@@ -1,28 +1,143 @@
 #pragma once
 
+#include "AsyncFileWriter.h"
+#include "GdtEntryCollector.h"
 #include "IZoneAssetDumperState.h"
-#include "Obj/Gdt/GdtStream.h"
 #include "Utils/ClassUtils.h"
+#include "Utils/ProgressReporter.h"
+#include "Utils/ThreadPool.h"
+#include "Zip/ZipWriter.h"
 #include "Zone/Zone.h"
 
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <typeindex>
+#include <unordered_set>
+#include <vector>
+
+class AssetClosure;
+class AssetDumpManifest;
+class AssetNameFilter;
+class ImageDumpCache;
 
 class AssetDumpingContext
 {
     std::unordered_map<std::type_index, std::unique_ptr<IZoneAssetDumperState>> m_zone_asset_dumper_states;
+    mutable std::atomic_uint64_t m_written_byte_count;
+
+    // Folders that were already created for asset files, so that only the first file of a folder has to create it
+    mutable std::unordered_set<std::string> m_created_folders;
+    mutable std::mutex m_created_folders_mutex;
+
+    // Only set while asset files are written into an archive instead of the base path
+    std::unique_ptr<std::ofstream> m_archive_stream;
+    std::unique_ptr<ZipWriter> m_archive_writer;
+
+    void CreateFolder(const std::filesystem::path& folder) const;
+    _NODISCARD std::unique_ptr<std::ostream> OpenAssetFile(const std::string& fileName, bool allowFileWriter) const;
 
 public:
     Zone* m_zone;
     std::string m_base_path;
-    std::unique_ptr<GdtOutputStream> m_gdt;
+
+    // Only set when assets are dumped into a gdt. The entries are written after all assets were dumped.
+    std::unique_ptr<GdtEntryCollector> m_gdt;
+
+    // Asset types that are not covered are always handled
+    std::vector<bool> m_asset_types_to_handle;
+
+    // Only set when dumping assets in parallel is enabled
+    std::unique_ptr<ThreadPool> m_worker_pool;
+
+    // Only set when asset files are buffered in memory and written on a background thread
+    std::unique_ptr<AsyncFileWriter> m_file_writer;
+
+    // Receives the progress of dumping if set
+    progress::IProgressReporter* m_progress_reporter;
+
+    // Skips images that were already dumped by another zone of the session if set
+    ImageDumpCache* m_image_dump_cache;
+
+    // Skips assets that did not change since the previous dump of the zone if set
+    AssetDumpManifest* m_dump_manifest;
+
+    // Only dumps assets whose names pass the filter if set
+    const AssetNameFilter* m_asset_name_filter;
+
+    // Only dumps the assets of the closure if set
+    const AssetClosure* m_asset_closure;
 
     AssetDumpingContext();
 
+    /**
+     * \brief Opens a file for an asset relative to the base path. Can be called from multiple threads at once.
+     * The size of the file is added to the written byte count when the returned stream is destroyed.
+     * With a file writer set, the file is buffered in memory and only written after the returned stream is destroyed.
+     * Failing to write it is then reported by the file writer instead of returning \c nullptr.
+     * With an open archive, the file is added to the archive when the returned stream is destroyed instead.
+     * \param fileName The name of the file to open.
+     * \return The opened file or \c nullptr if it could not be opened.
+     */
     _NODISCARD std::unique_ptr<std::ostream> OpenAssetFile(const std::string& fileName) const;
 
+    /**
+     * \brief Opens a file for an asset like \c OpenAssetFile but never queues it on the file writer.
+     * The file is completely written once the returned stream is destroyed.
+     * \param fileName The name of the file to open.
+     * \return The opened file or \c nullptr if it could not be opened.
+     */
+    _NODISCARD std::unique_ptr<std::ostream> OpenAssetFileUnbuffered(const std::string& fileName) const;
+
+    /**
+     * \brief Runs independent jobs on the worker pool if it is set, otherwise on the calling thread, and waits for all of them to finish.
+     * Must not be called from a job of the worker pool since it waits for the pool to become idle.
+     * The first exception thrown by a job is rethrown after all jobs finished.
+     * \param jobs The jobs to run.
+     */
+    void RunJobs(const std::vector<std::function<void()>>& jobs) const;
+
+    /**
+     * \brief Reports an asset of the zone as dumped if a progress reporter is set. Can be called from multiple threads at once.
+     * \param assetName The name of the dumped asset.
+     */
+    void ReportAssetDumped(const std::string& assetName) const;
+
+    /**
+     * \brief Creates a file writer that asset files opened from now on are written with.
+     * \param maxPendingSize The amount of buffered bytes that can wait to be written before opening further files blocks.
+     */
+    void EnableAsyncFileWrites(size_t maxPendingSize);
+
+    /**
+     * \brief Writes all asset files opened from now on into a zip archive instead of the base path, the file names are used as paths inside of the archive.
+     * \param archivePath The path of the archive to create.
+     * \param workerCount The amount of threads compressing files. A value of \c 0 uses one thread per hardware thread.
+     * \return \c true if the archive could be created, otherwise \c false.
+     */
+    bool OpenArchive(const std::string& archivePath, unsigned workerCount);
+
+    /**
+     * \brief Writes the remaining files and the directory of the archive if one is open. All asset file streams must be destroyed before.
+     * \return \c true if no archive was open or it was written successfully, otherwise \c false.
+     */
+    bool CloseArchive();
+
+    /**
+     * \brief Blocks until all asset files that were closed so far are written, if a file writer is set.
+     */
+    void FlushFiles() const;
+
+    /**
+     * \brief Returns the amount of bytes written to all files opened with \c OpenAssetFile that were closed so far.
+     */
+    _NODISCARD uint64_t GetWrittenByteCount() const;
+
     template<typename T> T* GetZoneAssetDumperState()
     {
         static_assert(std::is_base_of_v<IZoneAssetDumperState, T>, "T must inherit IZoneAssetDumperState");
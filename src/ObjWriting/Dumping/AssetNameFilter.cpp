@@ -0,0 +1,31 @@
+#include "AssetNameFilter.h"
+
+#include <algorithm>
+
+void AssetNameFilter::AddInclude(const std::string_view pattern)
+{
+    m_includes.emplace_back(pattern);
+}
+
+void AssetNameFilter::AddExclude(const std::string_view pattern)
+{
+    m_excludes.emplace_back(pattern);
+}
+
+bool AssetNameFilter::IsEmpty() const
+{
+    return m_includes.empty() && m_excludes.empty();
+}
+
+bool AssetNameFilter::ShouldDump(const std::string_view assetName) const
+{
+    const auto matches = [assetName](const GlobPattern& pattern)
+    {
+        return pattern.Matches(assetName);
+    };
+
+    if (!m_includes.empty() && !std::ranges::any_of(m_includes, matches))
+        return false;
+
+    return !std::ranges::any_of(m_excludes, matches);
+}
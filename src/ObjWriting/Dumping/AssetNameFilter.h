@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Utils/ClassUtils.h"
+#include "Utils/GlobPattern.h"
+
+#include <string_view>
+#include <vector>
+
+/**
+ * \brief Decides by their names which assets are dumped. The patterns are compiled once and can be checked from multiple threads at once.
+ * An asset is dumped when it matches any include pattern, or no include patterns were added, and does not match any exclude pattern.
+ */
+class AssetNameFilter
+{
+public:
+    /**
+     * \brief Adds a pattern of asset names to dump.
+     * \param pattern A name that may contain the wildcards \c * and \c ?.
+     */
+    void AddInclude(std::string_view pattern);
+
+    /**
+     * \brief Adds a pattern of asset names to not dump, even when they match an include pattern.
+     * \param pattern A name that may contain the wildcards \c * and \c ?.
+     */
+    void AddExclude(std::string_view pattern);
+
+    _NODISCARD bool IsEmpty() const;
+    _NODISCARD bool ShouldDump(std::string_view assetName) const;
+
+private:
+    std::vector<GlobPattern> m_includes;
+    std::vector<GlobPattern> m_excludes;
+};
@@ -0,0 +1,107 @@
+#include "AsyncFileWriter.h"
+
+#include <fstream>
+#include <iostream>
+
+AsyncFileWriter::AsyncFileWriter(std::atomic_uint64_t& writtenByteCount, const size_t maxPendingSize)
+    : m_written_byte_count(writtenByteCount),
+      m_max_pending_size(maxPendingSize),
+      m_pending_size(0u),
+      m_writing_batch(false),
+      m_stopping(false)
+{
+    m_thread = std::thread(&AsyncFileWriter::WriterMain, this);
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+
+    m_files_available.notify_all();
+    m_thread.join();
+}
+
+void AsyncFileWriter::Write(std::filesystem::path path, std::string data)
+{
+    const auto size = data.size();
+    {
+        std::unique_lock lock(m_mutex);
+
+        // A single file bigger than the limit is still accepted once nothing else is pending
+        m_space_available.wait(lock,
+                               [this, size]
+                               {
+                                   return m_pending_size == 0u || m_pending_size + size <= m_max_pending_size;
+                               });
+
+        m_pending_files.emplace_back(PendingFile{std::move(path), std::move(data)});
+        m_pending_size += size;
+    }
+
+    m_files_available.notify_one();
+}
+
+void AsyncFileWriter::Flush()
+{
+    std::unique_lock lock(m_mutex);
+    m_idle.wait(lock,
+                [this]
+                {
+                    return m_pending_files.empty() && !m_writing_batch;
+                });
+}
+
+void AsyncFileWriter::WriterMain()
+{
+    std::vector<PendingFile> batch;
+
+    while (true)
+    {
+        size_t batchSize;
+        {
+            std::unique_lock lock(m_mutex);
+            m_writing_batch = false;
+            if (m_pending_files.empty())
+                m_idle.notify_all();
+
+            m_files_available.wait(lock,
+                                   [this]
+                                   {
+                                       return m_stopping || !m_pending_files.empty();
+                                   });
+
+            if (m_pending_files.empty())
+                return;
+
+            // All files that queued up while the last batch was written are taken at once to only lock once per batch
+            batch.swap(m_pending_files);
+            batchSize = m_pending_size;
+            m_writing_batch = true;
+        }
+
+        for (const auto& file : batch)
+        {
+            std::ofstream stream(file.m_path, std::fstream::out | std::fstream::binary);
+            if (!stream.is_open())
+            {
+                std::cout << "Failed to open file '" << file.m_path.string() << "' to write it\n";
+                continue;
+            }
+
+            stream.write(file.m_data.data(), static_cast<std::streamsize>(file.m_data.size()));
+            m_written_byte_count += file.m_data.size();
+        }
+
+        batch.clear();
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_pending_size -= batchSize;
+        }
+
+        m_space_available.notify_all();
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * \brief Writes files whose contents were buffered in memory on a background thread.
+ * Pending files are written in batches, so the threads that produce them do not wait for the latency of creating and writing every single file.
+ */
+class AsyncFileWriter
+{
+    class PendingFile
+    {
+    public:
+        std::filesystem::path m_path;
+        std::string m_data;
+    };
+
+    std::atomic_uint64_t& m_written_byte_count;
+    size_t m_max_pending_size;
+
+    std::vector<PendingFile> m_pending_files;
+    size_t m_pending_size;
+    bool m_writing_batch;
+    bool m_stopping;
+
+    std::mutex m_mutex;
+    std::condition_variable m_files_available;
+    std::condition_variable m_space_available;
+    std::condition_variable m_idle;
+    std::thread m_thread;
+
+    void WriterMain();
+
+public:
+    /**
+     * \brief Creates a writer and starts its background thread.
+     * \param writtenByteCount The counter that the size of every written file is added to.
+     * \param maxPendingSize The amount of bytes that can wait to be written before \c Write blocks.
+     */
+    AsyncFileWriter(std::atomic_uint64_t& writtenByteCount, size_t maxPendingSize);
+    ~AsyncFileWriter();
+    AsyncFileWriter(const AsyncFileWriter& other) = delete;
+    AsyncFileWriter(AsyncFileWriter&& other) noexcept = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter& other) = delete;
+    AsyncFileWriter& operator=(AsyncFileWriter&& other) noexcept = delete;
+
+    /**
+     * \brief Queues a file to be written. Blocks while too many bytes are pending. Can be called from multiple threads at once.
+     * The folder of the file must already exist. Files that cannot be written are reported on stdout.
+     * \param path The path of the file.
+     * \param data The contents of the file.
+     */
+    void Write(std::filesystem::path path, std::string data);
+
+    /**
+     * \brief Blocks until all queued files have been written.
+     */
+    void Flush();
+};
@@ -0,0 +1,69 @@
+#include "GdtEntryCollector.h"
+
+#include "Utils/JobSystem.h"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+std::vector<GdtEntry>& GdtEntryCollector::GetEntriesOfCurrentThread()
+{
+    // Elements of the map are never moved, so the buffer can be filled without holding the lock
+    std::lock_guard lock(m_mutex);
+    return m_thread_entries[std::this_thread::get_id()];
+}
+
+void GdtEntryCollector::WriteEntry(GdtEntry entry)
+{
+    GetEntriesOfCurrentThread().emplace_back(std::move(entry));
+}
+
+void GdtEntryCollector::WriteEntries(GdtOutputStream& stream)
+{
+    std::vector<GdtEntry*> sortedEntries;
+    for (auto& [threadId, entries] : m_thread_entries)
+    {
+        for (auto& entry : entries)
+            sortedEntries.emplace_back(&entry);
+    }
+
+    std::ranges::sort(sortedEntries,
+                      [](const GdtEntry* e1, const GdtEntry* e2)
+                      {
+                          if (e1->m_gdf_name != e2->m_gdf_name)
+                              return e1->m_gdf_name < e2->m_gdf_name;
+                          return e1->m_name < e2->m_name;
+                      });
+
+    // Entries are formatted into one buffer per range in parallel and the buffers are written in order, so the output does not change
+    const auto rangeCount = (sortedEntries.size() + ENTRIES_PER_FORMATTING_RANGE - 1u) / ENTRIES_PER_FORMATTING_RANGE;
+    std::vector<std::string> formattedRanges(rangeCount);
+    JobSystem::Instance().ParallelFor(rangeCount,
+                                      1u,
+                                      [&stream, &sortedEntries, &formattedRanges](const size_t begin, const size_t end)
+                                      {
+                                          for (auto rangeIndex = begin; rangeIndex < end; rangeIndex++)
+                                          {
+                                              std::ostringstream buffer;
+                                              auto formattingStream = stream.CreateFormattingStream(buffer);
+
+                                              const auto rangeEnd = std::min(sortedEntries.size(), (rangeIndex + 1u) * ENTRIES_PER_FORMATTING_RANGE);
+                                              for (auto entryIndex = rangeIndex * ENTRIES_PER_FORMATTING_RANGE; entryIndex < rangeEnd; entryIndex++)
+                                                  formattingStream.WriteEntry(*sortedEntries[entryIndex]);
+
+                                              formattedRanges[rangeIndex] = std::move(buffer).str();
+                                          }
+                                      });
+
+    std::string formattedEntries;
+    size_t formattedSize = 0u;
+    for (const auto& formattedRange : formattedRanges)
+        formattedSize += formattedRange.size();
+    formattedEntries.reserve(formattedSize);
+    for (const auto& formattedRange : formattedRanges)
+        formattedEntries += formattedRange;
+
+    stream.WriteFormatted(formattedEntries);
+
+    m_thread_entries.clear();
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Obj/Gdt/GdtEntry.h"
+#include "Obj/Gdt/GdtStream.h"
+
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \brief Collects the gdt entries of a dump so dumpers can add them from multiple threads at once.
+ * Every thread adds its entries to its own buffer. The buffers are merged in sorted order when writing them,
+ * so the written gdt does not depend on the order the assets were dumped in.
+ */
+class GdtEntryCollector
+{
+    static constexpr size_t ENTRIES_PER_FORMATTING_RANGE = 64u;
+
+    std::unordered_map<std::thread::id, std::vector<GdtEntry>> m_thread_entries;
+    std::mutex m_mutex;
+
+    std::vector<GdtEntry>& GetEntriesOfCurrentThread();
+
+public:
+    GdtEntryCollector() = default;
+    ~GdtEntryCollector() = default;
+    GdtEntryCollector(const GdtEntryCollector& other) = delete;
+    GdtEntryCollector(GdtEntryCollector&& other) noexcept = delete;
+    GdtEntryCollector& operator=(const GdtEntryCollector& other) = delete;
+    GdtEntryCollector& operator=(GdtEntryCollector&& other) noexcept = delete;
+
+    /**
+     * \brief Adds an entry to the buffer of the calling thread. Can be called from multiple threads at once.
+     * A parent of the entry must stay valid until the entries are written.
+     * \param entry The entry to add.
+     */
+    void WriteEntry(GdtEntry entry);
+
+    /**
+     * \brief Writes all collected entries sorted by their gdf and name and clears them. Must not be called while entries are added.
+     * The entries are formatted in parallel and written as one block.
+     * \param stream The gdt stream to write the entries to.
+     */
+    void WriteEntries(GdtOutputStream& stream);
+};
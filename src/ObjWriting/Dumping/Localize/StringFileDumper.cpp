@@ -2,7 +2,13 @@
 
 #include "Utils/StringUtils.h"
 
-#include <regex>
+#include <algorithm>
+
+namespace
+{
+    constexpr size_t INITIAL_BUFFER_SIZE = 0x100000u;
+    constexpr size_t KEY_COLUMN_WIDTH = 20u;
+} // namespace
 
 StringFileDumper::StringFileDumper(Zone* zone, std::ostream& stream)
     : AbstractTextDumper(stream),
@@ -10,6 +16,8 @@ StringFileDumper::StringFileDumper(Zone* zone, std::ostream& stream)
       m_language_caps("ENGLISH"),
       m_wrote_header(false)
 {
+    m_buffer.reserve(INITIAL_BUFFER_SIZE);
+    UpdateValuePrefix();
 }
 
 void StringFileDumper::SetLanguageName(std::string language)
@@ -17,6 +25,8 @@ void StringFileDumper::SetLanguageName(std::string language)
     m_language_caps = std::move(language);
     for (auto& c : m_language_caps)
         c = toupper(c);
+
+    UpdateValuePrefix();
 }
 
 void StringFileDumper::SetConfigFile(std::string configFile)
@@ -29,29 +39,45 @@ void StringFileDumper::SetNotes(std::string notes)
     m_notes = std::move(notes);
 }
 
+void StringFileDumper::UpdateValuePrefix()
+{
+    m_value_prefix = "LANG_";
+    m_value_prefix += m_language_caps;
+    m_value_prefix.resize(std::max(m_value_prefix.size(), KEY_COLUMN_WIDTH), ' ');
+    m_value_prefix += '"';
+}
+
 void StringFileDumper::WriteHeader()
 {
-    m_stream << "// Dumped from fastfile \"" << m_zone->m_name << "\".\n";
-    m_stream << "// In their original format the strings might have been separated in multiple files.\n";
-    m_stream << "VERSION             \"1\"\n";
-    m_stream << "CONFIG              \"" << m_config_file << "\"\n";
-    m_stream << "FILENOTES           \"" << m_notes << "\"\n";
+    m_buffer += "// Dumped from fastfile \"";
+    m_buffer += m_zone->m_name;
+    m_buffer += "\".\n";
+    m_buffer += "// In their original format the strings might have been separated in multiple files.\n";
+    m_buffer += "VERSION             \"1\"\n";
+    m_buffer += "CONFIG              \"";
+    m_buffer += m_config_file;
+    m_buffer += "\"\n";
+    m_buffer += "FILENOTES           \"";
+    m_buffer += m_notes;
+    m_buffer += "\"\n";
 
     m_wrote_header = true;
 }
 
-void StringFileDumper::WriteReference(const std::string& reference) const
+void StringFileDumper::WriteReference(const std::string& reference)
 {
     if (reference.find_first_not_of(utils::LETTERS_AL_NUM_UNDERSCORE) != std::string::npos)
     {
-        m_stream << "REFERENCE           \"";
-
-        utils::EscapeStringForQuotationMarks(m_stream, reference);
-
-        m_stream << "\"\n";
+        m_buffer += "REFERENCE           \"";
+        utils::EscapeStringForQuotationMarks(m_buffer, reference);
+        m_buffer += "\"\n";
     }
     else
-        m_stream << "REFERENCE           " << reference << "\n";
+    {
+        m_buffer += "REFERENCE           ";
+        m_buffer += reference;
+        m_buffer += '\n';
+    }
 }
 
 void StringFileDumper::WriteLocalizeEntry(const std::string& reference, const std::string& value)
@@ -59,13 +85,12 @@ void StringFileDumper::WriteLocalizeEntry(const std::string& reference, const st
     if (!m_wrote_header)
         WriteHeader();
 
-    m_stream << "\n";
+    m_buffer += '\n';
     WriteReference(reference);
 
-    const auto valueSpacing = std::string(15 - m_language_caps.length(), ' ');
-    m_stream << "LANG_" << m_language_caps << valueSpacing << "\"";
-    utils::EscapeStringForQuotationMarks(m_stream, value);
-    m_stream << "\"\n";
+    m_buffer += m_value_prefix;
+    utils::EscapeStringForQuotationMarks(m_buffer, value);
+    m_buffer += "\"\n";
 }
 
 void StringFileDumper::Finalize()
@@ -73,5 +98,8 @@ void StringFileDumper::Finalize()
     if (!m_wrote_header)
         WriteHeader();
 
-    m_stream << "\nENDMARKER";
+    m_buffer += "\nENDMARKER";
+
+    m_stream.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+    m_buffer.clear();
 }
@@ -3,6 +3,8 @@
 #include "Dumping/AbstractTextDumper.h"
 #include "Zone/Zone.h"
 
+#include <string>
+
 class StringFileDumper : AbstractTextDumper
 {
     Zone* m_zone;
@@ -10,11 +12,16 @@ class StringFileDumper : AbstractTextDumper
     std::string m_config_file;
     std::string m_notes;
     std::string m_language_caps;
+    std::string m_value_prefix;
 
     bool m_wrote_header;
 
+    // Entries are collected and written to the stream as a whole when finalizing
+    std::string m_buffer;
+
+    void UpdateValuePrefix();
     void WriteHeader();
-    void WriteReference(const std::string& reference) const;
+    void WriteReference(const std::string& reference);
 
 public:
     StringFileDumper(Zone* zone, std::ostream& stream);
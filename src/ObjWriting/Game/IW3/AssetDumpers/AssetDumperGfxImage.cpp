@@ -1,6 +1,7 @@
 #include "AssetDumperGfxImage.h"
 
 #include "Image/DdsWriter.h"
+#include "Image/ImageDumpCache.h"
 #include "Image/IwiWriter6.h"
 #include "ObjWriting.h"
 
@@ -50,9 +51,20 @@ std::string AssetDumperGfxImage::GetAssetFileName(XAssetInfo<GfxImage>* asset) c
     return "images/" + cleanAssetName + m_writer->GetFileExtension();
 }
 
+bool AssetDumperGfxImage::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
 void AssetDumperGfxImage::DumpAsset(AssetDumpingContext& context, XAssetInfo<GfxImage>* asset)
 {
     const auto* image = asset->Asset();
+    if (context.m_image_dump_cache)
+    {
+        context.m_image_dump_cache->DumpImage(context, GetAssetFileName(asset), *m_writer, image->texture.texture);
+        return;
+    }
+
     const auto assetFile = context.OpenAssetFile(GetAssetFileName(asset));
 
     if (!assetFile)
@@ -16,6 +16,7 @@ namespace IW3
 
     protected:
         bool ShouldDump(XAssetInfo<GfxImage>* asset) override;
+        bool CanDumpAssetsInParallel() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<GfxImage>* asset) override;
 
     public:
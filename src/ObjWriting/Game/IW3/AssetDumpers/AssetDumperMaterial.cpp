@@ -2,6 +2,7 @@
 
 #include "Game/IW3/MaterialConstantsIW3.h"
 #include "Game/IW3/TechsetConstantsIW3.h"
+#include "Json/JsonOutput.h"
 
 #include <iomanip>
 #include <nlohmann/json.hpp>
@@ -463,5 +464,5 @@ void AssetDumperMaterial::DumpAsset(AssetDumpingContext& context, XAssetInfo<Mat
         {"stateBitsTable", BuildStateBitsTableJson(material->stateBitsTable, material->stateBitsCount)},
     };
 
-    stream << std::setw(4) << j;
+    json_output::Write(stream, j);
 }
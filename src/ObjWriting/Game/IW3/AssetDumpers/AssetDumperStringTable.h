@@ -9,6 +9,7 @@ namespace IW3
     {
     protected:
         bool ShouldDump(XAssetInfo<StringTable>* asset) override;
+        bool CanDumpAssetsInParallel() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<StringTable>* asset) override;
     };
 } // namespace IW3
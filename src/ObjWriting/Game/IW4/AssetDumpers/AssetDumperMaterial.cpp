@@ -3,13 +3,15 @@
 #include "Game/IW4/MaterialConstantsIW4.h"
 #include "Game/IW4/ObjConstantsIW4.h"
 #include "Game/IW4/TechsetConstantsIW4.h"
+#include "Json/JsonOutput.h"
 #include "Utils/ClassUtils.h"
 
 #pragma warning(push, 0)
 #include <Eigen>
 #pragma warning(pop)
 
-#include <iomanip>
+#include <format>
+#include <functional>
 #include <nlohmann/json.hpp>
 #include <sstream>
 #include <string>
@@ -302,11 +304,7 @@ namespace IW4
         for (auto i = 0u; i < (sizeof(gameFlags) * 8u); i++)
         {
             if (gameFlags & (1 << i))
-            {
-                std::ostringstream ss;
-                ss << prefix << " 0x" << std::hex << (1 << i);
-                values.emplace_back(ss.str());
-            }
+                values.emplace_back(std::format("{} 0x{:x}", prefix, 1 << i));
         }
 
         return json(values);
@@ -321,7 +319,7 @@ namespace IW4
             ~(std::numeric_limits<unsigned>::max() >> ((sizeof(unsigned) * 8) - (static_cast<unsigned>(SURF_TYPE_NUM) - 1)));
         assert((surfaceTypeBits & NON_SURFACE_TYPE_BITS) == 0);
 
-        std::ostringstream ss;
+        std::string surfaceTypeString;
         auto firstSurfaceType = true;
         for (auto surfaceTypeIndex = static_cast<unsigned>(SURF_TYPE_BARK); surfaceTypeIndex < SURF_TYPE_NUM; surfaceTypeIndex++)
         {
@@ -331,14 +329,14 @@ namespace IW4
             if (firstSurfaceType)
                 firstSurfaceType = false;
             else
-                ss << ",";
-            ss << surfaceTypeNames[surfaceTypeIndex];
+                surfaceTypeString += ',';
+            surfaceTypeString += surfaceTypeNames[surfaceTypeIndex];
         }
 
         if (firstSurfaceType)
             return "<none>";
 
-        return ss.str();
+        return surfaceTypeString;
     }
 
     void DumpMaterialAsJson(Material* material, std::ostream& stream)
@@ -382,7 +380,7 @@ namespace IW4
             {"stateBitsTable", BuildStateBitsTableJson(material->stateBitsTable, material->stateBitsCount)}
         };
 
-        stream << std::setw(4) << j;
+        json_output::Write(stream, j);
     }
 
     class TechsetInfo
@@ -502,9 +500,8 @@ namespace IW4
 
         void SetValue(const std::string& key, const Eigen::Vector4f& v)
         {
-            std::ostringstream ss;
-            ss << v.x() << " " << v.y() << " " << v.z() << " " << v.w();
-            m_entry.m_properties.emplace(std::make_pair(key, ss.str()));
+            // Same representation as writing the floats to a stream with default formatting
+            m_entry.m_properties.emplace(std::make_pair(key, std::format("{:g} {:g} {:g} {:g}", v.x(), v.y(), v.z(), v.w())));
         }
 
         void SetValue(const std::string& key, const bool value)
@@ -1373,8 +1370,7 @@ namespace IW4
                 if (knownMaterialSourceName == knownTextureMaps.end())
                 {
                     assert(false);
-                    std::cout << "Unknown material texture source name hash: 0x" << std::hex << entry.nameHash << " (" << entry.nameStart << "..."
-                              << entry.nameEnd << ")\n";
+                    std::cout << std::format("Unknown material texture source name hash: 0x{:x} ({}...{})\n", entry.nameHash, entry.nameStart, entry.nameEnd);
                     continue;
                 }
 
@@ -1467,17 +1463,15 @@ bool AssetDumperMaterial::ShouldDump(XAssetInfo<Material>* asset)
     return true;
 }
 
-void AssetDumperMaterial::DumpAsset(AssetDumpingContext& context, XAssetInfo<Material>* asset)
+std::unique_ptr<GdtEntry> AssetDumperMaterial::DumpMaterial(const AssetDumpingContext& context, XAssetInfo<Material>* asset)
 {
     auto* material = asset->Asset();
 
 #if defined(DUMP_AS_JSON) && DUMP_AS_JSON == 1
     {
-        std::ostringstream ss;
-        ss << "materials/" << asset->m_name << ".json";
-        const auto assetFile = context.OpenAssetFile(ss.str());
+        const auto assetFile = context.OpenAssetFile(std::format("materials/{}.json", asset->m_name));
         if (!assetFile)
-            return;
+            return nullptr;
         auto& stream = *assetFile;
         DumpMaterialAsJson(material, stream);
     }
@@ -1485,11 +1479,9 @@ void AssetDumperMaterial::DumpAsset(AssetDumpingContext& context, XAssetInfo<Mat
 
 #if defined(DUMP_AS_GDT) && DUMP_AS_GDT == 1
     {
-        std::ostringstream ss;
-        ss << "materials/" << asset->m_name << ".gdt";
-        const auto assetFile = context.OpenAssetFile(ss.str());
+        const auto assetFile = context.OpenAssetFile(std::format("materials/{}.gdt", asset->m_name));
         if (!assetFile)
-            return;
+            return nullptr;
         auto& stream = *assetFile;
         MaterialGdtDumper dumper(material);
         Gdt gdt(GdtVersion("IW4", 1));
@@ -1498,9 +1490,50 @@ void AssetDumperMaterial::DumpAsset(AssetDumpingContext& context, XAssetInfo<Mat
     }
 #endif
 
-    if (context.m_gdt)
+    if (!context.m_gdt)
+        return nullptr;
+
+    MaterialGdtDumper dumper(material);
+    return std::make_unique<GdtEntry>(std::move(dumper.CreateGdtEntry()));
+}
+
+void AssetDumperMaterial::DumpAsset(AssetDumpingContext& context, XAssetInfo<Material>* asset)
+{
+    const auto gdtEntry = DumpMaterial(context, asset);
+    if (gdtEntry)
+        context.m_gdt->WriteEntry(*gdtEntry);
+}
+
+void AssetDumperMaterial::DumpPool(AssetDumpingContext& context, AssetPool<Material>* pool)
+{
+    if (!context.m_worker_pool)
     {
-        MaterialGdtDumper dumper(material);
-        context.m_gdt->WriteEntry(dumper.CreateGdtEntry());
+        AbstractAssetDumper::DumpPool(context, pool);
+        return;
+    }
+
+    std::vector<XAssetInfo<Material>*> assets;
+    for (auto* assetInfo : *pool)
+    {
+        if (assetInfo->m_name[0] == ',' || !ShouldDump(assetInfo))
+            continue;
+
+        assets.emplace_back(assetInfo);
     }
+
+    // The gdt sorts its entries when writing them, so they can be added from the jobs directly
+    std::vector<std::function<void()>> jobs;
+    jobs.reserve(assets.size());
+    for (auto* asset : assets)
+    {
+        jobs.emplace_back(
+            [&context, asset]
+            {
+                auto gdtEntry = DumpMaterial(context, asset);
+                if (gdtEntry)
+                    context.m_gdt->WriteEntry(std::move(*gdtEntry));
+            });
+    }
+
+    context.RunJobs(jobs);
 }
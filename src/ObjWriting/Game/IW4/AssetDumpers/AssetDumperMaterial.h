@@ -2,13 +2,25 @@
 
 #include "Dumping/AbstractAssetDumper.h"
 #include "Game/IW4/IW4.h"
+#include "Obj/Gdt/GdtEntry.h"
+
+#include <memory>
 
 namespace IW4
 {
     class AssetDumperMaterial final : public AbstractAssetDumper<Material>
     {
+        /**
+         * \brief Dumps the files of a material. Can be called from multiple threads at once.
+         * \return The gdt entry of the material if the context has a gdt, otherwise \c nullptr.
+         */
+        static std::unique_ptr<GdtEntry> DumpMaterial(const AssetDumpingContext& context, XAssetInfo<Material>* asset);
+
     protected:
         bool ShouldDump(XAssetInfo<Material>* asset) override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<Material>* asset) override;
+
+    public:
+        void DumpPool(AssetDumpingContext& context, AssetPool<Material>* pool) override;
     };
 } // namespace IW4
@@ -26,28 +26,50 @@ bool AssetDumperMenuDef::ShouldDump(XAssetInfo<menuDef_t>* asset)
     return true;
 }
 
+bool AssetDumperMenuDef::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
+bool AssetDumperMenuDef::OnlyDependsOnOwnAsset()
+{
+    // The path of a menu depends on the menu list containing it
+    return false;
+}
+
 void AssetDumperMenuDef::DumpAsset(AssetDumpingContext& context, XAssetInfo<menuDef_t>* asset)
 {
     const auto* menu = asset->Asset();
     auto* zoneState = context.GetZoneAssetDumperState<menu::MenuDumpingZoneState>();
 
-    if (!ObjWriting::ShouldHandleAssetType(ASSET_TYPE_MENULIST))
-    {
-        // Make sure menu paths based on menu lists are created
-        const auto* gameAssetPool = dynamic_cast<GameAssetPoolIW4*>(asset->m_zone->m_pools.get());
-        for (auto* menuListAsset : *gameAssetPool->m_menu_list)
-            AssetDumperMenuList::CreateDumpingStateForMenuList(zoneState, menuListAsset->Asset());
-    }
-
     const auto menuFilePath = GetPathForMenu(zoneState, asset);
     const auto assetFile = context.OpenAssetFile(menuFilePath);
 
     if (!assetFile)
         return;
 
-    MenuDumper menuDumper(*assetFile);
+    MenuDumper menuDumper(*assetFile, zoneState);
 
     menuDumper.Start();
     menuDumper.WriteMenu(menu);
     menuDumper.End();
 }
+
+void AssetDumperMenuDef::DumpPool(AssetDumpingContext& context, AssetPool<menuDef_t>* pool)
+{
+    // The menu dumping states are only read while dumping the menus so they must all be created before
+    auto* zoneState = context.GetZoneAssetDumperState<menu::MenuDumpingZoneState>();
+
+    if (!ObjWriting::ShouldHandleAssetType(context, ASSET_TYPE_MENULIST))
+    {
+        // Make sure menu paths based on menu lists are created
+        const auto* gameAssetPool = dynamic_cast<GameAssetPoolIW4*>(context.m_zone->m_pools.get());
+        if (gameAssetPool && gameAssetPool->m_menu_list)
+        {
+            for (auto* menuListAsset : *gameAssetPool->m_menu_list)
+                AssetDumperMenuList::CreateDumpingStateForMenuList(zoneState, menuListAsset->Asset());
+        }
+    }
+
+    AbstractAssetDumper::DumpPool(context, pool);
+}
@@ -12,6 +12,11 @@ namespace IW4
 
     protected:
         bool ShouldDump(XAssetInfo<menuDef_t>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool OnlyDependsOnOwnAsset() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<menuDef_t>* asset) override;
+
+    public:
+        void DumpPool(AssetDumpingContext& context, AssetPool<menuDef_t>* pool) override;
     };
 } // namespace IW4
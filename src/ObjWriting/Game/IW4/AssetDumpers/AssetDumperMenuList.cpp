@@ -92,6 +92,17 @@ bool AssetDumperMenuList::ShouldDump(XAssetInfo<MenuList>* asset)
     return true;
 }
 
+bool AssetDumperMenuList::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
+bool AssetDumperMenuList::OnlyDependsOnOwnAsset()
+{
+    // Menus that share the path of the menu list are written into the menu list file
+    return false;
+}
+
 void AssetDumperMenuList::DumpAsset(AssetDumpingContext& context, XAssetInfo<MenuList>* asset)
 {
     const auto* menuList = asset->Asset();
@@ -102,7 +113,7 @@ void AssetDumperMenuList::DumpAsset(AssetDumpingContext& context, XAssetInfo<Men
 
     auto* zoneState = context.GetZoneAssetDumperState<menu::MenuDumpingZoneState>();
 
-    MenuDumper menuDumper(*assetFile);
+    MenuDumper menuDumper(*assetFile, zoneState);
 
     menuDumper.Start();
 
@@ -18,6 +18,8 @@ namespace IW4
 
     protected:
         bool ShouldDump(XAssetInfo<MenuList>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool OnlyDependsOnOwnAsset() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<MenuList>* asset) override;
 
     public:
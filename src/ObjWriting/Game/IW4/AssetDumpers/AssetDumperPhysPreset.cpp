@@ -82,6 +82,16 @@ bool AssetDumperPhysPreset::ShouldDump(XAssetInfo<PhysPreset>* asset)
     return true;
 }
 
+bool AssetDumperPhysPreset::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
+bool AssetDumperPhysPreset::DumpsIntoGdt()
+{
+    return true;
+}
+
 void AssetDumperPhysPreset::DumpAsset(AssetDumpingContext& context, XAssetInfo<PhysPreset>* asset)
 {
     // Only dump raw when no gdt available
@@ -90,7 +100,7 @@ void AssetDumperPhysPreset::DumpAsset(AssetDumpingContext& context, XAssetInfo<P
         const auto infoString = CreateInfoString(asset);
         GdtEntry gdtEntry(asset->m_name, ObjConstants::GDF_FILENAME_PHYS_PRESET);
         infoString.ToGdtProperties(ObjConstants::INFO_STRING_PREFIX_PHYS_PRESET, gdtEntry);
-        context.m_gdt->WriteEntry(gdtEntry);
+        context.m_gdt->WriteEntry(std::move(gdtEntry));
     }
     else
     {
@@ -13,6 +13,8 @@ namespace IW4
 
     protected:
         bool ShouldDump(XAssetInfo<PhysPreset>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool DumpsIntoGdt() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<PhysPreset>* asset) override;
     };
 } // namespace IW4
@@ -10,6 +10,11 @@ bool AssetDumperRawFile::ShouldDump(XAssetInfo<RawFile>* asset)
     return true;
 }
 
+bool AssetDumperRawFile::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
 void AssetDumperRawFile::DumpAsset(AssetDumpingContext& context, XAssetInfo<RawFile>* asset)
 {
     const auto* rawFile = asset->Asset();
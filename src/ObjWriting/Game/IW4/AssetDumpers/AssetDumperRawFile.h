@@ -9,6 +9,7 @@ namespace IW4
     {
     protected:
         bool ShouldDump(XAssetInfo<RawFile>* asset) override;
+        bool CanDumpAssetsInParallel() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<RawFile>* asset) override;
     };
 } // namespace IW4
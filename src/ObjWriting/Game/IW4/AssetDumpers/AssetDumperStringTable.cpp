@@ -9,6 +9,11 @@ bool AssetDumperStringTable::ShouldDump(XAssetInfo<StringTable>* asset)
     return true;
 }
 
+bool AssetDumperStringTable::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
 void AssetDumperStringTable::DumpAsset(AssetDumpingContext& context, XAssetInfo<StringTable>* asset)
 {
     const auto* stringTable = asset->Asset();
@@ -9,6 +9,7 @@ namespace IW4
     {
     protected:
         bool ShouldDump(XAssetInfo<StringTable>* asset) override;
+        bool CanDumpAssetsInParallel() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<StringTable>* asset) override;
     };
 } // namespace IW4
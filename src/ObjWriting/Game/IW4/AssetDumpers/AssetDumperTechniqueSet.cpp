@@ -4,6 +4,7 @@
 #include "Game/IW4/TechsetConstantsIW4.h"
 #include "Pool/GlobalAssetPool.h"
 #include "Shader/D3D9ShaderAnalyser.h"
+#include "Shader/ShaderInfoCache.h"
 
 #include <algorithm>
 #include <cassert>
@@ -272,7 +273,7 @@ namespace IW4
             }
 
             const auto vertexShaderInfo =
-                d3d9::ShaderAnalyser::GetShaderInfo(vertexShader->prog.loadDef.program, vertexShader->prog.loadDef.programSize * sizeof(uint32_t));
+                ShaderInfoCache::Instance.GetShaderInfo(vertexShader->prog.loadDef.program, vertexShader->prog.loadDef.programSize * sizeof(uint32_t));
             assert(vertexShaderInfo);
             if (!vertexShaderInfo)
                 return;
@@ -327,7 +328,7 @@ namespace IW4
             }
 
             const auto pixelShaderInfo =
-                d3d9::ShaderAnalyser::GetShaderInfo(pixelShader->prog.loadDef.program, pixelShader->prog.loadDef.programSize * sizeof(uint32_t));
+                ShaderInfoCache::Instance.GetShaderInfo(pixelShader->prog.loadDef.program, pixelShader->prog.loadDef.programSize * sizeof(uint32_t));
             assert(pixelShaderInfo);
             if (!pixelShaderInfo)
                 return;
@@ -12,6 +12,8 @@ namespace IW4
 
     protected:
         bool ShouldDump(XAssetInfo<TracerDef>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool DumpsIntoGdt() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<TracerDef>* asset) override;
     };
 } // namespace IW4
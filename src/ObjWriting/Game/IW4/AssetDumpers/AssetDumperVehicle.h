@@ -12,6 +12,8 @@ namespace IW4
 
     protected:
         bool ShouldDump(XAssetInfo<VehicleDef>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool DumpsIntoGdt() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<VehicleDef>* asset) override;
     };
 } // namespace IW4
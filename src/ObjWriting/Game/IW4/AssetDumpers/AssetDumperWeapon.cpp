@@ -404,6 +404,16 @@ bool AssetDumperWeapon::ShouldDump(XAssetInfo<WeaponCompleteDef>* asset)
     return true;
 }
 
+bool AssetDumperWeapon::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
+bool AssetDumperWeapon::DumpsIntoGdt()
+{
+    return true;
+}
+
 void AssetDumperWeapon::DumpAsset(AssetDumpingContext& context, XAssetInfo<WeaponCompleteDef>* asset)
 {
     // Only dump raw when no gdt available
@@ -412,7 +422,7 @@ void AssetDumperWeapon::DumpAsset(AssetDumpingContext& context, XAssetInfo<Weapo
         const auto infoString = CreateInfoString(asset);
         GdtEntry gdtEntry(asset->m_name, ObjConstants::GDF_FILENAME_WEAPON);
         infoString.ToGdtProperties(ObjConstants::INFO_STRING_PREFIX_WEAPON, gdtEntry);
-        context.m_gdt->WriteEntry(gdtEntry);
+        context.m_gdt->WriteEntry(std::move(gdtEntry));
     }
     else
     {
@@ -429,3 +439,11 @@ void AssetDumperWeapon::DumpAsset(AssetDumpingContext& context, XAssetInfo<Weapo
 
     DumpAccuracyGraphs(context, asset);
 }
+
+void AssetDumperWeapon::DumpPool(AssetDumpingContext& context, AssetPool<WeaponCompleteDef>* pool)
+{
+    // Creating the state is not thread safe so it must exist before dumping assets in parallel
+    context.GetZoneAssetDumperState<AccuracyGraphWriter>();
+
+    AbstractAssetDumper::DumpPool(context, pool);
+}
@@ -14,6 +14,11 @@ namespace IW4
 
     protected:
         bool ShouldDump(XAssetInfo<WeaponCompleteDef>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool DumpsIntoGdt() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<WeaponCompleteDef>* asset) override;
+
+    public:
+        void DumpPool(AssetDumpingContext& context, AssetPool<WeaponCompleteDef>* pool) override;
     };
 } // namespace IW4
@@ -14,6 +14,7 @@
 
 #include <cassert>
 #include <format>
+#include <functional>
 
 using namespace IW4;
 
@@ -384,16 +385,16 @@ namespace
         }
     }
 
-    void PopulateXModelWriter(XModelCommon& out, const AssetDumpingContext& context, const unsigned lod, const XModel* model)
+    void PopulateXModelWriter(
+        XModelCommon& out, const XModelCommon& modelBase, const DistinctMapper<Material*>& materialMapper, const unsigned lod, const XModel* model)
     {
         const auto* modelSurfs = model->lodInfo[lod].modelSurfs;
 
-        DistinctMapper<Material*> materialMapper(model->numsurfs);
         AllocateXModelBoneWeights(modelSurfs, out.m_bone_weight_data);
 
         out.m_name = modelSurfs->name;
-        AddXModelBones(out, context, model);
-        AddXModelMaterials(out, materialMapper, model);
+        out.m_bones = modelBase.m_bones;
+        out.m_materials = modelBase.m_materials;
         AddXModelObjects(out, modelSurfs, materialMapper, model->lodInfo[lod].surfIndex);
         AddXModelVertices(out, modelSurfs);
         AddXModelVertexBoneWeights(out, modelSurfs);
@@ -409,8 +410,6 @@ namespace
             return;
 
         const auto writer = obj::CreateMtlWriter(*mtlFile, context.m_zone->m_game->GetShortName(), context.m_zone->m_name);
-        DistinctMapper<Material*> materialMapper(model->numsurfs);
-
         writer->Write(common);
     }
 
@@ -429,8 +428,6 @@ namespace
 
         const auto writer =
             obj::CreateObjWriter(*assetFile, std::format("{}.mtl", model->name), context.m_zone->m_game->GetShortName(), context.m_zone->m_name);
-        DistinctMapper<Material*> materialMapper(model->numsurfs);
-
         writer->Write(common);
     }
 
@@ -464,40 +461,67 @@ namespace
         writer->Write(common);
     }
 
+    void DumpXModelLod(const AssetDumpingContext& context,
+                       const XAssetInfo<XModel>* asset,
+                       const XModelCommon& modelBase,
+                       const DistinctMapper<Material*>& materialMapper,
+                       const unsigned currentLod)
+    {
+        XModelCommon common;
+        PopulateXModelWriter(common, modelBase, materialMapper, currentLod, asset->Asset());
+
+        if (ObjWriting::Configuration.ModelWeldVertices)
+            common.WeldVertices();
+
+        switch (ObjWriting::Configuration.ModelOutputFormat)
+        {
+        case ObjWriting::Configuration_t::ModelOutputFormat_e::OBJ:
+            DumpObjLod(common, context, asset, currentLod);
+            if (currentLod == 0u)
+                DumpObjMtl(common, context, asset);
+            break;
+
+        case ObjWriting::Configuration_t::ModelOutputFormat_e::XMODEL_EXPORT:
+            DumpXModelExportLod(common, context, asset, currentLod);
+            break;
+
+        case ObjWriting::Configuration_t::ModelOutputFormat_e::GLTF:
+            DumpGltfLod<gltf::TextOutput>(common, context, asset, currentLod, ".gltf");
+            break;
+
+        case ObjWriting::Configuration_t::ModelOutputFormat_e::GLB:
+            DumpGltfLod<gltf::BinOutput>(common, context, asset, currentLod, ".glb");
+            break;
+
+        default:
+            assert(false);
+            break;
+        }
+    }
+
     void DumpXModelSurfs(const AssetDumpingContext& context, const XAssetInfo<XModel>* asset)
     {
         const auto* model = asset->Asset();
 
+        // Bones and materials are the same for all lods
+        XModelCommon modelBase;
+        DistinctMapper<Material*> materialMapper(model->numsurfs);
+        AddXModelBones(modelBase, context, model);
+        AddXModelMaterials(modelBase, materialMapper, model);
+
+        // Lods are independent of each other, xmodels are not dumped in parallel so the worker pool is free to dump the lods of one model at once
+        std::vector<std::function<void()>> lodJobs;
+        lodJobs.reserve(model->numLods);
         for (auto currentLod = 0u; currentLod < model->numLods; currentLod++)
         {
-            XModelCommon common;
-            PopulateXModelWriter(common, context, currentLod, asset->Asset());
-
-            switch (ObjWriting::Configuration.ModelOutputFormat)
-            {
-            case ObjWriting::Configuration_t::ModelOutputFormat_e::OBJ:
-                DumpObjLod(common, context, asset, currentLod);
-                if (currentLod == 0u)
-                    DumpObjMtl(common, context, asset);
-                break;
-
-            case ObjWriting::Configuration_t::ModelOutputFormat_e::XMODEL_EXPORT:
-                DumpXModelExportLod(common, context, asset, currentLod);
-                break;
-
-            case ObjWriting::Configuration_t::ModelOutputFormat_e::GLTF:
-                DumpGltfLod<gltf::TextOutput>(common, context, asset, currentLod, ".gltf");
-                break;
-
-            case ObjWriting::Configuration_t::ModelOutputFormat_e::GLB:
-                DumpGltfLod<gltf::BinOutput>(common, context, asset, currentLod, ".glb");
-                break;
-
-            default:
-                assert(false);
-                break;
-            }
+            lodJobs.emplace_back(
+                [&context, asset, &modelBase, &materialMapper, currentLod]
+                {
+                    DumpXModelLod(context, asset, modelBase, materialMapper, currentLod);
+                });
         }
+
+        context.RunJobs(lodJobs);
     }
 } // namespace
 
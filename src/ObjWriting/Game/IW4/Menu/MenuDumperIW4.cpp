@@ -354,6 +354,30 @@ void MenuDumper::WriteStatementNaive(const Statement_s* statement) const
         m_stream << ")";
 }
 
+void MenuDumper::WriteStatementValue(const Statement_s* statementValue) const
+{
+    if (!m_zone_state)
+    {
+        DUMP_FUNC(statementValue);
+        return;
+    }
+
+    // Menus of a zone share many of their statements so each of them is only converted to text once
+    if (const auto* statementText = m_zone_state->FindStatementText(statementValue))
+    {
+        m_stream << *statementText;
+        return;
+    }
+
+    std::ostringstream ss;
+    const MenuDumper statementDumper(ss, m_zone_state);
+    statementDumper.DUMP_FUNC(statementValue);
+
+    auto statementText = ss.str();
+    m_stream << statementText;
+    m_zone_state->AddStatementText(statementValue, std::move(statementText));
+}
+
 void MenuDumper::WriteStatementProperty(const std::string& propertyKey, const Statement_s* statementValue, bool isBooleanStatement) const
 {
     if (statementValue == nullptr || statementValue->numEntries < 0)
@@ -365,12 +389,12 @@ void MenuDumper::WriteStatementProperty(const std::string& propertyKey, const St
     if (isBooleanStatement)
     {
         m_stream << "when(";
-        DUMP_FUNC(statementValue);
+        WriteStatementValue(statementValue);
         m_stream << ");\n";
     }
     else
     {
-        DUMP_FUNC(statementValue);
+        WriteStatementValue(statementValue);
         m_stream << ";\n";
     }
 }
@@ -899,7 +923,13 @@ void MenuDumper::WriteMenuData(const menuDef_t* menu)
 }
 
 MenuDumper::MenuDumper(std::ostream& stream)
-    : AbstractMenuDumper(stream)
+    : MenuDumper(stream, nullptr)
+{
+}
+
+MenuDumper::MenuDumper(std::ostream& stream, menu::MenuDumpingZoneState* zoneState)
+    : AbstractMenuDumper(stream),
+      m_zone_state(zoneState)
 {
 }
 
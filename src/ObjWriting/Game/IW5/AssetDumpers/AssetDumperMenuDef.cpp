@@ -3,6 +3,7 @@
 #include "Game/IW5/GameAssetPoolIW5.h"
 #include "Game/IW5/Menu/MenuDumperIW5.h"
 #include "Menu/AbstractMenuDumper.h"
+#include "Menu/MenuDumpingZoneState.h"
 #include "ObjWriting.h"
 
 #include <filesystem>
@@ -12,25 +13,16 @@ namespace fs = std::filesystem;
 
 using namespace IW5;
 
-const MenuList* AssetDumperMenuDef::GetParentMenuList(XAssetInfo<menuDef_t>* asset)
+const MenuList* AssetDumperMenuDef::GetParentMenuList(XAssetInfo<menuDef_t>* asset) const
 {
-    const auto* menu = asset->Asset();
-    const auto* gameAssetPool = dynamic_cast<GameAssetPoolIW5*>(asset->m_zone->m_pools.get());
-    for (const auto* menuList : *gameAssetPool->m_menu_list)
-    {
-        const auto* menuListAsset = menuList->Asset();
-
-        for (auto menuIndex = 0; menuIndex < menuListAsset->menuCount; menuIndex++)
-        {
-            if (menuListAsset->menus[menuIndex] == menu)
-                return menuListAsset;
-        }
-    }
+    const auto foundMenuList = m_parent_menu_lists.find(asset->Asset());
+    if (foundMenuList == m_parent_menu_lists.end())
+        return nullptr;
 
-    return nullptr;
+    return foundMenuList->second;
 }
 
-std::string AssetDumperMenuDef::GetPathForMenu(XAssetInfo<menuDef_t>* asset)
+std::string AssetDumperMenuDef::GetPathForMenu(XAssetInfo<menuDef_t>* asset) const
 {
     const auto* list = GetParentMenuList(asset);
 
@@ -50,12 +42,23 @@ bool AssetDumperMenuDef::ShouldDump(XAssetInfo<menuDef_t>* asset)
     return true;
 }
 
+bool AssetDumperMenuDef::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
+bool AssetDumperMenuDef::OnlyDependsOnOwnAsset()
+{
+    // The path of a menu depends on the menu list containing it
+    return false;
+}
+
 void AssetDumperMenuDef::DumpAsset(AssetDumpingContext& context, XAssetInfo<menuDef_t>* asset)
 {
     const auto* menu = asset->Asset();
     const auto menuFilePath = GetPathForMenu(asset);
 
-    if (ObjWriting::ShouldHandleAssetType(ASSET_TYPE_MENULIST))
+    if (ObjWriting::ShouldHandleAssetType(context, ASSET_TYPE_MENULIST))
     {
         // Don't dump menu file separately if the name matches the menu list
         const auto* menuListParent = GetParentMenuList(asset);
@@ -68,9 +71,30 @@ void AssetDumperMenuDef::DumpAsset(AssetDumpingContext& context, XAssetInfo<menu
     if (!assetFile)
         return;
 
-    MenuDumper menuDumper(*assetFile);
+    MenuDumper menuDumper(*assetFile, context.GetZoneAssetDumperState<menu::MenuDumpingZoneState>());
 
     menuDumper.Start();
     menuDumper.WriteMenu(menu);
     menuDumper.End();
 }
+
+void AssetDumperMenuDef::DumpPool(AssetDumpingContext& context, AssetPool<menuDef_t>* pool)
+{
+    // The zone state is only read while dumping the menus so it must be created before
+    context.GetZoneAssetDumperState<menu::MenuDumpingZoneState>();
+
+    // Searching all menu lists for every menu is quadratic in the amount of menus
+    m_parent_menu_lists.clear();
+    const auto* gameAssetPool = dynamic_cast<GameAssetPoolIW5*>(context.m_zone->m_pools.get());
+    if (gameAssetPool && gameAssetPool->m_menu_list)
+    {
+        for (const auto* menuList : *gameAssetPool->m_menu_list)
+        {
+            const auto* menuListAsset = menuList->Asset();
+            for (auto menuIndex = 0; menuIndex < menuListAsset->menuCount; menuIndex++)
+                m_parent_menu_lists.try_emplace(menuListAsset->menus[menuIndex], menuListAsset);
+        }
+    }
+
+    AbstractAssetDumper::DumpPool(context, pool);
+}
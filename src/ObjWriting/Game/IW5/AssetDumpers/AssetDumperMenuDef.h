@@ -3,15 +3,25 @@
 #include "Dumping/AbstractAssetDumper.h"
 #include "Game/IW5/IW5.h"
 
+#include <unordered_map>
+
 namespace IW5
 {
     class AssetDumperMenuDef final : public AbstractAssetDumper<menuDef_t>
     {
-        static const MenuList* GetParentMenuList(XAssetInfo<menuDef_t>* asset);
-        static std::string GetPathForMenu(XAssetInfo<menuDef_t>* asset);
+        // The first menu list containing each menu, collected once before dumping the pool
+        std::unordered_map<const menuDef_t*, const MenuList*> m_parent_menu_lists;
+
+        const MenuList* GetParentMenuList(XAssetInfo<menuDef_t>* asset) const;
+        std::string GetPathForMenu(XAssetInfo<menuDef_t>* asset) const;
 
     protected:
         bool ShouldDump(XAssetInfo<menuDef_t>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool OnlyDependsOnOwnAsset() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<menuDef_t>* asset) override;
+
+    public:
+        void DumpPool(AssetDumpingContext& context, AssetPool<menuDef_t>* pool) override;
     };
 } // namespace IW5
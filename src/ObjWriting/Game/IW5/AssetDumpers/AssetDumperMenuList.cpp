@@ -107,6 +107,17 @@ bool AssetDumperMenuList::ShouldDump(XAssetInfo<MenuList>* asset)
     return true;
 }
 
+bool AssetDumperMenuList::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
+bool AssetDumperMenuList::OnlyDependsOnOwnAsset()
+{
+    // Menus that share the path of the menu list are written into the menu list file
+    return false;
+}
+
 void AssetDumperMenuList::DumpAsset(AssetDumpingContext& context, XAssetInfo<MenuList>* asset)
 {
     const auto* menuList = asset->Asset();
@@ -115,7 +126,7 @@ void AssetDumperMenuList::DumpAsset(AssetDumpingContext& context, XAssetInfo<Men
     if (!assetFile)
         return;
 
-    MenuDumper menuDumper(*assetFile);
+    MenuDumper menuDumper(*assetFile, context.GetZoneAssetDumperState<menu::MenuDumpingZoneState>());
 
     menuDumper.Start();
 
@@ -126,3 +137,11 @@ void AssetDumperMenuList::DumpAsset(AssetDumpingContext& context, XAssetInfo<Men
 
     menuDumper.End();
 }
+
+void AssetDumperMenuList::DumpPool(AssetDumpingContext& context, AssetPool<MenuList>* pool)
+{
+    // The zone state is only read while dumping the menu lists so it must be created before
+    context.GetZoneAssetDumperState<menu::MenuDumpingZoneState>();
+
+    AbstractAssetDumper::DumpPool(context, pool);
+}
@@ -15,6 +15,11 @@ namespace IW5
 
     protected:
         bool ShouldDump(XAssetInfo<MenuList>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool OnlyDependsOnOwnAsset() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<MenuList>* asset) override;
+
+    public:
+        void DumpPool(AssetDumpingContext& context, AssetPool<MenuList>* pool) override;
     };
 } // namespace IW5
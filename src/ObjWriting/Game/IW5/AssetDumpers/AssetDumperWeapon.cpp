@@ -4,10 +4,12 @@
 #include "Game/IW5/InfoString/InfoStringFromStructConverter.h"
 #include "Game/IW5/InfoString/WeaponFields.h"
 #include "Game/IW5/ObjConstantsIW5.h"
+#include "InfoString/InfoStringSharedValueCache.h"
 #include "Weapon/AccuracyGraphWriter.h"
 
 #include <bit>
 #include <cassert>
+#include <cstddef>
 #include <cstring>
 #include <sstream>
 #include <type_traits>
@@ -23,13 +25,49 @@ namespace IW5
         InfoStringFromWeaponConverter(const WeaponFullDef* structure,
                                       const cspField_t* fields,
                                       const size_t fieldCount,
-                                      std::function<std::string(scr_string_t)> scriptStringValueCallback)
+                                      std::function<std::string(scr_string_t)> scriptStringValueCallback,
+                                      const WeaponDef* sharedWeaponDef,
+                                      InfoStringSharedValueCache& weaponDefCache)
             : InfoStringFromStructConverter(structure, fields, fieldCount, std::move(scriptStringValueCallback)),
-              m_weapon(structure)
+              m_weapon(structure),
+              m_shared_weapon_def(sharedWeaponDef),
+              m_weapon_def_cache(weaponDefCache)
         {
         }
 
     protected:
+        void FillInfoString() override
+        {
+            // Fields of the weapon def are the same for all variants using it so they are only converted for the first one
+            const auto* cachedValues = m_shared_weapon_def ? m_weapon_def_cache.Find(m_shared_weapon_def) : nullptr;
+            std::vector<std::string> convertedValues;
+            auto cachedValueIndex = 0u;
+
+            for (auto fieldIndex = 0u; fieldIndex < m_field_count; fieldIndex++)
+            {
+                const auto& field = m_fields[fieldIndex];
+                if (!m_shared_weapon_def || !IsWeaponDefField(field))
+                {
+                    FillFromField(field);
+                    continue;
+                }
+
+                if (cachedValues)
+                {
+                    assert(cachedValueIndex < cachedValues->size());
+                    m_info_string.SetValueForKey(std::string(field.szName), (*cachedValues)[cachedValueIndex++]);
+                }
+                else
+                {
+                    FillFromField(field);
+                    convertedValues.emplace_back(m_info_string.GetValueForKey(field.szName));
+                }
+            }
+
+            if (m_shared_weapon_def && !cachedValues)
+                m_weapon_def_cache.Add(m_shared_weapon_def, std::move(convertedValues));
+        }
+
         void FillFromExtensionField(const cspField_t& field) override
         {
             switch (static_cast<weapFieldType_t>(field.iFieldType))
@@ -532,7 +570,15 @@ namespace IW5
             m_info_string.SetValueForKey(key, ss.str());
         }
 
+        static bool IsWeaponDefField(const cspField_t& field)
+        {
+            return field.iOffset >= static_cast<int>(offsetof(WeaponFullDef, weapDef))
+                   && field.iOffset < static_cast<int>(offsetof(WeaponFullDef, weapDef) + sizeof(WeaponDef));
+        }
+
         const WeaponFullDef* m_weapon;
+        const WeaponDef* m_shared_weapon_def;
+        InfoStringSharedValueCache& m_weapon_def_cache;
     };
 
     GenericGraph2D ConvertAccuracyGraph(const char* graphName, const vec2_t* originalKnots, const unsigned originalKnotCount)
@@ -695,7 +741,9 @@ InfoString AssetDumperWeapon::CreateInfoString(XAssetInfo<WeaponCompleteDef>* as
                                                     return "";
 
                                                 return asset->m_zone->m_script_strings[scrStr];
-                                            });
+                                            },
+                                            asset->Asset()->weapDef,
+                                            m_weapon_def_cache);
 
     return converter.Convert();
 }
@@ -732,6 +780,16 @@ bool AssetDumperWeapon::ShouldDump(XAssetInfo<WeaponCompleteDef>* asset)
     return true;
 }
 
+bool AssetDumperWeapon::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
+bool AssetDumperWeapon::DumpsIntoGdt()
+{
+    return true;
+}
+
 void AssetDumperWeapon::DumpAsset(AssetDumpingContext& context, XAssetInfo<WeaponCompleteDef>* asset)
 {
     // TODO: only dump infostring fields when non-default
@@ -742,7 +800,7 @@ void AssetDumperWeapon::DumpAsset(AssetDumpingContext& context, XAssetInfo<Weapo
         const auto infoString = CreateInfoString(asset);
         GdtEntry gdtEntry(asset->m_name, ObjConstants::GDF_FILENAME_WEAPON);
         infoString.ToGdtProperties(ObjConstants::INFO_STRING_PREFIX_WEAPON, gdtEntry);
-        context.m_gdt->WriteEntry(gdtEntry);
+        context.m_gdt->WriteEntry(std::move(gdtEntry));
     }
     else
     {
@@ -759,3 +817,11 @@ void AssetDumperWeapon::DumpAsset(AssetDumpingContext& context, XAssetInfo<Weapo
 
     DumpAccuracyGraphs(context, asset);
 }
+
+void AssetDumperWeapon::DumpPool(AssetDumpingContext& context, AssetPool<WeaponCompleteDef>* pool)
+{
+    // Creating the state is not thread safe so it must exist before dumping assets in parallel
+    context.GetZoneAssetDumperState<AccuracyGraphWriter>();
+
+    AbstractAssetDumper::DumpPool(context, pool);
+}
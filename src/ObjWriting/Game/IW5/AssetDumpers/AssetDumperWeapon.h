@@ -3,17 +3,26 @@
 #include "Dumping/AbstractAssetDumper.h"
 #include "Game/IW5/IW5.h"
 #include "InfoString/InfoString.h"
+#include "InfoString/InfoStringSharedValueCache.h"
 
 namespace IW5
 {
     class AssetDumperWeapon final : public AbstractAssetDumper<WeaponCompleteDef>
     {
+        // Weapon defs are shared by multiple weapons so their fields are only converted once per dump
+        InfoStringSharedValueCache m_weapon_def_cache;
+
         static void CopyToFullDef(const WeaponCompleteDef* weapon, WeaponFullDef* fullDef);
-        static InfoString CreateInfoString(XAssetInfo<WeaponCompleteDef>* asset);
+        InfoString CreateInfoString(XAssetInfo<WeaponCompleteDef>* asset);
         static void DumpAccuracyGraphs(AssetDumpingContext& context, XAssetInfo<WeaponCompleteDef>* asset);
 
     protected:
         bool ShouldDump(XAssetInfo<WeaponCompleteDef>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool DumpsIntoGdt() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<WeaponCompleteDef>* asset) override;
+
+    public:
+        void DumpPool(AssetDumpingContext& context, AssetPool<WeaponCompleteDef>* pool) override;
     };
 } // namespace IW5
@@ -128,18 +128,20 @@ void InfoStringFromStructConverter::FillFromBaseField(const cspField_t& field)
     }
 }
 
+void InfoStringFromStructConverter::FillFromField(const cspField_t& field)
+{
+    assert(field.iFieldType >= 0);
+
+    if (field.iFieldType < CSPFT_NUM_BASE_FIELD_TYPES)
+        FillFromBaseField(field);
+    else
+        FillFromExtensionField(field);
+}
+
 void InfoStringFromStructConverter::FillInfoString()
 {
     for (auto fieldIndex = 0u; fieldIndex < m_field_count; fieldIndex++)
-    {
-        const auto& field = m_fields[fieldIndex];
-        assert(field.iFieldType >= 0);
-
-        if (field.iFieldType < CSPFT_NUM_BASE_FIELD_TYPES)
-            FillFromBaseField(field);
-        else
-            FillFromExtensionField(field);
-    }
+        FillFromField(m_fields[fieldIndex]);
 }
 
 InfoStringFromStructConverter::InfoStringFromStructConverter(const void* structure, const cspField_t* fields, const size_t fieldCount)
@@ -12,6 +12,7 @@ namespace IW5
 
         virtual void FillFromExtensionField(const cspField_t& field) = 0;
         void FillFromBaseField(const cspField_t& field);
+        void FillFromField(const cspField_t& field);
         void FillInfoString() override;
 
     public:
@@ -2,6 +2,7 @@
 
 #include "Game/IW5/IW5.h"
 #include "Menu/AbstractMenuDumper.h"
+#include "Menu/MenuDumpingZoneState.h"
 
 #include <string>
 
@@ -9,6 +10,8 @@ namespace IW5
 {
     class MenuDumper : public AbstractMenuDumper
     {
+        menu::MenuDumpingZoneState* m_zone_state;
+
         static size_t FindStatementClosingParenthesis(const Statement_s* statement, size_t openingParenthesisPosition);
 
         void WriteStatementNaive(const Statement_s* statement) const;
@@ -19,6 +22,7 @@ namespace IW5
         void WriteStatementEntryRange(const Statement_s* statement, size_t startOffset, size_t endOffset) const;
         void WriteStatement(const Statement_s* statement) const;
         void WriteStatementSkipInitialUnnecessaryParenthesis(const Statement_s* statementValue) const;
+        void WriteStatementValue(const Statement_s* statementValue) const;
         void WriteStatementProperty(const std::string& propertyKey, const Statement_s* statementValue, bool isBooleanStatement) const;
 
         void WriteSetLocalVarData(const std::string& setFunction, const SetLocalVarData* setLocalVarData) const;
@@ -50,6 +54,7 @@ namespace IW5
 
     public:
         explicit MenuDumper(std::ostream& stream);
+        MenuDumper(std::ostream& stream, menu::MenuDumpingZoneState* zoneState);
 
         void WriteFunctionDef(const std::string& functionName, const Statement_s* statement);
         void WriteMenu(const menuDef_t* menu);
@@ -2,8 +2,8 @@
 
 #include "Game/IW5/CommonIW5.h"
 #include "Game/IW5/Weapon/JsonWeaponAttachment.h"
+#include "Json/JsonOutput.h"
 
-#include <iomanip>
 #include <nlohmann/json.hpp>
 
 using namespace nlohmann;
@@ -28,7 +28,7 @@ namespace
             jRoot["_type"] = "attachment";
             jRoot["_version"] = 1;
 
-            m_stream << std::setw(4) << jRoot << "\n";
+            json_output::WriteLine(m_stream, jRoot);
         }
 
     private:
@@ -9,6 +9,7 @@ namespace T5
     {
     protected:
         bool ShouldDump(XAssetInfo<StringTable>* asset) override;
+        bool CanDumpAssetsInParallel() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<StringTable>* asset) override;
     };
 } // namespace T5
@@ -12,6 +12,7 @@
 #include "Game/T5/GameAssetPoolT5.h"
 #include "Game/T5/GameT5.h"
 #include "ObjWriting.h"
+#include "Utils/Tracing.h"
 
 using namespace T5;
 
@@ -23,8 +24,9 @@ bool ZoneDumper::CanHandleZone(AssetDumpingContext& context) const
 bool ZoneDumper::DumpZone(AssetDumpingContext& context) const
 {
 #define DUMP_ASSET_POOL(dumperType, poolName, assetType)                                                                                                       \
-    if (assetPools->poolName && ObjWriting::ShouldHandleAssetType(assetType))                                                                                  \
+    if (assetPools->poolName && ObjWriting::ShouldHandleAssetType(context, assetType))                                                                         \
     {                                                                                                                                                          \
+        TRACE_SCOPE("ObjWriting", #dumperType);                                                                                                                \
         dumperType dumper;                                                                                                                                     \
         dumper.DumpPool(context, assetPools->poolName.get());                                                                                                  \
     }
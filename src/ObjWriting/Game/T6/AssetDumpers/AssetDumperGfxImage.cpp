@@ -1,10 +1,13 @@
 #include "AssetDumperGfxImage.h"
 
+#include "Game/T6/ObjLoaderT6.h"
 #include "Image/DdsWriter.h"
+#include "Image/ImageDumpCache.h"
 #include "Image/IwiWriter27.h"
 #include "ObjWriting.h"
 
 #include <cassert>
+#include <cstdio>
 
 using namespace T6;
 
@@ -28,7 +31,7 @@ AssetDumperGfxImage::AssetDumperGfxImage()
 bool AssetDumperGfxImage::ShouldDump(XAssetInfo<GfxImage>* asset)
 {
     const auto* image = asset->Asset();
-    return image->loadedSize > 0;
+    return image->loadedSize > 0 || ObjLoader::CanLoadImageDataOnDemand(image);
 }
 
 std::string AssetDumperGfxImage::GetAssetFileName(XAssetInfo<GfxImage>* asset) const
@@ -50,14 +53,39 @@ std::string AssetDumperGfxImage::GetAssetFileName(XAssetInfo<GfxImage>* asset) c
     return "images/" + cleanAssetName + m_writer->GetFileExtension();
 }
 
+bool AssetDumperGfxImage::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
 void AssetDumperGfxImage::DumpAsset(AssetDumpingContext& context, XAssetInfo<GfxImage>* asset)
 {
     const auto* image = asset->Asset();
+
+    // Data loaded on demand is released when leaving, so only the images that are currently dumped are kept in memory
+    MemoryManager onDemandMemory;
+    auto* texture = image->texture.texture;
+    if (image->loadedSize <= 0)
+    {
+        texture = ObjLoader::LoadImageDataOnDemand(image, context.m_zone, &onDemandMemory);
+        if (texture == nullptr)
+        {
+            printf("Could not find data for image \"%s\"\n", image->name);
+            return;
+        }
+    }
+
+    if (context.m_image_dump_cache)
+    {
+        context.m_image_dump_cache->DumpImage(context, GetAssetFileName(asset), *m_writer, texture);
+        return;
+    }
+
     const auto assetFile = context.OpenAssetFile(GetAssetFileName(asset));
 
     if (!assetFile)
         return;
 
     auto& stream = *assetFile;
-    m_writer->DumpImage(stream, image->texture.texture);
+    m_writer->DumpImage(stream, texture);
 }
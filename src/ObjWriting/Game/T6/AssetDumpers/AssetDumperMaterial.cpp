@@ -36,13 +36,20 @@ void AssetDumperMaterial::DumpAsset(AssetDumpingContext& context, XAssetInfo<Mat
     if (!assetFile)
         return;
 
-    DumpMaterialAsJson(*assetFile, asset->Asset(), context);
+    DumpMaterialAsJson(*assetFile, asset->Asset(), *m_material_constants);
+}
+
+bool AssetDumperMaterial::CanDumpAssetsInParallel()
+{
+    // The constant names are only read once they have been extracted
+    return true;
 }
 
 void AssetDumperMaterial::DumpPool(AssetDumpingContext& context, AssetPool<Material>* pool)
 {
     auto* materialConstantState = context.GetZoneAssetDumperState<MaterialConstantZoneState>();
-    materialConstantState->ExtractNamesFromZone();
+    materialConstantState->ExtractNamesFromZone(context);
+    m_material_constants = materialConstantState;
 
     AbstractAssetDumper::DumpPool(context, pool);
 }
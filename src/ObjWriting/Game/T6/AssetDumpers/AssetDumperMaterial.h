@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Dumping/AbstractAssetDumper.h"
+#include "Game/T6/Material/MaterialConstantZoneState.h"
 #include "Game/T6/T6.h"
 
 #include <string>
@@ -9,11 +10,14 @@ namespace T6
 {
     class AssetDumperMaterial final : public AbstractAssetDumper<Material>
     {
+        const MaterialConstantZoneState* m_material_constants = nullptr;
+
         static std::string GetFileNameForAsset(const std::string& assetName);
 
     protected:
         bool ShouldDump(XAssetInfo<Material>* asset) override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<Material>* asset) override;
+        bool CanDumpAssetsInParallel() override;
 
     public:
         void DumpPool(AssetDumpingContext& context, AssetPool<Material>* pool) override;
@@ -64,6 +64,16 @@ bool AssetDumperPhysConstraints::ShouldDump(XAssetInfo<PhysConstraints>* asset)
     return true;
 }
 
+bool AssetDumperPhysConstraints::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
+bool AssetDumperPhysConstraints::DumpsIntoGdt()
+{
+    return true;
+}
+
 void AssetDumperPhysConstraints::DumpAsset(AssetDumpingContext& context, XAssetInfo<PhysConstraints>* asset)
 {
     // Only dump raw when no gdt available
@@ -72,7 +82,7 @@ void AssetDumperPhysConstraints::DumpAsset(AssetDumpingContext& context, XAssetI
         const auto infoString = CreateInfoString(asset);
         GdtEntry gdtEntry(asset->m_name, ObjConstants::GDF_FILENAME_PHYS_CONSTRAINTS);
         infoString.ToGdtProperties(ObjConstants::INFO_STRING_PREFIX_PHYS_CONSTRAINTS, gdtEntry);
-        context.m_gdt->WriteEntry(gdtEntry);
+        context.m_gdt->WriteEntry(std::move(gdtEntry));
     }
     else
     {
@@ -12,6 +12,8 @@ namespace T6
 
     protected:
         bool ShouldDump(XAssetInfo<PhysConstraints>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool DumpsIntoGdt() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<PhysConstraints>* asset) override;
     };
 } // namespace T6
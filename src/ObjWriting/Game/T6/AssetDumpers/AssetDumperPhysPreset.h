@@ -13,6 +13,8 @@ namespace T6
 
     protected:
         bool ShouldDump(XAssetInfo<PhysPreset>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool DumpsIntoGdt() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<PhysPreset>* asset) override;
     };
 } // namespace T6
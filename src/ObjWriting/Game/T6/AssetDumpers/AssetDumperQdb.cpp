@@ -7,6 +7,11 @@ bool AssetDumperQdb::ShouldDump(XAssetInfo<Qdb>* asset)
     return true;
 }
 
+bool AssetDumperQdb::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
 void AssetDumperQdb::DumpAsset(AssetDumpingContext& context, XAssetInfo<Qdb>* asset)
 {
     const auto* qdb = asset->Asset();
@@ -9,6 +9,7 @@ namespace T6
     {
     protected:
         bool ShouldDump(XAssetInfo<Qdb>* asset) override;
+        bool CanDumpAssetsInParallel() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<Qdb>* asset) override;
     };
 } // namespace T6
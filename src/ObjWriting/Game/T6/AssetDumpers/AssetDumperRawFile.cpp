@@ -73,6 +73,11 @@ void AssetDumperRawFile::DumpAnimtree(AssetDumpingContext& context, XAssetInfo<R
     inflateEnd(&zs);
 }
 
+bool AssetDumperRawFile::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
 void AssetDumperRawFile::DumpAsset(AssetDumpingContext& context, XAssetInfo<RawFile>* asset)
 {
     const auto* rawFile = asset->Asset();
@@ -7,6 +7,11 @@ bool AssetDumperScriptParseTree::ShouldDump(XAssetInfo<ScriptParseTree>* asset)
     return true;
 }
 
+bool AssetDumperScriptParseTree::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
 void AssetDumperScriptParseTree::DumpAsset(AssetDumpingContext& context, XAssetInfo<ScriptParseTree>* asset)
 {
     const auto* scriptParseTree = asset->Asset();
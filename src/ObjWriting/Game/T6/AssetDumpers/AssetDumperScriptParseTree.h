@@ -9,6 +9,7 @@ namespace T6
     {
     protected:
         bool ShouldDump(XAssetInfo<ScriptParseTree>* asset) override;
+        bool CanDumpAssetsInParallel() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<ScriptParseTree>* asset) override;
     };
 } // namespace T6
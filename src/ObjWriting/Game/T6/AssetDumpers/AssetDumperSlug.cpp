@@ -7,6 +7,11 @@ bool AssetDumperSlug::ShouldDump(XAssetInfo<Slug>* asset)
     return true;
 }
 
+bool AssetDumperSlug::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
 void AssetDumperSlug::DumpAsset(AssetDumpingContext& context, XAssetInfo<Slug>* asset)
 {
     const auto* slug = asset->Asset();
@@ -9,6 +9,7 @@ namespace T6
     {
     protected:
         bool ShouldDump(XAssetInfo<Slug>* asset) override;
+        bool CanDumpAssetsInParallel() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<Slug>* asset) override;
     };
 } // namespace T6
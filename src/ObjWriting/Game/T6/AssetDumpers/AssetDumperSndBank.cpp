@@ -3,13 +3,16 @@
 #include "Csv/CsvStream.h"
 #include "Game/T6/CommonT6.h"
 #include "Game/T6/SoundConstantsT6.h"
+#include "Json/JsonOutput.h"
 #include "ObjContainer/SoundBank/SoundBank.h"
 #include "Sound/WavWriter.h"
 #include "nlohmann/json.hpp"
 
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <unordered_set>
+#include <vector>
 
 using namespace T6;
 namespace fs = std::filesystem;
@@ -163,7 +166,9 @@ class AssetDumperSndBank::Internal
         auto assetDir(assetPath);
         assetDir.remove_filename();
 
-        create_directories(assetDir);
+        // Sound files are dumped from multiple threads that may create the same folders at the same time
+        std::error_code ec;
+        create_directories(assetDir, ec);
 
         auto outputStream = std::make_unique<std::ofstream>(assetPath, std::ios_base::out | std::ios_base::binary);
 
@@ -403,16 +408,14 @@ class AssetDumperSndBank::Internal
         stream.WriteColumn("");
     }
 
-    static SoundBankEntryInputStream FindSoundDataInSoundBanks(const unsigned assetId)
+    static SoundBankEntryInputStream FindSoundDataInSoundBanks(const unsigned assetId, bool& canReadConcurrently)
     {
-        for (const auto* soundBank : SoundBank::Repository)
-        {
-            auto soundFile = soundBank->GetEntryStream(assetId);
-            if (soundFile.IsOpen())
-                return soundFile;
-        }
+        const SoundBank* soundBank;
+        auto soundFile = SoundBank::FindEntryStream(assetId, soundBank);
+        if (soundFile.IsOpen())
+            canReadConcurrently = soundBank->CanReadEntriesConcurrently();
 
-        return {};
+        return soundFile;
     }
 
     void DumpSoundFilePcm(const char* assetFileName, const SoundBankEntryInputStream& soundFile, const unsigned bitsPerSample) const
@@ -432,14 +435,8 @@ class AssetDumperSndBank::Internal
         const WavMetaData metaData{soundFile.m_entry.channelCount, FRAME_RATE_FOR_INDEX[soundFile.m_entry.frameRateIndex], bitsPerSample};
 
         writer.WritePcmHeader(metaData, soundFile.m_entry.size);
-
-        while (!soundFile.m_stream->eof())
-        {
-            char buffer[2048];
-            soundFile.m_stream->read(buffer, sizeof(buffer));
-            const auto readSize = soundFile.m_stream->gcount();
-            outFile->write(buffer, readSize);
-        }
+        if (!soundFile.CopyTo(*outFile))
+            std::cerr << "Failed to write sound file: \"" << assetFileName << "\"\n";
     }
 
     void DumpSoundFilePassthrough(const char* assetFileName, const SoundBankEntryInputStream& soundFile, const std::string& extension) const
@@ -451,18 +448,21 @@ class AssetDumperSndBank::Internal
             return;
         }
 
-        while (!soundFile.m_stream->eof())
-        {
-            char buffer[2048];
-            soundFile.m_stream->read(buffer, sizeof(buffer));
-            const auto readSize = soundFile.m_stream->gcount();
-            outFile->write(buffer, readSize);
-        }
+        if (!soundFile.CopyTo(*outFile))
+            std::cerr << "Failed to write sound file: \"" << assetFileName << "\"\n";
     }
 
     void DumpSndAlias(const SndAlias& alias) const
     {
-        const auto soundFile = FindSoundDataInSoundBanks(alias.assetId);
+        // Sound banks can be shared with zones that are loaded or dumped at the same time and entry streams read from the underlying sound bank stream.
+        // Entries of mapped sound banks do not share a stream, and the sound bank stays loaded until the zone is unloaded, so they can be copied without the lock.
+        auto soundBankLock = SoundBank::Repository.Lock();
+
+        auto canReadConcurrently = false;
+        const auto soundFile = FindSoundDataInSoundBanks(alias.assetId, canReadConcurrently);
+        if (canReadConcurrently)
+            soundBankLock.unlock();
+
         if (soundFile.IsOpen())
         {
             const auto format = static_cast<snd_asset_format>(soundFile.m_entry.format);
@@ -499,10 +499,8 @@ class AssetDumperSndBank::Internal
         }
     }
 
-    void DumpSndBankAliases(const SndBank* sndBank) const
+    void DumpSndBankAliases(const SndBank* sndBank, std::unordered_set<unsigned>& dumpedAssets, std::vector<const SndAlias*>& aliasesToDump) const
     {
-        std::unordered_set<unsigned> dumpedAssets;
-
         const auto outFile = OpenAssetOutputFile("soundbank/" + std::string(sndBank->name) + ".aliases", ".csv");
         if (!outFile)
         {
@@ -524,11 +522,8 @@ class AssetDumperSndBank::Internal
                 WriteAliasToFile(csvStream, &alias, sndBank);
                 csvStream.NextRow();
 
-                if (alias.assetId && alias.assetFileName && dumpedAssets.find(alias.assetId) == dumpedAssets.end())
-                {
-                    DumpSndAlias(alias);
-                    dumpedAssets.emplace(alias.assetId);
-                }
+                if (alias.assetId && alias.assetFileName && dumpedAssets.emplace(alias.assetId).second)
+                    aliasesToDump.emplace_back(&alias);
             }
         }
     }
@@ -638,19 +633,35 @@ class AssetDumperSndBank::Internal
             }
 
             duckObj["values"] = values;
-            *duckFile << duckObj.dump(4) << "\n";
+            json_output::WriteLine(*duckFile, duckObj);
         }
     }
 
-    void DumpSndBank(const XAssetInfo<SndBank>* sndBankInfo) const
+    void DumpSndBank(const XAssetInfo<SndBank>* sndBankInfo, std::unordered_set<unsigned>& dumpedAssets, std::vector<const SndAlias*>& aliasesToDump) const
     {
         const auto* sndBank = sndBankInfo->Asset();
 
-        DumpSndBankAliases(sndBank);
+        DumpSndBankAliases(sndBank, dumpedAssets, aliasesToDump);
         DumpSoundRadverb(sndBank);
         DumpSoundDucks(sndBank);
     }
 
+    void DumpSndAliases(const std::vector<const SndAlias*>& aliases) const
+    {
+        std::vector<std::function<void()>> jobs;
+        jobs.reserve(aliases.size());
+        for (const auto* alias : aliases)
+        {
+            jobs.emplace_back(
+                [this, alias]
+                {
+                    DumpSndAlias(*alias);
+                });
+        }
+
+        m_context.RunJobs(jobs);
+    }
+
 public:
     explicit Internal(AssetDumpingContext& context)
         : m_context(context)
@@ -659,13 +670,19 @@ public:
 
     void DumpPool(AssetPool<SndBank>* pool) const
     {
+        // Sound files are written once even when multiple aliases or sound banks refer to them
+        std::unordered_set<unsigned> dumpedAssets;
+        std::vector<const SndAlias*> aliasesToDump;
+
         for (const auto* assetInfo : *pool)
         {
             if (!assetInfo->m_name.empty() && assetInfo->m_name[0] == ',')
                 continue;
 
-            DumpSndBank(assetInfo);
+            DumpSndBank(assetInfo, dumpedAssets, aliasesToDump);
         }
+
+        DumpSndAliases(aliasesToDump);
     }
 };
 
@@ -63,6 +63,16 @@ bool AssetDumperTracer::ShouldDump(XAssetInfo<TracerDef>* asset)
     return true;
 }
 
+bool AssetDumperTracer::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
+bool AssetDumperTracer::DumpsIntoGdt()
+{
+    return true;
+}
+
 void AssetDumperTracer::DumpAsset(AssetDumpingContext& context, XAssetInfo<TracerDef>* asset)
 {
     // Only dump raw when no gdt available
@@ -71,7 +81,7 @@ void AssetDumperTracer::DumpAsset(AssetDumpingContext& context, XAssetInfo<Trace
         const auto infoString = CreateInfoString(asset);
         GdtEntry gdtEntry(asset->m_name, ObjConstants::GDF_FILENAME_TRACER);
         infoString.ToGdtProperties(ObjConstants::INFO_STRING_PREFIX_TRACER, gdtEntry);
-        context.m_gdt->WriteEntry(gdtEntry);
+        context.m_gdt->WriteEntry(std::move(gdtEntry));
     }
     else
     {
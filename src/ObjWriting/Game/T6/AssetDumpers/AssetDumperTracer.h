@@ -12,6 +12,8 @@ namespace T6
 
     protected:
         bool ShouldDump(XAssetInfo<TracerDef>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool DumpsIntoGdt() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<TracerDef>* asset) override;
     };
 } // namespace T6
@@ -113,6 +113,16 @@ bool AssetDumperVehicle::ShouldDump(XAssetInfo<VehicleDef>* asset)
     return true;
 }
 
+bool AssetDumperVehicle::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
+bool AssetDumperVehicle::DumpsIntoGdt()
+{
+    return true;
+}
+
 void AssetDumperVehicle::DumpAsset(AssetDumpingContext& context, XAssetInfo<VehicleDef>* asset)
 {
     // Only dump raw when no gdt available
@@ -121,7 +131,7 @@ void AssetDumperVehicle::DumpAsset(AssetDumpingContext& context, XAssetInfo<Vehi
         const auto infoString = CreateInfoString(asset);
         GdtEntry gdtEntry(asset->m_name, ObjConstants::GDF_FILENAME_VEHICLE);
         infoString.ToGdtProperties(ObjConstants::INFO_STRING_PREFIX_VEHICLE, gdtEntry);
-        context.m_gdt->WriteEntry(gdtEntry);
+        context.m_gdt->WriteEntry(std::move(gdtEntry));
     }
     else
     {
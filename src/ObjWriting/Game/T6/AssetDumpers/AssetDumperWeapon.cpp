@@ -4,9 +4,11 @@
 #include "Game/T6/InfoString/InfoStringFromStructConverter.h"
 #include "Game/T6/InfoString/WeaponFields.h"
 #include "Game/T6/ObjConstantsT6.h"
+#include "InfoString/InfoStringSharedValueCache.h"
 #include "Weapon/AccuracyGraphWriter.h"
 
 #include <cassert>
+#include <cstddef>
 #include <cstring>
 #include <sstream>
 #include <type_traits>
@@ -18,6 +20,38 @@ namespace T6
     class InfoStringFromWeaponConverter final : public InfoStringFromStructConverter
     {
     protected:
+        void FillInfoString() override
+        {
+            // Fields of the weapon def are the same for all variants using it so they are only converted for the first one
+            const auto* cachedValues = m_shared_weapon_def ? m_weapon_def_cache.Find(m_shared_weapon_def) : nullptr;
+            std::vector<std::string> convertedValues;
+            auto cachedValueIndex = 0u;
+
+            for (auto fieldIndex = 0u; fieldIndex < m_field_count; fieldIndex++)
+            {
+                const auto& field = m_fields[fieldIndex];
+                if (!m_shared_weapon_def || !IsWeaponDefField(field))
+                {
+                    FillFromField(field);
+                    continue;
+                }
+
+                if (cachedValues)
+                {
+                    assert(cachedValueIndex < cachedValues->size());
+                    m_info_string.SetValueForKey(std::string(field.szName), (*cachedValues)[cachedValueIndex++]);
+                }
+                else
+                {
+                    FillFromField(field);
+                    convertedValues.emplace_back(m_info_string.GetValueForKey(field.szName));
+                }
+            }
+
+            if (m_shared_weapon_def && !cachedValues)
+                m_weapon_def_cache.Add(m_shared_weapon_def, std::move(convertedValues));
+        }
+
         void FillFromExtensionField(const cspField_t& field) override
         {
             switch (static_cast<weapFieldType_t>(field.iFieldType))
@@ -259,10 +293,24 @@ namespace T6
         InfoStringFromWeaponConverter(const WeaponFullDef* structure,
                                       const cspField_t* fields,
                                       const size_t fieldCount,
-                                      std::function<std::string(scr_string_t)> scriptStringValueCallback)
-            : InfoStringFromStructConverter(structure, fields, fieldCount, std::move(scriptStringValueCallback))
+                                      std::function<std::string(scr_string_t)> scriptStringValueCallback,
+                                      const WeaponDef* sharedWeaponDef,
+                                      InfoStringSharedValueCache& weaponDefCache)
+            : InfoStringFromStructConverter(structure, fields, fieldCount, std::move(scriptStringValueCallback)),
+              m_shared_weapon_def(sharedWeaponDef),
+              m_weapon_def_cache(weaponDefCache)
         {
         }
+
+    private:
+        static bool IsWeaponDefField(const cspField_t& field)
+        {
+            return field.iOffset >= static_cast<int>(offsetof(WeaponFullDef, weapDef))
+                   && field.iOffset < static_cast<int>(offsetof(WeaponFullDef, weapDef) + sizeof(WeaponDef));
+        }
+
+        const WeaponDef* m_shared_weapon_def;
+        InfoStringSharedValueCache& m_weapon_def_cache;
     };
 
     GenericGraph2D ConvertAccuracyGraph(const char* graphName, const vec2_t* originalKnots, const unsigned originalKnotCount)
@@ -424,7 +472,9 @@ InfoString AssetDumperWeapon::CreateInfoString(XAssetInfo<WeaponVariantDef>* ass
                                                     return "";
 
                                                 return asset->m_zone->m_script_strings[scrStr];
-                                            });
+                                            },
+                                            asset->Asset()->weapDef,
+                                            m_weapon_def_cache);
 
     return converter.Convert();
 }
@@ -461,6 +511,16 @@ bool AssetDumperWeapon::ShouldDump(XAssetInfo<WeaponVariantDef>* asset)
     return true;
 }
 
+bool AssetDumperWeapon::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
+bool AssetDumperWeapon::DumpsIntoGdt()
+{
+    return true;
+}
+
 void AssetDumperWeapon::DumpAsset(AssetDumpingContext& context, XAssetInfo<WeaponVariantDef>* asset)
 {
     // Only dump raw when no gdt available
@@ -469,7 +529,7 @@ void AssetDumperWeapon::DumpAsset(AssetDumpingContext& context, XAssetInfo<Weapo
         const auto infoString = CreateInfoString(asset);
         GdtEntry gdtEntry(asset->m_name, ObjConstants::GDF_FILENAME_WEAPON);
         infoString.ToGdtProperties(ObjConstants::INFO_STRING_PREFIX_WEAPON, gdtEntry);
-        context.m_gdt->WriteEntry(gdtEntry);
+        context.m_gdt->WriteEntry(std::move(gdtEntry));
     }
     else
     {
@@ -486,3 +546,11 @@ void AssetDumperWeapon::DumpAsset(AssetDumpingContext& context, XAssetInfo<Weapo
 
     DumpAccuracyGraphs(context, asset);
 }
+
+void AssetDumperWeapon::DumpPool(AssetDumpingContext& context, AssetPool<WeaponVariantDef>* pool)
+{
+    // Creating the state is not thread safe so it must exist before dumping assets in parallel
+    context.GetZoneAssetDumperState<AccuracyGraphWriter>();
+
+    AbstractAssetDumper::DumpPool(context, pool);
+}
@@ -3,17 +3,26 @@
 #include "Dumping/AbstractAssetDumper.h"
 #include "Game/T6/T6.h"
 #include "InfoString/InfoString.h"
+#include "InfoString/InfoStringSharedValueCache.h"
 
 namespace T6
 {
     class AssetDumperWeapon final : public AbstractAssetDumper<WeaponVariantDef>
     {
+        // Weapon defs are shared by multiple weapons so their fields are only converted once per dump
+        InfoStringSharedValueCache m_weapon_def_cache;
+
         static void CopyToFullDef(const WeaponVariantDef* weapon, WeaponFullDef* fullDef);
-        static InfoString CreateInfoString(XAssetInfo<WeaponVariantDef>* asset);
+        InfoString CreateInfoString(XAssetInfo<WeaponVariantDef>* asset);
         static void DumpAccuracyGraphs(AssetDumpingContext& context, XAssetInfo<WeaponVariantDef>* asset);
 
     protected:
         bool ShouldDump(XAssetInfo<WeaponVariantDef>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool DumpsIntoGdt() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<WeaponVariantDef>* asset) override;
+
+    public:
+        void DumpPool(AssetDumpingContext& context, AssetPool<WeaponVariantDef>* pool) override;
     };
 } // namespace T6
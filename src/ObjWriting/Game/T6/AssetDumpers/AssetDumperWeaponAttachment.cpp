@@ -69,6 +69,16 @@ bool AssetDumperWeaponAttachment::ShouldDump(XAssetInfo<WeaponAttachment>* asset
     return true;
 }
 
+bool AssetDumperWeaponAttachment::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
+bool AssetDumperWeaponAttachment::DumpsIntoGdt()
+{
+    return true;
+}
+
 void AssetDumperWeaponAttachment::DumpAsset(AssetDumpingContext& context, XAssetInfo<WeaponAttachment>* asset)
 {
     // Only dump raw when no gdt available
@@ -77,7 +87,7 @@ void AssetDumperWeaponAttachment::DumpAsset(AssetDumpingContext& context, XAsset
         const auto infoString = CreateInfoString(asset);
         GdtEntry gdtEntry(asset->m_name, ObjConstants::GDF_FILENAME_WEAPON_ATTACHMENT);
         infoString.ToGdtProperties(ObjConstants::INFO_STRING_PREFIX_WEAPON_ATTACHMENT, gdtEntry);
-        context.m_gdt->WriteEntry(gdtEntry);
+        context.m_gdt->WriteEntry(std::move(gdtEntry));
     }
     else
     {
@@ -133,6 +133,16 @@ bool AssetDumperWeaponAttachmentUnique::ShouldDump(XAssetInfo<WeaponAttachmentUn
     return true;
 }
 
+bool AssetDumperWeaponAttachmentUnique::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
+bool AssetDumperWeaponAttachmentUnique::DumpsIntoGdt()
+{
+    return true;
+}
+
 void AssetDumperWeaponAttachmentUnique::DumpAsset(AssetDumpingContext& context, XAssetInfo<WeaponAttachmentUnique>* asset)
 {
     // Only dump raw when no gdt available
@@ -141,7 +151,7 @@ void AssetDumperWeaponAttachmentUnique::DumpAsset(AssetDumpingContext& context,
         const auto infoString = CreateInfoString(asset);
         GdtEntry gdtEntry(asset->m_name, ObjConstants::GDF_FILENAME_WEAPON_ATTACHMENT_UNIQUE);
         infoString.ToGdtProperties(ObjConstants::INFO_STRING_PREFIX_WEAPON_ATTACHMENT_UNIQUE, gdtEntry);
-        context.m_gdt->WriteEntry(gdtEntry);
+        context.m_gdt->WriteEntry(std::move(gdtEntry));
     }
     else
     {
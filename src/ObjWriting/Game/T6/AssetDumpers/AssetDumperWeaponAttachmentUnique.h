@@ -13,6 +13,8 @@ namespace T6
 
     protected:
         bool ShouldDump(XAssetInfo<WeaponAttachmentUnique>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool DumpsIntoGdt() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<WeaponAttachmentUnique>* asset) override;
     };
 } // namespace T6
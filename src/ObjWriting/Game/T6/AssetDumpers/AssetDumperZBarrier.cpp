@@ -52,6 +52,16 @@ bool AssetDumperZBarrier::ShouldDump(XAssetInfo<ZBarrierDef>* asset)
     return true;
 }
 
+bool AssetDumperZBarrier::CanDumpAssetsInParallel()
+{
+    return true;
+}
+
+bool AssetDumperZBarrier::DumpsIntoGdt()
+{
+    return true;
+}
+
 void AssetDumperZBarrier::DumpAsset(AssetDumpingContext& context, XAssetInfo<ZBarrierDef>* asset)
 {
     // Only dump raw when no gdt available
@@ -60,7 +70,7 @@ void AssetDumperZBarrier::DumpAsset(AssetDumpingContext& context, XAssetInfo<ZBa
         const auto infoString = CreateInfoString(asset);
         GdtEntry gdtEntry(asset->m_name, ObjConstants::GDF_FILENAME_ZBARRIER);
         infoString.ToGdtProperties(ObjConstants::INFO_STRING_PREFIX_ZBARRIER, gdtEntry);
-        context.m_gdt->WriteEntry(gdtEntry);
+        context.m_gdt->WriteEntry(std::move(gdtEntry));
     }
     else
     {
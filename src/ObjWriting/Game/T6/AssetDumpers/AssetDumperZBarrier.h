@@ -12,6 +12,8 @@ namespace T6
 
     protected:
         bool ShouldDump(XAssetInfo<ZBarrierDef>* asset) override;
+        bool CanDumpAssetsInParallel() override;
+        bool DumpsIntoGdt() override;
         void DumpAsset(AssetDumpingContext& context, XAssetInfo<ZBarrierDef>* asset) override;
     };
 } // namespace T6
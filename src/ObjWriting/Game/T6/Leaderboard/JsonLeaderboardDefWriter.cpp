@@ -2,8 +2,8 @@
 
 #include "Game/T6/CommonT6.h"
 #include "Game/T6/Leaderboard/JsonLeaderboardDef.h"
+#include "Json/JsonOutput.h"
 
-#include <iomanip>
 #include <nlohmann/json.hpp>
 
 using namespace nlohmann;
@@ -29,7 +29,7 @@ namespace
             jRoot["_type"] = "leaderboard";
             jRoot["_version"] = 1;
 
-            m_stream << std::setw(4) << jRoot << "\n";
+            json_output::WriteLine(m_stream, jRoot);
         }
 
     private:
@@ -2,9 +2,9 @@
 
 #include "Game/T6/CommonT6.h"
 #include "Game/T6/Json/JsonMaterial.h"
+#include "Json/JsonOutput.h"
 #include "MaterialConstantZoneState.h"
 
-#include <iomanip>
 #include <nlohmann/json.hpp>
 
 using namespace nlohmann;
@@ -15,9 +15,9 @@ namespace
     class JsonDumper
     {
     public:
-        JsonDumper(AssetDumpingContext& context, std::ostream& stream)
+        JsonDumper(const MaterialConstantZoneState& materialConstants, std::ostream& stream)
             : m_stream(stream),
-              m_material_constants(*context.GetZoneAssetDumperState<MaterialConstantZoneState>())
+              m_material_constants(materialConstants)
         {
         }
 
@@ -30,7 +30,7 @@ namespace
             jRoot["_type"] = "material";
             jRoot["_version"] = 1;
 
-            m_stream << std::setw(4) << jRoot << "\n";
+            json_output::WriteLine(m_stream, jRoot);
         }
 
     private:
@@ -241,9 +241,9 @@ namespace
 
 namespace T6
 {
-    void DumpMaterialAsJson(std::ostream& stream, const Material* material, AssetDumpingContext& context)
+    void DumpMaterialAsJson(std::ostream& stream, const Material* material, const MaterialConstantZoneState& materialConstants)
     {
-        const JsonDumper dumper(context, stream);
+        const JsonDumper dumper(materialConstants, stream);
         dumper.Dump(material);
     }
 } // namespace T6
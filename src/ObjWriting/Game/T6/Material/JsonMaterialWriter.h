@@ -1,11 +1,17 @@
 #pragma once
 
-#include "Dumping/AssetDumpingContext.h"
 #include "Game/T6/T6.h"
+#include "MaterialConstantZoneState.h"
 
 #include <ostream>
 
 namespace T6
 {
-    void DumpMaterialAsJson(std::ostream& stream, const Material* material, AssetDumpingContext& context);
+    /**
+     * \brief Dumps a material as json. Can be called from multiple threads at once.
+     * \param stream The stream to write the json to.
+     * \param material The material to dump.
+     * \param materialConstants The constant names of the zone. Names must have been extracted before.
+     */
+    void DumpMaterialAsJson(std::ostream& stream, const Material* material, const MaterialConstantZoneState& materialConstants);
 } // namespace T6
@@ -4,9 +4,15 @@
 #include "Game/T6/GameAssetPoolT6.h"
 #include "Game/T6/GameT6.h"
 #include "ObjWriting.h"
-#include "Shader/D3D11ShaderAnalyser.h"
+#include "Shader/ShaderInfoCache.h"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
 
 namespace T6
 {
@@ -14,7 +20,23 @@ namespace T6
     static constexpr const char* GLOBALS_CBUFFER_NAME = "$Globals";
     static constexpr const char* PER_OBJECT_CONSTS_CBUFFER_NAME = "PerObjectConsts";
 
-    const char* KNOWN_CONSTANT_NAMES[]{
+    class KnownName
+    {
+    public:
+        const char* m_name;
+        uint32_t m_hash;
+    };
+
+    template<size_t Count> constexpr std::array<KnownName, Count> HashKnownNames(const char* const (&names)[Count])
+    {
+        std::array<KnownName, Count> knownNames{};
+        for (auto i = 0u; i < Count; i++)
+            knownNames[i] = KnownName{names[i], Common::R_HashString(names[i], 0)};
+
+        return knownNames;
+    }
+
+    constexpr const char* KNOWN_CONSTANT_NAMES[]{
         "AngularVelocityScale",
         "AnimSpeed",
         "Background",
@@ -330,7 +352,7 @@ namespace T6
         "worldViewProjectionMatrix",
     };
 
-    const char* KNOWN_TEXTURE_DEF_NAMES[]{
+    constexpr const char* KNOWN_TEXTURE_DEF_NAMES[]{
         "AddMap",
         "Blip_Mask",
         "BlockNoise",
@@ -478,7 +500,70 @@ namespace T6
         "ui3dSampler",
     };
 
-    void MaterialConstantZoneState::ExtractNamesFromZone()
+    // Hashed at compile time so that only inserting them is left when building the lookup
+    constexpr auto KNOWN_CONSTANT_NAME_HASHES = HashKnownNames(KNOWN_CONSTANT_NAMES);
+    constexpr auto KNOWN_TEXTURE_DEF_NAME_HASHES = HashKnownNames(KNOWN_TEXTURE_DEF_NAMES);
+
+    size_t MaterialConstantZoneState::NameLookup::FindSlot(const uint32_t hash) const
+    {
+        assert(!m_slots.empty());
+
+        // Fibonacci hashing spreads the name hashes over all slots even when they only differ in their high bits
+        const auto slotMask = m_slots.size() - 1u;
+        auto slotIndex = static_cast<size_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15u) >> 32u) & slotMask;
+        while (m_slots[slotIndex].m_name_index != 0u && m_slots[slotIndex].m_hash != hash)
+            slotIndex = (slotIndex + 1u) & slotMask;
+
+        return slotIndex;
+    }
+
+    void MaterialConstantZoneState::NameLookup::Grow()
+    {
+        const auto newSlotCount = m_slots.empty() ? 1024u : m_slots.size() * 2u;
+        const auto oldSlots = std::move(m_slots);
+        m_slots = std::vector<Slot>(newSlotCount, Slot{0u, 0u});
+
+        for (const auto& oldSlot : oldSlots)
+        {
+            if (oldSlot.m_name_index != 0u)
+                m_slots[FindSlot(oldSlot.m_hash)] = oldSlot;
+        }
+    }
+
+    bool MaterialConstantZoneState::NameLookup::Add(const uint32_t hash, std::string name)
+    {
+        // Keep at most half of the slots used to keep probe sequences short
+        if ((m_names.size() + 1u) * 2u > m_slots.size())
+            Grow();
+
+        auto& slot = m_slots[FindSlot(hash)];
+        if (slot.m_name_index != 0u)
+            return false;
+
+        m_names.emplace_back(std::move(name));
+        slot = Slot{hash, static_cast<uint32_t>(m_names.size())};
+
+        return true;
+    }
+
+    const std::string* MaterialConstantZoneState::NameLookup::Find(const uint32_t hash) const
+    {
+        if (m_slots.empty())
+            return nullptr;
+
+        const auto& slot = m_slots[FindSlot(hash)];
+        if (slot.m_name_index == 0u)
+            return nullptr;
+
+        return &m_names[slot.m_name_index - 1u];
+    }
+
+    size_t MaterialConstantZoneState::NameLookup::Size() const
+    {
+        return m_names.size();
+    }
+
+    void MaterialConstantZoneState::ExtractNamesFromZone(const AssetDumpingContext& context)
     {
         if (ObjWriting::Configuration.Verbose)
             std::cout << "Building material constant name lookup...\n";
@@ -487,6 +572,8 @@ namespace T6
 
         AddStaticKnownNames();
 
+        std::unordered_set<const char*> collectedPrograms;
+        std::vector<ShaderProgram> shaders;
         for (const auto* zone : g_GameT6.GetZones())
         {
             const auto* t6AssetPools = dynamic_cast<const GameAssetPoolT6*>(zone->m_pools.get());
@@ -500,27 +587,48 @@ namespace T6
                 for (const auto* technique : techniqueSet->techniques)
                 {
                     if (technique)
-                        ExtractNamesFromTechnique(technique);
+                        CollectShadersOfTechnique(technique, collectedPrograms, shaders);
                 }
             }
         }
 
+        // Analysing the shaders is the expensive part and is independent for each shader
+        std::vector<std::shared_ptr<const d3d11::ShaderInfo>> shaderInfos(shaders.size());
+        std::vector<std::function<void()>> jobs;
+        jobs.reserve(shaders.size());
+        for (auto i = 0u; i < shaders.size(); i++)
+        {
+            jobs.emplace_back(
+                [&shaders, &shaderInfos, i]
+                {
+                    shaderInfos[i] = ShaderInfoCache::Instance.GetShaderInfo(reinterpret_cast<const uint8_t*>(shaders[i].m_program), shaders[i].m_program_size);
+                });
+        }
+        context.RunJobs(jobs);
+
+        // Names are added in the order of the shaders so the first name for a hash does not depend on the order the jobs finished in
+        for (const auto& shaderInfo : shaderInfos)
+        {
+            if (shaderInfo)
+                ExtractNamesFromShader(*shaderInfo);
+        }
+
         const auto end = std::chrono::high_resolution_clock::now();
 
         if (ObjWriting::Configuration.Verbose)
         {
             const auto durationInMs = std::chrono::duration_cast<std::chrono::milliseconds>(end - begin);
-            std::cout << "Built material constant name lookup in " << durationInMs.count() << "ms: " << m_constant_names_from_shaders.size()
-                      << " constant names; " << m_texture_def_names_from_shaders.size() << " texture def names\n";
+            std::cout << "Built material constant name lookup in " << durationInMs.count() << "ms: " << m_constant_names_from_shaders.Size()
+                      << " constant names; " << m_texture_def_names_from_shaders.Size() << " texture def names\n";
         }
     }
 
     bool MaterialConstantZoneState::GetConstantName(const unsigned hash, std::string& constantName) const
     {
-        const auto existingConstantName = m_constant_names_from_shaders.find(hash);
-        if (existingConstantName != m_constant_names_from_shaders.end())
+        const auto* existingConstantName = m_constant_names_from_shaders.Find(hash);
+        if (existingConstantName)
         {
-            constantName = existingConstantName->second;
+            constantName = *existingConstantName;
             return true;
         }
 
@@ -529,17 +637,19 @@ namespace T6
 
     bool MaterialConstantZoneState::GetTextureDefName(const unsigned hash, std::string& textureDefName) const
     {
-        const auto existingTextureDefName = m_texture_def_names_from_shaders.find(hash);
-        if (existingTextureDefName != m_texture_def_names_from_shaders.end())
+        const auto* existingTextureDefName = m_texture_def_names_from_shaders.Find(hash);
+        if (existingTextureDefName)
         {
-            textureDefName = existingTextureDefName->second;
+            textureDefName = *existingTextureDefName;
             return true;
         }
 
         return false;
     }
 
-    void MaterialConstantZoneState::ExtractNamesFromTechnique(const MaterialTechnique* technique)
+    void MaterialConstantZoneState::CollectShadersOfTechnique(const MaterialTechnique* technique,
+                                                              std::unordered_set<const char*>& collectedPrograms,
+                                                              std::vector<ShaderProgram>& shaders)
     {
         const auto existingTechnique = m_dumped_techniques.find(technique);
         if (existingTechnique != m_dumped_techniques.end())
@@ -551,45 +661,41 @@ namespace T6
         {
             const auto& pass = technique->passArray[passIndex];
 
-            if (pass.vertexShader && pass.vertexShader->prog.loadDef.program)
-                ExtractNamesFromShader(pass.vertexShader->prog.loadDef.program, pass.vertexShader->prog.loadDef.programSize);
+            if (pass.vertexShader && pass.vertexShader->prog.loadDef.program && collectedPrograms.emplace(pass.vertexShader->prog.loadDef.program).second)
+                shaders.emplace_back(ShaderProgram{pass.vertexShader->prog.loadDef.program, pass.vertexShader->prog.loadDef.programSize});
 
-            if (pass.pixelShader && pass.pixelShader->prog.loadDef.program)
-                ExtractNamesFromShader(pass.pixelShader->prog.loadDef.program, pass.pixelShader->prog.loadDef.programSize);
+            if (pass.pixelShader && pass.pixelShader->prog.loadDef.program && collectedPrograms.emplace(pass.pixelShader->prog.loadDef.program).second)
+                shaders.emplace_back(ShaderProgram{pass.pixelShader->prog.loadDef.program, pass.pixelShader->prog.loadDef.programSize});
         }
     }
 
-    void MaterialConstantZoneState::ExtractNamesFromShader(const char* shader, const size_t shaderSize)
+    void MaterialConstantZoneState::ExtractNamesFromShader(const d3d11::ShaderInfo& shaderInfo)
     {
-        const auto shaderInfo = d3d11::ShaderAnalyser::GetShaderInfo(reinterpret_cast<const uint8_t*>(shader), shaderSize);
-        if (!shaderInfo)
-            return;
-
-        const auto globalsConstantBuffer = std::ranges::find_if(std::as_const(shaderInfo->m_constant_buffers),
+        const auto globalsConstantBuffer = std::ranges::find_if(std::as_const(shaderInfo.m_constant_buffers),
                                                                 [](const d3d11::ConstantBuffer& constantBuffer)
                                                                 {
                                                                     return constantBuffer.m_name == GLOBALS_CBUFFER_NAME;
                                                                 });
 
-        const auto perObjectConsts = std::ranges::find_if(std::as_const(shaderInfo->m_constant_buffers),
+        const auto perObjectConsts = std::ranges::find_if(std::as_const(shaderInfo.m_constant_buffers),
                                                           [](const d3d11::ConstantBuffer& constantBuffer)
                                                           {
                                                               return constantBuffer.m_name == PER_OBJECT_CONSTS_CBUFFER_NAME;
                                                           });
 
-        if (globalsConstantBuffer != shaderInfo->m_constant_buffers.end())
+        if (globalsConstantBuffer != shaderInfo.m_constant_buffers.end())
         {
             for (const auto& variable : globalsConstantBuffer->m_variables)
                 AddConstantName(variable.m_name);
         }
 
-        if (perObjectConsts != shaderInfo->m_constant_buffers.end())
+        if (perObjectConsts != shaderInfo.m_constant_buffers.end())
         {
             for (const auto& variable : perObjectConsts->m_variables)
                 AddConstantName(variable.m_name);
         }
 
-        for (const auto& boundResource : shaderInfo->m_bound_resources)
+        for (const auto& boundResource : shaderInfo.m_bound_resources)
         {
             if (boundResource.m_type == d3d11::BoundResourceType::SAMPLER || boundResource.m_type == d3d11::BoundResourceType::TEXTURE)
             {
@@ -609,28 +715,21 @@ namespace T6
 
     void MaterialConstantZoneState::AddStaticKnownNames()
     {
-        for (const auto* knownConstantName : KNOWN_CONSTANT_NAMES)
-            AddConstantName(knownConstantName);
-        for (const auto* knownTextureDefName : KNOWN_TEXTURE_DEF_NAMES)
-            AddTextureDefName(knownTextureDefName);
+        for (const auto& knownConstantName : KNOWN_CONSTANT_NAME_HASHES)
+            m_constant_names_from_shaders.Add(knownConstantName.m_hash, knownConstantName.m_name);
+        for (const auto& knownTextureDefName : KNOWN_TEXTURE_DEF_NAME_HASHES)
+            m_texture_def_names_from_shaders.Add(knownTextureDefName.m_hash, knownTextureDefName.m_name);
     }
 
     void MaterialConstantZoneState::AddConstantName(std::string constantName)
     {
         const auto hash = Common::R_HashString(constantName.c_str(), 0);
-        if (m_constant_names_from_shaders.contains(hash))
-            return;
-
-        m_constant_names_from_shaders.emplace(hash, std::move(constantName));
+        m_constant_names_from_shaders.Add(hash, std::move(constantName));
     }
 
     bool MaterialConstantZoneState::AddTextureDefName(std::string textureDefName)
     {
         const auto hash = Common::R_HashString(textureDefName.c_str(), 0);
-        if (m_texture_def_names_from_shaders.contains(hash))
-            return false;
-
-        m_texture_def_names_from_shaders.emplace(hash, std::move(textureDefName));
-        return true;
+        return m_texture_def_names_from_shaders.Add(hash, std::move(textureDefName));
     }
 } // namespace T6
@@ -1,30 +1,83 @@
 #pragma once
 
+#include "Dumping/AssetDumpingContext.h"
 #include "Dumping/IZoneAssetDumperState.h"
 #include "Game/T6/T6.h"
+#include "Shader/D3D11ShaderAnalyser.h"
+#include "Utils/ClassUtils.h"
 
+#include <cstdint>
 #include <string>
-#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace T6
 {
+    /**
+     * \brief Lookup of material constant and texture def names by their hash.
+     * The lookup is built once per zone before dumping materials and only read afterwards,
+     * so looking up names can be done from multiple threads at once.
+     */
     class MaterialConstantZoneState final : public IZoneAssetDumperState
     {
+        /**
+         * \brief Hash map from name hashes to names using open addressing.
+         * Keeps all slots in one array, which makes lookups cheaper than with node based maps.
+         */
+        class NameLookup
+        {
+            class Slot
+            {
+            public:
+                uint32_t m_hash;
+                // 0 for empty slots, otherwise index of the name + 1
+                uint32_t m_name_index;
+            };
+
+            std::vector<Slot> m_slots;
+            std::vector<std::string> m_names;
+
+            _NODISCARD size_t FindSlot(uint32_t hash) const;
+            void Grow();
+
+        public:
+            /**
+             * \brief Adds a name if there is no name for its hash yet.
+             * \return \c true if the name was added, \c false if there already is a name for the hash.
+             */
+            bool Add(uint32_t hash, std::string name);
+            _NODISCARD const std::string* Find(uint32_t hash) const;
+            _NODISCARD size_t Size() const;
+        };
+
+        class ShaderProgram
+        {
+        public:
+            const char* m_program;
+            size_t m_program_size;
+        };
+
     public:
-        void ExtractNamesFromZone();
+        /**
+         * \brief Builds the lookup from known names and the shaders of all loaded zones.
+         * Shaders are analysed on the worker pool of the context if it has one.
+         * \param context The context of the dump.
+         */
+        void ExtractNamesFromZone(const AssetDumpingContext& context);
         bool GetConstantName(unsigned hash, std::string& constantName) const;
         bool GetTextureDefName(unsigned hash, std::string& textureDefName) const;
 
     private:
-        void ExtractNamesFromTechnique(const MaterialTechnique* technique);
-        void ExtractNamesFromShader(const char* shader, size_t shaderSize);
+        void CollectShadersOfTechnique(const MaterialTechnique* technique,
+                                       std::unordered_set<const char*>& collectedPrograms,
+                                       std::vector<ShaderProgram>& shaders);
+        void ExtractNamesFromShader(const d3d11::ShaderInfo& shaderInfo);
         void AddStaticKnownNames();
         void AddConstantName(std::string constantName);
         bool AddTextureDefName(std::string textureDefName);
 
         std::unordered_set<const MaterialTechnique*> m_dumped_techniques;
-        std::unordered_map<unsigned, std::string> m_constant_names_from_shaders;
-        std::unordered_map<unsigned, std::string> m_texture_def_names_from_shaders;
+        NameLookup m_constant_names_from_shaders;
+        NameLookup m_texture_def_names_from_shaders;
     };
 } // namespace T6
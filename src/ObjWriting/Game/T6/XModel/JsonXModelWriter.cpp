@@ -2,11 +2,11 @@
 
 #include "Game/T6/CommonT6.h"
 #include "Game/T6/Json/JsonXModel.h"
+#include "Json/JsonOutput.h"
 #include "ObjWriting.h"
 
 #include <cassert>
 #include <format>
-#include <iomanip>
 #include <nlohmann/json.hpp>
 
 using namespace nlohmann;
@@ -31,7 +31,7 @@ namespace
             jRoot["_type"] = "xmodel";
             jRoot["_version"] = 1;
 
-            m_stream << std::setw(4) << jRoot << "\n";
+            json_output::WriteLine(m_stream, jRoot);
         }
 
     private:
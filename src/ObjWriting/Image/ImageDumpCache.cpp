@@ -0,0 +1,163 @@
+#include "ImageDumpCache.h"
+
+#include "Dumping/AssetDumpingContext.h"
+
+#include <cstring>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr uint64_t HASH_SEED = 0x27D4EB2F165667C5ull;
+    constexpr uint64_t HASH_PRIME_1 = 0x9E3779B185EBCA87ull;
+    constexpr uint64_t HASH_PRIME_2 = 0xC2B2AE3D27D4EB4Full;
+
+    // Images are megabytes in size, so their data is hashed a whole word at a time instead of byte by byte
+    uint64_t HashData(uint64_t hash, const uint8_t* data, const size_t size)
+    {
+        size_t offset = 0u;
+        for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t))
+        {
+            uint64_t word;
+            std::memcpy(&word, &data[offset], sizeof(word));
+
+            hash ^= word * HASH_PRIME_2;
+            hash = (hash << 31u | hash >> 33u) * HASH_PRIME_1;
+        }
+
+        for (; offset < size; offset++)
+        {
+            hash ^= data[offset] * HASH_PRIME_2;
+            hash = (hash << 31u | hash >> 33u) * HASH_PRIME_1;
+        }
+
+        hash ^= hash >> 29u;
+        hash *= HASH_PRIME_2;
+        hash ^= hash >> 32u;
+
+        return hash;
+    }
+
+    uint64_t HashValue(const uint64_t hash, const uint64_t value)
+    {
+        return HashData(hash, reinterpret_cast<const uint8_t*>(&value), sizeof(value));
+    }
+} // namespace
+
+size_t ImageDumpCache::KeyHasher::operator()(const Key& key) const noexcept
+{
+    return static_cast<size_t>(key.m_hash ^ key.m_size ^ key.m_writer_type.hash_code());
+}
+
+ImageDumpCache::ImageDumpCache(const bool hardlinkDuplicates)
+    : m_hardlink_duplicates(hardlinkDuplicates),
+      m_skipped_count(0u),
+      m_linked_count(0u)
+{
+}
+
+ImageDumpCache::Key ImageDumpCache::CreateKey(const IImageWriter& writer, Texture* texture)
+{
+    // The layout of the texture is part of the hash since the same data can be a different image with another format or size
+    auto hash = HashValue(HASH_SEED, static_cast<uint64_t>(texture->GetTextureType()));
+    hash = HashValue(hash, static_cast<uint64_t>(texture->GetFormat()->GetId()));
+    hash = HashValue(hash, texture->GetWidth());
+    hash = HashValue(hash, texture->GetHeight());
+    hash = HashValue(hash, texture->GetDepth());
+
+    size_t size = 0u;
+    const auto mipCount = texture->HasMipMaps() ? texture->GetMipMapCount() : 1;
+    for (auto mipLevel = 0; mipLevel < mipCount; mipLevel++)
+    {
+        // All faces of a mip level are stored consecutively
+        const auto mipLevelSize = texture->GetSizeOfMipLevel(mipLevel) * texture->GetFaceCount();
+        hash = HashData(hash, texture->GetBufferForMipLevel(mipLevel), mipLevelSize);
+        size += mipLevelSize;
+    }
+
+    return Key{hash, size, typeid(writer)};
+}
+
+void ImageDumpCache::DumpImage(const AssetDumpingContext& context, const std::string& fileName, IImageWriter& writer, Texture* texture)
+{
+    const auto key = CreateKey(writer, texture);
+    const auto path = fs::absolute(fs::path(context.m_base_path) / fileName).lexically_normal();
+    const auto pathString = path.string();
+
+    fs::path dumpedPath;
+    {
+        std::lock_guard lock(m_mutex);
+
+        const auto existingKey = m_keys_by_path.find(pathString);
+        if (existingKey != m_keys_by_path.end() && existingKey->second == key)
+        {
+            m_skipped_count++;
+            return;
+        }
+
+        // A different image replaces the file, which must no longer be used for images identical to the one it contained before
+        if (existingKey != m_keys_by_path.end())
+        {
+            const auto replacedDump = m_dumped_paths.find(existingKey->second);
+            if (replacedDump != m_dumped_paths.end() && replacedDump->second == path)
+                m_dumped_paths.erase(replacedDump);
+        }
+
+        m_keys_by_path.insert_or_assign(pathString, key);
+
+        const auto existingDump = m_dumped_paths.find(key);
+        if (existingDump != m_dumped_paths.end())
+            dumpedPath = existingDump->second;
+    }
+
+    if (!m_hardlink_duplicates)
+    {
+        const auto assetFile = context.OpenAssetFile(fileName);
+        if (assetFile)
+            writer.DumpImage(*assetFile, texture);
+
+        return;
+    }
+
+    // Writing through an existing link would change the contents of every file linked to it
+    std::error_code ec;
+    fs::remove(path, ec);
+
+    if (!dumpedPath.empty())
+    {
+        fs::create_directories(path.parent_path(), ec);
+        fs::create_hard_link(dumpedPath, path, ec);
+        if (!ec)
+        {
+            m_linked_count++;
+            return;
+        }
+    }
+
+    // Other threads may only link to the file once it is completely written, so it must not wait on the file writer
+    {
+        const auto assetFile = context.OpenAssetFileUnbuffered(fileName);
+        if (!assetFile)
+            return;
+
+        writer.DumpImage(*assetFile, texture);
+        assetFile->flush();
+        if (assetFile->fail())
+            return;
+    }
+
+    std::lock_guard lock(m_mutex);
+
+    // Another image may have replaced the file while it was written
+    const auto currentKey = m_keys_by_path.find(pathString);
+    if (currentKey != m_keys_by_path.end() && currentKey->second == key)
+        m_dumped_paths.try_emplace(key, path);
+}
+
+void ImageDumpCache::PrintSummary(std::ostream& stream) const
+{
+    stream << "Skipped " << m_skipped_count.load() << " images that were already dumped";
+    if (m_hardlink_duplicates)
+        stream << " and linked " << m_linked_count.load() << " identical images";
+    stream << "\n";
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "IImageWriter.h"
+#include "Image/Texture.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+
+class AssetDumpingContext;
+
+/**
+ * \brief Remembers which image files were dumped with which contents during a session to not write identical images more than once.
+ * Images are identified by a hash of their texture data and the writer that dumps them. Can be used from multiple threads and zones at once.
+ */
+class ImageDumpCache
+{
+    class Key
+    {
+    public:
+        uint64_t m_hash;
+        size_t m_size;
+        std::type_index m_writer_type;
+
+        friend bool operator==(const Key& lhs, const Key& rhs) = default;
+    };
+
+    class KeyHasher
+    {
+    public:
+        size_t operator()(const Key& key) const noexcept;
+    };
+
+    bool m_hardlink_duplicates;
+    std::unordered_map<Key, std::filesystem::path, KeyHasher> m_dumped_paths;
+    std::unordered_map<std::string, Key> m_keys_by_path;
+    std::mutex m_mutex;
+
+    std::atomic_size_t m_skipped_count;
+    std::atomic_size_t m_linked_count;
+
+    static Key CreateKey(const IImageWriter& writer, Texture* texture);
+
+public:
+    /**
+     * \brief Creates an empty cache.
+     * \param hardlinkDuplicates Whether images that were already dumped to another file are hard linked to it instead of being written again.
+     */
+    explicit ImageDumpCache(bool hardlinkDuplicates);
+
+    /**
+     * \brief Dumps an image to a file relative to the base path of the context unless an identical image was already dumped to the same file.
+     * When hard linking duplicates, an identical image that was dumped to another file is linked to that file instead. Falls back to writing the image if linking fails.
+     * Files are only linked to once they were completely written, so they are not written with the file writer of the context.
+     * \param context The context of the zone the image belongs to.
+     * \param fileName The name of the file to dump the image to.
+     * \param writer The writer to dump the image with.
+     * \param texture The texture of the image.
+     */
+    void DumpImage(const AssetDumpingContext& context, const std::string& fileName, IImageWriter& writer, Texture* texture);
+
+    /**
+     * \brief Prints how many images were skipped and linked because they were dumped before.
+     * \param stream The stream to print to.
+     */
+    void PrintSummary(std::ostream& stream) const;
+};
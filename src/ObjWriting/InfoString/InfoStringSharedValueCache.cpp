@@ -0,0 +1,18 @@
+#include "InfoStringSharedValueCache.h"
+
+const std::vector<std::string>* InfoStringSharedValueCache::Find(const void* subStructure)
+{
+    std::lock_guard lock(m_mutex);
+
+    const auto foundValues = m_values.find(subStructure);
+    if (foundValues == m_values.end())
+        return nullptr;
+
+    return &foundValues->second;
+}
+
+void InfoStringSharedValueCache::Add(const void* subStructure, std::vector<std::string> values)
+{
+    std::lock_guard lock(m_mutex);
+    m_values.try_emplace(subStructure, std::move(values));
+}
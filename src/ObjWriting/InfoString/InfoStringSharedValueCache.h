@@ -0,0 +1,40 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \brief Remembers the converted info string values of a sub structure that is shared by multiple converted structures,
+ * like a weapon def that is used by multiple weapon variants, so its fields only have to be converted once.
+ */
+class InfoStringSharedValueCache
+{
+    std::unordered_map<const void*, std::vector<std::string>> m_values;
+    std::mutex m_mutex;
+
+public:
+    InfoStringSharedValueCache() = default;
+    ~InfoStringSharedValueCache() = default;
+    InfoStringSharedValueCache(const InfoStringSharedValueCache& other) = delete;
+    InfoStringSharedValueCache(InfoStringSharedValueCache&& other) noexcept = delete;
+    InfoStringSharedValueCache& operator=(const InfoStringSharedValueCache& other) = delete;
+    InfoStringSharedValueCache& operator=(InfoStringSharedValueCache&& other) noexcept = delete;
+
+    /**
+     * \brief Searches for the converted values of a sub structure. Can be called from multiple threads at once.
+     * \param subStructure The shared sub structure that was converted.
+     * \return The converted values in the order of their fields or \c nullptr if the sub structure was not converted yet.
+     * The values stay valid for the lifetime of the cache.
+     */
+    const std::vector<std::string>* Find(const void* subStructure);
+
+    /**
+     * \brief Adds the converted values of a sub structure. Can be called from multiple threads at once.
+     * When the sub structure was already added concurrently the previously added values are kept.
+     * \param subStructure The shared sub structure that was converted.
+     * \param values The converted values in the order of their fields.
+     */
+    void Add(const void* subStructure, std::vector<std::string> values);
+};
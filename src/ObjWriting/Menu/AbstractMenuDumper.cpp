@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cmath>
 #include <sstream>
+#include <string_view>
 
 AbstractMenuDumper::AbstractMenuDumper(std::ostream& stream)
     : m_stream(stream),
@@ -24,10 +25,22 @@ void AbstractMenuDumper::DecIndent()
         m_indent--;
 }
 
+void AbstractMenuDumper::WriteSpaces(size_t count) const
+{
+    static constexpr std::string_view SPACES = "                                                                ";
+
+    // Almost every line of a menu is indented and padded so spaces are written in as few calls as possible
+    while (count > 0)
+    {
+        const auto writeSize = std::min(count, SPACES.size());
+        m_stream.write(SPACES.data(), static_cast<std::streamsize>(writeSize));
+        count -= writeSize;
+    }
+}
+
 void AbstractMenuDumper::Indent() const
 {
-    for (auto i = 0u; i < m_indent; i++)
-        m_stream << "    ";
+    WriteSpaces(m_indent * 4u);
 }
 
 void AbstractMenuDumper::StartScope(const std::string& scopeName)
@@ -175,11 +188,7 @@ void AbstractMenuDumper::WriteKey(const std::string& keyName) const
     m_stream << keyName;
 
     if (keyName.size() < MENU_KEY_SPACING)
-    {
-        const auto spacingLength = MENU_KEY_SPACING - keyName.size();
-        for (auto i = 0u; i < spacingLength; i++)
-            m_stream << " ";
-    }
+        WriteSpaces(MENU_KEY_SPACING - keyName.size());
 }
 
 void AbstractMenuDumper::WriteStringProperty(const std::string& propertyKey, const std::string& propertyValue) const
@@ -17,6 +17,7 @@ protected:
     std::ostream& m_stream;
     size_t m_indent;
 
+    void WriteSpaces(size_t count) const;
     void IncIndent();
     void DecIndent();
     void Indent() const;
@@ -12,3 +12,20 @@ void MenuDumpingZoneState::CreateMenuDumpingState(const void* menuDef, std::stri
 {
     m_menu_dumping_state_map.emplace(std::make_pair(menuDef, MenuDumpingState(std::move(path), aliasMenuList)));
 }
+
+const std::string* MenuDumpingZoneState::FindStatementText(const void* statement)
+{
+    std::lock_guard lock(m_statement_texts_mutex);
+
+    const auto foundText = m_statement_texts.find(statement);
+    if (foundText == m_statement_texts.end())
+        return nullptr;
+
+    return &foundText->second;
+}
+
+void MenuDumpingZoneState::AddStatementText(const void* statement, std::string text)
+{
+    std::lock_guard lock(m_statement_texts_mutex);
+    m_statement_texts.try_emplace(statement, std::move(text));
+}
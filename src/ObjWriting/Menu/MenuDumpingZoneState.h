@@ -2,6 +2,9 @@
 #include "Dumping/IZoneAssetDumperState.h"
 
 #include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace menu
 {
@@ -20,5 +23,23 @@ namespace menu
         std::map<const void*, MenuDumpingState> m_menu_dumping_state_map;
 
         void CreateMenuDumpingState(const void* menuDef, std::string path, const void* aliasMenuList);
+
+        /**
+         * \brief Searches for the text of a statement that was already written by any menu of the zone. Can be called from multiple threads at once.
+         * \param statement The statement to search for.
+         * \return The written text of the statement or \c nullptr if it was not written yet. The text stays valid for the lifetime of the state.
+         */
+        const std::string* FindStatementText(const void* statement);
+
+        /**
+         * \brief Remembers the written text of a statement for other menus using the same statement. Can be called from multiple threads at once.
+         * \param statement The statement that was written.
+         * \param text The written text of the statement.
+         */
+        void AddStatementText(const void* statement, std::string text);
+
+    private:
+        std::unordered_map<const void*, std::string> m_statement_texts;
+        std::mutex m_statement_texts_mutex;
     };
 } // namespace menu
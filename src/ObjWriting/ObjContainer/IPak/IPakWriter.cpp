@@ -4,11 +4,15 @@
 #include "Game/T6/GameT6.h"
 #include "ObjContainer/IPak/IPakTypes.h"
 #include "Utils/Alignment.h"
+#include "Utils/ThreadPool.h"
 
 #include <algorithm>
+#include <deque>
+#include <future>
 #include <iostream>
 #include <minilzo.h>
 #include <sstream>
+#include <unordered_map>
 #include <zlib.h>
 
 class IPakWriterImpl final : public IPakWriter
@@ -18,10 +22,28 @@ class IPakWriterImpl final : public IPakWriter
 
     inline static const std::string PAD_DATA = std::string(256, '\xA7');
 
+    class CompressedCommand
+    {
+    public:
+        std::unique_ptr<char[]> m_data;
+        lzo_uint m_size;
+        bool m_compressed;
+    };
+
+    class SpeculativeCommand
+    {
+    public:
+        size_t m_data_offset;
+        size_t m_data_size;
+        std::future<CompressedCommand> m_result;
+    };
+
 public:
-    explicit IPakWriterImpl(std::ostream& stream, ISearchPath* assetSearchPath)
+    IPakWriterImpl(std::ostream& stream, ISearchPath* assetSearchPath, std::istream* seedStream)
         : m_stream(stream),
           m_asset_search_path(assetSearchPath),
+          m_seed_stream(seedStream),
+          m_seed_data_section_offset(0),
           m_current_offset(0),
           m_total_size(0),
           m_data_section_offset(0),
@@ -31,10 +53,9 @@ public:
           m_file_offset(0u),
           m_chunk_buffer_window_start(0),
           m_current_block{},
-          m_current_block_header_offset(0)
+          m_current_block_header_offset(0),
+          m_compression_pool(0u)
     {
-        m_decompressed_buffer = std::make_unique<char[]>(ipak_consts::IPAK_CHUNK_SIZE);
-        m_lzo_work_buffer = std::make_unique<char[]>(LZO1X_1_MEM_COMPRESS);
     }
 
     void AddImage(std::string imageName) override
@@ -185,6 +206,77 @@ public:
         GoTo(m_current_offset + sizeof(IPakDataBlockHeader));
     }
 
+    static CompressedCommand CompressCommand(const unsigned char* data, const size_t dataSize)
+    {
+        // Every compression worker keeps its own work memory
+        thread_local const auto workMemory = std::make_unique<char[]>(LZO1X_1_MEM_COMPRESS);
+
+        // Worst case size of lzo output for incompressible data
+        const auto outputCapacity = dataSize + dataSize / 16u + 64u + 3u;
+
+        CompressedCommand command;
+        command.m_data = std::make_unique<char[]>(outputCapacity);
+        command.m_size = static_cast<lzo_uint>(outputCapacity);
+
+        const auto result = lzo1x_1_compress(data, dataSize, reinterpret_cast<unsigned char*>(command.m_data.get()), &command.m_size, workMemory.get());
+        command.m_compressed = result == LZO_E_OK && command.m_size < dataSize;
+
+        return command;
+    }
+
+    void QueueCommandCompression(const unsigned char* data, const size_t dataOffset, const size_t commandSize)
+    {
+        auto task = std::make_shared<std::packaged_task<CompressedCommand()>>(
+            [data, dataOffset, commandSize]
+            {
+                return CompressCommand(&data[dataOffset], commandSize);
+            });
+
+        m_speculative_commands.emplace_back(SpeculativeCommand{dataOffset, commandSize, task->get_future()});
+        m_compression_pool.Enqueue(
+            [task]
+            {
+                (*task)();
+            });
+    }
+
+    void DiscardSpeculativeCommand()
+    {
+        // The compression job still references the data so it needs to finish before it can be discarded
+        m_speculative_commands.front().m_result.wait();
+        m_speculative_commands.pop_front();
+    }
+
+    CompressedCommand TakeCompressedCommand(const unsigned char* data, const size_t dataSize, const size_t dataOffset, const size_t commandSize)
+    {
+        // The layout of commands depends on the compressed size of previous commands, so following commands are compressed speculatively
+        // assuming they are not cut short by the chunk buffer window. Only speculation matching the actual layout is used which keeps the output identical.
+        while (!m_speculative_commands.empty()
+               && (m_speculative_commands.front().m_data_offset != dataOffset || m_speculative_commands.front().m_data_size != commandSize))
+        {
+            DiscardSpeculativeCommand();
+        }
+
+        if (m_speculative_commands.empty())
+            QueueCommandCompression(data, dataOffset, commandSize);
+
+        const auto speculationDepth = m_compression_pool.GetThreadCount() * 2u;
+        while (m_speculative_commands.size() < speculationDepth)
+        {
+            const auto& lastCommand = m_speculative_commands.back();
+            const auto nextDataOffset = lastCommand.m_data_offset + lastCommand.m_data_size;
+            if (nextDataOffset >= dataSize)
+                break;
+
+            QueueCommandCompression(data, nextDataOffset, std::min<size_t>(dataSize - nextDataOffset, ipak_consts::IPAK_COMMAND_DEFAULT_SIZE));
+        }
+
+        auto command = m_speculative_commands.front().m_result.get();
+        m_speculative_commands.pop_front();
+
+        return command;
+    }
+
     void WriteChunkData(const void* data, const size_t dataSize)
     {
         auto dataOffset = 0u;
@@ -213,20 +305,15 @@ public:
             auto writeUncompressed = true;
             if (USE_COMPRESSION)
             {
-                auto outLen = static_cast<lzo_uint>(ipak_consts::IPAK_CHUNK_SIZE);
-                const auto result = lzo1x_1_compress(&static_cast<const unsigned char*>(data)[dataOffset],
-                                                     commandSize,
-                                                     reinterpret_cast<unsigned char*>(m_decompressed_buffer.get()),
-                                                     &outLen,
-                                                     m_lzo_work_buffer.get());
-
-                if (result == LZO_E_OK && outLen < commandSize)
+                const auto compressedCommand = TakeCompressedCommand(static_cast<const unsigned char*>(data), dataSize, dataOffset, commandSize);
+
+                if (compressedCommand.m_compressed)
                 {
                     writeUncompressed = false;
-                    Write(m_decompressed_buffer.get(), outLen);
+                    Write(compressedCommand.m_data.get(), compressedCommand.m_size);
 
                     const auto currentCommand = m_current_block.countAndOffset.count;
-                    m_current_block.commands[currentCommand].size = static_cast<uint32_t>(outLen);
+                    m_current_block.commands[currentCommand].size = static_cast<uint32_t>(compressedCommand.m_size);
                     m_current_block.commands[currentCommand].compressed = ipak_consts::IPAK_COMMAND_COMPRESSED;
                     m_current_block.countAndOffset.count = currentCommand + 1u;
                 }
@@ -245,6 +332,89 @@ public:
             dataOffset += commandSize;
             m_file_offset += commandSize;
         }
+
+        while (!m_speculative_commands.empty())
+            DiscardSpeculativeCommand();
+    }
+
+    bool ReadSeedIndex()
+    {
+        m_seed_stream->seekg(0, std::ios::beg);
+
+        IPakHeader header{};
+        m_seed_stream->read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (m_seed_stream->gcount() != sizeof(header) || header.magic != ipak_consts::IPAK_MAGIC || header.version != ipak_consts::IPAK_VERSION)
+            return false;
+
+        const IPakSection* dataSection = nullptr;
+        const IPakSection* indexSection = nullptr;
+        std::vector<IPakSection> sections(header.sectionCount);
+        for (auto& section : sections)
+        {
+            m_seed_stream->read(reinterpret_cast<char*>(&section), sizeof(section));
+            if (m_seed_stream->gcount() != sizeof(section))
+                return false;
+
+            if (section.type == ipak_consts::IPAK_DATA_SECTION)
+                dataSection = &section;
+            else if (section.type == ipak_consts::IPAK_INDEX_SECTION)
+                indexSection = &section;
+        }
+
+        if (dataSection == nullptr || indexSection == nullptr)
+            return false;
+
+        m_seed_data_section_offset = dataSection->offset;
+
+        m_seed_stream->seekg(indexSection->offset, std::ios::beg);
+        for (auto itemIndex = 0u; itemIndex < indexSection->itemCount; itemIndex++)
+        {
+            IPakIndexEntry indexEntry{};
+            m_seed_stream->read(reinterpret_cast<char*>(&indexEntry), sizeof(indexEntry));
+            if (m_seed_stream->gcount() != sizeof(indexEntry))
+                return false;
+
+            m_seed_entries.emplace(indexEntry.key.combinedKey, indexEntry);
+        }
+
+        return true;
+    }
+
+    bool CopySeedEntry(const IPakIndexEntry& seedEntry, IPakIndexEntry& indexEntry)
+    {
+        // The previous image was already completed and the copied data contains its own block headers
+        FlushBlock();
+        m_current_block_header_offset = 0;
+        AlignToBlockHeader();
+
+        // The written data only depends on where inside a chunk it starts, so it can be copied as is when starting at the same offset inside a chunk
+        const auto seedOffset = m_seed_data_section_offset + static_cast<int64_t>(seedEntry.offset);
+        const auto chunkSize = static_cast<int64_t>(ipak_consts::IPAK_CHUNK_SIZE);
+        auto targetOffset = utils::AlignToPrevious(m_current_offset, chunkSize) + seedOffset % chunkSize;
+        if (targetOffset < m_current_offset)
+            targetOffset += chunkSize;
+
+        Pad(static_cast<size_t>(targetOffset - m_current_offset));
+
+        m_seed_stream->seekg(seedOffset, std::ios::beg);
+
+        char buffer[ipak_consts::IPAK_CHUNK_SIZE];
+        auto sizeLeft = static_cast<size_t>(seedEntry.size);
+        while (sizeLeft > 0)
+        {
+            const auto readSize = std::min(sizeLeft, sizeof(buffer));
+            m_seed_stream->read(buffer, static_cast<std::streamsize>(readSize));
+            if (static_cast<size_t>(m_seed_stream->gcount()) != readSize)
+                return false;
+
+            Write(buffer, readSize);
+            sizeLeft -= readSize;
+        }
+
+        indexEntry.offset = static_cast<uint32_t>(targetOffset - m_data_section_offset);
+        indexEntry.size = seedEntry.size;
+
+        return true;
     }
 
     void StartNewFile()
@@ -266,12 +436,25 @@ public:
         const auto nameHash = T6::Common::R_HashString(imageName.c_str(), 0);
         const auto dataHash = static_cast<unsigned>(crc32(0u, reinterpret_cast<const Bytef*>(imageData.get()), imageSize));
 
-        StartNewFile();
-        const auto startOffset = m_current_block_header_offset;
-
         IPakIndexEntry indexEntry;
         indexEntry.key.nameHash = nameHash;
         indexEntry.key.dataHash = dataHash & 0x1FFFFFFF;
+
+        if (const auto existingSeedEntry = m_seed_entries.find(indexEntry.key.combinedKey); existingSeedEntry != m_seed_entries.end())
+        {
+            if (CopySeedEntry(existingSeedEntry->second, indexEntry))
+            {
+                m_index_entries.emplace_back(indexEntry);
+                return true;
+            }
+
+            std::cerr << "Could not copy image \"" << imageName << "\" from previous IPak, compressing it again\n";
+            m_seed_stream->clear();
+        }
+
+        StartNewFile();
+        const auto startOffset = m_current_block_header_offset;
+
         indexEntry.offset = static_cast<uint32_t>(startOffset - m_data_section_offset);
 
         WriteChunkData(imageData.get(), imageSize);
@@ -340,6 +523,12 @@ public:
 
     bool Write() override
     {
+        if (m_seed_stream && !ReadSeedIndex())
+        {
+            std::cerr << "Could not read index of previous IPak, all images are compressed again\n";
+            m_seed_entries.clear();
+        }
+
         // We will write the header and sections later since they need complementary data
         GoTo(sizeof(IPakHeader) + sizeof(IPakSection) * SECTION_COUNT);
         AlignToChunk();
@@ -361,6 +550,10 @@ private:
     ISearchPath* m_asset_search_path;
     std::vector<std::string> m_images;
 
+    std::istream* m_seed_stream;
+    int64_t m_seed_data_section_offset;
+    std::unordered_map<uint64_t, IPakIndexEntry> m_seed_entries;
+
     int64_t m_current_offset;
     std::vector<IPakIndexEntry> m_index_entries;
     int64_t m_total_size;
@@ -369,15 +562,21 @@ private:
     int64_t m_index_section_offset;
     int64_t m_branding_section_offset;
 
-    std::unique_ptr<char[]> m_decompressed_buffer;
-    std::unique_ptr<char[]> m_lzo_work_buffer;
     size_t m_file_offset;
     int64_t m_chunk_buffer_window_start;
     IPakDataBlockHeader m_current_block;
     int64_t m_current_block_header_offset;
+
+    ThreadPool m_compression_pool;
+    std::deque<SpeculativeCommand> m_speculative_commands;
 };
 
 std::unique_ptr<IPakWriter> IPakWriter::Create(std::ostream& stream, ISearchPath* assetSearchPath)
 {
-    return std::make_unique<IPakWriterImpl>(stream, assetSearchPath);
+    return std::make_unique<IPakWriterImpl>(stream, assetSearchPath, nullptr);
+}
+
+std::unique_ptr<IPakWriter> IPakWriter::Create(std::ostream& stream, ISearchPath* assetSearchPath, std::istream& seedStream)
+{
+    return std::make_unique<IPakWriterImpl>(stream, assetSearchPath, &seedStream);
 }
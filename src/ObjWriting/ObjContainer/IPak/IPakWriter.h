@@ -1,6 +1,7 @@
 #pragma once
 #include "SearchPath/ISearchPath.h"
 
+#include <istream>
 #include <memory>
 #include <ostream>
 
@@ -21,4 +22,13 @@ public:
     virtual bool Write() = 0;
 
     static std::unique_ptr<IPakWriter> Create(std::ostream& stream, ISearchPath* assetSearchPath);
+
+    /**
+     * \brief Creates an IPak writer that reuses the written data of images that did not change since a previous IPak was written.
+     * \param stream The stream to write the IPak to.
+     * \param assetSearchPath The search path to read the images from.
+     * \param seedStream A stream of a previously written IPak. Images whose name and data hash match an entry of it are copied without recompressing.
+     * \return The IPak writer.
+     */
+    static std::unique_ptr<IPakWriter> Create(std::ostream& stream, ISearchPath* assetSearchPath, std::istream& seedStream);
 };
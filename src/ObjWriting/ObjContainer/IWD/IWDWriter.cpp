@@ -0,0 +1,95 @@
+#include "IWDWriter.h"
+
+#include "Zip/ZipWriter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <unordered_set>
+#include <vector>
+
+class IWDWriterImpl final : public IWDWriter
+{
+    // The game does not support the zip64 extension, so IWDs are limited to the file count and size of plain zip files
+    static constexpr uint64_t MAX_SIZE = std::numeric_limits<uint32_t>::max();
+    static constexpr size_t MAX_FILE_COUNT = std::numeric_limits<uint16_t>::max();
+
+public:
+    IWDWriterImpl(std::ostream& stream, ISearchPath* assetSearchPath, const unsigned workerCount)
+        : m_asset_search_path(assetSearchPath),
+          m_zip_writer(stream, false, workerCount)
+    {
+    }
+
+    void AddFile(std::string fileName) override
+    {
+        // Paths inside of zip files always use forward slashes
+        std::ranges::replace(fileName, '\\', '/');
+
+        if (m_added_files.emplace(fileName).second)
+            m_files.emplace_back(std::move(fileName));
+    }
+
+    bool Write() override
+    {
+        if (m_files.size() > MAX_FILE_COUNT)
+        {
+            std::cerr << "Too many files for IWD: " << m_files.size() << "\n";
+            return false;
+        }
+
+        // Files need to be read one after another since search paths cannot be used from multiple threads,
+        // but reading is a lot faster than compressing, so the zip writer compresses the following files while writing the current one
+        for (const auto& fileName : m_files)
+        {
+            std::vector<uint8_t> fileData;
+            if (!ReadFileFromSearchPath(fileName, fileData))
+                return false;
+
+            if (!m_zip_writer.AddFile(fileName, std::move(fileData)))
+                return false;
+        }
+
+        return m_zip_writer.Finish();
+    }
+
+private:
+    bool ReadFileFromSearchPath(const std::string& fileName, std::vector<uint8_t>& fileData) const
+    {
+        const auto openFile = m_asset_search_path->Open(fileName);
+        if (!openFile.IsOpen())
+        {
+            std::cerr << "Could not open file for writing to IWD \"" << fileName << "\"\n";
+            return false;
+        }
+
+        if (openFile.m_length < 0 || static_cast<uint64_t>(openFile.m_length) > MAX_SIZE)
+        {
+            std::cerr << "File is too big for IWD \"" << fileName << "\"\n";
+            return false;
+        }
+
+        fileData.resize(static_cast<size_t>(openFile.m_length));
+        openFile.m_stream->read(reinterpret_cast<char*>(fileData.data()), static_cast<std::streamsize>(fileData.size()));
+        if (openFile.m_stream->gcount() != static_cast<std::streamsize>(fileData.size()))
+        {
+            std::cerr << "Could not read file for writing to IWD \"" << fileName << "\"\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    ISearchPath* m_asset_search_path;
+
+    std::vector<std::string> m_files;
+    std::unordered_set<std::string> m_added_files;
+
+    ZipWriter m_zip_writer;
+};
+
+std::unique_ptr<IWDWriter> IWDWriter::Create(std::ostream& stream, ISearchPath* assetSearchPath, const unsigned workerCount)
+{
+    return std::make_unique<IWDWriterImpl>(stream, assetSearchPath, workerCount);
+}
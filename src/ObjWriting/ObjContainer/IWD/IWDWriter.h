@@ -0,0 +1,35 @@
+#pragma once
+#include "SearchPath/ISearchPath.h"
+
+#include <memory>
+#include <ostream>
+#include <string>
+
+class IWDWriter
+{
+public:
+    IWDWriter() = default;
+    virtual ~IWDWriter() = default;
+
+    IWDWriter(const IWDWriter& other) = default;
+    IWDWriter(IWDWriter&& other) noexcept = default;
+    IWDWriter& operator=(const IWDWriter& other) = default;
+    IWDWriter& operator=(IWDWriter&& other) noexcept = default;
+
+    /**
+     * \brief Adds a file of the asset search path to the IWD. Adding the same file multiple times only adds it once.
+     * \param fileName The path of the file relative to the search path, which is also its path inside the IWD.
+     */
+    virtual void AddFile(std::string fileName) = 0;
+    virtual bool Write() = 0;
+
+    /**
+     * \brief Creates an IWD writer that compresses the files of the IWD on multiple threads.
+     * Files are written with a \c ZipWriter without the zip64 extension, which the game does not support.
+     * \param stream The stream to write the IWD to.
+     * \param assetSearchPath The search path to read the files from.
+     * \param workerCount The amount of threads compressing files. A value of \c 0 uses one thread per hardware thread.
+     * \return The IWD writer.
+     */
+    static std::unique_ptr<IWDWriter> Create(std::ostream& stream, ISearchPath* assetSearchPath, unsigned workerCount = 0u);
+};
@@ -9,6 +9,9 @@
 
 ObjWriting::Configuration_t ObjWriting::Configuration;
 
+// The amount of bytes of asset files that can be buffered in memory while waiting to be written
+constexpr size_t ASYNC_FILE_WRITE_BUFFER_SIZE = 0x4000000;
+
 const IZoneDumper* const ZONE_DUMPER[]{
     new IW3::ZoneDumper(),
     new IW4::ZoneDumper(),
@@ -19,11 +22,29 @@ const IZoneDumper* const ZONE_DUMPER[]{
 
 bool ObjWriting::DumpZone(AssetDumpingContext& context)
 {
+    if (Configuration.DumpWorkerCount > 1u && !context.m_worker_pool)
+        context.m_worker_pool = std::make_unique<ThreadPool>(Configuration.DumpWorkerCount);
+    if (!context.m_progress_reporter)
+        context.m_progress_reporter = Configuration.ProgressReporter;
+    if (!context.m_image_dump_cache)
+        context.m_image_dump_cache = Configuration.DumpedImageCache;
+    if (Configuration.AsyncFileWrites && !context.m_file_writer)
+        context.EnableAsyncFileWrites(ASYNC_FILE_WRITE_BUFFER_SIZE);
+
     for (const auto* dumper : ZONE_DUMPER)
     {
         if (dumper->CanHandleZone(context))
         {
-            if (dumper->DumpZone(context))
+            if (context.m_progress_reporter)
+                context.m_progress_reporter->OnZoneDumpStarted(context.m_zone->m_name, context.m_zone->m_pools->GetTotalAssetCount());
+
+            const auto result = dumper->DumpZone(context);
+            context.FlushFiles();
+
+            if (context.m_progress_reporter)
+                context.m_progress_reporter->OnZoneDumpFinished(context.m_zone->m_name, result, context.GetWrittenByteCount());
+
+            if (result)
             {
                 return true;
             }
@@ -36,12 +57,12 @@ bool ObjWriting::DumpZone(AssetDumpingContext& context)
     return false;
 }
 
-bool ObjWriting::ShouldHandleAssetType(const asset_type_t assetType)
+bool ObjWriting::ShouldHandleAssetType(const AssetDumpingContext& context, const asset_type_t assetType)
 {
     if (assetType < 0)
         return false;
-    if (static_cast<size_t>(assetType) >= Configuration.AssetTypesToHandleBitfield.size())
+    if (static_cast<size_t>(assetType) >= context.m_asset_types_to_handle.size())
         return true;
 
-    return Configuration.AssetTypesToHandleBitfield[assetType];
+    return context.m_asset_types_to_handle[assetType];
 }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Dumping/AssetDumpingContext.h"
+#include "Image/ImageDumpCache.h"
+#include "Utils/ProgressReporter.h"
 #include "Zone/ZoneTypes.h"
 
 #include <vector>
@@ -26,14 +28,23 @@ public:
         };
 
         bool Verbose = false;
-        std::vector<bool> AssetTypesToHandleBitfield;
 
         ImageOutputFormat_e ImageOutputFormat = ImageOutputFormat_e::DDS;
         ModelOutputFormat_e ModelOutputFormat = ModelOutputFormat_e::GLB;
+        bool ModelWeldVertices = false;
         bool MenuLegacyMode = false;
+        unsigned DumpWorkerCount = 1u;
+        unsigned ModelFormatWorkerCount = 1u;
+        bool AsyncFileWrites = false;
+
+        // Receives the progress of dumping zones if set.
+        progress::IProgressReporter* ProgressReporter = nullptr;
+
+        // Shared by all zones of a session to not dump identical images more than once if set.
+        ImageDumpCache* DumpedImageCache = nullptr;
 
     } Configuration;
 
     static bool DumpZone(AssetDumpingContext& context);
-    static bool ShouldHandleAssetType(asset_type_t assetType);
+    static bool ShouldHandleAssetType(const AssetDumpingContext& context, asset_type_t assetType);
 };
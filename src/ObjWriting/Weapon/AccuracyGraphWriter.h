@@ -3,12 +3,14 @@
 #include "Dumping/IZoneAssetDumperState.h"
 #include "Parsing/GenericGraph2D.h"
 
+#include <mutex>
 #include <string>
 #include <unordered_set>
 
 class AccuracyGraphWriter final : public IZoneAssetDumperState
 {
 public:
+    // Both can be called from multiple threads at once
     bool ShouldDumpAiVsAiGraph(const std::string& graphName);
     bool ShouldDumpAiVsPlayerGraph(const std::string& graphName);
 
@@ -18,4 +20,5 @@ public:
 private:
     std::unordered_set<std::string> m_dumped_ai_vs_ai_graphs;
     std::unordered_set<std::string> m_dumped_ai_vs_player_graphs;
+    std::mutex m_mutex;
 };
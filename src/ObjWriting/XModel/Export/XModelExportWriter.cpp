@@ -1,12 +1,17 @@
 #include "XModelExportWriter.h"
 
+#include "XModel/TextFormatBuffer.h"
+
 #pragma warning(push, 0)
 #include <Eigen>
 #pragma warning(pop)
 
 #include <chrono>
+#include <format>
 #include <iomanip>
 #include <iostream>
+#include <string_view>
+#include <type_traits>
 
 class XModelExportWriterBase : public XModelWriter
 {
@@ -91,33 +96,86 @@ protected:
 
 class XModelExportWriter6 final : public XModelExportWriterBase
 {
-    void WriteVertices(const XModelCommon& xmodel) const
+    static void WriteFixedValues(TextFormatBuffer& buffer, const std::string_view prefix, const float* values, const size_t count, const std::string_view separator)
     {
-        const auto& distinctVertexValues = m_vertex_merger.GetDistinctValues();
-        m_stream << "NUMVERTS " << distinctVertexValues.size() << "\n";
-        size_t vertexNum = 0u;
-        for (const auto& vertexPos : distinctVertexValues)
+        buffer.Append(prefix);
+        for (auto i = 0u; i < count; i++)
         {
-            m_stream << "VERT " << vertexNum << "\n";
-            m_stream << std::format("OFFSET {:.6f}, {:.6f}, {:.6f}\n", vertexPos.x, vertexPos.y, vertexPos.z);
-            m_stream << "BONES " << vertexPos.weightCount << "\n";
-
-            for (auto weightIndex = 0u; weightIndex < vertexPos.weightCount; weightIndex++)
-            {
-                const auto& weight = vertexPos.weights[weightIndex];
-                m_stream << std::format("BONE {} {:.6f}\n", weight.boneIndex, weight.weight);
-            }
-            m_stream << "\n";
-            vertexNum++;
+            if (i > 0)
+                buffer.Append(separator);
+            buffer.AppendFixed(values[i]);
         }
+        buffer.Append('\n');
     }
 
-    void WriteFaceVertex(const size_t index, const XModelVertex& vertex) const
+    static void WriteVertex(TextFormatBuffer& buffer, const size_t vertexNum, const VertexMergerPos& vertexPos)
     {
-        m_stream << "VERT " << index << "\n";
-        m_stream << std::format("NORMAL {:.6f} {:.6f} {:.6f}\n", vertex.normal[0], vertex.normal[1], vertex.normal[2]);
-        m_stream << std::format("COLOR {:.6f} {:.6f} {:.6f} {:.6f}\n", vertex.color[0], vertex.color[1], vertex.color[2], vertex.color[3]);
-        m_stream << std::format("UV 1 {:.6f} {:.6f}\n", vertex.uv[0], vertex.uv[1]);
+        buffer.Append("VERT ");
+        buffer.AppendInteger(vertexNum);
+        buffer.Append('\n');
+
+        const float offset[3]{vertexPos.x, vertexPos.y, vertexPos.z};
+        WriteFixedValues(buffer, "OFFSET ", offset, std::extent_v<decltype(offset)>, ", ");
+
+        buffer.Append("BONES ");
+        buffer.AppendInteger(vertexPos.weightCount);
+        buffer.Append('\n');
+
+        for (auto weightIndex = 0u; weightIndex < vertexPos.weightCount; weightIndex++)
+        {
+            const auto& weight = vertexPos.weights[weightIndex];
+            buffer.Append("BONE ");
+            buffer.AppendInteger(weight.boneIndex);
+            buffer.Append(' ');
+            buffer.AppendFixed(weight.weight);
+            buffer.Append('\n');
+        }
+        buffer.Append('\n');
+    }
+
+    void WriteVertices(const XModelCommon& xmodel) const
+    {
+        const auto& distinctVertexValues = m_vertex_merger.GetDistinctValues();
+
+        TextFormatBuffer buffer;
+        buffer.Append("NUMVERTS ");
+        buffer.AppendInteger(distinctVertexValues.size());
+        buffer.Append('\n');
+
+        text_format::FormatElements(m_stream,
+                                    buffer,
+                                    distinctVertexValues.size(),
+                                    [&distinctVertexValues](TextFormatBuffer& chunk, const size_t begin, const size_t end)
+                                    {
+                                        for (auto vertexNum = begin; vertexNum < end; vertexNum++)
+                                            WriteVertex(chunk, vertexNum, distinctVertexValues[vertexNum]);
+                                    });
+
+        buffer.Flush(m_stream);
+    }
+
+    static void WriteFaceVertex(TextFormatBuffer& buffer, const size_t index, const XModelVertex& vertex)
+    {
+        buffer.Append("VERT ");
+        buffer.AppendInteger(index);
+        buffer.Append('\n');
+        WriteFixedValues(buffer, "NORMAL ", vertex.normal, std::extent_v<decltype(vertex.normal)>, " ");
+        WriteFixedValues(buffer, "COLOR ", vertex.color, std::extent_v<decltype(vertex.color)>, " ");
+        WriteFixedValues(buffer, "UV 1 ", vertex.uv, std::extent_v<decltype(vertex.uv)>, " ");
+    }
+
+    void WriteFace(TextFormatBuffer& buffer, const XModelCommon& xmodel, const size_t objectIndex, const XModelObject& object, const XModelFace& face) const
+    {
+        buffer.Append("TRI ");
+        buffer.AppendInteger(objectIndex);
+        buffer.Append(' ');
+        buffer.AppendInteger(object.materialIndex);
+        buffer.Append(" 0 0\n");
+
+        for (const auto vertexIndex : face.vertexIndex)
+            WriteFaceVertex(buffer, m_vertex_merger.GetDistinctPositionByInputPosition(vertexIndex), xmodel.m_vertices[vertexIndex]);
+
+        buffer.Append('\n');
     }
 
     void WriteFaces(const XModelCommon& xmodel) const
@@ -126,32 +184,27 @@ class XModelExportWriter6 final : public XModelExportWriterBase
         for (const auto& object : xmodel.m_objects)
             totalFaceCount += object.m_faces.size();
 
-        m_stream << "NUMFACES " << totalFaceCount << "\n";
+        TextFormatBuffer buffer;
+        buffer.Append("NUMFACES ");
+        buffer.AppendInteger(totalFaceCount);
+        buffer.Append('\n');
 
         auto objectIndex = 0u;
         for (const auto& object : xmodel.m_objects)
         {
-            for (const auto& face : object.m_faces)
-            {
-                const size_t distinctPositions[3]{
-                    m_vertex_merger.GetDistinctPositionByInputPosition(face.vertexIndex[0]),
-                    m_vertex_merger.GetDistinctPositionByInputPosition(face.vertexIndex[1]),
-                    m_vertex_merger.GetDistinctPositionByInputPosition(face.vertexIndex[2]),
-                };
-
-                const XModelVertex& v0 = xmodel.m_vertices[face.vertexIndex[0]];
-                const XModelVertex& v1 = xmodel.m_vertices[face.vertexIndex[1]];
-                const XModelVertex& v2 = xmodel.m_vertices[face.vertexIndex[2]];
-
-                m_stream << "TRI " << objectIndex << " " << object.materialIndex << " 0 0\n";
-                WriteFaceVertex(distinctPositions[0], v0);
-                WriteFaceVertex(distinctPositions[1], v1);
-                WriteFaceVertex(distinctPositions[2], v2);
-                m_stream << "\n";
-            }
+            text_format::FormatElements(m_stream,
+                                        buffer,
+                                        object.m_faces.size(),
+                                        [this, &xmodel, objectIndex, &object](TextFormatBuffer& chunk, const size_t begin, const size_t end)
+                                        {
+                                            for (auto faceIndex = begin; faceIndex < end; faceIndex++)
+                                                WriteFace(chunk, xmodel, objectIndex, object, object.m_faces[faceIndex]);
+                                        });
 
             objectIndex++;
         }
+
+        buffer.Flush(m_stream);
     }
 
     void WriteObjects(const XModelCommon& xmodel) const
@@ -28,7 +28,7 @@ void BinOutput::AlignToFour(const char value) const
     }
 }
 
-std::optional<std::string> BinOutput::CreateBufferUri(const void* buffer, size_t bufferSize) const
+std::optional<std::string> BinOutput::CreateBufferUri(size_t bufferSize) const
 {
     return std::nullopt;
 }
@@ -62,13 +62,20 @@ void BinOutput::EmitJson(const nlohmann::json& json) const
     m_stream.seekp(offsetAfterData, std::ios::beg);
 }
 
-void BinOutput::EmitBuffer(const void* buffer, const size_t bufferSize) const
+void BinOutput::BeginBuffer(const size_t bufferSize) const
 {
     const auto chunkLength = utils::Align<uint32_t>(bufferSize, 4u);
     Write(&chunkLength, sizeof(chunkLength));
     Write(&CHUNK_MAGIC_BIN, sizeof(CHUNK_MAGIC_BIN));
+}
 
-    Write(buffer, bufferSize);
+void BinOutput::EmitBufferData(const void* data, const size_t dataSize) const
+{
+    Write(data, dataSize);
+}
+
+void BinOutput::EndBuffer() const
+{
     AlignToFour('\0');
 }
 
@@ -11,9 +11,11 @@ namespace gltf
     public:
         explicit BinOutput(std::ostream& stream);
 
-        std::optional<std::string> CreateBufferUri(const void* buffer, size_t bufferSize) const override;
+        std::optional<std::string> CreateBufferUri(size_t bufferSize) const override;
         void EmitJson(const nlohmann::json& json) const override;
-        void EmitBuffer(const void* buffer, size_t bufferSize) const override;
+        void BeginBuffer(size_t bufferSize) const override;
+        void EmitBufferData(const void* data, size_t dataSize) const override;
+        void EndBuffer() const override;
         void Finalize() const override;
 
     private:
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Utils/ClassUtils.h"
+
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 #include <string>
@@ -17,9 +19,16 @@ namespace gltf
         Output& operator=(Output&& other) noexcept = default;
 
     public:
-        virtual std::optional<std::string> CreateBufferUri(const void* buffer, size_t bufferSize) const = 0;
+        /**
+         * \brief Creates the uri of the buffer for the json. The buffer data is only emitted after the json and never needs to be available in its entirety.
+         * \param bufferSize The size of the buffer.
+         * \return The uri of the buffer or \c std::nullopt if the buffer is not referenced by an uri.
+         */
+        virtual std::optional<std::string> CreateBufferUri(size_t bufferSize) const = 0;
         virtual void EmitJson(const nlohmann::json& json) const = 0;
-        virtual void EmitBuffer(const void* buffer, size_t bufferSize) const = 0;
+        virtual void BeginBuffer(size_t bufferSize) const = 0;
+        virtual void EmitBufferData(const void* data, size_t dataSize) const = 0;
+        virtual void EndBuffer() const = 0;
         virtual void Finalize() const = 0;
     };
 } // namespace gltf
@@ -1,46 +1,114 @@
 #include "GltfTextOutput.h"
 
+#include "Utils/Base64.h"
 #include "XModel/Gltf/GltfConstants.h"
 
-#include <iomanip>
+#include <algorithm>
+#include <format>
 #include <nlohmann/json.hpp>
 
-#define LTC_NO_PROTOTYPES
-#include <tomcrypt.h>
-
 using namespace gltf;
 
+namespace
+{
+    constexpr auto JSON_INDENTATION = 4;
+
+    // Base64 encodes groups of three bytes, so incomplete groups are kept until more data is emitted
+    constexpr size_t BASE64_GROUP_SIZE = 3u;
+} // namespace
+
 TextOutput::TextOutput(std::ostream& stream)
-    : m_stream(stream)
+    : m_stream(stream),
+      m_is_streaming_uri(false),
+      m_incomplete_group{},
+      m_incomplete_group_size(0u)
+{
+}
+
+std::optional<std::string> TextOutput::CreateBufferUri(const size_t bufferSize) const
+{
+    if (bufferSize == 0u)
+        return std::nullopt;
+
+    // The uri only consists of its prefix in the json, the encoded data is written after it while the buffer is emitted
+    return std::string(GLTF_DATA_URI_PREFIX);
+}
+
+void TextOutput::EmitJson(const nlohmann::json& json) const
+{
+    const auto jsonString = json.dump(JSON_INDENTATION);
+    const auto uriValue = std::format("\"{}\"", GLTF_DATA_URI_PREFIX);
+    const auto uriOffset = jsonString.find(uriValue);
+    if (uriOffset == std::string::npos)
+    {
+        m_stream.write(jsonString.data(), static_cast<std::streamsize>(jsonString.size()));
+        return;
+    }
+
+    // Everything up to the end of the uri prefix is written now, the closing quotation mark is written after the buffer data
+    const auto uriDataOffset = uriOffset + uriValue.size() - 1u;
+    m_stream.write(jsonString.data(), static_cast<std::streamsize>(uriDataOffset));
+    m_json_after_uri = jsonString.substr(uriDataOffset);
+    m_is_streaming_uri = true;
+}
+
+void TextOutput::BeginBuffer(const size_t bufferSize) const
 {
+    m_incomplete_group_size = 0u;
 }
 
-std::optional<std::string> TextOutput::CreateBufferUri(const void* buffer, const size_t bufferSize) const
+void TextOutput::EmitBufferData(const void* data, const size_t dataSize) const
 {
-    const auto base64Length = 4u * ((bufferSize + 2u) / 3u);
-    const auto base64BufferSize = URI_PREFIX_LENGTH + base64Length;
+    if (!m_is_streaming_uri)
+        return;
+
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    auto remainingSize = dataSize;
 
-    std::string output(base64BufferSize, '\0');
+    if (m_incomplete_group_size > 0u)
+    {
+        const auto fillSize = std::min(BASE64_GROUP_SIZE - m_incomplete_group_size, remainingSize);
+        std::copy_n(bytes, fillSize, &m_incomplete_group[m_incomplete_group_size]);
+        m_incomplete_group_size += fillSize;
+        bytes += fillSize;
+        remainingSize -= fillSize;
 
-    std::memcpy(output.data(), GLTF_DATA_URI_PREFIX, URI_PREFIX_LENGTH);
+        if (m_incomplete_group_size < BASE64_GROUP_SIZE)
+            return;
 
-    unsigned long outLength = base64Length + 1u;
-    const auto result = base64_encode(static_cast<const unsigned char*>(buffer), bufferSize, &output[URI_PREFIX_LENGTH], &outLength);
+        EncodeBufferData(m_incomplete_group, BASE64_GROUP_SIZE);
+        m_incomplete_group_size = 0u;
+    }
 
-    assert(result == CRYPT_OK);
-    assert(outLength == base64Length);
+    const auto completeSize = remainingSize - remainingSize % BASE64_GROUP_SIZE;
+    EncodeBufferData(bytes, completeSize);
 
-    return output;
+    m_incomplete_group_size = remainingSize - completeSize;
+    std::copy_n(&bytes[completeSize], m_incomplete_group_size, m_incomplete_group);
 }
 
-void TextOutput::EmitJson(const nlohmann::json& json) const
+void TextOutput::EndBuffer() const
 {
-    m_stream << std::setw(4) << json;
+    if (!m_is_streaming_uri)
+        return;
+
+    // The last group is padded by the encoder
+    EncodeBufferData(m_incomplete_group, m_incomplete_group_size);
+    m_incomplete_group_size = 0u;
+
+    m_stream.write(m_json_after_uri.data(), static_cast<std::streamsize>(m_json_after_uri.size()));
+    m_json_after_uri.clear();
+    m_is_streaming_uri = false;
 }
 
-void TextOutput::EmitBuffer(const void* buffer, const size_t bufferSize) const
+void TextOutput::EncodeBufferData(const uint8_t* data, const size_t dataSize) const
 {
-    // Nothing to do
+    if (dataSize == 0u)
+        return;
+
+    m_encoded_data.resize(base64::GetEncodedLength(dataSize));
+    base64::Encode(data, dataSize, m_encoded_data.data());
+    m_stream.write(m_encoded_data.data(), static_cast<std::streamsize>(m_encoded_data.size()));
 }
 
 void TextOutput::Finalize() const
@@ -2,21 +2,39 @@
 
 #include "GltfOutput.h"
 
+#include <cstdint>
 #include <ostream>
+#include <string>
+#include <vector>
 
 namespace gltf
 {
+    /**
+     * \brief Writes gltf as text with the buffer embedded as a base64 data uri.
+     * The json is written up to the uri of the buffer, the buffer data is encoded into the stream as it is emitted and the rest of the json follows after it.
+     */
     class TextOutput final : public Output
     {
     public:
         explicit TextOutput(std::ostream& stream);
 
-        std::optional<std::string> CreateBufferUri(const void* buffer, size_t bufferSize) const override;
+        std::optional<std::string> CreateBufferUri(size_t bufferSize) const override;
         void EmitJson(const nlohmann::json& json) const override;
-        void EmitBuffer(const void* buffer, size_t bufferSize) const override;
+        void BeginBuffer(size_t bufferSize) const override;
+        void EmitBufferData(const void* data, size_t dataSize) const override;
+        void EndBuffer() const override;
         void Finalize() const override;
 
     private:
+        void EncodeBufferData(const uint8_t* data, size_t dataSize) const;
+
         std::ostream& m_stream;
+
+        // The state of streaming the buffer into the uri changes while emitting data through the const interface
+        mutable bool m_is_streaming_uri;
+        mutable std::string m_json_after_uri;
+        mutable uint8_t m_incomplete_group[3];
+        mutable size_t m_incomplete_group_size;
+        mutable std::vector<char> m_encoded_data;
     };
 } // namespace gltf
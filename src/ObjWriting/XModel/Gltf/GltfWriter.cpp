@@ -8,7 +8,10 @@
 #include <Eigen>
 #pragma warning(pop)
 
+#include <cassert>
+#include <cstring>
 #include <format>
+#include <type_traits>
 
 using namespace gltf;
 using namespace nlohmann;
@@ -17,6 +20,9 @@ namespace
 {
     constexpr auto GLTF_GENERATOR = "OpenAssetTools " GIT_VERSION;
 
+    // Buffer data is emitted in parts of this size to not need to keep the whole buffer in memory
+    constexpr auto BUFFER_STAGING_SIZE = 0x10000u;
+
     struct GltfVertex
     {
         float coordinates[3];
@@ -24,6 +30,52 @@ namespace
         float uv[2];
     };
 
+    /**
+     * \brief Collects buffer data in parts that are emitted to the output as soon as they are complete.
+     */
+    class BufferDataWriter
+    {
+    public:
+        BufferDataWriter(const Output& output, std::vector<uint8_t>& data)
+            : m_output(output),
+              m_data(data),
+              m_written_size(0u)
+        {
+        }
+
+        template<typename T> void Write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+
+            const auto offset = m_data.size();
+            m_data.resize(offset + sizeof(T));
+            std::memcpy(&m_data[offset], &value, sizeof(T));
+            m_written_size += sizeof(T);
+
+            if (m_data.size() >= BUFFER_STAGING_SIZE)
+                Flush();
+        }
+
+        void Flush()
+        {
+            if (m_data.empty())
+                return;
+
+            m_output.EmitBufferData(m_data.data(), m_data.size());
+            m_data.clear();
+        }
+
+        _NODISCARD size_t GetWrittenSize() const
+        {
+            return m_written_size;
+        }
+
+    private:
+        const Output& m_output;
+        std::vector<uint8_t>& m_data;
+        size_t m_written_size;
+    };
+
     class GltfWriterImpl final : public gltf::Writer
     {
     public:
@@ -37,7 +89,6 @@ namespace
         void Write(const XModelCommon& xmodel) override
         {
             JsonRoot gltf;
-            std::vector<uint8_t> bufferData;
 
             CreateJsonAsset(gltf.asset);
             CreateSkeletonNodes(gltf, xmodel);
@@ -49,19 +100,34 @@ namespace
             CreateSkin(gltf, xmodel);
             CreateMesh(gltf, xmodel);
             CreateScene(gltf, xmodel);
-            FillBufferData(gltf, xmodel, bufferData);
-            CreateBuffer(gltf, xmodel, bufferData);
 
-            const json jRoot = gltf;
-            m_output->EmitJson(jRoot);
+            // The buffer data is never kept in its entirety, even when it is embedded into the json
+            const auto bufferSize = GetExpectedBufferSize(xmodel);
+            CreateBuffer(gltf, bufferSize, m_output->CreateBufferUri(bufferSize));
+            EmitJson(gltf);
 
-            if (!bufferData.empty())
-                m_output->EmitBuffer(bufferData.data(), bufferData.size());
+            if (bufferSize > 0u)
+            {
+                std::vector<uint8_t> stagingData;
+                stagingData.reserve(BUFFER_STAGING_SIZE + sizeof(float) * 16u);
+
+                m_output->BeginBuffer(bufferSize);
+                BufferDataWriter bufferWriter(*m_output, stagingData);
+                FillBufferData(xmodel, bufferWriter);
+                bufferWriter.Flush();
+                m_output->EndBuffer();
+            }
 
             m_output->Finalize();
         }
 
     private:
+        void EmitJson(const JsonRoot& gltf) const
+        {
+            const json jRoot = gltf;
+            m_output->EmitJson(jRoot);
+        }
+
         static void CreateJsonAsset(JsonAsset& asset)
         {
             asset.version = GLTF_VERSION_STRING;
@@ -366,12 +432,37 @@ namespace
             if (!gltf.accessors.has_value())
                 gltf.accessors.emplace();
 
+            float minPosition[3]{
+                std::numeric_limits<float>::max(),
+                std::numeric_limits<float>::max(),
+                std::numeric_limits<float>::max(),
+            };
+            float maxPosition[3]{
+                -std::numeric_limits<float>::max(),
+                -std::numeric_limits<float>::max(),
+                -std::numeric_limits<float>::max(),
+            };
+
+            for (const auto& commonVertex : xmodel.m_vertices)
+            {
+                const auto vertex = CreateGltfVertex(commonVertex);
+                for (auto i = 0u; i < 3u; i++)
+                {
+                    if (minPosition[i] > vertex.coordinates[i])
+                        minPosition[i] = vertex.coordinates[i];
+                    if (maxPosition[i] < vertex.coordinates[i])
+                        maxPosition[i] = vertex.coordinates[i];
+                }
+            }
+
             JsonAccessor positionAccessor;
             positionAccessor.bufferView = m_vertex_buffer_view;
             positionAccessor.byteOffset = offsetof(GltfVertex, coordinates);
             positionAccessor.componentType = JsonAccessorComponentType::FLOAT;
             positionAccessor.count = xmodel.m_vertices.size();
             positionAccessor.type = JsonAccessorType::VEC3;
+            positionAccessor.min = std::vector({minPosition[0], minPosition[1], minPosition[2]});
+            positionAccessor.max = std::vector({maxPosition[0], maxPosition[1], maxPosition[2]});
             m_position_accessor = gltf.accessors->size();
             gltf.accessors->emplace_back(positionAccessor);
 
@@ -435,67 +526,34 @@ namespace
             }
         }
 
-        void FillBufferData(JsonRoot& gltf, const XModelCommon& xmodel, std::vector<uint8_t>& bufferData) const
+        static GltfVertex CreateGltfVertex(const XModelVertex& commonVertex)
         {
-            const auto expectedBufferSize = GetExpectedBufferSize(xmodel);
-            bufferData.resize(expectedBufferSize);
+            GltfVertex vertex{};
 
-            auto currentBufferOffset = 0u;
+            vertex.coordinates[0] = commonVertex.coordinates[0];
+            vertex.coordinates[1] = commonVertex.coordinates[2];
+            vertex.coordinates[2] = -commonVertex.coordinates[1];
 
-            float minPosition[3]{
-                std::numeric_limits<float>::max(),
-                std::numeric_limits<float>::max(),
-                std::numeric_limits<float>::max(),
-            };
-            float maxPosition[3]{
-                -std::numeric_limits<float>::max(),
-                -std::numeric_limits<float>::max(),
-                -std::numeric_limits<float>::max(),
-            };
+            vertex.normal[0] = commonVertex.normal[0];
+            vertex.normal[1] = commonVertex.normal[2];
+            vertex.normal[2] = -commonVertex.normal[1];
 
-            for (const auto& commonVertex : xmodel.m_vertices)
-            {
-                auto* vertex = reinterpret_cast<GltfVertex*>(&bufferData[currentBufferOffset]);
-
-                vertex->coordinates[0] = commonVertex.coordinates[0];
-                vertex->coordinates[1] = commonVertex.coordinates[2];
-                vertex->coordinates[2] = -commonVertex.coordinates[1];
-
-                if (minPosition[0] > vertex->coordinates[0])
-                    minPosition[0] = vertex->coordinates[0];
-                if (minPosition[1] > vertex->coordinates[1])
-                    minPosition[1] = vertex->coordinates[1];
-                if (minPosition[2] > vertex->coordinates[2])
-                    minPosition[2] = vertex->coordinates[2];
-                if (maxPosition[0] < vertex->coordinates[0])
-                    maxPosition[0] = vertex->coordinates[0];
-                if (maxPosition[1] < vertex->coordinates[1])
-                    maxPosition[1] = vertex->coordinates[1];
-                if (maxPosition[2] < vertex->coordinates[2])
-                    maxPosition[2] = vertex->coordinates[2];
-
-                vertex->normal[0] = commonVertex.normal[0];
-                vertex->normal[1] = commonVertex.normal[2];
-                vertex->normal[2] = -commonVertex.normal[1];
-
-                vertex->uv[0] = commonVertex.uv[0];
-                vertex->uv[1] = commonVertex.uv[1];
-
-                currentBufferOffset += sizeof(GltfVertex);
-            }
+            vertex.uv[0] = commonVertex.uv[0];
+            vertex.uv[1] = commonVertex.uv[1];
 
-            if (gltf.accessors.has_value())
-            {
-                gltf.accessors.value()[m_position_accessor].min = std::vector({minPosition[0], minPosition[1], minPosition[2]});
-                gltf.accessors.value()[m_position_accessor].max = std::vector({maxPosition[0], maxPosition[1], maxPosition[2]});
-            }
+            return vertex;
+        }
+
+        static void FillBufferData(const XModelCommon& xmodel, BufferDataWriter& bufferWriter)
+        {
+            for (const auto& commonVertex : xmodel.m_vertices)
+                bufferWriter.Write(CreateGltfVertex(commonVertex));
 
             if (!xmodel.m_bone_weight_data.weights.empty())
             {
                 assert(xmodel.m_vertex_bone_weights.size() == xmodel.m_vertices.size());
 
-                auto* joints = reinterpret_cast<uint8_t*>(&bufferData[currentBufferOffset]);
-                auto* weights = reinterpret_cast<float*>(&bufferData[currentBufferOffset + sizeof(uint8_t) * 4u * xmodel.m_vertex_bone_weights.size()]);
+                // All joints are written before all weights
                 for (const auto& commonVertexWeights : xmodel.m_vertex_bone_weights)
                 {
                     assert(commonVertexWeights.weightOffset < xmodel.m_bone_weight_data.weights.size());
@@ -503,25 +561,26 @@ namespace
 
                     const auto commonVertexWeightCount = std::min(commonVertexWeights.weightCount, 4u);
                     const auto* commonVertexWeightData = &xmodel.m_bone_weight_data.weights[commonVertexWeights.weightOffset];
+
+                    uint8_t joints[4]{};
                     for (auto i = 0u; i < commonVertexWeightCount; i++)
-                    {
                         joints[i] = static_cast<unsigned char>(commonVertexWeightData[i].boneIndex);
-                        weights[i] = commonVertexWeightData[i].weight;
-                    }
 
-                    for (auto i = commonVertexWeightCount; i < 4u; i++)
-                    {
-                        joints[i] = 0u;
-                        weights[i] = 0.0f;
-                    }
-
-                    joints += 4u;
-                    weights += 4u;
+                    bufferWriter.Write(joints);
                 }
 
-                currentBufferOffset += (sizeof(uint8_t) + sizeof(float)) * 4u * xmodel.m_vertex_bone_weights.size();
+                for (const auto& commonVertexWeights : xmodel.m_vertex_bone_weights)
+                {
+                    const auto commonVertexWeightCount = std::min(commonVertexWeights.weightCount, 4u);
+                    const auto* commonVertexWeightData = &xmodel.m_bone_weight_data.weights[commonVertexWeights.weightOffset];
+
+                    float weights[4]{};
+                    for (auto i = 0u; i < commonVertexWeightCount; i++)
+                        weights[i] = commonVertexWeightData[i].weight;
+
+                    bufferWriter.Write(weights);
+                }
 
-                auto* inverseBindMatrixData = reinterpret_cast<float*>(&bufferData[currentBufferOffset]);
                 for (const auto& bone : xmodel.m_bones)
                 {
                     const auto translation = Eigen::Translation3f(bone.globalOffset[0], bone.globalOffset[2], -bone.globalOffset[1]);
@@ -530,42 +589,32 @@ namespace
                     const auto inverseBindMatrix = (translation * rotation).matrix().inverse();
 
                     // GLTF matrix is column major
-                    inverseBindMatrixData[0] = inverseBindMatrix(0, 0);
-                    inverseBindMatrixData[1] = inverseBindMatrix(1, 0);
-                    inverseBindMatrixData[2] = inverseBindMatrix(2, 0);
-                    inverseBindMatrixData[3] = inverseBindMatrix(3, 0);
-                    inverseBindMatrixData[4] = inverseBindMatrix(0, 1);
-                    inverseBindMatrixData[5] = inverseBindMatrix(1, 1);
-                    inverseBindMatrixData[6] = inverseBindMatrix(2, 1);
-                    inverseBindMatrixData[7] = inverseBindMatrix(3, 1);
-                    inverseBindMatrixData[8] = inverseBindMatrix(0, 2);
-                    inverseBindMatrixData[9] = inverseBindMatrix(1, 2);
-                    inverseBindMatrixData[10] = inverseBindMatrix(2, 2);
-                    inverseBindMatrixData[11] = inverseBindMatrix(3, 2);
-                    inverseBindMatrixData[12] = inverseBindMatrix(0, 3);
-                    inverseBindMatrixData[13] = inverseBindMatrix(1, 3);
-                    inverseBindMatrixData[14] = inverseBindMatrix(2, 3);
-                    inverseBindMatrixData[15] = inverseBindMatrix(3, 3);
-
-                    inverseBindMatrixData += 16u;
+                    float inverseBindMatrixData[16];
+                    for (auto column = 0u; column < 4u; column++)
+                    {
+                        for (auto row = 0u; row < 4u; row++)
+                            inverseBindMatrixData[column * 4u + row] = inverseBindMatrix(row, column);
+                    }
+
+                    bufferWriter.Write(inverseBindMatrixData);
                 }
-                currentBufferOffset += sizeof(float) * 16u * xmodel.m_bones.size();
             }
 
             for (const auto& object : xmodel.m_objects)
             {
                 for (const auto& face : object.m_faces)
                 {
-                    auto* faceIndices = reinterpret_cast<unsigned short*>(&bufferData[currentBufferOffset]);
-                    faceIndices[0] = static_cast<unsigned short>(face.vertexIndex[2]);
-                    faceIndices[1] = static_cast<unsigned short>(face.vertexIndex[1]);
-                    faceIndices[2] = static_cast<unsigned short>(face.vertexIndex[0]);
+                    const unsigned short faceIndices[3]{
+                        static_cast<unsigned short>(face.vertexIndex[2]),
+                        static_cast<unsigned short>(face.vertexIndex[1]),
+                        static_cast<unsigned short>(face.vertexIndex[0]),
+                    };
 
-                    currentBufferOffset += sizeof(unsigned short) * 3u;
+                    bufferWriter.Write(faceIndices);
                 }
             }
 
-            assert(expectedBufferSize == currentBufferOffset);
+            assert(bufferWriter.GetWrittenSize() == GetExpectedBufferSize(xmodel));
         }
 
         static size_t GetExpectedBufferSize(const XModelCommon& xmodel)
@@ -591,16 +640,14 @@ namespace
             return result;
         }
 
-        void CreateBuffer(JsonRoot& gltf, const XModelCommon& xmodel, const std::vector<uint8_t>& bufferData) const
+        static void CreateBuffer(JsonRoot& gltf, const size_t bufferSize, std::optional<std::string> uri)
         {
             if (!gltf.buffers.has_value())
                 gltf.buffers.emplace();
 
             JsonBuffer jsonBuffer;
-            jsonBuffer.byteLength = bufferData.size();
-
-            if (!bufferData.empty())
-                jsonBuffer.uri = m_output->CreateBufferUri(bufferData.data(), bufferData.size());
+            jsonBuffer.byteLength = bufferSize;
+            jsonBuffer.uri = std::move(uri);
 
             gltf.buffers->emplace_back(std::move(jsonBuffer));
         }
@@ -2,8 +2,9 @@
 
 #include "Utils/DistinctMapper.h"
 #include "XModel/Obj/ObjCommon.h"
+#include "XModel/TextFormatBuffer.h"
 
-#include <format>
+#include <string_view>
 
 namespace
 {
@@ -45,48 +46,95 @@ namespace
             std::vector<ObjObjectDataOffsets> distinctOffsetsByObject;
             GetObjObjectDataOffsets(xmodel, inputOffsetsByObject, distinctOffsetsByObject);
 
+            TextFormatBuffer buffer;
             auto objectIndex = 0;
             for (const auto& object : xmodel.m_objects)
             {
                 const auto& objectData = m_object_data[objectIndex];
-                m_stream << "o " << object.name << "\n";
-
-                for (const auto& v : objectData.m_vertices.GetDistinctValues())
-                    m_stream << "v " << v.coordinates[0] << " " << v.coordinates[1] << " " << v.coordinates[2] << "\n";
-                for (const auto& uv : objectData.m_uvs.GetDistinctValues())
-                    m_stream << "vt " << uv.uv[0] << " " << uv.uv[1] << "\n";
-                for (const auto& n : objectData.m_normals.GetDistinctValues())
-                    m_stream << "vn " << n.normal[0] << " " << n.normal[1] << " " << n.normal[2] << "\n";
+                buffer.Append("o ");
+                buffer.Append(object.name);
+                buffer.Append('\n');
+
+                const auto& vertices = objectData.m_vertices.GetDistinctValues();
+                text_format::FormatElements(m_stream,
+                                            buffer,
+                                            vertices.size(),
+                                            [&vertices](TextFormatBuffer& chunk, const size_t begin, const size_t end)
+                                            {
+                                                for (auto i = begin; i < end; i++)
+                                                    WriteFloats(chunk, "v ", vertices[i].coordinates);
+                                            });
+
+                const auto& uvs = objectData.m_uvs.GetDistinctValues();
+                text_format::FormatElements(m_stream,
+                                            buffer,
+                                            uvs.size(),
+                                            [&uvs](TextFormatBuffer& chunk, const size_t begin, const size_t end)
+                                            {
+                                                for (auto i = begin; i < end; i++)
+                                                    WriteFloats(chunk, "vt ", uvs[i].uv);
+                                            });
+
+                const auto& normals = objectData.m_normals.GetDistinctValues();
+                text_format::FormatElements(m_stream,
+                                            buffer,
+                                            normals.size(),
+                                            [&normals](TextFormatBuffer& chunk, const size_t begin, const size_t end)
+                                            {
+                                                for (auto i = begin; i < end; i++)
+                                                    WriteFloats(chunk, "vn ", normals[i].normal);
+                                            });
 
                 if (object.materialIndex >= 0 && static_cast<unsigned>(object.materialIndex) < xmodel.m_materials.size())
-                    m_stream << "usemtl " << xmodel.m_materials[object.materialIndex].name << "\n";
-
-                auto faceIndex = 0u;
-                for (const auto& f : object.m_faces)
                 {
-                    const auto faceVertexOffset = 3u * faceIndex;
-                    const size_t v[3]{
-                        objectData.m_vertices.GetDistinctPositionByInputPosition(faceVertexOffset + 0) + distinctOffsetsByObject[objectIndex].vertexOffset + 1,
-                        objectData.m_vertices.GetDistinctPositionByInputPosition(faceVertexOffset + 1) + distinctOffsetsByObject[objectIndex].vertexOffset + 1,
-                        objectData.m_vertices.GetDistinctPositionByInputPosition(faceVertexOffset + 2) + distinctOffsetsByObject[objectIndex].vertexOffset + 1,
-                    };
-                    const size_t n[3]{
-                        objectData.m_normals.GetDistinctPositionByInputPosition(faceVertexOffset + 0) + distinctOffsetsByObject[objectIndex].normalOffset + 1,
-                        objectData.m_normals.GetDistinctPositionByInputPosition(faceVertexOffset + 1) + distinctOffsetsByObject[objectIndex].normalOffset + 1,
-                        objectData.m_normals.GetDistinctPositionByInputPosition(faceVertexOffset + 2) + distinctOffsetsByObject[objectIndex].normalOffset + 1,
-                    };
-                    const size_t uv[3]{
-                        objectData.m_uvs.GetDistinctPositionByInputPosition(faceVertexOffset + 0) + distinctOffsetsByObject[objectIndex].uvOffset + 1,
-                        objectData.m_uvs.GetDistinctPositionByInputPosition(faceVertexOffset + 1) + distinctOffsetsByObject[objectIndex].uvOffset + 1,
-                        objectData.m_uvs.GetDistinctPositionByInputPosition(faceVertexOffset + 2) + distinctOffsetsByObject[objectIndex].uvOffset + 1,
-                    };
-
-                    m_stream << std::format("f {}/{}/{} {}/{}/{} {}/{}/{}\n", v[0], uv[0], n[0], v[1], uv[1], n[1], v[2], uv[2], n[2]);
-                    faceIndex++;
+                    buffer.Append("usemtl ");
+                    buffer.Append(xmodel.m_materials[object.materialIndex].name);
+                    buffer.Append('\n');
                 }
 
+                const auto& offsets = distinctOffsetsByObject[objectIndex];
+                text_format::FormatElements(m_stream,
+                                            buffer,
+                                            object.m_faces.size(),
+                                            [&objectData, &offsets](TextFormatBuffer& chunk, const size_t begin, const size_t end)
+                                            {
+                                                for (auto faceIndex = begin; faceIndex < end; faceIndex++)
+                                                    WriteFace(chunk, objectData, offsets, faceIndex);
+                                            });
+
                 objectIndex++;
             }
+
+            buffer.Flush(m_stream);
+        }
+
+        template<size_t N> static void WriteFloats(TextFormatBuffer& buffer, const std::string_view prefix, const float (&values)[N])
+        {
+            buffer.Append(prefix);
+            for (auto i = 0u; i < N; i++)
+            {
+                if (i > 0)
+                    buffer.Append(' ');
+                buffer.AppendFloat(values[i]);
+            }
+            buffer.Append('\n');
+        }
+
+        static void WriteFace(TextFormatBuffer& buffer, const ObjObjectData& objectData, const ObjObjectDataOffsets& offsets, const size_t faceIndex)
+        {
+            const auto faceVertexOffset = 3u * faceIndex;
+
+            buffer.Append('f');
+            for (auto i = 0u; i < 3u; i++)
+            {
+                buffer.Append(' ');
+                buffer.AppendInteger(objectData.m_vertices.GetDistinctPositionByInputPosition(faceVertexOffset + i) + offsets.vertexOffset + 1);
+                buffer.Append('/');
+                buffer.AppendInteger(objectData.m_uvs.GetDistinctPositionByInputPosition(faceVertexOffset + i) + offsets.uvOffset + 1);
+                buffer.Append('/');
+                buffer.AppendInteger(objectData.m_normals.GetDistinctPositionByInputPosition(faceVertexOffset + i) + offsets.normalOffset + 1);
+            }
+            buffer.Append('\n');
         }
 
         void GetObjObjectDataOffsets(const XModelCommon& xmodel,
@@ -0,0 +1,129 @@
+#include "TextFormatBuffer.h"
+
+#include "ObjWriting.h"
+#include "Utils/ThreadPool.h"
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    constexpr size_t BUFFER_SIZE = 0x10000u;
+
+    // Formatting on workers only pays off for models with a lot of elements
+    constexpr size_t CHUNK_ELEMENT_COUNT = 0x2000u;
+
+    // Bounds the amount of text that is formatted ahead of writing it
+    constexpr size_t CHUNKS_IN_FLIGHT_PER_WORKER = 2u;
+
+    void FormatElementsInParallel(std::ostream& stream, const size_t count, const unsigned workerCount, const text_format::chunk_formatter_t& formatter)
+    {
+        ThreadPool workerPool(workerCount);
+        const auto chunkCount = (count + CHUNK_ELEMENT_COUNT - 1u) / CHUNK_ELEMENT_COUNT;
+        const auto chunksInFlight = static_cast<size_t>(workerCount) * CHUNKS_IN_FLIGHT_PER_WORKER;
+
+        std::vector<std::future<std::unique_ptr<TextFormatBuffer>>> chunks;
+        chunks.reserve(chunkCount);
+
+        auto nextChunkToFormat = 0u;
+        const auto enqueueChunk = [&]
+        {
+            const auto begin = nextChunkToFormat * CHUNK_ELEMENT_COUNT;
+            const auto end = std::min(begin + CHUNK_ELEMENT_COUNT, count);
+            nextChunkToFormat++;
+
+            auto task = std::make_shared<std::packaged_task<std::unique_ptr<TextFormatBuffer>()>>(
+                [&formatter, begin, end]
+                {
+                    auto chunk = std::make_unique<TextFormatBuffer>();
+                    formatter(*chunk, begin, end);
+                    return chunk;
+                });
+
+            chunks.emplace_back(task->get_future());
+            workerPool.Enqueue(
+                [task]
+                {
+                    (*task)();
+                });
+        };
+
+        while (nextChunkToFormat < chunkCount && nextChunkToFormat < chunksInFlight)
+            enqueueChunk();
+
+        for (auto chunkIndex = 0u; chunkIndex < chunkCount; chunkIndex++)
+        {
+            chunks[chunkIndex].get()->Flush(stream);
+
+            if (nextChunkToFormat < chunkCount)
+                enqueueChunk();
+        }
+    }
+} // namespace
+
+TextFormatBuffer::TextFormatBuffer()
+{
+    m_buffer.reserve(BUFFER_SIZE);
+}
+
+void TextFormatBuffer::Append(const std::string_view text)
+{
+    m_buffer.append(text);
+}
+
+void TextFormatBuffer::Append(const char c)
+{
+    m_buffer.push_back(c);
+}
+
+void TextFormatBuffer::AppendFloat(const float value)
+{
+    char buffer[32];
+    const auto result = std::to_chars(std::begin(buffer), std::end(buffer), value, std::chars_format::general, 6);
+    m_buffer.append(buffer, result.ptr);
+}
+
+void TextFormatBuffer::AppendFixed(const float value)
+{
+    // Fixed notation of large floats needs up to 39 digits before the decimal point
+    char buffer[64];
+    const auto result = std::to_chars(std::begin(buffer), std::end(buffer), value, std::chars_format::fixed, 6);
+    m_buffer.append(buffer, result.ptr);
+}
+
+void TextFormatBuffer::FlushIfFull(std::ostream& stream)
+{
+    if (m_buffer.size() >= BUFFER_SIZE)
+        Flush(stream);
+}
+
+void TextFormatBuffer::Flush(std::ostream& stream)
+{
+    if (m_buffer.empty())
+        return;
+
+    stream.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+    m_buffer.clear();
+}
+
+namespace text_format
+{
+    void FormatElements(std::ostream& stream, TextFormatBuffer& buffer, const size_t count, const chunk_formatter_t& formatter)
+    {
+        const auto workerCount = ObjWriting::Configuration.ModelFormatWorkerCount;
+        if (workerCount > 1u && count > CHUNK_ELEMENT_COUNT)
+        {
+            buffer.Flush(stream);
+            FormatElementsInParallel(stream, count, workerCount, formatter);
+            return;
+        }
+
+        for (auto begin = 0u; begin < count; begin += CHUNK_ELEMENT_COUNT)
+        {
+            formatter(buffer, begin, std::min(begin + CHUNK_ELEMENT_COUNT, count));
+            buffer.FlushIfFull(stream);
+        }
+    }
+} // namespace text_format
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * \brief Formats text of model files into a reusable buffer that is written to the output stream in blocks.
+ * Numbers are formatted with \c std::to_chars and produce the same text as formatting them with iostreams or \c std::format.
+ */
+class TextFormatBuffer
+{
+public:
+    TextFormatBuffer();
+
+    void Append(std::string_view text);
+    void Append(char c);
+
+    template<typename T> void AppendInteger(const T value)
+    {
+        static_assert(std::is_integral_v<T>);
+
+        char buffer[24];
+        const auto result = std::to_chars(std::begin(buffer), std::end(buffer), value);
+        m_buffer.append(buffer, result.ptr);
+    }
+
+    /**
+     * \brief Appends a float like writing it to a stream with default formatting, which uses six significant digits.
+     */
+    void AppendFloat(float value);
+
+    /**
+     * \brief Appends a float with six digits after the decimal point like formatting it with \c {:.6f}.
+     */
+    void AppendFixed(float value);
+
+    /**
+     * \brief Writes the buffered text to the stream once enough text was buffered to write it as a block.
+     * \param stream The stream to write to.
+     */
+    void FlushIfFull(std::ostream& stream);
+
+    /**
+     * \brief Writes all buffered text to the stream.
+     * \param stream The stream to write to.
+     */
+    void Flush(std::ostream& stream);
+
+private:
+    std::string m_buffer;
+};
+
+namespace text_format
+{
+    using chunk_formatter_t = std::function<void(TextFormatBuffer& buffer, size_t begin, size_t end)>;
+
+    /**
+     * \brief Formats the elements [0, count) in order and writes them to the stream.
+     * When multiple workers are configured and there are enough elements, chunks of elements are formatted on worker threads and written in their original order.
+     * \param stream The stream to write to.
+     * \param buffer The buffer of the writer. Any buffered text is written before the formatted elements.
+     * \param count The amount of elements to format.
+     * \param formatter Formats a range of elements. Must be safe to call from multiple threads for different ranges at once.
+     */
+    void FormatElements(std::ostream& stream, TextFormatBuffer& buffer, size_t count, const chunk_formatter_t& formatter);
+} // namespace text_format
@@ -0,0 +1,347 @@
+#include "ZipWriter.h"
+
+#include "Utils/StringUtils.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <unordered_set>
+#include <zlib.h>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr uint32_t LOCAL_FILE_HEADER_SIGNATURE = 0x04034B50u;
+    constexpr uint32_t CENTRAL_DIRECTORY_HEADER_SIGNATURE = 0x02014B50u;
+    constexpr uint32_t ZIP64_END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06064B50u;
+    constexpr uint32_t ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIGNATURE = 0x07064B50u;
+    constexpr uint32_t END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06054B50u;
+    constexpr uint16_t VERSION_NEEDED_TO_EXTRACT = 20u;
+    constexpr uint16_t VERSION_NEEDED_TO_EXTRACT_ZIP64 = 45u;
+    constexpr uint16_t COMPRESSION_METHOD_STORE = 0u;
+    constexpr uint16_t COMPRESSION_METHOD_DEFLATE = 8u;
+    constexpr uint16_t ZIP64_EXTRA_FIELD_ID = 0x0001u;
+
+    // All files get the same modification time of 1980-01-01 00:00, so writing the same files always results in the same archive
+    constexpr uint16_t DOS_TIME = 0u;
+    constexpr uint16_t DOS_DATE = (1u << 5u) | 1u;
+
+    // Without the zip64 extension sizes, offsets and counts are limited, values at the limit mark that the zip64 extension holds them
+    constexpr uint64_t MAX_SIZE = std::numeric_limits<uint32_t>::max();
+    constexpr size_t MAX_FILE_COUNT = std::numeric_limits<uint16_t>::max();
+
+    // Formats that do not get smaller when compressing them again
+    const std::unordered_set<std::string> STORED_EXTENSIONS{
+        ".bik",
+        ".flac",
+        ".gz",
+        ".iwd",
+        ".jpeg",
+        ".jpg",
+        ".mp3",
+        ".ogg",
+        ".png",
+        ".zip",
+    };
+
+    // Enough files are compressed ahead of writing them to keep every compression thread busy while the current file is written
+    constexpr size_t COMPRESSION_DEPTH_PER_THREAD = 2u;
+
+    void AppendUInt16(std::vector<uint8_t>& buffer, const uint16_t value)
+    {
+        buffer.emplace_back(static_cast<uint8_t>(value & 0xFFu));
+        buffer.emplace_back(static_cast<uint8_t>(value >> 8u));
+    }
+
+    void AppendUInt32(std::vector<uint8_t>& buffer, const uint32_t value)
+    {
+        AppendUInt16(buffer, static_cast<uint16_t>(value & 0xFFFFu));
+        AppendUInt16(buffer, static_cast<uint16_t>(value >> 16u));
+    }
+
+    void AppendUInt64(std::vector<uint8_t>& buffer, const uint64_t value)
+    {
+        AppendUInt32(buffer, static_cast<uint32_t>(value & 0xFFFFFFFFu));
+        AppendUInt32(buffer, static_cast<uint32_t>(value >> 32u));
+    }
+
+    void AppendString(std::vector<uint8_t>& buffer, const std::string& value)
+    {
+        buffer.insert(buffer.end(), value.begin(), value.end());
+    }
+
+    uint32_t LimitedSize(const uint64_t value)
+    {
+        return static_cast<uint32_t>(std::min(value, MAX_SIZE));
+    }
+
+    bool ShouldStoreUncompressed(const std::string& name)
+    {
+        auto extension = fs::path(name).extension().string();
+        utils::MakeStringLowerCase(extension);
+
+        return STORED_EXTENSIONS.contains(extension);
+    }
+
+    uint32_t CalculateCrc32(const std::vector<uint8_t>& data)
+    {
+        auto crc = crc32(0L, Z_NULL, 0);
+
+        // Files of zip64 archives can be bigger than what zlib takes at once
+        for (size_t offset = 0u; offset < data.size(); offset += std::numeric_limits<uInt>::max())
+        {
+            const auto chunkSize = std::min<size_t>(data.size() - offset, std::numeric_limits<uInt>::max());
+            crc = crc32(crc, &data[offset], static_cast<uInt>(chunkSize));
+        }
+
+        return static_cast<uint32_t>(crc);
+    }
+} // namespace
+
+ZipWriter::ZipWriter(std::ostream& stream, const bool allowZip64, const unsigned workerCount)
+    : m_stream(stream),
+      m_allow_zip64(allowZip64),
+      m_current_offset(0u),
+      m_failed(false),
+      m_compression_pool(workerCount)
+{
+}
+
+void ZipWriter::Write(const void* data, const size_t dataSize)
+{
+    m_stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(dataSize));
+    m_current_offset += dataSize;
+}
+
+ZipWriter::CompressedFile ZipWriter::CompressFile(const std::string& name, std::vector<uint8_t> data)
+{
+    CompressedFile file;
+    file.m_crc32 = CalculateCrc32(data);
+    file.m_uncompressed_size = data.size();
+    file.m_compression_method = COMPRESSION_METHOD_STORE;
+
+    if (!data.empty() && data.size() <= std::numeric_limits<uInt>::max() && !ShouldStoreUncompressed(name))
+    {
+        z_stream zs{};
+        if (deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK)
+        {
+            std::vector<uint8_t> compressedData(deflateBound(&zs, static_cast<uLong>(data.size())));
+
+            zs.next_in = data.data();
+            zs.avail_in = static_cast<uInt>(data.size());
+            zs.next_out = compressedData.data();
+            zs.avail_out = static_cast<uInt>(compressedData.size());
+
+            const auto result = deflate(&zs, Z_FINISH);
+            compressedData.resize(zs.total_out);
+            deflateEnd(&zs);
+
+            if (result == Z_STREAM_END && compressedData.size() < data.size())
+            {
+                file.m_data = std::move(compressedData);
+                file.m_compression_method = COMPRESSION_METHOD_DEFLATE;
+
+                return file;
+            }
+        }
+    }
+
+    file.m_data = std::move(data);
+    return file;
+}
+
+bool ZipWriter::AddFile(std::string name, std::vector<uint8_t> data)
+{
+    // Paths inside of zip files always use forward slashes
+    std::ranges::replace(name, '\\', '/');
+
+    auto task = std::make_shared<std::packaged_task<CompressedFile()>>(
+        [name, data = std::move(data)]() mutable
+        {
+            return CompressFile(name, std::move(data));
+        });
+    auto result = task->get_future();
+
+    std::lock_guard lock(m_mutex);
+    if (m_failed)
+        return false;
+
+    m_compression_pool.Enqueue(
+        [task]
+        {
+            (*task)();
+        });
+    m_pending_files.emplace_back(PendingFile{std::move(name), std::move(result)});
+
+    while (!m_failed && m_pending_files.size() > m_compression_pool.GetThreadCount() * COMPRESSION_DEPTH_PER_THREAD)
+    {
+        m_failed = !WritePendingFile(m_pending_files.front());
+        m_pending_files.pop_front();
+    }
+
+    return !m_failed;
+}
+
+bool ZipWriter::Finish()
+{
+    std::lock_guard lock(m_mutex);
+
+    while (!m_pending_files.empty())
+    {
+        // Compression jobs of files that are not written anymore still need to finish since they do not own the pool
+        if (!m_failed)
+            m_failed = !WritePendingFile(m_pending_files.front());
+        else
+            m_pending_files.front().m_result.wait();
+
+        m_pending_files.pop_front();
+    }
+
+    if (m_failed)
+        return false;
+
+    m_failed = !WriteCentralDirectory();
+    return !m_failed;
+}
+
+bool ZipWriter::WritePendingFile(PendingFile& pendingFile)
+{
+    const auto file = pendingFile.m_result.get();
+
+    const auto needsZip64 = file.m_data.size() >= MAX_SIZE || file.m_uncompressed_size >= MAX_SIZE;
+    if (!m_allow_zip64 && (needsZip64 || m_current_offset >= MAX_SIZE || m_central_directory.size() >= MAX_FILE_COUNT))
+    {
+        std::cerr << "Zip archive is too big, cannot add file \"" << pendingFile.m_name << "\"\n";
+        return false;
+    }
+
+    const CentralDirectoryEntry entry{
+        pendingFile.m_name,
+        file.m_crc32,
+        file.m_data.size(),
+        file.m_uncompressed_size,
+        file.m_compression_method,
+        m_current_offset,
+    };
+
+    std::vector<uint8_t> header;
+    AppendUInt32(header, LOCAL_FILE_HEADER_SIGNATURE);
+    AppendUInt16(header, needsZip64 ? VERSION_NEEDED_TO_EXTRACT_ZIP64 : VERSION_NEEDED_TO_EXTRACT);
+    AppendUInt16(header, 0u); // Flags
+    AppendUInt16(header, entry.m_compression_method);
+    AppendUInt16(header, DOS_TIME);
+    AppendUInt16(header, DOS_DATE);
+    AppendUInt32(header, entry.m_crc32);
+    AppendUInt32(header, needsZip64 ? static_cast<uint32_t>(MAX_SIZE) : LimitedSize(entry.m_compressed_size));
+    AppendUInt32(header, needsZip64 ? static_cast<uint32_t>(MAX_SIZE) : LimitedSize(entry.m_uncompressed_size));
+    AppendUInt16(header, static_cast<uint16_t>(entry.m_name.size()));
+    AppendUInt16(header, needsZip64 ? 20u : 0u); // Extra field length
+    AppendString(header, entry.m_name);
+
+    // The local header of a zip64 file must contain both sizes
+    if (needsZip64)
+    {
+        AppendUInt16(header, ZIP64_EXTRA_FIELD_ID);
+        AppendUInt16(header, 16u);
+        AppendUInt64(header, entry.m_uncompressed_size);
+        AppendUInt64(header, entry.m_compressed_size);
+    }
+
+    Write(header.data(), header.size());
+    Write(file.m_data.data(), file.m_data.size());
+
+    m_central_directory.emplace_back(entry);
+
+    return m_stream.good();
+}
+
+bool ZipWriter::WriteCentralDirectory()
+{
+    const auto centralDirectoryOffset = m_current_offset;
+
+    std::vector<uint8_t> centralDirectory;
+    for (const auto& entry : m_central_directory)
+    {
+        // The zip64 extra field only contains the values that do not fit, in this order
+        std::vector<uint8_t> zip64Values;
+        if (entry.m_uncompressed_size >= MAX_SIZE)
+            AppendUInt64(zip64Values, entry.m_uncompressed_size);
+        if (entry.m_compressed_size >= MAX_SIZE)
+            AppendUInt64(zip64Values, entry.m_compressed_size);
+        if (entry.m_local_header_offset >= MAX_SIZE)
+            AppendUInt64(zip64Values, entry.m_local_header_offset);
+
+        const auto versionNeeded = zip64Values.empty() ? VERSION_NEEDED_TO_EXTRACT : VERSION_NEEDED_TO_EXTRACT_ZIP64;
+        AppendUInt32(centralDirectory, CENTRAL_DIRECTORY_HEADER_SIGNATURE);
+        AppendUInt16(centralDirectory, versionNeeded); // Version made by
+        AppendUInt16(centralDirectory, versionNeeded);
+        AppendUInt16(centralDirectory, 0u); // Flags
+        AppendUInt16(centralDirectory, entry.m_compression_method);
+        AppendUInt16(centralDirectory, DOS_TIME);
+        AppendUInt16(centralDirectory, DOS_DATE);
+        AppendUInt32(centralDirectory, entry.m_crc32);
+        AppendUInt32(centralDirectory, LimitedSize(entry.m_compressed_size));
+        AppendUInt32(centralDirectory, LimitedSize(entry.m_uncompressed_size));
+        AppendUInt16(centralDirectory, static_cast<uint16_t>(entry.m_name.size()));
+        AppendUInt16(centralDirectory, static_cast<uint16_t>(zip64Values.empty() ? 0u : zip64Values.size() + 4u)); // Extra field length
+        AppendUInt16(centralDirectory, 0u); // Comment length
+        AppendUInt16(centralDirectory, 0u); // Disk number start
+        AppendUInt16(centralDirectory, 0u); // Internal attributes
+        AppendUInt32(centralDirectory, 0u); // External attributes
+        AppendUInt32(centralDirectory, LimitedSize(entry.m_local_header_offset));
+        AppendString(centralDirectory, entry.m_name);
+
+        if (!zip64Values.empty())
+        {
+            AppendUInt16(centralDirectory, ZIP64_EXTRA_FIELD_ID);
+            AppendUInt16(centralDirectory, static_cast<uint16_t>(zip64Values.size()));
+            centralDirectory.insert(centralDirectory.end(), zip64Values.begin(), zip64Values.end());
+        }
+    }
+
+    const uint64_t centralDirectorySize = centralDirectory.size();
+    const uint64_t entryCount = m_central_directory.size();
+    const auto needsZip64 = entryCount > MAX_FILE_COUNT || centralDirectoryOffset >= MAX_SIZE || centralDirectorySize >= MAX_SIZE;
+    if (needsZip64 && !m_allow_zip64)
+    {
+        std::cerr << "Zip archive is too big\n";
+        return false;
+    }
+
+    if (needsZip64)
+    {
+        const auto zip64EndOfCentralDirectoryOffset = centralDirectoryOffset + centralDirectorySize;
+
+        AppendUInt32(centralDirectory, ZIP64_END_OF_CENTRAL_DIRECTORY_SIGNATURE);
+        AppendUInt64(centralDirectory, 44u); // Size of the remaining record
+        AppendUInt16(centralDirectory, VERSION_NEEDED_TO_EXTRACT_ZIP64); // Version made by
+        AppendUInt16(centralDirectory, VERSION_NEEDED_TO_EXTRACT_ZIP64);
+        AppendUInt32(centralDirectory, 0u); // Number of this disk
+        AppendUInt32(centralDirectory, 0u); // Disk with the central directory
+        AppendUInt64(centralDirectory, entryCount);
+        AppendUInt64(centralDirectory, entryCount);
+        AppendUInt64(centralDirectory, centralDirectorySize);
+        AppendUInt64(centralDirectory, centralDirectoryOffset);
+
+        AppendUInt32(centralDirectory, ZIP64_END_OF_CENTRAL_DIRECTORY_LOCATOR_SIGNATURE);
+        AppendUInt32(centralDirectory, 0u); // Disk with the zip64 end of central directory
+        AppendUInt64(centralDirectory, zip64EndOfCentralDirectoryOffset);
+        AppendUInt32(centralDirectory, 1u); // Total number of disks
+    }
+
+    const auto limitedEntryCount = static_cast<uint16_t>(std::min<uint64_t>(entryCount, MAX_FILE_COUNT));
+    AppendUInt32(centralDirectory, END_OF_CENTRAL_DIRECTORY_SIGNATURE);
+    AppendUInt16(centralDirectory, 0u); // Number of this disk
+    AppendUInt16(centralDirectory, 0u); // Disk with the central directory
+    AppendUInt16(centralDirectory, limitedEntryCount);
+    AppendUInt16(centralDirectory, limitedEntryCount);
+    AppendUInt32(centralDirectory, LimitedSize(centralDirectorySize));
+    AppendUInt32(centralDirectory, LimitedSize(centralDirectoryOffset));
+    AppendUInt16(centralDirectory, 0u); // Comment length
+
+    Write(centralDirectory.data(), centralDirectory.size());
+
+    return m_stream.good();
+}
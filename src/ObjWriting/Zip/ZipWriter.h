@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Utils/ThreadPool.h"
+
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Writes a zip archive to a stream while compressing its files on multiple threads.
+ * Every file is compressed into its own deflate stream, files that are already compressed or do not get smaller are stored uncompressed.
+ * Files are written in the order they were added and always get the same modification time, so adding the same files results in the same archive.
+ */
+class ZipWriter
+{
+    class CompressedFile
+    {
+    public:
+        std::vector<uint8_t> m_data;
+        uint32_t m_crc32;
+        uint64_t m_uncompressed_size;
+        uint16_t m_compression_method;
+    };
+
+    class PendingFile
+    {
+    public:
+        std::string m_name;
+        std::future<CompressedFile> m_result;
+    };
+
+    class CentralDirectoryEntry
+    {
+    public:
+        std::string m_name;
+        uint32_t m_crc32;
+        uint64_t m_compressed_size;
+        uint64_t m_uncompressed_size;
+        uint16_t m_compression_method;
+        uint64_t m_local_header_offset;
+    };
+
+    std::ostream& m_stream;
+    bool m_allow_zip64;
+    uint64_t m_current_offset;
+    bool m_failed;
+
+    std::deque<PendingFile> m_pending_files;
+    std::vector<CentralDirectoryEntry> m_central_directory;
+    std::mutex m_mutex;
+
+    ThreadPool m_compression_pool;
+
+    void Write(const void* data, size_t dataSize);
+    static CompressedFile CompressFile(const std::string& name, std::vector<uint8_t> data);
+    bool WritePendingFile(PendingFile& pendingFile);
+    bool WriteCentralDirectory();
+
+public:
+    /**
+     * \brief Creates a zip writer.
+     * \param stream The stream to write the archive to.
+     * \param allowZip64 Whether the zip64 extension may be used for archives with more than 65535 files or sizes and offsets of 4GiB and more.
+     * Without it, adding files beyond those limits fails.
+     * \param workerCount The amount of threads compressing files. A value of \c 0 uses one thread per hardware thread.
+     */
+    ZipWriter(std::ostream& stream, bool allowZip64, unsigned workerCount = 0u);
+    ~ZipWriter() = default;
+    ZipWriter(const ZipWriter& other) = delete;
+    ZipWriter(ZipWriter&& other) noexcept = delete;
+    ZipWriter& operator=(const ZipWriter& other) = delete;
+    ZipWriter& operator=(ZipWriter&& other) noexcept = delete;
+
+    /**
+     * \brief Queues a file to be compressed and written to the archive. Can be called from multiple threads at once.
+     * Blocks while enough files are waiting for compression to keep all compression threads busy.
+     * \param name The path of the file inside of the archive.
+     * \param data The contents of the file.
+     * \return \c false if writing the archive failed, otherwise \c true.
+     */
+    bool AddFile(std::string name, std::vector<uint8_t> data);
+
+    /**
+     * \brief Writes all remaining files and the central directory of the archive. No files can be added afterwards.
+     * \return \c true if the whole archive was written successfully, otherwise \c false.
+     */
+    bool Finish();
+};
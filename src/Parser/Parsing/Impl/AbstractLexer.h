@@ -4,11 +4,13 @@
 #include "Parsing/IParserLineStream.h"
 #include "Parsing/ParsingException.h"
 #include "Utils/ClassUtils.h"
+#include "Utils/RingBuffer.h"
 #include "Utils/StringUtils.h"
 
 #include <cassert>
-#include <deque>
 #include <sstream>
+#include <string>
+#include <string_view>
 
 template<typename TokenType> class AbstractLexer : public ILexer<TokenType>
 {
@@ -16,8 +18,10 @@ template<typename TokenType> class AbstractLexer : public ILexer<TokenType>
     static_assert(std::is_base_of<IParserValue, TokenType>::value);
 
 protected:
-    std::deque<TokenType> m_token_cache;
-    std::deque<ParserLine> m_line_cache;
+    // Ring buffers do not need to allocate for every token and line like a deque might.
+    // Reading more tokens or lines can move the cached ones, so references to them must not be kept across reads.
+    RingBuffer<TokenType> m_token_cache;
+    RingBuffer<ParserLine> m_line_cache;
     IParserLineStream* const m_stream;
 
     unsigned m_line_index;
@@ -121,6 +125,15 @@ protected:
      * \return The value of the read identifier
      */
     std::string ReadIdentifier()
+    {
+        return std::string(ReadIdentifierView());
+    }
+
+    /**
+     * \brief Reads an identifier from the current position without copying it
+     * \return The value of the read identifier which is only valid until the current line is removed from the line cache
+     */
+    std::string_view ReadIdentifierView()
     {
         const auto& currentLine = CurrentLine();
         assert(m_current_line_offset >= 1);
@@ -138,7 +151,7 @@ protected:
             m_current_line_offset++;
         }
 
-        return std::string(currentLine.m_line, startPos, m_current_line_offset - startPos);
+        return std::string_view(currentLine.m_line).substr(startPos, m_current_line_offset - startPos);
     }
 
     /**
@@ -379,7 +392,8 @@ public:
         }
         else
         {
-            m_token_cache.erase(m_token_cache.begin(), m_token_cache.begin() + amount);
+            for (auto i = 0; i < amount; i++)
+                m_token_cache.pop_front();
             const auto& firstToken = m_token_cache.front();
             while (!m_line_cache.empty()
                    && (m_line_cache.front().m_line_number != firstToken.GetPos().m_line
@@ -403,8 +417,9 @@ public:
 
     _NODISCARD ParserLine GetLineForPos(const TokenPos& pos) const override
     {
-        for (const auto& line : m_line_cache)
+        for (auto i = 0u; i < m_line_cache.size(); i++)
         {
+            const auto& line = m_line_cache[i];
             if (line.m_filename && *line.m_filename == pos.m_filename.get() && line.m_line_number == pos.m_line)
             {
                 return line;
@@ -5,7 +5,10 @@
 #include "Parsing/ParsingException.h"
 #include "Parsing/Sequence/AbstractSequence.h"
 
+#include <algorithm>
+#include <concepts>
 #include <iostream>
+#include <unordered_map>
 #include <vector>
 
 template<typename TokenType, typename ParserState> class AbstractParser : public IParser
@@ -16,16 +19,103 @@ template<typename TokenType, typename ParserState> class AbstractParser : public
 public:
     typedef AbstractSequence<TokenType, ParserState> sequence_t;
 
+private:
+    // Tokens that are able to compute a key allow to only try sequences that can start with the current token
+    static constexpr bool SUPPORTS_FIRST_TOKEN_DISPATCH = requires(const TokenType& token, size_t& key) {
+        { token.GetFirstTokenKey(key) } -> std::convertible_to<bool>;
+    };
+
+    class FirstTokenDispatch
+    {
+    public:
+        // Contains all sequences that are able to start with a token with the key in their original order
+        std::unordered_map<size_t, std::vector<sequence_t*>> m_tests_by_key;
+        // Contains all sequences that cannot be narrowed down to a set of keys in their original order
+        std::vector<sequence_t*> m_unkeyed_tests;
+    };
+
+    std::unordered_map<const std::vector<sequence_t*>*, FirstTokenDispatch> m_first_token_dispatch;
+
+    static FirstTokenDispatch CreateFirstTokenDispatch(const std::vector<sequence_t*>& tests)
+    {
+        FirstTokenDispatch dispatch;
+
+        std::vector<std::vector<size_t>> keysByTest(tests.size());
+        std::vector<bool> testIsKeyed(tests.size());
+        for (auto i = 0u; i < tests.size(); i++)
+        {
+            auto& keys = keysByTest[i];
+            testIsKeyed[i] = tests[i]->GetFirstTokenKeys(keys);
+
+            std::ranges::sort(keys);
+            const auto [uniqueEnd, end] = std::ranges::unique(keys);
+            keys.erase(uniqueEnd, end);
+
+            if (testIsKeyed[i])
+            {
+                for (const auto key : keys)
+                    dispatch.m_tests_by_key.try_emplace(key);
+            }
+        }
+
+        for (auto i = 0u; i < tests.size(); i++)
+        {
+            if (testIsKeyed[i])
+            {
+                for (const auto key : keysByTest[i])
+                    dispatch.m_tests_by_key[key].push_back(tests[i]);
+            }
+            else
+            {
+                for (auto& [key, keyedTests] : dispatch.m_tests_by_key)
+                    keyedTests.push_back(tests[i]);
+                dispatch.m_unkeyed_tests.push_back(tests[i]);
+            }
+        }
+
+        return dispatch;
+    }
+
+    const std::vector<sequence_t*>& GetTestsForFirstToken(const std::vector<sequence_t*>& tests)
+    {
+        if constexpr (SUPPORTS_FIRST_TOKEN_DISPATCH)
+        {
+            auto dispatch = m_first_token_dispatch.find(&tests);
+            if (dispatch == m_first_token_dispatch.end())
+                dispatch = m_first_token_dispatch.emplace(&tests, CreateFirstTokenDispatch(tests)).first;
+
+            size_t key;
+            if (m_lexer->GetToken(0).GetFirstTokenKey(key))
+            {
+                const auto keyedTests = dispatch->second.m_tests_by_key.find(key);
+                if (keyedTests != dispatch->second.m_tests_by_key.end())
+                    return keyedTests->second;
+            }
+
+            return dispatch->second.m_unkeyed_tests;
+        }
+        else
+        {
+            return tests;
+        }
+    }
+
 protected:
     ILexer<TokenType>* m_lexer;
     std::unique_ptr<ParserState> m_state;
+    std::ostream* m_error_stream;
 
     explicit AbstractParser(ILexer<TokenType>* lexer, std::unique_ptr<ParserState> state)
         : m_lexer(lexer),
-          m_state(std::move(state))
+          m_state(std::move(state)),
+          m_error_stream(&std::cerr)
     {
     }
 
+    /**
+     * \brief Returns the sequences to try for the current state.
+     * The returned collections are indexed by their first token the first time they are used, so they must not change afterwards.
+     */
     virtual const std::vector<sequence_t*>& GetTestsForState() = 0;
 
 public:
@@ -35,6 +125,15 @@ public:
     AbstractParser& operator=(const AbstractParser& other) = default;
     AbstractParser& operator=(AbstractParser&& other) noexcept = default;
 
+    /**
+     * \brief Sets the stream that parsing errors are reported to instead of stderr.
+     * \param errorStream The stream to report errors to. Must outlive the parser.
+     */
+    void SetErrorStream(std::ostream& errorStream)
+    {
+        m_error_stream = &errorStream;
+    }
+
     bool Parse() override
     {
         try
@@ -42,7 +141,7 @@ public:
             while (!m_lexer->IsEof())
             {
                 auto testSuccessful = false;
-                const auto& availableTests = GetTestsForState();
+                const auto& availableTests = GetTestsForFirstToken(GetTestsForState());
 
                 for (const sequence_t* test : availableTests)
                 {
@@ -63,12 +162,12 @@ public:
 
                     if (!line.IsEof())
                     {
-                        std::cerr << "Error: " << pos.m_filename.get() << " L" << pos.m_line << ':' << pos.m_column << " Could not parse expression:\n"
+                        *m_error_stream << "Error: " << pos.m_filename.get() << " L" << pos.m_line << ':' << pos.m_column << " Could not parse expression:\n"
                                   << line.m_line.substr(pos.m_column - 1) << "\n";
                     }
                     else
                     {
-                        std::cerr << "Error: " << pos.m_filename.get() << " L" << pos.m_line << ':' << pos.m_column << " Could not parse expression.\n";
+                        *m_error_stream << "Error: " << pos.m_filename.get() << " L" << pos.m_line << ':' << pos.m_column << " Could not parse expression.\n";
                     }
                     return false;
                 }
@@ -81,11 +180,11 @@ public:
 
             if (!line.IsEof() && line.m_line.size() > static_cast<unsigned>(pos.m_column - 1))
             {
-                std::cerr << "Error: " << e.FullMessage() << "\n" << line.m_line.substr(pos.m_column - 1) << "\n";
+                *m_error_stream << "Error: " << e.FullMessage() << "\n" << line.m_line.substr(pos.m_column - 1) << "\n";
             }
             else
             {
-                std::cerr << "Error: " << e.FullMessage() << "\n";
+                *m_error_stream << "Error: " << e.FullMessage() << "\n";
             }
 
             return false;
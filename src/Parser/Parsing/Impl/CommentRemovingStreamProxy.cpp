@@ -1,5 +1,36 @@
 #include "CommentRemovingStreamProxy.h"
 
+#include <cstring>
+
+namespace
+{
+    size_t FindFirstOf(const std::string& text, const size_t offset, const char c0, const char c1)
+    {
+        // memchr is vectorised by the standard library, so two searches are a lot faster than comparing every character with both
+        const auto* begin = text.data() + offset;
+        const auto size = text.size() - offset;
+
+        const auto* found0 = static_cast<const char*>(std::memchr(begin, c0, size));
+        const auto* found1 = static_cast<const char*>(std::memchr(begin, c1, found0 ? static_cast<size_t>(found0 - begin) : size));
+
+        if (found1)
+            return static_cast<size_t>(found1 - text.data());
+        if (found0)
+            return static_cast<size_t>(found0 - text.data());
+
+        return std::string::npos;
+    }
+
+    size_t FindMultiLineCommentEnd(const std::string& text, const size_t starOffset)
+    {
+        auto slashPos = text.find('/', starOffset + 1u);
+        while (slashPos != std::string::npos && text[slashPos - 1u] != '*')
+            slashPos = text.find('/', slashPos + 1u);
+
+        return slashPos;
+    }
+} // namespace
+
 CommentRemovingStreamProxy::CommentRemovingStreamProxy(IParserLineStream* stream)
     : m_stream(stream),
       m_inside_multi_line_comment(false),
@@ -14,57 +45,78 @@ ParserLine CommentRemovingStreamProxy::NextLine()
     if (m_next_line_is_comment)
     {
         m_next_line_is_comment = !line.m_line.empty() && line.m_line[line.m_line.size() - 1] == '\\';
-        return ParserLine(line.m_filename, line.m_line_number, std::string());
+        line.m_line.clear();
+        return line;
     }
 
-    auto multiLineCommentStart = 0u;
+    // Instead of looking at every character, the search jumps to the next character that can change the state
+    auto& text = line.m_line;
+    size_t multiLineCommentStart = 0u;
+    size_t i = 0u;
     auto inString = false;
-    auto isEscaped = false;
-    for (auto i = 0u; i < line.m_line.size(); i++)
+    while (i < text.size())
     {
-        const auto c = line.m_line[i];
-
         if (m_inside_multi_line_comment)
         {
-            if (c == '*' && i + 1 < line.m_line.size() && line.m_line[i + 1] == '/')
-            {
-                line.m_line.erase(multiLineCommentStart, i + 2 - multiLineCommentStart);
-                i = multiLineCommentStart - 1;
-                multiLineCommentStart = 0;
-                m_inside_multi_line_comment = false;
-            }
+            // The star of the comment end may directly follow the slash of the comment start
+            const auto slashPos = FindMultiLineCommentEnd(text, i);
+            if (slashPos == std::string::npos)
+                break;
+
+            text.erase(multiLineCommentStart, slashPos + 1 - multiLineCommentStart);
+            i = multiLineCommentStart;
+            multiLineCommentStart = 0u;
+            m_inside_multi_line_comment = false;
         }
         else if (inString)
         {
-            if (isEscaped)
-                isEscaped = false;
-            else if (c == '\\')
-                isEscaped = true;
-            else if (c == '"')
+            const auto pos = FindFirstOf(text, i, '"', '\\');
+            if (pos == std::string::npos)
+                break;
+
+            // Skip the escaped character after a backslash
+            if (text[pos] == '\\')
+                i = pos + 2u;
+            else
+            {
                 inString = false;
+                i = pos + 1u;
+            }
         }
         else
         {
-            if (c == '"')
+            const auto pos = FindFirstOf(text, i, '"', '/');
+            if (pos == std::string::npos)
+                break;
+
+            if (text[pos] == '"')
             {
                 inString = true;
+                i = pos + 1u;
+                continue;
             }
-            else if (c == '/' && i + 1 < line.m_line.size())
+
+            if (pos + 1u < text.size())
             {
-                const auto c1 = line.m_line[i + 1];
+                const auto c1 = text[pos + 1u];
 
                 if (c1 == '*')
                 {
-                    multiLineCommentStart = i;
+                    multiLineCommentStart = pos;
                     m_inside_multi_line_comment = true;
+                    i = pos + 1u;
+                    continue;
                 }
-                else if (c1 == '/')
+
+                if (c1 == '/')
                 {
-                    m_next_line_is_comment = line.m_line[line.m_line.size() - 1] == '\\';
-                    line.m_line.erase(i);
+                    m_next_line_is_comment = text[text.size() - 1] == '\\';
+                    text.erase(pos);
                     return line;
                 }
             }
+
+            i = pos + 1u;
         }
     }
 
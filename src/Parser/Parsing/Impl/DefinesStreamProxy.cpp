@@ -510,7 +510,7 @@ bool DefinesStreamProxy::FindMacroForIdentifier(const std::string& input,
                                                 const unsigned identifierEnd,
                                                 const Define*& value) const
 {
-    const std::string identifier(input, identifierStart, identifierEnd - identifierStart);
+    const auto identifier = std::string_view(input).substr(identifierStart, identifierEnd - identifierStart);
     const auto foundEntry = m_defines.find(identifier);
     if (foundEntry != m_defines.end())
     {
@@ -531,7 +531,6 @@ void DefinesStreamProxy::ExtractParametersFromMacroUsage(
     state.m_parameter_state = ParameterState::AFTER_OPEN;
     state.m_parameters = std::vector<std::string>();
     state.m_current_parameter.clear();
-    state.m_current_parameter.str(std::string());
     state.m_bracket_depth = std::stack<char>();
 
     ContinueMacroParameters(line, linePos, state, input, inputPos);
@@ -721,7 +720,7 @@ namespace
             m_end = offset;
         }
 
-        void EmitValue(std::ostream& out, const std::string& input) const
+        void EmitValue(std::string& out, const std::string& input) const
         {
             if (m_end <= m_start)
                 return;
@@ -729,12 +728,12 @@ namespace
             if (m_type == TokenPasteTokenType::STRING)
             {
                 if (m_end - m_start > 2)
-                    out << std::string(input, m_start + 1, m_end - m_start - 2);
+                    out.append(input, m_start + 1, m_end - m_start - 2);
             }
             else
             {
                 assert(m_type == TokenPasteTokenType::IDENTIFIER || m_type == TokenPasteTokenType::SYMBOL);
-                out << std::string(input, m_start, m_end - m_start);
+                out.append(input, m_start, m_end - m_start);
             }
         }
 
@@ -744,17 +743,17 @@ namespace
     };
 
     void EmitPastedTokens(
-        ParserLine& line, unsigned& linePos, std::ostream& out, const std::string& input, const TokenPasteToken& token0, const TokenPasteToken& token1)
+        ParserLine& line, unsigned& linePos, std::string& out, const std::string& input, const TokenPasteToken& token0, const TokenPasteToken& token1)
     {
         if ((token0.m_type == TokenPasteTokenType::STRING) != (token1.m_type == TokenPasteTokenType::STRING))
             throw new ParsingException(TokenPos(*line.m_filename, line.m_line_number, static_cast<int>(linePos + 1)),
                                        "String token can only use token-pasting operator on other string token");
         if (token0.m_type == TokenPasteTokenType::STRING)
         {
-            out << '"';
+            out += '"';
             token0.EmitValue(out, input);
             token1.EmitValue(out, input);
-            out << '"';
+            out += '"';
         }
         else
         {
@@ -769,7 +768,8 @@ namespace
 void DefinesStreamProxy::ProcessTokenPastingOperators(
     ParserLine& line, unsigned& linePos, std::vector<const Define*>& callstack, std::string& input, unsigned& inputPos)
 {
-    std::ostringstream ss;
+    std::string ss;
+    ss.reserve(input.size());
 
     auto pasteNext = false;
     TokenPasteToken previousToken;
@@ -792,7 +792,7 @@ void DefinesStreamProxy::ProcessTokenPastingOperators(
                 throw new ParsingException(CreatePos(line, linePos), "Cannot use token-pasting operator without previous token");
 
             if (previousToken.m_end < currentToken.m_start)
-                ss << std::string(input, previousToken.m_end, currentToken.m_start - previousToken.m_end);
+                ss.append(input, previousToken.m_end, currentToken.m_start - previousToken.m_end);
 
             previousToken = currentToken;
             pasteNext = true;
@@ -813,19 +813,19 @@ void DefinesStreamProxy::ProcessTokenPastingOperators(
     }
 
     if (inputSize > previousToken.m_end)
-        ss << std::string(input, previousToken.m_end, inputSize - previousToken.m_end);
+        ss.append(input, previousToken.m_end, inputSize - previousToken.m_end);
 
     if (pasteNext)
         throw new ParsingException(CreatePos(line, linePos), "Cannot use token-pasting operator without following token");
 
-    input = ss.str();
+    input = std::move(ss);
 }
 
-void DefinesStreamProxy::InsertMacroParameters(std::ostringstream& out, const DefinesStreamProxy::Define* macro, std::vector<std::string>& parameterValues)
+void DefinesStreamProxy::InsertMacroParameters(std::string& out, const DefinesStreamProxy::Define* macro, std::vector<std::string>& parameterValues)
 {
     if (parameterValues.empty() || macro->m_parameter_positions.empty())
     {
-        out << macro->m_value;
+        out += macro->m_value;
         return;
     }
 
@@ -833,43 +833,46 @@ void DefinesStreamProxy::InsertMacroParameters(std::ostringstream& out, const De
     for (const auto& parameterPosition : macro->m_parameter_positions)
     {
         if (lastPos < parameterPosition.m_parameter_position)
-            out << std::string(macro->m_value, lastPos, parameterPosition.m_parameter_position - lastPos);
+            out.append(macro->m_value, lastPos, parameterPosition.m_parameter_position - lastPos);
 
         if (parameterPosition.m_parameter_index < parameterValues.size())
         {
             if (!parameterPosition.m_stringize)
             {
-                out << parameterValues[parameterPosition.m_parameter_index];
+                out += parameterValues[parameterPosition.m_parameter_index];
             }
             else
-                out << '"' << utils::EscapeStringForQuotationMarks(parameterValues[parameterPosition.m_parameter_index]) << '"';
+            {
+                out += '"';
+                out += utils::EscapeStringForQuotationMarks(parameterValues[parameterPosition.m_parameter_index]);
+                out += '"';
+            }
         }
 
         lastPos = parameterPosition.m_parameter_position;
     }
 
     if (lastPos < macro->m_value.size())
-        out << std::string(macro->m_value, lastPos, macro->m_value.size() - lastPos);
+        out.append(macro->m_value, lastPos, macro->m_value.size() - lastPos);
 }
 
 void DefinesStreamProxy::ExpandMacro(ParserLine& line,
                                      unsigned& linePos,
-                                     std::ostringstream& out,
+                                     std::string& out,
                                      std::vector<const Define*>& callstack,
                                      const DefinesStreamProxy::Define* macro,
                                      std::vector<std::string>& parameterValues)
 {
-    std::ostringstream rawOutput;
-    InsertMacroParameters(rawOutput, macro, parameterValues);
+    std::string str;
+    InsertMacroParameters(str, macro, parameterValues);
 
-    std::string str = rawOutput.str();
     unsigned nestedPos = 0;
     ProcessNestedMacros(line, linePos, callstack, str, nestedPos);
 
     if (macro->m_contains_token_pasting_operators)
         ProcessTokenPastingOperators(line, linePos, callstack, str, nestedPos);
 
-    out << str;
+    out += str;
 }
 
 void DefinesStreamProxy::ContinueMacroParameters(
@@ -885,13 +888,12 @@ void DefinesStreamProxy::ContinueMacroParameters(
             if (!state.m_bracket_depth.empty())
             {
                 state.m_parameter_state = ParameterState::AFTER_PARAM;
-                state.m_current_parameter << c;
+                state.m_current_parameter += c;
             }
             else
             {
-                state.m_parameters.emplace_back(state.m_current_parameter.str());
+                state.m_parameters.emplace_back(std::move(state.m_current_parameter));
                 state.m_current_parameter.clear();
-                state.m_current_parameter.str(std::string());
                 state.m_parameter_state = ParameterState::AFTER_COMMA;
             }
         }
@@ -899,7 +901,7 @@ void DefinesStreamProxy::ContinueMacroParameters(
         {
             state.m_parameter_state = ParameterState::AFTER_PARAM;
             state.m_bracket_depth.push(c);
-            state.m_current_parameter << c;
+            state.m_current_parameter += c;
         }
         else if (c == ')')
         {
@@ -910,7 +912,7 @@ void DefinesStreamProxy::ContinueMacroParameters(
 
                 state.m_bracket_depth.pop();
                 state.m_parameter_state = ParameterState::AFTER_PARAM;
-                state.m_current_parameter << c;
+                state.m_current_parameter += c;
             }
             else if (state.m_parameter_state == ParameterState::AFTER_COMMA)
             {
@@ -918,7 +920,8 @@ void DefinesStreamProxy::ContinueMacroParameters(
             }
             else
             {
-                state.m_parameters.emplace_back(state.m_current_parameter.str());
+                state.m_parameters.emplace_back(std::move(state.m_current_parameter));
+                state.m_current_parameter.clear();
                 state.m_parameter_state = ParameterState::NOT_IN_PARAMETERS;
             }
         }
@@ -933,12 +936,12 @@ void DefinesStreamProxy::ContinueMacroParameters(
             }
 
             state.m_parameter_state = ParameterState::AFTER_PARAM;
-            state.m_current_parameter << c;
+            state.m_current_parameter += c;
         }
         else if (state.m_parameter_state == ParameterState::AFTER_PARAM || !isspace(c))
         {
             state.m_parameter_state = ParameterState::AFTER_PARAM;
-            state.m_current_parameter << c;
+            state.m_current_parameter += c;
         }
 
         inputPos++;
@@ -952,14 +955,14 @@ void DefinesStreamProxy::ContinueMultiLineMacro(ParserLine& line)
 
     if (m_multi_line_macro_parameters.m_parameter_state == ParameterState::NOT_IN_PARAMETERS)
     {
-        std::ostringstream ss;
+        std::string ss;
         std::vector<const Define*> callstack;
         ExpandMacro(line, pos, ss, callstack, m_current_macro, m_multi_line_macro_parameters.m_parameters);
 
         if (pos < line.m_line.size())
-            ss << std::string(line.m_line, pos, line.m_line.size() - pos);
+            ss.append(line.m_line, pos, line.m_line.size() - pos);
 
-        line.m_line = ss.str();
+        line.m_line = std::move(ss);
 
         ProcessMacrosMultiLine(line);
     }
@@ -976,7 +979,7 @@ void DefinesStreamProxy::ProcessNestedMacros(ParserLine& line, unsigned& linePos
     auto pos = 0u;
     auto defineStart = 0u;
     auto lastDefineEnd = 0u;
-    std::ostringstream ss;
+    std::string ss;
 
     const Define* nestedMacro = nullptr;
     while (FindNextMacro(input, pos, defineStart, nestedMacro))
@@ -991,11 +994,11 @@ void DefinesStreamProxy::ProcessNestedMacros(ParserLine& line, unsigned& linePos
         if (!usesDefines)
         {
             usesDefines = true;
-            ss << std::string(input, 0, defineStart);
+            ss.append(input, 0, defineStart);
         }
         else
         {
-            ss << std::string(input, lastDefineEnd, defineStart - (lastDefineEnd));
+            ss.append(input, lastDefineEnd, defineStart - (lastDefineEnd));
         }
 
         callstack.push_back(nestedMacro);
@@ -1015,8 +1018,8 @@ void DefinesStreamProxy::ProcessNestedMacros(ParserLine& line, unsigned& linePos
     {
         // Make sure we account for all text between the last macro and the end
         if (lastDefineEnd < input.size())
-            ss << std::string(input, lastDefineEnd, input.size() - lastDefineEnd);
-        input = ss.str();
+            ss.append(input, lastDefineEnd, input.size() - lastDefineEnd);
+        input = std::move(ss);
     }
 }
 
@@ -1029,12 +1032,16 @@ void DefinesStreamProxy::ProcessMacrosSingleLine(ParserLine& line)
 
 void DefinesStreamProxy::ProcessMacrosMultiLine(ParserLine& line)
 {
+    // Without any defines there is nothing that could be expanded so the line is left as is
+    if (m_defines.empty())
+        return;
+
     bool usesDefines = false;
 
     auto pos = 0u;
     auto defineStart = 0u;
     auto lastDefineEnd = 0u;
-    std::ostringstream str;
+    std::string str;
     std::vector<const Define*> callstack;
     while (FindNextMacro(line.m_line, pos, defineStart, m_current_macro))
     {
@@ -1042,11 +1049,11 @@ void DefinesStreamProxy::ProcessMacrosMultiLine(ParserLine& line)
         if (!usesDefines)
         {
             usesDefines = true;
-            str << std::string(line.m_line, 0, defineStart);
+            str.append(line.m_line, 0, defineStart);
         }
         else
         {
-            str << std::string(line.m_line, lastDefineEnd, defineStart - (lastDefineEnd));
+            str.append(line.m_line, lastDefineEnd, defineStart - (lastDefineEnd));
         }
 
         callstack.push_back(m_current_macro);
@@ -1068,8 +1075,8 @@ void DefinesStreamProxy::ProcessMacrosMultiLine(ParserLine& line)
     {
         // Make sure we account for all text between the last macro and the end
         if (lastDefineEnd < line.m_line.size())
-            str << std::string(line.m_line, lastDefineEnd, line.m_line.size() - lastDefineEnd);
-        line.m_line = str.str();
+            str.append(line.m_line, lastDefineEnd, line.m_line.size() - lastDefineEnd);
+        line.m_line = std::move(str);
     }
 }
 
@@ -4,10 +4,12 @@
 #include "Parsing/IParserLineStream.h"
 #include "Parsing/Simple/Expression/ISimpleExpression.h"
 
-#include <map>
 #include <set>
 #include <sstream>
 #include <stack>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 class DefinesStreamProxy final : public AbstractDirectiveStreamProxy
@@ -64,7 +66,7 @@ public:
     {
     public:
         ParameterState m_parameter_state;
-        std::ostringstream m_current_parameter;
+        std::string m_current_parameter;
         std::vector<std::string> m_parameters;
         std::stack<char> m_bracket_depth;
 
@@ -80,9 +82,21 @@ private:
         BLOCK_BLOCKED
     };
 
+    // Allows looking up defines by parts of a line without copying them into a string first
+    class DefineNameHash
+    {
+    public:
+        using is_transparent = void;
+
+        size_t operator()(const std::string_view name) const
+        {
+            return std::hash<std::string_view>()(name);
+        }
+    };
+
     IParserLineStream* const m_stream;
     const bool m_skip_directive_lines;
-    std::map<std::string, Define> m_defines;
+    std::unordered_map<std::string, Define, DefineNameHash, std::equal_to<>> m_defines;
     std::stack<BlockMode> m_modes;
     unsigned m_ignore_depth;
 
@@ -117,10 +131,10 @@ private:
     bool FindNextMacro(const std::string& input, unsigned& inputPos, unsigned& defineStart, const DefinesStreamProxy::Define*& define);
 
     void ProcessTokenPastingOperators(ParserLine& line, unsigned& linePos, std::vector<const Define*>& callstack, std::string& input, unsigned& inputPos);
-    void InsertMacroParameters(std::ostringstream& out, const DefinesStreamProxy::Define* macro, std::vector<std::string>& parameterValues);
+    void InsertMacroParameters(std::string& out, const DefinesStreamProxy::Define* macro, std::vector<std::string>& parameterValues);
     void ExpandMacro(ParserLine& line,
                      unsigned& linePos,
-                     std::ostringstream& out,
+                     std::string& out,
                      std::vector<const Define*>& callstack,
                      const DefinesStreamProxy::Define* macro,
                      std::vector<std::string>& parameterValues);
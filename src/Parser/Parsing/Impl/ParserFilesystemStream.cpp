@@ -1,7 +1,6 @@
 #include "ParserFilesystemStream.h"
 
 #include <filesystem>
-#include <sstream>
 
 namespace fs = std::filesystem;
 
@@ -16,6 +15,9 @@ ParserFilesystemStream::ParserFilesystemStream(const std::string& path)
 {
     const auto absolutePath = absolute(fs::path(path));
     m_files.emplace(FileInfo(absolutePath.string()));
+
+    if (m_files.top().m_stream.is_open())
+        m_opened_files.emplace_back(*m_files.top().m_file_path);
 }
 
 bool ParserFilesystemStream::IsOpen() const
@@ -25,9 +27,6 @@ bool ParserFilesystemStream::IsOpen() const
 
 ParserLine ParserFilesystemStream::NextLine()
 {
-    std::ostringstream str;
-    auto hasLength = false;
-
     if (m_files.empty())
         return ParserLine();
 
@@ -35,33 +34,15 @@ ParserLine ParserFilesystemStream::NextLine()
     {
         auto& fileInfo = m_files.top();
 
-        auto c = fileInfo.m_stream.get();
-        while (c != EOF)
+        std::string line;
+        if (fileInfo.m_reader.ReadLine(fileInfo.m_stream, line))
         {
-            switch (c)
-            {
-            case '\r':
-                c = fileInfo.m_stream.get();
-                if (c == '\n')
-                    return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number++, str.str());
-                str << '\r';
-                hasLength = true;
-                continue;
-
-            case '\n':
-                return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number++, str.str());
-
-            default:
-                str << static_cast<char>(c);
-                hasLength = true;
-                break;
-            }
-
-            c = fileInfo.m_stream.get();
+            if (fileInfo.m_reader.Eof())
+                return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number, std::move(line));
+
+            return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number++, std::move(line));
         }
 
-        if (hasLength)
-            return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number, str.str());
         m_files.pop();
     }
 
@@ -82,6 +63,7 @@ bool ParserFilesystemStream::IncludeFile(const std::string& filename)
     if (!fileInfo.m_stream.is_open())
         return false;
 
+    m_opened_files.emplace_back(*fileInfo.m_file_path);
     m_files.emplace(std::move(fileInfo));
     return true;
 }
@@ -94,5 +76,10 @@ void ParserFilesystemStream::PopCurrentFile()
 
 bool ParserFilesystemStream::Eof() const
 {
-    return m_files.empty() || m_files.top().m_stream.eof();
+    return m_files.empty() || m_files.top().m_reader.Eof();
+}
+
+const std::vector<std::string>& ParserFilesystemStream::GetOpenedFiles() const
+{
+    return m_opened_files;
 }
@@ -1,9 +1,12 @@
 #pragma once
 
+#include "ParserLineReader.h"
 #include "Parsing/IParserLineStream.h"
 
 #include <fstream>
 #include <stack>
+#include <string>
+#include <vector>
 
 class ParserFilesystemStream final : public IParserLineStream
 {
@@ -12,12 +15,14 @@ class ParserFilesystemStream final : public IParserLineStream
     public:
         std::shared_ptr<std::string> m_file_path;
         std::ifstream m_stream;
+        ParserLineReader m_reader;
         int m_line_number;
 
         explicit FileInfo(std::string filePath);
     };
 
     std::stack<FileInfo> m_files;
+    std::vector<std::string> m_opened_files;
 
 public:
     explicit ParserFilesystemStream(const std::string& path);
@@ -27,4 +32,9 @@ public:
     void PopCurrentFile() override;
     _NODISCARD bool IsOpen() const override;
     _NODISCARD bool Eof() const override;
+
+    /**
+     * \brief Returns the absolute paths of all files that were opened by this stream, including the base file and all included files.
+     */
+    _NODISCARD const std::vector<std::string>& GetOpenedFiles() const;
 };
@@ -0,0 +1,27 @@
+#include "ParserLineCache.h"
+
+#include "ParserSingleInputStream.h"
+
+std::shared_ptr<const ParserLineCache::lines_t> ParserLineCache::Find(const std::string& fileName) const
+{
+    std::lock_guard lock(m_mutex);
+    const auto foundFile = m_lines_by_file_name.find(fileName);
+    if (foundFile == m_lines_by_file_name.end())
+        return nullptr;
+
+    return foundFile->second;
+}
+
+std::shared_ptr<const ParserLineCache::lines_t> ParserLineCache::Add(const std::string& fileName, std::istream& stream)
+{
+    // Splitting the lines with a regular input stream makes cached files behave exactly like files that are read directly
+    auto lines = std::make_shared<lines_t>();
+    ParserSingleInputStream lineStream(stream, fileName);
+    for (auto line = lineStream.NextLine(); !line.IsEof(); line = lineStream.NextLine())
+        lines->emplace_back(std::move(line.m_line));
+
+    std::lock_guard lock(m_mutex);
+    const auto cachedLines = m_lines_by_file_name.try_emplace(fileName, std::move(lines)).first;
+
+    return cachedLines->second;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Utils/ClassUtils.h"
+
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \brief Keeps the lines of included files to not need to open, read and split them again every time they are included.
+ * Files are identified by the name they are included with, so a cache must only be shared by streams that resolve an include name to the same file.
+ * The cache can be shared by streams on different threads.
+ */
+class ParserLineCache
+{
+public:
+    using lines_t = std::vector<std::string>;
+
+    /**
+     * \brief Searches the cache for the lines of a file.
+     * \param fileName The name the file is included with.
+     * \return The lines of the file or \c nullptr if the file is not cached.
+     */
+    _NODISCARD std::shared_ptr<const lines_t> Find(const std::string& fileName) const;
+
+    /**
+     * \brief Reads all lines of a file and adds them to the cache.
+     * \param fileName The name the file is included with.
+     * \param stream The stream to read the file from.
+     * \return The lines of the file. If the file was added concurrently, the lines that were added first.
+     */
+    std::shared_ptr<const lines_t> Add(const std::string& fileName, std::istream& stream);
+
+private:
+    std::unordered_map<std::string, std::shared_ptr<const lines_t>> m_lines_by_file_name;
+    mutable std::mutex m_mutex;
+};
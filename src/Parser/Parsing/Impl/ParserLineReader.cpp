@@ -0,0 +1,65 @@
+#include "ParserLineReader.h"
+
+#include <cstring>
+
+ParserLineReader::ParserLineReader()
+    : m_buffer_pos(0u),
+      m_buffer_size(0u),
+      m_eof(false)
+{
+}
+
+bool ParserLineReader::FillBuffer(std::istream& stream)
+{
+    if (!m_buffer)
+        m_buffer = std::make_unique_for_overwrite<char[]>(CHUNK_SIZE);
+
+    stream.read(m_buffer.get(), CHUNK_SIZE);
+    m_buffer_pos = 0u;
+    m_buffer_size = static_cast<size_t>(stream.gcount());
+
+    return m_buffer_size > 0u;
+}
+
+bool ParserLineReader::ReadLine(std::istream& stream, std::string& line)
+{
+    line.clear();
+
+    auto hasLength = false;
+    while (true)
+    {
+        if (m_buffer_pos >= m_buffer_size && !FillBuffer(stream))
+        {
+            m_eof = true;
+            return hasLength;
+        }
+
+        const auto* chunkStart = &m_buffer[m_buffer_pos];
+        const auto chunkSize = m_buffer_size - m_buffer_pos;
+        const auto* lineEnd = static_cast<const char*>(std::memchr(chunkStart, '\n', chunkSize));
+        if (lineEnd == nullptr)
+        {
+            // The line continues in the next chunk
+            line.append(chunkStart, chunkSize);
+            m_buffer_pos = m_buffer_size;
+            hasLength = true;
+            continue;
+        }
+
+        const auto lineLength = static_cast<size_t>(lineEnd - chunkStart);
+        line.append(chunkStart, lineLength);
+        m_buffer_pos += lineLength + 1u;
+
+        // A carriage return is only part of the line ending when it is followed by a line feed.
+        // It is checked after appending since it might have been at the end of the previous chunk.
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+
+        return true;
+    }
+}
+
+bool ParserLineReader::Eof() const
+{
+    return m_eof;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Utils/ClassUtils.h"
+
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <string>
+
+/**
+ * \brief Splits the contents of a stream into lines. The stream is read in large chunks instead of character by character.
+ * Lines may end with either \c \\n or \c \\r\\n which is not part of the line.
+ */
+class ParserLineReader
+{
+public:
+    static constexpr size_t CHUNK_SIZE = 0x10000;
+
+    ParserLineReader();
+
+    /**
+     * \brief Reads the next line of a stream.
+     * \param stream The stream to read from. It must be the same stream for every call.
+     * \param line The string to write the line to.
+     * \return \c true if a line was read, \c false if the stream has no more lines.
+     */
+    bool ReadLine(std::istream& stream, std::string& line);
+
+    /**
+     * \return \c true if the end of the stream was reached while reading a line.
+     */
+    _NODISCARD bool Eof() const;
+
+private:
+    bool FillBuffer(std::istream& stream);
+
+    std::unique_ptr<char[]> m_buffer;
+    size_t m_buffer_pos;
+    size_t m_buffer_size;
+    bool m_eof;
+};
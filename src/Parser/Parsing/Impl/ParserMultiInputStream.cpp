@@ -1,39 +1,47 @@
 #include "ParserMultiInputStream.h"
 
-#include <sstream>
-
 ParserMultiInputStream::FileInfo::FileInfo(std::unique_ptr<std::istream> stream, std::string filePath)
     : m_owned_stream(std::move(stream)),
-      m_stream(*m_owned_stream),
+      m_stream(m_owned_stream.get()),
       m_file_path(std::make_shared<std::string>(std::move(filePath))),
       m_line_number(1)
 {
 }
 
 ParserMultiInputStream::FileInfo::FileInfo(std::istream& stream, std::string filePath)
-    : m_stream(stream),
+    : m_stream(&stream),
+      m_file_path(std::make_shared<std::string>(std::move(filePath))),
+      m_line_number(1)
+{
+}
+
+ParserMultiInputStream::FileInfo::FileInfo(std::shared_ptr<const ParserLineCache::lines_t> cachedLines, std::string filePath)
+    : m_stream(nullptr),
+      m_cached_lines(std::move(cachedLines)),
       m_file_path(std::make_shared<std::string>(std::move(filePath))),
       m_line_number(1)
 {
 }
 
-ParserMultiInputStream::ParserMultiInputStream(std::unique_ptr<std::istream> stream, std::string fileName, include_callback_t includeCallback)
-    : m_include_callback(std::move(includeCallback))
+ParserMultiInputStream::ParserMultiInputStream(std::unique_ptr<std::istream> stream,
+                                               std::string fileName,
+                                               include_callback_t includeCallback,
+                                               ParserLineCache* includeCache)
+    : m_include_callback(std::move(includeCallback)),
+      m_include_cache(includeCache)
 {
     m_files.emplace(std::move(stream), std::move(fileName));
 }
 
-ParserMultiInputStream::ParserMultiInputStream(std::istream& stream, std::string fileName, include_callback_t includeCallback)
-    : m_include_callback(std::move(includeCallback))
+ParserMultiInputStream::ParserMultiInputStream(std::istream& stream, std::string fileName, include_callback_t includeCallback, ParserLineCache* includeCache)
+    : m_include_callback(std::move(includeCallback)),
+      m_include_cache(includeCache)
 {
     m_files.emplace(stream, std::move(fileName));
 }
 
 ParserLine ParserMultiInputStream::NextLine()
 {
-    std::ostringstream str;
-    auto hasLength = false;
-
     if (m_files.empty())
         return ParserLine();
 
@@ -41,33 +49,25 @@ ParserLine ParserMultiInputStream::NextLine()
     {
         auto& fileInfo = m_files.top();
 
-        auto c = fileInfo.m_stream.get();
-        while (c != EOF)
+        if (fileInfo.m_cached_lines)
         {
-            switch (c)
-            {
-            case '\r':
-                c = fileInfo.m_stream.get();
-                if (c == '\n')
-                    return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number++, str.str());
-                str << '\r';
-                hasLength = true;
-                continue;
-
-            case '\n':
-                return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number++, str.str());
-
-            default:
-                str << static_cast<char>(c);
-                hasLength = true;
-                break;
-            }
-
-            c = fileInfo.m_stream.get();
+            const auto lineIndex = static_cast<size_t>(fileInfo.m_line_number - 1);
+            if (lineIndex < fileInfo.m_cached_lines->size())
+                return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number++, (*fileInfo.m_cached_lines)[lineIndex]);
+
+            m_files.pop();
+            continue;
+        }
+
+        std::string line;
+        if (fileInfo.m_reader.ReadLine(*fileInfo.m_stream, line))
+        {
+            if (fileInfo.m_reader.Eof())
+                return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number, std::move(line));
+
+            return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number++, std::move(line));
         }
 
-        if (hasLength)
-            return ParserLine(fileInfo.m_file_path, fileInfo.m_line_number, str.str());
         m_files.pop();
     }
 
@@ -79,6 +79,22 @@ bool ParserMultiInputStream::IncludeFile(const std::string& filename)
     if (!m_include_callback)
         return false;
 
+    if (m_include_cache)
+    {
+        auto cachedLines = m_include_cache->Find(filename);
+        if (!cachedLines)
+        {
+            const auto newFile = m_include_callback(filename, m_files.empty() ? "" : *m_files.top().m_file_path);
+            if (!newFile)
+                return false;
+
+            cachedLines = m_include_cache->Add(filename, *newFile);
+        }
+
+        m_files.emplace(std::move(cachedLines), filename);
+        return true;
+    }
+
     auto newFile = m_include_callback(filename, m_files.empty() ? "" : *m_files.top().m_file_path);
     if (!newFile)
         return false;
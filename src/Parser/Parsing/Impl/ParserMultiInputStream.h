@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ParserLineCache.h"
+#include "ParserLineReader.h"
 #include "Parsing/IParserLineStream.h"
 
 #include <functional>
@@ -17,20 +19,30 @@ private:
     {
     public:
         std::unique_ptr<std::istream> m_owned_stream;
-        std::istream& m_stream;
+        std::istream* m_stream;
+        ParserLineReader m_reader;
+        std::shared_ptr<const ParserLineCache::lines_t> m_cached_lines;
         std::shared_ptr<std::string> m_file_path;
         int m_line_number;
 
         FileInfo(std::unique_ptr<std::istream> stream, std::string filePath);
         FileInfo(std::istream& stream, std::string filePath);
+        FileInfo(std::shared_ptr<const ParserLineCache::lines_t> cachedLines, std::string filePath);
     };
 
     const include_callback_t m_include_callback;
+    ParserLineCache* const m_include_cache;
     std::stack<FileInfo> m_files;
 
 public:
-    ParserMultiInputStream(std::unique_ptr<std::istream> stream, std::string fileName, include_callback_t includeCallback);
-    ParserMultiInputStream(std::istream& stream, std::string fileName, include_callback_t includeCallback);
+    /**
+     * \param includeCache An optional cache for the lines of included files. The include callback is only invoked for files that are not cached yet.
+     */
+    ParserMultiInputStream(std::unique_ptr<std::istream> stream,
+                           std::string fileName,
+                           include_callback_t includeCallback,
+                           ParserLineCache* includeCache = nullptr);
+    ParserMultiInputStream(std::istream& stream, std::string fileName, include_callback_t includeCallback, ParserLineCache* includeCache = nullptr);
 
     ParserLine NextLine() override;
     bool IncludeFile(const std::string& filename) override;
@@ -1,7 +1,5 @@
 #include "ParserSingleInputStream.h"
 
-#include <sstream>
-
 ParserSingleInputStream::ParserSingleInputStream(std::istream& stream, std::string fileName)
     : m_stream(stream),
       m_file_name(std::make_shared<std::string>(std::move(fileName))),
@@ -11,36 +9,14 @@ ParserSingleInputStream::ParserSingleInputStream(std::istream& stream, std::stri
 
 ParserLine ParserSingleInputStream::NextLine()
 {
-    std::ostringstream str;
-    auto hasLength = false;
-
-    auto c = m_stream.get();
-    while (c != EOF)
+    std::string line;
+    if (m_reader.ReadLine(m_stream, line))
     {
-        switch (c)
-        {
-        case '\r':
-            c = m_stream.get();
-            if (c == '\n')
-                return ParserLine(m_file_name, m_line_number++, str.str());
-            str << '\r';
-            hasLength = true;
-            continue;
-
-        case '\n':
-            return ParserLine(m_file_name, m_line_number++, str.str());
-
-        default:
-            str << static_cast<char>(c);
-            hasLength = true;
-            break;
-        }
-
-        c = m_stream.get();
-    }
+        if (m_reader.Eof())
+            return ParserLine(m_file_name, m_line_number, std::move(line));
 
-    if (hasLength)
-        return ParserLine(m_file_name, m_line_number, str.str());
+        return ParserLine(m_file_name, m_line_number++, std::move(line));
+    }
 
     return ParserLine();
 }
@@ -54,10 +30,10 @@ void ParserSingleInputStream::PopCurrentFile() {}
 
 bool ParserSingleInputStream::IsOpen() const
 {
-    return !m_stream.eof();
+    return !m_reader.Eof();
 }
 
 bool ParserSingleInputStream::Eof() const
 {
-    return m_stream.eof();
+    return m_reader.Eof();
 }
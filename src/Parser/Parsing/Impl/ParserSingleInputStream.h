@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ParserLineReader.h"
 #include "Parsing/IParserLineStream.h"
 
 #include <istream>
@@ -8,6 +9,7 @@
 class ParserSingleInputStream final : public IParserLineStream
 {
     std::istream& m_stream;
+    ParserLineReader m_reader;
     std::shared_ptr<std::string> m_file_name;
     int m_line_number;
 
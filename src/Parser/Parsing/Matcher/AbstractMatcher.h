@@ -5,6 +5,7 @@
 #include "Parsing/Matcher/MatcherResult.h"
 
 #include <functional>
+#include <vector>
 
 template<typename TokenType> class AbstractMatcher
 {
@@ -59,6 +60,16 @@ public:
         m_transform_func = std::move(transform);
     }
 
+    /**
+     * \brief Collects the keys of all tokens this matcher is able to start with. Keys are computed by the token type.
+     * \param keys The collection to add the keys to.
+     * \return \c true if this matcher can only start with tokens with one of the collected keys, \c false if the first token cannot be narrowed down.
+     */
+    _NODISCARD virtual bool GetFirstTokenKeys(std::vector<size_t>& keys) const
+    {
+        return false;
+    }
+
     MatcherResult<TokenType> Match(ILexer<TokenType>* lexer, const unsigned tokenOffset)
     {
         MatcherResult<TokenType> result = CanMatch(lexer, tokenOffset);
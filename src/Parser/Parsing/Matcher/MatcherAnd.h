@@ -32,6 +32,12 @@ protected:
     }
 
 public:
+    _NODISCARD bool GetFirstTokenKeys(std::vector<size_t>& keys) const override
+    {
+        // Every matcher has to match so the first one alone decides the first token
+        return !m_matchers.empty() && m_matchers.front()->GetFirstTokenKeys(keys);
+    }
+
     MatcherAnd(std::initializer_list<Movable<std::unique_ptr<AbstractMatcher<TokenType>>>> matchers)
         : m_matchers(std::make_move_iterator(matchers.begin()), std::make_move_iterator(matchers.end()))
     {
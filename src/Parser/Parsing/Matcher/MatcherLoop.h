@@ -36,6 +36,12 @@ protected:
     }
 
 public:
+    _NODISCARD bool GetFirstTokenKeys(std::vector<size_t>& keys) const override
+    {
+        // The loop needs to match at least once
+        return m_matcher->GetFirstTokenKeys(keys);
+    }
+
     explicit MatcherLoop(std::unique_ptr<AbstractMatcher<TokenType>> matcher)
         : m_matcher(std::move(matcher))
     {
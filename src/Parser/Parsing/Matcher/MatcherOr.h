@@ -30,6 +30,17 @@ protected:
     }
 
 public:
+    _NODISCARD bool GetFirstTokenKeys(std::vector<size_t>& keys) const override
+    {
+        for (const std::unique_ptr<AbstractMatcher<TokenType>>& matcher : m_matchers)
+        {
+            if (!matcher->GetFirstTokenKeys(keys))
+                return false;
+        }
+
+        return !m_matchers.empty();
+    }
+
     MatcherOr(std::initializer_list<Movable<std::unique_ptr<AbstractMatcher<TokenType>>>> matchers)
         : m_matchers(std::make_move_iterator(matchers.begin()), std::make_move_iterator(matchers.end()))
     {
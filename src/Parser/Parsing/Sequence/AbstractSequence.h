@@ -72,6 +72,16 @@ public:
         return nullptr;
     }
 
+    /**
+     * \brief Collects the keys of all tokens this sequence is able to start with.
+     * \param keys The collection to add the keys to.
+     * \return \c true if this sequence can only start with tokens with one of the collected keys, \c false if the first token cannot be narrowed down.
+     */
+    _NODISCARD bool GetFirstTokenKeys(std::vector<size_t>& keys) const
+    {
+        return m_entry && m_entry->GetFirstTokenKeys(keys);
+    }
+
     _NODISCARD bool MatchSequence(ILexer<TokenType>* lexer, ParserState* state, unsigned& consumedTokenCount) const
     {
         if (!m_entry)
@@ -11,3 +11,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherCharacter::CanMatch(ILexer<SimpleP
     return token.m_type == SimpleParserValueType::CHARACTER && token.CharacterValue() == m_char ? MatcherResult<SimpleParserValue>::Match(1)
                                                                                                 : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherCharacter::GetFirstTokenKeys(std::vector<size_t>& keys) const
+{
+    keys.emplace_back(SimpleParserValue::CharacterKey(m_char));
+    return true;
+}
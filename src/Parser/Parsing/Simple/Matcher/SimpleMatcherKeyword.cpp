@@ -14,3 +14,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherKeyword::CanMatch(ILexer<SimplePar
                ? MatcherResult<SimpleParserValue>::Match(1)
                : MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherKeyword::GetFirstTokenKeys(std::vector<size_t>& keys) const
+{
+    keys.emplace_back(SimpleParserValue::IdentifierKey(m_value));
+    return true;
+}
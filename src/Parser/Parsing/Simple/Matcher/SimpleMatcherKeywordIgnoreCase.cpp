@@ -29,3 +29,9 @@ MatcherResult<SimpleParserValue> SimpleMatcherKeywordIgnoreCase::CanMatch(ILexer
 
     return MatcherResult<SimpleParserValue>::NoMatch();
 }
+
+bool SimpleMatcherKeywordIgnoreCase::GetFirstTokenKeys(std::vector<size_t>& keys) const
+{
+    keys.emplace_back(SimpleParserValue::IdentifierKey(m_value));
+    return true;
+}
@@ -13,5 +13,7 @@ protected:
     MatcherResult<SimpleParserValue> CanMatch(ILexer<SimpleParserValue>* lexer, unsigned tokenOffset) override;
 
 public:
+    _NODISCARD bool GetFirstTokenKeys(std::vector<size_t>& keys) const override;
+
     explicit SimpleMatcherKeywordIgnoreCase(std::string value);
 };
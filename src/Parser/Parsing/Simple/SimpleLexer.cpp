@@ -149,9 +149,18 @@ SimpleParserValue SimpleLexer::GetNextToken()
 
     if (isalpha(c) || c == '_')
     {
-        auto identifier = ReadIdentifier();
+        const auto identifier = ReadIdentifierView();
 
-        return SimpleParserValue::Identifier(pos, new std::string(std::move(identifier)));
+        auto pooledIdentifier = m_identifier_pool.find(identifier);
+        if (pooledIdentifier == m_identifier_pool.end())
+        {
+            auto value = std::make_unique<std::string>(identifier);
+            const auto hash = std::hash<std::string>()(*value);
+            const std::string_view key(*value);
+            pooledIdentifier = m_identifier_pool.emplace(key, PooledIdentifier{std::move(value), hash}).first;
+        }
+
+        return SimpleParserValue::PooledIdentifier(pos, pooledIdentifier->second.m_value.get(), pooledIdentifier->second.m_hash);
     }
 
     return SimpleParserValue::Character(pos, static_cast<char>(c));
@@ -6,6 +6,9 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 
 class SimpleLexer : public AbstractLexer<SimpleParserValue>
 {
@@ -47,6 +50,16 @@ protected:
 
     std::unique_ptr<MultiCharacterTokenLookupEntry> m_multi_character_token_lookup[std::numeric_limits<uint8_t>::max() + 1];
 
+    class PooledIdentifier
+    {
+    public:
+        std::unique_ptr<std::string> m_value;
+        size_t m_hash;
+    };
+
+    // Identifiers repeat a lot, so every distinct identifier is only allocated once per lexer and shared by all its tokens
+    std::unordered_map<std::string_view, PooledIdentifier> m_identifier_pool;
+
     void AddMultiCharacterTokenConfigToLookup(Config::MultiCharacterToken tokenConfig);
     bool ReadMultiCharacterToken(const MultiCharacterTokenLookupEntry* multiTokenLookup);
 
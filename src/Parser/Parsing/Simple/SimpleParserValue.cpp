@@ -1,6 +1,8 @@
 #include "SimpleParserValue.h"
 
 #include <cassert>
+#include <cctype>
+#include <cstdint>
 
 SimpleParserValue SimpleParserValue::Invalid(const TokenPos pos)
 {
@@ -79,11 +81,21 @@ SimpleParserValue SimpleParserValue::Identifier(const TokenPos pos, std::string*
     return pv;
 }
 
+SimpleParserValue SimpleParserValue::PooledIdentifier(const TokenPos pos, std::string* identifier, const size_t hash)
+{
+    SimpleParserValue pv(pos, SimpleParserValueType::IDENTIFIER);
+    pv.m_value.string_value = identifier;
+    pv.m_hash = hash;
+    pv.m_owns_string = false;
+    return pv;
+}
+
 SimpleParserValue::SimpleParserValue(const TokenPos pos, const SimpleParserValueType type)
     : m_pos(pos),
       m_type(type),
       m_hash(0),
       m_has_sign_prefix(false),
+      m_owns_string(true),
       m_value{}
 {
 }
@@ -94,7 +106,8 @@ SimpleParserValue::~SimpleParserValue()
     {
     case SimpleParserValueType::STRING:
     case SimpleParserValueType::IDENTIFIER:
-        delete m_value.string_value;
+        if (m_owns_string)
+            delete m_value.string_value;
         break;
 
     default:
@@ -109,6 +122,7 @@ SimpleParserValue::SimpleParserValue(SimpleParserValue&& other) noexcept
       m_type(other.m_type),
       m_hash(other.m_hash),
       m_has_sign_prefix(other.m_has_sign_prefix),
+      m_owns_string(other.m_owns_string),
       m_value(other.m_value)
 {
     other.m_value = ValueType();
@@ -121,6 +135,7 @@ SimpleParserValue& SimpleParserValue::operator=(SimpleParserValue&& other) noexc
     m_value = other.m_value;
     m_hash = other.m_hash;
     m_has_sign_prefix = other.m_has_sign_prefix;
+    m_owns_string = other.m_owns_string;
     other.m_value = ValueType();
 
     return *this;
@@ -177,3 +192,38 @@ size_t SimpleParserValue::IdentifierHash() const
     assert(m_type == SimpleParserValueType::IDENTIFIER);
     return m_hash;
 }
+
+bool SimpleParserValue::GetFirstTokenKey(size_t& key) const
+{
+    switch (m_type)
+    {
+    case SimpleParserValueType::IDENTIFIER:
+        key = IdentifierKey(*m_value.string_value);
+        return true;
+
+    case SimpleParserValueType::CHARACTER:
+        key = CharacterKey(m_value.char_value);
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+size_t SimpleParserValue::IdentifierKey(const std::string& identifier)
+{
+    // FNV-1a over the lowercase characters to not need to allocate a lowercase copy
+    uint64_t key = 0xCBF29CE484222325u;
+    for (const auto c : identifier)
+    {
+        key ^= static_cast<uint64_t>(tolower(static_cast<unsigned char>(c)));
+        key *= 0x100000001B3u;
+    }
+
+    return static_cast<size_t>(key);
+}
+
+size_t SimpleParserValue::CharacterKey(const char c)
+{
+    return static_cast<unsigned char>(c);
+}
@@ -34,6 +34,7 @@ public:
     SimpleParserValueType m_type;
     size_t m_hash;
     bool m_has_sign_prefix;
+    bool m_owns_string;
 
     union ValueType
     {
@@ -56,6 +57,14 @@ public:
     static SimpleParserValue String(TokenPos pos, std::string* stringValue);
     static SimpleParserValue Identifier(TokenPos pos, std::string* identifier);
 
+    /**
+     * \brief Creates an identifier that does not take ownership of its value to be able to share it with all other identifiers of the same value.
+     * \param pos The position of the identifier.
+     * \param identifier The value of the identifier. It must outlive the created value.
+     * \param hash The hash of the identifier.
+     */
+    static SimpleParserValue PooledIdentifier(TokenPos pos, std::string* identifier, size_t hash);
+
 private:
     SimpleParserValue(TokenPos pos, SimpleParserValueType type);
 
@@ -76,4 +85,17 @@ public:
     _NODISCARD std::string& StringValue() const;
     _NODISCARD std::string& IdentifierValue() const;
     _NODISCARD size_t IdentifierHash() const;
+
+    /**
+     * \brief Computes the key of a token that parsers use to only try sequences that are able to start with it.
+     * \param key The key of the token if it has one.
+     * \return \c true if the token has a key, \c false if it does not.
+     */
+    _NODISCARD bool GetFirstTokenKey(size_t& key) const;
+
+    /**
+     * \brief Computes the first token key of an identifier. Case is ignored for case-insensitive keywords to be able to share the key.
+     */
+    _NODISCARD static size_t IdentifierKey(const std::string& identifier);
+    _NODISCARD static size_t CharacterKey(char c);
 };
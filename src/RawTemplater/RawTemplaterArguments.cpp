@@ -4,6 +4,7 @@
 #include "Utils/Arguments/CommandLineOption.h"
 #include "Utils/Arguments/UsageInformation.h"
 
+#include <cstdlib>
 #include <iostream>
 #include <type_traits>
 
@@ -37,6 +38,13 @@ const CommandLineOption* const OPTION_DEFINE = CommandLineOption::Builder::Creat
                                                    .Reusable()
                                                    .Build();
 
+const CommandLineOption* const OPTION_JOBS = CommandLineOption::Builder::Create()
+                                                 .WithShortName("j")
+                                                 .WithLongName("jobs")
+                                                 .WithDescription("Specifies the amount of variations of a template that are templated at the same time. Defaults to 1.")
+                                                 .WithParameter("jobCount")
+                                                 .Build();
+
 const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_HELP,
     OPTION_VERSION,
@@ -44,11 +52,13 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_OUTPUT_FOLDER,
     OPTION_BUILD_LOG,
     OPTION_DEFINE,
+    OPTION_JOBS,
 };
 
 RawTemplaterArguments::RawTemplaterArguments()
     : m_argument_parser(COMMAND_LINE_OPTIONS, std::extent_v<decltype(COMMAND_LINE_OPTIONS)>),
-      m_verbose(false)
+      m_verbose(false),
+      m_job_count(1u)
 {
 }
 
@@ -128,5 +138,21 @@ bool RawTemplaterArguments::ParseArgs(const int argc, const char** argv, bool& s
         }
     }
 
+    // -j; --jobs
+    if (m_argument_parser.IsOptionSpecified(OPTION_JOBS))
+    {
+        const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_JOBS);
+
+        char* endPtr;
+        const auto parsedValue = strtoul(specifiedValue.c_str(), &endPtr, 10);
+        if (specifiedValue.empty() || *endPtr != '\0' || parsedValue == 0u)
+        {
+            std::cerr << "Illegal value: \"" << specifiedValue << "\" is not a valid job count. Use -? to see usage information.\n";
+            return false;
+        }
+
+        m_job_count = static_cast<unsigned>(parsedValue);
+    }
+
     return true;
 }
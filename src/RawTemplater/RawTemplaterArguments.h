@@ -26,6 +26,8 @@ public:
 
     std::vector<std::pair<std::string, std::string>> m_defines;
 
+    unsigned m_job_count;
+
     RawTemplaterArguments();
 
     bool ParseArgs(int argc, const char** argv, bool& shouldContinue);
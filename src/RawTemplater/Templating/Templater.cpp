@@ -8,11 +8,18 @@
 #include "SetDefineStreamProxy.h"
 #include "TemplatingStreamProxy.h"
 #include "Utils/ClassUtils.h"
+#include "Utils/ThreadPool.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <mutex>
+#include <sstream>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 using namespace templating;
@@ -75,6 +82,7 @@ namespace templating
         virtual void Apply(DefinesStreamProxy* definesProxy) = 0;
         _NODISCARD virtual bool IsFinished() const = 0;
         _NODISCARD virtual TemplatingVariationType GetVariationType() const = 0;
+        _NODISCARD virtual std::unique_ptr<ITemplatingVariation> Clone() const = 0;
     };
 
     class SwitchVariation final : public ITemplatingVariation
@@ -116,6 +124,11 @@ namespace templating
             return TemplatingVariationType::SWITCH;
         }
 
+        _NODISCARD std::unique_ptr<ITemplatingVariation> Clone() const override
+        {
+            return std::make_unique<SwitchVariation>(*this);
+        }
+
         std::string m_name;
         bool m_should_define;
         bool m_finished;
@@ -157,114 +170,258 @@ namespace templating
             return TemplatingVariationType::OPTIONS;
         }
 
+        _NODISCARD std::unique_ptr<ITemplatingVariation> Clone() const override
+        {
+            return std::make_unique<OptionsVariation>(*this);
+        }
+
         std::string m_name;
         std::vector<std::string> m_values;
         size_t m_value_offset;
     };
 
-    class TemplaterControlImpl final : ITemplaterControl
+    using variations_t = std::vector<std::unique_ptr<ITemplatingVariation>>;
+
+    variations_t CloneVariations(const variations_t& variations)
+    {
+        variations_t result;
+        result.reserve(variations.size());
+        for (const auto& variation : variations)
+            result.emplace_back(variation->Clone());
+
+        return result;
+    }
+
+    /**
+     * \brief Advances the variations to the next permutation, dropping variations that went through all of their values.
+     */
+    void AdvanceVariations(variations_t& variations)
+    {
+        while (!variations.empty())
+        {
+            const auto& lastVariation = variations[variations.size() - 1];
+            lastVariation->Advance();
+
+            if (lastVariation->IsFinished())
+                variations.pop_back();
+            else
+                break;
+        }
+    }
+
+    /**
+     * \brief Writes a file only if its content differs from the file that already exists, so its modification time stays the same otherwise.
+     * \return \c true if the file has the content afterwards, \c false if it could not be written.
+     */
+    bool WriteFileIfChanged(const std::string& filePath, const std::string& content)
+    {
+        // Comparing the sizes first avoids reading the existing file in most cases where it changed
+        std::error_code ec;
+        const auto existingSize = fs::file_size(filePath, ec);
+        if (!ec && existingSize == content.size())
+        {
+            std::ifstream existingStream(filePath, std::ios::in | std::ios::binary);
+            if (existingStream.is_open())
+            {
+                std::string existingContent(content.size(), '\0');
+                existingStream.read(existingContent.data(), static_cast<std::streamsize>(existingContent.size()));
+                if (existingStream.gcount() == static_cast<std::streamsize>(existingContent.size()) && existingContent == content)
+                    return true;
+            }
+        }
+
+        std::ofstream outputStream(filePath, std::ios::out | std::ios::binary);
+        if (!outputStream.is_open())
+            return false;
+
+        outputStream.write(content.data(), static_cast<std::streamsize>(content.size()));
+        return outputStream.good();
+    }
+
+    /**
+     * \brief Writes the output files of passes on the worker pool if there is one. Files are independent of each other, only writing the same file twice
+     * has to wait for the first write to finish.
+     */
+    class TemplaterOutputWriter
+    {
+    public:
+        explicit TemplaterOutputWriter(ThreadPool* workerPool)
+            : m_worker_pool(workerPool),
+              m_failed(false)
+        {
+        }
+
+        // Scheduled writes reference the writer, so they have to finish before it is gone even if templating was aborted by an exception
+        ~TemplaterOutputWriter()
+        {
+            if (m_worker_pool)
+                m_worker_pool->WaitForIdle();
+        }
+
+        TemplaterOutputWriter(const TemplaterOutputWriter& other) = delete;
+        TemplaterOutputWriter(TemplaterOutputWriter&& other) noexcept = delete;
+        TemplaterOutputWriter& operator=(const TemplaterOutputWriter& other) = delete;
+        TemplaterOutputWriter& operator=(TemplaterOutputWriter&& other) noexcept = delete;
+
+        void WriteFile(std::string filePath, std::string content)
+        {
+            if (!m_worker_pool)
+            {
+                WriteFileAndReportErrors(filePath, content);
+                return;
+            }
+
+            if (m_pending_files.contains(filePath))
+                WaitForWrittenFiles();
+            m_pending_files.emplace(filePath);
+
+            m_worker_pool->Enqueue(
+                [this, filePath = std::move(filePath), content = std::move(content)]
+                {
+                    WriteFileAndReportErrors(filePath, content);
+                });
+        }
+
+        /**
+         * \brief Waits for all scheduled files to be written.
+         * \return \c true if all files were written, \c false otherwise.
+         */
+        bool WaitForWrittenFiles()
+        {
+            if (m_worker_pool)
+                m_worker_pool->WaitForIdle();
+
+            m_pending_files.clear();
+            return !m_failed;
+        }
+
+    private:
+        void WriteFileAndReportErrors(const std::string& filePath, const std::string& content)
+        {
+            if (WriteFileIfChanged(filePath, content))
+                return;
+
+            std::lock_guard lock(m_mutex);
+            std::cerr << "Failed to write output file \"" << filePath << "\"\n";
+            m_failed = true;
+        }
+
+        ThreadPool* m_worker_pool;
+        std::unordered_set<std::string> m_pending_files;
+        std::mutex m_mutex;
+        std::atomic_bool m_failed;
+    };
+
+    /**
+     * \brief Templates the source once for one permutation of variations.
+     * A pass only collects its output so that passes can run at the same time. Writing the output is scheduled by \c CommitPass in the order of the passes.
+     */
+    class TemplaterPass final : ITemplaterControl
     {
     public:
-        TemplaterControlImpl(std::istream& stream, std::string filename, const std::string& outputDirectory)
-            : m_stream(stream),
+        TemplaterPass(const std::string& source, std::string filename, const std::string& outputDirectory, variations_t variations)
+            : m_active_variations(std::move(variations)),
+              m_source(source),
               m_filename(std::move(filename)),
               m_output_directory(outputDirectory),
+              m_discovered_variations(false),
               m_first_line(true),
               m_skip_pass(false),
-              m_write_output_to_file(false)
+              m_has_output_file_name(false)
         {
             const fs::path filenamePath(m_filename);
-            m_default_output_file = (m_output_directory / filenamePath.filename().replace_extension()).string();
+            m_output_file = (m_output_directory / filenamePath.filename().replace_extension()).string();
+
+            for (const auto& variation : m_active_variations)
+                m_active_variations_by_name.emplace(variation->GetName(), variation.get());
         }
 
-        bool RunNextPass(std::ostream* buildLogFile)
+        void Run()
         {
-            m_stream.clear();
-            m_stream.seekg(0, std::ios::beg);
-
-            m_output_file = m_default_output_file;
-            m_current_pass = TemplatingPass(m_stream, m_filename, this);
-
-            for (const auto& activeVariation : m_active_variations)
-                activeVariation->Apply(m_current_pass.m_defines_proxy.get());
-
-            while (!m_skip_pass && !m_current_pass.m_stream->Eof())
+            std::istringstream stream(m_source);
+            try
             {
-                auto nextLine = m_current_pass.m_stream->NextLine();
+                m_current_pass = TemplatingPass(stream, m_filename, this);
 
-                if (m_write_output_to_file)
-                {
-                    if (m_first_line)
-                        m_first_line = false;
-                    else
-                        m_output_stream << '\n';
+                for (const auto& activeVariation : m_active_variations)
+                    activeVariation->Apply(m_current_pass.m_defines_proxy.get());
 
-                    m_output_stream << nextLine.m_line;
-                }
-                else
+                while (!m_skip_pass && !m_current_pass.m_stream->Eof())
                 {
+                    auto nextLine = m_current_pass.m_stream->NextLine();
+
                     if (m_first_line)
                         m_first_line = false;
                     else
-                        m_output_cache << '\n';
+                        m_output << '\n';
 
-                    m_output_cache << nextLine.m_line;
+                    m_output << nextLine.m_line;
                 }
             }
+            catch (...)
+            {
+                m_exception = std::current_exception();
+            }
+
+            // The proxies reference the stream of the source which only lives as long as the pass runs
+            m_current_pass = TemplatingPass();
+        }
+
+        /**
+         * \brief Schedules writing the output of a pass that ran before and reports its errors.
+         * \return \c true if the pass succeeded, \c false otherwise.
+         */
+        bool CommitPass(std::ostream* buildLogFile, TemplaterOutputWriter& outputWriter)
+        {
+            const auto errors = m_errors.str();
+            if (!errors.empty())
+                std::cerr << errors;
+
+            if (m_exception)
+                std::rethrow_exception(m_exception);
 
             if (m_skip_pass)
                 return true;
 
-            if (!m_write_output_to_file)
+            if (!m_has_output_file_name && !m_active_variations.empty())
             {
-                if (!m_active_variations.empty())
+                std::cerr << "Template with variations must specify a filename\n";
+                return false;
+            }
+
+            const auto parentDir = fs::path(m_output_file).parent_path();
+            if (!parentDir.empty())
+            {
+                std::error_code ec;
+                create_directories(parentDir, ec);
+                if (ec)
                 {
-                    std::cerr << "Template with variations must specify a filename\n";
+                    std::cerr << "Failed to create output directory \"" << parentDir.string() << "\": " << ec.message() << "\n";
                     return false;
                 }
-
-                if (!OpenOutputStream())
-                    return false;
-
-                const auto cachedData = m_output_cache.str();
-                if (!cachedData.empty())
-                    m_output_stream << cachedData;
             }
 
+            outputWriter.WriteFile(m_output_file, std::move(m_output).str());
+
             std::cout << "Templated file \"" << m_output_file << "\"\n";
 
             if (buildLogFile)
                 *buildLogFile << "Templated file \"" << m_output_file << "\"\n";
 
-            m_first_line = true;
-            m_write_output_to_file = false;
-            m_output_cache.clear();
-            m_output_cache.str(std::string());
-            m_output_stream.close();
-
             return true;
         }
 
-        void AdvanceActiveVariations()
+        /**
+         * \brief Whether the pass added variations that were not part of the permutation it started with.
+         */
+        _NODISCARD bool DiscoveredVariations() const
         {
-            while (!m_active_variations.empty())
-            {
-                const auto& lastVariation = m_active_variations[m_active_variations.size() - 1];
-                lastVariation->Advance();
-
-                if (lastVariation->IsFinished())
-                {
-                    m_active_variations_by_name.erase(lastVariation->GetName());
-                    m_active_variations.pop_back();
-                }
-                else
-                    break;
-            }
+            return m_discovered_variations;
         }
 
-        _NODISCARD bool HasActiveVariations() const
+        _NODISCARD const variations_t& GetVariations() const
         {
-            return !m_active_variations.empty();
+            return m_active_variations;
         }
 
     protected:
@@ -276,7 +433,7 @@ namespace templating
                 const auto isValidRedefinition = existingVariation->second->GetVariationType() == TemplatingVariationType::SWITCH;
 
                 if (!isValidRedefinition)
-                    std::cerr << "Redefinition of \"" << switchName << "\" as switch is invalid\n";
+                    m_errors << "Redefinition of \"" << switchName << "\" as switch is invalid\n";
 
                 return isValidRedefinition;
             }
@@ -287,6 +444,7 @@ namespace templating
 
             m_active_variations_by_name.emplace(switchVariation->m_name, switchVariation.get());
             m_active_variations.emplace_back(std::move(switchVariation));
+            m_discovered_variations = true;
 
             return true;
         }
@@ -299,7 +457,7 @@ namespace templating
                 const auto isValidRedefinition = existingVariation->second->GetVariationType() == TemplatingVariationType::OPTIONS;
 
                 if (!isValidRedefinition)
-                    std::cerr << "Redefinition of \"" << optionsName << "\" as options is invalid\n";
+                    m_errors << "Redefinition of \"" << optionsName << "\" as options is invalid\n";
 
                 return isValidRedefinition;
             }
@@ -310,34 +468,27 @@ namespace templating
 
             m_active_variations_by_name.emplace(optionsVariation->m_name, optionsVariation.get());
             m_active_variations.emplace_back(std::move(optionsVariation));
+            m_discovered_variations = true;
 
             return true;
         }
 
         bool SetFileName(const std::string& fileName) override
         {
-            if (m_write_output_to_file)
+            if (m_has_output_file_name)
                 return false;
 
             m_output_file = (m_output_directory / fileName).string();
-            if (!OpenOutputStream())
-                return false;
-
-            m_write_output_to_file = true;
-            const auto cachedData = m_output_cache.str();
-            if (!cachedData.empty())
-                m_output_stream << cachedData;
-            m_output_cache.clear();
-            m_output_cache.str(std::string());
+            m_has_output_file_name = true;
 
             return true;
         }
 
         bool SkipPass() override
         {
-            if (m_write_output_to_file)
+            if (m_has_output_file_name)
             {
-                std::cerr << "Cannot skip when already writing to file\n";
+                m_errors << "Cannot skip when already writing to file\n";
                 return false;
             }
 
@@ -346,44 +497,30 @@ namespace templating
         }
 
     private:
-        bool OpenOutputStream()
-        {
-            const auto parentDir = fs::path(m_output_file).parent_path();
-            if (!parentDir.empty())
-                create_directories(parentDir);
-
-            m_output_stream = std::ofstream(m_output_file, std::ios::out | std::ios::binary);
-            if (!m_output_stream.is_open())
-            {
-                std::cerr << "Failed to open output file \"" << m_output_file << "\"\n";
-                return false;
-            }
-
-            return true;
-        }
-
-        std::vector<std::unique_ptr<ITemplatingVariation>> m_active_variations;
+        variations_t m_active_variations;
         std::unordered_map<std::string, ITemplatingVariation*> m_active_variations_by_name;
         TemplatingPass m_current_pass;
 
-        std::istream& m_stream;
+        const std::string& m_source;
         std::string m_filename;
         std::string m_output_file;
-        std::string m_default_output_file;
         const fs::path m_output_directory;
 
+        bool m_discovered_variations;
         bool m_first_line;
         bool m_skip_pass;
-        bool m_write_output_to_file;
-        std::ofstream m_output_stream;
-        std::ostringstream m_output_cache;
+        bool m_has_output_file_name;
+        std::ostringstream m_output;
+        std::ostringstream m_errors;
+        std::exception_ptr m_exception;
     };
 } // namespace templating
 
 Templater::Templater(std::istream& stream, std::string fileName)
     : m_stream(stream),
       m_build_log(nullptr),
-      m_file_name(std::move(fileName))
+      m_file_name(std::move(fileName)),
+      m_job_count(1u)
 {
 }
 
@@ -392,30 +529,91 @@ void Templater::SetBuildLogFile(std::ostream* buildLogFile)
     m_build_log = buildLogFile;
 }
 
+void Templater::SetJobCount(const unsigned jobCount)
+{
+    m_job_count = std::max(jobCount, 1u);
+}
+
 bool Templater::TemplateToDirectory(const std::string& outputDirectory) const
 {
-    TemplaterControlImpl control(m_stream, m_file_name, outputDirectory);
+    // The source is read once and every pass reads it from memory
+    std::ostringstream sourceStream;
+    sourceStream << m_stream.rdbuf();
+    const auto source = std::move(sourceStream).str();
+
+    std::unique_ptr<ThreadPool> workerPool;
+    if (m_job_count > 1u)
+        workerPool = std::make_unique<ThreadPool>(m_job_count);
+
+    TemplaterOutputWriter outputWriter(workerPool.get());
 
     try
     {
-        if (!control.RunNextPass(m_build_log))
+        // The first pass discovers the variations of the template
+        TemplaterPass firstPass(source, m_file_name, outputDirectory, variations_t());
+        firstPass.Run();
+        if (!firstPass.CommitPass(m_build_log, outputWriter))
+        {
+            outputWriter.WaitForWrittenFiles();
             return false;
+        }
+
+        auto variations = CloneVariations(firstPass.GetVariations());
+        AdvanceVariations(variations);
 
-        control.AdvanceActiveVariations();
-        while (control.HasActiveVariations())
+        while (!variations.empty())
         {
-            if (!control.RunNextPass(m_build_log))
-                return false;
+            // Following passes are assumed to not discover any more variations so their permutations are known ahead of time.
+            // If one of them does discover a variation, the passes after it are discarded and run again with the new variations.
+            std::vector<std::unique_ptr<TemplaterPass>> passes;
+            while (!variations.empty() && passes.size() < m_job_count)
+            {
+                passes.emplace_back(std::make_unique<TemplaterPass>(source, m_file_name, outputDirectory, CloneVariations(variations)));
+                AdvanceVariations(variations);
+            }
+
+            if (workerPool && passes.size() > 1u)
+            {
+                for (const auto& pass : passes)
+                {
+                    workerPool->Enqueue(
+                        [&pass]
+                        {
+                            pass->Run();
+                        });
+                }
+                workerPool->WaitForIdle();
+            }
+            else
+            {
+                for (const auto& pass : passes)
+                    pass->Run();
+            }
+
+            for (const auto& pass : passes)
+            {
+                if (!pass->CommitPass(m_build_log, outputWriter))
+                {
+                    outputWriter.WaitForWrittenFiles();
+                    return false;
+                }
 
-            control.AdvanceActiveVariations();
+                if (pass->DiscoveredVariations())
+                {
+                    variations = CloneVariations(pass->GetVariations());
+                    AdvanceVariations(variations);
+                    break;
+                }
+            }
         }
     }
     catch (ParsingException& e)
     {
+        outputWriter.WaitForWrittenFiles();
         std::cerr << "Error: " << e.FullMessage() << "\n";
 
         return false;
     }
 
-    return true;
+    return outputWriter.WaitForWrittenFiles();
 }
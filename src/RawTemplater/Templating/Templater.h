@@ -12,11 +12,18 @@ namespace templating
         Templater(std::istream& stream, std::string fileName);
 
         void SetBuildLogFile(std::ostream* buildLogFile);
+
+        /**
+         * \brief Sets the amount of variations that are templated at the same time.
+         * \param jobCount The amount of variations to template at the same time. Defaults to \c 1.
+         */
+        void SetJobCount(unsigned jobCount);
         _NODISCARD bool TemplateToDirectory(const std::string& outputDirectory) const;
 
     private:
         std::istream& m_stream;
         std::ostream* m_build_log;
         std::string m_file_name;
+        unsigned m_job_count;
     };
 } // namespace templating
@@ -1,20 +1,226 @@
 #include "ContentPrinter.h"
 
-ContentPrinter::ContentPrinter(Zone* zone)
+#include <format>
+#include <iterator>
+
+namespace
+{
+    // Large enough for the content of most zones to not need to grow the buffer
+    constexpr auto INITIAL_BUFFER_SIZE = 0x10000u;
+
+    double GetPercentage(const size_t value, const size_t total)
+    {
+        if (total == 0u)
+            return 0.0;
+
+        return static_cast<double>(value) * 100.0 / static_cast<double>(total);
+    }
+} // namespace
+
+ContentPrinter::ContentPrinter(Zone* zone, const Format format)
+    : m_zone(zone),
+      m_format(format)
+{
+    m_buffer.reserve(INITIAL_BUFFER_SIZE);
+}
+
+void ContentPrinter::AppendCsvField(const std::string_view value)
+{
+    m_buffer += ',';
+
+    if (value.find_first_of(",\"\r\n") == std::string_view::npos)
+    {
+        m_buffer += value;
+        return;
+    }
+
+    m_buffer += '"';
+    for (const auto c : value)
+    {
+        if (c == '"')
+            m_buffer += '"';
+        m_buffer += c;
+    }
+    m_buffer += '"';
+}
+
+void ContentPrinter::AppendJsonString(const std::string_view value)
+{
+    m_buffer += '"';
+    for (const auto c : value)
+    {
+        if (c == '"' || c == '\\')
+        {
+            m_buffer += '\\';
+            m_buffer += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20u)
+            std::format_to(std::back_inserter(m_buffer), "\\u{:04x}", static_cast<unsigned>(c));
+        else
+            m_buffer += c;
+    }
+    m_buffer += '"';
+}
+
+void ContentPrinter::PrintContent()
+{
+    const auto* pools = m_zone->m_pools.get();
+    auto out = std::back_inserter(m_buffer);
+
+    switch (m_format)
+    {
+    case Format::TEXT:
+        std::format_to(out, "Zone '{}' ({})\nContent:\n", m_zone->m_name, m_zone->m_game->GetShortName());
+        for (const auto& asset : *pools)
+            std::format_to(out, "{}, {}\n", pools->GetAssetTypeName(asset->m_type), asset->m_name);
+        m_buffer += '\n';
+        break;
+
+    case Format::CSV:
+        m_buffer += "zone";
+        AppendCsvField(m_zone->m_name);
+        AppendCsvField(m_zone->m_game->GetShortName());
+        m_buffer += '\n';
+
+        for (const auto& asset : *pools)
+        {
+            m_buffer += "asset";
+            AppendCsvField(m_zone->m_name);
+            AppendCsvField(pools->GetAssetTypeName(asset->m_type));
+            AppendCsvField(asset->m_name);
+            m_buffer += '\n';
+        }
+        break;
+
+    case Format::JSON:
+        m_buffer += R"({"record":"zone","zone":)";
+        AppendJsonString(m_zone->m_name);
+        m_buffer += R"(,"game":)";
+        AppendJsonString(m_zone->m_game->GetShortName());
+        m_buffer += "}\n";
+
+        for (const auto& asset : *pools)
+        {
+            m_buffer += R"({"record":"asset","zone":)";
+            AppendJsonString(m_zone->m_name);
+            m_buffer += R"(,"type":)";
+            AppendJsonString(pools->GetAssetTypeName(asset->m_type));
+            m_buffer += R"(,"name":)";
+            AppendJsonString(asset->m_name);
+            m_buffer += "}\n";
+        }
+        break;
+    }
+}
+
+void ContentPrinter::PrintBlockUsage()
 {
-    m_zone = zone;
+    auto out = std::back_inserter(m_buffer);
+
+    if (m_format == Format::TEXT)
+        m_buffer += "Blocks:\n";
+
+    for (const auto& block : m_zone->GetMemory()->GetBlocks())
+    {
+        switch (m_format)
+        {
+        case Format::TEXT:
+            std::format_to(out,
+                           "{}, {} of {} bytes used ({:.1f}%)\n",
+                           block->m_name,
+                           block->m_used_size,
+                           block->m_buffer_size,
+                           GetPercentage(block->m_used_size, block->m_buffer_size));
+            break;
+
+        case Format::CSV:
+            m_buffer += "block";
+            AppendCsvField(m_zone->m_name);
+            AppendCsvField(block->m_name);
+            std::format_to(out, ",{},{}\n", block->m_used_size, block->m_buffer_size);
+            break;
+
+        case Format::JSON:
+            m_buffer += R"({"record":"block","zone":)";
+            AppendJsonString(m_zone->m_name);
+            m_buffer += R"(,"name":)";
+            AppendJsonString(block->m_name);
+            std::format_to(out, R"(,"used":{},"size":{}}})"
+                                "\n",
+                           block->m_used_size,
+                           block->m_buffer_size);
+            break;
+        }
+    }
+
+    if (m_format == Format::TEXT)
+        m_buffer += '\n';
 }
 
-void ContentPrinter::PrintContent() const
+void ContentPrinter::PrintAssetMemoryUsage()
 {
+    const auto* memory = m_zone->GetMemory();
     const auto* pools = m_zone->m_pools.get();
-    printf("Zone '%s' (%s)\n", m_zone->m_name.c_str(), m_zone->m_game->GetShortName().c_str());
-    puts("Content:");
+    auto out = std::back_inserter(m_buffer);
+
+    if (m_format == Format::TEXT)
+        m_buffer += "Asset memory:\n";
 
-    for (const auto& asset : *pools)
+    size_t totalBlockSize = 0u;
+    size_t totalHeapSize = 0u;
+    for (const auto& [assetType, usage] : memory->GetAssetMemoryUsage())
     {
-        printf("%s, %s\n", pools->GetAssetTypeName(asset->m_type), asset->m_name.c_str());
+        switch (m_format)
+        {
+        case Format::TEXT:
+            std::format_to(out,
+                           "{}, {} assets, {} block bytes, {} heap bytes\n",
+                           pools->GetAssetTypeName(assetType),
+                           usage.m_asset_count,
+                           usage.m_block_size,
+                           usage.m_heap_size);
+            break;
+
+        case Format::CSV:
+            m_buffer += "asset_memory";
+            AppendCsvField(m_zone->m_name);
+            AppendCsvField(pools->GetAssetTypeName(assetType));
+            std::format_to(out, ",{},{},{}\n", usage.m_asset_count, usage.m_block_size, usage.m_heap_size);
+            break;
+
+        case Format::JSON:
+            m_buffer += R"({"record":"asset_memory","zone":)";
+            AppendJsonString(m_zone->m_name);
+            m_buffer += R"(,"type":)";
+            AppendJsonString(pools->GetAssetTypeName(assetType));
+            std::format_to(out,
+                           R"(,"assets":{},"block_bytes":{},"heap_bytes":{}}})"
+                           "\n",
+                           usage.m_asset_count,
+                           usage.m_block_size,
+                           usage.m_heap_size);
+            break;
+        }
+
+        totalBlockSize += usage.m_block_size;
+        totalHeapSize += usage.m_heap_size;
     }
 
-    puts("");
+    if (m_format == Format::TEXT)
+        std::format_to(
+            out, "Total, {} block bytes, {} heap bytes, {} heap bytes of zone\n\n", totalBlockSize, totalHeapSize, memory->GetAllocatedSize());
+}
+
+void ContentPrinter::PrintMemoryUsage()
+{
+    PrintBlockUsage();
+    PrintAssetMemoryUsage();
+}
+
+void ContentPrinter::Flush(FILE* file)
+{
+    // A single write keeps the output of zones that are listed at the same time from interleaving
+    fwrite(m_buffer.data(), 1u, m_buffer.size(), file);
+    fflush(file);
+    m_buffer.clear();
 }
@@ -2,12 +2,50 @@
 
 #include "Zone/Zone.h"
 
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+/**
+ * \brief Lists the content of a zone. All output is collected in one buffer and written at once when flushing
+ * so listing many zones, possibly at the same time, does not write line by line.
+ */
 class ContentPrinter
 {
-    Zone* m_zone;
-
 public:
-    explicit ContentPrinter(Zone* zone);
+    enum class Format
+    {
+        // Readable text with a section for the assets, the blocks and the asset memory
+        TEXT,
+        // One comma separated record per line starting with the kind of record and the zone name
+        CSV,
+        // One json object per line with a "record" and a "zone" field
+        JSON
+    };
+
+    ContentPrinter(Zone* zone, Format format);
+
+    void PrintContent();
 
-    void PrintContent() const;
+    /**
+     * \brief Prints how much of each block of the zone was used and how much memory the assets of each type use.
+     */
+    void PrintMemoryUsage();
+
+    /**
+     * \brief Writes everything that was printed so far to the specified file and clears the buffer.
+     * \param file The file to write to.
+     */
+    void Flush(FILE* file = stdout);
+
+private:
+    void PrintBlockUsage();
+    void PrintAssetMemoryUsage();
+
+    void AppendCsvField(std::string_view value);
+    void AppendJsonString(std::string_view value);
+
+    Zone* m_zone;
+    Format m_format;
+    std::string m_buffer;
 };
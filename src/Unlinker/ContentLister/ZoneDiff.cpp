@@ -0,0 +1,100 @@
+#include "ZoneDiff.h"
+
+#include <format>
+#include <map>
+#include <utility>
+
+namespace
+{
+    using asset_key_t = std::pair<std::string, std::string>;
+
+    std::map<asset_key_t, uint64_t> GetAssetHashes(const Zone& zone)
+    {
+        std::map<asset_key_t, uint64_t> hashes;
+
+        const auto* pools = zone.m_pools.get();
+        for (const auto& asset : *pools)
+            hashes.emplace(asset_key_t(pools->GetAssetTypeName(asset->m_type), asset->m_name), asset->m_content_hash);
+
+        return hashes;
+    }
+
+    char GetChangeSymbol(const ZoneDiff::Change change)
+    {
+        switch (change)
+        {
+        case ZoneDiff::Change::ADDED:
+            return '+';
+        case ZoneDiff::Change::REMOVED:
+            return '-';
+        case ZoneDiff::Change::CHANGED:
+        default:
+            return '~';
+        }
+    }
+} // namespace
+
+ZoneDiff::ZoneDiff(const Zone& oldZone, const Zone& newZone)
+    : m_old_zone_name(oldZone.m_name),
+      m_new_zone_name(newZone.m_name),
+      m_unchanged_count(0u)
+{
+    const auto oldHashes = GetAssetHashes(oldZone);
+    const auto newHashes = GetAssetHashes(newZone);
+
+    // Both maps are sorted the same way, so they are merged in a single pass
+    auto oldAsset = oldHashes.begin();
+    auto newAsset = newHashes.begin();
+    while (oldAsset != oldHashes.end() || newAsset != newHashes.end())
+    {
+        if (newAsset == newHashes.end() || (oldAsset != oldHashes.end() && oldAsset->first < newAsset->first))
+        {
+            m_entries.emplace_back(Entry{Change::REMOVED, oldAsset->first.first, oldAsset->first.second});
+            ++oldAsset;
+        }
+        else if (oldAsset == oldHashes.end() || newAsset->first < oldAsset->first)
+        {
+            m_entries.emplace_back(Entry{Change::ADDED, newAsset->first.first, newAsset->first.second});
+            ++newAsset;
+        }
+        else
+        {
+            // Assets that were not hashed cannot be told apart, so they are always reported as changed
+            if (oldAsset->second == 0u || oldAsset->second != newAsset->second)
+                m_entries.emplace_back(Entry{Change::CHANGED, newAsset->first.first, newAsset->first.second});
+            else
+                m_unchanged_count++;
+
+            ++oldAsset;
+            ++newAsset;
+        }
+    }
+}
+
+const std::vector<ZoneDiff::Entry>& ZoneDiff::GetEntries() const
+{
+    return m_entries;
+}
+
+size_t ZoneDiff::GetUnchangedCount() const
+{
+    return m_unchanged_count;
+}
+
+void ZoneDiff::Print(std::ostream& stream) const
+{
+    size_t counts[3]{};
+
+    stream << std::format("Comparing zone '{}' with zone '{}'\n", m_old_zone_name, m_new_zone_name);
+    for (const auto& entry : m_entries)
+    {
+        stream << std::format("{} {}, {}\n", GetChangeSymbol(entry.m_change), entry.m_asset_type, entry.m_asset_name);
+        counts[static_cast<unsigned>(entry.m_change)]++;
+    }
+
+    stream << std::format("{} added, {} removed, {} changed, {} unchanged\n",
+                          counts[static_cast<unsigned>(Change::ADDED)],
+                          counts[static_cast<unsigned>(Change::REMOVED)],
+                          counts[static_cast<unsigned>(Change::CHANGED)],
+                          m_unchanged_count);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Utils/ClassUtils.h"
+#include "Zone/Zone.h"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Compares the assets of two zones by the hashes of the zone data they were loaded from, without dumping any of them.
+ * Both zones must be loaded with content hashing enabled. Assets are identified by their type name and their name.
+ */
+class ZoneDiff
+{
+public:
+    enum class Change
+    {
+        ADDED,
+        REMOVED,
+        CHANGED
+    };
+
+    class Entry
+    {
+    public:
+        Change m_change;
+        std::string m_asset_type;
+        std::string m_asset_name;
+    };
+
+    /**
+     * \brief Compares two zones. Changes are sorted by asset type and asset name.
+     * \param oldZone The zone to compare against.
+     * \param newZone The zone whose changes are determined.
+     */
+    ZoneDiff(const Zone& oldZone, const Zone& newZone);
+
+    _NODISCARD const std::vector<Entry>& GetEntries() const;
+    _NODISCARD size_t GetUnchangedCount() const;
+
+    /**
+     * \brief Prints one line per added (+), removed (-) or changed (~) asset followed by a summary.
+     * \param stream The stream to print to.
+     */
+    void Print(std::ostream& stream) const;
+
+private:
+    std::string m_old_zone_name;
+    std::string m_new_zone_name;
+    std::vector<Entry> m_entries;
+    size_t m_unchanged_count;
+};
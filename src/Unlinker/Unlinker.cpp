@@ -1,25 +1,46 @@
 #include "Unlinker.h"
 
 #include "ContentLister/ContentPrinter.h"
+#include "ContentLister/ZoneDiff.h"
 #include "ContentLister/ZoneDefWriter.h"
+#include "Dumping/AssetDumpManifest.h"
 #include "Game/IW3/ZoneDefWriterIW3.h"
 #include "Game/IW4/ZoneDefWriterIW4.h"
 #include "Game/IW5/ZoneDefWriterIW5.h"
 #include "Game/T5/ZoneDefWriterT5.h"
 #include "Game/T6/ZoneDefWriterT6.h"
+#include "GitVersion.h"
+#include "Image/ImageDumpCache.h"
 #include "ObjContainer/IWD/IWD.h"
 #include "ObjLoading.h"
 #include "ObjWriting.h"
+#include "Pool/AssetClosure.h"
+#include "Pool/GlobalAssetPoolLinkOrder.h"
 #include "SearchPath/SearchPathFilesystem.h"
 #include "SearchPath/SearchPaths.h"
+#include "Shader/ShaderInfoCache.h"
 #include "UnlinkerArgs.h"
 #include "Utils/Arguments/ArgumentParser.h"
+#include "Utils/BenchmarkReport.h"
 #include "Utils/ClassUtils.h"
+#include "Utils/JobSystem.h"
+#include "Utils/MemoryBudget.h"
 #include "Utils/ObjFileStream.h"
+#include "Utils/ProcessMemory.h"
+#include "Utils/ProgressReporter.h"
+#include "Utils/ThreadPool.h"
+#include "Utils/Tracing.h"
+#include "Utils/WorkClaims.h"
 #include "ZoneLoading.h"
 
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
+#include <format>
 #include <fstream>
+#include <future>
+#include <mutex>
+#include <optional>
 #include <regex>
 #include <set>
 
@@ -40,11 +61,21 @@ class Unlinker::Impl
     SearchPathFilesystem* m_last_zone_search_path;
     std::set<std::string> m_absolute_search_paths;
 
+    // Declared before the zones to outlive the blocks it allocated for them
+    std::unique_ptr<VirtualXBlockAllocator> m_xblock_allocator;
     std::vector<std::unique_ptr<Zone>> m_loaded_zones;
+    std::unique_ptr<benchmarking::BenchmarkReport> m_benchmark_report;
+    std::ofstream m_progress_stream;
+    std::unique_ptr<progress::IProgressReporter> m_progress_reporter;
+    std::unique_ptr<ImageDumpCache> m_image_dump_cache;
+    std::unique_ptr<WorkClaims> m_work_claims;
+
+    // Guards search paths, obj containers and global asset pools when unlinking multiple zones at once
+    std::mutex m_shared_state_mutex;
 
     _NODISCARD bool ShouldLoadObj() const
     {
-        return m_args.m_task != UnlinkerArgs::ProcessingTask::LIST && !m_args.m_skip_obj;
+        return m_args.m_task == UnlinkerArgs::ProcessingTask::DUMP && !m_args.m_skip_obj;
     }
 
     /**
@@ -156,14 +187,10 @@ class Unlinker::Impl
         return true;
     }
 
-    bool WriteZoneDefinitionFile(Zone* zone, const fs::path& zoneDefinitionFileFolder) const
+    bool WriteZoneDefinitionFile(Zone* zone, const AssetDumpingContext& context) const
     {
-        auto zoneDefinitionFilePath(zoneDefinitionFileFolder);
-        zoneDefinitionFilePath.append(zone->m_name);
-        zoneDefinitionFilePath.replace_extension(".zone");
-
-        std::ofstream zoneDefinitionFile(zoneDefinitionFilePath, std::fstream::out | std::fstream::binary);
-        if (!zoneDefinitionFile.is_open())
+        const auto zoneDefinitionFile = context.OpenAssetFile("zone_source/" + zone->m_name + ".zone");
+        if (!zoneDefinitionFile)
         {
             printf("Failed to open file for zone definition file of zone \"%s\".\n", zone->m_name.c_str());
             return false;
@@ -174,7 +201,7 @@ class Unlinker::Impl
         {
             if (zoneDefWriter->CanHandleZone(zone))
             {
-                zoneDefWriter->WriteZoneDef(zoneDefinitionFile, &m_args, zone);
+                zoneDefWriter->WriteZoneDef(*zoneDefinitionFile, &m_args, zone);
                 result = true;
                 break;
             }
@@ -185,52 +212,100 @@ class Unlinker::Impl
             printf("Failed to find writer for zone definition file of zone \"%s\".\n", zone->m_name.c_str());
         }
 
-        zoneDefinitionFile.close();
         return result;
     }
 
-    static bool OpenGdtFile(Zone* zone, const fs::path& outputFolder, std::ofstream& stream)
+    static bool WriteGdtFile(Zone* zone, AssetDumpingContext& context)
     {
-        auto gdtFilePath(outputFolder);
-        gdtFilePath.append("source_data");
-
-        fs::create_directories(gdtFilePath);
-
-        gdtFilePath.append(zone->m_name);
-        gdtFilePath.replace_extension(".gdt");
-
-        stream = std::ofstream(gdtFilePath, std::fstream::out | std::fstream::binary);
-        if (!stream.is_open())
+        const auto stream = context.OpenAssetFile("source_data/" + zone->m_name + ".gdt");
+        if (!stream)
         {
-            printf("Failed to open file for zone definition file of zone \"%s\".\n", zone->m_name.c_str());
+            printf("Failed to open file for gdt of zone \"%s\".\n", zone->m_name.c_str());
             return false;
         }
 
+        GdtOutputStream gdt(*stream);
+        gdt.BeginStream();
+        gdt.WriteVersion(GdtVersion(zone->m_game->GetShortName(), 1));
+        context.m_gdt->WriteEntries(gdt);
+        gdt.EndStream();
+        context.m_gdt.reset();
+
         return true;
     }
 
-    void UpdateAssetIncludesAndExcludes(const AssetDumpingContext& context) const
+    /**
+     * \brief Determines which asset types of a zone are handled according to the asset types included or excluded via command line.
+     * \param zone The zone to determine the handled asset types for.
+     * \param handledSpecifiedAssets Optionally receives which of the specified asset types exist for the zone.
+     * \return A bitfield of the asset types of the zone that are handled.
+     */
+    std::vector<bool> GetAssetTypesToHandle(const Zone* zone, std::vector<bool>* handledSpecifiedAssets = nullptr) const
     {
-        const auto assetTypeCount = context.m_zone->m_pools->GetAssetTypeCount();
+        const auto assetTypeCount = zone->m_pools->GetAssetTypeCount();
 
-        ObjWriting::Configuration.AssetTypesToHandleBitfield = std::vector<bool>(assetTypeCount);
+        std::vector<bool> assetTypesToHandle(assetTypeCount);
+        if (handledSpecifiedAssets)
+            *handledSpecifiedAssets = std::vector<bool>(m_args.m_specified_asset_types.size());
 
-        std::vector<bool> handledSpecifiedAssets(m_args.m_specified_asset_types.size());
         for (auto i = 0; i < assetTypeCount; i++)
         {
-            const auto assetTypeName = std::string(context.m_zone->m_pools->GetAssetTypeName(i));
+            const auto assetTypeName = std::string(zone->m_pools->GetAssetTypeName(i));
 
             const auto foundSpecifiedEntry = m_args.m_specified_asset_type_map.find(assetTypeName);
             if (foundSpecifiedEntry != m_args.m_specified_asset_type_map.end())
             {
-                ObjWriting::Configuration.AssetTypesToHandleBitfield[i] = m_args.m_asset_type_handling == UnlinkerArgs::AssetTypeHandling::INCLUDE;
-                assert(foundSpecifiedEntry->second < handledSpecifiedAssets.size());
-                handledSpecifiedAssets[foundSpecifiedEntry->second] = true;
+                assetTypesToHandle[i] = m_args.m_asset_type_handling == UnlinkerArgs::AssetTypeHandling::INCLUDE;
+                if (handledSpecifiedAssets)
+                {
+                    assert(foundSpecifiedEntry->second < handledSpecifiedAssets->size());
+                    (*handledSpecifiedAssets)[foundSpecifiedEntry->second] = true;
+                }
             }
             else
-                ObjWriting::Configuration.AssetTypesToHandleBitfield[i] = m_args.m_asset_type_handling == UnlinkerArgs::AssetTypeHandling::EXCLUDE;
+                assetTypesToHandle[i] = m_args.m_asset_type_handling == UnlinkerArgs::AssetTypeHandling::EXCLUDE;
         }
 
+        return assetTypesToHandle;
+    }
+
+    /**
+     * \brief Collects the assets of a zone that are reachable from the root assets specified via command line.
+     * \param zone The zone to collect the assets of.
+     * \return The reachable assets or \c nullptr if no root assets were specified and all assets are handled.
+     */
+    std::unique_ptr<AssetClosure> CreateAssetClosure(const Zone* zone) const
+    {
+        if (m_args.m_asset_roots.empty())
+            return nullptr;
+
+        const auto& pools = *zone->m_pools;
+        auto closure = std::make_unique<AssetClosure>(pools);
+        for (const auto& root : m_args.m_asset_roots)
+        {
+            for (asset_type_t assetType = 0; assetType < pools.GetAssetTypeCount(); assetType++)
+            {
+                if (!root.m_asset_type.empty() && root.m_asset_type != pools.GetAssetTypeName(assetType))
+                    continue;
+
+                if (auto* rootAsset = pools.GetAsset(assetType, root.m_asset_name))
+                    closure->AddRoot(rootAsset);
+            }
+        }
+
+        if (m_args.m_verbose)
+            std::cout << std::format("{} assets of zone \"{}\" are reachable from the root assets\n", closure->GetAssetCount(), zone->m_name);
+
+        return closure;
+    }
+
+    void UpdateAssetIncludesAndExcludes(AssetDumpingContext& context) const
+    {
+        const auto assetTypeCount = context.m_zone->m_pools->GetAssetTypeCount();
+
+        std::vector<bool> handledSpecifiedAssets;
+        context.m_asset_types_to_handle = GetAssetTypesToHandle(context.m_zone, &handledSpecifiedAssets);
+
         auto anySpecifiedValueInvalid = false;
         for (auto i = 0u; i < handledSpecifiedAssets.size(); i++)
         {
@@ -260,60 +335,175 @@ class Unlinker::Impl
         }
     }
 
+    /**
+     * \brief Creates a dump manifest for a zone with everything besides the zone itself that influences the dumped files as its environment.
+     */
+    std::unique_ptr<AssetDumpManifest> CreateDumpManifest(const Zone* zone) const
+    {
+        auto manifest = std::make_unique<AssetDumpManifest>();
+        manifest->AddEnvironment(std::format("version {}", GIT_VERSION));
+        manifest->AddEnvironment(std::format("game {}", zone->m_game->GetShortName()));
+        manifest->AddEnvironment(std::format("image-format {}", static_cast<int>(ObjWriting::Configuration.ImageOutputFormat)));
+        manifest->AddEnvironment(std::format("model-format {}", static_cast<int>(ObjWriting::Configuration.ModelOutputFormat)));
+        manifest->AddEnvironment(std::format("weld-vertices {}", ObjWriting::Configuration.ModelWeldVertices));
+        manifest->AddEnvironment(std::format("legacy-menus {}", ObjWriting::Configuration.MenuLegacyMode));
+        manifest->AddEnvironment(std::format("gdt {}", m_args.m_use_gdt));
+
+        return manifest;
+    }
+
     /**
      * \brief Performs the tasks specified by the command line arguments on the specified zone.
      * \param zone The zone to handle.
      * \return \c true if handling the zone was successful, otherwise \c false.
      */
-    bool HandleZone(Zone* zone) const
+    bool HandleZone(Zone* zone, const AssetClosure* assetClosure = nullptr) const
     {
+        TRACE_SCOPE("Unlinker", "HandleZone " + zone->m_name);
+        benchmarking::ScopedPhase benchmarkPhase(m_benchmark_report.get(), m_args.m_task == UnlinkerArgs::ProcessingTask::LIST ? "list" : "dump");
+        benchmarkPhase.AddAssets(zone->m_pools->GetTotalAssetCount());
+
         if (m_args.m_task == UnlinkerArgs::ProcessingTask::LIST)
         {
-            const ContentPrinter printer(zone);
+            ContentPrinter printer(zone, m_args.m_list_format);
             printer.PrintContent();
+            printer.PrintMemoryUsage();
+            printer.Flush();
         }
         else if (m_args.m_task == UnlinkerArgs::ProcessingTask::DUMP)
         {
             const auto outputFolderPath = m_args.GetOutputFolderPathForZone(zone);
-            fs::create_directories(outputFolderPath);
-
-            fs::path zoneDefinitionFileFolder(outputFolderPath);
-            zoneDefinitionFileFolder.append("zone_source");
-            fs::create_directories(zoneDefinitionFileFolder);
 
-            if (!WriteZoneDefinitionFile(zone, zoneDefinitionFileFolder))
-                return false;
-
-            std::ofstream gdtStream;
             AssetDumpingContext context;
             context.m_zone = zone;
             context.m_base_path = outputFolderPath;
 
-            if (m_args.m_use_gdt)
+            if (m_args.m_archive)
             {
-                if (!OpenGdtFile(zone, outputFolderPath, gdtStream))
+                // The archive is placed next to where the output folder would be
+                auto archivePath = fs::path(outputFolderPath).lexically_normal();
+                if (!archivePath.has_filename())
+                    archivePath = archivePath.parent_path();
+                archivePath += ".zip";
+
+                if (!context.OpenArchive(archivePath.string(), 0u))
                     return false;
-                auto gdt = std::make_unique<GdtOutputStream>(gdtStream);
-                gdt->BeginStream();
-                gdt->WriteVersion(GdtVersion(zone->m_game->GetShortName(), 1));
-                context.m_gdt = std::move(gdt);
+            }
+            else
+                fs::create_directories(outputFolderPath);
+
+            if (m_args.m_use_gdt)
+                context.m_gdt = std::make_unique<GdtEntryCollector>();
+
+            std::unique_ptr<AssetDumpManifest> dumpManifest;
+            const auto dumpManifestPath = fs::path(outputFolderPath) / std::format("{}.dump_manifest", zone->m_name);
+            if (m_args.m_incremental)
+            {
+                dumpManifest = CreateDumpManifest(zone);
+                dumpManifest->Load(dumpManifestPath);
+                context.m_dump_manifest = dumpManifest.get();
             }
 
             UpdateAssetIncludesAndExcludes(context);
-            ObjWriting::DumpZone(context);
+            if (!m_args.m_asset_name_filter.IsEmpty())
+                context.m_asset_name_filter = &m_args.m_asset_name_filter;
 
-            if (m_args.m_use_gdt)
+            // Dumpers that do not check every asset on their own are skipped entirely when no asset of their type is reachable
+            if (assetClosure)
+            {
+                context.m_asset_closure = assetClosure;
+                for (auto assetType = 0u; assetType < context.m_asset_types_to_handle.size(); assetType++)
+                {
+                    context.m_asset_types_to_handle[assetType] =
+                        context.m_asset_types_to_handle[assetType] && assetClosure->ContainsAssetType(static_cast<asset_type_t>(assetType));
+                }
+            }
+
+            // The zone definition only reads the asset names of the zone, so it is written while the assets are dumped
+            auto zoneDefinitionWritten = std::async(std::launch::async,
+                                                    [this, zone, &context]
+                                                    {
+                                                        return WriteZoneDefinitionFile(zone, context);
+                                                    });
+            const auto dumpSucceeded = ObjWriting::DumpZone(context);
+            if (!zoneDefinitionWritten.get())
+                return false;
+
+            benchmarkPhase.AddBytesWritten(context.GetWrittenByteCount());
+
+            // A manifest of a failed dump would mark assets as dumped that might not have been written
+            if (dumpManifest && dumpSucceeded)
+            {
+                dumpManifest->Save(dumpManifestPath);
+                dumpManifest->PrintSummary(std::cout);
+            }
+
+            if (m_args.m_use_gdt && !WriteGdtFile(zone, context))
+                return false;
+
+            if (!context.CloseArchive())
             {
-                context.m_gdt->EndStream();
-                gdtStream.close();
+                printf("Failed to write archive of zone \"%s\".\n", zone->m_name.c_str());
+                return false;
             }
         }
 
         return true;
     }
 
+    void PrintPeakMemoryUsage(const char* phase) const
+    {
+        if (m_args.m_verbose)
+            printf("Peak memory usage after %s: %.1f MiB\n", phase, static_cast<double>(process_memory::GetPeakUsage()) / (1024.0 * 1024.0));
+    }
+
+    /**
+     * \brief Loads a zone and measures it as the zone load phase when benchmarking.
+     */
+    std::unique_ptr<Zone> LoadZone(const std::string& zonePath) const
+    {
+        benchmarking::ScopedPhase benchmarkPhase(m_benchmark_report.get(), "zone load");
+        auto zone = ZoneLoading::LoadZone(zonePath);
+        if (zone)
+        {
+            std::error_code ec;
+            const auto zoneFileSize = fs::file_size(zonePath, ec);
+            benchmarkPhase.AddBytesRead(ec ? 0u : zoneFileSize);
+            benchmarkPhase.AddAssets(zone->m_pools->GetTotalAssetCount());
+
+            // The index is only valid for this exact zone file so it is kept next to it
+            if (zone->m_asset_offset_index)
+            {
+                const auto indexPath = fs::path(zonePath).replace_extension(".asset_offsets");
+                if (!zone->m_asset_offset_index->Save(indexPath))
+                    std::cerr << std::format("Failed to write asset offset index \"{}\"\n", indexPath.string());
+            }
+        }
+
+        return zone;
+    }
+
+    /**
+     * \brief Loads the obj data of a zone and measures it as the obj load phase when benchmarking.
+     */
+    void LoadObjDataForZone(ISearchPath* searchPath, Zone* zone, const AssetClosure* assetClosure = nullptr) const
+    {
+        benchmarking::ScopedPhase benchmarkPhase(m_benchmark_report.get(), "obj load");
+        // Containers and obj data of asset types that are not dumped are never used
+        auto assetTypesToLoad = GetAssetTypesToHandle(zone);
+        if (assetClosure)
+        {
+            for (auto assetType = 0u; assetType < assetTypesToLoad.size(); assetType++)
+                assetTypesToLoad[assetType] = assetTypesToLoad[assetType] && assetClosure->ContainsAssetType(static_cast<asset_type_t>(assetType));
+        }
+
+        ObjLoading::LoadReferencedContainersForZone(searchPath, zone, assetTypesToLoad);
+        ObjLoading::LoadObjDataForZone(searchPath, zone, assetTypesToLoad);
+    }
+
     bool LoadZones()
     {
+        std::vector<std::string> zonePaths;
         for (const auto& zonePath : m_args.m_zones_to_load)
         {
             if (!fs::is_regular_file(zonePath))
@@ -322,18 +512,50 @@ class Unlinker::Impl
                 continue;
             }
 
-            auto absoluteZoneDirectory = absolute(std::filesystem::path(zonePath).remove_filename()).string();
+            zonePaths.emplace_back(zonePath);
+        }
 
-            auto searchPathsForZone = GetSearchPathsForZone(absoluteZoneDirectory);
-            searchPathsForZone.IncludeSearchPath(&m_search_paths);
+        // Zones are loaded at once but registered and linked into the global asset pools in the order they were specified,
+        // so assets that exist in multiple zones are resolved the same way as when loading them one after another
+        std::vector<std::unique_ptr<Zone>> zones(zonePaths.size());
+        {
+            const auto linkBatch = GlobalAssetPoolLinkOrder::BeginBatch();
+            ZoneLoading::Configuration.RegisterLoadedZones = false;
 
-            auto zone = ZoneLoading::LoadZone(zonePath);
+            JobSystem::TaskGroup loadJobs;
+            for (auto i = 0u; i < zonePaths.size(); i++)
+            {
+                loadJobs.Run(
+                    [this, &zonePaths, &zones, linkBatch, i]
+                    {
+                        const GlobalAssetPoolLinkOrder::BatchScope linkOrder(linkBatch, i);
+
+                        try
+                        {
+                            zones[i] = LoadZone(zonePaths[i]);
+                        }
+                        catch (std::exception& e)
+                        {
+                            std::cerr << "Failed to load zone \"" << zonePaths[i] << "\": " << e.what() << "\n";
+                        }
+                    });
+            }
+
+            loadJobs.Wait();
+            ZoneLoading::Configuration.RegisterLoadedZones = true;
+        }
+
+        for (auto i = 0u; i < zonePaths.size(); i++)
+        {
+            auto& zone = zones[i];
             if (zone == nullptr)
             {
-                printf("Failed to load zone \"%s\".\n", zonePath.c_str());
+                printf("Failed to load zone \"%s\".\n", zonePaths[i].c_str());
                 return false;
             }
 
+            zone->Register();
+
             if (m_args.m_verbose)
             {
                 printf("Loaded zone \"%s\"\n", zone->m_name.c_str());
@@ -341,8 +563,12 @@ class Unlinker::Impl
 
             if (ShouldLoadObj())
             {
-                ObjLoading::LoadReferencedContainersForZone(&searchPathsForZone, zone.get());
-                ObjLoading::LoadObjDataForZone(&searchPathsForZone, zone.get());
+                auto absoluteZoneDirectory = absolute(std::filesystem::path(zonePaths[i]).remove_filename()).string();
+
+                auto searchPathsForZone = GetSearchPathsForZone(absoluteZoneDirectory);
+                searchPathsForZone.IncludeSearchPath(&m_search_paths);
+
+                LoadObjDataForZone(&searchPathsForZone, zone.get());
             }
 
             m_loaded_zones.emplace_back(std::move(zone));
@@ -371,15 +597,26 @@ class Unlinker::Impl
         m_loaded_zones.clear();
     }
 
-    bool UnlinkZones()
+    /**
+     * \brief Loads, handles and unloads a single zone.
+     * Everything touching state that is shared between zones is done while holding the shared state lock so multiple zones can be unlinked at once.
+     * \param zonePath The path of the zone to unlink.
+     * \return \c true if unlinking the zone was successful, otherwise \c false.
+     */
+    bool UnlinkZone(const std::string& zonePath)
     {
-        for (const auto& zonePath : m_args.m_zones_to_unlink)
+        if (!fs::is_regular_file(zonePath))
         {
-            if (!fs::is_regular_file(zonePath))
-            {
-                printf("Could not find file \"%s\".\n", zonePath.c_str());
-                continue;
-            }
+            printf("Could not find file \"%s\".\n", zonePath.c_str());
+            return true;
+        }
+
+        std::unique_ptr<Zone> zone;
+        std::unique_ptr<AssetClosure> assetClosure;
+        std::string zoneName;
+
+        {
+            std::lock_guard lock(m_shared_state_mutex);
 
             auto zoneDirectory = fs::path(zonePath).remove_filename();
             if (zoneDirectory.empty())
@@ -389,8 +626,7 @@ class Unlinker::Impl
             auto searchPathsForZone = GetSearchPathsForZone(absoluteZoneDirectory);
             searchPathsForZone.IncludeSearchPath(&m_search_paths);
 
-            std::string zoneName;
-            auto zone = ZoneLoading::LoadZone(zonePath);
+            zone = LoadZone(zonePath);
             if (zone == nullptr)
             {
                 printf("Failed to load zone \"%s\".\n", zonePath.c_str());
@@ -401,23 +637,184 @@ class Unlinker::Impl
             if (m_args.m_verbose)
                 std::cout << "Loaded zone \"" << zoneName << "\"\n";
 
+            assetClosure = CreateAssetClosure(zone.get());
             if (ShouldLoadObj())
-            {
-                ObjLoading::LoadReferencedContainersForZone(&searchPathsForZone, zone.get());
-                ObjLoading::LoadObjDataForZone(&searchPathsForZone, zone.get());
-            }
+                LoadObjDataForZone(&searchPathsForZone, zone.get(), assetClosure.get());
+        }
 
-            if (!HandleZone(zone.get()))
-                return false;
+        const auto result = HandleZone(zone.get(), assetClosure.get());
+
+        {
+            std::lock_guard lock(m_shared_state_mutex);
 
             if (ShouldLoadObj())
                 ObjLoading::UnloadContainersOfZone(zone.get());
 
             zone.reset();
-            if (m_args.m_verbose)
-                std::cout << "Unloaded zone \"" << zoneName << "\"\n";
         }
 
+        if (m_args.m_verbose)
+            std::cout << "Unloaded zone \"" << zoneName << "\"\n";
+
+        return result;
+    }
+
+    /**
+     * \brief Checks whether this instance is responsible for unlinking a zone when sharing zones with other instances.
+     * \param zonePath The path of the zone as specified on the command line.
+     * \return \c CLAIMED if the zone should be unlinked by this instance, \c CLAIMED_BY_OTHER if another instance unlinks it
+     * or \c FAILED if it could not be claimed.
+     */
+    _NODISCARD WorkClaims::ClaimResult ClaimZone(const std::string& zonePath) const
+    {
+        if (!m_work_claims)
+            return WorkClaims::ClaimResult::CLAIMED;
+
+        std::error_code ec;
+        const auto result = m_work_claims->Claim(zonePath, ec);
+        if (result == WorkClaims::ClaimResult::CLAIMED_BY_OTHER && m_args.m_verbose)
+            std::cout << "Zone \"" << zonePath << "\" was claimed by another instance\n";
+        else if (result == WorkClaims::ClaimResult::FAILED)
+            std::cerr << "Failed to claim zone \"" << zonePath << "\": " << ec.message() << "\n";
+
+        return result;
+    }
+
+    /**
+     * \brief Reads the block sizes of a zone without loading it to know how much memory unlinking it takes.
+     * Blocks that are not loaded from the zone stay reserved without taking physical memory, so they are not counted.
+     * \param zonePath The path of the zone.
+     * \return The amount of bytes the blocks of the zone take or the whole memory budget if the zone could not be probed, which unlinks it on its own.
+     */
+    _NODISCARD size_t GetZoneMemorySize(const std::string& zonePath) const
+    {
+        ZoneProbe probe;
+        if (!fs::is_regular_file(zonePath) || !ZoneLoading::ProbeZone(zonePath, probe))
+            return m_args.m_memory_budget;
+
+        size_t memorySize = 0u;
+        for (const auto& block : probe.m_blocks)
+        {
+            if (block.m_type == XBlock::Type::BLOCK_TYPE_NORMAL || block.m_type == XBlock::Type::BLOCK_TYPE_TEMP)
+                memorySize += block.m_size;
+        }
+
+        if (m_args.m_verbose)
+            std::cout << std::format("Zone \"{}\" needs {} KB of block memory\n", zonePath, memorySize / 1024u);
+
+        return memorySize;
+    }
+
+    bool UnlinkZones()
+    {
+        if (m_args.m_job_count <= 1u || m_args.m_zones_to_unlink.size() <= 1u)
+        {
+            for (const auto& zonePath : m_args.m_zones_to_unlink)
+            {
+                const auto claimResult = ClaimZone(zonePath);
+                if (claimResult == WorkClaims::ClaimResult::FAILED)
+                    return false;
+                if (claimResult == WorkClaims::ClaimResult::CLAIMED_BY_OTHER)
+                    continue;
+
+                if (!UnlinkZone(zonePath))
+                    return false;
+            }
+
+            return true;
+        }
+
+        // Block sizes are only known once the header of a zone was read, so all zones are probed before any of them is started
+        std::unique_ptr<MemoryBudget> memoryBudget;
+        std::vector<size_t> zoneMemorySizes;
+        if (m_args.m_memory_budget > 0u)
+        {
+            memoryBudget = std::make_unique<MemoryBudget>(m_args.m_memory_budget);
+            zoneMemorySizes.reserve(m_args.m_zones_to_unlink.size());
+            for (const auto& zonePath : m_args.m_zones_to_unlink)
+                zoneMemorySizes.emplace_back(GetZoneMemorySize(zonePath));
+        }
+
+        // Zones are started in order and no new zones are started after one failed, same as when unlinking them one after another
+        std::atomic_bool failed = false;
+        {
+            ThreadPool jobs(std::min<size_t>(m_args.m_job_count, m_args.m_zones_to_unlink.size()));
+            for (auto zoneIndex = 0u; zoneIndex < m_args.m_zones_to_unlink.size(); zoneIndex++)
+            {
+                jobs.Enqueue(
+                    [this, zoneIndex, &memoryBudget, &zoneMemorySizes, &failed]
+                    {
+                        const auto& zonePath = m_args.m_zones_to_unlink[zoneIndex];
+
+                        // Zones are claimed when a job starts working on them so idle instances take over the zones that are left
+                        if (failed)
+                            return;
+
+                        const auto claimResult = ClaimZone(zonePath);
+                        if (claimResult == WorkClaims::ClaimResult::FAILED)
+                            failed = true;
+                        if (claimResult != WorkClaims::ClaimResult::CLAIMED)
+                            return;
+
+                        std::optional<MemoryBudget::Reservation> memoryReservation;
+                        if (memoryBudget)
+                        {
+                            memoryReservation.emplace(*memoryBudget, zoneMemorySizes[zoneIndex]);
+                            if (failed)
+                                return;
+                        }
+
+                        try
+                        {
+                            if (!UnlinkZone(zonePath))
+                                failed = true;
+                        }
+                        catch (std::exception& e)
+                        {
+                            std::cerr << "Failed to unlink zone \"" << zonePath << "\": " << e.what() << "\n";
+                            failed = true;
+                        }
+                    });
+            }
+
+            jobs.WaitForIdle();
+        }
+
+        return !failed;
+    }
+
+    /**
+     * \brief Loads the two zones to unlink and prints which assets of the second zone were added, removed or changed compared to the first one.
+     * \return \c true if both zones could be loaded, otherwise \c false.
+     */
+    bool DiffZones() const
+    {
+        assert(m_args.m_zones_to_unlink.size() == 2u);
+
+        std::unique_ptr<Zone> zones[2];
+        for (auto i = 0u; i < std::extent_v<decltype(zones)>; i++)
+        {
+            const auto& zonePath = m_args.m_zones_to_unlink[i];
+            if (!fs::is_regular_file(zonePath))
+            {
+                printf("Could not find file \"%s\".\n", zonePath.c_str());
+                return false;
+            }
+
+            zones[i] = LoadZone(zonePath);
+            if (zones[i] == nullptr)
+            {
+                printf("Failed to load zone \"%s\".\n", zonePath.c_str());
+                return false;
+            }
+        }
+
+        benchmarking::ScopedPhase benchmarkPhase(m_benchmark_report.get(), "diff");
+        benchmarkPhase.AddAssets(zones[0]->m_pools->GetTotalAssetCount() + zones[1]->m_pools->GetTotalAssetCount());
+
+        const ZoneDiff diff(*zones[0], *zones[1]);
+        diff.Print(std::cout);
+
         return true;
     }
 
@@ -427,6 +824,30 @@ public:
         m_last_zone_search_path = nullptr;
     }
 
+    bool CreateProgressReporter()
+    {
+        if (m_args.m_progress_format.empty())
+            return true;
+
+        std::ostream* stream = &std::cerr;
+        if (!m_args.m_progress_file.empty())
+        {
+            m_progress_stream.open(m_args.m_progress_file, std::fstream::out | std::fstream::binary);
+            if (!m_progress_stream.is_open())
+            {
+                printf("Could not open progress file \"%s\"\n", m_args.m_progress_file.c_str());
+                return false;
+            }
+            stream = &m_progress_stream;
+        }
+
+        m_progress_reporter = progress::CreateProgressReporter(m_args.m_progress_format, *stream);
+        ZoneLoading::Configuration.ProgressReporter = m_progress_reporter.get();
+        ObjWriting::Configuration.ProgressReporter = m_progress_reporter.get();
+
+        return true;
+    }
+
     /**
      * \copydoc Unlinker::Start
      */
@@ -439,15 +860,93 @@ public:
         if (!shouldContinue)
             return true;
 
-        if (!BuildSearchPaths())
+        if (!m_args.m_trace_file.empty())
+            tracing::Tracer::Instance.Enable();
+
+        // Listing and dumping never write to runtime blocks, so they can stay reserved without taking physical memory
+        ZoneLoading::Configuration.ReserveUnloadedBlocks = true;
+        if (m_args.m_large_pages)
+        {
+            m_xblock_allocator = std::make_unique<VirtualXBlockAllocator>(true);
+            ZoneLoading::Configuration.XBlockAllocator = m_xblock_allocator.get();
+        }
+
+        if (!CreateProgressReporter())
             return false;
 
-        if (!LoadZones())
+        if (!BuildSearchPaths())
             return false;
 
-        const auto result = UnlinkZones();
+        if (!m_args.m_work_claims_folder.empty())
+        {
+            m_work_claims = std::make_unique<WorkClaims>(m_args.m_work_claims_folder);
+            if (!m_work_claims->IsUsable())
+            {
+                printf("Could not create work claim folder \"%s\"\n", m_args.m_work_claims_folder.c_str());
+                return false;
+            }
+        }
+
+        // A missing or outdated shader cache is not an error, all shaders are simply analysed again
+        if (!m_args.m_shader_cache_file.empty())
+            ShaderInfoCache::Instance.Load(m_args.m_shader_cache_file);
+
+        if (m_args.m_benchmark_run_count > 0u)
+            m_benchmark_report = std::make_unique<benchmarking::BenchmarkReport>("Unlinker");
+
+        // Without benchmarking all tasks are only run once
+        const auto runCount = std::max(m_args.m_benchmark_run_count, 1u);
+        auto result = true;
+        for (auto run = 0u; result && run < runCount; run++)
+        {
+            if (m_benchmark_report)
+                m_benchmark_report->BeginRun(run);
+
+            if (!LoadZones())
+                return false;
+
+            PrintPeakMemoryUsage("loading zones");
+
+            // Every run starts without a cache so benchmark runs all dump the same amount of images
+            if (m_args.m_deduplicate_images && m_args.m_task == UnlinkerArgs::ProcessingTask::DUMP)
+            {
+                m_image_dump_cache = std::make_unique<ImageDumpCache>(m_args.m_hardlink_images);
+                ObjWriting::Configuration.DumpedImageCache = m_image_dump_cache.get();
+            }
+
+            result = m_args.m_task == UnlinkerArgs::ProcessingTask::DIFF ? DiffZones() : UnlinkZones();
+            PrintPeakMemoryUsage("unlinking zones");
+
+            if (m_image_dump_cache)
+            {
+                if (m_args.m_verbose)
+                    m_image_dump_cache->PrintSummary(std::cout);
+
+                ObjWriting::Configuration.DumpedImageCache = nullptr;
+                m_image_dump_cache.reset();
+            }
+
+            UnloadZones();
+        }
+
+        if (!m_args.m_shader_cache_file.empty() && !ShaderInfoCache::Instance.Save(m_args.m_shader_cache_file))
+            std::cerr << "Failed to save shader cache \"" << m_args.m_shader_cache_file << "\"\n";
+
+        if (m_benchmark_report)
+        {
+            std::cout << "Benchmark of " << runCount << " runs:\n";
+            m_benchmark_report->PrintSummary(std::cout);
+            if (!m_args.m_benchmark_json_file.empty() && !m_benchmark_report->WriteJson(m_args.m_benchmark_json_file))
+                std::cerr << "Failed to write benchmark results \"" << m_args.m_benchmark_json_file << "\"\n";
+        }
+
+        if (!m_args.m_trace_file.empty())
+        {
+            tracing::Tracer::Instance.PrintSummary(std::cout);
+            if (!tracing::Tracer::Instance.WriteChromeTrace(m_args.m_trace_file))
+                std::cerr << "Failed to write trace \"" << m_args.m_trace_file << "\"\n";
+        }
 
-        UnloadZones();
         return result;
     }
 };
@@ -5,10 +5,11 @@
 #include "ObjWriting.h"
 #include "Utils/Arguments/UsageInformation.h"
 #include "Utils/FileUtils.h"
+#include "Utils/JobSystem.h"
 #include "Utils/StringUtils.h"
+#include "ZoneLoading.h"
 
 #include <iostream>
-#include <regex>
 #include <type_traits>
 
 // clang-format off
@@ -54,6 +55,21 @@ const CommandLineOption* const OPTION_LIST =
     .WithDescription("Lists the contents of a zone instead of writing them to the disk.")
     .Build();
 
+const CommandLineOption* const OPTION_DIFF =
+    CommandLineOption::Builder::Create()
+    .WithLongName("diff")
+    .WithDescription("Compares the assets of two zones instead of writing them to the disk and lists the assets that were added, removed or changed "
+                        "in the second zone. Assets are compared by hashes of the zone data they were loaded from, leaving out offsets of pointers.")
+    .Build();
+
+const CommandLineOption* const OPTION_LIST_FORMAT =
+    CommandLineOption::Builder::Create()
+    .WithLongName("list-format")
+    .WithDescription("Specifies the format that --list prints the contents of zones in. Valid formats are: text, csv, json. "
+                        "The json format writes one object per line for other programs to read.")
+    .WithParameter("format")
+    .Build();
+
 const CommandLineOption* const OPTION_OUTPUT_FOLDER =
     CommandLineOption::Builder::Create()
     .WithShortName("o")
@@ -84,6 +100,51 @@ const CommandLineOption* const OPTION_MODEL_FORMAT =
     .WithParameter("modelFormatValue")
     .Build();
 
+const CommandLineOption* const OPTION_WELD_VERTICES =
+    CommandLineOption::Builder::Create()
+    .WithLongName("weld-vertices")
+    .WithDescription("Merges identical vertices of dumped models to reduce the size of the model files.")
+    .Build();
+
+const CommandLineOption* const OPTION_DEDUPLICATE_IMAGES =
+    CommandLineOption::Builder::Create()
+    .WithLongName("deduplicate-images")
+    .WithDescription("Skips writing images that another zone of this session already dumped to the same file with identical contents.")
+    .Build();
+
+const CommandLineOption* const OPTION_HARDLINK_IMAGES =
+    CommandLineOption::Builder::Create()
+    .WithLongName("hardlink-images")
+    .WithDescription("Creates hard links to images that another zone of this session already dumped with identical contents instead of writing them again. "
+                        "Implies --deduplicate-images.")
+    .Build();
+
+const CommandLineOption* const OPTION_PRELOAD_IMAGES =
+    CommandLineOption::Builder::Create()
+    .WithLongName("preload-images")
+    .WithDescription("Loads the data of all images streamed from ipaks when loading a zone instead of loading each image only while dumping it.")
+    .Build();
+
+const CommandLineOption* const OPTION_ARCHIVE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("archive")
+    .WithDescription("Writes the dumped files of every zone into a zip archive next to where its output folder would be instead of writing loose files. "
+                        "The output folder must contain ?zone? when unlinking multiple zones.")
+    .Build();
+
+const CommandLineOption* const OPTION_INCREMENTAL =
+    CommandLineOption::Builder::Create()
+    .WithLongName("incremental")
+    .WithDescription("Writes a manifest of the dumped assets into the output folder of every zone and skips assets that did not change since the last dump. "
+                        "Delete the manifest to dump all assets again when dumped files were modified or removed.")
+    .Build();
+
+const CommandLineOption* const OPTION_ASSET_OFFSET_INDEX =
+    CommandLineOption::Builder::Create()
+    .WithLongName("asset-offset-index")
+    .WithDescription("Writes an index of where the data of every asset is located in the inflated zone content next to every loaded zone file.")
+    .Build();
+
 const CommandLineOption* const OPTION_SKIP_OBJ =
     CommandLineOption::Builder::Create()
     .WithLongName("skip-obj")
@@ -112,12 +173,176 @@ const CommandLineOption* const OPTION_INCLUDE_ASSETS =
     .Reusable()
     .Build();
 
+const CommandLineOption* const OPTION_INCLUDE_ASSET_NAMES =
+    CommandLineOption::Builder::Create()
+    .WithLongName("include-asset-names")
+    .WithDescription("Specify a comma separated list of asset names that should be dumped. Names can contain the wildcards * and ?.")
+    .WithParameter("assetNameList")
+    .Reusable()
+    .Build();
+
+const CommandLineOption* const OPTION_EXCLUDE_ASSET_NAMES =
+    CommandLineOption::Builder::Create()
+    .WithLongName("exclude-asset-names")
+    .WithDescription("Specify a comma separated list of asset names that should not be dumped. Names can contain the wildcards * and ?.")
+    .WithParameter("assetNameList")
+    .Reusable()
+    .Build();
+
+const CommandLineOption* const OPTION_ASSET_ROOT =
+    CommandLineOption::Builder::Create()
+    .WithLongName("asset-root")
+    .WithDescription("Only dumps the specified asset and all assets it depends on. The asset type can be left out to use assets of all types with the name. "
+                        "Containers like ipaks and sound banks are only loaded when assets of their type are dumped.")
+    .WithParameter("[assetType:]assetName")
+    .Reusable()
+    .Build();
+
 const CommandLineOption* const OPTION_LEGACY_MENUS =
     CommandLineOption::Builder::Create()
     .WithLongName("legacy-menus")
     .WithDescription("Dumps menus with a compatibility mode to work with applications not compatible with the newer dumping mode.")
     .Build();
 
+const CommandLineOption* const OPTION_LOAD_WORKERS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("load-workers")
+    .WithDescription("Specifies the amount of worker threads that decode fastfile chunks. Defaults to one per stream.")
+    .WithParameter("workerCount")
+    .Build();
+
+const CommandLineOption* const OPTION_AUTHED_BLOCK_WORKERS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("authed-block-workers")
+    .WithDescription("Specifies the amount of worker threads that verify authed fastfile chunks ahead of time. By default chunks are verified while loading.")
+    .WithParameter("workerCount")
+    .Build();
+
+const CommandLineOption* const OPTION_TRUSTED_INPUT =
+    CommandLineOption::Builder::Create()
+    .WithLongName("trusted-input")
+    .WithDescription("Skips verifying the signatures of signed fastfiles and the hashes of authed fastfile chunks. "
+                        "Only use this for fastfiles that are known to be intact.")
+    .Build();
+
+const CommandLineOption* const OPTION_LARGE_PAGES =
+    CommandLineOption::Builder::Create()
+    .WithLongName("large-pages")
+    .WithDescription("Backs the memory blocks of loaded zones with large pages if the system provides them to reduce TLB misses on big zones. "
+                        "Depending on the system, large pages are backed by physical memory right away.")
+    .Build();
+
+const CommandLineOption* const OPTION_DUMP_WORKERS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("dump-workers")
+    .WithDescription("Specifies the amount of worker threads that dump independent assets in parallel. Defaults to 1.")
+    .WithParameter("workerCount")
+    .Build();
+
+const CommandLineOption* const OPTION_MODEL_FORMAT_WORKERS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("model-format-workers")
+    .WithDescription("Specifies the amount of worker threads that format the vertices and faces of large models when dumping them as text. Defaults to 1.")
+    .WithParameter("workerCount")
+    .Build();
+
+const CommandLineOption* const OPTION_IMAGE_LOAD_WORKERS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("image-load-workers")
+    .WithDescription("Specifies the amount of worker threads that read and decode image files when loading the obj data of a zone. Defaults to 4.")
+    .WithParameter("workerCount")
+    .Build();
+
+const CommandLineOption* const OPTION_ASYNC_WRITES =
+    CommandLineOption::Builder::Create()
+    .WithLongName("async-writes")
+    .WithDescription("Buffers dumped files in memory and writes them in batches on a background thread. Speeds up dumping many small files.")
+    .Build();
+
+const CommandLineOption* const OPTION_JOBS =
+    CommandLineOption::Builder::Create()
+    .WithShortName("j")
+    .WithLongName("jobs")
+    .WithDescription("Specifies the amount of zones that are unlinked at the same time. Defaults to 1.")
+    .WithParameter("jobCount")
+    .Build();
+
+const CommandLineOption* const OPTION_MEMORY_BUDGET =
+    CommandLineOption::Builder::Create()
+    .WithLongName("memory-budget")
+    .WithDescription("Specifies the amount of megabytes the blocks of zones that are unlinked at the same time may use when using multiple jobs. "
+                        "Zones are only started while the sum of their block sizes fits into the budget. Defaults to no limit.")
+    .WithParameter("megabytes")
+    .Build();
+
+const CommandLineOption* const OPTION_THREADS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("threads")
+    .WithDescription("Specifies the amount of threads of the job system that all parallel features of a run share. Defaults to one per hardware thread.")
+    .WithParameter("threadCount")
+    .Build();
+
+const CommandLineOption* const OPTION_WORK_CLAIMS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("work-claims")
+    .WithDescription("Shares the specified zones with other Unlinker instances that use the same claim folder, for example on a network share. "
+                        "Each zone is only unlinked by the instance that claims it first. All instances must be started with the same zone paths "
+                        "and the folder must not contain claims of earlier runs.")
+    .WithParameter("claimFolder")
+    .Build();
+
+const CommandLineOption* const OPTION_IPAK_CACHE_SIZE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("ipak-cache-size")
+    .WithDescription("Specifies the amount of megabytes of chunk data each ipak keeps cached. Use 0 to disable caching. Defaults to 32.")
+    .WithParameter("megabytes")
+    .Build();
+
+const CommandLineOption* const OPTION_SHADER_CACHE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("shader-cache")
+    .WithDescription("Specifies a file to keep the analysed info of shaders in to not analyse the same shaders again in later runs.")
+    .WithParameter("cacheFile")
+    .Build();
+
+const CommandLineOption* const OPTION_TRACE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("trace")
+    .WithDescription("Records how long loading, unlinking and dumping zones takes and writes it to the specified file in the Chrome trace format. "
+                        "Also prints a summary of the recorded times.")
+    .WithParameter("traceFile")
+    .Build();
+
+const CommandLineOption* const OPTION_BENCHMARK =
+    CommandLineOption::Builder::Create()
+    .WithLongName("benchmark")
+    .WithDescription("Loads, unlinks and dumps all specified zones the specified amount of times. "
+                        "Prints the wall time, cpu time and throughput of each phase.")
+    .WithParameter("runCount")
+    .Build();
+
+const CommandLineOption* const OPTION_BENCHMARK_JSON =
+    CommandLineOption::Builder::Create()
+    .WithLongName("benchmark-json")
+    .WithDescription("Writes the measurements of --benchmark to the specified file as json.")
+    .WithParameter("jsonFile")
+    .Build();
+
+const CommandLineOption* const OPTION_PROGRESS =
+    CommandLineOption::Builder::Create()
+    .WithLongName("progress")
+    .WithDescription("Reports the progress of loading and dumping zones in the specified format. Valid formats are: text, json. "
+                        "The json format writes one object per line for other programs to read.")
+    .WithParameter("format")
+    .Build();
+
+const CommandLineOption* const OPTION_PROGRESS_FILE =
+    CommandLineOption::Builder::Create()
+    .WithLongName("progress-file")
+    .WithDescription("Writes the progress of --progress to the specified file instead of stderr.")
+    .WithParameter("progressFile")
+    .Build();
+
 // clang-format on
 
 const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
@@ -127,25 +352,65 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_MINIMAL_ZONE_FILE,
     OPTION_LOAD,
     OPTION_LIST,
+    OPTION_DIFF,
+    OPTION_LIST_FORMAT,
     OPTION_OUTPUT_FOLDER,
     OPTION_SEARCH_PATH,
     OPTION_IMAGE_FORMAT,
     OPTION_MODEL_FORMAT,
+    OPTION_WELD_VERTICES,
+    OPTION_DEDUPLICATE_IMAGES,
+    OPTION_HARDLINK_IMAGES,
+    OPTION_PRELOAD_IMAGES,
+    OPTION_ARCHIVE,
+    OPTION_INCREMENTAL,
+    OPTION_ASSET_OFFSET_INDEX,
     OPTION_SKIP_OBJ,
     OPTION_GDT,
     OPTION_EXCLUDE_ASSETS,
     OPTION_INCLUDE_ASSETS,
+    OPTION_INCLUDE_ASSET_NAMES,
+    OPTION_EXCLUDE_ASSET_NAMES,
+    OPTION_ASSET_ROOT,
     OPTION_LEGACY_MENUS,
+    OPTION_LOAD_WORKERS,
+    OPTION_AUTHED_BLOCK_WORKERS,
+    OPTION_TRUSTED_INPUT,
+    OPTION_LARGE_PAGES,
+    OPTION_DUMP_WORKERS,
+    OPTION_MODEL_FORMAT_WORKERS,
+    OPTION_IMAGE_LOAD_WORKERS,
+    OPTION_ASYNC_WRITES,
+    OPTION_JOBS,
+    OPTION_MEMORY_BUDGET,
+    OPTION_THREADS,
+    OPTION_WORK_CLAIMS,
+    OPTION_IPAK_CACHE_SIZE,
+    OPTION_SHADER_CACHE,
+    OPTION_TRACE,
+    OPTION_BENCHMARK,
+    OPTION_BENCHMARK_JSON,
+    OPTION_PROGRESS,
+    OPTION_PROGRESS_FILE,
 };
 
 UnlinkerArgs::UnlinkerArgs()
     : m_argument_parser(COMMAND_LINE_OPTIONS, std::extent_v<decltype(COMMAND_LINE_OPTIONS)>),
-      m_zone_pattern(R"(\?zone\?)"),
       m_task(ProcessingTask::DUMP),
+      m_list_format(ContentPrinter::Format::TEXT),
       m_minimal_zone_def(false),
       m_asset_type_handling(AssetTypeHandling::EXCLUDE),
+      m_deduplicate_images(false),
+      m_hardlink_images(false),
+      m_archive(false),
+      m_incremental(false),
+      m_asset_offset_index(false),
       m_skip_obj(false),
+      m_large_pages(false),
       m_use_gdt(false),
+      m_job_count(1u),
+      m_memory_budget(0u),
+      m_benchmark_run_count(0u),
       m_verbose(false)
 {
 }
@@ -233,6 +498,105 @@ bool UnlinkerArgs::SetModelDumpingMode()
     return false;
 }
 
+bool UnlinkerArgs::SetIPakCacheSize()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_IPAK_CACHE_SIZE);
+
+    char* endPtr;
+    const auto megabytes = strtoull(specifiedValue.c_str(), &endPtr, 10);
+    if (specifiedValue.empty() || *endPtr != '\0' || megabytes > SIZE_MAX / 0x100000)
+    {
+        printf("Illegal value: \"%s\" is not a valid cache size. Use -? to see usage information.\n", specifiedValue.c_str());
+        return false;
+    }
+
+    ObjLoading::Configuration.IPakChunkCacheSize = static_cast<size_t>(megabytes) * 0x100000;
+    return true;
+}
+
+bool UnlinkerArgs::ParseMemoryBudget()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_MEMORY_BUDGET);
+
+    char* endPtr;
+    const auto megabytes = strtoull(specifiedValue.c_str(), &endPtr, 10);
+    if (specifiedValue.empty() || *endPtr != '\0' || megabytes == 0u || megabytes > SIZE_MAX / 0x100000)
+    {
+        printf("Illegal value: \"%s\" is not a valid memory budget. Use -? to see usage information.\n", specifiedValue.c_str());
+        return false;
+    }
+
+    m_memory_budget = static_cast<size_t>(megabytes) * 0x100000;
+    return true;
+}
+
+bool UnlinkerArgs::ParseWorkerCount(const CommandLineOption* option, unsigned& workerCount)
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(option);
+
+    char* endPtr;
+    const auto parsedValue = strtoul(specifiedValue.c_str(), &endPtr, 10);
+    if (specifiedValue.empty() || *endPtr != '\0' || parsedValue == 0u)
+    {
+        printf("Illegal value: \"%s\" is not a valid worker count. Use -? to see usage information.\n", specifiedValue.c_str());
+        return false;
+    }
+
+    workerCount = static_cast<unsigned>(parsedValue);
+    return true;
+}
+
+bool UnlinkerArgs::ParseListFormat()
+{
+    auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_LIST_FORMAT);
+    utils::MakeStringLowerCase(specifiedValue);
+
+    if (specifiedValue == "text")
+        m_list_format = ContentPrinter::Format::TEXT;
+    else if (specifiedValue == "csv")
+        m_list_format = ContentPrinter::Format::CSV;
+    else if (specifiedValue == "json")
+        m_list_format = ContentPrinter::Format::JSON;
+    else
+    {
+        printf("Illegal value: \"%s\" is not a valid list format. Use -? to see usage information.\n", specifiedValue.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool UnlinkerArgs::ParseProgressFormat()
+{
+    auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_PROGRESS);
+    utils::MakeStringLowerCase(specifiedValue);
+
+    if (specifiedValue == "text" || specifiedValue == "json")
+    {
+        m_progress_format = std::move(specifiedValue);
+        return true;
+    }
+
+    printf("Illegal value: \"%s\" is not a valid progress format. Use -? to see usage information.\n", specifiedValue.c_str());
+    return false;
+}
+
+bool UnlinkerArgs::ParseBenchmarkRunCount()
+{
+    const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_BENCHMARK);
+
+    char* endPtr;
+    const auto parsedValue = strtoul(specifiedValue.c_str(), &endPtr, 10);
+    if (specifiedValue.empty() || *endPtr != '\0' || parsedValue == 0u)
+    {
+        printf("Illegal value: \"%s\" is not a valid run count. Use -? to see usage information.\n", specifiedValue.c_str());
+        return false;
+    }
+
+    m_benchmark_run_count = static_cast<unsigned>(parsedValue);
+    return true;
+}
+
 void UnlinkerArgs::AddSpecifiedAssetType(std::string value)
 {
     const auto alreadySpecifiedAssetType = m_specified_asset_type_map.find(value);
@@ -261,6 +625,46 @@ void UnlinkerArgs::ParseCommaSeparatedAssetTypeString(const std::string& input)
         AddSpecifiedAssetType(std::string(lowerInput, currentPos, lowerInput.size() - currentPos));
 }
 
+void UnlinkerArgs::ParseAssetNamePatterns()
+{
+    for (const auto& include : m_argument_parser.GetParametersForOption(OPTION_INCLUDE_ASSET_NAMES))
+    {
+        for (const auto& pattern : utils::StringSplit(include, ','))
+        {
+            if (!pattern.empty())
+                m_asset_name_filter.AddInclude(pattern);
+        }
+    }
+
+    for (const auto& exclude : m_argument_parser.GetParametersForOption(OPTION_EXCLUDE_ASSET_NAMES))
+    {
+        for (const auto& pattern : utils::StringSplit(exclude, ','))
+        {
+            if (!pattern.empty())
+                m_asset_name_filter.AddExclude(pattern);
+        }
+    }
+}
+
+void UnlinkerArgs::ParseAssetRoots()
+{
+    for (const auto& root : m_argument_parser.GetParametersForOption(OPTION_ASSET_ROOT))
+    {
+        AssetRoot assetRoot;
+        const auto typeSeparator = root.find(':');
+        if (typeSeparator != std::string::npos)
+        {
+            assetRoot.m_asset_type = root.substr(0, typeSeparator);
+            assetRoot.m_asset_name = root.substr(typeSeparator + 1);
+            utils::MakeStringLowerCase(assetRoot.m_asset_type);
+        }
+        else
+            assetRoot.m_asset_name = root;
+
+        m_asset_roots.emplace_back(std::move(assetRoot));
+    }
+}
+
 bool UnlinkerArgs::ParseArgs(const int argc, const char** argv, bool& shouldContinue)
 {
     shouldContinue = true;
@@ -307,13 +711,42 @@ bool UnlinkerArgs::ParseArgs(const int argc, const char** argv, bool& shouldCont
 
     // --list
     if (m_argument_parser.IsOptionSpecified(OPTION_LIST))
+    {
         m_task = ProcessingTask::LIST;
 
+        // Listing only prints the names of the assets
+        ZoneLoading::Configuration.MarkAssetReferences = false;
+    }
+
+    // --diff
+    if (m_argument_parser.IsOptionSpecified(OPTION_DIFF))
+    {
+        if (m_task == ProcessingTask::LIST || m_zones_to_unlink.size() != 2u)
+        {
+            std::cout << "Diffing requires exactly two zones and cannot be combined with listing\n";
+            return false;
+        }
+
+        m_task = ProcessingTask::DIFF;
+        ZoneLoading::Configuration.MarkAssetReferences = false;
+        ZoneLoading::Configuration.HashAssetContent = true;
+    }
+
+    // --list-format
+    if (m_argument_parser.IsOptionSpecified(OPTION_LIST_FORMAT))
+    {
+        if (!ParseListFormat())
+        {
+            return false;
+        }
+    }
+
     // -o; --output-folder
     if (m_argument_parser.IsOptionSpecified(OPTION_OUTPUT_FOLDER))
         m_output_folder = m_argument_parser.GetValueForOption(OPTION_OUTPUT_FOLDER);
     else
         m_output_folder = DEFAULT_OUTPUT_FOLDER;
+    m_output_folder_template = PathTemplate(m_output_folder, {PATTERN_ZONE});
 
     // --search-path
     if (m_argument_parser.IsOptionSpecified(OPTION_SEARCH_PATH))
@@ -342,6 +775,50 @@ bool UnlinkerArgs::ParseArgs(const int argc, const char** argv, bool& shouldCont
         }
     }
 
+    // --weld-vertices
+    if (m_argument_parser.IsOptionSpecified(OPTION_WELD_VERTICES))
+        ObjWriting::Configuration.ModelWeldVertices = true;
+
+    // --hardlink-images
+    m_hardlink_images = m_argument_parser.IsOptionSpecified(OPTION_HARDLINK_IMAGES);
+
+    // --deduplicate-images
+    m_deduplicate_images = m_hardlink_images || m_argument_parser.IsOptionSpecified(OPTION_DEDUPLICATE_IMAGES);
+
+    // --preload-images
+    if (m_argument_parser.IsOptionSpecified(OPTION_PRELOAD_IMAGES))
+        ObjLoading::Configuration.LoadImageDataOnDemand = false;
+
+    // --archive
+    m_archive = m_argument_parser.IsOptionSpecified(OPTION_ARCHIVE);
+    if (m_archive && m_deduplicate_images)
+    {
+        std::cout << "Images cannot be deduplicated when writing archives\n";
+        return false;
+    }
+
+    if (m_archive && m_zones_to_unlink.size() > 1u && !m_output_folder_template.Uses(0u))
+    {
+        std::cout << "The output folder must contain ?zone? to write an archive for every zone\n";
+        return false;
+    }
+
+    // --incremental
+    m_incremental = m_argument_parser.IsOptionSpecified(OPTION_INCREMENTAL);
+    if (m_incremental && m_archive)
+    {
+        std::cout << "Archives cannot be dumped incrementally\n";
+        return false;
+    }
+
+    if (m_incremental)
+        ZoneLoading::Configuration.HashAssetContent = true;
+
+    // --asset-offset-index
+    m_asset_offset_index = m_argument_parser.IsOptionSpecified(OPTION_ASSET_OFFSET_INDEX);
+    if (m_asset_offset_index)
+        ZoneLoading::Configuration.RecordAssetOffsets = true;
+
     // --skip-obj
     m_skip_obj = m_argument_parser.IsOptionSpecified(OPTION_SKIP_OBJ);
 
@@ -369,14 +846,168 @@ bool UnlinkerArgs::ParseArgs(const int argc, const char** argv, bool& shouldCont
             ParseCommaSeparatedAssetTypeString(include);
     }
 
+    // --include-asset-names
+    // --exclude-asset-names
+    ParseAssetNamePatterns();
+
+    // --asset-root
+    ParseAssetRoots();
+
     // --legacy-menus
     if (m_argument_parser.IsOptionSpecified(OPTION_LEGACY_MENUS))
         ObjWriting::Configuration.MenuLegacyMode = true;
 
+    // --load-workers
+    if (m_argument_parser.IsOptionSpecified(OPTION_LOAD_WORKERS))
+    {
+        if (!ParseWorkerCount(OPTION_LOAD_WORKERS, ZoneLoading::Configuration.XChunkWorkerCount))
+        {
+            return false;
+        }
+    }
+
+    // --authed-block-workers
+    if (m_argument_parser.IsOptionSpecified(OPTION_AUTHED_BLOCK_WORKERS))
+    {
+        if (!ParseWorkerCount(OPTION_AUTHED_BLOCK_WORKERS, ZoneLoading::Configuration.AuthedBlockWorkerCount))
+        {
+            return false;
+        }
+    }
+
+    // --trusted-input
+    if (m_argument_parser.IsOptionSpecified(OPTION_TRUSTED_INPUT))
+    {
+        ZoneLoading::Configuration.VerifyAuthedBlocks = false;
+        ZoneLoading::Configuration.VerifySignatures = false;
+    }
+
+    // --large-pages
+    m_large_pages = m_argument_parser.IsOptionSpecified(OPTION_LARGE_PAGES);
+
+    // --dump-workers
+    if (m_argument_parser.IsOptionSpecified(OPTION_DUMP_WORKERS))
+    {
+        if (!ParseWorkerCount(OPTION_DUMP_WORKERS, ObjWriting::Configuration.DumpWorkerCount))
+        {
+            return false;
+        }
+    }
+
+    // --model-format-workers
+    if (m_argument_parser.IsOptionSpecified(OPTION_MODEL_FORMAT_WORKERS))
+    {
+        if (!ParseWorkerCount(OPTION_MODEL_FORMAT_WORKERS, ObjWriting::Configuration.ModelFormatWorkerCount))
+        {
+            return false;
+        }
+    }
+
+    // --image-load-workers
+    if (m_argument_parser.IsOptionSpecified(OPTION_IMAGE_LOAD_WORKERS))
+    {
+        if (!ParseWorkerCount(OPTION_IMAGE_LOAD_WORKERS, ObjLoading::Configuration.ImageLoadWorkerCount))
+        {
+            return false;
+        }
+    }
+
+    // --async-writes
+    if (m_argument_parser.IsOptionSpecified(OPTION_ASYNC_WRITES))
+        ObjWriting::Configuration.AsyncFileWrites = true;
+
+    // --jobs
+    if (m_argument_parser.IsOptionSpecified(OPTION_JOBS))
+    {
+        if (!ParseWorkerCount(OPTION_JOBS, m_job_count))
+        {
+            return false;
+        }
+    }
+
+    // --memory-budget
+    if (m_argument_parser.IsOptionSpecified(OPTION_MEMORY_BUDGET))
+    {
+        if (!ParseMemoryBudget())
+        {
+            return false;
+        }
+    }
+
+    // --threads
+    if (m_argument_parser.IsOptionSpecified(OPTION_THREADS))
+    {
+        unsigned threadCount;
+        if (!ParseWorkerCount(OPTION_THREADS, threadCount))
+        {
+            return false;
+        }
+
+        JobSystem::SetThreadCount(threadCount);
+    }
+
+    // --work-claims
+    if (m_argument_parser.IsOptionSpecified(OPTION_WORK_CLAIMS))
+        m_work_claims_folder = m_argument_parser.GetValueForOption(OPTION_WORK_CLAIMS);
+
+    // --ipak-cache-size
+    if (m_argument_parser.IsOptionSpecified(OPTION_IPAK_CACHE_SIZE))
+    {
+        if (!SetIPakCacheSize())
+        {
+            return false;
+        }
+    }
+
+    // --shader-cache
+    if (m_argument_parser.IsOptionSpecified(OPTION_SHADER_CACHE))
+        m_shader_cache_file = m_argument_parser.GetValueForOption(OPTION_SHADER_CACHE);
+
+    // --trace
+    if (m_argument_parser.IsOptionSpecified(OPTION_TRACE))
+        m_trace_file = m_argument_parser.GetValueForOption(OPTION_TRACE);
+
+    // --benchmark
+    if (m_argument_parser.IsOptionSpecified(OPTION_BENCHMARK))
+    {
+        if (!ParseBenchmarkRunCount())
+        {
+            return false;
+        }
+    }
+
+    // --benchmark-json
+    if (m_argument_parser.IsOptionSpecified(OPTION_BENCHMARK_JSON))
+    {
+        m_benchmark_json_file = m_argument_parser.GetValueForOption(OPTION_BENCHMARK_JSON);
+        if (m_benchmark_run_count == 0u)
+            m_benchmark_run_count = 1u;
+    }
+
+    // --progress
+    if (m_argument_parser.IsOptionSpecified(OPTION_PROGRESS))
+    {
+        if (!ParseProgressFormat())
+        {
+            return false;
+        }
+    }
+
+    // --progress-file
+    if (m_argument_parser.IsOptionSpecified(OPTION_PROGRESS_FILE))
+        m_progress_file = m_argument_parser.GetValueForOption(OPTION_PROGRESS_FILE);
+
+    // Claims are kept after a zone was unlinked so later benchmark runs would not find any zones left to unlink
+    if (!m_work_claims_folder.empty() && m_benchmark_run_count > 0u)
+    {
+        printf("Work claims cannot be used when benchmarking. Use -? to see usage information.\n");
+        return false;
+    }
+
     return true;
 }
 
 std::string UnlinkerArgs::GetOutputFolderPathForZone(const Zone* zone) const
 {
-    return std::regex_replace(m_output_folder, m_zone_pattern, zone->m_name);
+    return m_output_folder_template.Resolve({zone->m_name});
 }
@@ -1,8 +1,10 @@
 #pragma once
+#include "ContentLister/ContentPrinter.h"
+#include "Dumping/AssetNameFilter.h"
 #include "Utils/Arguments/ArgumentParser.h"
+#include "Utils/PathTemplate.h"
 #include "Zone/Zone.h"
 
-#include <regex>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -11,11 +13,12 @@
 class UnlinkerArgs
 {
 public:
+    static constexpr const char* PATTERN_ZONE = "?zone?";
     static constexpr const char* DEFAULT_OUTPUT_FOLDER = "zone_dump/zone_raw/?zone?";
 
 private:
     ArgumentParser m_argument_parser;
-    std::regex m_zone_pattern;
+    PathTemplate m_output_folder_template;
 
     /**
      * \brief Prints a command line usage help text for the Unlinker tool to stdout.
@@ -26,15 +29,24 @@ private:
     void SetVerbose(bool isVerbose);
     bool SetImageDumpingMode();
     bool SetModelDumpingMode();
+    bool SetIPakCacheSize();
+    bool ParseMemoryBudget();
+    bool ParseWorkerCount(const CommandLineOption* option, unsigned& workerCount);
+    bool ParseBenchmarkRunCount();
+    bool ParseListFormat();
+    bool ParseProgressFormat();
 
     void AddSpecifiedAssetType(std::string value);
     void ParseCommaSeparatedAssetTypeString(const std::string& input);
+    void ParseAssetNamePatterns();
+    void ParseAssetRoots();
 
 public:
     enum class ProcessingTask
     {
         DUMP,
-        LIST
+        LIST,
+        DIFF
     };
 
     enum class AssetTypeHandling
@@ -43,20 +55,46 @@ public:
         INCLUDE
     };
 
+    class AssetRoot
+    {
+    public:
+        // Empty when assets of all types with the name are roots
+        std::string m_asset_type;
+        std::string m_asset_name;
+    };
+
     std::vector<std::string> m_zones_to_load;
     std::vector<std::string> m_zones_to_unlink;
     std::set<std::string> m_user_search_paths;
 
     ProcessingTask m_task;
+    ContentPrinter::Format m_list_format;
     std::string m_output_folder;
     bool m_minimal_zone_def;
 
     std::vector<std::string> m_specified_asset_types;
     std::unordered_map<std::string, size_t> m_specified_asset_type_map;
     AssetTypeHandling m_asset_type_handling;
+    AssetNameFilter m_asset_name_filter;
+    std::vector<AssetRoot> m_asset_roots;
 
+    bool m_deduplicate_images;
+    bool m_hardlink_images;
+    bool m_archive;
+    bool m_incremental;
+    bool m_asset_offset_index;
     bool m_skip_obj;
+    bool m_large_pages;
     bool m_use_gdt;
+    unsigned m_job_count;
+    size_t m_memory_budget;
+    std::string m_work_claims_folder;
+    std::string m_shader_cache_file;
+    std::string m_trace_file;
+    unsigned m_benchmark_run_count;
+    std::string m_benchmark_json_file;
+    std::string m_progress_format;
+    std::string m_progress_file;
 
     bool m_verbose;
 
@@ -0,0 +1,70 @@
+#include "AllocationLayout.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace
+{
+    size_t AlignOffset(const size_t offset, const size_t alignment)
+    {
+        return (offset + alignment - 1u) / alignment * alignment;
+    }
+} // namespace
+
+AllocationLayout::AllocationLayout()
+    : m_size(0u),
+      m_alignment(1u),
+      m_data(nullptr),
+      m_offset(0u)
+{
+}
+
+void AllocationLayout::Reserve(const size_t size, const size_t alignment)
+{
+    assert(m_data == nullptr);
+
+    m_size = AlignOffset(m_size, alignment) + size;
+    if (alignment > m_alignment)
+        m_alignment = alignment;
+}
+
+void AllocationLayout::ReserveString(const std::string& str)
+{
+    Reserve(str.size() + 1u, 1u);
+}
+
+void AllocationLayout::Allocate(MemoryManager& memory)
+{
+    assert(m_data == nullptr);
+
+    // Memory managers align allocations by their size, so a size that is a multiple of the largest alignment aligns the start for all parts
+    m_size = AlignOffset(m_size, m_alignment);
+    m_data = static_cast<char*>(memory.AllocRaw(m_size));
+    m_offset = 0u;
+}
+
+void* AllocationLayout::Take(const size_t size, const size_t alignment)
+{
+    assert(m_data != nullptr || m_size == 0u);
+
+    m_offset = AlignOffset(m_offset, alignment);
+    assert(m_offset + size <= m_size);
+
+    auto* result = &m_data[m_offset];
+    m_offset += size;
+
+    return result;
+}
+
+char* AllocationLayout::TakeString(const std::string& str)
+{
+    auto* result = static_cast<char*>(Take(str.size() + 1u, 1u));
+    std::memcpy(result, str.c_str(), str.size() + 1u);
+
+    return result;
+}
+
+size_t AllocationLayout::GetSize() const
+{
+    return m_size;
+}
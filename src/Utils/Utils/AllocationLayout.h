@@ -0,0 +1,54 @@
+#pragma once
+
+#include "ClassUtils.h"
+#include "MemoryManager.h"
+
+#include <cstddef>
+#include <string>
+
+/**
+ * \brief Allocates an asset together with the sub objects it owns in a single allocation of a memory manager instead of one allocation per sub object.
+ * All parts are reserved first to measure the total size, then the memory is allocated once and handed out in the same order the parts were reserved in.
+ * Handed out memory is zeroed like all other memory of a memory manager and can only be freed together with the memory manager.
+ */
+class AllocationLayout
+{
+public:
+    AllocationLayout();
+
+    template<typename T> void Reserve(const size_t count = 1u)
+    {
+        Reserve(sizeof(T) * count, alignof(T));
+    }
+
+    void ReserveString(const std::string& str);
+
+    /**
+     * \brief Allocates the memory for all reserved parts. Nothing can be reserved afterwards.
+     * \param memory The memory manager to allocate the memory with.
+     */
+    void Allocate(MemoryManager& memory);
+
+    template<typename T> T* Take(const size_t count = 1u)
+    {
+        return static_cast<T*>(Take(sizeof(T) * count, alignof(T)));
+    }
+
+    /**
+     * \brief Takes the memory of a string that was reserved with \c ReserveString and copies the string into it.
+     * \param str The string that was reserved.
+     * \return The copied string.
+     */
+    char* TakeString(const std::string& str);
+
+    _NODISCARD size_t GetSize() const;
+
+private:
+    void Reserve(size_t size, size_t alignment);
+    void* Take(size_t size, size_t alignment);
+
+    size_t m_size;
+    size_t m_alignment;
+    char* m_data;
+    size_t m_offset;
+};
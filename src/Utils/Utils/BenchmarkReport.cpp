@@ -0,0 +1,248 @@
+#include "BenchmarkReport.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <ctime>
+#endif
+
+using namespace benchmarking;
+
+namespace
+{
+    double ToSeconds(const std::chrono::nanoseconds duration)
+    {
+        return std::chrono::duration<double>(duration).count();
+    }
+
+    double ToMilliseconds(const std::chrono::nanoseconds duration)
+    {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    double PerSecond(const double value, const std::chrono::nanoseconds duration)
+    {
+        const auto seconds = ToSeconds(duration);
+        if (seconds <= 0.0)
+            return 0.0;
+
+        return value / seconds;
+    }
+
+    void WriteJsonString(std::ostream& stream, const std::string& value)
+    {
+        stream << '"';
+        for (const auto c : value)
+        {
+            if (c == '"' || c == '\\')
+                stream << '\\' << c;
+            else if (static_cast<unsigned char>(c) < 0x20u)
+                stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<unsigned>(c) << std::dec << std::setfill(' ');
+            else
+                stream << c;
+        }
+        stream << '"';
+    }
+} // namespace
+
+std::chrono::nanoseconds benchmarking::GetProcessCpuTime()
+{
+#ifdef _WIN32
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+        return std::chrono::nanoseconds(0);
+
+    // File times are specified in 100 nanosecond intervals
+    const auto kernel = static_cast<uint64_t>(kernelTime.dwHighDateTime) << 32 | kernelTime.dwLowDateTime;
+    const auto user = static_cast<uint64_t>(userTime.dwHighDateTime) << 32 | userTime.dwLowDateTime;
+    return std::chrono::nanoseconds((kernel + user) * 100u);
+#else
+    timespec time{};
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time) != 0)
+        return std::chrono::nanoseconds(0);
+
+    return std::chrono::seconds(time.tv_sec) + std::chrono::nanoseconds(time.tv_nsec);
+#endif
+}
+
+BenchmarkReport::BenchmarkReport(std::string toolName)
+    : m_tool_name(std::move(toolName)),
+      m_current_run(0u)
+{
+}
+
+void BenchmarkReport::BeginRun(const unsigned run)
+{
+    std::lock_guard lock(m_mutex);
+    m_current_run = run;
+}
+
+void BenchmarkReport::AddSample(PhaseSample sample)
+{
+    std::lock_guard lock(m_mutex);
+    sample.m_run = m_current_run;
+    m_samples.emplace_back(std::move(sample));
+}
+
+std::vector<BenchmarkReport::PhaseSummary> BenchmarkReport::SummarizePhases() const
+{
+    // Phases are kept in the order they were first executed in
+    std::vector<PhaseSummary> summaries;
+    for (const auto& sample : m_samples)
+    {
+        auto summary = std::ranges::find_if(summaries,
+                                            [&sample](const PhaseSummary& existingSummary)
+                                            {
+                                                return existingSummary.m_phase == sample.m_phase;
+                                            });
+        if (summary == summaries.end())
+        {
+            summaries.emplace_back(PhaseSummary{sample.m_phase, {}});
+            summary = std::prev(summaries.end());
+        }
+
+        auto run = std::ranges::find_if(summary->m_runs,
+                                        [&sample](const PhaseSample& existingRun)
+                                        {
+                                            return existingRun.m_run == sample.m_run;
+                                        });
+        if (run == summary->m_runs.end())
+        {
+            summary->m_runs.emplace_back(PhaseSample{sample.m_phase, sample.m_run, {}, {}, 0u, 0u, 0u});
+            run = std::prev(summary->m_runs.end());
+        }
+
+        run->m_wall_time += sample.m_wall_time;
+        run->m_cpu_time += sample.m_cpu_time;
+        run->m_bytes_read += sample.m_bytes_read;
+        run->m_bytes_written += sample.m_bytes_written;
+        run->m_asset_count += sample.m_asset_count;
+    }
+
+    return summaries;
+}
+
+void BenchmarkReport::PrintSummary(std::ostream& stream) const
+{
+    std::lock_guard lock(m_mutex);
+
+    stream << std::fixed << std::setprecision(2);
+    stream << std::setw(12) << "mean ms" << std::setw(12) << "min ms" << std::setw(12) << "max ms" << std::setw(12) << "cpu ms" << std::setw(12) << "read MB/s"
+           << std::setw(12) << "write MB/s" << std::setw(12) << "assets/s"
+           << "  phase\n";
+
+    for (const auto& summary : SummarizePhases())
+    {
+        std::chrono::nanoseconds totalWallTime(0);
+        std::chrono::nanoseconds totalCpuTime(0);
+        auto minWallTime = summary.m_runs.front().m_wall_time;
+        auto maxWallTime = summary.m_runs.front().m_wall_time;
+        uint64_t totalBytesRead = 0u;
+        uint64_t totalBytesWritten = 0u;
+        size_t totalAssetCount = 0u;
+        for (const auto& run : summary.m_runs)
+        {
+            totalWallTime += run.m_wall_time;
+            totalCpuTime += run.m_cpu_time;
+            minWallTime = std::min(minWallTime, run.m_wall_time);
+            maxWallTime = std::max(maxWallTime, run.m_wall_time);
+            totalBytesRead += run.m_bytes_read;
+            totalBytesWritten += run.m_bytes_written;
+            totalAssetCount += run.m_asset_count;
+        }
+
+        const auto runCount = static_cast<double>(summary.m_runs.size());
+        stream << std::setw(12) << ToMilliseconds(totalWallTime) / runCount << std::setw(12) << ToMilliseconds(minWallTime) << std::setw(12)
+               << ToMilliseconds(maxWallTime) << std::setw(12) << ToMilliseconds(totalCpuTime) / runCount << std::setw(12)
+               << PerSecond(static_cast<double>(totalBytesRead) / 1000000.0, totalWallTime) << std::setw(12)
+               << PerSecond(static_cast<double>(totalBytesWritten) / 1000000.0, totalWallTime) << std::setw(12)
+               << PerSecond(static_cast<double>(totalAssetCount), totalWallTime) << "  " << summary.m_phase << "\n";
+    }
+
+    stream << std::defaultfloat << std::setprecision(6);
+}
+
+bool BenchmarkReport::WriteJson(const std::string& path) const
+{
+    std::ofstream stream(path, std::fstream::out | std::fstream::binary);
+    if (!stream.is_open())
+        return false;
+
+    std::lock_guard lock(m_mutex);
+
+    stream << "{\n  \"tool\": ";
+    WriteJsonString(stream, m_tool_name);
+    stream << ",\n  \"phases\": [";
+
+    auto firstPhase = true;
+    for (const auto& summary : SummarizePhases())
+    {
+        stream << (firstPhase ? "\n" : ",\n") << "    {\"name\": ";
+        firstPhase = false;
+        WriteJsonString(stream, summary.m_phase);
+        stream << ", \"runs\": [";
+
+        auto firstRun = true;
+        for (const auto& run : summary.m_runs)
+        {
+            stream << (firstRun ? "\n" : ",\n") << "      {\"run\": " << run.m_run << ", \"wallSeconds\": " << ToSeconds(run.m_wall_time)
+                   << ", \"cpuSeconds\": " << ToSeconds(run.m_cpu_time) << ", \"bytesRead\": " << run.m_bytes_read
+                   << ", \"bytesWritten\": " << run.m_bytes_written << ", \"assets\": " << run.m_asset_count
+                   << ", \"assetsPerSecond\": " << PerSecond(static_cast<double>(run.m_asset_count), run.m_wall_time) << "}";
+            firstRun = false;
+        }
+        stream << "\n    ]}";
+    }
+    stream << "\n  ]\n}\n";
+
+    return stream.good();
+}
+
+ScopedPhase::ScopedPhase(BenchmarkReport* report, std::string phase)
+    : m_report(report),
+      m_phase(std::move(phase)),
+      m_bytes_read(0u),
+      m_bytes_written(0u),
+      m_asset_count(0u)
+{
+    if (m_report)
+    {
+        m_wall_start = wall_clock_t::now();
+        m_cpu_start = GetProcessCpuTime();
+    }
+}
+
+ScopedPhase::~ScopedPhase()
+{
+    if (m_report)
+    {
+        m_report->AddSample(BenchmarkReport::PhaseSample{std::move(m_phase),
+                                                         0u,
+                                                         std::chrono::duration_cast<std::chrono::nanoseconds>(wall_clock_t::now() - m_wall_start),
+                                                         GetProcessCpuTime() - m_cpu_start,
+                                                         m_bytes_read,
+                                                         m_bytes_written,
+                                                         m_asset_count});
+    }
+}
+
+void ScopedPhase::AddBytesRead(const uint64_t byteCount)
+{
+    m_bytes_read += byteCount;
+}
+
+void ScopedPhase::AddBytesWritten(const uint64_t byteCount)
+{
+    m_bytes_written += byteCount;
+}
+
+void ScopedPhase::AddAssets(const size_t assetCount)
+{
+    m_asset_count += assetCount;
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "ClassUtils.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace benchmarking
+{
+    using wall_clock_t = std::chrono::steady_clock;
+
+    /**
+     * \brief Returns the CPU time all threads of the current process have used so far.
+     */
+    _NODISCARD std::chrono::nanoseconds GetProcessCpuTime();
+
+    /**
+     * \brief Collects measurements of the phases of repeated runs and reports them per phase.
+     * Can be used from multiple threads at once.
+     */
+    class BenchmarkReport
+    {
+    public:
+        class PhaseSample
+        {
+        public:
+            std::string m_phase;
+            unsigned m_run;
+            std::chrono::nanoseconds m_wall_time;
+            std::chrono::nanoseconds m_cpu_time;
+            uint64_t m_bytes_read;
+            uint64_t m_bytes_written;
+            size_t m_asset_count;
+        };
+
+        explicit BenchmarkReport(std::string toolName);
+
+        /**
+         * \brief Starts a new run. Samples that are added afterwards belong to this run.
+         * \param run The index of the run.
+         */
+        void BeginRun(unsigned run);
+        void AddSample(PhaseSample sample);
+
+        /**
+         * \brief Prints the mean, minimum and maximum wall time and the throughput of each phase over all runs.
+         * Phases that were executed multiple times in a run, like once per zone, are summed up per run.
+         * \param stream The stream to print to.
+         */
+        void PrintSummary(std::ostream& stream) const;
+
+        /**
+         * \brief Writes all samples and the summary of each phase as json.
+         * \param path The path of the file to write.
+         * \return \c true if the file could be written.
+         */
+        bool WriteJson(const std::string& path) const;
+
+    private:
+        class PhaseSummary
+        {
+        public:
+            std::string m_phase;
+            std::vector<PhaseSample> m_runs;
+        };
+
+        _NODISCARD std::vector<PhaseSummary> SummarizePhases() const;
+
+        std::string m_tool_name;
+        unsigned m_current_run;
+        std::vector<PhaseSample> m_samples;
+        mutable std::mutex m_mutex;
+    };
+
+    /**
+     * \brief Measures the wall time and process CPU time from its construction to its destruction and adds it to a report.
+     * Does nothing if no report is specified.
+     */
+    class ScopedPhase
+    {
+    public:
+        ScopedPhase(BenchmarkReport* report, std::string phase);
+        ~ScopedPhase();
+        ScopedPhase(const ScopedPhase& other) = delete;
+        ScopedPhase(ScopedPhase&& other) noexcept = delete;
+        ScopedPhase& operator=(const ScopedPhase& other) = delete;
+        ScopedPhase& operator=(ScopedPhase&& other) noexcept = delete;
+
+        void AddBytesRead(uint64_t byteCount);
+        void AddBytesWritten(uint64_t byteCount);
+        void AddAssets(size_t assetCount);
+
+    private:
+        BenchmarkReport* m_report;
+        std::string m_phase;
+        wall_clock_t::time_point m_wall_start;
+        std::chrono::nanoseconds m_cpu_start;
+        uint64_t m_bytes_read;
+        uint64_t m_bytes_written;
+        size_t m_asset_count;
+    };
+} // namespace benchmarking
@@ -1,5 +1,21 @@
 #include "Endianness.h"
 
+#include <cstring>
+
+#if defined(__AVX2__)
+#define ENDIANNESS_AVX2
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#define ENDIANNESS_SSSE3
+#include <tmmintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENDIANNESS_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define ENDIANNESS_NEON
+#include <arm_neon.h>
+#endif
+
 #if defined(_WIN32) || defined(_WIN64) || defined(_MSC_VER)
 
 namespace endianness
@@ -26,7 +42,7 @@ namespace endianness
 
     constexpr uint64_t byteswap64u(const uint64_t in)
     {
-        return static_cast<uint32_t>((in >> 56) | ((in >> 40) & 0x000000000000FF00ui64) | ((in >> 24) & 0x0000000000FF0000ui64)
+        return static_cast<uint64_t>((in >> 56) | ((in >> 40) & 0x000000000000FF00ui64) | ((in >> 24) & 0x0000000000FF0000ui64)
                                      | ((in >> 8) & 0x00000000FF000000ui64) | ((in << 8) & 0x000000FF00000000ui64) | ((in << 24) & 0x0000FF0000000000ui64)
                                      | ((in << 40) & 0x00FF000000000000ui64) | (in << 56));
     }
@@ -202,3 +218,225 @@ namespace endianness
 
 #endif
 } // namespace endianness
+
+namespace
+{
+#if defined(ENDIANNESS_AVX2) || defined(ENDIANNESS_SSSE3)
+    // Shuffle masks that reverse the bytes of every element of a 16 byte lane
+    constexpr char SHUFFLE_16[16]{1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14};
+    constexpr char SHUFFLE_32[16]{3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12};
+    constexpr char SHUFFLE_64[16]{7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8};
+
+    size_t SwapVectors(uint8_t* data, const size_t size, const char (&shuffle)[16])
+    {
+        size_t offset = 0u;
+
+#ifdef ENDIANNESS_AVX2
+        const auto mask256 = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(shuffle)));
+        for (; offset + 32u <= size; offset += 32u)
+        {
+            auto* vector = reinterpret_cast<__m256i*>(&data[offset]);
+            _mm256_storeu_si256(vector, _mm256_shuffle_epi8(_mm256_loadu_si256(vector), mask256));
+        }
+#endif
+
+        const auto mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(shuffle));
+        for (; offset + 16u <= size; offset += 16u)
+        {
+            auto* vector = reinterpret_cast<__m128i*>(&data[offset]);
+            _mm_storeu_si128(vector, _mm_shuffle_epi8(_mm_loadu_si128(vector), mask));
+        }
+
+        return offset;
+    }
+
+    size_t SwapVectors16(uint8_t* data, const size_t size)
+    {
+        return SwapVectors(data, size, SHUFFLE_16);
+    }
+
+    size_t SwapVectors32(uint8_t* data, const size_t size)
+    {
+        return SwapVectors(data, size, SHUFFLE_32);
+    }
+
+    size_t SwapVectors64(uint8_t* data, const size_t size)
+    {
+        return SwapVectors(data, size, SHUFFLE_64);
+    }
+#elif defined(ENDIANNESS_SSE2)
+    // Without a byte shuffle the elements are reversed in 16 bit words first and the bytes of each word are swapped afterwards
+    __m128i SwapWordBytes(const __m128i value)
+    {
+        return _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+    }
+
+    template<typename TSwap> size_t SwapVectorsSse2(uint8_t* data, const size_t size, const TSwap& swap)
+    {
+        size_t offset = 0u;
+        for (; offset + 16u <= size; offset += 16u)
+        {
+            auto* vector = reinterpret_cast<__m128i*>(&data[offset]);
+            _mm_storeu_si128(vector, swap(_mm_loadu_si128(vector)));
+        }
+
+        return offset;
+    }
+
+    size_t SwapVectors16(uint8_t* data, const size_t size)
+    {
+        return SwapVectorsSse2(data, size, SwapWordBytes);
+    }
+
+    size_t SwapVectors32(uint8_t* data, const size_t size)
+    {
+        return SwapVectorsSse2(data,
+                               size,
+                               [](const __m128i value)
+                               {
+                                   const auto words = _mm_shufflehi_epi16(_mm_shufflelo_epi16(value, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+                                   return SwapWordBytes(words);
+                               });
+    }
+
+    size_t SwapVectors64(uint8_t* data, const size_t size)
+    {
+        return SwapVectorsSse2(data,
+                               size,
+                               [](const __m128i value)
+                               {
+                                   const auto words = _mm_shufflehi_epi16(_mm_shufflelo_epi16(value, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+                                   return SwapWordBytes(words);
+                               });
+    }
+#elif defined(ENDIANNESS_NEON)
+    size_t SwapVectors16(uint8_t* data, const size_t size)
+    {
+        size_t offset = 0u;
+        for (; offset + 16u <= size; offset += 16u)
+            vst1q_u8(&data[offset], vrev16q_u8(vld1q_u8(&data[offset])));
+
+        return offset;
+    }
+
+    size_t SwapVectors32(uint8_t* data, const size_t size)
+    {
+        size_t offset = 0u;
+        for (; offset + 16u <= size; offset += 16u)
+            vst1q_u8(&data[offset], vrev32q_u8(vld1q_u8(&data[offset])));
+
+        return offset;
+    }
+
+    size_t SwapVectors64(uint8_t* data, const size_t size)
+    {
+        size_t offset = 0u;
+        for (; offset + 16u <= size; offset += 16u)
+            vst1q_u8(&data[offset], vrev64q_u8(vld1q_u8(&data[offset])));
+
+        return offset;
+    }
+#else
+    size_t SwapVectors16(uint8_t*, size_t)
+    {
+        return 0u;
+    }
+
+    size_t SwapVectors32(uint8_t*, size_t)
+    {
+        return 0u;
+    }
+
+    size_t SwapVectors64(uint8_t*, size_t)
+    {
+        return 0u;
+    }
+#endif
+
+    void SwapBytes16(void* data, const size_t count)
+    {
+        auto* bytes = static_cast<uint8_t*>(data);
+        const auto size = count * sizeof(uint16_t);
+
+        for (auto offset = SwapVectors16(bytes, size); offset < size; offset += sizeof(uint16_t))
+        {
+            uint16_t value;
+            std::memcpy(&value, &bytes[offset], sizeof(value));
+            value = endianness::byteswap16u(value);
+            std::memcpy(&bytes[offset], &value, sizeof(value));
+        }
+    }
+
+    void SwapBytes32(void* data, const size_t count)
+    {
+        auto* bytes = static_cast<uint8_t*>(data);
+        const auto size = count * sizeof(uint32_t);
+
+        for (auto offset = SwapVectors32(bytes, size); offset < size; offset += sizeof(uint32_t))
+        {
+            uint32_t value;
+            std::memcpy(&value, &bytes[offset], sizeof(value));
+            value = endianness::byteswap32u(value);
+            std::memcpy(&bytes[offset], &value, sizeof(value));
+        }
+    }
+
+    void SwapBytes64(void* data, const size_t count)
+    {
+        auto* bytes = static_cast<uint8_t*>(data);
+        const auto size = count * sizeof(uint64_t);
+
+        for (auto offset = SwapVectors64(bytes, size); offset < size; offset += sizeof(uint64_t))
+        {
+            uint64_t value;
+            std::memcpy(&value, &bytes[offset], sizeof(value));
+            value = endianness::byteswap64u(value);
+            std::memcpy(&bytes[offset], &value, sizeof(value));
+        }
+    }
+} // namespace
+
+namespace endianness
+{
+    void SwapBytes(const std::span<uint16_t> values)
+    {
+        SwapBytes16(values.data(), values.size());
+    }
+
+    void SwapBytes(const std::span<int16_t> values)
+    {
+        SwapBytes16(values.data(), values.size());
+    }
+
+    void SwapBytes(const std::span<uint32_t> values)
+    {
+        SwapBytes32(values.data(), values.size());
+    }
+
+    void SwapBytes(const std::span<int32_t> values)
+    {
+        SwapBytes32(values.data(), values.size());
+    }
+
+    void SwapBytes(const std::span<float> values)
+    {
+        static_assert(sizeof(float) == sizeof(uint32_t));
+        SwapBytes32(values.data(), values.size());
+    }
+
+    void SwapBytes(const std::span<uint64_t> values)
+    {
+        SwapBytes64(values.data(), values.size());
+    }
+
+    void SwapBytes(const std::span<int64_t> values)
+    {
+        SwapBytes64(values.data(), values.size());
+    }
+
+    void SwapBytes(const std::span<double> values)
+    {
+        static_assert(sizeof(double) == sizeof(uint64_t));
+        SwapBytes64(values.data(), values.size());
+    }
+} // namespace endianness
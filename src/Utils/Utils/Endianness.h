@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 
 #define LITTLE_ENDIAN_ENDIANNESS 1234
 #define BIG_ENDIAN_ENDIANNESS 4321
@@ -172,4 +173,39 @@ namespace endianness
     int64_t FromBigEndian(int64_t in);
     uint64_t FromBigEndian(uint64_t in);
 #endif
+
+    /**
+     * \brief Swaps the byte order of every value in place. Large arrays are swapped with vector instructions where available.
+     * \param values The values to swap.
+     */
+    void SwapBytes(std::span<uint16_t> values);
+    void SwapBytes(std::span<int16_t> values);
+    void SwapBytes(std::span<uint32_t> values);
+    void SwapBytes(std::span<int32_t> values);
+    void SwapBytes(std::span<float> values);
+    void SwapBytes(std::span<uint64_t> values);
+    void SwapBytes(std::span<int64_t> values);
+    void SwapBytes(std::span<double> values);
+
+    /**
+     * \brief Converts every value between big endian and host byte order in place.
+     * \param values The values to convert.
+     */
+    template<typename T> void ConvertBigEndian(const std::span<T> values)
+    {
+#if HOST_ENDIANNESS == LITTLE_ENDIAN_ENDIANNESS
+        SwapBytes(values);
+#endif
+    }
+
+    /**
+     * \brief Converts every value between little endian and host byte order in place.
+     * \param values The values to convert.
+     */
+    template<typename T> void ConvertLittleEndian(const std::span<T> values)
+    {
+#if HOST_ENDIANNESS == BIG_ENDIAN_ENDIANNESS
+        SwapBytes(values);
+#endif
+    }
 } // namespace endianness
@@ -61,3 +61,23 @@ bool FileUtils::ParsePathsString(const std::string& pathsString, std::set<std::s
 
     return true;
 }
+
+std::string FileUtils::ReadStream(std::istream& stream)
+{
+    constexpr auto READ_SIZE = 0x10000u;
+
+    std::string data;
+    while (true)
+    {
+        const auto previousSize = data.size();
+        data.resize(previousSize + READ_SIZE);
+        stream.read(data.data() + previousSize, READ_SIZE);
+
+        const auto readSize = static_cast<size_t>(stream.gcount());
+        data.resize(previousSize + readSize);
+        if (readSize < READ_SIZE)
+            break;
+    }
+
+    return data;
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+#include <istream>
 #include <set>
 #include <string>
 
@@ -18,4 +19,11 @@ public:
      * \return \c true if the user input was valid and could be processed successfully, otherwise \c false.
      */
     static bool ParsePathsString(const std::string& pathsString, std::set<std::string>& output);
+
+    /**
+     * \brief Reads the remaining data of a stream in large chunks instead of reading it character by character.
+     * \param stream The stream to read.
+     * \return All data that could be read from the stream.
+     */
+    static std::string ReadStream(std::istream& stream);
 };
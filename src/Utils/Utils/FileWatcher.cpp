@@ -0,0 +1,89 @@
+#include "FileWatcher.h"
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325u;
+    constexpr uint64_t FNV_PRIME = 0x100000001B3u;
+
+    // Distinguishes paths that do not exist from empty folders
+    constexpr uint64_t MISSING_PATH_FINGERPRINT = 0u;
+
+    uint64_t HashValue(uint64_t hash, const uint64_t value)
+    {
+        for (auto i = 0u; i < sizeof(value); i++)
+        {
+            hash ^= (value >> (i * 8u)) & 0xFFu;
+            hash *= FNV_PRIME;
+        }
+
+        return hash;
+    }
+
+    uint64_t HashFile(const fs::directory_entry& entry)
+    {
+        auto hash = FNV_OFFSET_BASIS;
+        for (const auto c : entry.path().native())
+            hash = HashValue(hash, static_cast<uint64_t>(c));
+
+        std::error_code ec;
+        hash = HashValue(hash, entry.file_size(ec));
+        hash = HashValue(hash, static_cast<uint64_t>(entry.last_write_time(ec).time_since_epoch().count()));
+
+        return hash;
+    }
+} // namespace
+
+uint64_t FileWatcher::GetFingerprint(const std::string& path)
+{
+    std::error_code ec;
+    const fs::directory_entry pathEntry(path, ec);
+    if (ec || !pathEntry.exists(ec))
+        return MISSING_PATH_FINGERPRINT;
+
+    if (!pathEntry.is_directory(ec))
+        return HashFile(pathEntry);
+
+    // Folders are iterated in an unspecified order so the hashes of all files are combined in a way that does not depend on it
+    auto fingerprint = FNV_OFFSET_BASIS;
+    fs::recursive_directory_iterator iterator(path, fs::directory_options::skip_permission_denied, ec);
+    for (const fs::recursive_directory_iterator end; !ec && iterator != end; iterator.increment(ec))
+    {
+        if (iterator->is_regular_file(ec))
+            fingerprint += HashFile(*iterator);
+    }
+
+    return fingerprint;
+}
+
+void FileWatcher::Watch(const std::string& path)
+{
+    if (m_fingerprints.find(path) != m_fingerprints.end())
+        return;
+
+    m_fingerprints.emplace(path, GetFingerprint(path));
+}
+
+bool FileWatcher::Poll()
+{
+    auto changed = false;
+    for (auto& [path, fingerprint] : m_fingerprints)
+    {
+        const auto currentFingerprint = GetFingerprint(path);
+        if (currentFingerprint != fingerprint)
+        {
+            fingerprint = currentFingerprint;
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+size_t FileWatcher::GetWatchedPathCount() const
+{
+    return m_fingerprints.size();
+}
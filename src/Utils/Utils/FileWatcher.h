@@ -0,0 +1,35 @@
+#pragma once
+
+#include "ClassUtils.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+/**
+ * \brief Detects changes to watched files and folders by comparing the names, sizes and last write times of all files inside them between polls.
+ * Polling behaves the same on all platforms and file systems, including network shares that do not report changes.
+ */
+class FileWatcher
+{
+public:
+    /**
+     * \brief Starts watching a file or a folder including all of its subfolders. Paths that do not exist yet are watched for being created.
+     * Changes that happened before a path was watched are not reported. Watching a path again does not reset it.
+     * \param path The path of the file or folder to watch.
+     */
+    void Watch(const std::string& path);
+
+    /**
+     * \brief Checks whether any watched path changed since the last poll or since it was watched.
+     * \return \c true if any watched file was added, removed or changed, otherwise \c false.
+     */
+    bool Poll();
+
+    _NODISCARD size_t GetWatchedPathCount() const;
+
+private:
+    static uint64_t GetFingerprint(const std::string& path);
+
+    std::map<std::string, uint64_t> m_fingerprints;
+};
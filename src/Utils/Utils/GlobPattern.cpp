@@ -0,0 +1,82 @@
+#include "GlobPattern.h"
+
+namespace
+{
+    constexpr char ToLower(const char c)
+    {
+        return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+} // namespace
+
+GlobPattern::GlobPattern(const std::string_view pattern)
+    : m_has_wildcards(false)
+{
+    m_pattern.reserve(pattern.size());
+    for (const auto c : pattern)
+    {
+        if (c == '*' || c == '?')
+            m_has_wildcards = true;
+
+        if (c == '*' && !m_pattern.empty() && m_pattern.back() == '*')
+            continue;
+
+        m_pattern += ToLower(c);
+    }
+}
+
+bool GlobPattern::Matches(const std::string_view name) const
+{
+    if (m_has_wildcards)
+        return MatchesWildcards(name);
+
+    if (name.size() != m_pattern.size())
+        return false;
+
+    for (auto i = 0u; i < name.size(); i++)
+    {
+        if (ToLower(name[i]) != m_pattern[i])
+            return false;
+    }
+
+    return true;
+}
+
+const std::string& GlobPattern::GetPattern() const
+{
+    return m_pattern;
+}
+
+bool GlobPattern::MatchesWildcards(const std::string_view name) const
+{
+    // Only the last star needs to be retried with more characters, since any earlier star could only match a prefix of what the last one matches
+    size_t patternPos = 0u;
+    size_t namePos = 0u;
+    auto starPatternPos = std::string::npos;
+    size_t starNamePos = 0u;
+
+    while (namePos < name.size())
+    {
+        if (patternPos < m_pattern.size() && m_pattern[patternPos] == '*')
+        {
+            starPatternPos = patternPos++;
+            starNamePos = namePos;
+        }
+        else if (patternPos < m_pattern.size() && (m_pattern[patternPos] == '?' || m_pattern[patternPos] == ToLower(name[namePos])))
+        {
+            patternPos++;
+            namePos++;
+        }
+        else if (starPatternPos != std::string::npos)
+        {
+            patternPos = starPatternPos + 1u;
+            namePos = ++starNamePos;
+        }
+        else
+            return false;
+    }
+
+    while (patternPos < m_pattern.size() && m_pattern[patternPos] == '*')
+        patternPos++;
+
+    return patternPos == m_pattern.size();
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "ClassUtils.h"
+
+#include <string>
+#include <string_view>
+
+/**
+ * \brief A pattern of names with the wildcards \c * for any amount of characters and \c ? for exactly one character.
+ * Matching ignores the case of ASCII letters and does not allocate. Patterns without wildcards are compared directly.
+ */
+class GlobPattern
+{
+public:
+    explicit GlobPattern(std::string_view pattern);
+
+    /**
+     * \brief Checks whether a name matches the pattern.
+     * \param name The name to check.
+     * \return \c true if the whole name matches the pattern, otherwise \c false.
+     */
+    _NODISCARD bool Matches(std::string_view name) const;
+
+    _NODISCARD const std::string& GetPattern() const;
+
+private:
+    _NODISCARD bool MatchesWildcards(std::string_view name) const;
+
+    // Lower case with consecutive stars collapsed into one
+    std::string m_pattern;
+    bool m_has_wildcards;
+};
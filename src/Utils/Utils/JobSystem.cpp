@@ -0,0 +1,238 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace
+{
+    // More ranges than workers let workers that finish early take over the work of slower ones
+    constexpr size_t RANGES_PER_WORKER = 4u;
+
+    std::atomic<size_t> sharedThreadCount = 0u;
+
+    thread_local const JobSystem* currentJobSystem = nullptr;
+    thread_local size_t currentWorkerIndex = 0u;
+} // namespace
+
+JobSystem::TaskGroup::TaskGroup(JobSystem& jobSystem)
+    : m_job_system(jobSystem),
+      m_pending_jobs(0u)
+{
+}
+
+JobSystem::TaskGroup::~TaskGroup()
+{
+    // Jobs reference the group so they have to finish before it is destroyed, exceptions are only reported by an explicit Wait
+    try
+    {
+        Wait();
+    }
+    catch (...)
+    {
+    }
+}
+
+void JobSystem::TaskGroup::Run(job_t job)
+{
+    assert(job);
+
+    m_pending_jobs.fetch_add(1u, std::memory_order_relaxed);
+    m_job_system.Push(
+        [this, job = std::move(job)]
+        {
+            try
+            {
+                job();
+            }
+            catch (...)
+            {
+                std::lock_guard lock(m_mutex);
+                if (!m_exception)
+                    m_exception = std::current_exception();
+            }
+
+            // Waiting takes the lock before returning, so the group cannot be destroyed while the last job still holds it
+            std::lock_guard lock(m_mutex);
+            if (m_pending_jobs.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+                m_finished.notify_all();
+        });
+}
+
+void JobSystem::TaskGroup::Wait()
+{
+    while (m_pending_jobs.load(std::memory_order_acquire) > 0u)
+    {
+        if (m_job_system.TryRunJob())
+            continue;
+
+        // All remaining jobs of the group are already executing on other threads
+        std::unique_lock lock(m_mutex);
+        m_finished.wait(lock,
+                        [this]
+                        {
+                            return m_pending_jobs.load(std::memory_order_acquire) == 0u;
+                        });
+    }
+
+    std::exception_ptr exception;
+    {
+        std::lock_guard lock(m_mutex);
+        exception = std::exchange(m_exception, nullptr);
+    }
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+JobSystem::JobSystem(const size_t threadCount)
+    : m_queued_jobs(0u),
+      m_stopping(false)
+{
+    const auto workerCount = threadCount > 0u ? threadCount : std::max(std::thread::hardware_concurrency(), 1u);
+
+    m_queues.reserve(workerCount + 1u);
+    for (auto i = 0u; i < workerCount + 1u; i++)
+        m_queues.emplace_back(std::make_unique<JobQueue>());
+
+    m_workers.reserve(workerCount);
+    for (auto i = 0u; i < workerCount; i++)
+        m_workers.emplace_back(&JobSystem::WorkerMain, this, i);
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard lock(m_sleep_mutex);
+        m_stopping = true;
+    }
+
+    m_job_available.notify_all();
+
+    for (auto& worker : m_workers)
+        worker.join();
+}
+
+JobSystem& JobSystem::Instance()
+{
+    static JobSystem instance(sharedThreadCount.load());
+    return instance;
+}
+
+void JobSystem::SetThreadCount(const size_t threadCount)
+{
+    sharedThreadCount = threadCount;
+}
+
+void JobSystem::ParallelFor(const size_t count, const size_t minRangeSize, const std::function<void(size_t begin, size_t end)>& function)
+{
+    const auto maxRangeCount = (count + std::max<size_t>(minRangeSize, 1u) - 1u) / std::max<size_t>(minRangeSize, 1u);
+    const auto rangeCount = std::min(maxRangeCount, GetThreadCount() * RANGES_PER_WORKER);
+    if (rangeCount <= 1u)
+    {
+        if (count > 0u)
+            function(0u, count);
+        return;
+    }
+
+    TaskGroup group(*this);
+    for (auto rangeIndex = 0u; rangeIndex < rangeCount; rangeIndex++)
+    {
+        const auto begin = count * rangeIndex / rangeCount;
+        const auto end = count * (rangeIndex + 1u) / rangeCount;
+        group.Run(
+            [&function, begin, end]
+            {
+                function(begin, end);
+            });
+    }
+
+    group.Wait();
+}
+
+size_t JobSystem::GetThreadCount() const
+{
+    return m_workers.size();
+}
+
+size_t JobSystem::GetOwnQueueIndex() const
+{
+    return currentJobSystem == this ? currentWorkerIndex : m_workers.size();
+}
+
+void JobSystem::Push(job_t job)
+{
+    {
+        // Taking the lock makes sure a worker that is about to sleep sees the new job.
+        // The job is counted before it is queued so the count never drops below the amount of queued jobs.
+        std::lock_guard lock(m_sleep_mutex);
+        m_queued_jobs.fetch_add(1u, std::memory_order_release);
+    }
+
+    {
+        auto& queue = *m_queues[GetOwnQueueIndex()];
+        std::lock_guard lock(queue.m_mutex);
+        queue.m_jobs.emplace_back(std::move(job));
+    }
+
+    m_job_available.notify_one();
+}
+
+bool JobSystem::TryRunJob()
+{
+    const auto ownQueueIndex = GetOwnQueueIndex();
+    const auto queueCount = m_queues.size();
+
+    job_t job;
+
+    // The own queue is used like a stack to keep working on recently created data, other queues are stolen from in order
+    for (auto offset = 0u; offset < queueCount && !job; offset++)
+    {
+        auto& queue = *m_queues[(ownQueueIndex + offset) % queueCount];
+        std::lock_guard lock(queue.m_mutex);
+        if (queue.m_jobs.empty())
+            continue;
+
+        if (offset == 0u)
+        {
+            job = std::move(queue.m_jobs.back());
+            queue.m_jobs.pop_back();
+        }
+        else
+        {
+            job = std::move(queue.m_jobs.front());
+            queue.m_jobs.pop_front();
+        }
+    }
+
+    if (!job)
+        return false;
+
+    m_queued_jobs.fetch_sub(1u, std::memory_order_acq_rel);
+    job();
+
+    return true;
+}
+
+void JobSystem::WorkerMain(const size_t workerIndex)
+{
+    currentJobSystem = this;
+    currentWorkerIndex = workerIndex;
+
+    while (true)
+    {
+        if (TryRunJob())
+            continue;
+
+        std::unique_lock lock(m_sleep_mutex);
+        m_job_available.wait(lock,
+                             [this]
+                             {
+                                 return m_stopping || m_queued_jobs.load(std::memory_order_acquire) > 0u;
+                             });
+
+        // Remaining jobs are still executed when stopping
+        if (m_stopping && m_queued_jobs.load(std::memory_order_acquire) == 0u)
+            return;
+    }
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "ClassUtils.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * \brief A pool of worker threads that is shared by all parallel features of a process so they do not oversubscribe the cores when running at once.
+ * Every worker has its own queue of jobs and steals jobs of other workers when it runs out of jobs.
+ * Threads waiting for jobs to finish help executing jobs instead of blocking, which allows jobs to wait for jobs they started themselves.
+ */
+class JobSystem
+{
+public:
+    using job_t = std::function<void()>;
+
+    /**
+     * \brief A set of jobs that can be waited for together. Exceptions of jobs are rethrown when waiting.
+     */
+    class TaskGroup
+    {
+    public:
+        explicit TaskGroup(JobSystem& jobSystem = Instance());
+        ~TaskGroup();
+        TaskGroup(const TaskGroup& other) = delete;
+        TaskGroup(TaskGroup&& other) noexcept = delete;
+        TaskGroup& operator=(const TaskGroup& other) = delete;
+        TaskGroup& operator=(TaskGroup&& other) noexcept = delete;
+
+        /**
+         * \brief Queues a job of this group for execution on the job system.
+         * \param job The job to execute.
+         */
+        void Run(job_t job);
+
+        /**
+         * \brief Executes jobs until all jobs of this group finished and rethrows the first exception any of them threw.
+         */
+        void Wait();
+
+    private:
+        JobSystem& m_job_system;
+        std::atomic<size_t> m_pending_jobs;
+        std::exception_ptr m_exception;
+        std::mutex m_mutex;
+        std::condition_variable m_finished;
+    };
+
+    /**
+     * \brief Creates a job system with its own workers. Most code should use the shared \c Instance instead.
+     * \param threadCount The amount of worker threads. A value of \c 0 uses one per hardware thread.
+     */
+    explicit JobSystem(size_t threadCount);
+    ~JobSystem();
+    JobSystem(const JobSystem& other) = delete;
+    JobSystem(JobSystem&& other) noexcept = delete;
+    JobSystem& operator=(const JobSystem& other) = delete;
+    JobSystem& operator=(JobSystem&& other) noexcept = delete;
+
+    /**
+     * \brief Returns the job system that is shared by the whole process. It is created on first use.
+     * \return The shared job system.
+     */
+    static JobSystem& Instance();
+
+    /**
+     * \brief Sets the amount of worker threads the shared job system is created with. Has no effect once it was used.
+     * \param threadCount The amount of worker threads. A value of \c 0 uses one per hardware thread.
+     */
+    static void SetThreadCount(size_t threadCount);
+
+    /**
+     * \brief Calls a function for consecutive ranges of [0, count) in parallel and returns once all ranges were processed.
+     * Small counts are processed on the calling thread.
+     * \param count The amount of elements to process.
+     * \param minRangeSize The minimum amount of elements of a range to make distributing them worthwhile.
+     * \param function Processes the elements of a range. Must be safe to call from multiple threads for different ranges at once.
+     */
+    void ParallelFor(size_t count, size_t minRangeSize, const std::function<void(size_t begin, size_t end)>& function);
+
+    _NODISCARD size_t GetThreadCount() const;
+
+private:
+    class JobQueue
+    {
+    public:
+        std::mutex m_mutex;
+        std::deque<job_t> m_jobs;
+    };
+
+    void Push(job_t job);
+    bool TryRunJob();
+    void WorkerMain(size_t workerIndex);
+    _NODISCARD size_t GetOwnQueueIndex() const;
+
+    // One queue per worker and one last queue for jobs of threads that are not workers
+    std::vector<std::unique_ptr<JobQueue>> m_queues;
+    std::vector<std::thread> m_workers;
+    std::atomic<size_t> m_queued_jobs;
+    bool m_stopping;
+
+    std::mutex m_sleep_mutex;
+    std::condition_variable m_job_available;
+};
@@ -0,0 +1,68 @@
+#include "MemoryBudget.h"
+
+#include <cassert>
+
+MemoryBudget::Reservation::Reservation(MemoryBudget& budget, const size_t size)
+    : m_budget(budget),
+      m_size(size)
+{
+    m_budget.Acquire(m_size);
+}
+
+MemoryBudget::Reservation::~Reservation()
+{
+    m_budget.Release(m_size);
+}
+
+MemoryBudget::MemoryBudget(const size_t budget)
+    : m_budget(budget),
+      m_used(0u),
+      m_active_count(0u),
+      m_next_ticket(0u),
+      m_admitted_ticket(0u)
+{
+}
+
+void MemoryBudget::Acquire(const size_t size)
+{
+    std::unique_lock lock(m_mutex);
+
+    const auto ticket = m_next_ticket++;
+    m_changed.wait(lock,
+                   [this, ticket, size]
+                   {
+                       // Work that does not fit into the whole budget runs alone instead of never running
+                       return ticket == m_admitted_ticket && (m_active_count == 0u || (m_used <= m_budget && size <= m_budget - m_used));
+                   });
+
+    m_used += size;
+    m_active_count++;
+    m_admitted_ticket++;
+
+    // The next request may fit as well
+    m_changed.notify_all();
+}
+
+void MemoryBudget::Release(const size_t size)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        assert(m_active_count > 0u && m_used >= size);
+
+        m_used -= size;
+        m_active_count--;
+    }
+
+    m_changed.notify_all();
+}
+
+size_t MemoryBudget::GetBudget() const
+{
+    return m_budget;
+}
+
+size_t MemoryBudget::GetUsed()
+{
+    std::lock_guard lock(m_mutex);
+    return m_used;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "ClassUtils.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+/**
+ * \brief Limits the amount of memory that work running at the same time may use.
+ * Work is admitted in the order it asked for memory, so large work items are not starved by smaller ones asking later.
+ * A work item that is larger than the whole budget is admitted once nothing else uses the budget so it can still run on its own.
+ */
+class MemoryBudget
+{
+public:
+    /**
+     * \brief Memory of a budget that is held until the reservation is destroyed.
+     */
+    class Reservation
+    {
+    public:
+        Reservation(MemoryBudget& budget, size_t size);
+        ~Reservation();
+        Reservation(const Reservation& other) = delete;
+        Reservation(Reservation&& other) noexcept = delete;
+        Reservation& operator=(const Reservation& other) = delete;
+        Reservation& operator=(Reservation&& other) noexcept = delete;
+
+    private:
+        MemoryBudget& m_budget;
+        size_t m_size;
+    };
+
+    /**
+     * \brief Creates a new budget.
+     * \param budget The amount of bytes that may be in use at the same time.
+     */
+    explicit MemoryBudget(size_t budget);
+
+    /**
+     * \brief Blocks until all earlier requests were admitted and the requested memory fits into the budget, then takes it from the budget.
+     * \param size The amount of bytes to take.
+     */
+    void Acquire(size_t size);
+
+    /**
+     * \brief Gives memory that was taken by \c Acquire back to the budget.
+     * \param size The amount of bytes to give back. Must match the amount that was taken.
+     */
+    void Release(size_t size);
+
+    _NODISCARD size_t GetBudget() const;
+    _NODISCARD size_t GetUsed();
+
+private:
+    size_t m_budget;
+    size_t m_used;
+    size_t m_active_count;
+    uint64_t m_next_ticket;
+    uint64_t m_admitted_ticket;
+
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+};
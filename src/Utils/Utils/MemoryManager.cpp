@@ -1,7 +1,17 @@
 #include "MemoryManager.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <iterator>
+#include <utility>
+
+namespace
+{
+    // Allocations larger than this fraction of an arena block are allocated separately to not waste the rest of the block
+    constexpr size_t ARENA_MAX_ALLOCATION_FRACTION = 4u;
+} // namespace
 
 MemoryManager::AllocationInfo::AllocationInfo(IDestructible* data, void* dataPtr)
 {
@@ -9,9 +19,63 @@ MemoryManager::AllocationInfo::AllocationInfo(IDestructible* data, void* dataPtr
     m_data_ptr = dataPtr;
 }
 
-MemoryManager::MemoryManager() = default;
+MemoryManager::MemoryManager()
+    : MemoryManager(0u)
+{
+}
+
+MemoryManager::MemoryManager(const size_t arenaBlockSize)
+    : m_arena_block_size(arenaBlockSize),
+      m_arena_pos(nullptr),
+      m_arena_remaining(0u),
+      m_allocated_size(0u)
+{
+}
+
+// The moved-from memory manager must not keep allocating from an arena block that it does not own anymore
+MemoryManager::MemoryManager(MemoryManager&& other) noexcept
+    : m_allocations(std::move(other.m_allocations)),
+      m_destructible(std::move(other.m_destructible)),
+      m_arena_block_size(other.m_arena_block_size),
+      m_arena_blocks(std::move(other.m_arena_blocks)),
+      m_arena_pos(std::exchange(other.m_arena_pos, nullptr)),
+      m_arena_remaining(std::exchange(other.m_arena_remaining, 0u)),
+      m_allocated_size(std::exchange(other.m_allocated_size, 0u))
+{
+    other.m_allocations.clear();
+    other.m_destructible.clear();
+    other.m_arena_blocks.clear();
+}
+
+MemoryManager& MemoryManager::operator=(MemoryManager&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    FreeAll();
+
+    m_allocations = std::move(other.m_allocations);
+    other.m_allocations.clear();
+    m_destructible = std::move(other.m_destructible);
+    other.m_destructible.clear();
+
+    m_arena_block_size = other.m_arena_block_size;
+    m_arena_blocks = std::move(other.m_arena_blocks);
+    other.m_arena_blocks.clear();
+    m_arena_pos = std::exchange(other.m_arena_pos, nullptr);
+    m_arena_remaining = std::exchange(other.m_arena_remaining, 0u);
+
+    m_allocated_size = std::exchange(other.m_allocated_size, 0u);
+
+    return *this;
+}
 
 MemoryManager::~MemoryManager()
+{
+    FreeAll();
+}
+
+void MemoryManager::FreeAll()
 {
     for (auto allocation : m_allocations)
     {
@@ -24,10 +88,51 @@ MemoryManager::~MemoryManager()
         delete destructible.m_data;
     }
     m_destructible.clear();
+
+    for (auto* block : m_arena_blocks)
+    {
+        free(block);
+    }
+    m_arena_blocks.clear();
+    m_arena_pos = nullptr;
+    m_arena_remaining = 0u;
+    m_allocated_size = 0u;
+}
+
+void* MemoryManager::AllocArena(const size_t size)
+{
+    // Align to the largest power of two the size is a multiple of since that is always a valid alignment for the allocated type
+    const auto alignment = std::min(size & (~size + 1u), alignof(std::max_align_t));
+    const auto padding = (alignment - reinterpret_cast<uintptr_t>(m_arena_pos) % alignment) % alignment;
+
+    if (m_arena_pos == nullptr || padding + size > m_arena_remaining)
+    {
+        // Blocks are zero initialized and suitably aligned for any type
+        auto* block = calloc(m_arena_block_size, 1u);
+        m_arena_blocks.push_back(block);
+        m_arena_pos = static_cast<char*>(block);
+        m_arena_remaining = m_arena_block_size;
+    }
+    else
+    {
+        m_arena_pos += padding;
+        m_arena_remaining -= padding;
+    }
+
+    auto* result = m_arena_pos;
+    m_arena_pos += size;
+    m_arena_remaining -= size;
+
+    return result;
 }
 
 void* MemoryManager::AllocRaw(const size_t size)
 {
+    m_allocated_size += size;
+
+    if (m_arena_block_size > 0u && size > 0u && size <= m_arena_block_size / ARENA_MAX_ALLOCATION_FRACTION)
+        return AllocArena(size);
+
     void* result = calloc(size, 1u);
     m_allocations.push_back(result);
 
@@ -36,24 +141,36 @@ void* MemoryManager::AllocRaw(const size_t size)
 
 char* MemoryManager::Dup(const char* str)
 {
+    if (m_arena_block_size > 0u)
+    {
+        const auto size = strlen(str) + 1u;
+        auto* result = static_cast<char*>(AllocRaw(size));
+        memcpy(result, str, size);
+
+        return result;
+    }
+
 #ifdef _MSC_VER
     auto* result = _strdup(str);
 #else
     auto* result = strdup(str);
 #endif
     m_allocations.push_back(result);
+    m_allocated_size += strlen(str) + 1u;
 
     return result;
 }
 
 void MemoryManager::Free(const void* data)
 {
-    for (auto iAlloc = m_allocations.begin(); iAlloc != m_allocations.end(); ++iAlloc)
+    // Memory is usually freed shortly after it was allocated so search from the back.
+    // Arena memory is not tracked individually and will not be found.
+    for (auto iAlloc = m_allocations.rbegin(); iAlloc != m_allocations.rend(); ++iAlloc)
     {
         if (*iAlloc == data)
         {
             free(*iAlloc);
-            m_allocations.erase(iAlloc);
+            m_allocations.erase(std::next(iAlloc).base());
             return;
         }
     }
@@ -61,13 +178,36 @@ void MemoryManager::Free(const void* data)
 
 void MemoryManager::Delete(const void* data)
 {
-    for (auto iAlloc = m_destructible.begin(); iAlloc != m_destructible.end(); ++iAlloc)
+    for (auto iAlloc = m_destructible.rbegin(); iAlloc != m_destructible.rend(); ++iAlloc)
     {
         if (iAlloc->m_data_ptr == data)
         {
             delete iAlloc->m_data;
-            m_destructible.erase(iAlloc);
+            m_destructible.erase(std::next(iAlloc).base());
             return;
         }
     }
 }
+
+void MemoryManager::TakeOwnership(MemoryManager& other)
+{
+    m_allocations.insert(m_allocations.end(), other.m_allocations.begin(), other.m_allocations.end());
+    other.m_allocations.clear();
+
+    m_destructible.insert(m_destructible.end(), other.m_destructible.begin(), other.m_destructible.end());
+    other.m_destructible.clear();
+
+    // The current arena block of this memory manager stays the one to allocate from
+    m_arena_blocks.insert(m_arena_blocks.end(), other.m_arena_blocks.begin(), other.m_arena_blocks.end());
+    other.m_arena_blocks.clear();
+    other.m_arena_pos = nullptr;
+    other.m_arena_remaining = 0u;
+
+    m_allocated_size += other.m_allocated_size;
+    other.m_allocated_size = 0u;
+}
+
+size_t MemoryManager::GetAllocatedSize() const
+{
+    return m_allocated_size;
+}
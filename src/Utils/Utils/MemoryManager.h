@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ClassUtils.h"
+
 #include <cstddef>
 #include <type_traits>
 #include <vector>
@@ -48,13 +50,30 @@ class MemoryManager
     std::vector<void*> m_allocations;
     std::vector<AllocationInfo> m_destructible;
 
+    size_t m_arena_block_size;
+    std::vector<void*> m_arena_blocks;
+    char* m_arena_pos;
+    size_t m_arena_remaining;
+
+    size_t m_allocated_size;
+
+    void* AllocArena(size_t size);
+    void FreeAll();
+
 public:
     MemoryManager();
+
+    /**
+     * \brief Creates a memory manager that serves small allocations from arena blocks of the specified size.
+     * Arena memory is only released when the memory manager is destroyed, freeing it is a no-op.
+     * \param arenaBlockSize The size of a single arena block or \c 0 to allocate every entry separately.
+     */
+    explicit MemoryManager(size_t arenaBlockSize);
     virtual ~MemoryManager();
     MemoryManager(const MemoryManager& other) = delete;
-    MemoryManager(MemoryManager&& other) noexcept = default;
+    MemoryManager(MemoryManager&& other) noexcept;
     MemoryManager& operator=(const MemoryManager& other) = delete;
-    MemoryManager& operator=(MemoryManager&& other) noexcept = default;
+    MemoryManager& operator=(MemoryManager&& other) noexcept;
 
     void* AllocRaw(size_t size);
     char* Dup(const char* str);
@@ -68,9 +87,23 @@ public:
     {
         Allocation<T>* allocation = new Allocation<T>(std::forward<ValType>(val)...);
         m_destructible.emplace_back(allocation, &allocation->m_entry);
+        m_allocated_size += sizeof(Allocation<T>);
         return &allocation->m_entry;
     }
 
     void Free(const void* data);
     void Delete(const void* data);
+
+    /**
+     * \brief Takes over all memory of another memory manager so it lives as long as this memory manager.
+     * Pointers to the memory stay valid and the other memory manager is left without any memory.
+     * \param other The memory manager to take the memory of.
+     */
+    void TakeOwnership(MemoryManager& other);
+
+    /**
+     * \brief Returns the amount of bytes that were requested from this memory manager, including memory taken over from other memory managers.
+     * Freed memory is not subtracted and the overhead of arena blocks is not included.
+     */
+    _NODISCARD size_t GetAllocatedSize() const;
 };
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "ClassUtils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class MemoryMappedFile
+{
+    const uint8_t* m_data;
+    size_t m_size;
+
+#ifdef _WIN32
+    void* m_file_handle;
+    void* m_mapping_handle;
+#endif
+
+public:
+    MemoryMappedFile();
+    ~MemoryMappedFile();
+    MemoryMappedFile(const MemoryMappedFile& other) = delete;
+    MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+    MemoryMappedFile& operator=(const MemoryMappedFile& other) = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+    /**
+     * \brief Maps the entire file at the specified path into memory for reading.
+     * \param path The path of the file to map.
+     * \return \c true if the file could be mapped, otherwise \c false. Empty files cannot be mapped.
+     */
+    bool Open(const std::string& path);
+    void Close();
+
+    _NODISCARD bool IsOpen() const;
+    _NODISCARD const uint8_t* GetData() const;
+    _NODISCARD size_t GetSize() const;
+};
@@ -0,0 +1,60 @@
+#include "PathTemplate.h"
+
+#include <algorithm>
+
+PathTemplate::PathTemplate(const std::string_view text, const std::initializer_list<std::string_view> placeholders)
+{
+    size_t position = 0u;
+    while (position < text.size())
+    {
+        // The placeholder that occurs first is substituted first
+        auto nextPosition = std::string_view::npos;
+        auto nextPlaceholderIndex = LITERAL;
+        auto placeholderIndex = 0u;
+        for (const auto& placeholder : placeholders)
+        {
+            const auto foundPosition = placeholder.empty() ? std::string_view::npos : text.find(placeholder, position);
+            if (foundPosition < nextPosition)
+            {
+                nextPosition = foundPosition;
+                nextPlaceholderIndex = placeholderIndex;
+            }
+            placeholderIndex++;
+        }
+
+        if (nextPosition == std::string_view::npos)
+        {
+            m_segments.emplace_back(Segment{std::string(text.substr(position)), LITERAL});
+            break;
+        }
+
+        if (nextPosition > position)
+            m_segments.emplace_back(Segment{std::string(text.substr(position, nextPosition - position)), LITERAL});
+        m_segments.emplace_back(Segment{std::string(), nextPlaceholderIndex});
+
+        position = nextPosition + placeholders.begin()[nextPlaceholderIndex].size();
+    }
+}
+
+bool PathTemplate::Uses(const size_t placeholderIndex) const
+{
+    return std::ranges::any_of(m_segments,
+                               [placeholderIndex](const Segment& segment)
+                               {
+                                   return segment.m_placeholder_index == placeholderIndex;
+                               });
+}
+
+std::string PathTemplate::Resolve(const std::initializer_list<std::string_view> values) const
+{
+    std::string result;
+    for (const auto& segment : m_segments)
+    {
+        if (segment.m_placeholder_index == LITERAL)
+            result += segment.m_text;
+        else if (segment.m_placeholder_index < values.size())
+            result += values.begin()[segment.m_placeholder_index];
+    }
+
+    return result;
+}
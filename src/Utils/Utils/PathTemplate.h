@@ -0,0 +1,53 @@
+#pragma once
+
+#include "ClassUtils.h"
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * \brief A path with placeholders like \c ?zone? that is split into literal text and placeholders once, so resolving it only concatenates strings.
+ * Placeholders are substituted in a single pass, values containing placeholders themselves are not substituted again.
+ */
+class PathTemplate
+{
+public:
+    PathTemplate() = default;
+
+    /**
+     * \brief Compiles a path template.
+     * \param text The path containing the placeholders.
+     * \param placeholders The placeholders to substitute. Their index is used to refer to them when resolving the path.
+     */
+    PathTemplate(std::string_view text, std::initializer_list<std::string_view> placeholders);
+
+    /**
+     * \brief Checks whether the path contains a placeholder.
+     * \param placeholderIndex The index of the placeholder when the template was compiled.
+     * \return \c true if the path contains the placeholder at least once, otherwise \c false.
+     */
+    _NODISCARD bool Uses(size_t placeholderIndex) const;
+
+    /**
+     * \brief Substitutes all placeholders of the path.
+     * \param values The value for each placeholder in the same order the placeholders were specified in when compiling the template.
+     * Placeholders without value are substituted with an empty string.
+     * \return The resolved path.
+     */
+    _NODISCARD std::string Resolve(std::initializer_list<std::string_view> values) const;
+
+private:
+    static constexpr auto LITERAL = static_cast<size_t>(-1);
+
+    class Segment
+    {
+    public:
+        std::string m_text;
+        size_t m_placeholder_index;
+    };
+
+    std::vector<Segment> m_segments;
+};
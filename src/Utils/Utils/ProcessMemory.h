@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstddef>
+
+namespace process_memory
+{
+    /**
+     * \brief Returns the largest amount of physical memory the current process has used since it was started.
+     * \return The peak resident set size in bytes or \c 0 if it could not be determined.
+     */
+    size_t GetPeakUsage();
+} // namespace process_memory
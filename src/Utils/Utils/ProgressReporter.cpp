@@ -0,0 +1,221 @@
+#include "ProgressReporter.h"
+
+#include <algorithm>
+#include <iomanip>
+
+using namespace progress;
+
+namespace
+{
+    constexpr unsigned PERCENTAGE_STEP = 10u;
+
+    unsigned GetPercentage(const uint64_t value, const uint64_t total)
+    {
+        if (total == 0u)
+            return 100u;
+
+        return static_cast<unsigned>(std::min<uint64_t>(value * 100u / total, 100u));
+    }
+
+    double ToMebibytes(const uint64_t byteCount)
+    {
+        return static_cast<double>(byteCount) / (1024.0 * 1024.0);
+    }
+
+    void WriteJsonString(std::ostream& stream, const std::string& value)
+    {
+        stream << '"';
+        for (const auto c : value)
+        {
+            if (c == '"' || c == '\\')
+                stream << '\\' << c;
+            else if (static_cast<unsigned char>(c) < 0x20u)
+                stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<unsigned>(c) << std::dec << std::setfill(' ');
+            else
+                stream << c;
+        }
+        stream << '"';
+    }
+} // namespace
+
+TextProgressReporter::TextProgressReporter(std::ostream& stream)
+    : m_stream(stream)
+{
+}
+
+void TextProgressReporter::OnZoneLoadStarted(const std::string& zoneName, const uint64_t totalBytes)
+{
+    std::lock_guard lock(m_mutex);
+    m_printed_load_percentages[zoneName] = 0u;
+    m_stream << "Loading zone \"" << zoneName << "\" (" << std::fixed << std::setprecision(1) << ToMebibytes(totalBytes) << " MiB)\n"
+             << std::defaultfloat << std::setprecision(6);
+}
+
+void TextProgressReporter::OnZoneLoadProgress(const std::string& zoneName, const uint64_t consumedBytes, const uint64_t totalBytes)
+{
+    const auto percentage = GetPercentage(consumedBytes, totalBytes) / PERCENTAGE_STEP * PERCENTAGE_STEP;
+
+    std::lock_guard lock(m_mutex);
+    auto& printedPercentage = m_printed_load_percentages[zoneName];
+    if (percentage <= printedPercentage || percentage >= 100u)
+        return;
+
+    printedPercentage = percentage;
+    m_stream << "Loading zone \"" << zoneName << "\": " << percentage << "%\n";
+}
+
+void TextProgressReporter::OnZoneLoadFinished(const std::string& zoneName, const bool success, const size_t assetCount)
+{
+    std::lock_guard lock(m_mutex);
+    m_printed_load_percentages.erase(zoneName);
+
+    if (success)
+        m_stream << "Loaded zone \"" << zoneName << "\" with " << assetCount << " assets\n";
+    else
+        m_stream << "Failed to load zone \"" << zoneName << "\"\n";
+}
+
+void TextProgressReporter::OnZoneDumpStarted(const std::string& zoneName, const size_t assetCount)
+{
+    std::lock_guard lock(m_mutex);
+    m_dump_progress[zoneName] = DumpProgress{assetCount, 0u, 0u};
+    m_stream << "Dumping zone \"" << zoneName << "\" with " << assetCount << " assets\n";
+}
+
+void TextProgressReporter::OnAssetDumped(const std::string& zoneName, const std::string& assetName)
+{
+    std::lock_guard lock(m_mutex);
+    auto& dumpProgress = m_dump_progress[zoneName];
+    dumpProgress.m_dumped_asset_count++;
+
+    const auto percentage = GetPercentage(dumpProgress.m_dumped_asset_count, dumpProgress.m_asset_count) / PERCENTAGE_STEP * PERCENTAGE_STEP;
+    if (percentage <= dumpProgress.m_printed_percentage || percentage >= 100u)
+        return;
+
+    dumpProgress.m_printed_percentage = percentage;
+    m_stream << "Dumping zone \"" << zoneName << "\": " << percentage << "%\n";
+}
+
+void TextProgressReporter::OnZoneDumpFinished(const std::string& zoneName, const bool success, const uint64_t writtenBytes)
+{
+    std::lock_guard lock(m_mutex);
+    const auto dumpProgress = m_dump_progress.find(zoneName);
+    const auto dumpedAssetCount = dumpProgress != m_dump_progress.end() ? dumpProgress->second.m_dumped_asset_count : 0u;
+    if (dumpProgress != m_dump_progress.end())
+        m_dump_progress.erase(dumpProgress);
+
+    if (success)
+        m_stream << "Dumped " << dumpedAssetCount << " assets of zone \"" << zoneName << "\" (" << std::fixed << std::setprecision(1) << ToMebibytes(writtenBytes)
+                 << " MiB)\n"
+                 << std::defaultfloat << std::setprecision(6);
+    else
+        m_stream << "Failed to dump zone \"" << zoneName << "\" after " << dumpedAssetCount << " assets\n";
+}
+
+void TextProgressReporter::OnFileWritten(const std::string& fileName, const uint64_t byteCount)
+{
+    std::lock_guard lock(m_mutex);
+    m_stream << "Wrote \"" << fileName << "\" (" << std::fixed << std::setprecision(1) << ToMebibytes(byteCount) << " MiB)\n"
+             << std::defaultfloat << std::setprecision(6);
+}
+
+JsonProgressReporter::JsonProgressReporter(std::ostream& stream)
+    : m_stream(stream),
+      m_start(std::chrono::steady_clock::now())
+{
+}
+
+void JsonProgressReporter::BeginEvent(const char* eventName)
+{
+    const auto time = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+
+    m_stream << "{\"event\":\"" << eventName << "\",\"time\":" << std::fixed << std::setprecision(6) << time << std::defaultfloat;
+}
+
+void JsonProgressReporter::EndEvent()
+{
+    // Flush every event so that readers of a pipe see it immediately
+    m_stream << "}\n" << std::flush;
+}
+
+void JsonProgressReporter::OnZoneLoadStarted(const std::string& zoneName, const uint64_t totalBytes)
+{
+    std::lock_guard lock(m_mutex);
+    BeginEvent("zoneLoadStarted");
+    m_stream << ",\"zone\":";
+    WriteJsonString(m_stream, zoneName);
+    m_stream << ",\"totalBytes\":" << totalBytes;
+    EndEvent();
+}
+
+void JsonProgressReporter::OnZoneLoadProgress(const std::string& zoneName, const uint64_t consumedBytes, const uint64_t totalBytes)
+{
+    std::lock_guard lock(m_mutex);
+    BeginEvent("zoneLoadProgress");
+    m_stream << ",\"zone\":";
+    WriteJsonString(m_stream, zoneName);
+    m_stream << ",\"consumedBytes\":" << consumedBytes << ",\"totalBytes\":" << totalBytes;
+    EndEvent();
+}
+
+void JsonProgressReporter::OnZoneLoadFinished(const std::string& zoneName, const bool success, const size_t assetCount)
+{
+    std::lock_guard lock(m_mutex);
+    BeginEvent("zoneLoadFinished");
+    m_stream << ",\"zone\":";
+    WriteJsonString(m_stream, zoneName);
+    m_stream << ",\"success\":" << (success ? "true" : "false") << ",\"assets\":" << assetCount;
+    EndEvent();
+}
+
+void JsonProgressReporter::OnZoneDumpStarted(const std::string& zoneName, const size_t assetCount)
+{
+    std::lock_guard lock(m_mutex);
+    BeginEvent("zoneDumpStarted");
+    m_stream << ",\"zone\":";
+    WriteJsonString(m_stream, zoneName);
+    m_stream << ",\"assets\":" << assetCount;
+    EndEvent();
+}
+
+void JsonProgressReporter::OnAssetDumped(const std::string& zoneName, const std::string& assetName)
+{
+    std::lock_guard lock(m_mutex);
+    BeginEvent("assetDumped");
+    m_stream << ",\"zone\":";
+    WriteJsonString(m_stream, zoneName);
+    m_stream << ",\"asset\":";
+    WriteJsonString(m_stream, assetName);
+    EndEvent();
+}
+
+void JsonProgressReporter::OnZoneDumpFinished(const std::string& zoneName, const bool success, const uint64_t writtenBytes)
+{
+    std::lock_guard lock(m_mutex);
+    BeginEvent("zoneDumpFinished");
+    m_stream << ",\"zone\":";
+    WriteJsonString(m_stream, zoneName);
+    m_stream << ",\"success\":" << (success ? "true" : "false") << ",\"writtenBytes\":" << writtenBytes;
+    EndEvent();
+}
+
+void JsonProgressReporter::OnFileWritten(const std::string& fileName, const uint64_t byteCount)
+{
+    std::lock_guard lock(m_mutex);
+    BeginEvent("fileWritten");
+    m_stream << ",\"file\":";
+    WriteJsonString(m_stream, fileName);
+    m_stream << ",\"bytes\":" << byteCount;
+    EndEvent();
+}
+
+std::unique_ptr<IProgressReporter> progress::CreateProgressReporter(const std::string& formatName, std::ostream& stream)
+{
+    if (formatName == "text")
+        return std::make_unique<TextProgressReporter>(stream);
+
+    if (formatName == "json")
+        return std::make_unique<JsonProgressReporter>(stream);
+
+    return nullptr;
+}
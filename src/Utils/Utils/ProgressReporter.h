@@ -0,0 +1,141 @@
+#pragma once
+
+#include "ClassUtils.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace progress
+{
+    /**
+     * \brief Receives events about the progress of long running jobs like loading, dumping and writing zones.
+     * Events can be reported from multiple threads at once, so implementations must be thread safe.
+     */
+    class IProgressReporter
+    {
+    public:
+        IProgressReporter() = default;
+        virtual ~IProgressReporter() = default;
+        IProgressReporter(const IProgressReporter& other) = default;
+        IProgressReporter(IProgressReporter&& other) noexcept = default;
+        IProgressReporter& operator=(const IProgressReporter& other) = default;
+        IProgressReporter& operator=(IProgressReporter&& other) noexcept = default;
+
+        /**
+         * \brief Reports that loading a zone started.
+         * \param zoneName The name of the zone.
+         * \param totalBytes The size of the zone file in bytes.
+         */
+        virtual void OnZoneLoadStarted(const std::string& zoneName, uint64_t totalBytes) = 0;
+
+        /**
+         * \brief Reports how much of a zone file was consumed so far. Reported in steps instead of for every read.
+         * \param zoneName The name of the zone.
+         * \param consumedBytes The amount of bytes of the zone file that were consumed so far.
+         * \param totalBytes The size of the zone file in bytes.
+         */
+        virtual void OnZoneLoadProgress(const std::string& zoneName, uint64_t consumedBytes, uint64_t totalBytes) = 0;
+
+        /**
+         * \brief Reports that loading a zone finished.
+         * \param zoneName The name of the zone.
+         * \param success Whether the zone could be loaded.
+         * \param assetCount The amount of assets that were loaded.
+         */
+        virtual void OnZoneLoadFinished(const std::string& zoneName, bool success, size_t assetCount) = 0;
+
+        /**
+         * \brief Reports that dumping a zone started.
+         * \param zoneName The name of the zone.
+         * \param assetCount The amount of assets in the zone. Assets that are skipped are not reported as dumped.
+         */
+        virtual void OnZoneDumpStarted(const std::string& zoneName, size_t assetCount) = 0;
+        virtual void OnAssetDumped(const std::string& zoneName, const std::string& assetName) = 0;
+
+        /**
+         * \brief Reports that dumping a zone finished.
+         * \param zoneName The name of the zone.
+         * \param success Whether the zone could be dumped.
+         * \param writtenBytes The amount of bytes written to all files that assets were dumped to.
+         */
+        virtual void OnZoneDumpFinished(const std::string& zoneName, bool success, uint64_t writtenBytes) = 0;
+
+        /**
+         * \brief Reports that a file was written completely.
+         * \param fileName The name of the file.
+         * \param byteCount The size of the written file in bytes.
+         */
+        virtual void OnFileWritten(const std::string& fileName, uint64_t byteCount) = 0;
+    };
+
+    /**
+     * \brief Prints progress as human readable lines. Load and dump progress is printed in steps of ten percent.
+     */
+    class TextProgressReporter final : public IProgressReporter
+    {
+    public:
+        explicit TextProgressReporter(std::ostream& stream);
+
+        void OnZoneLoadStarted(const std::string& zoneName, uint64_t totalBytes) override;
+        void OnZoneLoadProgress(const std::string& zoneName, uint64_t consumedBytes, uint64_t totalBytes) override;
+        void OnZoneLoadFinished(const std::string& zoneName, bool success, size_t assetCount) override;
+        void OnZoneDumpStarted(const std::string& zoneName, size_t assetCount) override;
+        void OnAssetDumped(const std::string& zoneName, const std::string& assetName) override;
+        void OnZoneDumpFinished(const std::string& zoneName, bool success, uint64_t writtenBytes) override;
+        void OnFileWritten(const std::string& fileName, uint64_t byteCount) override;
+
+    private:
+        class DumpProgress
+        {
+        public:
+            size_t m_asset_count;
+            size_t m_dumped_asset_count;
+            unsigned m_printed_percentage;
+        };
+
+        std::ostream& m_stream;
+        std::unordered_map<std::string, unsigned> m_printed_load_percentages;
+        std::unordered_map<std::string, DumpProgress> m_dump_progress;
+        std::mutex m_mutex;
+    };
+
+    /**
+     * \brief Writes every event as a single line json object, which makes the progress readable by other programs.
+     * Every object has an \c event name and the \c time in seconds since the reporter was created.
+     */
+    class JsonProgressReporter final : public IProgressReporter
+    {
+    public:
+        explicit JsonProgressReporter(std::ostream& stream);
+
+        void OnZoneLoadStarted(const std::string& zoneName, uint64_t totalBytes) override;
+        void OnZoneLoadProgress(const std::string& zoneName, uint64_t consumedBytes, uint64_t totalBytes) override;
+        void OnZoneLoadFinished(const std::string& zoneName, bool success, size_t assetCount) override;
+        void OnZoneDumpStarted(const std::string& zoneName, size_t assetCount) override;
+        void OnAssetDumped(const std::string& zoneName, const std::string& assetName) override;
+        void OnZoneDumpFinished(const std::string& zoneName, bool success, uint64_t writtenBytes) override;
+        void OnFileWritten(const std::string& fileName, uint64_t byteCount) override;
+
+    private:
+        void BeginEvent(const char* eventName);
+        void EndEvent();
+
+        std::ostream& m_stream;
+        std::chrono::steady_clock::time_point m_start;
+        std::mutex m_mutex;
+    };
+
+    /**
+     * \brief Creates a reporter for the output format with the specified name.
+     * \param formatName Either \c text or \c json.
+     * \param stream The stream to report to. Must outlive the reporter.
+     * \return The created reporter or \c nullptr if the format is unknown.
+     */
+    _NODISCARD std::unique_ptr<IProgressReporter> CreateProgressReporter(const std::string& formatName, std::ostream& stream);
+} // namespace progress
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "ClassUtils.h"
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**
+ * \brief A queue that keeps its elements in a single growing allocation that is reused when elements are removed from the front.
+ * Unlike a deque, adding and removing elements does not allocate once the buffer is large enough.
+ * \tparam T The type of the elements. It must be move constructible.
+ */
+template<typename T> class RingBuffer
+{
+    static constexpr size_t INITIAL_CAPACITY = 16u;
+
+    T* m_elements;
+    size_t m_capacity;
+    size_t m_head;
+    size_t m_size;
+
+    T* ElementAt(const size_t index) const
+    {
+        // Capacity is always a power of two
+        return &m_elements[(m_head + index) & (m_capacity - 1u)];
+    }
+
+    void Grow()
+    {
+        const auto newCapacity = m_capacity == 0u ? INITIAL_CAPACITY : m_capacity * 2u;
+        auto* newElements = static_cast<T*>(::operator new(sizeof(T) * newCapacity, std::align_val_t(alignof(T))));
+
+        for (auto i = 0u; i < m_size; i++)
+        {
+            auto* element = ElementAt(i);
+            std::construct_at(&newElements[i], std::move(*element));
+            std::destroy_at(element);
+        }
+
+        Release();
+        m_elements = newElements;
+        m_capacity = newCapacity;
+        m_head = 0u;
+    }
+
+    void Release()
+    {
+        if (m_elements)
+            ::operator delete(m_elements, std::align_val_t(alignof(T)));
+    }
+
+public:
+    RingBuffer()
+        : m_elements(nullptr),
+          m_capacity(0u),
+          m_head(0u),
+          m_size(0u)
+    {
+    }
+
+    ~RingBuffer()
+    {
+        clear();
+        Release();
+    }
+
+    RingBuffer(const RingBuffer& other) = delete;
+    RingBuffer& operator=(const RingBuffer& other) = delete;
+
+    RingBuffer(RingBuffer&& other) noexcept
+        : m_elements(std::exchange(other.m_elements, nullptr)),
+          m_capacity(std::exchange(other.m_capacity, 0u)),
+          m_head(std::exchange(other.m_head, 0u)),
+          m_size(std::exchange(other.m_size, 0u))
+    {
+    }
+
+    RingBuffer& operator=(RingBuffer&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            Release();
+            m_elements = std::exchange(other.m_elements, nullptr);
+            m_capacity = std::exchange(other.m_capacity, 0u);
+            m_head = std::exchange(other.m_head, 0u);
+            m_size = std::exchange(other.m_size, 0u);
+        }
+
+        return *this;
+    }
+
+    _NODISCARD size_t size() const
+    {
+        return m_size;
+    }
+
+    _NODISCARD bool empty() const
+    {
+        return m_size == 0u;
+    }
+
+    T& operator[](const size_t index)
+    {
+        assert(index < m_size);
+        return *ElementAt(index);
+    }
+
+    const T& operator[](const size_t index) const
+    {
+        assert(index < m_size);
+        return *ElementAt(index);
+    }
+
+    T& front()
+    {
+        return (*this)[0u];
+    }
+
+    const T& front() const
+    {
+        return (*this)[0u];
+    }
+
+    T& back()
+    {
+        return (*this)[m_size - 1u];
+    }
+
+    const T& back() const
+    {
+        return (*this)[m_size - 1u];
+    }
+
+    template<typename... Args> T& emplace_back(Args&&... args)
+    {
+        if (m_size == m_capacity)
+            Grow();
+
+        auto* element = std::construct_at(ElementAt(m_size), std::forward<Args>(args)...);
+        m_size++;
+
+        return *element;
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    void pop_front()
+    {
+        assert(m_size > 0u);
+        std::destroy_at(ElementAt(0u));
+        m_head = (m_head + 1u) & (m_capacity - 1u);
+        m_size--;
+    }
+
+    void clear()
+    {
+        while (m_size > 0u)
+            pop_front();
+        m_head = 0u;
+    }
+};
@@ -5,42 +5,74 @@
 
 namespace utils
 {
-    std::string EscapeStringForQuotationMarks(const std::string_view& str)
+    namespace
     {
-        std::ostringstream ss;
-        EscapeStringForQuotationMarks(ss, str);
-        return ss.str();
-    }
+        constexpr std::string_view CHARACTERS_TO_ESCAPE = "\r\n\t\f\"\\";
 
-    void EscapeStringForQuotationMarks(std::ostream& stream, const std::string_view& str)
-    {
-        for (const auto& c : str)
+        const char* GetEscapeSequence(const char c)
         {
             switch (c)
             {
             case '\r':
-                stream << "\\r";
-                break;
+                return "\\r";
             case '\n':
-                stream << "\\n";
-                break;
+                return "\\n";
             case '\t':
-                stream << "\\t";
-                break;
+                return "\\t";
             case '\f':
-                stream << "\\f";
-                break;
+                return "\\f";
             case '"':
-                stream << "\\\"";
-                break;
-            case '\\':
-                stream << "\\\\";
-                break;
+                return "\\\"";
             default:
-                stream << c;
-                break;
+                return "\\\\";
+            }
+        }
+
+        // Unescaped spans are passed on as a whole instead of character by character
+        template<typename AppendFunc> void EscapeSpans(const std::string_view& str, AppendFunc append)
+        {
+            size_t spanStart = 0u;
+            auto escapePos = str.find_first_of(CHARACTERS_TO_ESCAPE);
+            while (escapePos != std::string_view::npos)
+            {
+                if (escapePos > spanStart)
+                    append(str.substr(spanStart, escapePos - spanStart));
+
+                append(std::string_view(GetEscapeSequence(str[escapePos]), 2u));
+
+                spanStart = escapePos + 1u;
+                escapePos = str.find_first_of(CHARACTERS_TO_ESCAPE, spanStart);
             }
+
+            if (spanStart < str.size())
+                append(str.substr(spanStart));
         }
+    } // namespace
+
+    std::string EscapeStringForQuotationMarks(const std::string_view& str)
+    {
+        std::string result;
+        result.reserve(str.size());
+        EscapeStringForQuotationMarks(result, str);
+        return result;
+    }
+
+    void EscapeStringForQuotationMarks(std::ostream& stream, const std::string_view& str)
+    {
+        EscapeSpans(str,
+                    [&stream](const std::string_view& span)
+                    {
+                        stream.write(span.data(), static_cast<std::streamsize>(span.size()));
+                    });
+    }
+
+    void EscapeStringForQuotationMarks(std::string& buffer, const std::string_view& str)
+    {
+        EscapeSpans(str,
+                    [&buffer](const std::string_view& span)
+                    {
+                        buffer.append(span);
+                    });
     }
 
     std::string UnescapeStringFromQuotationMarks(const std::string_view& str)
@@ -10,6 +10,7 @@ namespace utils
 
     std::string EscapeStringForQuotationMarks(const std::string_view& str);
     void EscapeStringForQuotationMarks(std::ostream& stream, const std::string_view& str);
+    void EscapeStringForQuotationMarks(std::string& buffer, const std::string_view& str);
     std::string UnescapeStringFromQuotationMarks(const std::string_view& str);
     void UnescapeStringFromQuotationMarks(std::ostream& stream, const std::string_view& str);
 
@@ -0,0 +1,107 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cassert>
+
+ThreadPool::ThreadPool(const size_t threadCount, const size_t maxQueuedJobs)
+    : m_max_queued_jobs(maxQueuedJobs),
+      m_active_jobs(0u),
+      m_stopping(false)
+{
+    const auto workerCount = threadCount > 0u ? threadCount : GetDefaultThreadCount();
+
+    m_workers.reserve(workerCount);
+    for (auto i = 0u; i < workerCount; i++)
+        m_workers.emplace_back(&ThreadPool::WorkerMain, this);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+
+    m_job_available.notify_all();
+
+    for (auto& worker : m_workers)
+        worker.join();
+}
+
+void ThreadPool::WorkerMain()
+{
+    while (true)
+    {
+        job_t job;
+
+        {
+            std::unique_lock lock(m_mutex);
+            m_job_available.wait(lock,
+                                 [this]
+                                 {
+                                     return m_stopping || !m_jobs.empty();
+                                 });
+
+            // Remaining jobs are still executed when stopping
+            if (m_jobs.empty())
+                return;
+
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+            m_active_jobs++;
+        }
+
+        m_slot_available.notify_one();
+
+        job();
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_active_jobs--;
+
+            if (m_active_jobs == 0u && m_jobs.empty())
+                m_idle.notify_all();
+        }
+    }
+}
+
+void ThreadPool::Enqueue(job_t job)
+{
+    assert(job);
+
+    {
+        std::unique_lock lock(m_mutex);
+        if (m_max_queued_jobs > 0u)
+        {
+            m_slot_available.wait(lock,
+                                  [this]
+                                  {
+                                      return m_jobs.size() < m_max_queued_jobs;
+                                  });
+        }
+
+        m_jobs.emplace_back(std::move(job));
+    }
+
+    m_job_available.notify_one();
+}
+
+void ThreadPool::WaitForIdle()
+{
+    std::unique_lock lock(m_mutex);
+    m_idle.wait(lock,
+                [this]
+                {
+                    return m_active_jobs == 0u && m_jobs.empty();
+                });
+}
+
+size_t ThreadPool::GetThreadCount() const
+{
+    return m_workers.size();
+}
+
+size_t ThreadPool::GetDefaultThreadCount()
+{
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
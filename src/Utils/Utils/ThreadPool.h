@@ -0,0 +1,60 @@
+#pragma once
+
+#include "ClassUtils.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+public:
+    using job_t = std::function<void()>;
+
+private:
+    std::vector<std::thread> m_workers;
+    std::deque<job_t> m_jobs;
+    size_t m_max_queued_jobs;
+    size_t m_active_jobs;
+    bool m_stopping;
+
+    std::mutex m_mutex;
+    std::condition_variable m_job_available;
+    std::condition_variable m_slot_available;
+    std::condition_variable m_idle;
+
+    void WorkerMain();
+
+public:
+    /**
+     * \brief Creates a pool of long-lived worker threads.
+     * \param threadCount The amount of worker threads. A value of \c 0 uses \c GetDefaultThreadCount.
+     * \param maxQueuedJobs The maximum amount of jobs that can wait for a worker before \c Enqueue blocks. A value of \c 0 means unbounded.
+     */
+    explicit ThreadPool(size_t threadCount, size_t maxQueuedJobs = 0u);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool(ThreadPool&& other) noexcept = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+    ThreadPool& operator=(ThreadPool&& other) noexcept = delete;
+
+    /**
+     * \brief Queues a job for execution on one of the workers. Blocks while the queue is full.
+     * Jobs must not let exceptions escape, they are expected to hand them over to whoever waits for their result.
+     * \param job The job to execute.
+     */
+    void Enqueue(job_t job);
+
+    /**
+     * \brief Blocks until all queued jobs have finished executing.
+     */
+    void WaitForIdle();
+
+    _NODISCARD size_t GetThreadCount() const;
+
+    _NODISCARD static size_t GetDefaultThreadCount();
+};
@@ -0,0 +1,253 @@
+#include "Tracing.h"
+
+#include <algorithm>
+#include <fstream>
+#include <initializer_list>
+#include <iomanip>
+#include <string_view>
+#include <unordered_map>
+
+#if defined(__GNUG__)
+#include <cstdlib>
+#include <cxxabi.h>
+#include <memory>
+#endif
+
+using namespace tracing;
+
+Tracer Tracer::Instance;
+
+namespace
+{
+    class ScopeSummary
+    {
+    public:
+        size_t m_count = 0u;
+        trace_clock_t::duration m_total{};
+        trace_clock_t::duration m_self{};
+        trace_clock_t::duration m_max{};
+    };
+
+    int64_t ToMicroseconds(const trace_clock_t::duration duration)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    }
+
+    double ToMilliseconds(const trace_clock_t::duration duration)
+    {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    void WriteJsonString(std::ostream& stream, const std::string& value)
+    {
+        stream << '"';
+        for (const auto c : value)
+        {
+            switch (c)
+            {
+            case '"':
+                stream << "\\\"";
+                break;
+            case '\\':
+                stream << "\\\\";
+                break;
+            case '\n':
+                stream << "\\n";
+                break;
+            case '\r':
+                stream << "\\r";
+                break;
+            case '\t':
+                stream << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20u)
+                    stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<unsigned>(c) << std::dec << std::setfill(' ');
+                else
+                    stream << c;
+                break;
+            }
+        }
+        stream << '"';
+    }
+} // namespace
+
+Tracer::Tracer()
+    : m_enabled(false),
+      m_start(trace_clock_t::now())
+{
+}
+
+void Tracer::Enable()
+{
+    std::lock_guard lock(m_mutex);
+    m_start = trace_clock_t::now();
+    m_enabled.store(true, std::memory_order_relaxed);
+}
+
+unsigned Tracer::GetCurrentThreadIndex()
+{
+    static std::atomic_uint nextThreadIndex = 0u;
+    thread_local const auto threadIndex = nextThreadIndex++;
+
+    return threadIndex;
+}
+
+void Tracer::AddEvent(std::string name, const char* category, const trace_clock_t::time_point start, const trace_clock_t::time_point end)
+{
+    const auto threadIndex = GetCurrentThreadIndex();
+
+    std::lock_guard lock(m_mutex);
+    m_events.emplace_back(Event{std::move(name), category, start, end - start, threadIndex});
+}
+
+void Tracer::AddToCounter(const std::string& name, const int64_t value)
+{
+    const auto now = trace_clock_t::now();
+
+    std::lock_guard lock(m_mutex);
+    auto& counter = m_counters[name];
+    counter += value;
+    m_counter_samples.emplace_back(CounterSample{name, now, counter});
+}
+
+bool Tracer::WriteChromeTrace(const std::string& path) const
+{
+    std::ofstream stream(path, std::fstream::out | std::fstream::binary);
+    if (!stream.is_open())
+        return false;
+
+    std::lock_guard lock(m_mutex);
+
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    auto first = true;
+    for (const auto& event : m_events)
+    {
+        if (!first)
+            stream << ',';
+        first = false;
+
+        stream << "\n{\"ph\":\"X\",\"pid\":1,\"tid\":" << event.m_thread_index << ",\"ts\":" << ToMicroseconds(event.m_start - m_start)
+               << ",\"dur\":" << ToMicroseconds(event.m_duration) << ",\"cat\":";
+        WriteJsonString(stream, event.m_category);
+        stream << ",\"name\":";
+        WriteJsonString(stream, event.m_name);
+        stream << '}';
+    }
+
+    for (const auto& sample : m_counter_samples)
+    {
+        if (!first)
+            stream << ',';
+        first = false;
+
+        stream << "\n{\"ph\":\"C\",\"pid\":1,\"ts\":" << ToMicroseconds(sample.m_time - m_start) << ",\"name\":";
+        WriteJsonString(stream, sample.m_name);
+        stream << ",\"args\":{\"value\":" << sample.m_value << "}}";
+    }
+    stream << "\n]}\n";
+
+    return stream.good();
+}
+
+void Tracer::PrintSummary(std::ostream& stream) const
+{
+    std::lock_guard lock(m_mutex);
+
+    // Scopes of one thread are either nested or disjoint, so the self time of a scope is its duration minus the duration of its direct children
+    std::vector<const Event*> sortedEvents;
+    sortedEvents.reserve(m_events.size());
+    for (const auto& event : m_events)
+        sortedEvents.emplace_back(&event);
+
+    std::ranges::sort(sortedEvents,
+                      [](const Event* e1, const Event* e2)
+                      {
+                          if (e1->m_thread_index != e2->m_thread_index)
+                              return e1->m_thread_index < e2->m_thread_index;
+                          if (e1->m_start != e2->m_start)
+                              return e1->m_start < e2->m_start;
+                          return e1->m_duration > e2->m_duration;
+                      });
+
+    std::unordered_map<const Event*, trace_clock_t::duration> childDurations;
+    std::vector<const Event*> openEvents;
+    for (const auto* event : sortedEvents)
+    {
+        while (!openEvents.empty()
+               && (openEvents.back()->m_thread_index != event->m_thread_index
+                   || openEvents.back()->m_start + openEvents.back()->m_duration <= event->m_start))
+        {
+            openEvents.pop_back();
+        }
+
+        if (!openEvents.empty())
+            childDurations[openEvents.back()] += event->m_duration;
+
+        openEvents.emplace_back(event);
+    }
+
+    std::map<std::pair<std::string, std::string>, ScopeSummary> summaries;
+    for (const auto& event : m_events)
+    {
+        auto& summary = summaries[std::make_pair(std::string(event.m_category), event.m_name)];
+        summary.m_count++;
+        summary.m_total += event.m_duration;
+        summary.m_max = std::max(summary.m_max, event.m_duration);
+
+        const auto childDuration = childDurations.find(&event);
+        summary.m_self += childDuration != childDurations.end() ? event.m_duration - childDuration->second : event.m_duration;
+    }
+
+    std::vector<std::pair<const std::pair<std::string, std::string>*, const ScopeSummary*>> sortedSummaries;
+    sortedSummaries.reserve(summaries.size());
+    for (const auto& [key, summary] : summaries)
+        sortedSummaries.emplace_back(&key, &summary);
+
+    std::ranges::sort(sortedSummaries,
+                      [](const auto& s1, const auto& s2)
+                      {
+                          return s1.second->m_self > s2.second->m_self;
+                      });
+
+    stream << std::fixed << std::setprecision(2);
+    stream << std::setw(12) << "self ms" << std::setw(12) << "total ms" << std::setw(10) << "count" << std::setw(12) << "max ms"
+           << "  scope\n";
+    for (const auto& [key, summary] : sortedSummaries)
+    {
+        stream << std::setw(12) << ToMilliseconds(summary->m_self) << std::setw(12) << ToMilliseconds(summary->m_total) << std::setw(10) << summary->m_count
+               << std::setw(12) << ToMilliseconds(summary->m_max) << "  " << key->first << ": " << key->second << "\n";
+    }
+
+    if (!m_counters.empty())
+    {
+        stream << "\n" << std::setw(12) << "value"
+               << "  counter\n";
+        for (const auto& [name, value] : m_counters)
+            stream << std::setw(12) << value << "  " << name << "\n";
+    }
+
+    stream << std::defaultfloat << std::setprecision(6);
+}
+
+std::string Tracer::GetTypeName(const std::type_info& type)
+{
+#if defined(__GNUG__)
+    auto status = 0;
+    const std::unique_ptr<char, void (*)(void*)> demangledName(abi::__cxa_demangle(type.name(), nullptr, nullptr, &status), std::free);
+    if (status == 0 && demangledName)
+        return demangledName.get();
+
+    return type.name();
+#else
+    std::string name(type.name());
+    for (const auto* prefix : {"class ", "struct "})
+    {
+        const std::string_view prefixView(prefix);
+        if (name.starts_with(prefixView))
+            return name.substr(prefixView.size());
+    }
+
+    return name;
+#endif
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "ClassUtils.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace tracing
+{
+    using trace_clock_t = std::chrono::steady_clock;
+
+    /**
+     * \brief Collects timed scopes and counters of the whole process while it is enabled.
+     * Can be used from multiple threads at once. Recording is a single check of a flag while disabled.
+     */
+    class Tracer
+    {
+    public:
+        class Event
+        {
+        public:
+            std::string m_name;
+            const char* m_category;
+            trace_clock_t::time_point m_start;
+            trace_clock_t::duration m_duration;
+            unsigned m_thread_index;
+        };
+
+        class CounterSample
+        {
+        public:
+            std::string m_name;
+            trace_clock_t::time_point m_time;
+            int64_t m_value;
+        };
+
+        static Tracer Instance;
+
+        Tracer();
+        ~Tracer() = default;
+        Tracer(const Tracer& other) = delete;
+        Tracer(Tracer&& other) noexcept = delete;
+        Tracer& operator=(const Tracer& other) = delete;
+        Tracer& operator=(Tracer&& other) noexcept = delete;
+
+        void Enable();
+        _NODISCARD bool IsEnabled() const
+        {
+            return m_enabled.load(std::memory_order_relaxed);
+        }
+
+        void AddEvent(std::string name, const char* category, trace_clock_t::time_point start, trace_clock_t::time_point end);
+
+        /**
+         * \brief Adds a value to a counter. Counters start at \c 0.
+         * \param name The name of the counter.
+         * \param value The value to add.
+         */
+        void AddToCounter(const std::string& name, int64_t value);
+
+        /**
+         * \brief Writes all recorded events and counters in the Chrome trace event format, which can be viewed with chrome://tracing or Perfetto.
+         * \param path The path of the file to write.
+         * \return \c true if the file could be written.
+         */
+        bool WriteChromeTrace(const std::string& path) const;
+
+        /**
+         * \brief Prints the total and self time of all recorded scopes grouped by their name and the final value of all counters.
+         * \param stream The stream to print to.
+         */
+        void PrintSummary(std::ostream& stream) const;
+
+        /**
+         * \brief Returns a readable name of a type to name scopes after the class doing the work.
+         */
+        _NODISCARD static std::string GetTypeName(const std::type_info& type);
+
+        /**
+         * \brief Returns a readable name of the most derived type of an object.
+         */
+        template<typename T> _NODISCARD static std::string GetDynamicTypeName(const T& value)
+        {
+            return GetTypeName(typeid(value));
+        }
+
+    private:
+        static unsigned GetCurrentThreadIndex();
+
+        std::atomic_bool m_enabled;
+        trace_clock_t::time_point m_start;
+
+        std::vector<Event> m_events;
+        std::vector<CounterSample> m_counter_samples;
+        std::map<std::string, int64_t> m_counters;
+        mutable std::mutex m_mutex;
+    };
+
+    /**
+     * \brief Records the time from its construction to its destruction as an event when tracing is enabled.
+     */
+    class ScopedTimer
+    {
+    public:
+        /**
+         * \brief Starts timing a scope.
+         * \param category The category of the scope.
+         * \param nameSupplier Returns the name of the scope. Only called when tracing is enabled so names can be built without any cost while disabled.
+         */
+        template<typename TNameSupplier>
+        ScopedTimer(const char* category, TNameSupplier&& nameSupplier)
+            : m_active(Tracer::Instance.IsEnabled()),
+              m_category(category)
+        {
+            if (m_active)
+            {
+                m_name = std::forward<TNameSupplier>(nameSupplier)();
+                m_start = trace_clock_t::now();
+            }
+        }
+
+        ~ScopedTimer()
+        {
+            if (m_active)
+                Tracer::Instance.AddEvent(std::move(m_name), m_category, m_start, trace_clock_t::now());
+        }
+
+        ScopedTimer(const ScopedTimer& other) = delete;
+        ScopedTimer(ScopedTimer&& other) noexcept = delete;
+        ScopedTimer& operator=(const ScopedTimer& other) = delete;
+        ScopedTimer& operator=(ScopedTimer&& other) noexcept = delete;
+
+    private:
+        bool m_active;
+        const char* m_category;
+        std::string m_name;
+        trace_clock_t::time_point m_start;
+    };
+} // namespace tracing
+
+#define TRACING_CONCAT_INTERNAL(a, b) a##b
+#define TRACING_CONCAT(a, b) TRACING_CONCAT_INTERNAL(a, b)
+
+// Tracing can be removed from the build completely by defining TRACING_DISABLED
+#ifdef TRACING_DISABLED
+#define TRACE_SCOPE(category, name)
+#define TRACE_COUNTER(name, value)                                                                                                                             \
+    do                                                                                                                                                         \
+    {                                                                                                                                                          \
+    } while (false)
+#else
+/**
+ * \brief Times the remainder of the current scope. The name is only evaluated when tracing is enabled.
+ */
+#define TRACE_SCOPE(category, name)                                                                                                                            \
+    const tracing::ScopedTimer TRACING_CONCAT(traceScope, __LINE__)(category,                                                                                 \
+                                                                     [&]() -> std::string                                                                      \
+                                                                     {                                                                                         \
+                                                                         return name;                                                                          \
+                                                                     })
+
+/**
+ * \brief Adds a value to a counter. The name and value are only evaluated when tracing is enabled.
+ */
+#define TRACE_COUNTER(name, value)                                                                                                                             \
+    do                                                                                                                                                         \
+    {                                                                                                                                                          \
+        if (tracing::Tracer::Instance.IsEnabled())                                                                                                             \
+            tracing::Tracer::Instance.AddToCounter(name, value);                                                                                               \
+    } while (false)
+#endif
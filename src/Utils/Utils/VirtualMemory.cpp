@@ -0,0 +1,102 @@
+#include "VirtualMemory.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace
+{
+    size_t AlignSize(const size_t size, const size_t alignment)
+    {
+        return (size + alignment - 1u) / alignment * alignment;
+    }
+
+#ifdef _WIN32
+    void* ReserveLargePages(const size_t size, size_t& reservedSize)
+    {
+        const auto largePageSize = GetLargePageMinimum();
+        if (largePageSize == 0u || size < largePageSize)
+            return nullptr;
+
+        // Large pages are always committed right away and require the lock pages in memory privilege, so this commonly fails
+        reservedSize = AlignSize(size, largePageSize);
+        return VirtualAlloc(nullptr, reservedSize, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+    }
+#else
+    constexpr size_t HUGE_PAGE_SIZE = 2u * 1024u * 1024u;
+
+    void* ReserveLargePages(const size_t size, size_t& reservedSize)
+    {
+#ifdef MAP_HUGETLB
+        if (size < HUGE_PAGE_SIZE)
+            return nullptr;
+
+        // Explicit huge pages only exist when the administrator reserved some, transparent huge pages are used otherwise
+        reservedSize = AlignSize(size, HUGE_PAGE_SIZE);
+        auto* data = mmap(nullptr, reservedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        return data != MAP_FAILED ? data : nullptr;
+#else
+        return nullptr;
+#endif
+    }
+#endif
+} // namespace
+
+namespace virtual_memory
+{
+    Reservation Reserve(const size_t size, const bool largePages)
+    {
+        Reservation reservation;
+        if (size == 0u)
+            return reservation;
+
+        if (largePages)
+        {
+            size_t reservedSize = 0u;
+            auto* data = ReserveLargePages(size, reservedSize);
+            if (data)
+            {
+                reservation.m_data = data;
+                reservation.m_size = reservedSize;
+                reservation.m_large_pages = true;
+                return reservation;
+            }
+        }
+
+#ifdef _WIN32
+        // Committed memory only counts against the commit limit, physical pages are assigned on first access
+        auto* data = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        if (!data)
+            return reservation;
+#else
+        auto* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (data == MAP_FAILED)
+            return reservation;
+
+#ifdef MADV_HUGEPAGE
+        if (largePages)
+            madvise(data, size, MADV_HUGEPAGE);
+#endif
+#endif
+
+        reservation.m_data = data;
+        reservation.m_size = size;
+        return reservation;
+    }
+
+    void Release(const Reservation& reservation)
+    {
+        if (!reservation.m_data)
+            return;
+
+#ifdef _WIN32
+        VirtualFree(reservation.m_data, 0u, MEM_RELEASE);
+#else
+        munmap(reservation.m_data, reservation.m_size);
+#endif
+    }
+} // namespace virtual_memory
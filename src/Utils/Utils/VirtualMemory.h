@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+
+namespace virtual_memory
+{
+    class Reservation
+    {
+    public:
+        void* m_data = nullptr;
+        size_t m_size = 0u;
+        bool m_large_pages = false;
+    };
+
+    /**
+     * \brief Reserves zero initialized memory directly from the operating system.
+     * Pages of regular reservations are only backed by physical memory once they are touched.
+     * \param size The amount of bytes to reserve.
+     * \param largePages Whether to back the memory with large pages if the system provides them. Large pages reduce TLB misses when accessing big buffers,
+     * but depending on the system they are backed by physical memory right away.
+     * \return The reservation or a reservation without data if no memory could be reserved.
+     */
+    Reservation Reserve(size_t size, bool largePages);
+
+    /**
+     * \brief Returns the memory of a reservation to the operating system.
+     * \param reservation The reservation to release.
+     */
+    void Release(const Reservation& reservation);
+} // namespace virtual_memory
@@ -0,0 +1,67 @@
+#include "WorkClaims.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <format>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325u;
+    constexpr uint64_t FNV_PRIME = 0x100000001B3u;
+
+    uint64_t HashWorkItem(const std::string& workItem)
+    {
+        auto hash = FNV_OFFSET_BASIS;
+        for (const auto c : workItem)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= FNV_PRIME;
+        }
+
+        return hash;
+    }
+} // namespace
+
+WorkClaims::WorkClaims(std::string directory)
+    : m_directory(std::move(directory))
+{
+    std::error_code ec;
+    fs::create_directories(m_directory, ec);
+    m_usable = fs::is_directory(m_directory, ec);
+}
+
+bool WorkClaims::IsUsable() const
+{
+    return m_usable;
+}
+
+std::string WorkClaims::GetClaimFilePath(const std::string& workItem) const
+{
+    // Work items may contain characters that are not allowed in file names
+    return (fs::path(m_directory) / std::format("{:016x}.claim", HashWorkItem(workItem))).string();
+}
+
+WorkClaims::ClaimResult WorkClaims::Claim(const std::string& workItem, std::error_code& ec) const
+{
+    // Exclusive creation fails when the file exists, even when another process creates it at the same time
+    errno = 0;
+    auto* claimFile = std::fopen(GetClaimFilePath(workItem).c_str(), "wx");
+    if (claimFile == nullptr)
+    {
+        // Any other error like missing permissions must not make the item look like it is processed by another process
+        if (errno == EEXIST)
+            return ClaimResult::CLAIMED_BY_OTHER;
+
+        ec = std::error_code(errno, std::generic_category());
+        return ClaimResult::FAILED;
+    }
+
+    std::fwrite(workItem.data(), 1u, workItem.size(), claimFile);
+    std::fclose(claimFile);
+
+    return ClaimResult::CLAIMED;
+}
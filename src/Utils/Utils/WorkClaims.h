@@ -0,0 +1,50 @@
+#pragma once
+
+#include "ClassUtils.h"
+
+#include <string>
+#include <system_error>
+
+/**
+ * \brief Lets multiple processes, possibly on different machines, share one list of work items through a directory they all can access.
+ * Every process goes through the same list and only processes the items it was the first to claim.
+ * Processes that are done with their items claim the remaining ones so a slow process does not hold back any items except the one it is working on.
+ */
+class WorkClaims
+{
+public:
+    enum class ClaimResult
+    {
+        CLAIMED,
+        CLAIMED_BY_OTHER,
+        FAILED
+    };
+
+    /**
+     * \brief Uses a directory for claiming work items. The directory is created if it does not exist.
+     * It must not contain claims of earlier runs when the first process starts.
+     * \param directory The directory shared by all processes working on the same list.
+     */
+    explicit WorkClaims(std::string directory);
+
+    /**
+     * \brief Checks whether the claim directory could be created or already exists.
+     * \return \c true if work items can be claimed, otherwise \c false.
+     */
+    _NODISCARD bool IsUsable() const;
+
+    /**
+     * \brief Tries to claim a work item for this process. Claiming is atomic across processes.
+     * \param workItem A name that identifies the work item the same way in all processes, like a zone path or project specifier.
+     * \param ec Set to the reason of failing to create the claim if claiming failed.
+     * \return \c CLAIMED if this process claimed the item and should process it, \c CLAIMED_BY_OTHER if another process already claimed it
+     * or \c FAILED if the claim could not be created for any other reason.
+     */
+    ClaimResult Claim(const std::string& workItem, std::error_code& ec) const;
+
+private:
+    _NODISCARD std::string GetClaimFilePath(const std::string& workItem) const;
+
+    std::string m_directory;
+    bool m_usable;
+};
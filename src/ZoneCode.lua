@@ -208,6 +208,7 @@ function ZoneCode:outputForAssets(assetList)
             "%{wks.location}/src/ZoneCode/Game/%{file.basename}/XAssets/" .. assetNameLower .. "/" .. assetNameLower .. "_write_db.cpp",
             "%{wks.location}/src/ZoneCode/Game/%{file.basename}/XAssets/" .. assetNameLower .. "/" .. assetNameLower .. "_write_db.h",
             "%{wks.location}/src/ZoneCode/Game/%{file.basename}/XAssets/" .. assetNameLower .. "/" .. assetNameLower .. "_struct_test.cpp",
+            "%{wks.location}/src/ZoneCode/Game/%{file.basename}/XAssets/" .. assetNameLower .. "/" .. assetNameLower .. "_benchmark.cpp",
         }
     end
 end
@@ -225,6 +226,19 @@ function ZoneCode:allTestFiles()
     return result
 end
 
+function ZoneCode:allBenchmarkFiles()
+    result = {}
+
+    for game, assets in pairs(self.Assets) do
+        for i, assetName in ipairs(assets) do
+            local assetNameLower = string.lower(assetName)
+            table.insert(result, "%{wks.location}/src/ZoneCode/Game/" .. game .. "/XAssets/" .. assetNameLower .. "/" .. assetNameLower .. "_benchmark.cpp")
+        end
+    end
+    
+    return result
+end
+
 function ZoneCode:allLoadFiles()
     result = {}
 
@@ -312,6 +326,8 @@ function ZoneCode:project()
                     .. ' -g "*" ZoneMark'
                     .. ' -g "*" ZoneWrite'
                     .. ' -g "*" AssetStructTests'
+                    .. ' -g "*" AssetBenchmarks'
+                    .. ' --load-stream XBlockInputStream'
             }
             buildinputs {
                 path.join(ProjectFolder(), "ZoneCode/Game/%{file.basename}/%{file.basename}_ZoneCode.h"),
@@ -20,6 +20,7 @@ public:
 
     bool m_is_leaf;
     bool m_requires_marking;
+    bool m_requires_loading;
 
     bool m_non_embedded_reference_exists;
     bool m_single_pointer_reference_exists;
@@ -1,14 +1,18 @@
 #include "CodeGenerator.h"
 
 #include "Domain/Computations/StructureComputations.h"
+#include "Templates/AssetBenchmarksTemplate.h"
 #include "Templates/AssetStructTestsTemplate.h"
 #include "Templates/ZoneLoadTemplate.h"
 #include "Templates/ZoneMarkTemplate.h"
 #include "Templates/ZoneWriteTemplate.h"
+#include "Utils/ThreadPool.h"
 
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 
 namespace fs = std::filesystem;
 
@@ -24,35 +28,62 @@ void CodeGenerator::SetupTemplates()
     m_template_mapping["zonemark"] = std::make_unique<ZoneMarkTemplate>();
     m_template_mapping["zonewrite"] = std::make_unique<ZoneWriteTemplate>();
     m_template_mapping["assetstructtests"] = std::make_unique<AssetStructTestsTemplate>();
+    m_template_mapping["assetbenchmarks"] = std::make_unique<AssetBenchmarksTemplate>();
 }
 
-bool CodeGenerator::GenerateCodeForTemplate(RenderingContext* context, ICodeTemplate* codeTemplate) const
+bool CodeGenerator::WriteRenderedFile(const RenderedFile& file)
 {
-    for (const auto& codeFile : codeTemplate->GetFilesToRender(context))
-    {
-        fs::path p(m_args->m_output_directory);
-        p.append(codeFile.m_file_name);
-
-        auto parentFolder(p);
-        parentFolder.remove_filename();
-        create_directories(parentFolder);
-
-        std::ofstream stream(p, std::fstream::out | std::fstream::binary);
+    fs::path p(m_args->m_output_directory);
+    p.append(file.m_file_name);
+    m_generated_files.emplace_back(p.string());
 
-        if (!stream.is_open())
+    // Files that did not change are not touched so that whatever includes them does not need to be rebuilt
+    std::error_code ec;
+    if (fs::file_size(p, ec) == file.m_data.size() && !ec)
+    {
+        std::ifstream existingStream(p, std::fstream::in | std::fstream::binary);
+        if (existingStream.is_open())
         {
-            std::cout << "Failed to open file '" << p.string() << "'\n";
-            return false;
+            std::string existingData(file.m_data.size(), '\0');
+            existingStream.read(existingData.data(), static_cast<std::streamsize>(existingData.size()));
+            if (existingStream.gcount() == static_cast<std::streamsize>(existingData.size()) && existingData == file.m_data)
+                return true;
         }
+    }
+
+    auto parentFolder(p);
+    parentFolder.remove_filename();
+    create_directories(parentFolder);
 
-        codeTemplate->RenderFile(stream, codeFile.m_tag, context);
+    std::ofstream stream(p, std::fstream::out | std::fstream::binary);
 
-        stream.close();
+    if (!stream.is_open())
+    {
+        std::cout << "Failed to open file '" << p.string() << "'\n";
+        return false;
     }
 
+    stream.write(file.m_data.data(), static_cast<std::streamsize>(file.m_data.size()));
+    stream.close();
+
     return true;
 }
 
+void CodeGenerator::RenderGenerationJob(IDataRepository* repository, GenerationJob& job) const
+{
+    auto context = RenderingContext::BuildContext(repository, job.m_asset);
+    context->m_load_stream_class = m_args->m_load_stream_class;
+
+    for (const auto& codeFile : job.m_template->GetFilesToRender(context.get()))
+    {
+        std::ostringstream stream;
+        job.m_template->RenderFile(stream, codeFile.m_tag, context.get());
+        job.m_files.emplace_back(RenderedFile{codeFile.m_file_name, std::move(stream).str()});
+    }
+
+    job.m_success = true;
+}
+
 bool CodeGenerator::GetAssetWithName(IDataRepository* repository, const std::string& name, StructureInformation*& asset)
 {
     auto* def = repository->GetDataDefinitionByName(name);
@@ -76,21 +107,12 @@ bool CodeGenerator::GetAssetWithName(IDataRepository* repository, const std::str
         return false;
     }
 
+    asset = info;
     return true;
 }
 
-bool CodeGenerator::GenerateCode(IDataRepository* repository)
+bool CodeGenerator::CreateGenerationJobs(IDataRepository* repository, const std::vector<StructureInformation*>& assets, std::vector<GenerationJob>& jobs) const
 {
-    std::vector<StructureInformation*> assets;
-
-    for (auto* info : repository->GetAllStructureInformation())
-    {
-        StructureComputations computations(info);
-        if (computations.IsAsset())
-            assets.push_back(info);
-    }
-
-    const auto start = std::chrono::steady_clock::now();
     for (const auto& generationTask : m_args->m_generation_tasks)
     {
         auto templateName = generationTask.m_template_name;
@@ -107,18 +129,7 @@ bool CodeGenerator::GenerateCode(IDataRepository* repository)
         if (generationTask.m_all_assets)
         {
             for (auto* asset : assets)
-            {
-                auto context = RenderingContext::BuildContext(repository, asset);
-                if (!GenerateCodeForTemplate(context.get(), foundTemplate->second.get()))
-                {
-                    std::cout << "Failed to generate code for asset '" << asset->m_definition->GetFullName() << "' with preset '" << foundTemplate->first
-                              << "'\n";
-                    return false;
-                }
-
-                std::cout << "Successfully generated code for asset '" << asset->m_definition->GetFullName() << "' with preset '" << foundTemplate->first
-                          << "'\n";
-            }
+                jobs.emplace_back(GenerationJob{asset, foundTemplate->second.get(), foundTemplate->first, true, false, {}});
         }
         else
         {
@@ -126,11 +137,76 @@ bool CodeGenerator::GenerateCode(IDataRepository* repository)
             if (!GetAssetWithName(repository, generationTask.m_asset_name, asset))
                 return false;
 
-            auto context = RenderingContext::BuildContext(repository, asset);
-            if (!GenerateCodeForTemplate(context.get(), foundTemplate->second.get()))
-                return false;
+            jobs.emplace_back(GenerationJob{asset, foundTemplate->second.get(), foundTemplate->first, false, false, {}});
         }
     }
+
+    return true;
+}
+
+bool CodeGenerator::GenerateCode(IDataRepository* repository)
+{
+    std::vector<StructureInformation*> assets;
+
+    for (auto* info : repository->GetAllStructureInformation())
+    {
+        StructureComputations computations(info);
+        if (computations.IsAsset())
+            assets.push_back(info);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    // All tasks are checked before rendering so that an invalid task does not leave the output partially generated
+    std::vector<GenerationJob> jobs;
+    if (!CreateGenerationJobs(repository, assets, jobs))
+        return false;
+
+    // Each job builds its own rendering context and templates only read from the repository, so jobs can be rendered at the same time
+    {
+        ThreadPool renderPool(m_args->m_job_count);
+        for (auto& job : jobs)
+        {
+            renderPool.Enqueue(
+                [this, repository, &job]
+                {
+                    try
+                    {
+                        RenderGenerationJob(repository, job);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        std::cout << "Rendering failed: " << e.what() << "\n";
+                        job.m_success = false;
+                    }
+                    catch (...)
+                    {
+                        job.m_success = false;
+                    }
+                });
+        }
+        renderPool.WaitForIdle();
+    }
+
+    for (const auto& job : jobs)
+    {
+        auto success = job.m_success;
+        for (auto i = 0u; success && i < job.m_files.size(); i++)
+            success = WriteRenderedFile(job.m_files[i]);
+
+        if (!success)
+        {
+            if (job.m_all_assets)
+                std::cout << "Failed to generate code for asset '" << job.m_asset->m_definition->GetFullName() << "' with preset '" << job.m_template_name
+                          << "'\n";
+            return false;
+        }
+
+        if (job.m_all_assets)
+            std::cout << "Successfully generated code for asset '" << job.m_asset->m_definition->GetFullName() << "' with preset '" << job.m_template_name
+                      << "'\n";
+    }
+
     const auto end = std::chrono::steady_clock::now();
     if (m_args->m_verbose)
     {
@@ -139,3 +215,8 @@ bool CodeGenerator::GenerateCode(IDataRepository* repository)
 
     return true;
 }
+
+const std::vector<std::string>& CodeGenerator::GetGeneratedFiles() const
+{
+    return m_generated_files;
+}
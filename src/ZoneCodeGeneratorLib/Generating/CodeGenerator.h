@@ -3,21 +3,50 @@
 #include "ICodeTemplate.h"
 #include "ZoneCodeGeneratorArguments.h"
 
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 class CodeGenerator
 {
+    class RenderedFile
+    {
+    public:
+        std::string m_file_name;
+        std::string m_data;
+    };
+
+    class GenerationJob
+    {
+    public:
+        StructureInformation* m_asset;
+        ICodeTemplate* m_template;
+        std::string m_template_name;
+        bool m_all_assets;
+
+        bool m_success;
+        std::vector<RenderedFile> m_files;
+    };
+
     const ZoneCodeGeneratorArguments* m_args;
 
     std::unordered_map<std::string, std::unique_ptr<ICodeTemplate>> m_template_mapping;
+    std::vector<std::string> m_generated_files;
 
     void SetupTemplates();
 
-    bool GenerateCodeForTemplate(RenderingContext* context, ICodeTemplate* codeTemplate) const;
+    bool CreateGenerationJobs(IDataRepository* repository, const std::vector<StructureInformation*>& assets, std::vector<GenerationJob>& jobs) const;
+    void RenderGenerationJob(IDataRepository* repository, GenerationJob& job) const;
+    bool WriteRenderedFile(const RenderedFile& file);
     static bool GetAssetWithName(IDataRepository* repository, const std::string& name, StructureInformation*& asset);
 
 public:
     explicit CodeGenerator(const ZoneCodeGeneratorArguments* args);
 
     bool GenerateCode(IDataRepository* repository);
+
+    /**
+     * \brief Returns the paths of all files that were generated, including files that were up to date and therefore not written again.
+     */
+    _NODISCARD const std::vector<std::string>& GetGeneratedFiles() const;
 };
@@ -0,0 +1,177 @@
+#include "GenerationCache.h"
+
+#include "GitVersion.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325u;
+    constexpr uint64_t FNV_PRIME = 0x100000001B3u;
+
+    uint64_t HashData(const std::string& data, uint64_t hash = FNV_OFFSET_BASIS)
+    {
+        for (const auto c : data)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= FNV_PRIME;
+        }
+
+        return hash;
+    }
+
+    void HashOption(uint64_t& hash, const std::string& value)
+    {
+        // Hash the terminator as well so that options cannot be moved between values without changing the hash
+        hash = HashData(value, hash);
+        hash = HashData(std::string(1, '\0'), hash);
+    }
+} // namespace
+
+GenerationCache::GenerationCache(const ZoneCodeGeneratorArguments* args, const std::string& executablePath)
+    : m_args(args),
+      m_options_hash(FNV_OFFSET_BASIS),
+      m_inputs_complete(true)
+{
+    HashOption(m_options_hash, GIT_VERSION);
+    HashOption(m_options_hash, absolute(fs::path(executablePath)).string());
+    HashOption(m_options_hash, m_args->m_load_stream_class);
+    for (const auto& headerPath : m_args->m_header_paths)
+        HashOption(m_options_hash, absolute(fs::path(headerPath)).string());
+    for (const auto& commandsPath : m_args->m_command_paths)
+        HashOption(m_options_hash, absolute(fs::path(commandsPath)).string());
+    for (const auto& generationTask : m_args->m_generation_tasks)
+    {
+        HashOption(m_options_hash, generationTask.m_all_assets ? "*" : generationTask.m_asset_name);
+        HashOption(m_options_hash, generationTask.m_template_name);
+    }
+
+    AddInputFile(executablePath);
+}
+
+std::string GenerationCache::GetCacheFilePath() const
+{
+    fs::path p(m_args->m_output_directory);
+    p.append(CACHE_FILE_NAME);
+
+    return p.string();
+}
+
+bool GenerationCache::HashFile(const std::string& path, uint64_t& hash, size_t& size)
+{
+    std::ifstream stream(path, std::fstream::in | std::fstream::binary);
+    if (!stream.is_open())
+        return false;
+
+    std::ostringstream data;
+    data << stream.rdbuf();
+    const auto fileData = std::move(data).str();
+
+    hash = HashData(fileData);
+    size = fileData.size();
+
+    return true;
+}
+
+void GenerationCache::AddInputFile(const std::string& path)
+{
+    InputFile inputFile{absolute(fs::path(path)).lexically_normal().string(), 0u, 0u};
+    if (!HashFile(inputFile.m_path, inputFile.m_hash, inputFile.m_size))
+    {
+        m_inputs_complete = false;
+        return;
+    }
+
+    m_input_files.emplace_back(std::move(inputFile));
+}
+
+void GenerationCache::AddOutputFile(std::string path)
+{
+    m_output_files.emplace_back(std::move(path));
+}
+
+bool GenerationCache::IsUpToDate() const
+{
+    std::ifstream stream(GetCacheFilePath(), std::fstream::in);
+    if (!stream.is_open())
+        return false;
+
+    unsigned version;
+    uint64_t optionsHash;
+    if (!(stream >> version >> std::hex >> optionsHash >> std::dec) || version != CACHE_VERSION || optionsHash != m_options_hash)
+        return false;
+
+    auto inputFileCount = 0u;
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        if (line.empty())
+            continue;
+
+        std::istringstream lineStream(line);
+        std::string entryType;
+        lineStream >> entryType;
+
+        if (entryType == "input")
+        {
+            uint64_t cachedHash;
+            size_t cachedSize;
+            std::string path;
+            if (!(lineStream >> std::hex >> cachedHash >> std::dec >> cachedSize) || lineStream.get() != ' ' || !std::getline(lineStream, path))
+                return false;
+
+            uint64_t hash;
+            size_t size;
+            if (!HashFile(path, hash, size) || hash != cachedHash || size != cachedSize)
+                return false;
+
+            inputFileCount++;
+        }
+        else if (entryType == "output")
+        {
+            std::string path;
+            if (lineStream.get() != ' ' || !std::getline(lineStream, path))
+                return false;
+
+            std::error_code ec;
+            if (!fs::is_regular_file(path, ec))
+                return false;
+        }
+        else
+            return false;
+    }
+
+    return inputFileCount > 0u;
+}
+
+void GenerationCache::Invalidate() const
+{
+    std::error_code ec;
+    fs::remove(GetCacheFilePath(), ec);
+}
+
+bool GenerationCache::Save() const
+{
+    if (!m_inputs_complete)
+        return false;
+
+    std::ofstream stream(GetCacheFilePath(), std::fstream::out);
+    if (!stream.is_open())
+    {
+        std::cout << "Failed to save generation cache to '" << GetCacheFilePath() << "'\n";
+        return false;
+    }
+
+    stream << CACHE_VERSION << ' ' << std::hex << m_options_hash << std::dec << '\n';
+    for (const auto& inputFile : m_input_files)
+        stream << "input " << std::hex << inputFile.m_hash << std::dec << ' ' << inputFile.m_size << ' ' << inputFile.m_path << '\n';
+    for (const auto& outputFile : m_output_files)
+        stream << "output " << outputFile << '\n';
+
+    return true;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "ZoneCodeGeneratorArguments.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Remembers the input files and options of a code generation run in the output folder.
+ * When neither the inputs nor the options changed since the last run, the generated code is still up to date and reading the inputs can be skipped.
+ */
+class GenerationCache
+{
+    static constexpr const char* CACHE_FILE_NAME = ".zcg_cache";
+    static constexpr unsigned CACHE_VERSION = 1u;
+
+    class InputFile
+    {
+    public:
+        std::string m_path;
+        uint64_t m_hash;
+        size_t m_size;
+    };
+
+    const ZoneCodeGeneratorArguments* m_args;
+    uint64_t m_options_hash;
+    bool m_inputs_complete;
+    std::vector<InputFile> m_input_files;
+    std::vector<std::string> m_output_files;
+
+    _NODISCARD std::string GetCacheFilePath() const;
+    static bool HashFile(const std::string& path, uint64_t& hash, size_t& size);
+
+public:
+    /**
+     * \brief Creates a cache for the current run.
+     * \param args The arguments of the current run. Every option that changes the generated code is part of the cache.
+     * \param executablePath The path of the generator itself. A different generator might generate different code from the same inputs.
+     */
+    GenerationCache(const ZoneCodeGeneratorArguments* args, const std::string& executablePath);
+
+    /**
+     * \brief Adds a file that was read for generating code in the current run.
+     * \param path The path of the file.
+     */
+    void AddInputFile(const std::string& path);
+
+    /**
+     * \brief Adds a file that was generated in the current run.
+     * \param path The path of the file.
+     */
+    void AddOutputFile(std::string path);
+
+    /**
+     * \brief Checks whether the last run used the same options and input files that did not change since then and whether all of its outputs still exist.
+     * \return \c true if generating code again would produce the same files.
+     */
+    _NODISCARD bool IsUpToDate() const;
+
+    /**
+     * \brief Removes the cache of the last run. Must be called before generating any code so that a failed run is never considered up to date.
+     */
+    void Invalidate() const;
+
+    /**
+     * \brief Saves the inputs and outputs of the current run to the output folder.
+     * Nothing is saved when one of the inputs could not be read since the next run could not tell whether it changed.
+     * \return \c true if the cache was saved.
+     */
+    bool Save() const;
+};
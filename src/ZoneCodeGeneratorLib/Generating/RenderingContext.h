@@ -52,5 +52,8 @@ public:
     const FastFileBlock* m_default_normal_block;
     const FastFileBlock* m_default_temp_block;
 
+    // The concrete zone input stream class generated loaders use or empty to use the interface
+    std::string m_load_stream_class;
+
     static std::unique_ptr<RenderingContext> BuildContext(const IDataRepository* repository, StructureInformation* asset);
 };
@@ -0,0 +1,133 @@
+#include "AssetBenchmarksTemplate.h"
+
+#include "Internal/BaseTemplate.h"
+
+#include <iostream>
+#include <sstream>
+
+class AssetBenchmarksTemplate::Internal final : BaseTemplate
+{
+    void PrintSetNameMethod()
+    {
+        LINE("static void SetName(asset_t& asset, const char* name)")
+        LINE("{")
+        m_intendation++;
+
+        if (!m_env.m_asset->m_name_chain.empty())
+        {
+            LINE_START("asset")
+            for (auto* member : m_env.m_asset->m_name_chain)
+            {
+                LINE_MIDDLE("." << member->m_member->m_name)
+            }
+
+            // Names are not always declared const
+            LINE_END(" = const_cast<char*>(name);")
+        }
+
+        m_intendation--;
+        LINE("}")
+    }
+
+    void PrintTraits()
+    {
+        LINE("class AssetTraits")
+        LINE("{")
+        LINE("public:")
+        m_intendation++;
+
+        LINE("using asset_t = " << m_env.m_asset->m_definition->GetFullName() << ";")
+        LINE("using pool_t = GameAssetPool" << m_env.m_game << ";")
+        LINE("using loader_t = Loader_" << m_env.m_asset->m_definition->m_name << ";")
+        LINE("using writer_t = Writer_" << m_env.m_asset->m_definition->m_name << ";")
+        LINE("")
+        LINE("static constexpr asset_type_t ASSET_TYPE = " << m_env.m_asset->m_asset_enum_entry->m_name << ";")
+        LINE("static constexpr block_t BLOCK_COUNT = MAX_XFILE_COUNT;")
+        LINE("static constexpr block_t TEMP_BLOCK = XFILE_BLOCK_TEMP;")
+        LINE("static constexpr block_t INSERT_BLOCK = ZoneConstants::INSERT_BLOCK;")
+        LINE("static constexpr int OFFSET_BLOCK_BIT_COUNT = ZoneConstants::OFFSET_BLOCK_BIT_COUNT;")
+        LINE("")
+        LINE("static IGame* Game()")
+        LINE("{")
+        m_intendation++;
+        LINE("return &g_Game" << m_env.m_game << ";")
+        m_intendation--;
+        LINE("}")
+        LINE("")
+        PrintSetNameMethod();
+
+        m_intendation--;
+        LINE("};")
+    }
+
+public:
+    Internal(std::ostream& stream, RenderingContext* context)
+        : BaseTemplate(stream, context)
+    {
+    }
+
+    void Source()
+    {
+        const auto assetNameLower = Lower(m_env.m_asset->m_definition->m_name);
+
+        LINE("// ====================================================================")
+        LINE("// This file has been generated by ZoneCodeGenerator.")
+        LINE("// Do not modify.")
+        LINE("// Any changes will be discarded when regenerating.")
+        LINE("// ====================================================================")
+        LINE("")
+        LINE("#include \"Game/" << m_env.m_game << "/GameAssetPool" << m_env.m_game << ".h\"")
+        LINE("#include \"Game/" << m_env.m_game << "/Game" << m_env.m_game << ".h\"")
+        LINE("#include \"Game/" << m_env.m_game << "/XAssets/" << assetNameLower << "/" << assetNameLower << "_load_db.h\"")
+        LINE("#include \"Game/" << m_env.m_game << "/XAssets/" << assetNameLower << "/" << assetNameLower << "_write_db.h\"")
+        LINE("#include \"Game/" << m_env.m_game << "/ZoneConstants" << m_env.m_game << ".h\"")
+        LINE("#include \"Zone/AssetBenchmark.h\"")
+        LINE("")
+        LINE("#include <catch2/catch_test_macros.hpp>")
+        LINE("")
+        LINE("using namespace " << m_env.m_game << ";")
+        LINE("")
+        LINE("namespace benchmarks::game::" << m_env.m_game << "::xassets::asset_" << assetNameLower)
+        LINE("{")
+        m_intendation++;
+
+        PrintTraits();
+        LINE("")
+        LINE("TEST_CASE(\"" << m_env.m_game << "::" << m_env.m_asset->m_definition->GetFullName() << ": Write and load\", \"[benchmark][assetbenchmark]\")")
+        LINE("{")
+        m_intendation++;
+        LINE("asset_benchmark::Run<AssetTraits>();")
+        m_intendation--;
+        LINE("}")
+
+        m_intendation--;
+        LINE("}")
+    }
+};
+
+std::vector<CodeTemplateFile> AssetBenchmarksTemplate::GetFilesToRender(RenderingContext* context)
+{
+    std::vector<CodeTemplateFile> files;
+
+    auto assetName = context->m_asset->m_definition->m_name;
+    for (auto& c : assetName)
+        c = static_cast<char>(tolower(c));
+
+    {
+        std::ostringstream str;
+        str << assetName << '/' << assetName << "_benchmark.cpp";
+        files.emplace_back(str.str(), TAG_SOURCE);
+    }
+
+    return files;
+}
+
+void AssetBenchmarksTemplate::RenderFile(std::ostream& stream, const int fileTag, RenderingContext* context)
+{
+    Internal internal(stream, context);
+
+    if (fileTag == TAG_SOURCE)
+        internal.Source();
+    else
+        std::cout << "Invalid tag in AssetBenchmarksTemplate\n";
+}
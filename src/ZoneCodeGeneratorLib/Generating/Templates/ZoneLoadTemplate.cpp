@@ -27,13 +27,6 @@ class ZoneLoadTemplate::Internal final : BaseTemplate
         return str.str();
     }
 
-    static std::string MarkerClassName(StructureInformation* asset)
-    {
-        std::ostringstream str;
-        str << "Marker_" << asset->m_definition->m_name;
-        return str.str();
-    }
-
     static std::string VariableDecl(const DataDefinition* def)
     {
         std::ostringstream str;
@@ -104,6 +97,10 @@ class ZoneLoadTemplate::Internal final : BaseTemplate
 
         m_intendation++;
         LINE_START(": AssetLoader(" << m_env.m_asset->m_asset_enum_entry->m_name << ", zone, stream)")
+        if (!m_env.m_load_stream_class.empty())
+        {
+            LINE_MIDDLE(", m_stream(static_cast<" << m_env.m_load_stream_class << "*>(stream))")
+        }
         if (m_env.m_has_actions)
         {
             LINE_MIDDLE(", m_actions(zone)")
@@ -114,6 +111,12 @@ class ZoneLoadTemplate::Internal final : BaseTemplate
         LINE("{")
         m_intendation++;
 
+        if (!m_env.m_load_stream_class.empty())
+        {
+            LINE("assert(dynamic_cast<" << m_env.m_load_stream_class << "*>(stream) != nullptr);")
+            LINE("")
+        }
+
         LINE("m_asset_info = nullptr;")
         PrintVariableInitialization(m_env.m_asset->m_definition);
         PrintPointerVariableInitialization(m_env.m_asset->m_definition);
@@ -121,7 +124,7 @@ class ZoneLoadTemplate::Internal final : BaseTemplate
 
         for (auto* type : m_env.m_used_types)
         {
-            if (type->m_info && !type->m_info->m_definition->m_anonymous && !type->m_info->m_is_leaf && !StructureComputations(type->m_info).IsAsset())
+            if (type->m_info && !type->m_info->m_definition->m_anonymous && type->m_info->m_requires_loading && !StructureComputations(type->m_info).IsAsset())
             {
                 PrintVariableInitialization(type->m_type);
             }
@@ -142,7 +145,7 @@ class ZoneLoadTemplate::Internal final : BaseTemplate
     {
         LINE("*" << MakeTypePtrVarName(def) << " = m_stream->Alloc<" << def->GetFullName() << ">(" << def->GetAlignment() << ");")
 
-        if (info && !info->m_is_leaf)
+        if (info && info->m_requires_loading)
         {
             LINE(MakeTypeVarName(info->m_definition) << " = *" << MakeTypePtrVarName(def) << ";")
             LINE("Load_" << MakeSafeTypeName(def) << "(true);")
@@ -316,7 +319,7 @@ class ZoneLoadTemplate::Internal final : BaseTemplate
     void LoadMember_ArrayPointer(StructureInformation* info, MemberInformation* member, const DeclarationModifierComputations& modifier) const
     {
         const MemberComputations computations(member);
-        if (member->m_type && !member->m_type->m_is_leaf && !computations.IsInRuntimeBlock())
+        if (member->m_type && member->m_type->m_requires_loading && !computations.IsInRuntimeBlock())
         {
             LINE(MakeTypeVarName(member->m_member->m_type_declaration->m_type) << " = " << MakeMemberAccess(info, member, modifier) << ";")
             LINE("LoadArray_" << MakeSafeTypeName(member->m_member->m_type_declaration->m_type) << "(true, "
@@ -366,7 +369,7 @@ class ZoneLoadTemplate::Internal final : BaseTemplate
         else
             arraySizeStr = std::to_string(modifier.GetArraySize());
 
-        if (!member->m_is_leaf)
+        if (member->m_type && member->m_type->m_requires_loading)
         {
             LINE(MakeTypeVarName(member->m_member->m_type_declaration->m_type) << " = " << MakeMemberAccess(info, member, modifier) << ";")
 
@@ -401,7 +404,7 @@ class ZoneLoadTemplate::Internal final : BaseTemplate
 
     void LoadMember_DynamicArray(StructureInformation* info, MemberInformation* member, const DeclarationModifierComputations& modifier) const
     {
-        if (member->m_type && !member->m_type->m_is_leaf)
+        if (member->m_type && member->m_type->m_requires_loading)
         {
             LINE(MakeTypeVarName(member->m_member->m_type_declaration->m_type) << " = " << MakeMemberAccess(info, member, modifier) << ";")
             LINE("LoadArray_" << MakeSafeTypeName(member->m_member->m_type_declaration->m_type) << "(true, "
@@ -418,7 +421,7 @@ class ZoneLoadTemplate::Internal final : BaseTemplate
     void LoadMember_Embedded(StructureInformation* info, MemberInformation* member, const DeclarationModifierComputations& modifier) const
     {
         const MemberComputations computations(member);
-        if (!member->m_is_leaf)
+        if (member->m_type && member->m_type->m_requires_loading)
         {
             LINE(MakeTypeVarName(member->m_member->m_type_declaration->m_type) << " = &" << MakeMemberAccess(info, member, modifier) << ";")
 
@@ -454,7 +457,7 @@ class ZoneLoadTemplate::Internal final : BaseTemplate
     void LoadMember_SinglePointer(StructureInformation* info, MemberInformation* member, const DeclarationModifierComputations& modifier) const
     {
         const MemberComputations computations(member);
-        if (member->m_type && !member->m_type->m_is_leaf && !computations.IsInRuntimeBlock())
+        if (member->m_type && member->m_type->m_requires_loading && !computations.IsInRuntimeBlock())
         {
             LINE(MakeTypeVarName(member->m_member->m_type_declaration->m_type) << " = " << MakeMemberAccess(info, member, modifier) << ";")
             LINE("Load_" << MakeSafeTypeName(member->m_type->m_definition) << "(true);")
@@ -889,7 +892,7 @@ class ZoneLoadTemplate::Internal final : BaseTemplate
         if (computations.ShouldIgnore())
             return;
 
-        if (member->m_is_string || computations.ContainsNonEmbeddedReference() || member->m_type && !member->m_type->m_is_leaf
+        if (member->m_is_string || computations.ContainsNonEmbeddedReference() || member->m_type && member->m_type->m_requires_loading
             || computations.IsAfterPartialLoad())
         {
             if (info->m_definition->GetType() == DataDefinitionType::UNION)
@@ -1095,12 +1098,9 @@ class ZoneLoadTemplate::Internal final : BaseTemplate
 
         LINE("assert(pAsset != nullptr);")
         LINE("")
-        LINE(MarkerClassName(m_env.m_asset) << " marker(m_zone);")
-        LINE("marker.Mark(*pAsset);")
-        LINE("")
-        LINE("m_asset_info = reinterpret_cast<XAssetInfo<"
-             << info->m_definition->GetFullName()
-             << ">*>(LinkAsset(GetAssetName(*pAsset), *pAsset, marker.GetDependencies(), marker.GetUsedScriptStrings(), marker.GetIndirectAssetReferences()));")
+        // References are collected by the content loader once all assets have been loaded
+        LINE("m_asset_info = reinterpret_cast<XAssetInfo<" << info->m_definition->GetFullName()
+                                                           << ">*>(LinkAsset(GetAssetName(*pAsset), *pAsset, {}, {}, {}));")
         LINE("*pAsset = m_asset_info->Asset();")
 
         m_intendation--;
@@ -1183,6 +1183,10 @@ public:
         LINE("#pragma once")
         LINE("")
         LINE("#include \"Loading/AssetLoader.h\"")
+        if (!m_env.m_load_stream_class.empty())
+        {
+            LINE("#include \"Zone/Stream/Impl/" << m_env.m_load_stream_class << ".h\"")
+        }
         LINE("#include \"Game/" << m_env.m_game << "/" << m_env.m_game << ".h\"")
         if (m_env.m_has_actions)
         {
@@ -1198,6 +1202,11 @@ public:
         LINE("{")
         m_intendation++;
 
+        // Hides the interface pointer of the base class for the generated code to call the concrete stream without virtual dispatch
+        if (!m_env.m_load_stream_class.empty())
+        {
+            LINE(m_env.m_load_stream_class << "* m_stream;")
+        }
         LINE("XAssetInfo<" << m_env.m_asset->m_definition->GetFullName() << ">* m_asset_info;")
         if (m_env.m_has_actions)
         {
@@ -1210,7 +1219,7 @@ public:
         // Variable Declarations: type varType;
         for (auto* type : m_env.m_used_types)
         {
-            if (type->m_info && !type->m_info->m_definition->m_anonymous && !type->m_info->m_is_leaf && !StructureComputations(type->m_info).IsAsset())
+            if (type->m_info && !type->m_info->m_definition->m_anonymous && type->m_info->m_requires_loading && !StructureComputations(type->m_info).IsAsset())
             {
                 LINE(VariableDecl(type->m_type))
             }
@@ -1235,14 +1244,14 @@ public:
         }
         for (auto* type : m_env.m_used_types)
         {
-            if (type->m_array_reference_exists && type->m_info && !type->m_info->m_is_leaf && type->m_non_runtime_reference_exists)
+            if (type->m_array_reference_exists && type->m_info && type->m_info->m_requires_loading && type->m_non_runtime_reference_exists)
             {
                 PrintHeaderArrayLoadMethodDeclaration(type->m_type);
             }
         }
         for (auto* type : m_env.m_used_structures)
         {
-            if (type->m_non_runtime_reference_exists && !type->m_info->m_is_leaf && !StructureComputations(type->m_info).IsAsset())
+            if (type->m_non_runtime_reference_exists && type->m_info->m_requires_loading && !StructureComputations(type->m_info).IsAsset())
             {
                 PrintHeaderLoadMethodDeclaration(type->m_info);
             }
@@ -1273,7 +1282,6 @@ public:
         LINE("// ====================================================================")
         LINE("")
         LINE("#include \"" << Lower(m_env.m_asset->m_definition->m_name) << "_load_db.h\"")
-        LINE("#include \"" << Lower(m_env.m_asset->m_definition->m_name) << "_mark_db.h\"")
         LINE("#include <cassert>")
         LINE("")
 
@@ -1300,7 +1308,7 @@ public:
         }
         for (auto* type : m_env.m_used_types)
         {
-            if (type->m_array_reference_exists && type->m_info && !type->m_info->m_is_leaf && type->m_non_runtime_reference_exists)
+            if (type->m_array_reference_exists && type->m_info && type->m_info->m_requires_loading && type->m_non_runtime_reference_exists)
             {
                 LINE("")
                 PrintLoadArrayMethod(type->m_type, type->m_info);
@@ -1308,7 +1316,7 @@ public:
         }
         for (auto* type : m_env.m_used_structures)
         {
-            if (type->m_non_runtime_reference_exists && !type->m_info->m_is_leaf && !StructureComputations(type->m_info).IsAsset())
+            if (type->m_non_runtime_reference_exists && type->m_info->m_requires_loading && !StructureComputations(type->m_info).IsAsset())
             {
                 LINE("")
                 PrintLoadMethod(type->m_info);
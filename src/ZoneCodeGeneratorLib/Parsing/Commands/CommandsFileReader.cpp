@@ -8,6 +8,7 @@
 #include "Parsing/Impl/ParserFilesystemStream.h"
 #include "Parsing/PostProcessing/CalculateSizeAndAlignPostProcessor.h"
 #include "Parsing/PostProcessing/LeafsPostProcessor.h"
+#include "Parsing/PostProcessing/LoadingRequiredPostProcessor.h"
 #include "Parsing/PostProcessing/MarkingRequiredPostProcessor.h"
 #include "Parsing/PostProcessing/MemberLeafsPostProcessor.h"
 #include "Parsing/PostProcessing/UnionsPostProcessor.h"
@@ -20,6 +21,7 @@
 CommandsFileReader::CommandsFileReader(const ZoneCodeGeneratorArguments* args, std::string filename)
     : m_args(args),
       m_filename(std::move(filename)),
+      m_base_stream(nullptr),
       m_stream(nullptr)
 {
     SetupPostProcessors();
@@ -34,6 +36,7 @@ bool CommandsFileReader::OpenBaseStream()
         return false;
     }
 
+    m_base_stream = stream.get();
     m_stream = stream.get();
     m_open_streams.emplace_back(std::move(stream));
     return true;
@@ -59,6 +62,7 @@ void CommandsFileReader::SetupPostProcessors()
     m_post_processors.emplace_back(std::make_unique<CalculateSizeAndAlignPostProcessor>());
     m_post_processors.emplace_back(std::make_unique<UsagesPostProcessor>());
     m_post_processors.emplace_back(std::make_unique<LeafsPostProcessor>());
+    m_post_processors.emplace_back(std::make_unique<LoadingRequiredPostProcessor>());
     m_post_processors.emplace_back(std::make_unique<MarkingRequiredPostProcessor>());
     m_post_processors.emplace_back(std::make_unique<MemberLeafsPostProcessor>());
     m_post_processors.emplace_back(std::make_unique<UnionsPostProcessor>());
@@ -97,3 +101,11 @@ bool CommandsFileReader::ReadCommandsFile(IDataRepository* repository)
                                    return postProcessor->PostProcess(repository);
                                });
 }
+
+std::vector<std::string> CommandsFileReader::GetReadFiles() const
+{
+    if (!m_base_stream)
+        return {};
+
+    return m_base_stream->GetOpenedFiles();
+}
@@ -1,11 +1,13 @@
 #pragma once
 
 #include "Parsing/IParserLineStream.h"
+#include "Parsing/Impl/ParserFilesystemStream.h"
 #include "Parsing/PostProcessing/IPostProcessor.h"
 #include "Persistence/IDataRepository.h"
 #include "ZoneCodeGeneratorArguments.h"
 
 #include <string>
+#include <vector>
 
 class CommandsFileReader
 {
@@ -16,6 +18,7 @@ class CommandsFileReader
     std::string m_filename;
 
     std::vector<std::unique_ptr<IParserLineStream>> m_open_streams;
+    const ParserFilesystemStream* m_base_stream;
     IParserLineStream* m_stream;
 
     std::vector<std::unique_ptr<IPostProcessor>> m_post_processors;
@@ -28,4 +31,9 @@ public:
     explicit CommandsFileReader(const ZoneCodeGeneratorArguments* args, std::string filename);
 
     bool ReadCommandsFile(IDataRepository* repository);
+
+    /**
+     * \brief Returns the absolute paths of the commands file and all files it included. Only complete after reading the file.
+     */
+    _NODISCARD std::vector<std::string> GetReadFiles() const;
 };
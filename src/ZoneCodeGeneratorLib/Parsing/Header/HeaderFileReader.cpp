@@ -18,6 +18,7 @@
 HeaderFileReader::HeaderFileReader(const ZoneCodeGeneratorArguments* args, std::string filename)
     : m_args(args),
       m_filename(std::move(filename)),
+      m_base_stream(nullptr),
       m_pack_value_supplier(nullptr),
       m_stream(nullptr)
 {
@@ -33,6 +34,7 @@ bool HeaderFileReader::OpenBaseStream()
         return false;
     }
 
+    m_base_stream = stream.get();
     m_stream = stream.get();
     m_open_streams.emplace_back(std::move(stream));
     return true;
@@ -97,3 +99,11 @@ bool HeaderFileReader::ReadHeaderFile(IDataRepository* repository)
                                    return postProcessor->PostProcess(repository);
                                });
 }
+
+std::vector<std::string> HeaderFileReader::GetReadFiles() const
+{
+    if (!m_base_stream)
+        return {};
+
+    return m_base_stream->GetOpenedFiles();
+}
@@ -2,11 +2,13 @@
 
 #include "Parsing/IPackValueSupplier.h"
 #include "Parsing/IParserLineStream.h"
+#include "Parsing/Impl/ParserFilesystemStream.h"
 #include "Parsing/PostProcessing/IPostProcessor.h"
 #include "Persistence/IDataRepository.h"
 #include "ZoneCodeGeneratorArguments.h"
 
 #include <string>
+#include <vector>
 
 class HeaderFileReader
 {
@@ -17,6 +19,7 @@ class HeaderFileReader
     std::string m_filename;
 
     std::vector<std::unique_ptr<IParserLineStream>> m_open_streams;
+    const ParserFilesystemStream* m_base_stream;
     const IPackValueSupplier* m_pack_value_supplier;
     IParserLineStream* m_stream;
 
@@ -30,4 +33,9 @@ public:
     HeaderFileReader(const ZoneCodeGeneratorArguments* args, std::string filename);
 
     bool ReadHeaderFile(IDataRepository* repository);
+
+    /**
+     * \brief Returns the absolute paths of the header file and all files it included. Only complete after reading the file.
+     */
+    _NODISCARD std::vector<std::string> GetReadFiles() const;
 };
@@ -0,0 +1,73 @@
+#include "LoadingRequiredPostProcessor.h"
+
+#include "Domain/Computations/MemberComputations.h"
+#include "Domain/Definition/PointerDeclarationModifier.h"
+
+#include <unordered_set>
+
+bool LoadingRequiredPostProcessor::CalculateRequiresLoading(std::unordered_set<const void*>& visitedStructures, StructureInformation* info)
+{
+    if (visitedStructures.find(info) != visitedStructures.end())
+        return info->m_requires_loading;
+
+    visitedStructures.emplace(info);
+
+    for (const auto& member : info->m_ordered_members)
+    {
+        // If there is a condition to this member, and it always evaluates to false: Skip this member
+        if (member->m_condition && member->m_condition->IsStatic() && member->m_condition->EvaluateNumeric() == 0)
+            continue;
+
+        // Strings need to be processed. Unlike when marking or writing, script strings are loaded as they are.
+        if (member->m_is_string)
+        {
+            info->m_requires_loading = true;
+            return true;
+        }
+
+        // If there are any Pointer members that are not always count 0 it needs to be processed.
+        for (const auto& modifier : member->m_member->m_type_declaration->m_declaration_modifiers)
+        {
+            if (modifier->GetType() == DeclarationModifierType::POINTER)
+            {
+                const auto* pointer = dynamic_cast<PointerDeclarationModifier*>(modifier.get());
+                const auto* countEvaluation = pointer->GetCountEvaluation();
+
+                if (!countEvaluation->IsStatic() || countEvaluation->EvaluateNumeric() != 0)
+                {
+                    info->m_requires_loading = true;
+                    return true;
+                }
+            }
+        }
+
+        // If the member has an embedded type with dynamic size
+        if (MemberComputations(member.get()).HasDynamicArraySize())
+        {
+            info->m_requires_loading = true;
+            return true;
+        }
+
+        if (member->m_type != nullptr && member->m_type != info && CalculateRequiresLoading(visitedStructures, member->m_type))
+        {
+            info->m_requires_loading = true;
+            return true;
+        }
+    }
+
+    info->m_requires_loading = false;
+    return false;
+}
+
+bool LoadingRequiredPostProcessor::PostProcess(IDataRepository* repository)
+{
+    const auto& allInfos = repository->GetAllStructureInformation();
+
+    std::unordered_set<const void*> visitedStructures;
+    for (const auto& info : allInfos)
+    {
+        CalculateRequiresLoading(visitedStructures, info);
+    }
+
+    return true;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "IPostProcessor.h"
+
+#include <unordered_set>
+
+class LoadingRequiredPostProcessor final : public IPostProcessor
+{
+    static bool CalculateRequiresLoading(std::unordered_set<const void*>& visitedStructures, StructureInformation* info);
+
+public:
+    bool PostProcess(IDataRepository* repository) override;
+};
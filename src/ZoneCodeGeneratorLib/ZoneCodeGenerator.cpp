@@ -1,6 +1,7 @@
 #include "ZoneCodeGenerator.h"
 
 #include "Generating/CodeGenerator.h"
+#include "Generating/GenerationCache.h"
 #include "Parsing/Commands/CommandsFileReader.h"
 #include "Parsing/Header/HeaderFileReader.h"
 #include "Persistence/IDataRepository.h"
@@ -18,7 +19,7 @@ class ZoneCodeGenerator::Impl
     ZoneCodeGeneratorArguments m_args;
     std::unique_ptr<IDataRepository> m_repository;
 
-    bool ReadHeaderData()
+    bool ReadHeaderData(GenerationCache& cache)
     {
         for (const auto& headerFile : m_args.m_header_paths)
         {
@@ -26,12 +27,15 @@ class ZoneCodeGenerator::Impl
 
             if (!headerFileReader.ReadHeaderFile(m_repository.get()))
                 return false;
+
+            for (const auto& readFile : headerFileReader.GetReadFiles())
+                cache.AddInputFile(readFile);
         }
 
         return true;
     }
 
-    bool ReadCommandsData()
+    bool ReadCommandsData(GenerationCache& cache)
     {
         for (const auto& commandsFile : m_args.m_command_paths)
         {
@@ -39,6 +43,9 @@ class ZoneCodeGenerator::Impl
 
             if (!commandsFileReader.ReadCommandsFile(m_repository.get()))
                 return false;
+
+            for (const auto& readFile : commandsFileReader.GetReadFiles())
+                cache.AddInputFile(readFile);
         }
 
         return true;
@@ -50,10 +57,16 @@ class ZoneCodeGenerator::Impl
         prettyPrinter.PrintAll();
     }
 
-    _NODISCARD bool GenerateCode() const
+    _NODISCARD bool GenerateCode(GenerationCache& cache) const
     {
         CodeGenerator codeGenerator(&m_args);
-        return codeGenerator.GenerateCode(m_repository.get());
+        if (!codeGenerator.GenerateCode(m_repository.get()))
+            return false;
+
+        for (const auto& generatedFile : codeGenerator.GetGeneratedFiles())
+            cache.AddOutputFile(generatedFile);
+
+        return true;
     }
 
 public:
@@ -71,7 +84,21 @@ public:
         if (!shouldContinue)
             return 0;
 
-        if (!ReadHeaderData() || !ReadCommandsData())
+        // Printing needs the data of the inputs so reading them can only be skipped when only generating
+        const auto useCache = m_args.m_use_cache && m_args.ShouldGenerate() && !m_args.ShouldPrint();
+        GenerationCache cache(&m_args, argv[0]);
+        if (useCache)
+        {
+            if (cache.IsUpToDate())
+            {
+                std::cout << "Generated code is up to date\n";
+                return 0;
+            }
+
+            cache.Invalidate();
+        }
+
+        if (!ReadHeaderData(cache) || !ReadCommandsData(cache))
             return 1;
 
         if (m_args.ShouldPrint())
@@ -81,10 +108,13 @@ public:
 
         if (m_args.ShouldGenerate())
         {
-            if (!GenerateCode())
+            if (!GenerateCode(cache))
                 return 1;
         }
 
+        if (useCache)
+            cache.Save();
+
         return 0;
     }
 };
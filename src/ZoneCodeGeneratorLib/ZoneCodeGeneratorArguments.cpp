@@ -4,6 +4,7 @@
 #include "Utils/Arguments/CommandLineOption.h"
 #include "Utils/Arguments/UsageInformation.h"
 
+#include <cstdlib>
 #include <iostream>
 #include <type_traits>
 
@@ -66,13 +67,38 @@ const CommandLineOption* const OPTION_GENERATE =
         .WithShortName("g")
         .WithLongName("generate")
         .WithDescription("Generates a specified asset/preset combination. Can be used multiple times. Available presets: "
-                         "ZoneLoad, ZoneWrite, AssetStructTests")
+                         "ZoneLoad, ZoneWrite, AssetStructTests, AssetBenchmarks")
         .WithCategory(CATEGORY_OUTPUT)
         .WithParameter("assetName")
         .WithParameter("preset")
         .Reusable()
         .Build();
 
+const CommandLineOption* const OPTION_LOAD_STREAM =
+    CommandLineOption::Builder::Create()
+        .WithLongName("load-stream")
+        .WithDescription("Makes generated loaders use the specified final zone input stream class instead of the IZoneInputStream interface. "
+                         "This allows calls to the stream to be inlined. The class is included from \"Zone/Stream/Impl/<className>.h\".")
+        .WithCategory(CATEGORY_OUTPUT)
+        .WithParameter("className")
+        .Build();
+
+const CommandLineOption* const OPTION_JOBS =
+    CommandLineOption::Builder::Create()
+        .WithShortName("j")
+        .WithLongName("jobs")
+        .WithDescription("Specifies the amount of files that are generated at the same time. Defaults to the amount of hardware threads.")
+        .WithCategory(CATEGORY_OUTPUT)
+        .WithParameter("jobCount")
+        .Build();
+
+const CommandLineOption* const OPTION_NO_CACHE =
+    CommandLineOption::Builder::Create()
+        .WithLongName("no-cache")
+        .WithDescription("Always reads all input files and generates code, even if nothing changed since the last run into the same output folder.")
+        .WithCategory(CATEGORY_OUTPUT)
+        .Build();
+
 const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_HELP,
     OPTION_VERSION,
@@ -82,6 +108,9 @@ const CommandLineOption* const COMMAND_LINE_OPTIONS[]{
     OPTION_OUTPUT_FOLDER,
     OPTION_PRINT,
     OPTION_GENERATE,
+    OPTION_LOAD_STREAM,
+    OPTION_JOBS,
+    OPTION_NO_CACHE,
 };
 
 ZoneCodeGeneratorArguments::GenerationTask::GenerationTask()
@@ -104,7 +133,9 @@ ZoneCodeGeneratorArguments::GenerationTask::GenerationTask(std::string assetName
 
 ZoneCodeGeneratorArguments::ZoneCodeGeneratorArguments()
     : m_argument_parser(COMMAND_LINE_OPTIONS, std::extent_v<decltype(COMMAND_LINE_OPTIONS)>),
-      m_task_flags(0)
+      m_task_flags(0),
+      m_job_count(0u),
+      m_use_cache(true)
 {
     m_verbose = false;
 }
@@ -204,6 +235,29 @@ bool ZoneCodeGeneratorArguments::ParseArgs(const int argc, const char** argv, bo
         }
     }
 
+    // --load-stream
+    if (m_argument_parser.IsOptionSpecified(OPTION_LOAD_STREAM))
+        m_load_stream_class = m_argument_parser.GetValueForOption(OPTION_LOAD_STREAM);
+
+    // -j; --jobs
+    if (m_argument_parser.IsOptionSpecified(OPTION_JOBS))
+    {
+        const auto specifiedValue = m_argument_parser.GetValueForOption(OPTION_JOBS);
+
+        char* endPtr;
+        const auto parsedValue = strtoul(specifiedValue.c_str(), &endPtr, 10);
+        if (specifiedValue.empty() || *endPtr != '\0' || parsedValue == 0u)
+        {
+            std::cout << "Illegal value: \"" << specifiedValue << "\" is not a valid job count.\n";
+            return false;
+        }
+
+        m_job_count = static_cast<unsigned>(parsedValue);
+    }
+
+    // --no-cache
+    m_use_cache = !m_argument_parser.IsOptionSpecified(OPTION_NO_CACHE);
+
     if (m_task_flags == 0)
     {
         std::cout << "There was no output task specified.\n";
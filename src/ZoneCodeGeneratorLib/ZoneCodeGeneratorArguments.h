@@ -39,6 +39,9 @@ public:
 
     unsigned m_task_flags;
     std::vector<GenerationTask> m_generation_tasks;
+    std::string m_load_stream_class;
+    unsigned m_job_count;
+    bool m_use_cache;
 
     ZoneCodeGeneratorArguments();
     bool ParseArgs(int argc, const char** argv, bool& shouldContinue);
@@ -33,3 +33,8 @@ MatcherFactoryWrapper<ZoneDefinitionParserValue> ZoneDefinitionMatcherFactory::C
 {
     return MatcherFactoryWrapper<ZoneDefinitionParserValue>(std::make_unique<ZoneDefinitionMatcherCharacter>(c));
 }
+
+MatcherFactoryWrapper<ZoneDefinitionParserValue> ZoneDefinitionMatcherFactory::AssetEntry() const
+{
+    return MatcherFactoryWrapper<ZoneDefinitionParserValue>(std::make_unique<ZoneDefinitionMatcherValueType>(ZoneDefinitionParserValueType::ASSET_ENTRY));
+}
@@ -15,4 +15,5 @@ public:
     _NODISCARD MatcherFactoryWrapper<ZoneDefinitionParserValue> Field() const;
     _NODISCARD MatcherFactoryWrapper<ZoneDefinitionParserValue> String() const;
     _NODISCARD MatcherFactoryWrapper<ZoneDefinitionParserValue> Char(char c) const;
+    _NODISCARD MatcherFactoryWrapper<ZoneDefinitionParserValue> AssetEntry() const;
 };
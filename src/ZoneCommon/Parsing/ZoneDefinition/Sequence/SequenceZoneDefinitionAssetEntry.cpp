@@ -0,0 +1,17 @@
+#include "SequenceZoneDefinitionAssetEntry.h"
+
+#include "Parsing/ZoneDefinition/Matcher/ZoneDefinitionMatcherFactory.h"
+
+SequenceZoneDefinitionAssetEntry::SequenceZoneDefinitionAssetEntry()
+{
+    const ZoneDefinitionMatcherFactory create(this);
+
+    AddMatchers({
+        create.AssetEntry().Capture(CAPTURE_ASSET_ENTRY),
+    });
+}
+
+void SequenceZoneDefinitionAssetEntry::ProcessMatch(ZoneDefinition* state, SequenceResult<ZoneDefinitionParserValue>& result) const
+{
+    state->m_assets.emplace_back(std::move(result.NextCapture(CAPTURE_ASSET_ENTRY).AssetEntryValue()));
+}
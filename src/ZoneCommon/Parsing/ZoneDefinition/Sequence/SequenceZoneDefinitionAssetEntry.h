@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Parsing/ZoneDefinition/ZoneDefinitionParser.h"
+
+class SequenceZoneDefinitionAssetEntry final : public ZoneDefinitionParser::sequence_t
+{
+    static constexpr auto CAPTURE_ASSET_ENTRY = 1;
+
+protected:
+    void ProcessMatch(ZoneDefinition* state, SequenceResult<ZoneDefinitionParserValue>& result) const override;
+
+public:
+    SequenceZoneDefinitionAssetEntry();
+};
@@ -7,6 +7,11 @@ ZoneDefinitionLexer::ZoneDefinitionLexer(IParserLineStream* stream)
 {
 }
 
+bool ZoneDefinitionLexer::IsKeyword(const std::string_view field)
+{
+    return field == "include" || field == "ignore" || field == "assetlist" || field == "build";
+}
+
 std::string ZoneDefinitionLexer::ReadField()
 {
     const auto& currentLine = CurrentLine();
@@ -45,6 +50,72 @@ std::string ZoneDefinitionLexer::ReadField()
     return std::string(currentLine.m_line, startPos, lastNonSpaceOffset - startPos);
 }
 
+std::unique_ptr<ZoneDefinitionEntry> ZoneDefinitionLexer::ReadPlainAssetEntry()
+{
+    // Generated zone definitions mostly consist of lines like "type,name" or "type,,name".
+    // Those are scanned as a whole instead of creating a token for every field and separator.
+    const auto& currentLine = CurrentLine();
+    assert(m_current_line_offset >= 1);
+
+    const std::string_view line(currentLine.m_line);
+    const auto typeStart = m_current_line_offset - 1;
+    for (auto i = 0u; i < typeStart; i++)
+    {
+        if (!isspace(line[i]))
+            return nullptr;
+    }
+
+    const auto lineSize = line.size();
+    auto pos = typeStart;
+    auto typeEnd = typeStart;
+    while (pos < lineSize && line[pos] != ',')
+    {
+        const auto c = line[pos++];
+        if (c == '\"' || c == '>' || c == '<')
+            return nullptr;
+        if (!isspace(c))
+            typeEnd = pos;
+    }
+
+    if (pos >= lineSize)
+        return nullptr;
+
+    const auto type = line.substr(typeStart, typeEnd - typeStart);
+    if (IsKeyword(type))
+        return nullptr;
+
+    pos++;
+    while (pos < lineSize && isspace(line[pos]))
+        pos++;
+
+    auto isReference = false;
+    if (pos < lineSize && line[pos] == ',')
+    {
+        isReference = true;
+        pos++;
+        while (pos < lineSize && isspace(line[pos]))
+            pos++;
+    }
+
+    // Names that are missing or continue on the next line are left to the parser
+    if (pos >= lineSize)
+        return nullptr;
+
+    const auto nameStart = pos;
+    auto nameEnd = nameStart;
+    while (pos < lineSize)
+    {
+        const auto c = line[pos++];
+        if (c == '\"' || c == '>' || c == '<' || c == ',')
+            return nullptr;
+        if (!isspace(c))
+            nameEnd = pos;
+    }
+
+    m_current_line_offset = static_cast<unsigned>(lineSize);
+    return std::make_unique<ZoneDefinitionEntry>(std::string(type), std::string(line.substr(nameStart, nameEnd - nameStart)), isReference);
+}
+
 ZoneDefinitionParserValue ZoneDefinitionLexer::GetNextToken()
 {
     auto c = NextChar();
@@ -65,7 +136,11 @@ ZoneDefinitionParserValue ZoneDefinitionLexer::GetNextToken()
             if (isspace(c))
                 break;
 
-            return ZoneDefinitionParserValue::Field(GetPreviousCharacterPos(), new std::string(ReadField()));
+            const auto pos = GetPreviousCharacterPos();
+            if (auto assetEntry = ReadPlainAssetEntry())
+                return ZoneDefinitionParserValue::AssetEntry(pos, assetEntry.release());
+
+            return ZoneDefinitionParserValue::Field(pos, new std::string(ReadField()));
         }
 
         c = NextChar();
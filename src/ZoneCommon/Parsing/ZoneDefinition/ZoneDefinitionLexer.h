@@ -1,11 +1,18 @@
 #pragma once
 
 #include "Parsing/Impl/AbstractLexer.h"
+#include "Zone/Definition/ZoneDefinition.h"
 #include "ZoneDefinitionParserValue.h"
 
+#include <memory>
+#include <string_view>
+
 class ZoneDefinitionLexer final : public AbstractLexer<ZoneDefinitionParserValue>
 {
+    static bool IsKeyword(std::string_view field);
+
     std::string ReadField();
+    std::unique_ptr<ZoneDefinitionEntry> ReadPlainAssetEntry();
 
 protected:
     ZoneDefinitionParserValue GetNextToken() override;
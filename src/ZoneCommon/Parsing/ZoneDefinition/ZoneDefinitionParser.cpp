@@ -1,5 +1,6 @@
 #include "ZoneDefinitionParser.h"
 
+#include "Sequence/SequenceZoneDefinitionAssetEntry.h"
 #include "Sequence/SequenceZoneDefinitionAssetList.h"
 #include "Sequence/SequenceZoneDefinitionBuild.h"
 #include "Sequence/SequenceZoneDefinitionEntry.h"
@@ -14,7 +15,9 @@ ZoneDefinitionParser::ZoneDefinitionParser(ZoneDefinitionLexer* lexer)
 
 const std::vector<AbstractParser<ZoneDefinitionParserValue, ZoneDefinition>::sequence_t*>& ZoneDefinitionParser::GetTestsForState()
 {
+    // Plain asset entries make up most of the file, so they are tested first
     static std::vector<sequence_t*> tests({
+        new SequenceZoneDefinitionAssetEntry(),
         new SequenceZoneDefinitionMetaData(),
         new SequenceZoneDefinitionInclude(),
         new SequenceZoneDefinitionIgnore(),
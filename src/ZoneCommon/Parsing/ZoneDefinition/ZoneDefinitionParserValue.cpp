@@ -1,5 +1,7 @@
 #include "ZoneDefinitionParserValue.h"
 
+#include "Zone/Definition/ZoneDefinition.h"
+
 #include <cassert>
 
 ZoneDefinitionParserValue ZoneDefinitionParserValue::Invalid(const TokenPos pos)
@@ -36,6 +38,13 @@ ZoneDefinitionParserValue ZoneDefinitionParserValue::Field(const TokenPos pos, s
     return pv;
 }
 
+ZoneDefinitionParserValue ZoneDefinitionParserValue::AssetEntry(const TokenPos pos, ZoneDefinitionEntry* entry)
+{
+    ZoneDefinitionParserValue pv(pos, ZoneDefinitionParserValueType::ASSET_ENTRY);
+    pv.m_value.asset_entry_value = entry;
+    return pv;
+}
+
 ZoneDefinitionParserValue::ZoneDefinitionParserValue(const TokenPos pos, const ZoneDefinitionParserValueType type)
     : m_pos(pos),
       m_type(type),
@@ -53,6 +62,10 @@ ZoneDefinitionParserValue::~ZoneDefinitionParserValue()
         delete m_value.string_value;
         break;
 
+    case ZoneDefinitionParserValueType::ASSET_ENTRY:
+        delete m_value.asset_entry_value;
+        break;
+
     default:
         break;
     }
@@ -113,3 +126,9 @@ size_t ZoneDefinitionParserValue::FieldHash() const
     assert(m_type == ZoneDefinitionParserValueType::FIELD);
     return m_hash;
 }
+
+ZoneDefinitionEntry& ZoneDefinitionParserValue::AssetEntryValue() const
+{
+    assert(m_type == ZoneDefinitionParserValueType::ASSET_ENTRY);
+    return *m_value.asset_entry_value;
+}
@@ -6,6 +6,8 @@
 
 #include <string>
 
+class ZoneDefinitionEntry;
+
 enum class ZoneDefinitionParserValueType
 {
     // Meta tokens
@@ -16,6 +18,9 @@ enum class ZoneDefinitionParserValueType
     STRING,
     FIELD,
 
+    // A whole plain asset entry line that was read without tokenizing it
+    ASSET_ENTRY,
+
     // End
     MAX
 };
@@ -31,6 +36,7 @@ public:
     {
         char char_value;
         std::string* string_value;
+        ZoneDefinitionEntry* asset_entry_value;
     } m_value;
 
     static ZoneDefinitionParserValue Invalid(TokenPos pos);
@@ -38,6 +44,7 @@ public:
     static ZoneDefinitionParserValue Character(TokenPos pos, char c);
     static ZoneDefinitionParserValue String(TokenPos pos, std::string* str);
     static ZoneDefinitionParserValue Field(TokenPos pos, std::string* field);
+    static ZoneDefinitionParserValue AssetEntry(TokenPos pos, ZoneDefinitionEntry* entry);
 
 private:
     ZoneDefinitionParserValue(TokenPos pos, ZoneDefinitionParserValueType type);
@@ -56,4 +63,5 @@ public:
     _NODISCARD std::string& StringValue() const;
     _NODISCARD std::string& FieldValue() const;
     _NODISCARD size_t FieldHash() const;
+    _NODISCARD ZoneDefinitionEntry& AssetEntryValue() const;
 };
@@ -0,0 +1,46 @@
+#include "AssetClosure.h"
+
+#include "ZoneAssetPools.h"
+
+AssetClosure::AssetClosure(const ZoneAssetPools& pools)
+    : m_pools(pools),
+      m_asset_types(pools.GetAssetTypeCount())
+{
+}
+
+void AssetClosure::AddRoot(const XAssetInfoGeneric* asset)
+{
+    std::vector<const XAssetInfoGeneric*> assetsToVisit{asset};
+    while (!assetsToVisit.empty())
+    {
+        const auto* currentAsset = assetsToVisit.back();
+        assetsToVisit.pop_back();
+
+        if (currentAsset == nullptr || !m_assets.emplace(currentAsset).second)
+            continue;
+
+        if (currentAsset->m_type >= 0 && static_cast<size_t>(currentAsset->m_type) < m_asset_types.size())
+            m_asset_types[currentAsset->m_type] = true;
+
+        for (const auto* dependency : currentAsset->m_dependencies)
+            assetsToVisit.emplace_back(dependency);
+
+        for (const auto& indirectReference : currentAsset->m_indirect_asset_references)
+            assetsToVisit.emplace_back(m_pools.GetAsset(indirectReference.m_type, indirectReference.m_name));
+    }
+}
+
+bool AssetClosure::Contains(const XAssetInfoGeneric* asset) const
+{
+    return m_assets.contains(asset);
+}
+
+bool AssetClosure::ContainsAssetType(const asset_type_t assetType) const
+{
+    return assetType >= 0 && static_cast<size_t>(assetType) < m_asset_types.size() && m_asset_types[assetType];
+}
+
+size_t AssetClosure::GetAssetCount() const
+{
+    return m_assets.size();
+}
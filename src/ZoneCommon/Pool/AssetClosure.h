@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Utils/ClassUtils.h"
+#include "XAssetInfo.h"
+#include "Zone/ZoneTypes.h"
+
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+class ZoneAssetPools;
+
+/**
+ * \brief The assets of a zone that are reachable from a set of root assets.
+ * Assets are reachable through their dependencies and through indirect references to assets of the same zone.
+ */
+class AssetClosure
+{
+public:
+    /**
+     * \brief Creates an empty closure.
+     * \param pools The pools of the zone to resolve indirect asset references with.
+     */
+    explicit AssetClosure(const ZoneAssetPools& pools);
+
+    /**
+     * \brief Adds an asset and all assets that are reachable from it.
+     * \param asset The root asset to add.
+     */
+    void AddRoot(const XAssetInfoGeneric* asset);
+
+    _NODISCARD bool Contains(const XAssetInfoGeneric* asset) const;
+    _NODISCARD bool ContainsAssetType(asset_type_t assetType) const;
+    _NODISCARD size_t GetAssetCount() const;
+
+private:
+    const ZoneAssetPools& m_pools;
+    std::unordered_set<const XAssetInfoGeneric*> m_assets;
+    std::vector<bool> m_asset_types;
+};
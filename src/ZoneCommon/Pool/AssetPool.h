@@ -5,6 +5,7 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 
 class Zone;
 
@@ -13,14 +14,15 @@ template<typename T> class AssetPool
 public:
     using type = T;
 
-    std::map<std::string, XAssetInfo<T>*> m_asset_lookup;
+    // Keys are normalized asset names. Looking up names that are not normalized yet works as well.
+    std::map<std::string, XAssetInfo<T>*, AssetNameLess> m_asset_lookup;
 
     class Iterator
     {
-        typename std::map<std::string, XAssetInfo<T>*>::iterator m_iterator;
+        typename std::map<std::string, XAssetInfo<T>*, AssetNameLess>::iterator m_iterator;
 
     public:
-        explicit Iterator(typename std::map<std::string, XAssetInfo<T>*>::iterator i)
+        explicit Iterator(typename std::map<std::string, XAssetInfo<T>*, AssetNameLess>::iterator i)
         {
             m_iterator = i;
         }
@@ -41,10 +43,7 @@ public:
         }
     };
 
-    AssetPool()
-    {
-        m_asset_lookup = std::map<std::string, XAssetInfo<T>*>();
-    }
+    AssetPool() = default;
 
     virtual ~AssetPool() = default;
 
@@ -52,8 +51,7 @@ public:
 
     XAssetInfo<T>* GetAsset(const std::string& name)
     {
-        const auto normalizedName = XAssetInfo<T>::NormalizeAssetName(name);
-        auto foundAsset = m_asset_lookup.find(normalizedName);
+        auto foundAsset = m_asset_lookup.find(std::string_view(name));
 
         if (foundAsset == m_asset_lookup.end())
             return nullptr;
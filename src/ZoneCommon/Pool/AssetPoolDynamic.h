@@ -4,17 +4,51 @@
 #include "GlobalAssetPool.h"
 #include "XAssetInfo.h"
 
+#include <algorithm>
 #include <cstring>
+#include <memory>
+#include <vector>
 
 template<typename T> class AssetPoolDynamic final : public AssetPool<T>
 {
     using AssetPool<T>::m_asset_lookup;
 
-    std::vector<std::unique_ptr<XAssetInfo<T>>> m_assets;
+    // Assets are kept next to their info in chunks that never move so they can be referenced for the whole lifetime of the pool
+    struct AssetPoolEntry
+    {
+        XAssetInfo<T> m_info;
+        T m_entry;
+    };
+
+    struct AssetPoolChunk
+    {
+        std::unique_ptr<AssetPoolEntry[]> m_entries;
+        size_t m_capacity;
+    };
+
+    // Chunks grow with the pool so small pools stay small while big pools only need few allocations
+    static constexpr size_t MIN_CHUNK_CAPACITY = 16u;
+    static constexpr size_t MAX_CHUNK_CAPACITY = 1024u;
+
+    std::vector<AssetPoolChunk> m_chunks;
+    size_t m_used_in_last_chunk;
     asset_type_t m_type;
 
+    AssetPoolEntry& AllocateEntry()
+    {
+        if (m_chunks.empty() || m_used_in_last_chunk >= m_chunks.back().m_capacity)
+        {
+            const auto capacity = m_chunks.empty() ? MIN_CHUNK_CAPACITY : std::min(m_chunks.back().m_capacity * 2u, MAX_CHUNK_CAPACITY);
+            m_chunks.emplace_back(AssetPoolChunk{std::make_unique<AssetPoolEntry[]>(capacity), capacity});
+            m_used_in_last_chunk = 0u;
+        }
+
+        return m_chunks.back().m_entries[m_used_in_last_chunk++];
+    }
+
 public:
     AssetPoolDynamic(const int priority, const asset_type_t type)
+        : m_used_in_last_chunk(0u)
     {
         GlobalAssetPool<T>::LinkAssetPool(this, priority);
         m_type = type;
@@ -29,12 +63,8 @@ public:
     {
         GlobalAssetPool<T>::UnlinkAssetPool(this);
 
-        for (auto& entry : m_assets)
-        {
-            delete entry->Asset();
-        }
-
-        m_assets.clear();
+        m_chunks.clear();
+        m_used_in_last_chunk = 0u;
         m_asset_lookup.clear();
     }
 
@@ -42,13 +72,13 @@ public:
     {
         const auto normalizedName = XAssetInfo<T>::NormalizeAssetName(xAssetInfo->m_name);
 
-        T* newAsset = new T();
-        memcpy(newAsset, xAssetInfo->Asset(), sizeof(T));
-        xAssetInfo->m_ptr = newAsset;
+        auto& poolEntry = AllocateEntry();
+        memcpy(&poolEntry.m_entry, xAssetInfo->Asset(), sizeof(T));
+        xAssetInfo->m_ptr = &poolEntry.m_entry;
 
-        auto* pAssetInfo = xAssetInfo.get();
+        auto* pAssetInfo = &poolEntry.m_info;
+        *pAssetInfo = std::move(*xAssetInfo);
         m_asset_lookup[normalizedName] = pAssetInfo;
-        m_assets.emplace_back(std::move(xAssetInfo));
 
         GlobalAssetPool<T>::LinkAsset(this, normalizedName, pAssetInfo);
 
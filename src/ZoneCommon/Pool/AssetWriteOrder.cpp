@@ -0,0 +1,161 @@
+#include "AssetWriteOrder.h"
+
+#include "ZoneAssetPools.h"
+
+#include <functional>
+#include <map>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+    class AssetGraph
+    {
+    public:
+        explicit AssetGraph(const std::vector<XAssetInfoGeneric*>& assets)
+            : m_dependencies(assets.size()),
+              m_dependents(assets.size())
+        {
+            std::unordered_map<const XAssetInfoGeneric*, size_t> indexOfAsset;
+            indexOfAsset.reserve(assets.size());
+            for (auto assetIndex = 0u; assetIndex < assets.size(); assetIndex++)
+                indexOfAsset.emplace(assets[assetIndex], assetIndex);
+
+            // Dependencies of other zones are not written with this zone and do not restrict the order
+            for (auto assetIndex = 0u; assetIndex < assets.size(); assetIndex++)
+            {
+                for (const auto* dependency : assets[assetIndex]->m_dependencies)
+                {
+                    const auto foundDependency = indexOfAsset.find(dependency);
+                    if (foundDependency == indexOfAsset.end() || foundDependency->second == assetIndex)
+                        continue;
+
+                    m_dependencies[assetIndex].emplace_back(foundDependency->second);
+                    m_dependents[foundDependency->second].emplace_back(assetIndex);
+                }
+            }
+        }
+
+        std::vector<std::vector<size_t>> m_dependencies;
+        std::vector<std::vector<size_t>> m_dependents;
+    };
+
+    std::vector<size_t> OrderByType(const std::vector<XAssetInfoGeneric*>& assets, const AssetGraph& graph)
+    {
+        // Keeps picking assets of the current type as long as there are some whose dependencies were all ordered already.
+        // Only then continues with the lowest type that has assets ready. Assets of the same type keep their original order.
+        using ready_queue_t = std::priority_queue<size_t, std::vector<size_t>, std::greater<>>;
+        std::map<asset_type_t, ready_queue_t> readyAssetsByType;
+
+        std::vector<size_t> remainingDependencies(assets.size());
+        for (auto assetIndex = 0u; assetIndex < assets.size(); assetIndex++)
+        {
+            remainingDependencies[assetIndex] = graph.m_dependencies[assetIndex].size();
+            if (remainingDependencies[assetIndex] == 0u)
+                readyAssetsByType[assets[assetIndex]->m_type].emplace(assetIndex);
+        }
+
+        std::vector<size_t> order;
+        order.reserve(assets.size());
+        std::vector<bool> ordered(assets.size(), false);
+        auto currentType = readyAssetsByType.empty() ? 0 : readyAssetsByType.begin()->first;
+        while (!readyAssetsByType.empty())
+        {
+            auto currentTypeAssets = readyAssetsByType.find(currentType);
+            if (currentTypeAssets == readyAssetsByType.end())
+            {
+                currentTypeAssets = readyAssetsByType.begin();
+                currentType = currentTypeAssets->first;
+            }
+
+            const auto assetIndex = currentTypeAssets->second.top();
+            currentTypeAssets->second.pop();
+            if (currentTypeAssets->second.empty())
+                readyAssetsByType.erase(currentTypeAssets);
+
+            order.emplace_back(assetIndex);
+            ordered[assetIndex] = true;
+
+            for (const auto dependentIndex : graph.m_dependents[assetIndex])
+            {
+                if (--remainingDependencies[dependentIndex] == 0u)
+                    readyAssetsByType[assets[dependentIndex]->m_type].emplace(dependentIndex);
+            }
+        }
+
+        // Assets with cyclic dependencies cannot be ordered and keep their original order
+        for (auto assetIndex = 0u; assetIndex < assets.size(); assetIndex++)
+        {
+            if (!ordered[assetIndex])
+                order.emplace_back(assetIndex);
+        }
+
+        return order;
+    }
+
+    std::vector<size_t> OrderByDependencies(const std::vector<XAssetInfoGeneric*>& assets, const AssetGraph& graph)
+    {
+        std::vector<size_t> order;
+        order.reserve(assets.size());
+        std::vector<bool> visited(assets.size(), false);
+
+        // Orders the dependencies of an asset depth first before the asset itself
+        std::vector<std::pair<size_t, size_t>> stack;
+        const auto visit = [&graph, &order, &visited, &stack](const size_t rootIndex)
+        {
+            if (visited[rootIndex])
+                return;
+
+            visited[rootIndex] = true;
+            stack.emplace_back(rootIndex, 0u);
+            while (!stack.empty())
+            {
+                auto& [assetIndex, nextDependency] = stack.back();
+                const auto& dependencies = graph.m_dependencies[assetIndex];
+                if (nextDependency < dependencies.size())
+                {
+                    const auto dependencyIndex = dependencies[nextDependency++];
+                    if (!visited[dependencyIndex])
+                    {
+                        visited[dependencyIndex] = true;
+                        stack.emplace_back(dependencyIndex, 0u);
+                    }
+                    continue;
+                }
+
+                order.emplace_back(assetIndex);
+                stack.pop_back();
+            }
+        };
+
+        // Assets that no other asset depends on are the roots of the dependency closures
+        for (auto assetIndex = 0u; assetIndex < assets.size(); assetIndex++)
+        {
+            if (graph.m_dependents[assetIndex].empty())
+                visit(assetIndex);
+        }
+
+        for (auto assetIndex = 0u; assetIndex < assets.size(); assetIndex++)
+            visit(assetIndex);
+
+        return order;
+    }
+} // namespace
+
+std::vector<XAssetInfoGeneric*> AssetWriteOrder::GetAssets(const ZoneAssetPools& pools, const AssetWriteOrderMode mode)
+{
+    std::vector<XAssetInfoGeneric*> assets(pools.begin(), pools.end());
+    if (mode == AssetWriteOrderMode::DEFINITION)
+        return assets;
+
+    const AssetGraph graph(assets);
+    const auto order = mode == AssetWriteOrderMode::TYPE ? OrderByType(assets, graph) : OrderByDependencies(assets, graph);
+
+    std::vector<XAssetInfoGeneric*> orderedAssets;
+    orderedAssets.reserve(assets.size());
+    for (const auto assetIndex : order)
+        orderedAssets.emplace_back(assets[assetIndex]);
+
+    return orderedAssets;
+}
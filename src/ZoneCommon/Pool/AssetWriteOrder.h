@@ -0,0 +1,31 @@
+#pragma once
+
+#include "XAssetInfo.h"
+
+#include <vector>
+
+class ZoneAssetPools;
+
+enum class AssetWriteOrderMode
+{
+    // The order assets were added to the zone in, which is the order of the zone definition with dependencies before the assets using them
+    DEFINITION,
+
+    // Assets of the same type are kept together as far as dependencies allow it
+    TYPE,
+
+    // Every asset is directly preceded by all of its dependencies that were not written before
+    DEPENDENCY
+};
+
+class AssetWriteOrder
+{
+public:
+    /**
+     * \brief Orders the assets of a zone for writing. Dependencies in the same zone are always ordered before the assets that use them.
+     * \param pools The pools of the zone to order the assets of.
+     * \param mode How to order the assets.
+     * \return All assets of the zone in the order they should be written in.
+     */
+    static std::vector<XAssetInfoGeneric*> GetAssets(const ZoneAssetPools& pools, AssetWriteOrderMode mode);
+};
@@ -1,11 +1,15 @@
 #pragma once
 
 #include "AssetPool.h"
+#include "GlobalAssetPoolLinkOrder.h"
 
 #include <algorithm>
 #include <cassert>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -15,175 +19,128 @@ template<typename T> class GlobalAssetPool
     {
         AssetPool<T>* m_asset_pool;
         int m_priority;
+        GlobalAssetPoolLinkOrder m_order;
     };
 
-    struct GameAssetPoolEntry
+    struct LinkedAsset
     {
         XAssetInfo<T>* m_asset;
-        bool m_duplicate;
         LinkedAssetPool* m_asset_pool;
     };
 
-    static std::vector<std::unique_ptr<LinkedAssetPool>> m_linked_asset_pools;
-    static std::unordered_map<std::string, GameAssetPoolEntry> m_assets;
-
-    static void SortLinkedAssetPools()
-    {
-        std::sort(m_linked_asset_pools.begin(),
-                  m_linked_asset_pools.end(),
-                  [](const std::unique_ptr<LinkedAssetPool>& a, const std::unique_ptr<LinkedAssetPool>& b) -> bool
-                  {
-                      return a->m_priority < b->m_priority;
-                  });
-    }
-
-    static bool ReplaceAssetPoolEntry(GameAssetPoolEntry& assetEntry)
+    struct GameAssetPoolEntry
     {
-        int occurrences = 0;
-
-        for (const auto& linkedAssetPool : m_linked_asset_pools)
-        {
-            XAssetInfo<T>* foundAsset = linkedAssetPool->m_asset_pool->GetAsset(assetEntry.m_asset->m_name);
-
-            if (foundAsset != nullptr)
-            {
-                if (++occurrences == 1)
-                {
-                    assetEntry.m_asset = foundAsset;
-                    assetEntry.m_duplicate = false;
-                    assetEntry.m_asset_pool = linkedAssetPool.get();
-                }
-                else
-                {
-                    assetEntry.m_duplicate = true;
-                    break;
-                }
-            }
-        }
+        // All linked assets with the same name ordered by descending priority. The first one is the one that is resolved.
+        std::vector<LinkedAsset> m_linked_assets;
+    };
 
-        return occurrences > 0;
-    }
+    // Zones can be loaded and unloaded from multiple threads at once
+    static std::shared_mutex m_mutex;
+    static std::unordered_map<AssetPool<T>*, std::unique_ptr<LinkedAssetPool>> m_linked_asset_pools;
+    // Keys are normalized asset names. Looking up names that are not normalized yet works as well.
+    static std::unordered_map<std::string, GameAssetPoolEntry, AssetNameHash, AssetNameEqual> m_assets;
 
-    static void LinkAsset(LinkedAssetPool* link, const std::string& normalizedAssetName, XAssetInfo<T>* asset)
+    static void LinkAsset(LinkedAssetPool* link, const std::string& assetName, XAssetInfo<T>* asset)
     {
-        auto existingAsset = m_assets.find(normalizedAssetName);
+        auto foundEntry = m_assets.find(std::string_view(assetName));
+        if (foundEntry == m_assets.end())
+            foundEntry = m_assets.emplace(XAssetInfo<T>::NormalizeAssetName(assetName), GameAssetPoolEntry()).first;
 
-        if (existingAsset == m_assets.end())
-        {
-            GameAssetPoolEntry entry{};
-            entry.m_asset = asset;
-            entry.m_asset_pool = link;
-            entry.m_duplicate = false;
+        auto& linkedAssets = foundEntry->second.m_linked_assets;
 
-            m_assets[normalizedAssetName] = entry;
-        }
-        else
-        {
-            auto& existingEntry = existingAsset->second;
+        // Assets of pools with the same priority are resolved in the link order of their pools
+        const auto insertPosition = std::ranges::find_if(linkedAssets,
+                                                         [link](const LinkedAsset& linkedAsset)
+                                                         {
+                                                             const auto* otherLink = linkedAsset.m_asset_pool;
+                                                             if (otherLink->m_priority != link->m_priority)
+                                                                 return otherLink->m_priority < link->m_priority;
 
-            existingEntry.m_duplicate = true;
+                                                             return link->m_order < otherLink->m_order;
+                                                         });
 
-            if (existingEntry.m_asset_pool->m_priority < link->m_priority)
-            {
-                existingEntry.m_asset_pool = link;
-                existingEntry.m_asset = asset;
-            }
-        }
+        linkedAssets.insert(insertPosition, LinkedAsset{asset, link});
     }
 
 public:
     static void LinkAssetPool(AssetPool<T>* assetPool, const int priority)
     {
+        std::lock_guard lock(m_mutex);
+
         auto newLink = std::make_unique<LinkedAssetPool>();
         newLink->m_asset_pool = assetPool;
         newLink->m_priority = priority;
+        newLink->m_order = GlobalAssetPoolLinkOrder::Next();
 
         auto* newLinkPtr = newLink.get();
-        m_linked_asset_pools.emplace_back(std::move(newLink));
-        SortLinkedAssetPools();
+        m_linked_asset_pools.emplace(assetPool, std::move(newLink));
 
         for (auto asset : *assetPool)
-        {
-            const auto normalizedAssetName = XAssetInfo<T>::NormalizeAssetName(asset->m_name);
-            LinkAsset(newLinkPtr, normalizedAssetName, asset);
-        }
+            LinkAsset(newLinkPtr, asset->m_name, asset);
     }
 
     static void LinkAsset(AssetPool<T>* assetPool, const std::string& normalizedAssetName, XAssetInfo<T>* asset)
     {
-        LinkedAssetPool* link = nullptr;
+        std::lock_guard lock(m_mutex);
 
-        for (const auto& existingLink : m_linked_asset_pools)
-        {
-            if (existingLink->m_asset_pool == assetPool)
-            {
-                link = existingLink.get();
-                break;
-            }
-        }
+        const auto foundLink = m_linked_asset_pools.find(assetPool);
 
-        assert(link != nullptr);
-        if (link == nullptr)
+        assert(foundLink != m_linked_asset_pools.end());
+        if (foundLink == m_linked_asset_pools.end())
             return;
 
-        LinkAsset(link, normalizedAssetName, asset);
+        LinkAsset(foundLink->second.get(), normalizedAssetName, asset);
     }
 
     static void UnlinkAssetPool(AssetPool<T>* assetPool)
     {
-        auto iLinkEntry = m_linked_asset_pools.begin();
+        std::lock_guard lock(m_mutex);
 
-        for (; iLinkEntry != m_linked_asset_pools.end(); ++iLinkEntry)
-        {
-            LinkedAssetPool* linkEntry = iLinkEntry->get();
-            if (linkEntry->m_asset_pool == assetPool)
-            {
-                break;
-            }
-        }
+        const auto foundLink = m_linked_asset_pools.find(assetPool);
 
-        assert(iLinkEntry != m_linked_asset_pools.end());
-        if (iLinkEntry == m_linked_asset_pools.end())
+        assert(foundLink != m_linked_asset_pools.end());
+        if (foundLink == m_linked_asset_pools.end())
             return;
 
-        auto assetPoolToUnlink = std::move(*iLinkEntry);
-        m_linked_asset_pools.erase(iLinkEntry);
+        const auto* link = foundLink->second.get();
 
-        for (auto iAssetEntry = m_assets.begin(); iAssetEntry != m_assets.end();)
+        // Only the entries of assets in the unlinked pool can reference it
+        for (auto asset : *assetPool)
         {
-            auto& assetEntry = *iAssetEntry;
-
-            if (assetEntry.second.m_asset_pool != assetPoolToUnlink.get())
-            {
-                ++iAssetEntry;
+            const auto foundEntry = m_assets.find(std::string_view(asset->m_name));
+            if (foundEntry == m_assets.end())
                 continue;
-            }
 
-            if (assetEntry.second.m_duplicate && ReplaceAssetPoolEntry(assetEntry.second))
-            {
-                ++iAssetEntry;
-                continue;
-            }
+            auto& linkedAssets = foundEntry->second.m_linked_assets;
+            std::erase_if(linkedAssets,
+                          [link](const LinkedAsset& linkedAsset)
+                          {
+                              return linkedAsset.m_asset_pool == link;
+                          });
 
-            iAssetEntry = m_assets.erase(iAssetEntry);
+            if (linkedAssets.empty())
+                m_assets.erase(foundEntry);
         }
+
+        m_linked_asset_pools.erase(foundLink);
     }
 
     static XAssetInfo<T>* GetAssetByName(const std::string& name)
     {
-        const auto normalizedName = XAssetInfo<T>::NormalizeAssetName(name);
-        const auto foundEntry = m_assets.find(normalizedName);
+        std::shared_lock lock(m_mutex);
+        const auto foundEntry = m_assets.find(std::string_view(name));
         if (foundEntry == m_assets.end())
             return nullptr;
 
-        return foundEntry->second.m_asset;
+        return foundEntry->second.m_linked_assets.front().m_asset;
     }
 };
 
+template<typename T> std::shared_mutex GlobalAssetPool<T>::m_mutex;
+
 template<typename T>
-std::vector<std::unique_ptr<typename GlobalAssetPool<T>::LinkedAssetPool>> GlobalAssetPool<T>::m_linked_asset_pools =
-    std::vector<std::unique_ptr<LinkedAssetPool>>();
+std::unordered_map<AssetPool<T>*, std::unique_ptr<typename GlobalAssetPool<T>::LinkedAssetPool>> GlobalAssetPool<T>::m_linked_asset_pools =
+    std::unordered_map<AssetPool<T>*, std::unique_ptr<LinkedAssetPool>>();
 
 template<typename T>
-std::unordered_map<std::string, typename GlobalAssetPool<T>::GameAssetPoolEntry> GlobalAssetPool<T>::m_assets =
-    std::unordered_map<std::string, GameAssetPoolEntry>();
+std::unordered_map<std::string, typename GlobalAssetPool<T>::GameAssetPoolEntry, AssetNameHash, AssetNameEqual> GlobalAssetPool<T>::m_assets;
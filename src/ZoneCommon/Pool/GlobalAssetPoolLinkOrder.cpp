@@ -0,0 +1,36 @@
+#include "GlobalAssetPoolLinkOrder.h"
+
+#include <atomic>
+
+namespace
+{
+    std::atomic<uint64_t> nextSequence = 0u;
+
+    thread_local const GlobalAssetPoolLinkOrder::BatchScope* currentBatchScope = nullptr;
+} // namespace
+
+GlobalAssetPoolLinkOrder GlobalAssetPoolLinkOrder::Next()
+{
+    if (currentBatchScope)
+        return GlobalAssetPoolLinkOrder{currentBatchScope->m_batch_sequence, currentBatchScope->m_index_in_batch};
+
+    return GlobalAssetPoolLinkOrder{nextSequence.fetch_add(1u, std::memory_order_relaxed), 0u};
+}
+
+uint64_t GlobalAssetPoolLinkOrder::BeginBatch()
+{
+    return nextSequence.fetch_add(1u, std::memory_order_relaxed);
+}
+
+GlobalAssetPoolLinkOrder::BatchScope::BatchScope(const uint64_t batchSequence, const size_t indexInBatch)
+    : m_previous_scope(currentBatchScope),
+      m_batch_sequence(batchSequence),
+      m_index_in_batch(indexInBatch)
+{
+    currentBatchScope = this;
+}
+
+GlobalAssetPoolLinkOrder::BatchScope::~BatchScope()
+{
+    currentBatchScope = m_previous_scope;
+}
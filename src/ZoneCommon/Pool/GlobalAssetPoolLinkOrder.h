@@ -0,0 +1,53 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * \brief Decides the order in which assets with the same name and priority of different pools are resolved by the global asset pools.
+ * Pools are ordered by the time they were linked, unless they are linked inside a batch scope.
+ * Pools of a batch are ordered by their index in the batch instead, which allows loading multiple zones at once while still resolving their assets
+ * like they were loaded one after another.
+ */
+class GlobalAssetPoolLinkOrder
+{
+public:
+    uint64_t m_sequence;
+    size_t m_index_in_batch;
+
+    auto operator<=>(const GlobalAssetPoolLinkOrder& other) const = default;
+
+    /**
+     * \brief Returns the order of a pool that is linked on the calling thread right now.
+     */
+    static GlobalAssetPoolLinkOrder Next();
+
+    /**
+     * \brief Reserves the position of a batch of pools that are linked concurrently. The batch is ordered after all pools that were linked before.
+     * \return The sequence of the batch to pass to its scopes.
+     */
+    static uint64_t BeginBatch();
+
+    /**
+     * \brief Orders all pools that are linked on the calling thread while the scope exists by an index within a batch.
+     */
+    class BatchScope
+    {
+    public:
+        BatchScope(uint64_t batchSequence, size_t indexInBatch);
+        ~BatchScope();
+        BatchScope(const BatchScope& other) = delete;
+        BatchScope(BatchScope&& other) noexcept = delete;
+        BatchScope& operator=(const BatchScope& other) = delete;
+        BatchScope& operator=(BatchScope&& other) noexcept = delete;
+
+    private:
+        friend class GlobalAssetPoolLinkOrder;
+
+        // Scopes can nest when a thread that waits for other jobs executes them in the meantime
+        const BatchScope* m_previous_scope;
+        uint64_t m_batch_sequence;
+        size_t m_index_in_batch;
+    };
+};
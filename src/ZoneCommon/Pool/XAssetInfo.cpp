@@ -3,6 +3,23 @@
 #include "Utils/StringUtils.h"
 
 #include <algorithm>
+#include <cctype>
+#include <cstdint>
+
+namespace
+{
+    constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325u;
+    constexpr uint64_t FNV_PRIME = 0x100000001B3u;
+
+    // Has to match the normalization of XAssetInfoGeneric::NormalizeAssetName
+    unsigned char NormalizeAssetNameChar(const char c)
+    {
+        if (c == '\\')
+            return '/';
+
+        return static_cast<unsigned char>(tolower(static_cast<unsigned char>(c)));
+    }
+} // namespace
 
 IndirectAssetReference::IndirectAssetReference()
     : m_type(-1)
@@ -37,7 +54,8 @@ std::size_t std::hash<IndirectAssetReference>::operator()(const IndirectAssetRef
 XAssetInfoGeneric::XAssetInfoGeneric()
     : m_type(-1),
       m_ptr(nullptr),
-      m_zone(nullptr)
+      m_zone(nullptr),
+      m_content_hash(0u)
 {
 }
 
@@ -45,7 +63,8 @@ XAssetInfoGeneric::XAssetInfoGeneric(const asset_type_t type, std::string name,
     : m_type(type),
       m_name(std::move(name)),
       m_ptr(ptr),
-      m_zone(nullptr)
+      m_zone(nullptr),
+      m_content_hash(0u)
 {
 }
 
@@ -56,7 +75,8 @@ XAssetInfoGeneric::XAssetInfoGeneric(
       m_ptr(ptr),
       m_dependencies(std::move(dependencies)),
       m_used_script_strings(std::move(usedScriptStrings)),
-      m_zone(nullptr)
+      m_zone(nullptr),
+      m_content_hash(0u)
 {
 }
 
@@ -72,7 +92,8 @@ XAssetInfoGeneric::XAssetInfoGeneric(asset_type_t type,
       m_dependencies(std::move(dependencies)),
       m_used_script_strings(std::move(usedScriptStrings)),
       m_indirect_asset_references(std::move(indirectAssetReferences)),
-      m_zone(nullptr)
+      m_zone(nullptr),
+      m_content_hash(0u)
 {
 }
 
@@ -89,7 +110,8 @@ XAssetInfoGeneric::XAssetInfoGeneric(const asset_type_t type,
       m_dependencies(std::move(dependencies)),
       m_used_script_strings(std::move(usedScriptStrings)),
       m_indirect_asset_references(std::move(indirectAssetReferences)),
-      m_zone(zone)
+      m_zone(zone),
+      m_content_hash(0u)
 {
 }
 
@@ -101,3 +123,36 @@ std::string XAssetInfoGeneric::NormalizeAssetName(std::string input)
 
     return input;
 }
+
+std::size_t AssetNameHash::operator()(const std::string_view name) const noexcept
+{
+    auto hash = FNV_OFFSET_BASIS;
+    for (const auto c : name)
+    {
+        hash ^= NormalizeAssetNameChar(c);
+        hash *= FNV_PRIME;
+    }
+
+    return static_cast<std::size_t>(hash);
+}
+
+bool AssetNameEqual::operator()(const std::string_view lhs, const std::string_view rhs) const noexcept
+{
+    return std::ranges::equal(lhs,
+                              rhs,
+                              [](const char lhsChar, const char rhsChar)
+                              {
+                                  return NormalizeAssetNameChar(lhsChar) == NormalizeAssetNameChar(rhsChar);
+                              });
+}
+
+bool AssetNameLess::operator()(const std::string_view lhs, const std::string_view rhs) const noexcept
+{
+    // Normalized names compare like std::string which compares characters as unsigned char
+    return std::ranges::lexicographical_compare(lhs,
+                                                rhs,
+                                                [](const char lhsChar, const char rhsChar)
+                                                {
+                                                    return NormalizeAssetNameChar(lhsChar) < NormalizeAssetNameChar(rhsChar);
+                                                });
+}
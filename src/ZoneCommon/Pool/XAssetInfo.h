@@ -2,7 +2,10 @@
 #include "Zone/Zone.h"
 #include "Zone/ZoneTypes.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class Zone;
@@ -27,6 +30,39 @@ template<> struct std::hash<IndirectAssetReference>
     std::size_t operator()(const IndirectAssetReference& v) const noexcept;
 };
 
+/**
+ * \brief Hashes asset names as if they were normalized with \c XAssetInfoGeneric::NormalizeAssetName without creating a normalized copy.
+ */
+class AssetNameHash
+{
+public:
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view name) const noexcept;
+};
+
+/**
+ * \brief Compares asset names for equality as if they were normalized with \c XAssetInfoGeneric::NormalizeAssetName.
+ */
+class AssetNameEqual
+{
+public:
+    using is_transparent = void;
+
+    bool operator()(std::string_view lhs, std::string_view rhs) const noexcept;
+};
+
+/**
+ * \brief Orders asset names the same way their normalized forms would be ordered.
+ */
+class AssetNameLess
+{
+public:
+    using is_transparent = void;
+
+    bool operator()(std::string_view lhs, std::string_view rhs) const noexcept;
+};
+
 class XAssetInfoGeneric
 {
 public:
@@ -63,6 +99,9 @@ public:
     std::vector<scr_string_t> m_used_script_strings;
     std::vector<IndirectAssetReference> m_indirect_asset_references;
     Zone* m_zone;
+
+    // The hash of the zone data the asset was loaded from or 0 if it was not hashed
+    uint64_t m_content_hash;
 };
 
 template<typename T> class XAssetInfo : public XAssetInfoGeneric
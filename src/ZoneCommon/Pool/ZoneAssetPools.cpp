@@ -1,7 +1,5 @@
 #include "ZoneAssetPools.h"
 
-#include <format>
-
 ZoneAssetPools::ZoneAssetPools(Zone* zone)
     : m_zone(zone)
 {
@@ -28,14 +26,36 @@ XAssetInfoGeneric* ZoneAssetPools::AddAsset(std::unique_ptr<XAssetInfoGeneric> x
 }
 
 XAssetInfoGeneric* ZoneAssetPools::GetAssetOrAssetReference(const asset_type_t type, const std::string& name) const
+{
+    std::string referenceNameBuffer;
+    return FindAssetOrAssetReference(type, name, referenceNameBuffer);
+}
+
+std::vector<XAssetInfoGeneric*> ZoneAssetPools::GetAssetsOrAssetReferences(const std::vector<std::pair<asset_type_t, std::string>>& assets) const
+{
+    std::vector<XAssetInfoGeneric*> result;
+    result.reserve(assets.size());
+
+    std::string referenceNameBuffer;
+    for (const auto& [assetType, assetName] : assets)
+        result.emplace_back(FindAssetOrAssetReference(assetType, assetName, referenceNameBuffer));
+
+    return result;
+}
+
+XAssetInfoGeneric* ZoneAssetPools::FindAssetOrAssetReference(const asset_type_t type, const std::string& name, std::string& referenceNameBuffer) const
 {
     auto* result = GetAsset(type, name);
 
     if (result != nullptr || (!name.empty() && name[0] == ','))
         return result;
 
-    result = GetAsset(type, std::format(",{}", name));
-    return result;
+    referenceNameBuffer.clear();
+    referenceNameBuffer.reserve(name.size() + 1u);
+    referenceNameBuffer.push_back(',');
+    referenceNameBuffer.append(name);
+
+    return GetAsset(type, referenceNameBuffer);
 }
 
 size_t ZoneAssetPools::GetTotalAssetCount() const
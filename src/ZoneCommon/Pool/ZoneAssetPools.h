@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 class Zone;
@@ -15,6 +16,8 @@ class XAssetInfoGeneric;
 
 class ZoneAssetPools
 {
+    _NODISCARD XAssetInfoGeneric* FindAssetOrAssetReference(asset_type_t type, const std::string& name, std::string& referenceNameBuffer) const;
+
 protected:
     Zone* m_zone;
     std::vector<XAssetInfoGeneric*> m_assets_in_order;
@@ -41,6 +44,13 @@ public:
     _NODISCARD virtual XAssetInfoGeneric* GetAsset(asset_type_t type, const std::string& name) const = 0;
     _NODISCARD virtual XAssetInfoGeneric* GetAssetOrAssetReference(asset_type_t type, const std::string& name) const;
 
+    /**
+     * \brief Looks up multiple assets or references to them at once, reusing the same buffer for the names of all references.
+     * \param assets The types and names of the assets to look up.
+     * \return The found asset or reference for each specified asset in the same order or \c nullptr if it is not part of the zone.
+     */
+    _NODISCARD std::vector<XAssetInfoGeneric*> GetAssetsOrAssetReferences(const std::vector<std::pair<asset_type_t, std::string>>& assets) const;
+
     _NODISCARD virtual asset_type_t GetAssetTypeCount() const = 0;
     _NODISCARD virtual const char* GetAssetTypeName(asset_type_t assetType) const = 0;
 
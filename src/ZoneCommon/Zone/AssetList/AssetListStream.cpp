@@ -1,5 +1,7 @@
 #include "AssetListStream.h"
 
+#include "Utils/MemoryManager.h"
+
 AssetListInputStream::AssetListInputStream(std::istream& stream)
     : m_stream(stream)
 {
@@ -33,6 +35,31 @@ bool AssetListInputStream::NextEntry(AssetListEntry& entry) const
     }
 }
 
+void AssetListInputStream::ReadAllEntries(AssetList& assetList) const
+{
+    // The cells only live until the entries were created from them
+    MemoryManager memory;
+    CsvCells cells;
+    m_stream.ReadAllRows(cells, memory);
+
+    if (cells.m_column_count == 0u)
+        return;
+
+    assetList.m_entries.reserve(assetList.m_entries.size() + cells.m_row_count);
+    for (auto row = 0u; row < cells.m_row_count; row++)
+    {
+        const auto* rowCells = &cells.m_cells[row * cells.m_column_count];
+        if (rowCells[0][0] == '\0')
+            continue;
+
+        // Rows are padded with empty cells so all columns up to the widest row can be accessed
+        if (cells.m_column_count >= 3u && rowCells[1][0] == '\0' && rowCells[2][0] != '\0')
+            assetList.m_entries.emplace_back(rowCells[0], rowCells[2], true);
+        else
+            assetList.m_entries.emplace_back(rowCells[0], cells.m_column_count >= 2u ? rowCells[1] : "", false);
+    }
+}
+
 AssetListOutputStream::AssetListOutputStream(std::ostream& stream)
     : m_stream(stream)
 {
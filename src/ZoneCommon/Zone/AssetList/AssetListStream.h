@@ -12,6 +12,13 @@ public:
     explicit AssetListInputStream(std::istream& stream);
 
     bool NextEntry(AssetListEntry& entry) const;
+
+    /**
+     * \brief Reads all remaining entries at once, which is a lot faster than reading them one after another for big asset lists.
+     * Rows without an asset type are skipped.
+     * \param assetList The asset list to append the entries to.
+     */
+    void ReadAllEntries(AssetList& assetList) const;
 };
 
 class AssetListOutputStream
@@ -1,6 +1,14 @@
 #include "XBlock.h"
 
+#include "XBlockAllocator.h"
+
 #include <cassert>
+#include <new>
+
+namespace
+{
+    HeapXBlockAllocator heapAllocator;
+} // namespace
 
 XBlock::XBlock(const std::string& name, const int index, const Type type)
 {
@@ -9,26 +17,41 @@ XBlock::XBlock(const std::string& name, const int index, const Type type)
     m_type = type;
     m_buffer = nullptr;
     m_buffer_size = 0;
+    m_buffer_zero_initialized = false;
+    m_used_size = 0;
+    m_allocator = nullptr;
 }
 
 XBlock::~XBlock()
 {
-    delete[] m_buffer;
+    Free();
+}
+
+void XBlock::Free()
+{
+    if (m_buffer)
+        m_allocator->Free(m_buffer);
+
     m_buffer = nullptr;
+    m_buffer_zero_initialized = false;
+    m_allocator = nullptr;
 }
 
-void XBlock::Alloc(const size_t blockSize)
+void XBlock::Alloc(const size_t blockSize, IXBlockAllocator* allocator)
 {
-    delete[] m_buffer;
+    Free();
 
     if (blockSize > 0)
     {
-        m_buffer = new uint8_t[blockSize];
+        m_allocator = allocator ? allocator : &heapAllocator;
+        m_buffer = m_allocator->Allocate(*this, blockSize, m_buffer_zero_initialized);
+        if (!m_buffer)
+            throw std::bad_alloc();
+
         m_buffer_size = blockSize;
     }
     else
     {
-        m_buffer = nullptr;
         m_buffer_size = 0;
     }
 }
@@ -2,6 +2,8 @@
 #include <cstdint>
 #include <string>
 
+class IXBlockAllocator;
+
 class XBlock
 {
 public:
@@ -20,8 +22,28 @@ public:
     uint8_t* m_buffer;
     size_t m_buffer_size;
 
+    // Whether the buffer is known to only contain zeros since it was allocated, so that it does not need to be cleared
+    bool m_buffer_zero_initialized;
+
+    // The amount of bytes of the buffer that were used when loading, which is the peak usage for temp blocks
+    size_t m_used_size;
+
     XBlock(const std::string& name, int index, Type type);
     ~XBlock();
+    XBlock(const XBlock& other) = delete;
+    XBlock(XBlock&& other) noexcept = delete;
+    XBlock& operator=(const XBlock& other) = delete;
+    XBlock& operator=(XBlock&& other) noexcept = delete;
+
+    /**
+     * \brief Allocates the buffer of the block and frees its previous buffer.
+     * \param blockSize The size of the buffer in bytes.
+     * \param allocator The allocator to allocate the buffer with. Must outlive the buffer. The buffer is allocated on the heap if \c nullptr.
+     */
+    void Alloc(size_t blockSize, IXBlockAllocator* allocator = nullptr);
+
+private:
+    void Free();
 
-    void Alloc(size_t blockSize);
+    IXBlockAllocator* m_allocator;
 };
@@ -0,0 +1,60 @@
+#include "XBlockAllocator.h"
+
+#include "XBlock.h"
+
+uint8_t* HeapXBlockAllocator::Allocate(const XBlock& block, const size_t size, bool& zeroInitialized)
+{
+    zeroInitialized = false;
+    return new uint8_t[size];
+}
+
+void HeapXBlockAllocator::Free(uint8_t* buffer)
+{
+    delete[] buffer;
+}
+
+VirtualXBlockAllocator::VirtualXBlockAllocator(const bool largePages)
+    : m_large_pages(largePages)
+{
+}
+
+VirtualXBlockAllocator::~VirtualXBlockAllocator()
+{
+    for (const auto& [buffer, reservation] : m_reservations)
+        virtual_memory::Release(reservation);
+}
+
+uint8_t* VirtualXBlockAllocator::Allocate(const XBlock& block, const size_t size, bool& zeroInitialized)
+{
+    // Runtime blocks are never loaded into, so large pages would only make them take physical memory
+    const auto reservation = virtual_memory::Reserve(size, m_large_pages && block.m_type != XBlock::Type::BLOCK_TYPE_RUNTIME);
+    if (!reservation.m_data)
+    {
+        zeroInitialized = false;
+        return nullptr;
+    }
+
+    auto* buffer = static_cast<uint8_t*>(reservation.m_data);
+    zeroInitialized = true;
+
+    std::lock_guard lock(m_mutex);
+    m_reservations.emplace(buffer, reservation);
+
+    return buffer;
+}
+
+void VirtualXBlockAllocator::Free(uint8_t* buffer)
+{
+    virtual_memory::Reservation reservation;
+    {
+        std::lock_guard lock(m_mutex);
+        const auto existingReservation = m_reservations.find(buffer);
+        if (existingReservation == m_reservations.end())
+            return;
+
+        reservation = existingReservation->second;
+        m_reservations.erase(existingReservation);
+    }
+
+    virtual_memory::Release(reservation);
+}
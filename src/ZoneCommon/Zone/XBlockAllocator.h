@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Utils/VirtualMemory.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+class XBlock;
+
+class IXBlockAllocator
+{
+public:
+    IXBlockAllocator() = default;
+    virtual ~IXBlockAllocator() = default;
+    IXBlockAllocator(const IXBlockAllocator& other) = default;
+    IXBlockAllocator(IXBlockAllocator&& other) noexcept = default;
+    IXBlockAllocator& operator=(const IXBlockAllocator& other) = default;
+    IXBlockAllocator& operator=(IXBlockAllocator&& other) noexcept = default;
+
+    /**
+     * \brief Allocates the buffer of a block. Can be called from multiple threads at once.
+     * \param block The block to allocate the buffer for.
+     * \param size The size of the buffer in bytes.
+     * \param zeroInitialized Is set to whether the buffer is known to only contain zeros.
+     * \return The allocated buffer or \c nullptr if it could not be allocated.
+     */
+    virtual uint8_t* Allocate(const XBlock& block, size_t size, bool& zeroInitialized) = 0;
+
+    /**
+     * \brief Frees a buffer that was allocated by this allocator. Can be called from multiple threads at once.
+     * \param buffer The buffer to free.
+     */
+    virtual void Free(uint8_t* buffer) = 0;
+};
+
+/**
+ * \brief Allocates the buffers of blocks on the heap.
+ */
+class HeapXBlockAllocator final : public IXBlockAllocator
+{
+public:
+    uint8_t* Allocate(const XBlock& block, size_t size, bool& zeroInitialized) override;
+    void Free(uint8_t* buffer) override;
+};
+
+/**
+ * \brief Reserves the buffers of blocks directly from the operating system.
+ * Pages are only backed by physical memory once they are touched, so runtime blocks that are only zeroed while loading take no physical memory.
+ */
+class VirtualXBlockAllocator final : public IXBlockAllocator
+{
+    bool m_large_pages;
+    std::unordered_map<uint8_t*, virtual_memory::Reservation> m_reservations;
+    std::mutex m_mutex;
+
+public:
+    /**
+     * \brief Creates a new allocator.
+     * \param largePages Whether to back blocks that are loaded from the zone with large pages if the system provides them.
+     */
+    explicit VirtualXBlockAllocator(bool largePages);
+    ~VirtualXBlockAllocator() override;
+    VirtualXBlockAllocator(const VirtualXBlockAllocator& other) = delete;
+    VirtualXBlockAllocator(VirtualXBlockAllocator&& other) noexcept = delete;
+    VirtualXBlockAllocator& operator=(const VirtualXBlockAllocator& other) = delete;
+    VirtualXBlockAllocator& operator=(VirtualXBlockAllocator&& other) noexcept = delete;
+
+    uint8_t* Allocate(const XBlock& block, size_t size, bool& zeroInitialized) override;
+    void Free(uint8_t* buffer) override;
+};
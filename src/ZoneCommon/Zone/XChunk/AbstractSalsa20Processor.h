@@ -14,6 +14,10 @@ protected:
     static constexpr int SHA1_HASH_SIZE = 20;
     static constexpr int SALSA20_IV_SIZE = 8;
 
+    // Chunks are encrypted and hashed in slices that stay in cache between both steps.
+    // Has to be a multiple of the Salsa20 block size for the key stream to continue across slices.
+    static constexpr size_t PROCESSING_SLICE_SIZE = 0x4000;
+
     class StreamContext
     {
     public:
@@ -41,5 +45,9 @@ public:
     AbstractSalsa20Processor& operator=(const AbstractSalsa20Processor& other) = delete;
     AbstractSalsa20Processor& operator=(AbstractSalsa20Processor&& other) noexcept = default;
 
+    /**
+     * \brief Provides the hash blocks of all streams. Every stream only ever updates its own part of each hash block, so streams can be processed in
+     * parallel. The data is only final once every chunk of every stream was processed.
+     */
     void GetCapturedData(const uint8_t** pCapturedData, size_t* pSize) override;
 };
@@ -6,6 +6,18 @@
 #include <zlib.h>
 #include <zutil.h>
 
+XChunkProcessorDeflate::XChunkProcessorDeflate()
+    : m_compression_level(Z_BEST_COMPRESSION),
+      m_compression_strategy(Z_DEFAULT_STRATEGY)
+{
+}
+
+XChunkProcessorDeflate::XChunkProcessorDeflate(const int compressionLevel, const int compressionStrategy)
+    : m_compression_level(compressionLevel < 0 ? Z_BEST_COMPRESSION : compressionLevel),
+      m_compression_strategy(compressionStrategy)
+{
+}
+
 size_t XChunkProcessorDeflate::Process(int streamNumber, const uint8_t* input, const size_t inputLength, uint8_t* output, const size_t outputBufferSize)
 {
     z_stream stream{};
@@ -13,7 +25,7 @@ size_t XChunkProcessorDeflate::Process(int streamNumber, const uint8_t* input, c
     stream.zfree = Z_NULL;
     stream.opaque = Z_NULL;
 
-    auto ret = deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, -DEF_WBITS, DEF_MEM_LEVEL, Z_DEFAULT_STRATEGY);
+    auto ret = deflateInit2(&stream, m_compression_level, Z_DEFLATED, -DEF_WBITS, DEF_MEM_LEVEL, m_compression_strategy);
     if (ret != Z_OK)
         throw XChunkException("Initializing deflate failed.");
 
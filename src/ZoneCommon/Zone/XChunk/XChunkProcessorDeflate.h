@@ -3,6 +3,18 @@
 
 class XChunkProcessorDeflate final : public IXChunkProcessor
 {
+    int m_compression_level;
+    int m_compression_strategy;
+
 public:
+    XChunkProcessorDeflate();
+
+    /**
+     * \brief Creates a processor that compresses chunks with the specified zlib compression level and strategy.
+     * \param compressionLevel The zlib compression level. A negative value uses the best compression.
+     * \param compressionStrategy The zlib compression strategy.
+     */
+    XChunkProcessorDeflate(int compressionLevel, int compressionStrategy);
+
     size_t Process(int streamNumber, const uint8_t* input, size_t inputLength, uint8_t* output, size_t outputBufferSize) override;
 };
@@ -2,32 +2,51 @@
 
 #include "XChunkException.h"
 
-#include <zlib.h>
+#include <cassert>
 #include <zutil.h>
 
-size_t XChunkProcessorInflate::Process(int streamNumber, const uint8_t* input, const size_t inputLength, uint8_t* output, const size_t outputBufferSize)
+XChunkProcessorInflate::StreamContext::~StreamContext()
 {
-    z_stream stream{};
-    stream.zalloc = Z_NULL;
-    stream.zfree = Z_NULL;
-    stream.opaque = Z_NULL;
+    if (m_initialized)
+        inflateEnd(&m_stream);
+}
+
+XChunkProcessorInflate::XChunkProcessorInflate(const int streamCount)
+    : m_stream_count(streamCount),
+      m_stream_contexts(std::make_unique<StreamContext[]>(streamCount))
+{
+}
+
+size_t XChunkProcessorInflate::Process(const int streamNumber, const uint8_t* input, const size_t inputLength, uint8_t* output, const size_t outputBufferSize)
+{
+    assert(streamNumber >= 0 && streamNumber < m_stream_count);
+    auto& context = m_stream_contexts[streamNumber];
+    auto& stream = context.m_stream;
+
+    // Allocating the inflate state and window once per stream instead of once per chunk
+    if (!context.m_initialized)
+    {
+        stream.zalloc = Z_NULL;
+        stream.zfree = Z_NULL;
+        stream.opaque = Z_NULL;
+
+        if (inflateInit2(&stream, -DEF_WBITS) != Z_OK)
+            throw XChunkException("Initializing inflate failed.");
 
-    auto ret = inflateInit2(&stream, -DEF_WBITS);
-    if (ret != Z_OK)
-        throw XChunkException("Initializing inflate failed.");
+        context.m_initialized = true;
+    }
+    else if (inflateReset(&stream) != Z_OK)
+        throw XChunkException("Resetting inflate failed.");
 
     stream.avail_in = inputLength;
     stream.next_in = input;
     stream.avail_out = outputBufferSize;
     stream.next_out = output;
 
-    ret = inflate(&stream, Z_FULL_FLUSH);
+    // The whole chunk is in memory so it is inflated in a single call which allows zlib to skip maintaining its window
+    const auto ret = inflate(&stream, Z_FINISH);
     if (ret != Z_STREAM_END)
         throw XChunkException("Zone has invalid or unsupported compression. Inflate failed");
 
-    const size_t outputSize = stream.total_out;
-
-    inflateEnd(&stream);
-
-    return outputSize;
+    return stream.total_out;
 }
@@ -1,8 +1,31 @@
 #pragma once
 #include "IXChunkProcessor.h"
 
+#include <memory>
+#include <zlib.h>
+
 class XChunkProcessorInflate final : public IXChunkProcessor
 {
+    // Chunks of one stream are processed one after another so each stream keeps its own inflate state that is reset for every chunk
+    class StreamContext
+    {
+    public:
+        z_stream m_stream{};
+        bool m_initialized = false;
+
+        StreamContext() = default;
+        ~StreamContext();
+        StreamContext(const StreamContext& other) = delete;
+        StreamContext(StreamContext&& other) noexcept = delete;
+        StreamContext& operator=(const StreamContext& other) = delete;
+        StreamContext& operator=(StreamContext&& other) noexcept = delete;
+    };
+
+    int m_stream_count;
+    std::unique_ptr<StreamContext[]> m_stream_contexts;
+
 public:
+    explicit XChunkProcessorInflate(int streamCount);
+
     size_t Process(int streamNumber, const uint8_t* input, size_t inputLength, uint8_t* output, size_t outputBufferSize) override;
 };
@@ -3,6 +3,7 @@
 #include "AbstractSalsa20Processor.h"
 #include "Crypto.h"
 
+#include <algorithm>
 #include <cassert>
 
 XChunkProcessorSalsa20Decryption::XChunkProcessorSalsa20Decryption(const int streamCount,
@@ -25,12 +26,16 @@ size_t XChunkProcessorSalsa20Decryption::Process(
 
     // Initialize Salsa20 with an IV of the first 8 bytes of the current hash block
     streamContext.m_salsa20->SetIV(GetHashBlock(streamNumber), SALSA20_IV_SIZE);
-    streamContext.m_salsa20->Process(input, output, inputLength);
 
-    // Hash decrypted XChunk
+    // Decrypt and hash XChunk slice by slice to hash the decrypted data while it is still cached
     uint8_t blockSha1Hash[SHA1_HASH_SIZE];
     streamContext.m_sha1->Init();
-    streamContext.m_sha1->Process(output, inputLength);
+    for (size_t offset = 0; offset < inputLength; offset += PROCESSING_SLICE_SIZE)
+    {
+        const auto sliceSize = std::min(inputLength - offset, PROCESSING_SLICE_SIZE);
+        streamContext.m_salsa20->Process(&input[offset], &output[offset], sliceSize);
+        streamContext.m_sha1->Process(&output[offset], sliceSize);
+    }
     streamContext.m_sha1->Finish(&blockSha1Hash);
 
     // Advance index to next hash block
@@ -1,5 +1,6 @@
 #include "XChunkProcessorSalsa20Encryption.h"
 
+#include <algorithm>
 #include <cassert>
 
 XChunkProcessorSalsa20Encryption::XChunkProcessorSalsa20Encryption(const int streamCount,
@@ -20,16 +21,20 @@ size_t XChunkProcessorSalsa20Encryption::Process(
 
     auto& streamContext = m_stream_contexts[streamNumber];
 
-    // Hash not yet encrypted XChunk
+    // Initialize Salsa20 with an IV of the first 8 bytes of the current hash block
+    streamContext.m_salsa20->SetIV(GetHashBlock(streamNumber), SALSA20_IV_SIZE);
+
+    // Hash not yet encrypted XChunk and encrypt it slice by slice to only load the data into cache once
     uint8_t blockSha1Hash[SHA1_HASH_SIZE];
     streamContext.m_sha1->Init();
-    streamContext.m_sha1->Process(input, inputLength);
+    for (size_t offset = 0; offset < inputLength; offset += PROCESSING_SLICE_SIZE)
+    {
+        const auto sliceSize = std::min(inputLength - offset, PROCESSING_SLICE_SIZE);
+        streamContext.m_sha1->Process(&input[offset], sliceSize);
+        streamContext.m_salsa20->Process(&input[offset], &output[offset], sliceSize);
+    }
     streamContext.m_sha1->Finish(&blockSha1Hash);
 
-    // Initialize Salsa20 with an IV of the first 8 bytes of the current hash block
-    streamContext.m_salsa20->SetIV(GetHashBlock(streamNumber), SALSA20_IV_SIZE);
-    streamContext.m_salsa20->Process(input, output, inputLength);
-
     // Advance index to next hash block
     m_stream_block_indices[streamNumber] = (m_stream_block_indices[streamNumber] + 1) % BLOCK_HASHES_COUNT;
 
@@ -4,6 +4,7 @@
 #include "Game/IGame.h"
 #include "Pool/ZoneAssetPools.h"
 #include "Utils/ClassUtils.h"
+#include "Zone/ZoneAssetOffsetIndex.h"
 #include "Zone/ZoneTypes.h"
 #include "ZoneMemory.h"
 #include "ZoneScriptStrings.h"
@@ -28,6 +29,9 @@ public:
     ZoneScriptStrings m_script_strings;
     std::unique_ptr<ZoneAssetPools> m_pools;
 
+    // Only set when the zone was loaded with recording asset offsets
+    std::unique_ptr<ZoneAssetOffsetIndex> m_asset_offset_index;
+
     Zone(std::string name, zone_priority_t priority, IGame* game);
     ~Zone();
     Zone(const Zone& other) = delete;
@@ -0,0 +1,73 @@
+#include "ZoneAssetOffsetIndex.h"
+
+#include <format>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    constexpr auto INDEX_FILE_HEADER = "OAT_ASSET_OFFSET_INDEX 1";
+    constexpr auto INDEX_KEY_ASSET = "asset";
+} // namespace
+
+bool ZoneAssetOffsetIndex::Load(const fs::path& indexFilePath)
+{
+    std::ifstream stream(indexFilePath);
+    if (!stream.is_open())
+        return false;
+
+    std::string line;
+    if (!std::getline(stream, line) || line != INDEX_FILE_HEADER)
+        return false;
+
+    std::vector<Entry> entries;
+    while (std::getline(stream, line))
+    {
+        std::istringstream lineStream(line);
+        std::string key;
+        lineStream >> key;
+
+        if (key != INDEX_KEY_ASSET)
+            return false;
+
+        Entry entry;
+        size_t blockCount;
+        lineStream >> entry.m_type >> entry.m_offset >> entry.m_size >> blockCount;
+
+        entry.m_block_offsets.resize(blockCount);
+        for (auto& blockOffset : entry.m_block_offsets)
+            lineStream >> blockOffset;
+
+        lineStream.get();
+        std::getline(lineStream, entry.m_name);
+
+        if (lineStream.fail())
+            return false;
+
+        entries.emplace_back(std::move(entry));
+    }
+
+    m_entries = std::move(entries);
+    return true;
+}
+
+bool ZoneAssetOffsetIndex::Save(const fs::path& indexFilePath) const
+{
+    std::ofstream stream(indexFilePath);
+    if (!stream.is_open())
+        return false;
+
+    stream << INDEX_FILE_HEADER << '\n';
+    for (const auto& entry : m_entries)
+    {
+        stream << std::format("{} {} {} {} {}", INDEX_KEY_ASSET, entry.m_type, entry.m_offset, entry.m_size, entry.m_block_offsets.size());
+        for (const auto blockOffset : entry.m_block_offsets)
+            stream << ' ' << blockOffset;
+
+        stream << ' ' << entry.m_name << '\n';
+    }
+
+    return stream.good();
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Utils/ClassUtils.h"
+#include "Zone/ZoneTypes.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Records where the data of every asset of a loaded zone is located in its inflated content.
+ * Together with the inflated content this allows later passes to load assets independently of each other, for example in parallel,
+ * by starting a stream at the offset of an asset with the blocks at the recorded offsets.
+ */
+class ZoneAssetOffsetIndex
+{
+public:
+    class Entry
+    {
+    public:
+        asset_type_t m_type;
+        std::string m_name;
+
+        // The offset and size of the data of the asset in the inflated zone content, starting at the asset list
+        size_t m_offset;
+        size_t m_size;
+
+        // The offset of every block when the asset started loading
+        std::vector<size_t> m_block_offsets;
+    };
+
+    std::vector<Entry> m_entries;
+
+    /**
+     * \brief Loads an index that was saved beside a zone.
+     * \param indexFilePath The path to the index file.
+     * \return \c true if the index could be loaded, otherwise \c false.
+     */
+    bool Load(const std::filesystem::path& indexFilePath);
+
+    /**
+     * \brief Saves the index to be able to use it without loading the zone again.
+     * \param indexFilePath The path to the index file.
+     * \return \c true if the index could be written, otherwise \c false.
+     */
+    _NODISCARD bool Save(const std::filesystem::path& indexFilePath) const;
+};
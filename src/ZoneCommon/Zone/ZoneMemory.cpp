@@ -1,8 +1,29 @@
 #include "ZoneMemory.h"
 
-ZoneMemory::ZoneMemory() = default;
+ZoneMemory::ZoneMemory()
+    : MemoryManager(ARENA_BLOCK_SIZE)
+{
+}
 
 void ZoneMemory::AddBlock(std::unique_ptr<XBlock> block)
 {
     m_blocks.emplace_back(std::move(block));
 }
+
+const std::vector<std::unique_ptr<XBlock>>& ZoneMemory::GetBlocks() const
+{
+    return m_blocks;
+}
+
+void ZoneMemory::AddAssetMemoryUsage(const asset_type_t assetType, const size_t blockSize, const size_t heapSize)
+{
+    auto& usage = m_asset_memory_usage[assetType];
+    usage.m_asset_count++;
+    usage.m_block_size += blockSize;
+    usage.m_heap_size += heapSize;
+}
+
+const std::map<asset_type_t, ZoneMemory::AssetTypeMemoryUsage>& ZoneMemory::GetAssetMemoryUsage() const
+{
+    return m_asset_memory_usage;
+}
@@ -2,16 +2,41 @@
 
 #include "Utils/MemoryManager.h"
 #include "Zone/XBlock.h"
+#include "Zone/ZoneTypes.h"
 
+#include <cstddef>
+#include <map>
 #include <memory>
 #include <vector>
 
 class ZoneMemory : public MemoryManager
 {
-    std::vector<std::unique_ptr<XBlock>> m_blocks;
+    static constexpr size_t ARENA_BLOCK_SIZE = 0x100000;
 
 public:
+    class AssetTypeMemoryUsage
+    {
+    public:
+        size_t m_asset_count = 0u;
+        size_t m_block_size = 0u;
+        size_t m_heap_size = 0u;
+    };
+
     ZoneMemory();
 
     void AddBlock(std::unique_ptr<XBlock> block);
+    _NODISCARD const std::vector<std::unique_ptr<XBlock>>& GetBlocks() const;
+
+    /**
+     * \brief Attributes memory to an asset of the specified type.
+     * \param assetType The type of the asset.
+     * \param blockSize The amount of bytes the asset uses in the non temporary blocks of the zone.
+     * \param heapSize The amount of bytes that were allocated from this memory for the asset, not including memory of its dependencies.
+     */
+    void AddAssetMemoryUsage(asset_type_t assetType, size_t blockSize, size_t heapSize);
+    _NODISCARD const std::map<asset_type_t, AssetTypeMemoryUsage>& GetAssetMemoryUsage() const;
+
+private:
+    std::vector<std::unique_ptr<XBlock>> m_blocks;
+    std::map<asset_type_t, AssetTypeMemoryUsage> m_asset_memory_usage;
 };
@@ -15,6 +15,7 @@ void ZoneScriptStrings::InitializeForExistingZone()
 {
     m_null_entry_pos = -1;
     m_scr_strings.clear();
+    m_scr_string_lookup.clear();
 }
 
 void ZoneScriptStrings::InitializeForExistingZone(const char** scrStrList, const size_t scrStrCount)
@@ -28,29 +29,34 @@ void ZoneScriptStrings::InitializeForExistingZone(const char** scrStrList, const
         AddScriptString(scrStrList[i]);
 }
 
-void ZoneScriptStrings::AddScriptString(const char* value)
+scr_string_t ZoneScriptStrings::AddNewScriptString(const std::string_view value)
 {
-    const auto newStringIndex = m_scr_strings.size();
-    const auto newScrStringIndex = static_cast<scr_string_t>(newStringIndex);
+    const auto newScrStringIndex = static_cast<scr_string_t>(m_scr_strings.size());
+    const auto& newString = m_scr_strings.emplace_back(value);
 
+    // Later strings with the same value take precedence like when adding them to an existing zone
+    m_scr_string_lookup.insert_or_assign(std::string_view(newString), newScrStringIndex);
+
+    return newScrStringIndex;
+}
+
+void ZoneScriptStrings::AddScriptString(const char* value)
+{
     if (value != nullptr)
     {
-        m_scr_strings.emplace_back(value);
-        m_scr_string_lookup[value] = newScrStringIndex;
+        AddNewScriptString(value);
     }
     else
     {
         assert(m_null_entry_pos < 0); // If null index is already set, the previous cost will not be considered null string anymore.
+        m_null_entry_pos = static_cast<int>(m_scr_strings.size());
         m_scr_strings.emplace_back();
-        m_null_entry_pos = static_cast<int>(newStringIndex);
     }
 }
 
 void ZoneScriptStrings::AddScriptString(const std::string& value)
 {
-    const auto newScrStringIndex = static_cast<scr_string_t>(m_scr_strings.size());
-    m_scr_strings.emplace_back(value);
-    m_scr_string_lookup[value] = newScrStringIndex;
+    AddNewScriptString(value);
 }
 
 scr_string_t ZoneScriptStrings::AddOrGetScriptString(const char* value)
@@ -61,10 +67,7 @@ scr_string_t ZoneScriptStrings::AddOrGetScriptString(const char* value)
         if (existingScriptString != m_scr_string_lookup.end())
             return existingScriptString->second;
 
-        const auto newScrStringIndex = static_cast<scr_string_t>(m_scr_strings.size());
-        m_scr_strings.emplace_back(value);
-        m_scr_string_lookup[value] = newScrStringIndex;
-        return newScrStringIndex;
+        return AddNewScriptString(value);
     }
 
     if (m_null_entry_pos < 0)
@@ -83,11 +86,7 @@ scr_string_t ZoneScriptStrings::AddOrGetScriptString(const std::string& value)
     if (existingScriptString != m_scr_string_lookup.end())
         return existingScriptString->second;
 
-    const auto newScrStringIndex = static_cast<scr_string_t>(m_scr_strings.size());
-    m_scr_strings.emplace_back(value);
-    m_scr_string_lookup[value] = newScrStringIndex;
-
-    return newScrStringIndex;
+    return AddNewScriptString(value);
 }
 
 scr_string_t ZoneScriptStrings::GetScriptString(const char* value) const
@@ -177,12 +176,12 @@ const std::string& ZoneScriptStrings::operator[](const size_t index) const
     return m_scr_strings[index];
 }
 
-std::vector<std::string>::const_iterator ZoneScriptStrings::begin() const
+std::deque<std::string>::const_iterator ZoneScriptStrings::begin() const
 {
     return m_scr_strings.cbegin();
 }
 
-std::vector<std::string>::const_iterator ZoneScriptStrings::end() const
+std::deque<std::string>::const_iterator ZoneScriptStrings::end() const
 {
     return m_scr_strings.end();
 }
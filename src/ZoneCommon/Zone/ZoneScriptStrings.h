@@ -4,18 +4,28 @@
 #include "Zone/ZoneTypes.h"
 
 #include <cstddef>
+#include <deque>
 #include <string>
+#include <string_view>
 #include <unordered_map>
-#include <vector>
 
 class ZoneScriptStrings
 {
     int m_null_entry_pos;
-    std::vector<std::string> m_scr_strings;
-    std::unordered_map<std::string, scr_string_t> m_scr_string_lookup;
+
+    // Strings in a deque never move when adding more so the lookup can refer to them instead of holding a copy of each string
+    std::deque<std::string> m_scr_strings;
+    std::unordered_map<std::string_view, scr_string_t> m_scr_string_lookup;
+
+    scr_string_t AddNewScriptString(std::string_view value);
 
 public:
     ZoneScriptStrings();
+    ~ZoneScriptStrings() = default;
+    ZoneScriptStrings(const ZoneScriptStrings& other) = delete;
+    ZoneScriptStrings(ZoneScriptStrings&& other) noexcept = default;
+    ZoneScriptStrings& operator=(const ZoneScriptStrings& other) = delete;
+    ZoneScriptStrings& operator=(ZoneScriptStrings&& other) noexcept = default;
 
     void InitializeForExistingZone();
     void InitializeForExistingZone(const char** scrStrList, size_t scrStrCount);
@@ -34,6 +44,6 @@ public:
     _NODISCARD const std::string& Value(size_t index) const;
     _NODISCARD const std::string& Value(size_t index, bool& isNull) const;
     _NODISCARD const std::string& operator[](size_t index) const;
-    _NODISCARD std::vector<std::string>::const_iterator begin() const;
-    _NODISCARD std::vector<std::string>::const_iterator end() const;
+    _NODISCARD std::deque<std::string>::const_iterator begin() const;
+    _NODISCARD std::deque<std::string>::const_iterator end() const;
 };
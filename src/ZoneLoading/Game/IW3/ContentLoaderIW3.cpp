@@ -2,39 +2,119 @@
 
 #include "Game/IW3/IW3.h"
 #include "Game/IW3/XAssets/clipmap_t/clipmap_t_load_db.h"
+#include "Game/IW3/XAssets/clipmap_t/clipmap_t_mark_db.h"
 #include "Game/IW3/XAssets/comworld/comworld_load_db.h"
+#include "Game/IW3/XAssets/comworld/comworld_mark_db.h"
 #include "Game/IW3/XAssets/font_s/font_s_load_db.h"
+#include "Game/IW3/XAssets/font_s/font_s_mark_db.h"
 #include "Game/IW3/XAssets/fxeffectdef/fxeffectdef_load_db.h"
+#include "Game/IW3/XAssets/fxeffectdef/fxeffectdef_mark_db.h"
 #include "Game/IW3/XAssets/fximpacttable/fximpacttable_load_db.h"
+#include "Game/IW3/XAssets/fximpacttable/fximpacttable_mark_db.h"
 #include "Game/IW3/XAssets/gameworldmp/gameworldmp_load_db.h"
+#include "Game/IW3/XAssets/gameworldmp/gameworldmp_mark_db.h"
 #include "Game/IW3/XAssets/gameworldsp/gameworldsp_load_db.h"
+#include "Game/IW3/XAssets/gameworldsp/gameworldsp_mark_db.h"
 #include "Game/IW3/XAssets/gfximage/gfximage_load_db.h"
+#include "Game/IW3/XAssets/gfximage/gfximage_mark_db.h"
 #include "Game/IW3/XAssets/gfxlightdef/gfxlightdef_load_db.h"
+#include "Game/IW3/XAssets/gfxlightdef/gfxlightdef_mark_db.h"
 #include "Game/IW3/XAssets/gfxworld/gfxworld_load_db.h"
+#include "Game/IW3/XAssets/gfxworld/gfxworld_mark_db.h"
 #include "Game/IW3/XAssets/loadedsound/loadedsound_load_db.h"
+#include "Game/IW3/XAssets/loadedsound/loadedsound_mark_db.h"
 #include "Game/IW3/XAssets/localizeentry/localizeentry_load_db.h"
+#include "Game/IW3/XAssets/localizeentry/localizeentry_mark_db.h"
 #include "Game/IW3/XAssets/mapents/mapents_load_db.h"
+#include "Game/IW3/XAssets/mapents/mapents_mark_db.h"
 #include "Game/IW3/XAssets/material/material_load_db.h"
+#include "Game/IW3/XAssets/material/material_mark_db.h"
 #include "Game/IW3/XAssets/materialtechniqueset/materialtechniqueset_load_db.h"
+#include "Game/IW3/XAssets/materialtechniqueset/materialtechniqueset_mark_db.h"
 #include "Game/IW3/XAssets/menudef_t/menudef_t_load_db.h"
+#include "Game/IW3/XAssets/menudef_t/menudef_t_mark_db.h"
 #include "Game/IW3/XAssets/menulist/menulist_load_db.h"
+#include "Game/IW3/XAssets/menulist/menulist_mark_db.h"
 #include "Game/IW3/XAssets/physpreset/physpreset_load_db.h"
+#include "Game/IW3/XAssets/physpreset/physpreset_mark_db.h"
 #include "Game/IW3/XAssets/rawfile/rawfile_load_db.h"
+#include "Game/IW3/XAssets/rawfile/rawfile_mark_db.h"
 #include "Game/IW3/XAssets/snd_alias_list_t/snd_alias_list_t_load_db.h"
+#include "Game/IW3/XAssets/snd_alias_list_t/snd_alias_list_t_mark_db.h"
 #include "Game/IW3/XAssets/sndcurve/sndcurve_load_db.h"
+#include "Game/IW3/XAssets/sndcurve/sndcurve_mark_db.h"
 #include "Game/IW3/XAssets/stringtable/stringtable_load_db.h"
+#include "Game/IW3/XAssets/stringtable/stringtable_mark_db.h"
 #include "Game/IW3/XAssets/weapondef/weapondef_load_db.h"
+#include "Game/IW3/XAssets/weapondef/weapondef_mark_db.h"
 #include "Game/IW3/XAssets/xanimparts/xanimparts_load_db.h"
+#include "Game/IW3/XAssets/xanimparts/xanimparts_mark_db.h"
 #include "Game/IW3/XAssets/xmodel/xmodel_load_db.h"
+#include "Game/IW3/XAssets/xmodel/xmodel_mark_db.h"
+#include "Loading/Exception/UnexpectedEndOfFileException.h"
 #include "Loading/Exception/UnsupportedAssetTypeException.h"
 
 #include <cassert>
 
 using namespace IW3;
 
-ContentLoader::ContentLoader()
+namespace
+{
+    void MarkXAsset(Zone* zone, XAssetInfoGeneric& assetInfo)
+    {
+#define MARK_ASSET(type_index, typeName)                                                                                                                       \
+    case type_index:                                                                                                                                           \
+    {                                                                                                                                                          \
+        Marker_##typeName marker(zone);                                                                                                                        \
+        marker.Mark(static_cast<typeName*>(assetInfo.m_ptr));                                                                                                  \
+        assetInfo.m_dependencies = marker.GetDependencies();                                                                                                   \
+        assetInfo.m_used_script_strings = marker.GetUsedScriptStrings();                                                                                       \
+        assetInfo.m_indirect_asset_references = marker.GetIndirectAssetReferences();                                                                           \
+        break;                                                                                                                                                 \
+    }
+
+        switch (assetInfo.m_type)
+        {
+            MARK_ASSET(ASSET_TYPE_PHYSPRESET, PhysPreset)
+            MARK_ASSET(ASSET_TYPE_XANIMPARTS, XAnimParts)
+            MARK_ASSET(ASSET_TYPE_XMODEL, XModel)
+            MARK_ASSET(ASSET_TYPE_MATERIAL, Material)
+            MARK_ASSET(ASSET_TYPE_TECHNIQUE_SET, MaterialTechniqueSet)
+            MARK_ASSET(ASSET_TYPE_IMAGE, GfxImage)
+            MARK_ASSET(ASSET_TYPE_SOUND, snd_alias_list_t)
+            MARK_ASSET(ASSET_TYPE_SOUND_CURVE, SndCurve)
+            MARK_ASSET(ASSET_TYPE_LOADED_SOUND, LoadedSound)
+            MARK_ASSET(ASSET_TYPE_CLIPMAP, clipMap_t)
+            MARK_ASSET(ASSET_TYPE_CLIPMAP_PVS, clipMap_t)
+            MARK_ASSET(ASSET_TYPE_COMWORLD, ComWorld)
+            MARK_ASSET(ASSET_TYPE_GAMEWORLD_SP, GameWorldSp)
+            MARK_ASSET(ASSET_TYPE_GAMEWORLD_MP, GameWorldMp)
+            MARK_ASSET(ASSET_TYPE_MAP_ENTS, MapEnts)
+            MARK_ASSET(ASSET_TYPE_GFXWORLD, GfxWorld)
+            MARK_ASSET(ASSET_TYPE_LIGHT_DEF, GfxLightDef)
+            MARK_ASSET(ASSET_TYPE_FONT, Font_s)
+            MARK_ASSET(ASSET_TYPE_MENULIST, MenuList)
+            MARK_ASSET(ASSET_TYPE_MENU, menuDef_t)
+            MARK_ASSET(ASSET_TYPE_LOCALIZE_ENTRY, LocalizeEntry)
+            MARK_ASSET(ASSET_TYPE_WEAPON, WeaponDef)
+            MARK_ASSET(ASSET_TYPE_FX, FxEffectDef)
+            MARK_ASSET(ASSET_TYPE_IMPACT_FX, FxImpactTable)
+            MARK_ASSET(ASSET_TYPE_RAWFILE, RawFile)
+            MARK_ASSET(ASSET_TYPE_STRINGTABLE, StringTable)
+
+        default:
+            assert(false);
+            break;
+        }
+
+#undef MARK_ASSET
+    }
+} // namespace
+
+ContentLoader::ContentLoader(const bool markAssetReferences)
     : varXAsset(nullptr),
-      varScriptStringList(nullptr)
+      varScriptStringList(nullptr),
+      m_mark_asset_references(markAssetReferences)
 {
 }
 
@@ -131,9 +211,16 @@ void ContentLoader::LoadXAssetArray(const bool atStreamStart, const size_t count
         m_zone->m_pools->InitPoolDynamic(assetType);
     }
 
+    auto* memory = m_zone->GetMemory();
     for (size_t index = 0; index < count; index++)
     {
+        const auto loadedSizeBefore = m_stream->GetLoadedSize();
+        m_stream->BeginAsset();
+        const auto allocatedSizeBefore = memory->GetAllocatedSize();
+
         LoadXAsset(false);
+
+        memory->AddAssetMemoryUsage(varXAsset->type, m_stream->GetLoadedSize() - loadedSizeBefore, memory->GetAllocatedSize() - allocatedSizeBefore);
         varXAsset++;
     }
 }
@@ -161,4 +248,23 @@ void ContentLoader::Load(Zone* zone, IZoneInputStream* stream)
     }
 
     m_stream->PopBlock();
+
+    if (m_mark_asset_references)
+    {
+        MarkAssets(
+            [this](XAssetInfoGeneric& assetInfo)
+            {
+                MarkXAsset(m_zone, assetInfo);
+            });
+    }
+}
+
+void ContentLoader::Probe(ILoadingStream* stream, ZoneProbe& probe)
+{
+    XAssetList assetList{};
+    if (stream->Load(&assetList, sizeof(assetList)) != sizeof(assetList))
+        throw UnexpectedEndOfFileException();
+
+    probe.m_script_string_count = static_cast<unsigned>(assetList.stringList.count);
+    probe.m_asset_count = static_cast<unsigned>(assetList.assetCount);
 }
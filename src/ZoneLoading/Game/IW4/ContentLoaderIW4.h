@@ -10,14 +10,17 @@ namespace IW4
         XAsset* varXAsset;
         ScriptStringList* varScriptStringList;
 
+        bool m_mark_asset_references;
+
         void LoadScriptStringList(bool atStreamStart);
 
         void LoadXAsset(bool atStreamStart) const;
         void LoadXAssetArray(bool atStreamStart, size_t count);
 
     public:
-        ContentLoader();
+        explicit ContentLoader(bool markAssetReferences);
 
         void Load(Zone* zone, IZoneInputStream* stream) override;
+        void Probe(ILoadingStream* stream, ZoneProbe& probe) override;
     };
 } // namespace IW4
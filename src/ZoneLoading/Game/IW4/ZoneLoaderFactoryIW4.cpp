@@ -10,6 +10,7 @@
 #include "Loading/Processor/ProcessorCaptureData.h"
 #include "Loading/Processor/ProcessorIW4xDecryption.h"
 #include "Loading/Processor/ProcessorInflate.h"
+#include "Loading/Processor/ProcessorReadAhead.h"
 #include "Loading/Steps/StepAddProcessor.h"
 #include "Loading/Steps/StepAllocXBlocks.h"
 #include "Loading/Steps/StepLoadHash.h"
@@ -22,6 +23,7 @@
 #include "Loading/Steps/StepVerifyMagic.h"
 #include "Loading/Steps/StepVerifySignature.h"
 #include "Utils/ClassUtils.h"
+#include "ZoneLoading.h"
 
 #include <cassert>
 #include <cstring>
@@ -138,7 +140,9 @@ class ZoneLoaderFactory::Impl
         auto* subHeaderHashSignaturePtr = subHeaderHashSignature.get();
         zoneLoader->AddLoadingStep(std::move(subHeaderHashSignature));
 
-        zoneLoader->AddLoadingStep(std::make_unique<StepVerifySignature>(std::move(rsa), subHeaderHashSignaturePtr, subHeaderHashPtr));
+        // The signature only covers the hash of the sub header, so it is verified while the rest of the zone is loading
+        if (ZoneLoading::Configuration.VerifySignatures)
+            zoneLoader->AddLoadingStep(std::make_unique<StepVerifySignature>(std::move(rsa), subHeaderHashSignaturePtr, subHeaderHashPtr, true));
 
         auto subHeaderCapture = std::make_unique<ProcessorCaptureData>(sizeof(DB_AuthSubHeader));
         auto* subHeaderCapturePtr = subHeaderCapture.get();
@@ -162,8 +166,13 @@ class ZoneLoaderFactory::Impl
             std::make_unique<StepAddProcessor>(std::make_unique<ProcessorAuthedBlocks>(ZoneConstants::AUTHED_CHUNK_COUNT_PER_GROUP,
                                                                                        ZoneConstants::AUTHED_CHUNK_SIZE,
                                                                                        std::extent_v<decltype(DB_AuthSubHeader::masterBlockHashes)>,
-                                                                                       std::unique_ptr<IHashFunction>(Crypto::CreateSHA256()),
-                                                                                       masterBlockHashesPtr)));
+                                                                                       []
+                                                                                       {
+                                                                                           return std::unique_ptr<IHashFunction>(Crypto::CreateSHA256());
+                                                                                       },
+                                                                                       masterBlockHashesPtr,
+                                                                                       ZoneLoading::Configuration.AuthedBlockWorkerCount,
+                                                                                       ZoneLoading::Configuration.VerifyAuthedBlocks)));
     }
 
 public:
@@ -185,6 +194,8 @@ public:
 
         // File is supported. Now setup all required steps for loading this file.
         auto* zoneLoader = new ZoneLoader(std::move(zone));
+        zoneLoader->m_is_signed = isSecure;
+        zoneLoader->m_is_encrypted = isIw4x;
 
         SetupBlock(zoneLoader);
 
@@ -199,20 +210,33 @@ public:
 
         zoneLoader->AddLoadingStep(std::make_unique<StepAddProcessor>(std::make_unique<ProcessorInflate>(ZoneConstants::AUTHED_CHUNK_SIZE)));
 
-        if (isIw4x) // IW4x has one extra byte of padding here for protection purposes
+        // All processors are added before loading through them, no processors are added or removed once reading ahead started
+        if (isIw4x)
         {
+            // Decrypting on its own thread pipelines it with inflating instead of running both one after another
+            if (ZoneLoading::Configuration.DecompressAhead)
+                zoneLoader->AddLoadingStep(std::make_unique<StepAddProcessor>(std::make_unique<ProcessorReadAhead>()));
+
             zoneLoader->AddLoadingStep(std::make_unique<StepAddProcessor>(std::make_unique<ProcessorIW4xDecryption>()));
-            zoneLoader->AddLoadingStep(std::make_unique<StepSkipBytes>(1));
         }
 
+        if (ZoneLoading::Configuration.DecompressAhead)
+            zoneLoader->AddLoadingStep(std::make_unique<StepAddProcessor>(std::make_unique<ProcessorReadAhead>()));
+
+        // IW4x has one extra byte of padding here for protection purposes
+        if (isIw4x)
+            zoneLoader->AddLoadingStep(std::make_unique<StepSkipBytes>(1));
+
         // Start of the XFile struct
         zoneLoader->AddLoadingStep(std::make_unique<StepSkipBytes>(8));
         // Skip size and externalSize fields since they are not interesting for us
         zoneLoader->AddLoadingStep(std::make_unique<StepAllocXBlocks>());
 
         // Start of the zone content
-        zoneLoader->AddLoadingStep(std::make_unique<StepLoadZoneContent>(
-            std::make_unique<ContentLoader>(), zonePtr, ZoneConstants::OFFSET_BLOCK_BIT_COUNT, ZoneConstants::INSERT_BLOCK));
+        zoneLoader->AddLoadingStep(std::make_unique<StepLoadZoneContent>(std::make_unique<ContentLoader>(ZoneLoading::Configuration.MarkAssetReferences),
+                                                                         zonePtr,
+                                                                         ZoneConstants::OFFSET_BLOCK_BIT_COUNT,
+                                                                         ZoneConstants::INSERT_BLOCK));
 
         // Return the fully setup zoneloader
         return zoneLoader;
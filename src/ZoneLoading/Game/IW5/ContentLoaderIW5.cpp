@@ -2,54 +2,163 @@
 
 #include "Game/IW5/IW5.h"
 #include "Game/IW5/XAssets/addonmapents/addonmapents_load_db.h"
+#include "Game/IW5/XAssets/addonmapents/addonmapents_mark_db.h"
 #include "Game/IW5/XAssets/clipmap_t/clipmap_t_load_db.h"
+#include "Game/IW5/XAssets/clipmap_t/clipmap_t_mark_db.h"
 #include "Game/IW5/XAssets/comworld/comworld_load_db.h"
+#include "Game/IW5/XAssets/comworld/comworld_mark_db.h"
 #include "Game/IW5/XAssets/font_s/font_s_load_db.h"
+#include "Game/IW5/XAssets/font_s/font_s_mark_db.h"
 #include "Game/IW5/XAssets/fxeffectdef/fxeffectdef_load_db.h"
+#include "Game/IW5/XAssets/fxeffectdef/fxeffectdef_mark_db.h"
 #include "Game/IW5/XAssets/fximpacttable/fximpacttable_load_db.h"
+#include "Game/IW5/XAssets/fximpacttable/fximpacttable_mark_db.h"
 #include "Game/IW5/XAssets/fxworld/fxworld_load_db.h"
+#include "Game/IW5/XAssets/fxworld/fxworld_mark_db.h"
 #include "Game/IW5/XAssets/gfximage/gfximage_load_db.h"
+#include "Game/IW5/XAssets/gfximage/gfximage_mark_db.h"
 #include "Game/IW5/XAssets/gfxlightdef/gfxlightdef_load_db.h"
+#include "Game/IW5/XAssets/gfxlightdef/gfxlightdef_mark_db.h"
 #include "Game/IW5/XAssets/gfxworld/gfxworld_load_db.h"
+#include "Game/IW5/XAssets/gfxworld/gfxworld_mark_db.h"
 #include "Game/IW5/XAssets/glassworld/glassworld_load_db.h"
+#include "Game/IW5/XAssets/glassworld/glassworld_mark_db.h"
 #include "Game/IW5/XAssets/leaderboarddef/leaderboarddef_load_db.h"
+#include "Game/IW5/XAssets/leaderboarddef/leaderboarddef_mark_db.h"
 #include "Game/IW5/XAssets/loadedsound/loadedsound_load_db.h"
+#include "Game/IW5/XAssets/loadedsound/loadedsound_mark_db.h"
 #include "Game/IW5/XAssets/localizeentry/localizeentry_load_db.h"
+#include "Game/IW5/XAssets/localizeentry/localizeentry_mark_db.h"
 #include "Game/IW5/XAssets/mapents/mapents_load_db.h"
+#include "Game/IW5/XAssets/mapents/mapents_mark_db.h"
 #include "Game/IW5/XAssets/material/material_load_db.h"
+#include "Game/IW5/XAssets/material/material_mark_db.h"
 #include "Game/IW5/XAssets/materialpixelshader/materialpixelshader_load_db.h"
+#include "Game/IW5/XAssets/materialpixelshader/materialpixelshader_mark_db.h"
 #include "Game/IW5/XAssets/materialtechniqueset/materialtechniqueset_load_db.h"
+#include "Game/IW5/XAssets/materialtechniqueset/materialtechniqueset_mark_db.h"
 #include "Game/IW5/XAssets/materialvertexdeclaration/materialvertexdeclaration_load_db.h"
+#include "Game/IW5/XAssets/materialvertexdeclaration/materialvertexdeclaration_mark_db.h"
 #include "Game/IW5/XAssets/materialvertexshader/materialvertexshader_load_db.h"
+#include "Game/IW5/XAssets/materialvertexshader/materialvertexshader_mark_db.h"
 #include "Game/IW5/XAssets/menudef_t/menudef_t_load_db.h"
+#include "Game/IW5/XAssets/menudef_t/menudef_t_mark_db.h"
 #include "Game/IW5/XAssets/menulist/menulist_load_db.h"
+#include "Game/IW5/XAssets/menulist/menulist_mark_db.h"
 #include "Game/IW5/XAssets/pathdata/pathdata_load_db.h"
+#include "Game/IW5/XAssets/pathdata/pathdata_mark_db.h"
 #include "Game/IW5/XAssets/physcollmap/physcollmap_load_db.h"
+#include "Game/IW5/XAssets/physcollmap/physcollmap_mark_db.h"
 #include "Game/IW5/XAssets/physpreset/physpreset_load_db.h"
+#include "Game/IW5/XAssets/physpreset/physpreset_mark_db.h"
 #include "Game/IW5/XAssets/rawfile/rawfile_load_db.h"
+#include "Game/IW5/XAssets/rawfile/rawfile_mark_db.h"
 #include "Game/IW5/XAssets/scriptfile/scriptfile_load_db.h"
+#include "Game/IW5/XAssets/scriptfile/scriptfile_mark_db.h"
 #include "Game/IW5/XAssets/snd_alias_list_t/snd_alias_list_t_load_db.h"
+#include "Game/IW5/XAssets/snd_alias_list_t/snd_alias_list_t_mark_db.h"
 #include "Game/IW5/XAssets/sndcurve/sndcurve_load_db.h"
+#include "Game/IW5/XAssets/sndcurve/sndcurve_mark_db.h"
 #include "Game/IW5/XAssets/stringtable/stringtable_load_db.h"
+#include "Game/IW5/XAssets/stringtable/stringtable_mark_db.h"
 #include "Game/IW5/XAssets/structureddatadefset/structureddatadefset_load_db.h"
+#include "Game/IW5/XAssets/structureddatadefset/structureddatadefset_mark_db.h"
 #include "Game/IW5/XAssets/surfacefxtable/surfacefxtable_load_db.h"
+#include "Game/IW5/XAssets/surfacefxtable/surfacefxtable_mark_db.h"
 #include "Game/IW5/XAssets/tracerdef/tracerdef_load_db.h"
+#include "Game/IW5/XAssets/tracerdef/tracerdef_mark_db.h"
 #include "Game/IW5/XAssets/vehicledef/vehicledef_load_db.h"
+#include "Game/IW5/XAssets/vehicledef/vehicledef_mark_db.h"
 #include "Game/IW5/XAssets/vehicletrack/vehicletrack_load_db.h"
+#include "Game/IW5/XAssets/vehicletrack/vehicletrack_mark_db.h"
 #include "Game/IW5/XAssets/weaponattachment/weaponattachment_load_db.h"
+#include "Game/IW5/XAssets/weaponattachment/weaponattachment_mark_db.h"
 #include "Game/IW5/XAssets/weaponcompletedef/weaponcompletedef_load_db.h"
+#include "Game/IW5/XAssets/weaponcompletedef/weaponcompletedef_mark_db.h"
 #include "Game/IW5/XAssets/xanimparts/xanimparts_load_db.h"
+#include "Game/IW5/XAssets/xanimparts/xanimparts_mark_db.h"
 #include "Game/IW5/XAssets/xmodel/xmodel_load_db.h"
+#include "Game/IW5/XAssets/xmodel/xmodel_mark_db.h"
 #include "Game/IW5/XAssets/xmodelsurfs/xmodelsurfs_load_db.h"
+#include "Game/IW5/XAssets/xmodelsurfs/xmodelsurfs_mark_db.h"
+#include "Loading/Exception/UnexpectedEndOfFileException.h"
 #include "Loading/Exception/UnsupportedAssetTypeException.h"
 
 #include <cassert>
 
 using namespace IW5;
 
-ContentLoader::ContentLoader()
+namespace
+{
+    void MarkXAsset(Zone* zone, XAssetInfoGeneric& assetInfo)
+    {
+#define MARK_ASSET(type_index, typeName)                                                                                                                       \
+    case type_index:                                                                                                                                           \
+    {                                                                                                                                                          \
+        Marker_##typeName marker(zone);                                                                                                                        \
+        marker.Mark(static_cast<typeName*>(assetInfo.m_ptr));                                                                                                  \
+        assetInfo.m_dependencies = marker.GetDependencies();                                                                                                   \
+        assetInfo.m_used_script_strings = marker.GetUsedScriptStrings();                                                                                       \
+        assetInfo.m_indirect_asset_references = marker.GetIndirectAssetReferences();                                                                           \
+        break;                                                                                                                                                 \
+    }
+
+        switch (assetInfo.m_type)
+        {
+            MARK_ASSET(ASSET_TYPE_PHYSPRESET, PhysPreset)
+            MARK_ASSET(ASSET_TYPE_PHYSCOLLMAP, PhysCollmap)
+            MARK_ASSET(ASSET_TYPE_XANIMPARTS, XAnimParts)
+            MARK_ASSET(ASSET_TYPE_XMODEL_SURFS, XModelSurfs)
+            MARK_ASSET(ASSET_TYPE_XMODEL, XModel)
+            MARK_ASSET(ASSET_TYPE_MATERIAL, Material)
+            MARK_ASSET(ASSET_TYPE_PIXELSHADER, MaterialPixelShader)
+            MARK_ASSET(ASSET_TYPE_VERTEXSHADER, MaterialVertexShader)
+            MARK_ASSET(ASSET_TYPE_VERTEXDECL, MaterialVertexDeclaration)
+            MARK_ASSET(ASSET_TYPE_TECHNIQUE_SET, MaterialTechniqueSet)
+            MARK_ASSET(ASSET_TYPE_IMAGE, GfxImage)
+            MARK_ASSET(ASSET_TYPE_SOUND, snd_alias_list_t)
+            MARK_ASSET(ASSET_TYPE_SOUND_CURVE, SndCurve)
+            MARK_ASSET(ASSET_TYPE_LOADED_SOUND, LoadedSound)
+            MARK_ASSET(ASSET_TYPE_CLIPMAP, clipMap_t)
+            MARK_ASSET(ASSET_TYPE_COMWORLD, ComWorld)
+            MARK_ASSET(ASSET_TYPE_GLASSWORLD, GlassWorld)
+            MARK_ASSET(ASSET_TYPE_PATHDATA, PathData)
+            MARK_ASSET(ASSET_TYPE_VEHICLE_TRACK, VehicleTrack)
+            MARK_ASSET(ASSET_TYPE_MAP_ENTS, MapEnts)
+            MARK_ASSET(ASSET_TYPE_FXWORLD, FxWorld)
+            MARK_ASSET(ASSET_TYPE_GFXWORLD, GfxWorld)
+            MARK_ASSET(ASSET_TYPE_LIGHT_DEF, GfxLightDef)
+            MARK_ASSET(ASSET_TYPE_FONT, Font_s)
+            MARK_ASSET(ASSET_TYPE_MENULIST, MenuList)
+            MARK_ASSET(ASSET_TYPE_MENU, menuDef_t)
+            MARK_ASSET(ASSET_TYPE_LOCALIZE_ENTRY, LocalizeEntry)
+            MARK_ASSET(ASSET_TYPE_ATTACHMENT, WeaponAttachment)
+            MARK_ASSET(ASSET_TYPE_WEAPON, WeaponCompleteDef)
+            MARK_ASSET(ASSET_TYPE_FX, FxEffectDef)
+            MARK_ASSET(ASSET_TYPE_IMPACT_FX, FxImpactTable)
+            MARK_ASSET(ASSET_TYPE_SURFACE_FX, SurfaceFxTable)
+            MARK_ASSET(ASSET_TYPE_RAWFILE, RawFile)
+            MARK_ASSET(ASSET_TYPE_SCRIPTFILE, ScriptFile)
+            MARK_ASSET(ASSET_TYPE_STRINGTABLE, StringTable)
+            MARK_ASSET(ASSET_TYPE_LEADERBOARD, LeaderboardDef)
+            MARK_ASSET(ASSET_TYPE_STRUCTURED_DATA_DEF, StructuredDataDefSet)
+            MARK_ASSET(ASSET_TYPE_TRACER, TracerDef)
+            MARK_ASSET(ASSET_TYPE_VEHICLE, VehicleDef)
+            MARK_ASSET(ASSET_TYPE_ADDON_MAP_ENTS, AddonMapEnts)
+
+        default:
+            assert(false);
+            break;
+        }
+
+#undef MARK_ASSET
+    }
+} // namespace
+
+ContentLoader::ContentLoader(const bool markAssetReferences)
     : varXAsset(nullptr),
-      varScriptStringList(nullptr)
+      varScriptStringList(nullptr),
+      m_mark_asset_references(markAssetReferences)
 {
 }
 
@@ -160,9 +269,16 @@ void ContentLoader::LoadXAssetArray(const bool atStreamStart, const size_t count
         m_zone->m_pools->InitPoolDynamic(assetType);
     }
 
+    auto* memory = m_zone->GetMemory();
     for (size_t index = 0; index < count; index++)
     {
+        const auto loadedSizeBefore = m_stream->GetLoadedSize();
+        m_stream->BeginAsset();
+        const auto allocatedSizeBefore = memory->GetAllocatedSize();
+
         LoadXAsset(false);
+
+        memory->AddAssetMemoryUsage(varXAsset->type, m_stream->GetLoadedSize() - loadedSizeBefore, memory->GetAllocatedSize() - allocatedSizeBefore);
         varXAsset++;
     }
 }
@@ -190,4 +306,23 @@ void ContentLoader::Load(Zone* zone, IZoneInputStream* stream)
     }
 
     m_stream->PopBlock();
+
+    if (m_mark_asset_references)
+    {
+        MarkAssets(
+            [this](XAssetInfoGeneric& assetInfo)
+            {
+                MarkXAsset(m_zone, assetInfo);
+            });
+    }
+}
+
+void ContentLoader::Probe(ILoadingStream* stream, ZoneProbe& probe)
+{
+    XAssetList assetList{};
+    if (stream->Load(&assetList, sizeof(assetList)) != sizeof(assetList))
+        throw UnexpectedEndOfFileException();
+
+    probe.m_script_string_count = static_cast<unsigned>(assetList.stringList.count);
+    probe.m_asset_count = static_cast<unsigned>(assetList.assetCount);
 }
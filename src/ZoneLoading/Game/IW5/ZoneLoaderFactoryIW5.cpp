@@ -9,6 +9,7 @@
 #include "Loading/Processor/ProcessorAuthedBlocks.h"
 #include "Loading/Processor/ProcessorCaptureData.h"
 #include "Loading/Processor/ProcessorInflate.h"
+#include "Loading/Processor/ProcessorReadAhead.h"
 #include "Loading/Steps/StepAddProcessor.h"
 #include "Loading/Steps/StepAllocXBlocks.h"
 #include "Loading/Steps/StepLoadHash.h"
@@ -21,6 +22,7 @@
 #include "Loading/Steps/StepVerifyMagic.h"
 #include "Loading/Steps/StepVerifySignature.h"
 #include "Utils/ClassUtils.h"
+#include "ZoneLoading.h"
 
 #include <cassert>
 #include <cstring>
@@ -122,7 +124,9 @@ class ZoneLoaderFactory::Impl
         auto* subHeaderHashSignaturePtr = subHeaderHashSignature.get();
         zoneLoader->AddLoadingStep(std::move(subHeaderHashSignature));
 
-        zoneLoader->AddLoadingStep(std::make_unique<StepVerifySignature>(std::move(rsa), subHeaderHashSignaturePtr, subHeaderHashPtr));
+        // The signature only covers the hash of the sub header, so it is verified while the rest of the zone is loading
+        if (ZoneLoading::Configuration.VerifySignatures)
+            zoneLoader->AddLoadingStep(std::make_unique<StepVerifySignature>(std::move(rsa), subHeaderHashSignaturePtr, subHeaderHashPtr, true));
 
         auto subHeaderCapture = std::make_unique<ProcessorCaptureData>(sizeof(DB_AuthSubHeader));
         auto* subHeaderCapturePtr = subHeaderCapture.get();
@@ -146,8 +150,13 @@ class ZoneLoaderFactory::Impl
             std::make_unique<StepAddProcessor>(std::make_unique<ProcessorAuthedBlocks>(ZoneConstants::AUTHED_CHUNK_COUNT_PER_GROUP,
                                                                                        ZoneConstants::AUTHED_CHUNK_SIZE,
                                                                                        std::extent_v<decltype(DB_AuthSubHeader::masterBlockHashes)>,
-                                                                                       std::unique_ptr<IHashFunction>(Crypto::CreateSHA256()),
-                                                                                       masterBlockHashesPtr)));
+                                                                                       []
+                                                                                       {
+                                                                                           return std::unique_ptr<IHashFunction>(Crypto::CreateSHA256());
+                                                                                       },
+                                                                                       masterBlockHashesPtr,
+                                                                                       ZoneLoading::Configuration.AuthedBlockWorkerCount,
+                                                                                       ZoneLoading::Configuration.VerifyAuthedBlocks)));
     }
 
 public:
@@ -168,6 +177,7 @@ public:
 
         // File is supported. Now setup all required steps for loading this file.
         auto* zoneLoader = new ZoneLoader(std::move(zone));
+        zoneLoader->m_is_signed = isSecure;
 
         SetupBlock(zoneLoader);
 
@@ -182,14 +192,20 @@ public:
 
         zoneLoader->AddLoadingStep(std::make_unique<StepAddProcessor>(std::make_unique<ProcessorInflate>(ZoneConstants::AUTHED_CHUNK_SIZE)));
 
+        // No processors are added or removed once reading ahead started
+        if (ZoneLoading::Configuration.DecompressAhead)
+            zoneLoader->AddLoadingStep(std::make_unique<StepAddProcessor>(std::make_unique<ProcessorReadAhead>()));
+
         // Start of the XFile struct
         zoneLoader->AddLoadingStep(std::make_unique<StepSkipBytes>(8));
         // Skip size and externalSize fields since they are not interesting for us
         zoneLoader->AddLoadingStep(std::make_unique<StepAllocXBlocks>());
 
         // Start of the zone content
-        zoneLoader->AddLoadingStep(std::make_unique<StepLoadZoneContent>(
-            std::make_unique<ContentLoader>(), zonePtr, ZoneConstants::OFFSET_BLOCK_BIT_COUNT, ZoneConstants::INSERT_BLOCK));
+        zoneLoader->AddLoadingStep(std::make_unique<StepLoadZoneContent>(std::make_unique<ContentLoader>(ZoneLoading::Configuration.MarkAssetReferences),
+                                                                         zonePtr,
+                                                                         ZoneConstants::OFFSET_BLOCK_BIT_COUNT,
+                                                                         ZoneConstants::INSERT_BLOCK));
 
         // Return the fully setup zoneloader
         return zoneLoader;
@@ -2,46 +2,140 @@
 
 #include "Game/T5/T5.h"
 #include "Game/T5/XAssets/clipmap_t/clipmap_t_load_db.h"
+#include "Game/T5/XAssets/clipmap_t/clipmap_t_mark_db.h"
 #include "Game/T5/XAssets/comworld/comworld_load_db.h"
+#include "Game/T5/XAssets/comworld/comworld_mark_db.h"
 #include "Game/T5/XAssets/ddlroot_t/ddlroot_t_load_db.h"
+#include "Game/T5/XAssets/ddlroot_t/ddlroot_t_mark_db.h"
 #include "Game/T5/XAssets/destructibledef/destructibledef_load_db.h"
+#include "Game/T5/XAssets/destructibledef/destructibledef_mark_db.h"
 #include "Game/T5/XAssets/emblemset/emblemset_load_db.h"
+#include "Game/T5/XAssets/emblemset/emblemset_mark_db.h"
 #include "Game/T5/XAssets/font_s/font_s_load_db.h"
+#include "Game/T5/XAssets/font_s/font_s_mark_db.h"
 #include "Game/T5/XAssets/fxeffectdef/fxeffectdef_load_db.h"
+#include "Game/T5/XAssets/fxeffectdef/fxeffectdef_mark_db.h"
 #include "Game/T5/XAssets/fximpacttable/fximpacttable_load_db.h"
+#include "Game/T5/XAssets/fximpacttable/fximpacttable_mark_db.h"
 #include "Game/T5/XAssets/gameworldmp/gameworldmp_load_db.h"
+#include "Game/T5/XAssets/gameworldmp/gameworldmp_mark_db.h"
 #include "Game/T5/XAssets/gameworldsp/gameworldsp_load_db.h"
+#include "Game/T5/XAssets/gameworldsp/gameworldsp_mark_db.h"
 #include "Game/T5/XAssets/gfximage/gfximage_load_db.h"
+#include "Game/T5/XAssets/gfximage/gfximage_mark_db.h"
 #include "Game/T5/XAssets/gfxlightdef/gfxlightdef_load_db.h"
+#include "Game/T5/XAssets/gfxlightdef/gfxlightdef_mark_db.h"
 #include "Game/T5/XAssets/gfxworld/gfxworld_load_db.h"
+#include "Game/T5/XAssets/gfxworld/gfxworld_mark_db.h"
 #include "Game/T5/XAssets/glasses/glasses_load_db.h"
+#include "Game/T5/XAssets/glasses/glasses_mark_db.h"
 #include "Game/T5/XAssets/localizeentry/localizeentry_load_db.h"
+#include "Game/T5/XAssets/localizeentry/localizeentry_mark_db.h"
 #include "Game/T5/XAssets/mapents/mapents_load_db.h"
+#include "Game/T5/XAssets/mapents/mapents_mark_db.h"
 #include "Game/T5/XAssets/material/material_load_db.h"
+#include "Game/T5/XAssets/material/material_mark_db.h"
 #include "Game/T5/XAssets/materialtechniqueset/materialtechniqueset_load_db.h"
+#include "Game/T5/XAssets/materialtechniqueset/materialtechniqueset_mark_db.h"
 #include "Game/T5/XAssets/menudef_t/menudef_t_load_db.h"
+#include "Game/T5/XAssets/menudef_t/menudef_t_mark_db.h"
 #include "Game/T5/XAssets/menulist/menulist_load_db.h"
+#include "Game/T5/XAssets/menulist/menulist_mark_db.h"
 #include "Game/T5/XAssets/packindex/packindex_load_db.h"
+#include "Game/T5/XAssets/packindex/packindex_mark_db.h"
 #include "Game/T5/XAssets/physconstraints/physconstraints_load_db.h"
+#include "Game/T5/XAssets/physconstraints/physconstraints_mark_db.h"
 #include "Game/T5/XAssets/physpreset/physpreset_load_db.h"
+#include "Game/T5/XAssets/physpreset/physpreset_mark_db.h"
 #include "Game/T5/XAssets/rawfile/rawfile_load_db.h"
+#include "Game/T5/XAssets/rawfile/rawfile_mark_db.h"
 #include "Game/T5/XAssets/sndbank/sndbank_load_db.h"
+#include "Game/T5/XAssets/sndbank/sndbank_mark_db.h"
 #include "Game/T5/XAssets/snddriverglobals/snddriverglobals_load_db.h"
+#include "Game/T5/XAssets/snddriverglobals/snddriverglobals_mark_db.h"
 #include "Game/T5/XAssets/sndpatch/sndpatch_load_db.h"
+#include "Game/T5/XAssets/sndpatch/sndpatch_mark_db.h"
 #include "Game/T5/XAssets/stringtable/stringtable_load_db.h"
+#include "Game/T5/XAssets/stringtable/stringtable_mark_db.h"
 #include "Game/T5/XAssets/weaponvariantdef/weaponvariantdef_load_db.h"
+#include "Game/T5/XAssets/weaponvariantdef/weaponvariantdef_mark_db.h"
 #include "Game/T5/XAssets/xanimparts/xanimparts_load_db.h"
+#include "Game/T5/XAssets/xanimparts/xanimparts_mark_db.h"
 #include "Game/T5/XAssets/xglobals/xglobals_load_db.h"
+#include "Game/T5/XAssets/xglobals/xglobals_mark_db.h"
 #include "Game/T5/XAssets/xmodel/xmodel_load_db.h"
+#include "Game/T5/XAssets/xmodel/xmodel_mark_db.h"
+#include "Loading/Exception/UnexpectedEndOfFileException.h"
 #include "Loading/Exception/UnsupportedAssetTypeException.h"
 
 #include <cassert>
 
 using namespace T5;
 
-ContentLoader::ContentLoader()
+namespace
+{
+    void MarkXAsset(Zone* zone, XAssetInfoGeneric& assetInfo)
+    {
+#define MARK_ASSET(type_index, typeName)                                                                                                                       \
+    case type_index:                                                                                                                                           \
+    {                                                                                                                                                          \
+        Marker_##typeName marker(zone);                                                                                                                        \
+        marker.Mark(static_cast<typeName*>(assetInfo.m_ptr));                                                                                                  \
+        assetInfo.m_dependencies = marker.GetDependencies();                                                                                                   \
+        assetInfo.m_used_script_strings = marker.GetUsedScriptStrings();                                                                                       \
+        assetInfo.m_indirect_asset_references = marker.GetIndirectAssetReferences();                                                                           \
+        break;                                                                                                                                                 \
+    }
+
+        switch (assetInfo.m_type)
+        {
+            MARK_ASSET(ASSET_TYPE_PHYSPRESET, PhysPreset)
+            MARK_ASSET(ASSET_TYPE_PHYSCONSTRAINTS, PhysConstraints)
+            MARK_ASSET(ASSET_TYPE_DESTRUCTIBLEDEF, DestructibleDef)
+            MARK_ASSET(ASSET_TYPE_XANIMPARTS, XAnimParts)
+            MARK_ASSET(ASSET_TYPE_XMODEL, XModel)
+            MARK_ASSET(ASSET_TYPE_MATERIAL, Material)
+            MARK_ASSET(ASSET_TYPE_TECHNIQUE_SET, MaterialTechniqueSet)
+            MARK_ASSET(ASSET_TYPE_IMAGE, GfxImage)
+            MARK_ASSET(ASSET_TYPE_SOUND, SndBank)
+            MARK_ASSET(ASSET_TYPE_SOUND_PATCH, SndPatch)
+            MARK_ASSET(ASSET_TYPE_CLIPMAP, clipMap_t)
+            MARK_ASSET(ASSET_TYPE_CLIPMAP_PVS, clipMap_t)
+            MARK_ASSET(ASSET_TYPE_COMWORLD, ComWorld)
+            MARK_ASSET(ASSET_TYPE_GAMEWORLD_SP, GameWorldSp)
+            MARK_ASSET(ASSET_TYPE_GAMEWORLD_MP, GameWorldMp)
+            MARK_ASSET(ASSET_TYPE_MAP_ENTS, MapEnts)
+            MARK_ASSET(ASSET_TYPE_GFXWORLD, GfxWorld)
+            MARK_ASSET(ASSET_TYPE_LIGHT_DEF, GfxLightDef)
+            MARK_ASSET(ASSET_TYPE_FONT, Font_s)
+            MARK_ASSET(ASSET_TYPE_MENULIST, MenuList)
+            MARK_ASSET(ASSET_TYPE_MENU, menuDef_t)
+            MARK_ASSET(ASSET_TYPE_LOCALIZE_ENTRY, LocalizeEntry)
+            MARK_ASSET(ASSET_TYPE_WEAPON, WeaponVariantDef)
+            MARK_ASSET(ASSET_TYPE_SNDDRIVER_GLOBALS, SndDriverGlobals)
+            MARK_ASSET(ASSET_TYPE_FX, FxEffectDef)
+            MARK_ASSET(ASSET_TYPE_IMPACT_FX, FxImpactTable)
+            MARK_ASSET(ASSET_TYPE_RAWFILE, RawFile)
+            MARK_ASSET(ASSET_TYPE_STRINGTABLE, StringTable)
+            MARK_ASSET(ASSET_TYPE_PACK_INDEX, PackIndex)
+            MARK_ASSET(ASSET_TYPE_XGLOBALS, XGlobals)
+            MARK_ASSET(ASSET_TYPE_DDL, ddlRoot_t)
+            MARK_ASSET(ASSET_TYPE_GLASSES, Glasses)
+            MARK_ASSET(ASSET_TYPE_EMBLEMSET, EmblemSet)
+
+        default:
+            assert(false);
+            break;
+        }
+
+#undef MARK_ASSET
+    }
+} // namespace
+
+ContentLoader::ContentLoader(const bool markAssetReferences)
     : varXAsset(nullptr),
-      varScriptStringList(nullptr)
+      varScriptStringList(nullptr),
+      m_mark_asset_references(markAssetReferences)
 {
 }
 
@@ -144,9 +238,16 @@ void ContentLoader::LoadXAssetArray(const bool atStreamStart, const size_t count
         m_zone->m_pools->InitPoolDynamic(assetType);
     }
 
+    auto* memory = m_zone->GetMemory();
     for (size_t index = 0; index < count; index++)
     {
+        const auto loadedSizeBefore = m_stream->GetLoadedSize();
+        m_stream->BeginAsset();
+        const auto allocatedSizeBefore = memory->GetAllocatedSize();
+
         LoadXAsset(false);
+
+        memory->AddAssetMemoryUsage(varXAsset->type, m_stream->GetLoadedSize() - loadedSizeBefore, memory->GetAllocatedSize() - allocatedSizeBefore);
         varXAsset++;
     }
 }
@@ -174,4 +275,23 @@ void ContentLoader::Load(Zone* zone, IZoneInputStream* stream)
     }
 
     m_stream->PopBlock();
+
+    if (m_mark_asset_references)
+    {
+        MarkAssets(
+            [this](XAssetInfoGeneric& assetInfo)
+            {
+                MarkXAsset(m_zone, assetInfo);
+            });
+    }
+}
+
+void ContentLoader::Probe(ILoadingStream* stream, ZoneProbe& probe)
+{
+    XAssetList assetList{};
+    if (stream->Load(&assetList, sizeof(assetList)) != sizeof(assetList))
+        throw UnexpectedEndOfFileException();
+
+    probe.m_script_string_count = static_cast<unsigned>(assetList.stringList.count);
+    probe.m_asset_count = static_cast<unsigned>(assetList.assetCount);
 }
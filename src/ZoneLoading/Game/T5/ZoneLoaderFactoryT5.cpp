@@ -7,11 +7,13 @@
 #include "Game/T5/T5.h"
 #include "Game/T5/ZoneConstantsT5.h"
 #include "Loading/Processor/ProcessorInflate.h"
+#include "Loading/Processor/ProcessorReadAhead.h"
 #include "Loading/Steps/StepAddProcessor.h"
 #include "Loading/Steps/StepAllocXBlocks.h"
 #include "Loading/Steps/StepLoadZoneContent.h"
 #include "Loading/Steps/StepSkipBytes.h"
 #include "Utils/ClassUtils.h"
+#include "ZoneLoading.h"
 
 #include <cassert>
 #include <cstring>
@@ -79,19 +81,26 @@ public:
 
         // File is supported. Now setup all required steps for loading this file.
         auto* zoneLoader = new ZoneLoader(std::move(zone));
+        zoneLoader->m_is_signed = isSecure;
 
         SetupBlock(zoneLoader);
 
         zoneLoader->AddLoadingStep(std::make_unique<StepAddProcessor>(std::make_unique<ProcessorInflate>(ZoneConstants::AUTHED_CHUNK_SIZE)));
 
+        // No processors are added or removed once reading ahead started
+        if (ZoneLoading::Configuration.DecompressAhead)
+            zoneLoader->AddLoadingStep(std::make_unique<StepAddProcessor>(std::make_unique<ProcessorReadAhead>()));
+
         // Start of the XFile struct
         zoneLoader->AddLoadingStep(std::make_unique<StepSkipBytes>(8));
         // Skip size and externalSize fields since they are not interesting for us
         zoneLoader->AddLoadingStep(std::make_unique<StepAllocXBlocks>());
 
         // Start of the zone content
-        zoneLoader->AddLoadingStep(std::make_unique<StepLoadZoneContent>(
-            std::make_unique<ContentLoader>(), zonePtr, ZoneConstants::OFFSET_BLOCK_BIT_COUNT, ZoneConstants::INSERT_BLOCK));
+        zoneLoader->AddLoadingStep(std::make_unique<StepLoadZoneContent>(std::make_unique<ContentLoader>(ZoneLoading::Configuration.MarkAssetReferences),
+                                                                         zonePtr,
+                                                                         ZoneConstants::OFFSET_BLOCK_BIT_COUNT,
+                                                                         ZoneConstants::INSERT_BLOCK));
 
         // Return the fully setup zoneloader
         return zoneLoader;
@@ -19,6 +19,7 @@
 #include "Utils/ClassUtils.h"
 #include "Zone/XChunk/XChunkProcessorInflate.h"
 #include "Zone/XChunk/XChunkProcessorSalsa20Decryption.h"
+#include "ZoneLoading.h"
 
 #include <cassert>
 #include <cstring>
@@ -147,7 +148,11 @@ class ZoneLoaderFactory::Impl
     static ICapturedDataProvider* AddXChunkProcessor(bool isEncrypted, ZoneLoader* zoneLoader, std::string& fileName)
     {
         ICapturedDataProvider* result = nullptr;
-        auto xChunkProcessor = std::make_unique<ProcessorXChunks>(ZoneConstants::STREAM_COUNT, ZoneConstants::XCHUNK_SIZE, ZoneConstants::VANILLA_BUFFER_SIZE);
+        auto xChunkProcessor = std::make_unique<ProcessorXChunks>(ZoneConstants::STREAM_COUNT,
+                                                                  ZoneConstants::XCHUNK_SIZE,
+                                                                  ZoneConstants::VANILLA_BUFFER_SIZE,
+                                                                  ZoneLoading::Configuration.XChunkWorkerCount,
+                                                                  ZoneLoading::Configuration.XChunkReadAheadDepth);
 
         if (isEncrypted)
         {
@@ -159,7 +164,7 @@ class ZoneLoaderFactory::Impl
         }
 
         // Decompress the chunks using zlib
-        xChunkProcessor->AddChunkProcessor(std::make_unique<XChunkProcessorInflate>());
+        xChunkProcessor->AddChunkProcessor(std::make_unique<XChunkProcessorInflate>(ZoneConstants::STREAM_COUNT));
         zoneLoader->AddLoadingStep(std::make_unique<StepAddProcessor>(std::move(xChunkProcessor)));
 
         // If there is encryption, the signed data of the zone is the final hash blocks provided by the Salsa20 IV adaption algorithm
@@ -185,6 +190,8 @@ public:
 
         // File is supported. Now setup all required steps for loading this file.
         auto* zoneLoader = new ZoneLoader(std::move(zone));
+        zoneLoader->m_is_signed = isSecure;
+        zoneLoader->m_is_encrypted = isEncrypted;
 
         SetupBlock(zoneLoader);
 
@@ -202,10 +209,13 @@ public:
         zoneLoader->AddLoadingStep(std::make_unique<StepAllocXBlocks>());
 
         // Start of the zone content
-        zoneLoader->AddLoadingStep(std::make_unique<StepLoadZoneContent>(
-            std::make_unique<ContentLoader>(), zonePtr, ZoneConstants::OFFSET_BLOCK_BIT_COUNT, ZoneConstants::INSERT_BLOCK));
+        zoneLoader->AddLoadingStep(std::make_unique<StepLoadZoneContent>(std::make_unique<ContentLoader>(ZoneLoading::Configuration.MarkAssetReferences),
+                                                                         zonePtr,
+                                                                         ZoneConstants::OFFSET_BLOCK_BIT_COUNT,
+                                                                         ZoneConstants::INSERT_BLOCK));
 
-        if (isSecure)
+        // The signed data is only complete once all chunks were read
+        if (isSecure && ZoneLoading::Configuration.VerifySignatures)
         {
             zoneLoader->AddLoadingStep(std::make_unique<StepVerifySignature>(std::move(rsa), signatureProvider, signatureDataProvider));
         }
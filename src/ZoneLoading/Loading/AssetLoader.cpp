@@ -16,8 +16,17 @@ XAssetInfoGeneric* AssetLoader::LinkAsset(std::string name,
                                           std::vector<scr_string_t> scriptStrings,
                                           std::vector<IndirectAssetReference> indirectAssetReferences) const
 {
-    return m_zone->m_pools->AddAsset(
+    auto* assetInfo = m_zone->m_pools->AddAsset(
         m_asset_type, std::move(name), asset, std::move(dependencies), std::move(scriptStrings), std::move(indirectAssetReferences));
+
+    // Linking happens after all data of the asset was loaded, so the hash and the offset cover everything since the asset started
+    if (assetInfo)
+    {
+        assetInfo->m_content_hash = m_stream->GetContentHash();
+        m_stream->RecordAssetOffset(m_asset_type, assetInfo->m_name);
+    }
+
+    return assetInfo;
 }
 
 XAssetInfoGeneric* AssetLoader::GetAssetInfo(const std::string& name) const
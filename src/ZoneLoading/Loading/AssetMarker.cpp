@@ -2,6 +2,45 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <numeric>
+
+namespace
+{
+    /**
+     * \brief Removes all values that are equal to an earlier value without changing the order of the remaining values.
+     * Sorting avoids hashing every marked value and keeps the result independent of any hash or memory layout.
+     */
+    template<typename T, typename Less> void RemoveLaterDuplicates(std::vector<T>& values, Less less)
+    {
+        if (values.size() <= 1u)
+            return;
+
+        std::vector<size_t> sortedIndices(values.size());
+        std::iota(sortedIndices.begin(), sortedIndices.end(), 0u);
+        std::ranges::stable_sort(sortedIndices,
+                                 [&values, &less](const size_t lhs, const size_t rhs)
+                                 {
+                                     return less(values[lhs], values[rhs]);
+                                 });
+
+        // Equal values are next to each other with the earliest one first
+        std::vector<bool> isDuplicate(values.size(), false);
+        for (auto i = 1u; i < sortedIndices.size(); i++)
+        {
+            if (!less(values[sortedIndices[i - 1u]], values[sortedIndices[i]]))
+                isDuplicate[sortedIndices[i]] = true;
+        }
+
+        auto writeIndex = 0u;
+        for (auto readIndex = 0u; readIndex < values.size(); readIndex++)
+        {
+            if (!isDuplicate[readIndex])
+                values[writeIndex++] = std::move(values[readIndex]);
+        }
+        values.resize(writeIndex);
+    }
+} // namespace
 
 AssetMarker::AssetMarker(const asset_type_t assetType, Zone* zone)
     : m_asset_type(assetType),
@@ -14,11 +53,7 @@ void AssetMarker::AddDependency(XAssetInfoGeneric* assetInfo)
     if (assetInfo == nullptr)
         return;
 
-    const auto existingEntry = m_dependencies.find(assetInfo);
-    if (existingEntry != m_dependencies.end())
-        return;
-
-    m_dependencies.emplace(assetInfo);
+    m_dependencies.push_back(assetInfo);
 }
 
 void AssetMarker::Mark_ScriptString(const scr_string_t scrString)
@@ -28,7 +63,7 @@ void AssetMarker::Mark_ScriptString(const scr_string_t scrString)
     if (scrString >= m_zone->m_script_strings.Count())
         return;
 
-    m_used_script_strings.emplace(scrString);
+    m_used_script_strings.push_back(scrString);
 }
 
 void AssetMarker::MarkArray_ScriptString(const scr_string_t* scrStringArray, const size_t count)
@@ -44,7 +79,8 @@ void AssetMarker::Mark_IndirectAssetRef(asset_type_t type, const char* assetRefN
     if (!assetRefName || !assetRefName[0])
         return;
 
-    m_indirect_asset_references.emplace(type, assetRefName);
+    // The name points into the zone memory which outlives the marker, so it is only copied once the references are requested
+    m_indirect_asset_references.emplace_back(type, assetRefName);
 }
 
 void AssetMarker::MarkArray_IndirectAssetRef(const asset_type_t type, const char** assetRefNames, const size_t count)
@@ -62,27 +98,20 @@ XAssetInfoGeneric* AssetMarker::GetAssetInfoByName(const std::string& name) cons
 
 std::vector<XAssetInfoGeneric*> AssetMarker::GetDependencies() const
 {
-    std::vector<XAssetInfoGeneric*> dependencies;
-    if (!m_dependencies.empty())
-    {
-        dependencies.reserve(m_dependencies.size());
-        for (auto dependency : m_dependencies)
-            dependencies.push_back(dependency);
-    }
+    auto dependencies = m_dependencies;
+    RemoveLaterDuplicates(dependencies, std::less<XAssetInfoGeneric*>());
 
     return dependencies;
 }
 
 std::vector<scr_string_t> AssetMarker::GetUsedScriptStrings() const
 {
-    std::vector<scr_string_t> usedScriptStrings;
-    if (!m_used_script_strings.empty())
+    auto usedScriptStrings = m_used_script_strings;
+    if (!usedScriptStrings.empty())
     {
-        usedScriptStrings.reserve(m_used_script_strings.size());
-        for (auto scrString : m_used_script_strings)
-            usedScriptStrings.push_back(scrString);
-
         std::ranges::sort(usedScriptStrings);
+        const auto duplicates = std::ranges::unique(usedScriptStrings);
+        usedScriptStrings.erase(duplicates.begin(), duplicates.end());
     }
 
     return usedScriptStrings;
@@ -90,13 +119,20 @@ std::vector<scr_string_t> AssetMarker::GetUsedScriptStrings() const
 
 std::vector<IndirectAssetReference> AssetMarker::GetIndirectAssetReferences() const
 {
+    auto uniqueReferences = m_indirect_asset_references;
+    RemoveLaterDuplicates(uniqueReferences,
+                          [](const std::pair<asset_type_t, const char*>& lhs, const std::pair<asset_type_t, const char*>& rhs)
+                          {
+                              if (lhs.first != rhs.first)
+                                  return lhs.first < rhs.first;
+
+                              return std::strcmp(lhs.second, rhs.second) < 0;
+                          });
+
     std::vector<IndirectAssetReference> assetReferences;
-    if (!m_indirect_asset_references.empty())
-    {
-        assetReferences.reserve(m_indirect_asset_references.size());
-        for (const auto& assetReference : m_indirect_asset_references)
-            assetReferences.emplace_back(assetReference);
-    }
+    assetReferences.reserve(uniqueReferences.size());
+    for (const auto& [type, name] : uniqueReferences)
+        assetReferences.emplace_back(type, name);
 
     return assetReferences;
 }
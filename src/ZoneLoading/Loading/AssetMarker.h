@@ -5,15 +5,18 @@
 #include "Utils/ClassUtils.h"
 #include "Zone/ZoneTypes.h"
 
-#include <unordered_set>
+#include <utility>
+#include <vector>
 
 class AssetMarker
 {
     asset_type_t m_asset_type;
 
-    std::unordered_set<XAssetInfoGeneric*> m_dependencies;
-    std::unordered_set<scr_string_t> m_used_script_strings;
-    std::unordered_set<IndirectAssetReference> m_indirect_asset_references;
+    // Marked values are collected with duplicates and only deduplicated once when they are requested.
+    // Markers are created for every asset and every asset reference, so they must not allocate anything until something is marked.
+    std::vector<XAssetInfoGeneric*> m_dependencies;
+    std::vector<scr_string_t> m_used_script_strings;
+    std::vector<std::pair<asset_type_t, const char*>> m_indirect_asset_references;
 
 protected:
     AssetMarker(asset_type_t assetType, Zone* zone);
@@ -31,7 +34,18 @@ protected:
     Zone* m_zone;
 
 public:
+    /**
+     * \brief Returns all marked dependencies without duplicates in the order they were first marked.
+     */
     _NODISCARD std::vector<XAssetInfoGeneric*> GetDependencies() const;
+
+    /**
+     * \brief Returns all marked script strings without duplicates in ascending order.
+     */
     _NODISCARD std::vector<scr_string_t> GetUsedScriptStrings() const;
+
+    /**
+     * \brief Returns all marked indirect asset references without duplicates in the order they were first marked.
+     */
     _NODISCARD std::vector<IndirectAssetReference> GetIndirectAssetReferences() const;
 };
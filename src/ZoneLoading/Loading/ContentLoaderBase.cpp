@@ -1,6 +1,15 @@
 #include "ContentLoaderBase.h"
 
+#include "Utils/JobSystem.h"
+
 #include <cassert>
+#include <vector>
+
+namespace
+{
+    // Marking a handful of assets is faster than distributing them to workers
+    constexpr auto MIN_ASSETS_PER_MARKING_JOB = 64u;
+} // namespace
 
 const void* ContentLoaderBase::PTR_FOLLOWING = reinterpret_cast<void*>(-1);
 const void* ContentLoaderBase::PTR_INSERT = reinterpret_cast<void*>(-2);
@@ -53,3 +62,17 @@ void ContentLoaderBase::LoadXStringArray(const bool atStreamStart, const size_t
         varXString++;
     }
 }
+
+void ContentLoaderBase::MarkAssets(const std::function<void(XAssetInfoGeneric& assetInfo)>& markAsset) const
+{
+    const std::vector<XAssetInfoGeneric*> assets(m_zone->m_pools->begin(), m_zone->m_pools->end());
+
+    // Exceptions of any range are rethrown on the calling thread once all ranges finished
+    JobSystem::Instance().ParallelFor(assets.size(),
+                                      MIN_ASSETS_PER_MARKING_JOB,
+                                      [&assets, &markAsset](const size_t begin, const size_t end)
+                                      {
+                                          for (auto index = begin; index < end; index++)
+                                              markAsset(*assets[index]);
+                                      });
+}
@@ -3,6 +3,8 @@
 #include "Zone/Stream/IZoneInputStream.h"
 #include "Zone/Zone.h"
 
+#include <functional>
+
 class ContentLoaderBase
 {
 protected:
@@ -20,6 +22,13 @@ protected:
     void LoadXString(bool atStreamStart) const;
     void LoadXStringArray(bool atStreamStart, size_t count);
 
+    /**
+     * \brief Calls the specified function for every asset of the zone, distributing the assets over multiple threads.
+     * The function is called after all assets have been loaded, so it must only modify the asset info it has been called with.
+     * \param markAsset The function that collects the references of an asset into its asset info.
+     */
+    void MarkAssets(const std::function<void(XAssetInfoGeneric& assetInfo)>& markAsset) const;
+
 public:
     virtual ~ContentLoaderBase() = default;
 };
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Loading/ILoadingStream.h"
+#include "Loading/ZoneProbe.h"
 #include "Zone/Stream/IZoneInputStream.h"
 #include "Zone/Zone.h"
 
@@ -9,4 +11,11 @@ public:
     virtual ~IContentLoadingEntryPoint() = default;
 
     virtual void Load(Zone* zone, IZoneInputStream* stream) = 0;
+
+    /**
+     * \brief Reads the counts of the asset list at the start of the zone content without loading it.
+     * \param stream The stream positioned at the start of the zone content.
+     * \param probe The metadata of the zone to fill.
+     */
+    virtual void Probe(ILoadingStream* stream, ZoneProbe& probe) = 0;
 };
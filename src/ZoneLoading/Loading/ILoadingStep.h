@@ -2,6 +2,7 @@
 
 #include "ILoadingStream.h"
 #include "Loading/ZoneLoader.h"
+#include "Loading/ZoneProbe.h"
 
 class ZoneLoader;
 
@@ -11,4 +12,24 @@ public:
     virtual ~ILoadingStep() = default;
 
     virtual void PerformStep(ZoneLoader* zoneLoader, ILoadingStream* stream) = 0;
+
+    /**
+     * \brief Performs the step when only probing the zone for its metadata instead of loading it.
+     * \param zoneLoader The zone loader that is probing the zone.
+     * \param stream The stream to read from.
+     * \param probe The metadata of the zone to fill.
+     * \return \c true if probing should continue with the next step, \c false if all metadata has been read.
+     */
+    virtual bool ProbeStep(ZoneLoader* zoneLoader, ILoadingStream* stream, ZoneProbe& probe)
+    {
+        PerformStep(zoneLoader, stream);
+        return true;
+    }
+
+    /**
+     * \brief Finishes work the step started in the background after all steps were performed and before the zone is returned.
+     * Throws a \c LoadingException if the background work failed.
+     * \param zoneLoader The zone loader that loaded the zone.
+     */
+    virtual void FinishStep(ZoneLoader* zoneLoader) {}
 };
@@ -10,4 +10,16 @@ public:
 
     virtual size_t Load(void* buffer, size_t length) = 0;
     virtual int64_t Pos() = 0;
+
+    /**
+     * \brief Advances the stream like \c Load but provides the data in place instead of copying it. Only supported by streams that hold their data in memory.
+     * \param maxLength The maximum amount of bytes to advance.
+     * \param loadedLength The amount of bytes that are available at the returned pointer.
+     * \return A pointer to the loaded data that stays valid as long as the stream or \c nullptr if loading in place is not supported.
+     */
+    virtual const uint8_t* LoadDirect(size_t maxLength, size_t& loadedLength)
+    {
+        loadedLength = 0;
+        return nullptr;
+    }
 };
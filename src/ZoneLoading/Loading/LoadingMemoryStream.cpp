@@ -0,0 +1,37 @@
+#include "LoadingMemoryStream.h"
+
+#include <algorithm>
+#include <cstring>
+
+LoadingMemoryStream::LoadingMemoryStream(const void* data, const size_t size)
+    : m_data(static_cast<const uint8_t*>(data)),
+      m_size(size),
+      m_offset(0u)
+{
+}
+
+size_t LoadingMemoryStream::Load(void* buffer, const size_t length)
+{
+    size_t loadedLength;
+    const auto* data = LoadDirect(length, loadedLength);
+
+    if (loadedLength > 0)
+        memcpy(buffer, data, loadedLength);
+
+    return loadedLength;
+}
+
+int64_t LoadingMemoryStream::Pos()
+{
+    return static_cast<int64_t>(m_offset);
+}
+
+const uint8_t* LoadingMemoryStream::LoadDirect(const size_t maxLength, size_t& loadedLength)
+{
+    const auto* data = &m_data[m_offset];
+
+    loadedLength = std::min(maxLength, m_size - m_offset);
+    m_offset += loadedLength;
+
+    return data;
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include "ILoadingStream.h"
+
+#include <cstddef>
+#include <cstdint>
+
+class LoadingMemoryStream final : public ILoadingStream
+{
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_offset;
+
+public:
+    LoadingMemoryStream(const void* data, size_t size);
+
+    size_t Load(void* buffer, size_t length) override;
+    int64_t Pos() override;
+    const uint8_t* LoadDirect(size_t maxLength, size_t& loadedLength) override;
+};
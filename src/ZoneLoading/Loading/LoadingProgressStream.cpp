@@ -0,0 +1,49 @@
+#include "LoadingProgressStream.h"
+
+#include <algorithm>
+#include <utility>
+
+LoadingProgressStream::LoadingProgressStream(ILoadingStream& baseStream,
+                                             progress::IProgressReporter& reporter,
+                                             std::string zoneName,
+                                             const uint64_t totalSize)
+    : m_base_stream(baseStream),
+      m_reporter(reporter),
+      m_zone_name(std::move(zoneName)),
+      m_total_size(totalSize),
+      m_pos(static_cast<uint64_t>(std::max<int64_t>(baseStream.Pos(), 0))),
+      m_report_step_size(std::max(totalSize / REPORT_STEP_COUNT, MIN_REPORT_STEP_SIZE)),
+      m_next_report_pos((m_pos / m_report_step_size + 1u) * m_report_step_size)
+{
+}
+
+void LoadingProgressStream::AdvanceAndReport(const size_t loadedLength)
+{
+    m_pos += loadedLength;
+    if (m_pos < m_next_report_pos)
+        return;
+
+    m_reporter.OnZoneLoadProgress(m_zone_name, m_pos, m_total_size);
+    m_next_report_pos = (m_pos / m_report_step_size + 1u) * m_report_step_size;
+}
+
+size_t LoadingProgressStream::Load(void* buffer, const size_t length)
+{
+    const auto loadedLength = m_base_stream.Load(buffer, length);
+    AdvanceAndReport(loadedLength);
+
+    return loadedLength;
+}
+
+int64_t LoadingProgressStream::Pos()
+{
+    return m_base_stream.Pos();
+}
+
+const uint8_t* LoadingProgressStream::LoadDirect(const size_t maxLength, size_t& loadedLength)
+{
+    const auto* data = m_base_stream.LoadDirect(maxLength, loadedLength);
+    AdvanceAndReport(loadedLength);
+
+    return data;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "ILoadingStream.h"
+#include "Utils/ProgressReporter.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * \brief Passes all data of a stream through and reports the amount of consumed bytes in steps to a progress reporter.
+ * Counts the consumed bytes itself since asking the base stream for its position can be expensive.
+ */
+class LoadingProgressStream final : public ILoadingStream
+{
+    static constexpr uint64_t REPORT_STEP_COUNT = 100u;
+    static constexpr uint64_t MIN_REPORT_STEP_SIZE = 1024u * 1024u;
+
+    ILoadingStream& m_base_stream;
+    progress::IProgressReporter& m_reporter;
+    std::string m_zone_name;
+    uint64_t m_total_size;
+    uint64_t m_pos;
+    uint64_t m_report_step_size;
+    uint64_t m_next_report_pos;
+
+    void AdvanceAndReport(size_t loadedLength);
+
+public:
+    LoadingProgressStream(ILoadingStream& baseStream, progress::IProgressReporter& reporter, std::string zoneName, uint64_t totalSize);
+
+    size_t Load(void* buffer, size_t length) override;
+    int64_t Pos() override;
+    const uint8_t* LoadDirect(size_t maxLength, size_t& loadedLength) override;
+};
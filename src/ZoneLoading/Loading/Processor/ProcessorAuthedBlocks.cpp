@@ -4,53 +4,125 @@
 #include "Loading/Exception/InvalidHashException.h"
 #include "Loading/Exception/TooManyAuthedGroupsException.h"
 #include "Loading/Exception/UnexpectedEndOfFileException.h"
+#include "Utils/ThreadPool.h"
 
 #include <cassert>
 #include <cstring>
+#include <future>
 #include <memory>
+#include <vector>
+
+namespace
+{
+    // The amount of chunks that are read and hashed ahead of the loading thread per worker
+    constexpr unsigned READ_AHEAD_CHUNKS_PER_WORKER = 4u;
+} // namespace
 
 class ProcessorAuthedBlocks::Impl
 {
+    class ChunkSlot
+    {
+    public:
+        std::unique_ptr<uint8_t[]> m_buffer;
+        size_t m_size;
+
+        std::unique_ptr<IHashFunction> m_hash_function;
+        std::unique_ptr<uint8_t[]> m_hash;
+
+        // Only valid while the chunk is being hashed on a worker thread
+        std::future<void> m_hashed;
+
+        void Hash()
+        {
+            m_hash_function->Init();
+            m_hash_function->Process(m_buffer.get(), m_size);
+            m_hash_function->Finish(m_hash.get());
+        }
+    };
+
     ProcessorAuthedBlocks* const m_base;
 
     const unsigned m_authed_chunk_count;
     const size_t m_chunk_size;
     const unsigned m_max_master_block_count;
+    const bool m_verify_hashes;
 
-    const std::unique_ptr<IHashFunction> m_hash_function;
     IHashProvider* const m_master_block_hash_provider;
-    const std::unique_ptr<uint8_t[]> m_chunk_hashes_buffer;
-    const std::unique_ptr<uint8_t[]> m_current_chunk_hash_buffer;
+    size_t m_hash_size;
+    std::unique_ptr<uint8_t[]> m_chunk_hashes_buffer;
 
-    const std::unique_ptr<uint8_t[]> m_chunk_buffer;
+    // Ring of chunks that were read from the base stream but not yet consumed, in the order of the stream
+    std::vector<ChunkSlot> m_slots;
+    size_t m_read_index;
+    size_t m_consume_index;
+    size_t m_read_ahead_size;
+    bool m_end_reached;
+
+    ChunkSlot* m_current_chunk;
     unsigned m_current_group;
     unsigned m_current_chunk_in_group;
 
     size_t m_current_chunk_offset;
     size_t m_current_chunk_size;
 
-public:
-    Impl(ProcessorAuthedBlocks* base,
-         const unsigned authedChunkCount,
-         const size_t chunkSize,
-         const unsigned maxMasterBlockCount,
-         std::unique_ptr<IHashFunction> hashFunction,
-         IHashProvider* masterBlockHashProvider)
-        : m_base(base),
-          m_authed_chunk_count(authedChunkCount),
-          m_chunk_size(chunkSize),
-          m_max_master_block_count(maxMasterBlockCount),
-          m_hash_function(std::move(hashFunction)),
-          m_master_block_hash_provider(masterBlockHashProvider),
-          m_chunk_hashes_buffer(std::make_unique<uint8_t[]>(m_authed_chunk_count * m_hash_function->GetHashSize())),
-          m_current_chunk_hash_buffer(std::make_unique<uint8_t[]>(m_hash_function->GetHashSize())),
-          m_chunk_buffer(std::make_unique<uint8_t[]>(m_chunk_size)),
-          m_current_group(1),
-          m_current_chunk_in_group(0),
-          m_current_chunk_offset(0),
-          m_current_chunk_size(0)
+    // Declared last to finish all jobs before the slots they reference are destroyed
+    std::unique_ptr<ThreadPool> m_worker_pool;
+
+    ChunkSlot& SlotAt(const size_t index)
+    {
+        return m_slots[index % m_slots.size()];
+    }
+
+    void ReadAhead()
+    {
+        while (!m_end_reached && m_read_index - m_consume_index < m_slots.size())
+        {
+            auto& slot = SlotAt(m_read_index);
+            slot.m_size = m_base->m_base_stream->Load(slot.m_buffer.get(), m_chunk_size);
+
+            if (slot.m_size == 0)
+            {
+                m_end_reached = true;
+                return;
+            }
+
+            if (m_worker_pool)
+            {
+                auto task = std::make_shared<std::packaged_task<void()>>(
+                    [&slot]
+                    {
+                        slot.Hash();
+                    });
+
+                slot.m_hashed = task->get_future();
+                m_worker_pool->Enqueue(
+                    [task]
+                    {
+                        (*task)();
+                    });
+            }
+            else if (m_verify_hashes)
+                slot.Hash();
+
+            m_read_ahead_size += slot.m_size;
+            m_read_index++;
+        }
+    }
+
+    void VerifyGroupHashChunk(const ChunkSlot& chunk) const
+    {
+        const uint8_t* masterBlockHash = nullptr;
+        size_t masterBlockHashSize = 0;
+        m_master_block_hash_provider->GetHash(m_current_group - 1, &masterBlockHash, &masterBlockHashSize);
+
+        if (masterBlockHashSize != m_hash_size || std::memcmp(chunk.m_hash.get(), masterBlockHash, m_hash_size) != 0)
+            throw InvalidHashException();
+    }
+
+    void VerifyDataChunk(const ChunkSlot& chunk) const
     {
-        assert(m_authed_chunk_count * m_hash_function->GetHashSize() <= m_chunk_size);
+        if (std::memcmp(chunk.m_hash.get(), &m_chunk_hashes_buffer[(m_current_chunk_in_group - 1) * m_hash_size], m_hash_size) != 0)
+            throw InvalidHashException();
     }
 
     bool NextChunk()
@@ -59,39 +131,40 @@ public:
 
         while (true)
         {
-            m_current_chunk_size = m_base->m_base_stream->Load(m_chunk_buffer.get(), m_chunk_size);
+            // The previous chunk is fully consumed, so its slot can be filled again
+            ReadAhead();
 
-            if (m_current_chunk_size == 0)
+            if (m_consume_index == m_read_index)
+            {
+                m_current_chunk = nullptr;
+                m_current_chunk_size = 0;
                 return false;
+            }
 
-            m_hash_function->Init();
-            m_hash_function->Process(m_chunk_buffer.get(), m_current_chunk_size);
-            m_hash_function->Finish(m_current_chunk_hash_buffer.get());
+            m_current_chunk = &SlotAt(m_consume_index++);
+            m_current_chunk_size = m_current_chunk->m_size;
+            m_read_ahead_size -= m_current_chunk_size;
+
+            if (m_current_chunk->m_hashed.valid())
+                m_current_chunk->m_hashed.get();
 
             if (m_current_chunk_in_group == 0)
             {
-                if (m_current_chunk_size < m_authed_chunk_count * m_hash_function->GetHashSize())
+                if (m_current_chunk_size < m_authed_chunk_count * m_hash_size)
                     throw UnexpectedEndOfFileException();
 
-                const uint8_t* masterBlockHash = nullptr;
-                size_t masterBlockHashSize = 0;
-                m_master_block_hash_provider->GetHash(m_current_group - 1, &masterBlockHash, &masterBlockHashSize);
-
-                if (masterBlockHashSize != m_hash_function->GetHashSize()
-                    || std::memcmp(m_current_chunk_hash_buffer.get(), masterBlockHash, m_hash_function->GetHashSize()) != 0)
-                    throw InvalidHashException();
-
-                memcpy(m_chunk_hashes_buffer.get(), m_chunk_buffer.get(), m_authed_chunk_count * m_hash_function->GetHashSize());
+                if (m_verify_hashes)
+                {
+                    VerifyGroupHashChunk(*m_current_chunk);
+                    memcpy(m_chunk_hashes_buffer.get(), m_current_chunk->m_buffer.get(), m_authed_chunk_count * m_hash_size);
+                }
 
                 m_current_chunk_in_group++;
             }
             else
             {
-                if (std::memcmp(m_current_chunk_hash_buffer.get(),
-                                &m_chunk_hashes_buffer[(m_current_chunk_in_group - 1) * m_hash_function->GetHashSize()],
-                                m_hash_function->GetHashSize())
-                    != 0)
-                    throw InvalidHashException();
+                if (m_verify_hashes)
+                    VerifyDataChunk(*m_current_chunk);
 
                 if (++m_current_chunk_in_group > m_authed_chunk_count)
                 {
@@ -107,6 +180,50 @@ public:
         }
     }
 
+public:
+    Impl(ProcessorAuthedBlocks* base,
+         const unsigned authedChunkCount,
+         const size_t chunkSize,
+         const unsigned maxMasterBlockCount,
+         const std::function<std::unique_ptr<IHashFunction>()>& hashFunctionFactory,
+         IHashProvider* masterBlockHashProvider,
+         const unsigned workerCount,
+         const bool verifyHashes)
+        : m_base(base),
+          m_authed_chunk_count(authedChunkCount),
+          m_chunk_size(chunkSize),
+          m_max_master_block_count(maxMasterBlockCount),
+          m_verify_hashes(verifyHashes),
+          m_master_block_hash_provider(masterBlockHashProvider),
+          m_hash_size(0),
+          m_slots(verifyHashes && workerCount > 0 ? workerCount * READ_AHEAD_CHUNKS_PER_WORKER : 1u),
+          m_read_index(0),
+          m_consume_index(0),
+          m_read_ahead_size(0),
+          m_end_reached(false),
+          m_current_chunk(nullptr),
+          m_current_group(1),
+          m_current_chunk_in_group(0),
+          m_current_chunk_offset(0),
+          m_current_chunk_size(0)
+    {
+        for (auto& slot : m_slots)
+        {
+            slot.m_buffer = std::make_unique<uint8_t[]>(m_chunk_size);
+            slot.m_size = 0;
+            slot.m_hash_function = hashFunctionFactory();
+            m_hash_size = slot.m_hash_function->GetHashSize();
+            slot.m_hash = std::make_unique<uint8_t[]>(m_hash_size);
+        }
+
+        m_chunk_hashes_buffer = std::make_unique<uint8_t[]>(m_authed_chunk_count * m_hash_size);
+
+        assert(m_authed_chunk_count * m_hash_size <= m_chunk_size);
+
+        if (verifyHashes && workerCount > 0)
+            m_worker_pool = std::make_unique<ThreadPool>(workerCount);
+    }
+
     size_t Load(void* buffer, const size_t length)
     {
         size_t loadedSize = 0;
@@ -124,7 +241,7 @@ public:
                 sizeToWrite = m_current_chunk_size - m_current_chunk_offset;
 
             assert(length - loadedSize >= sizeToWrite);
-            memcpy(&static_cast<uint8_t*>(buffer)[loadedSize], &m_chunk_buffer[m_current_chunk_offset], sizeToWrite);
+            memcpy(&static_cast<uint8_t*>(buffer)[loadedSize], &m_current_chunk->m_buffer[m_current_chunk_offset], sizeToWrite);
             loadedSize += sizeToWrite;
             m_current_chunk_offset += sizeToWrite;
         }
@@ -134,16 +251,18 @@ public:
 
     int64_t Pos()
     {
-        return m_base->m_base_stream->Pos() - (m_current_chunk_size - m_current_chunk_offset);
+        return m_base->m_base_stream->Pos() - static_cast<int64_t>(m_read_ahead_size + (m_current_chunk_size - m_current_chunk_offset));
     }
 };
 
 ProcessorAuthedBlocks::ProcessorAuthedBlocks(const unsigned authedChunkCount,
                                              const size_t chunkSize,
                                              const unsigned maxMasterBlockCount,
-                                             std::unique_ptr<IHashFunction> hashFunction,
-                                             IHashProvider* masterBlockHashProvider)
-    : m_impl(new Impl(this, authedChunkCount, chunkSize, maxMasterBlockCount, std::move(hashFunction), masterBlockHashProvider))
+                                             const std::function<std::unique_ptr<IHashFunction>()>& hashFunctionFactory,
+                                             IHashProvider* masterBlockHashProvider,
+                                             const unsigned workerCount,
+                                             const bool verifyHashes)
+    : m_impl(new Impl(this, authedChunkCount, chunkSize, maxMasterBlockCount, hashFunctionFactory, masterBlockHashProvider, workerCount, verifyHashes))
 {
 }
 
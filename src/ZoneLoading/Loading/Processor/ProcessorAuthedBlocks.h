@@ -3,6 +3,7 @@
 #include "Loading/IHashProvider.h"
 #include "Loading/StreamProcessor.h"
 
+#include <functional>
 #include <memory>
 
 class ProcessorAuthedBlocks final : public StreamProcessor
@@ -11,11 +12,19 @@ class ProcessorAuthedBlocks final : public StreamProcessor
     Impl* m_impl;
 
 public:
+    /**
+     * \brief Creates a processor that verifies the hashes of authed chunks before handing out their data.
+     * \param hashFunctionFactory Creates the hash functions for hashing chunks. Multiple are created when hashing on worker threads.
+     * \param workerCount The amount of worker threads that hash upcoming chunks ahead of time. A value of \c 0 hashes each chunk when it is reached.
+     * \param verifyHashes Whether to verify the chunk hashes at all. Should only be disabled for trusted input.
+     */
     ProcessorAuthedBlocks(unsigned authedChunkCount,
                           size_t chunkSize,
                           unsigned maxMasterBlockCount,
-                          std::unique_ptr<IHashFunction> hashFunction,
-                          IHashProvider* masterBlockHashProvider);
+                          const std::function<std::unique_ptr<IHashFunction>()>& hashFunctionFactory,
+                          IHashProvider* masterBlockHashProvider,
+                          unsigned workerCount = 0u,
+                          bool verifyHashes = true);
     ~ProcessorAuthedBlocks() override;
     ProcessorAuthedBlocks(const ProcessorAuthedBlocks& other) = delete;
     ProcessorAuthedBlocks(ProcessorAuthedBlocks&& other) noexcept = default;
@@ -1,22 +1,43 @@
 #include "ProcessorIW4xDecryption.h"
 
-#include <cassert>
+#include <array>
+#include <cstdint>
 
-ProcessorIW4xDecryption::ProcessorIW4xDecryption()
-    : m_last_byte(0u)
+namespace
 {
-}
+    constexpr uint8_t RotateLeft(const uint8_t value, const unsigned count)
+    {
+        return static_cast<uint8_t>(value << count | (value >> ((sizeof(value) * 8) - count)));
+    }
 
-uint8_t ProcessorIW4xDecryption::RotateLeft(const uint8_t value, const unsigned count)
-{
-    assert(count < sizeof(value) * 8);
-    return static_cast<uint8_t>(value << count | (value >> ((sizeof(value) * 8) - count)));
-}
+    constexpr uint8_t RotateRight(const uint8_t value, const unsigned count)
+    {
+        return static_cast<uint8_t>(value >> count | (value << ((sizeof(value) * 8) - count)));
+    }
+
+    // Every byte is decrypted by the same steps after combining it with the previous decrypted byte, so they can be looked up for all possible combinations
+    constexpr std::array<uint8_t, 256> CreateDecryptionTable()
+    {
+        std::array<uint8_t, 256> table{};
+        for (auto i = 0u; i < table.size(); i++)
+        {
+            auto value = static_cast<uint8_t>(i);
+            value = RotateLeft(value, 4);
+            value ^= 0xFFu;
+            value = RotateRight(value, 6);
+
+            table[i] = value;
+        }
+
+        return table;
+    }
 
-uint8_t ProcessorIW4xDecryption::RotateRight(uint8_t value, const unsigned count)
+    constexpr auto DECRYPTION_TABLE = CreateDecryptionTable();
+} // namespace
+
+ProcessorIW4xDecryption::ProcessorIW4xDecryption()
+    : m_last_byte(0u)
 {
-    assert(count < sizeof(value) * 8);
-    return static_cast<uint8_t>(value >> count | (value << ((sizeof(value) * 8) - count)));
 }
 
 size_t ProcessorIW4xDecryption::Load(void* buffer, const size_t length)
@@ -24,18 +45,15 @@ size_t ProcessorIW4xDecryption::Load(void* buffer, const size_t length)
     const auto readLen = m_base_stream->Load(buffer, length);
 
     auto* charBuffer = static_cast<uint8_t*>(buffer);
+    auto lastByte = m_last_byte;
     for (auto i = 0u; i < readLen; i++)
     {
-        auto value = charBuffer[i];
-        value ^= m_last_byte;
-        value = RotateLeft(value, 4);
-        value ^= -1;
-        value = RotateRight(value, 6);
-
-        charBuffer[i] = value;
-        m_last_byte = value;
+        lastByte = DECRYPTION_TABLE[charBuffer[i] ^ lastByte];
+        charBuffer[i] = lastByte;
     }
 
+    m_last_byte = lastByte;
+
     return readLen;
 }
 
@@ -5,9 +5,6 @@ class ProcessorIW4xDecryption final : public StreamProcessor
 {
     uint8_t m_last_byte;
 
-    static uint8_t RotateLeft(uint8_t value, unsigned count);
-    static uint8_t RotateRight(uint8_t value, unsigned count);
-
 public:
     ProcessorIW4xDecryption();
 
@@ -56,8 +56,19 @@ public:
         {
             if (m_stream.avail_in == 0)
             {
-                m_stream.avail_in = m_base->m_base_stream->Load(m_buffer.get(), m_buffer_size);
-                m_stream.next_in = m_buffer.get();
+                // Inflate straight from the base stream's memory if it supports it
+                size_t directLength;
+                const auto* directInput = m_base->m_base_stream->LoadDirect(m_buffer_size, directLength);
+                if (directInput != nullptr)
+                {
+                    m_stream.avail_in = directLength;
+                    m_stream.next_in = directInput;
+                }
+                else
+                {
+                    m_stream.avail_in = m_base->m_base_stream->Load(m_buffer.get(), m_buffer_size);
+                    m_stream.next_in = m_buffer.get();
+                }
 
                 if (m_stream.avail_in == 0) // EOF
                     return length - m_stream.avail_out;
@@ -0,0 +1,218 @@
+#include "ProcessorReadAhead.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ProcessorReadAhead::Impl
+{
+    class Chunk
+    {
+    public:
+        std::unique_ptr<uint8_t[]> m_data;
+        size_t m_size = 0u;
+        int64_t m_pos = 0;
+    };
+
+    ProcessorReadAhead* m_base;
+    size_t m_chunk_size;
+
+    // Ring of chunks. Chunks are filled by the read thread and consumed by the loading thread in this exact order.
+    std::vector<Chunk> m_chunks;
+    size_t m_filled_count;
+    size_t m_write_index;
+    bool m_end_of_stream;
+    bool m_stopping;
+    std::exception_ptr m_exception;
+
+    std::mutex m_mutex;
+    std::condition_variable m_chunk_filled;
+    std::condition_variable m_chunk_consumed;
+    std::thread m_read_thread;
+
+    // Only accessed by the loading thread. The current chunk stays counted as filled until it is completely consumed.
+    Chunk* m_current_chunk;
+    size_t m_read_index;
+    size_t m_current_offset;
+    int64_t m_pos;
+
+    void ReadChunks()
+    {
+        while (true)
+        {
+            Chunk* chunk;
+            {
+                std::unique_lock lock(m_mutex);
+                m_chunk_consumed.wait(lock,
+                                      [this]
+                                      {
+                                          return m_stopping || m_filled_count < m_chunks.size();
+                                      });
+
+                if (m_stopping)
+                    return;
+
+                // The loading thread never touches chunks that are not filled, so this one can be written without holding the lock
+                chunk = &m_chunks[m_write_index];
+            }
+
+            std::exception_ptr exception;
+            try
+            {
+                chunk->m_size = m_base->m_base_stream->Load(chunk->m_data.get(), m_chunk_size);
+                chunk->m_pos = m_base->m_base_stream->Pos();
+            }
+            catch (...)
+            {
+                exception = std::current_exception();
+            }
+
+            std::lock_guard lock(m_mutex);
+            if (exception || chunk->m_size == 0u)
+            {
+                m_exception = std::move(exception);
+                m_end_of_stream = true;
+                m_chunk_filled.notify_one();
+                return;
+            }
+
+            m_write_index = (m_write_index + 1u) % m_chunks.size();
+            m_filled_count++;
+            m_chunk_filled.notify_one();
+        }
+    }
+
+    bool NextChunk()
+    {
+        std::unique_lock lock(m_mutex);
+
+        if (m_current_chunk)
+        {
+            m_current_chunk = nullptr;
+            m_read_index = (m_read_index + 1u) % m_chunks.size();
+            m_filled_count--;
+            m_chunk_consumed.notify_one();
+        }
+
+        // The read thread is only started once the chain is complete and the base stream is final
+        if (!m_read_thread.joinable() && !m_end_of_stream)
+            m_read_thread = std::thread(&Impl::ReadChunks, this);
+
+        m_chunk_filled.wait(lock,
+                            [this]
+                            {
+                                return m_filled_count > 0u || m_end_of_stream;
+                            });
+
+        if (m_filled_count == 0u)
+        {
+            if (m_exception)
+                std::rethrow_exception(m_exception);
+
+            return false;
+        }
+
+        m_current_chunk = &m_chunks[m_read_index];
+        m_current_offset = 0u;
+        m_pos = m_current_chunk->m_pos;
+        return true;
+    }
+
+public:
+    Impl(ProcessorReadAhead* baseClass, const size_t chunkSize, const size_t chunkCount)
+        : m_base(baseClass),
+          m_chunk_size(chunkSize),
+          m_chunks(std::max(chunkCount, static_cast<size_t>(2u))),
+          m_filled_count(0u),
+          m_write_index(0u),
+          m_end_of_stream(false),
+          m_stopping(false),
+          m_current_chunk(nullptr),
+          m_read_index(0u),
+          m_current_offset(0u),
+          m_pos(0)
+    {
+        for (auto& chunk : m_chunks)
+            chunk.m_data = std::make_unique<uint8_t[]>(chunkSize);
+    }
+
+    ~Impl()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+        m_chunk_consumed.notify_all();
+
+        if (m_read_thread.joinable())
+            m_read_thread.join();
+    }
+
+    Impl(const Impl& other) = delete;
+    Impl(Impl&& other) noexcept = delete;
+    Impl& operator=(const Impl& other) = delete;
+    Impl& operator=(Impl&& other) noexcept = delete;
+
+    size_t Load(void* buffer, const size_t length)
+    {
+        auto* output = static_cast<uint8_t*>(buffer);
+        size_t loadedSize = 0u;
+
+        while (loadedSize < length)
+        {
+            if (!m_current_chunk || m_current_offset >= m_current_chunk->m_size)
+            {
+                if (!NextChunk())
+                    break;
+            }
+
+            const auto copySize = std::min(length - loadedSize, m_current_chunk->m_size - m_current_offset);
+            std::memcpy(&output[loadedSize], &m_current_chunk->m_data[m_current_offset], copySize);
+            m_current_offset += copySize;
+            loadedSize += copySize;
+        }
+
+        return loadedSize;
+    }
+
+    _NODISCARD int64_t Pos() const
+    {
+        // Until the read thread was started the base stream can still be used from the loading thread
+        if (!m_read_thread.joinable())
+            return m_base->m_base_stream->Pos();
+
+        return m_pos;
+    }
+};
+
+ProcessorReadAhead::ProcessorReadAhead()
+    : ProcessorReadAhead(DEFAULT_CHUNK_SIZE, DEFAULT_CHUNK_COUNT)
+{
+}
+
+ProcessorReadAhead::ProcessorReadAhead(const size_t chunkSize, const size_t chunkCount)
+    : m_impl(new Impl(this, chunkSize, chunkCount))
+{
+}
+
+ProcessorReadAhead::~ProcessorReadAhead()
+{
+    delete m_impl;
+    m_impl = nullptr;
+}
+
+size_t ProcessorReadAhead::Load(void* buffer, const size_t length)
+{
+    return m_impl->Load(buffer, length);
+}
+
+int64_t ProcessorReadAhead::Pos()
+{
+    return m_impl->Pos();
+}
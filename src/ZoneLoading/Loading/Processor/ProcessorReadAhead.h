@@ -0,0 +1,35 @@
+#pragma once
+#include "Loading/StreamProcessor.h"
+
+#include <cstddef>
+
+/**
+ * \brief Reads its base stream ahead into a ring of chunks on a background thread, so that expensive processors like inflating run in parallel with loading the content.
+ * Processors before it must not be added or removed once loading through it started, since its base stream is accessed from the background thread from then on.
+ */
+class ProcessorReadAhead final : public StreamProcessor
+{
+    class Impl;
+    Impl* m_impl;
+
+public:
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 0x40000;
+    static constexpr size_t DEFAULT_CHUNK_COUNT = 4u;
+
+    ProcessorReadAhead();
+
+    /**
+     * \brief Creates a processor that reads ahead of the loading thread.
+     * \param chunkSize The amount of bytes that are read from the base stream at once.
+     * \param chunkCount The amount of chunks that can be read ahead.
+     */
+    ProcessorReadAhead(size_t chunkSize, size_t chunkCount);
+    ~ProcessorReadAhead() override;
+    ProcessorReadAhead(const ProcessorReadAhead& other) = delete;
+    ProcessorReadAhead(ProcessorReadAhead&& other) noexcept = default;
+    ProcessorReadAhead& operator=(const ProcessorReadAhead& other) = delete;
+    ProcessorReadAhead& operator=(ProcessorReadAhead&& other) noexcept = default;
+
+    size_t Load(void* buffer, size_t length) override;
+    int64_t Pos() override;
+};
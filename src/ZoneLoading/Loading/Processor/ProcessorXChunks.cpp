@@ -1,123 +1,304 @@
 #include "ProcessorXChunks.h"
 
 #include "Loading/Exception/InvalidChunkSizeException.h"
+#include "Loading/Exception/InvalidCompressionException.h"
+#include "Utils/ThreadPool.h"
+#include "Utils/Tracing.h"
+#include "Zone/XChunk/XChunkException.h"
 #include "Zone/ZoneTypes.h"
 
+#include <atomic>
 #include <cassert>
 #include <condition_variable>
 #include <cstring>
+#include <exception>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <utility>
 #include <vector>
 
 class DBLoadStream
 {
-    int m_index;
+    enum class SlotState
+    {
+        FREE,
+        READ,
+        DECODED,
+        END,
+        FAILED
+    };
+
+    class ChunkSlot
+    {
+    public:
+        std::unique_ptr<uint8_t[]> m_buffers[2];
 
-    std::unique_ptr<uint8_t[]> m_buffers[2];
+        // The input of the first processor which is either the input buffer or the data of a base stream that is held in memory
+        const uint8_t* m_input;
+        uint8_t* m_input_buffer;
+        size_t m_input_size;
 
-    uint8_t* m_input_buffer;
-    size_t m_input_size;
+        uint8_t* m_output_buffer;
+        size_t m_output_size;
 
-    uint8_t* m_output_buffer;
-    size_t m_output_size;
+        SlotState m_state;
+        std::exception_ptr m_exception;
 
+        explicit ChunkSlot(const size_t chunkSize)
+        {
+            for (auto& buffer : m_buffers)
+                buffer = std::make_unique<uint8_t[]>(chunkSize);
+
+            m_input_buffer = m_buffers[0].get();
+            m_output_buffer = m_buffers[1].get();
+            m_input = m_input_buffer;
+
+            m_input_size = 0;
+            m_output_size = 0;
+
+            m_state = SlotState::FREE;
+        }
+    };
+
+    int m_index;
     size_t m_chunk_size;
 
-    bool m_is_loading;
-    std::mutex m_load_mutex;
-    std::condition_variable m_loading_finished;
-    std::thread m_load_thread;
+    // Ring of chunks of this stream. Slots are filled by the reader, decoded by the worker pool and consumed by the loading thread in this exact order.
+    std::vector<ChunkSlot> m_slots;
+    size_t m_read_index;
+    size_t m_decode_index;
+    size_t m_consume_index;
+
+    bool m_is_decoding;
+    bool m_is_stopping;
+    std::mutex m_mutex;
+    std::condition_variable m_state_changed;
 
+    ThreadPool& m_worker_pool;
     std::vector<std::unique_ptr<IXChunkProcessor>>& m_processors;
 
-    void Load()
+    ChunkSlot& SlotAt(const size_t index)
     {
-        std::lock_guard<std::mutex> lock(m_load_mutex);
+        return m_slots[index % m_slots.size()];
+    }
+
+    void Process(ChunkSlot& slot) const
+    {
+        // Empty chunks do not advance the state of any processor
+        if (slot.m_input_size == 0)
+        {
+            slot.m_output_size = 0;
+            return;
+        }
 
         bool firstProcessor = true;
+        const uint8_t* input = slot.m_input;
+        TRACE_COUNTER("XChunk bytes read", static_cast<int64_t>(slot.m_input_size));
 
         for (const auto& processor : m_processors)
         {
+            TRACE_SCOPE("XChunk", tracing::Tracer::GetDynamicTypeName(*processor));
+
             if (!firstProcessor)
             {
-                uint8_t* previousInputBuffer = m_input_buffer;
-                m_input_buffer = m_output_buffer;
-                m_output_buffer = previousInputBuffer;
+                std::swap(slot.m_input_buffer, slot.m_output_buffer);
+                input = slot.m_input_buffer;
 
-                m_input_size = m_output_size;
-                m_output_size = 0;
+                slot.m_input_size = slot.m_output_size;
+                slot.m_output_size = 0;
             }
 
-            m_output_size = processor->Process(m_index, m_input_buffer, m_input_size, m_output_buffer, m_chunk_size);
+            slot.m_output_size = processor->Process(m_index, input, slot.m_input_size, slot.m_output_buffer, m_chunk_size);
 
             firstProcessor = false;
         }
+    }
+
+    void Decode()
+    {
+        // Chunks of one stream depend on each other so only one decoding job per stream runs at a time and it works through the read chunks in order
+        std::unique_lock lock(m_mutex);
+        while (SlotAt(m_decode_index).m_state == SlotState::READ)
+        {
+            auto& slot = SlotAt(m_decode_index);
+            lock.unlock();
+
+            std::exception_ptr decodeException;
+            try
+            {
+                Process(slot);
+            }
+            catch (XChunkException&)
+            {
+                decodeException = std::make_exception_ptr(InvalidCompressionException());
+            }
+            catch (...)
+            {
+                decodeException = std::current_exception();
+            }
+
+            lock.lock();
+            slot.m_exception = std::move(decodeException);
+            slot.m_state = slot.m_exception ? SlotState::FAILED : SlotState::DECODED;
+            m_decode_index++;
+            m_state_changed.notify_all();
+        }
 
-        m_is_loading = false;
-        m_loading_finished.notify_all();
+        m_is_decoding = false;
+        m_state_changed.notify_all();
     }
 
-public:
-    DBLoadStream(const int streamIndex, const size_t chunkSize, std::vector<std::unique_ptr<IXChunkProcessor>>& chunkProcessors)
-        : m_processors(chunkProcessors)
+    void CommitSlot(const SlotState state, std::exception_ptr exception)
     {
-        m_index = streamIndex;
-        m_chunk_size = chunkSize;
+        {
+            std::lock_guard lock(m_mutex);
+
+            auto& slot = SlotAt(m_read_index);
+            slot.m_state = state;
+            slot.m_exception = std::move(exception);
 
-        for (auto& buffer : m_buffers)
-            buffer = std::make_unique<uint8_t[]>(chunkSize);
+            if (state != SlotState::READ)
+            {
+                m_state_changed.notify_all();
+                return;
+            }
 
-        m_input_buffer = m_buffers[0].get();
-        m_output_buffer = m_buffers[1].get();
+            m_read_index++;
+            if (m_is_decoding)
+                return;
 
-        m_input_size = 0;
-        m_output_size = 0;
+            m_is_decoding = true;
+        }
 
-        m_is_loading = false;
+        m_worker_pool.Enqueue(
+            [this]
+            {
+                Decode();
+            });
     }
 
-    uint8_t* GetInputBuffer() const
+public:
+    DBLoadStream(const int streamIndex,
+                 const size_t chunkSize,
+                 const size_t readAheadDepth,
+                 ThreadPool& workerPool,
+                 std::vector<std::unique_ptr<IXChunkProcessor>>& chunkProcessors)
+        : m_index(streamIndex),
+          m_chunk_size(chunkSize),
+          m_read_index(0),
+          m_decode_index(0),
+          m_consume_index(0),
+          m_is_decoding(false),
+          m_is_stopping(false),
+          m_worker_pool(workerPool),
+          m_processors(chunkProcessors)
     {
-        return m_input_buffer;
+        assert(readAheadDepth > 0);
+
+        m_slots.reserve(readAheadDepth);
+        for (auto i = 0u; i < readAheadDepth; i++)
+            m_slots.emplace_back(chunkSize);
     }
 
-    void StartLoading(const size_t inputSize)
+    /**
+     * \brief Waits for the next chunk of this stream to be free for reading into.
+     * \return The input buffer to read the chunk into or \c nullptr if the stream is being stopped.
+     */
+    uint8_t* AcquireInputBuffer()
     {
-        if (inputSize > 0)
-        {
-            std::unique_lock<std::mutex> lock(m_load_mutex);
+        std::unique_lock lock(m_mutex);
+        m_state_changed.wait(lock,
+                             [this]
+                             {
+                                 return m_is_stopping || SlotAt(m_read_index).m_state == SlotState::FREE;
+                             });
 
-            if (m_is_loading)
-            {
-                m_loading_finished.wait(lock);
-            }
+        if (m_is_stopping)
+            return nullptr;
 
-            m_input_size = inputSize;
-            m_is_loading = true;
-            m_load_thread = std::thread(&DBLoadStream::Load, this);
-            m_load_thread.detach();
-        }
-        else
-        {
-            m_output_size = 0;
-        }
+        return SlotAt(m_read_index).m_input_buffer;
+    }
+
+    /**
+     * \brief Marks the next chunk of this stream as read.
+     * \param input The data of the chunk. Either the acquired input buffer or memory that stays valid until the chunk was decoded.
+     * \param inputSize The size of the chunk.
+     */
+    void CommitInput(const uint8_t* input, const size_t inputSize)
+    {
+        auto& slot = SlotAt(m_read_index);
+        slot.m_input = input;
+        slot.m_input_size = inputSize;
+        CommitSlot(SlotState::READ, nullptr);
+    }
+
+    void CommitEndOfStream(std::exception_ptr exception)
+    {
+        CommitSlot(exception ? SlotState::FAILED : SlotState::END, std::move(exception));
     }
 
-    void GetOutput(const uint8_t** pBuffer, size_t* pSize)
+    /**
+     * \brief Waits for the next chunk of this stream to be decoded.
+     * \return \c true if a chunk was available, \c false if the stream reached its end.
+     */
+    bool GetOutput(const uint8_t** pBuffer, size_t* pSize)
     {
         assert(pBuffer != nullptr);
         assert(pSize != nullptr);
 
-        std::unique_lock<std::mutex> lock(m_load_mutex);
-        if (m_is_loading)
+        std::unique_lock lock(m_mutex);
+        auto& slot = SlotAt(m_consume_index);
+        m_state_changed.wait(lock,
+                             [&slot]
+                             {
+                                 return slot.m_state == SlotState::DECODED || slot.m_state == SlotState::END || slot.m_state == SlotState::FAILED;
+                             });
+
+        if (slot.m_state == SlotState::FAILED)
+            std::rethrow_exception(slot.m_exception);
+
+        if (slot.m_state == SlotState::END)
+            return false;
+
+        *pBuffer = slot.m_output_buffer;
+        *pSize = slot.m_output_size;
+        return true;
+    }
+
+    void ReleaseOutput()
+    {
         {
-            m_loading_finished.wait(lock);
+            std::lock_guard lock(m_mutex);
+
+            auto& slot = SlotAt(m_consume_index);
+            assert(slot.m_state == SlotState::DECODED);
+
+            slot.m_state = SlotState::FREE;
+            m_consume_index++;
         }
 
-        *pBuffer = m_output_buffer;
-        *pSize = m_output_size;
+        m_state_changed.notify_all();
+    }
+
+    void Stop()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_is_stopping = true;
+        }
+
+        m_state_changed.notify_all();
+    }
+
+    void WaitForDecoding()
+    {
+        std::unique_lock lock(m_mutex);
+        m_state_changed.wait(lock,
+                             [this]
+                             {
+                                 return !m_is_decoding;
+                             });
     }
 };
 
@@ -125,11 +306,15 @@ class ProcessorXChunks::ProcessorXChunksImpl
 {
     ProcessorXChunks* m_base;
 
+    ThreadPool m_worker_pool;
     std::vector<std::unique_ptr<DBLoadStream>> m_streams;
     size_t m_chunk_size;
     size_t m_vanilla_buffer_size;
     std::vector<std::unique_ptr<IXChunkProcessor>> m_chunk_processors;
 
+    std::thread m_read_thread;
+    std::atomic<int64_t> m_read_pos;
+
     bool m_initialized_streams;
     unsigned int m_current_stream;
     const uint8_t* m_current_chunk;
@@ -138,15 +323,9 @@ class ProcessorXChunks::ProcessorXChunksImpl
     size_t m_vanilla_buffer_offset;
 
     bool m_eof_reached;
-    unsigned int m_eof_stream;
 
-    void AdvanceStream(const unsigned int streamNum)
+    void ReadChunk(DBLoadStream& stream, uint8_t* inputBuffer)
     {
-        assert(streamNum >= 0 && streamNum < m_streams.size());
-
-        if (m_eof_reached)
-            return;
-
         xchunk_size_t chunkSize;
         if (m_vanilla_buffer_size > 0)
         {
@@ -163,8 +342,7 @@ class ProcessorXChunks::ProcessorXChunksImpl
 
         if (readSize == 0)
         {
-            m_eof_reached = true;
-            m_eof_stream = streamNum;
+            stream.CommitEndOfStream(nullptr);
             return;
         }
 
@@ -173,8 +351,14 @@ class ProcessorXChunks::ProcessorXChunksImpl
             throw InvalidChunkSizeException(chunkSize, m_chunk_size);
         }
 
-        const auto& stream = m_streams[streamNum];
-        const size_t loadedChunkSize = m_base->m_base_stream->Load(stream->GetInputBuffer(), chunkSize);
+        // Chunks of base streams that are held in memory are decoded from there instead of being copied into the input buffer first
+        size_t loadedChunkSize;
+        const uint8_t* chunkData = m_base->m_base_stream->LoadDirect(chunkSize, loadedChunkSize);
+        if (chunkData == nullptr)
+        {
+            loadedChunkSize = m_base->m_base_stream->Load(inputBuffer, chunkSize);
+            chunkData = inputBuffer;
+        }
 
         if (loadedChunkSize != chunkSize)
         {
@@ -186,41 +370,68 @@ class ProcessorXChunks::ProcessorXChunksImpl
             m_vanilla_buffer_offset = (m_vanilla_buffer_offset + loadedChunkSize) % m_vanilla_buffer_size;
         }
 
-        stream->StartLoading(loadedChunkSize);
+        m_read_pos = m_base->m_base_stream->Pos();
+        stream.CommitInput(chunkData, loadedChunkSize);
+    }
+
+    void ReadStreams()
+    {
+        // The chunks of all streams are interleaved in the file so the reader advances one stream after another
+        const auto streamCount = m_streams.size();
+        for (auto streamNum = 0u;; streamNum = (streamNum + 1) % streamCount)
+        {
+            auto& stream = *m_streams[streamNum];
+            auto* inputBuffer = stream.AcquireInputBuffer();
+            if (inputBuffer == nullptr)
+                return;
+
+            try
+            {
+                ReadChunk(stream, inputBuffer);
+            }
+            catch (...)
+            {
+                stream.CommitEndOfStream(std::current_exception());
+                return;
+            }
+        }
     }
 
     void NextStream()
     {
-        AdvanceStream(m_current_stream);
+        m_streams[m_current_stream]->ReleaseOutput();
 
         m_current_stream = (m_current_stream + 1) % m_streams.size();
         m_current_chunk_offset = 0;
-        m_streams[m_current_stream]->GetOutput(&m_current_chunk, &m_current_chunk_size);
+        m_eof_reached = !m_streams[m_current_stream]->GetOutput(&m_current_chunk, &m_current_chunk_size);
     }
 
     void InitStreams()
     {
         m_initialized_streams = true;
         m_vanilla_buffer_offset = static_cast<size_t>(m_base->m_base_stream->Pos());
+        m_read_pos = m_base->m_base_stream->Pos();
 
-        const unsigned int streamCount = m_streams.size();
-        for (unsigned int streamNum = 0; streamNum < streamCount; streamNum++)
-        {
-            AdvanceStream(streamNum);
-        }
+        m_read_thread = std::thread(&ProcessorXChunksImpl::ReadStreams, this);
 
         m_current_stream = 0;
         m_current_chunk_offset = 0;
-        m_streams[0]->GetOutput(&m_current_chunk, &m_current_chunk_size);
+        m_eof_reached = !m_streams[0]->GetOutput(&m_current_chunk, &m_current_chunk_size);
     }
 
     bool EndOfStream() const
     {
-        return m_eof_reached && m_eof_stream == m_current_stream;
+        return m_eof_reached;
     }
 
 public:
-    ProcessorXChunksImpl(ProcessorXChunks* base, const int numStreams, const size_t xChunkSize)
+    ProcessorXChunksImpl(ProcessorXChunks* base,
+                         const int numStreams,
+                         const size_t xChunkSize,
+                         const size_t vanillaBufferSize,
+                         const size_t workerCount,
+                         const size_t readAheadDepth)
+        : m_worker_pool(workerCount > 0u ? workerCount : static_cast<size_t>(numStreams), static_cast<size_t>(numStreams))
     {
         assert(base != nullptr);
         assert(numStreams > 0);
@@ -230,11 +441,14 @@ public:
 
         for (int streamIndex = 0; streamIndex < numStreams; streamIndex++)
         {
-            m_streams.emplace_back(std::make_unique<DBLoadStream>(streamIndex, xChunkSize, m_chunk_processors));
+            m_streams.emplace_back(std::make_unique<DBLoadStream>(
+                streamIndex, xChunkSize, readAheadDepth > 0u ? readAheadDepth : DEFAULT_READ_AHEAD_DEPTH, m_worker_pool, m_chunk_processors));
         }
 
         m_chunk_size = xChunkSize;
-        m_vanilla_buffer_size = 0;
+        m_vanilla_buffer_size = vanillaBufferSize;
+
+        m_read_pos = 0;
 
         m_initialized_streams = false;
         m_current_stream = 0;
@@ -244,18 +458,30 @@ public:
         m_vanilla_buffer_offset = 0;
 
         m_eof_reached = false;
-        m_eof_stream = 0;
     }
 
-    ProcessorXChunksImpl(ProcessorXChunks* base, const int numStreams, const size_t xChunkSize, const size_t vanillaBufferSize)
-        : ProcessorXChunksImpl(base, numStreams, xChunkSize)
+    ~ProcessorXChunksImpl()
     {
-        m_vanilla_buffer_size = vanillaBufferSize;
+        // The reader and pending decoding jobs reference the streams and chunk processors so they must be finished before those can be destroyed
+        for (const auto& stream : m_streams)
+            stream->Stop();
+
+        if (m_read_thread.joinable())
+            m_read_thread.join();
+
+        for (const auto& stream : m_streams)
+            stream->WaitForDecoding();
     }
 
+    ProcessorXChunksImpl(const ProcessorXChunksImpl& other) = delete;
+    ProcessorXChunksImpl(ProcessorXChunksImpl&& other) noexcept = delete;
+    ProcessorXChunksImpl& operator=(const ProcessorXChunksImpl& other) = delete;
+    ProcessorXChunksImpl& operator=(ProcessorXChunksImpl&& other) noexcept = delete;
+
     void AddChunkProcessor(std::unique_ptr<IXChunkProcessor> streamProcessor)
     {
         assert(streamProcessor != nullptr);
+        assert(!m_initialized_streams);
 
         m_chunk_processors.emplace_back(std::move(streamProcessor));
     }
@@ -302,18 +528,28 @@ public:
 
     int64_t Pos() const
     {
-        return m_base->m_base_stream->Pos();
+        if (!m_initialized_streams)
+            return m_base->m_base_stream->Pos();
+
+        // The base stream is owned by the reader once it started
+        return m_read_pos;
     }
 };
 
 ProcessorXChunks::ProcessorXChunks(const int numStreams, const size_t xChunkSize)
+    : ProcessorXChunks(numStreams, xChunkSize, 0u)
 {
-    m_impl = new ProcessorXChunksImpl(this, numStreams, xChunkSize);
 }
 
 ProcessorXChunks::ProcessorXChunks(const int numStreams, const size_t xChunkSize, const size_t vanillaBufferSize)
+    : ProcessorXChunks(numStreams, xChunkSize, vanillaBufferSize, 0u, 0u)
+{
+}
+
+ProcessorXChunks::ProcessorXChunks(
+    const int numStreams, const size_t xChunkSize, const size_t vanillaBufferSize, const size_t workerCount, const size_t readAheadDepth)
 {
-    m_impl = new ProcessorXChunksImpl(this, numStreams, xChunkSize, vanillaBufferSize);
+    m_impl = new ProcessorXChunksImpl(this, numStreams, xChunkSize, vanillaBufferSize, workerCount, readAheadDepth);
 }
 
 ProcessorXChunks::~ProcessorXChunks()
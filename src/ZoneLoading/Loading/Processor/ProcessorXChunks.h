@@ -10,8 +10,20 @@ class ProcessorXChunks : public StreamProcessor
     ProcessorXChunksImpl* m_impl;
 
 public:
+    static constexpr size_t DEFAULT_READ_AHEAD_DEPTH = 4u;
+
     ProcessorXChunks(int numStreams, size_t xChunkSize);
     ProcessorXChunks(int numStreams, size_t xChunkSize, size_t vanillaBufferSize);
+
+    /**
+     * \brief Creates a processor for loading XChunks. Chunks are read ahead by a dedicated reader thread and decoded on a persistent pool of worker threads.
+     * \param numStreams The amount of interleaved streams.
+     * \param xChunkSize The maximum size of a single XChunk.
+     * \param vanillaBufferSize The size of the buffer the game uses for reading or \c 0 if chunks are not aligned to it.
+     * \param workerCount The amount of worker threads to decode chunks with. A value of \c 0 uses one worker per stream.
+     * \param readAheadDepth The amount of chunks that can be read ahead for each stream. A value of \c 0 uses \c DEFAULT_READ_AHEAD_DEPTH.
+     */
+    ProcessorXChunks(int numStreams, size_t xChunkSize, size_t vanillaBufferSize, size_t workerCount, size_t readAheadDepth);
     ~ProcessorXChunks() override;
 
     size_t Load(void* buffer, size_t length) override;
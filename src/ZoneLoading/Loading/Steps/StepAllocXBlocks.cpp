@@ -1,15 +1,27 @@
 #include "StepAllocXBlocks.h"
 
 #include "Loading/Exception/InvalidXBlockSizeException.h"
+#include "ZoneLoading.h"
 
 const uint64_t StepAllocXBlocks::MAX_XBLOCK_SIZE = 0x3C000000;
 
-void StepAllocXBlocks::PerformStep(ZoneLoader* zoneLoader, ILoadingStream* stream)
+namespace
+{
+    // Reservations are never backed by large pages to not make unloaded blocks take physical memory
+    VirtualXBlockAllocator unloadedBlockAllocator(false);
+
+    bool IsLoadedFromZone(const XBlock& block)
+    {
+        return block.m_type == XBlock::Type::BLOCK_TYPE_NORMAL || block.m_type == XBlock::Type::BLOCK_TYPE_TEMP;
+    }
+} // namespace
+
+std::vector<xblock_size_t> StepAllocXBlocks::LoadBlockSizes(const ZoneLoader* zoneLoader, ILoadingStream* stream)
 {
     const unsigned int blockCount = zoneLoader->m_blocks.size();
 
-    auto* blockSizes = new xblock_size_t[blockCount];
-    stream->Load(blockSizes, sizeof(xblock_size_t) * blockCount);
+    std::vector<xblock_size_t> blockSizes(blockCount);
+    stream->Load(blockSizes.data(), sizeof(xblock_size_t) * blockCount);
 
     uint64_t totalMemory = 0;
     for (unsigned int block = 0; block < blockCount; block++)
@@ -22,10 +34,32 @@ void StepAllocXBlocks::PerformStep(ZoneLoader* zoneLoader, ILoadingStream* strea
         throw InvalidXBlockSizeException(totalMemory, MAX_XBLOCK_SIZE);
     }
 
-    for (unsigned int block = 0; block < blockCount; block++)
+    return blockSizes;
+}
+
+void StepAllocXBlocks::PerformStep(ZoneLoader* zoneLoader, ILoadingStream* stream)
+{
+    const auto blockSizes = LoadBlockSizes(zoneLoader, stream);
+
+    for (unsigned int block = 0; block < blockSizes.size(); block++)
+    {
+        auto* xblock = zoneLoader->m_blocks[block];
+        if (ZoneLoading::Configuration.ReserveUnloadedBlocks && !IsLoadedFromZone(*xblock))
+            xblock->Alloc(blockSizes[block], &unloadedBlockAllocator);
+        else
+            xblock->Alloc(blockSizes[block], ZoneLoading::Configuration.XBlockAllocator);
+    }
+}
+
+bool StepAllocXBlocks::ProbeStep(ZoneLoader* zoneLoader, ILoadingStream* stream, ZoneProbe& probe)
+{
+    const auto blockSizes = LoadBlockSizes(zoneLoader, stream);
+
+    for (unsigned int block = 0; block < blockSizes.size(); block++)
     {
-        zoneLoader->m_blocks[block]->Alloc(blockSizes[block]);
+        const auto* xblock = zoneLoader->m_blocks[block];
+        probe.m_blocks.emplace_back(ZoneProbe::Block{xblock->m_name, xblock->m_type, blockSizes[block]});
     }
 
-    delete[] blockSizes;
+    return true;
 }
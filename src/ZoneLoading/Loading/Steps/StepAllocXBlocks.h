@@ -2,10 +2,15 @@
 
 #include "Loading/ILoadingStep.h"
 
+#include <vector>
+
 class StepAllocXBlocks final : public ILoadingStep
 {
     static const uint64_t MAX_XBLOCK_SIZE;
 
+    static std::vector<xblock_size_t> LoadBlockSizes(const ZoneLoader* zoneLoader, ILoadingStream* stream);
+
 public:
     void PerformStep(ZoneLoader* zoneLoader, ILoadingStream* stream) override;
+    bool ProbeStep(ZoneLoader* zoneLoader, ILoadingStream* stream, ZoneProbe& probe) override;
 };
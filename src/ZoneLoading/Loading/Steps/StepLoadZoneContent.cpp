@@ -1,6 +1,7 @@
 #include "StepLoadZoneContent.h"
 
 #include "Zone/Stream/Impl/XBlockInputStream.h"
+#include "ZoneLoading.h"
 
 #include <cassert>
 
@@ -18,8 +19,24 @@ StepLoadZoneContent::StepLoadZoneContent(std::unique_ptr<IContentLoadingEntryPoi
 void StepLoadZoneContent::PerformStep(ZoneLoader* zoneLoader, ILoadingStream* stream)
 {
     auto* inputStream = new XBlockInputStream(zoneLoader->m_blocks, stream, m_offset_block_bit_count, m_insert_block);
+    if (ZoneLoading::Configuration.HashAssetContent)
+        inputStream->EnableContentHashing();
+
+    if (ZoneLoading::Configuration.RecordAssetOffsets)
+    {
+        m_zone->m_asset_offset_index = std::make_unique<ZoneAssetOffsetIndex>();
+        inputStream->EnableAssetOffsetRecording(m_zone->m_asset_offset_index.get());
+    }
 
     m_content_loader->Load(m_zone, inputStream);
 
     delete inputStream;
 }
+
+bool StepLoadZoneContent::ProbeStep(ZoneLoader* zoneLoader, ILoadingStream* stream, ZoneProbe& probe)
+{
+    m_content_loader->Probe(stream, probe);
+
+    // Everything after the asset list requires the blocks to be allocated
+    return false;
+}
@@ -16,4 +16,5 @@ public:
     StepLoadZoneContent(std::unique_ptr<IContentLoadingEntryPoint> entryPoint, Zone* zone, int offsetBlockBitCount, block_t insertBlock);
 
     void PerformStep(ZoneLoader* zoneLoader, ILoadingStream* stream) override;
+    bool ProbeStep(ZoneLoader* zoneLoader, ILoadingStream* stream, ZoneProbe& probe) override;
 };
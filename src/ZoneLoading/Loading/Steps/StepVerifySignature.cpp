@@ -6,14 +6,16 @@
 
 StepVerifySignature::StepVerifySignature(std::unique_ptr<IPublicKeyAlgorithm> signatureAlgorithm,
                                          ISignatureProvider* signatureProvider,
-                                         ICapturedDataProvider* signatureDataProvider)
+                                         ICapturedDataProvider* signatureDataProvider,
+                                         const bool verifyInBackground)
     : m_algorithm(std::move(signatureAlgorithm)),
       m_signature_provider(signatureProvider),
-      m_signature_data_provider(signatureDataProvider)
+      m_signature_data_provider(signatureDataProvider),
+      m_verify_in_background(verifyInBackground)
 {
 }
 
-void StepVerifySignature::PerformStep(ZoneLoader* zoneLoader, ILoadingStream* stream)
+bool StepVerifySignature::Verify() const
 {
     assert(m_algorithm != nullptr);
     assert(m_signature_provider != nullptr);
@@ -27,8 +29,31 @@ void StepVerifySignature::PerformStep(ZoneLoader* zoneLoader, ILoadingStream* st
     size_t signatureDataSize;
     m_signature_data_provider->GetCapturedData(&signatureData, &signatureDataSize);
 
-    if (!m_algorithm->Verify(signatureData, signatureDataSize, signature, signatureSize))
+    return m_algorithm->Verify(signatureData, signatureDataSize, signature, signatureSize);
+}
+
+void StepVerifySignature::PerformStep(ZoneLoader* zoneLoader, ILoadingStream* stream)
+{
+    if (m_verify_in_background)
     {
-        throw InvalidSignatureException();
+        zoneLoader->RunInBackground(
+            [this]
+            {
+                if (!Verify())
+                    throw InvalidSignatureException();
+            });
+        return;
     }
+
+    if (!Verify())
+        throw InvalidSignatureException();
+}
+
+bool StepVerifySignature::ProbeStep(ZoneLoader* zoneLoader, ILoadingStream* stream, ZoneProbe& probe)
+{
+    // Probing usually stops before the zone is complete so the signature is always verified right away
+    if (!Verify())
+        throw InvalidSignatureException();
+
+    return true;
 }
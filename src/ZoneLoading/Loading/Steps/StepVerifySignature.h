@@ -5,16 +5,30 @@
 #include "Loading/ISignatureProvider.h"
 #include "Utils/ICapturedDataProvider.h"
 
+#include <memory>
+
 class StepVerifySignature final : public ILoadingStep
 {
     std::unique_ptr<IPublicKeyAlgorithm> m_algorithm;
     ISignatureProvider* m_signature_provider;
     ICapturedDataProvider* m_signature_data_provider;
+    bool m_verify_in_background;
+
+    bool Verify() const;
 
 public:
+    /**
+     * \brief Creates a step that verifies a signature of previously loaded data.
+     * \param signatureAlgorithm The algorithm to verify the signature with.
+     * \param signatureProvider The provider of the signature.
+     * \param signatureDataProvider The provider of the signed data. Must not change anymore once the step is performed.
+     * \param verifyInBackground Whether to verify the signature on the job system while the following steps load the zone.
+     * The zone loader checks the result once all steps were performed.
+     */
     StepVerifySignature(std::unique_ptr<IPublicKeyAlgorithm> signatureAlgorithm,
                         ISignatureProvider* signatureProvider,
-                        ICapturedDataProvider* signatureDataProvider);
+                        ICapturedDataProvider* signatureDataProvider,
+                        bool verifyInBackground = false);
     ~StepVerifySignature() override = default;
     StepVerifySignature(const StepVerifySignature& other) = delete;
     StepVerifySignature(StepVerifySignature&& other) noexcept = default;
@@ -22,4 +36,5 @@ public:
     StepVerifySignature& operator=(StepVerifySignature&& other) noexcept = default;
 
     void PerformStep(ZoneLoader* zoneLoader, ILoadingStream* stream) override;
+    bool ProbeStep(ZoneLoader* zoneLoader, ILoadingStream* stream, ZoneProbe& probe) override;
 };
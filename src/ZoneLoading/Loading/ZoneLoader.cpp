@@ -1,13 +1,16 @@
 #include "ZoneLoader.h"
 
 #include "Exception/LoadingException.h"
-#include "LoadingFileStream.h"
+#include "Utils/Tracing.h"
+#include "ZoneLoading.h"
 
 #include <algorithm>
 
 ZoneLoader::ZoneLoader(std::unique_ptr<Zone> zone)
     : m_processor_chain_dirty(false),
-      m_zone(std::move(zone))
+      m_zone(std::move(zone)),
+      m_is_signed(false),
+      m_is_encrypted(false)
 {
 }
 
@@ -26,6 +29,27 @@ ILoadingStream* ZoneLoader::BuildLoadingChain(ILoadingStream* rootStream)
     return currentStream;
 }
 
+void ZoneLoader::ReleaseStreamProcessors()
+{
+    // Processors may still access the root stream from background threads and must therefore be released before it goes out of scope.
+    // They are released from the end of the chain so that no processor is destroyed while a later one may still read from it.
+    while (!m_processors.empty())
+        m_processors.pop_back();
+    m_processor_chain_dirty = true;
+}
+
+void ZoneLoader::AbandonBackgroundJobs()
+{
+    // Loading already failed, so only the jobs reading the stream processors have to end before they are released
+    try
+    {
+        m_background_jobs.Wait();
+    }
+    catch (...)
+    {
+    }
+}
+
 void ZoneLoader::AddXBlock(std::unique_ptr<XBlock> block)
 {
     m_blocks.push_back(block.get());
@@ -63,32 +87,91 @@ void ZoneLoader::RemoveStreamProcessor(StreamProcessor* streamProcessor)
     }
 }
 
-std::unique_ptr<Zone> ZoneLoader::LoadZone(std::istream& stream)
+void ZoneLoader::RunInBackground(JobSystem::job_t job)
+{
+    m_background_jobs.Run(std::move(job));
+}
+
+std::unique_ptr<Zone> ZoneLoader::LoadZone(ILoadingStream& stream)
 {
-    LoadingFileStream fileStream(stream);
-    auto* endStream = BuildLoadingChain(&fileStream);
+    TRACE_SCOPE("ZoneLoading", "LoadZone " + m_zone->m_name);
+
+    auto* endStream = BuildLoadingChain(&stream);
 
     try
     {
         for (const auto& step : m_steps)
         {
+            TRACE_SCOPE("ZoneLoading", tracing::Tracer::GetDynamicTypeName(*step));
             step->PerformStep(this, endStream);
 
             if (m_processor_chain_dirty)
             {
-                endStream = BuildLoadingChain(&fileStream);
+                endStream = BuildLoadingChain(&stream);
             }
         }
+
+        {
+            TRACE_SCOPE("ZoneLoading", "WaitForBackgroundJobs");
+            m_background_jobs.Wait();
+        }
+
+        for (const auto& step : m_steps)
+            step->FinishStep(this);
     }
     catch (LoadingException& e)
     {
         const auto detailedMessage = e.DetailedMessage();
         printf("Loading fastfile failed: %s\n", detailedMessage.c_str());
 
+        AbandonBackgroundJobs();
+        ReleaseStreamProcessors();
         return nullptr;
     }
 
-    m_zone->Register();
+    ReleaseStreamProcessors();
+    if (ZoneLoading::Configuration.RegisterLoadedZones)
+        m_zone->Register();
 
     return std::move(m_zone);
 }
+
+bool ZoneLoader::ProbeZone(ILoadingStream& stream, ZoneProbe& probe)
+{
+    TRACE_SCOPE("ZoneLoading", "ProbeZone " + m_zone->m_name);
+
+    probe.m_name = m_zone->m_name;
+    probe.m_game = m_zone->m_game;
+    probe.m_is_signed = m_is_signed;
+    probe.m_is_encrypted = m_is_encrypted;
+
+    auto* endStream = BuildLoadingChain(&stream);
+
+    try
+    {
+        for (const auto& step : m_steps)
+        {
+            if (!step->ProbeStep(this, endStream, probe))
+                break;
+
+            if (m_processor_chain_dirty)
+            {
+                endStream = BuildLoadingChain(&stream);
+            }
+        }
+
+        m_background_jobs.Wait();
+    }
+    catch (LoadingException& e)
+    {
+        const auto detailedMessage = e.DetailedMessage();
+        printf("Probing fastfile failed: %s\n", detailedMessage.c_str());
+
+        AbandonBackgroundJobs();
+        ReleaseStreamProcessors();
+        return false;
+    }
+
+    ReleaseStreamProcessors();
+    return true;
+}
@@ -2,10 +2,11 @@
 
 #include "ILoadingStep.h"
 #include "StreamProcessor.h"
+#include "Utils/JobSystem.h"
+#include "ZoneProbe.h"
 #include "Zone/XBlock.h"
 #include "Zone/Zone.h"
 
-#include <istream>
 #include <memory>
 #include <vector>
 
@@ -20,11 +21,20 @@ class ZoneLoader
 
     std::unique_ptr<Zone> m_zone;
 
+    // Declared after the steps and processors so background jobs finish before the data they read is destroyed
+    JobSystem::TaskGroup m_background_jobs;
+
     ILoadingStream* BuildLoadingChain(ILoadingStream* rootStream);
+    void ReleaseStreamProcessors();
+    void AbandonBackgroundJobs();
 
 public:
     std::vector<XBlock*> m_blocks;
 
+    // Set by the factory for probing the zone
+    bool m_is_signed;
+    bool m_is_encrypted;
+
     explicit ZoneLoader(std::unique_ptr<Zone> zone);
 
     void AddXBlock(std::unique_ptr<XBlock> block);
@@ -33,5 +43,21 @@ public:
 
     void RemoveStreamProcessor(StreamProcessor* streamProcessor);
 
-    std::unique_ptr<Zone> LoadZone(std::istream& stream);
+    /**
+     * \brief Runs work of a step on the shared job system while the following steps continue loading the zone.
+     * All background jobs are finished after the last step was performed and before any step is finished.
+     * A \c LoadingException thrown by a job fails loading the zone.
+     * \param job The job to run. May only read data that the following steps do not modify anymore.
+     */
+    void RunInBackground(JobSystem::job_t job);
+
+    std::unique_ptr<Zone> LoadZone(ILoadingStream& stream);
+
+    /**
+     * \brief Performs the loading steps until the counts of the asset list are known without allocating any block or loading any asset.
+     * \param stream The stream of the zone file positioned after the zone header.
+     * \param probe The metadata of the zone to fill.
+     * \return \c true if the zone could be probed, otherwise \c false.
+     */
+    bool ProbeZone(ILoadingStream& stream, ZoneProbe& probe);
 };
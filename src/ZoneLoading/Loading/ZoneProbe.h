@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Game/IGame.h"
+#include "Zone/XBlock.h"
+#include "Zone/ZoneTypes.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * \brief Metadata of a zone that is read from its header and the start of its content without allocating its blocks or loading any asset.
+ */
+class ZoneProbe
+{
+public:
+    class Block
+    {
+    public:
+        std::string m_name;
+        XBlock::Type m_type;
+        xblock_size_t m_size;
+    };
+
+    std::string m_name;
+    IGame* m_game = nullptr;
+    uint32_t m_version = 0u;
+    bool m_is_signed = false;
+    bool m_is_encrypted = false;
+    std::vector<Block> m_blocks;
+    unsigned m_script_string_count = 0u;
+    unsigned m_asset_count = 0u;
+};
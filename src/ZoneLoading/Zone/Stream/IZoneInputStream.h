@@ -1,9 +1,12 @@
 #pragma once
 
+#include "Utils/ClassUtils.h"
 #include "Zone/Stream/IZoneStream.h"
+#include "Zone/ZoneTypes.h"
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
 
 class IZoneInputStream : public IZoneStream
 {
@@ -44,15 +47,49 @@ public:
 
     virtual void* ConvertOffsetToPointer(const void* offset) = 0;
 
-    template<typename T> T* ConvertOffsetToPointer(T* offset)
+    // Takes the loaded member by reference to leave its offset, which depends on where the data it points to was placed in the zone, out of the content hash
+    template<typename T> T* ConvertOffsetToPointer(T* const& offset)
     {
+        ExcludeFromContentHash(&offset, sizeof(offset));
         return static_cast<T*>(ConvertOffsetToPointer(static_cast<const void*>(offset)));
     }
 
     virtual void* ConvertOffsetToAlias(const void* offset) = 0;
 
-    template<typename T> T* ConvertOffsetToAlias(T* offset)
+    /**
+     * \brief Returns the amount of bytes that were loaded into all blocks that are not temporary so far.
+     */
+    _NODISCARD virtual size_t GetLoadedSize() const = 0;
+
+    /**
+     * \brief Marks the start of the data of the next asset.
+     * Starts a new content hash that covers all data loaded from the zone from now on and remembers where the asset starts when recording asset offsets.
+     */
+    virtual void BeginAsset() = 0;
+
+    /**
+     * \brief Returns the hash of all data that was loaded from the zone since the last call to \c BeginAsset or \c 0 if content hashing is disabled.
+     */
+    _NODISCARD virtual uint64_t GetContentHash() const = 0;
+
+    /**
+     * \brief Hashes loaded data of the current asset as if it was zero, like offsets of pointers that differ between zones with the same asset.
+     * Does nothing if content hashing is disabled or the data was not loaded for the current asset.
+     * \param data The loaded data to exclude.
+     * \param size The size of the data to exclude.
+     */
+    virtual void ExcludeFromContentHash(const void* data, size_t size) = 0;
+
+    /**
+     * \brief Records where the data of the asset that was loaded since the last call to \c BeginAsset is located. Does nothing when not recording asset offsets.
+     * \param assetType The type of the asset.
+     * \param assetName The name of the asset.
+     */
+    virtual void RecordAssetOffset(asset_type_t assetType, const std::string& assetName) = 0;
+
+    template<typename T> T* ConvertOffsetToAlias(T* const& offset)
     {
+        ExcludeFromContentHash(&offset, sizeof(offset));
         return static_cast<T*>(ConvertOffsetToAlias(static_cast<const void*>(offset)));
     }
 };
@@ -1,13 +1,31 @@
 #include "XBlockInputStream.h"
 
 #include "Loading/Exception/BlockOverflowException.h"
-#include "Loading/Exception/InvalidOffsetBlockException.h"
-#include "Loading/Exception/InvalidOffsetBlockOffsetException.h"
 #include "Loading/Exception/OutOfBlockBoundsException.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
+namespace
+{
+    constexpr uint64_t CONTENT_HASH_SEED = 0x27D4EB2F165667C5u;
+    constexpr uint64_t CONTENT_HASH_PRIME_1 = 0x9E3779B185EBCA87u;
+    constexpr uint64_t CONTENT_HASH_PRIME_2 = 0xC2B2AE3D27D4EB4Fu;
+
+    // Every byte is hashed on its own together with its position in the asset and the results are summed up.
+    // This allows replacing the contribution of single bytes after they were hashed.
+    uint64_t HashByte(const size_t position, const uint8_t value)
+    {
+        auto hash = (static_cast<uint64_t>(position) << 8u | value) * CONTENT_HASH_PRIME_1;
+        hash ^= hash >> 32u;
+        hash *= CONTENT_HASH_PRIME_2;
+        hash ^= hash >> 29u;
+
+        return hash;
+    }
+} // namespace
+
 XBlockInputStream::XBlockInputStream(std::vector<XBlock*>& blocks, ILoadingStream* stream, const int blockBitCount, const block_t insertBlock)
     : m_blocks(blocks)
 {
@@ -17,6 +35,14 @@ XBlockInputStream::XBlockInputStream(std::vector<XBlock*>& blocks, ILoadingStrea
     m_block_offsets = new size_t[blockCount]{0};
 
     m_block_bit_count = blockBitCount;
+    m_hash_content = false;
+    m_content_hash = CONTENT_HASH_SEED;
+    m_content_position = 0u;
+    m_last_loaded_range = m_loaded_ranges.end();
+
+    m_stream_offset = 0u;
+    m_asset_offset_index = nullptr;
+    m_asset_start_offset = 0u;
 
     assert(insertBlock >= 0 && insertBlock < static_cast<block_t>(blocks.size()));
     m_insert_block = blocks[insertBlock];
@@ -24,134 +50,134 @@ XBlockInputStream::XBlockInputStream(std::vector<XBlock*>& blocks, ILoadingStrea
 
 XBlockInputStream::~XBlockInputStream()
 {
+    for (auto* block : m_blocks)
+        block->m_used_size = std::max(block->m_used_size, m_block_offsets[block->m_index]);
+
     delete[] m_block_offsets;
     m_block_offsets = nullptr;
 
     assert(m_block_stack.empty());
 }
 
-void XBlockInputStream::Align(const unsigned align)
+void XBlockInputStream::EnableContentHashing()
 {
-    assert(!m_block_stack.empty());
-
-    if (align > 0)
-    {
-        const block_t blockIndex = m_block_stack.top()->m_index;
-        m_block_offsets[blockIndex] = (m_block_offsets[blockIndex] + align - 1) / align * align;
-    }
+    m_hash_content = true;
+    m_content_hash = CONTENT_HASH_SEED;
+    m_content_position = 0u;
+    m_loaded_ranges.clear();
+    m_last_loaded_range = m_loaded_ranges.end();
 }
 
-void XBlockInputStream::PushBlock(const block_t block)
+void XBlockInputStream::HashContent(const void* data, const size_t size)
 {
-    assert(block >= 0 && block < static_cast<block_t>(m_blocks.size()));
-
-    XBlock* newBlock = m_blocks[block];
-
-    assert(newBlock->m_index == block);
+    if (size == 0u)
+        return;
 
-    m_block_stack.push(newBlock);
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    auto hash = m_content_hash;
+    for (auto offset = 0u; offset < size; offset++)
+        hash += HashByte(m_content_position + offset, bytes[offset]);
+    m_content_hash = hash;
 
-    if (newBlock->m_type == XBlock::Type::BLOCK_TYPE_TEMP)
+    // Most loads are single members that directly follow the previous load, so they extend its range
+    const auto address = reinterpret_cast<uintptr_t>(data);
+    if (m_last_loaded_range != m_loaded_ranges.end())
     {
-        m_temp_offsets.push(m_block_offsets[newBlock->m_index]);
+        auto& [lastAddress, lastRange] = *m_last_loaded_range;
+        if (lastAddress + lastRange.m_size == address && lastRange.m_content_position + lastRange.m_size == m_content_position)
+        {
+            lastRange.m_size += size;
+            m_content_position += size;
+            return;
+        }
     }
+
+    // Temp blocks load data of the same asset to the same addresses multiple times, the latest load is the one that is converted afterwards
+    m_last_loaded_range = m_loaded_ranges.insert_or_assign(address, LoadedRange{size, m_content_position}).first;
+    m_content_position += size;
 }
 
-block_t XBlockInputStream::PopBlock()
+void XBlockInputStream::ExcludeFromContentHash(const void* data, const size_t size)
 {
-    assert(!m_block_stack.empty());
-
-    if (m_block_stack.empty())
-        return -1;
-
-    const XBlock* poppedBlock = m_block_stack.top();
+    if (!m_hash_content)
+        return;
 
-    m_block_stack.pop();
+    const auto address = reinterpret_cast<uintptr_t>(data);
+    auto range = m_loaded_ranges.upper_bound(address);
+    if (range == m_loaded_ranges.begin())
+        return;
+    --range;
 
-    // If the temp block is not used anymore right now, reset it to the buffer start since as the name suggests, the data inside is temporary.
-    if (poppedBlock->m_type == XBlock::Type::BLOCK_TYPE_TEMP)
-    {
-        m_block_offsets[poppedBlock->m_index] = m_temp_offsets.top();
-        m_temp_offsets.pop();
-    }
+    if (address + size > range->first + range->second.m_size)
+        return;
 
-    return poppedBlock->m_index;
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    const auto position = range->second.m_content_position + (address - range->first);
+    for (auto offset = 0u; offset < size; offset++)
+        m_content_hash += HashByte(position + offset, 0u) - HashByte(position + offset, bytes[offset]);
 }
 
-void* XBlockInputStream::Alloc(const unsigned align)
+void XBlockInputStream::EnableAssetOffsetRecording(ZoneAssetOffsetIndex* index)
 {
-    assert(!m_block_stack.empty());
-
-    if (m_block_stack.empty())
-        return nullptr;
-
-    XBlock* block = m_block_stack.top();
+    m_asset_offset_index = index;
+}
 
-    Align(align);
+void XBlockInputStream::BeginAsset()
+{
+    m_content_hash = CONTENT_HASH_SEED;
+    m_content_position = 0u;
+    m_loaded_ranges.clear();
+    m_last_loaded_range = m_loaded_ranges.end();
 
-    if (m_block_offsets[block->m_index] > block->m_buffer_size)
+    if (m_asset_offset_index)
     {
-        throw BlockOverflowException(block);
+        m_asset_start_offset = m_stream_offset;
+        m_asset_start_block_offsets.assign(m_block_offsets, m_block_offsets + m_blocks.size());
     }
-
-    return &block->m_buffer[m_block_offsets[block->m_index]];
 }
 
-void XBlockInputStream::LoadDataRaw(void* dst, const size_t size)
+uint64_t XBlockInputStream::GetContentHash() const
 {
-    m_stream->Load(dst, size);
+    if (!m_hash_content)
+        return 0u;
+
+    auto hash = m_content_hash;
+    hash ^= hash >> 29u;
+    hash *= CONTENT_HASH_PRIME_2;
+    hash ^= hash >> 32u;
+
+    // 0 is reserved for data that was not hashed
+    return hash != 0u ? hash : 1u;
 }
 
-void XBlockInputStream::LoadDataInBlock(void* dst, const size_t size)
+void XBlockInputStream::RecordAssetOffset(const asset_type_t assetType, const std::string& assetName)
 {
-    assert(!m_block_stack.empty());
-
-    if (m_block_stack.empty())
+    if (!m_asset_offset_index)
         return;
 
-    XBlock* block = m_block_stack.top();
-
-    if (block->m_buffer > dst || block->m_buffer + block->m_buffer_size < dst)
-    {
-        throw OutOfBlockBoundsException(block);
-    }
-
-    if (static_cast<uint8_t*>(dst) + size > block->m_buffer + block->m_buffer_size)
-    {
-        throw BlockOverflowException(block);
-    }
-
-    // Theoretically ptr should always be at the current block offset.
-    assert(dst == &block->m_buffer[m_block_offsets[block->m_index]]);
+    m_asset_offset_index->m_entries.emplace_back(ZoneAssetOffsetIndex::Entry{
+        assetType, assetName, m_asset_start_offset, m_stream_offset - m_asset_start_offset, m_asset_start_block_offsets});
+}
 
-    switch (block->m_type)
-    {
-    case XBlock::Type::BLOCK_TYPE_TEMP:
-    case XBlock::Type::BLOCK_TYPE_NORMAL:
-        m_stream->Load(dst, size);
-        break;
-
-    case XBlock::Type::BLOCK_TYPE_RUNTIME:
-        memset(dst, 0, size);
-        break;
-
-    case XBlock::Type::BLOCK_TYPE_DELAY:
-        assert(false);
-        break;
-    }
+void XBlockInputStream::LoadDataRaw(void* dst, const size_t size)
+{
+    m_stream->Load(dst, size);
+    m_stream_offset += size;
 
-    IncBlockPos(size);
+    if (m_hash_content)
+        HashContent(dst, size);
 }
 
-void XBlockInputStream::IncBlockPos(const size_t size)
+size_t XBlockInputStream::GetLoadedSize() const
 {
-    assert(!m_block_stack.empty());
-
-    if (m_block_stack.empty())
-        return;
+    size_t loadedSize = 0u;
+    for (const auto* block : m_blocks)
+    {
+        if (block->m_type != XBlock::Type::BLOCK_TYPE_TEMP)
+            loadedSize += m_block_offsets[block->m_index];
+    }
 
-    XBlock* block = m_block_stack.top();
-    m_block_offsets[block->m_index] += size;
+    return loadedSize;
 }
 
 void XBlockInputStream::LoadNullTerminated(void* dst)
@@ -184,72 +210,11 @@ void XBlockInputStream::LoadNullTerminated(void* dst)
         block->m_buffer[offset++] = byte;
     } while (byte != 0);
 
-    m_block_offsets[block->m_index] = offset;
-}
-
-void** XBlockInputStream::InsertPointer()
-{
-    m_block_stack.push(m_insert_block);
-
-    Align(alignof(void*));
-
-    if (m_block_offsets[m_insert_block->m_index] + sizeof(void*) > m_insert_block->m_buffer_size)
-    {
-        throw BlockOverflowException(m_insert_block);
-    }
-
-    void** ptr = reinterpret_cast<void**>(&m_insert_block->m_buffer[m_block_offsets[m_insert_block->m_index]]);
-
-    IncBlockPos(sizeof(void*));
+    const auto loadedSize = offset - (static_cast<uint8_t*>(dst) - block->m_buffer);
+    m_stream_offset += loadedSize;
 
-    m_block_stack.pop();
+    if (m_hash_content)
+        HashContent(dst, loadedSize);
 
-    return ptr;
-}
-
-void* XBlockInputStream::ConvertOffsetToPointer(const void* offset)
-{
-    // -1 because otherwise Block 0 Offset 0 would be just 0 which is already used to signalize a nullptr.
-    // So all offsets are moved by 1.
-    auto offsetInt = reinterpret_cast<uintptr_t>(offset) - 1;
-
-    const block_t blockNum = offsetInt >> (sizeof(offsetInt) * 8 - m_block_bit_count);
-    const size_t blockOffset = offsetInt & (UINTPTR_MAX >> m_block_bit_count);
-
-    if (blockNum < 0 || blockNum >= static_cast<block_t>(m_blocks.size()))
-    {
-        throw InvalidOffsetBlockException(blockNum);
-    }
-
-    XBlock* block = m_blocks[blockNum];
-
-    if (block->m_buffer_size <= blockOffset)
-    {
-        throw InvalidOffsetBlockOffsetException(block, blockOffset);
-    }
-
-    return &block->m_buffer[blockOffset];
-}
-
-void* XBlockInputStream::ConvertOffsetToAlias(const void* offset)
-{
-    // For details see ConvertOffsetToPointer
-    auto offsetInt = reinterpret_cast<uintptr_t>(offset) - 1;
-
-    const block_t blockNum = offsetInt >> (sizeof(offsetInt) * 8 - m_block_bit_count);
-    const size_t blockOffset = offsetInt & (UINTPTR_MAX >> m_block_bit_count);
-
-    if (blockNum < 0 || blockNum >= static_cast<block_t>(m_blocks.size()))
-    {
-        throw InvalidOffsetBlockException(blockNum);
-    }
-
-    XBlock* block = m_blocks[blockNum];
-
-    if (block->m_buffer_size <= blockOffset + sizeof(void*))
-    {
-        throw InvalidOffsetBlockOffsetException(block, blockOffset);
-    }
-
-    return *reinterpret_cast<void**>(&block->m_buffer[blockOffset]);
+    m_block_offsets[block->m_index] = offset;
 }
@@ -1,12 +1,25 @@
 #pragma once
 
+#include "Loading/Exception/BlockOverflowException.h"
+#include "Loading/Exception/InvalidOffsetBlockException.h"
+#include "Loading/Exception/InvalidOffsetBlockOffsetException.h"
+#include "Loading/Exception/OutOfBlockBoundsException.h"
 #include "Loading/ILoadingStream.h"
 #include "Zone/Stream/IZoneInputStream.h"
 #include "Zone/XBlock.h"
+#include "Zone/ZoneAssetOffsetIndex.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <map>
 #include <stack>
 #include <vector>
 
+/**
+ * \brief The zone input stream that loads zone content into its XBlocks.
+ * The methods that are called for every loaded member are defined in this header for generated loaders that know this concrete type to be able to inline them.
+ */
 class XBlockInputStream final : public IZoneInputStream
 {
     std::vector<XBlock*>& m_blocks;
@@ -19,12 +32,46 @@ class XBlockInputStream final : public IZoneInputStream
     int m_block_bit_count;
     XBlock* m_insert_block;
 
+    class LoadedRange
+    {
+    public:
+        size_t m_size;
+        size_t m_content_position;
+    };
+
+    bool m_hash_content;
+    uint64_t m_content_hash;
+
+    // The amount of bytes hashed since the current asset started and where they were loaded to, to be able to exclude data from the hash later on
+    size_t m_content_position;
+    std::map<uintptr_t, LoadedRange> m_loaded_ranges;
+    std::map<uintptr_t, LoadedRange>::iterator m_last_loaded_range;
+
+    // The amount of bytes loaded from the zone content so far
+    size_t m_stream_offset;
+
+    ZoneAssetOffsetIndex* m_asset_offset_index;
+    size_t m_asset_start_offset;
+    std::vector<size_t> m_asset_start_block_offsets;
+
     void Align(unsigned align);
+    void HashContent(const void* data, size_t size);
 
 public:
     XBlockInputStream(std::vector<XBlock*>& blocks, ILoadingStream* stream, int blockBitCount, block_t insertBlock);
     ~XBlockInputStream() override;
 
+    /**
+     * \brief Hashes all data that is loaded from the zone from now on to be able to tell which assets changed between zones.
+     */
+    void EnableContentHashing();
+
+    /**
+     * \brief Records where the data of every asset is located in the zone content from now on.
+     * \param index The index to add the offsets of the assets to.
+     */
+    void EnableAssetOffsetRecording(ZoneAssetOffsetIndex* index);
+
     void PushBlock(block_t block) override;
     block_t PopBlock() override;
 
@@ -39,4 +86,245 @@ public:
 
     void* ConvertOffsetToPointer(const void* offset) override;
     void* ConvertOffsetToAlias(const void* offset) override;
+
+    _NODISCARD size_t GetLoadedSize() const override;
+
+    void BeginAsset() override;
+    _NODISCARD uint64_t GetContentHash() const override;
+    void ExcludeFromContentHash(const void* data, size_t size) override;
+    void RecordAssetOffset(asset_type_t assetType, const std::string& assetName) override;
+
+    // The helpers of the interface are hidden by the overrides above and need to be repeated to be usable with the concrete type
+
+    template<typename T> T* Alloc(const unsigned align)
+    {
+        return static_cast<T*>(Alloc(align));
+    }
+
+    template<typename T> void Load(T* dst)
+    {
+        LoadDataInBlock(const_cast<void*>(reinterpret_cast<const void*>(dst)), sizeof(T));
+    }
+
+    template<typename T> void Load(T* dst, const uint32_t count)
+    {
+        LoadDataInBlock(const_cast<void*>(reinterpret_cast<const void*>(dst)), count * sizeof(T));
+    }
+
+    template<typename T> void LoadPartial(T* dst, const size_t size)
+    {
+        LoadDataInBlock(const_cast<void*>(reinterpret_cast<const void*>(dst)), size);
+    }
+
+    template<typename T> T** InsertPointer()
+    {
+        return reinterpret_cast<T**>(InsertPointer());
+    }
+
+    template<typename T> T* ConvertOffsetToPointer(T* const& offset)
+    {
+        if (m_hash_content)
+            ExcludeFromContentHash(&offset, sizeof(offset));
+        return static_cast<T*>(ConvertOffsetToPointer(static_cast<const void*>(offset)));
+    }
+
+    template<typename T> T* ConvertOffsetToAlias(T* const& offset)
+    {
+        if (m_hash_content)
+            ExcludeFromContentHash(&offset, sizeof(offset));
+        return static_cast<T*>(ConvertOffsetToAlias(static_cast<const void*>(offset)));
+    }
 };
+
+inline void XBlockInputStream::Align(const unsigned align)
+{
+    assert(!m_block_stack.empty());
+
+    if (align > 0)
+    {
+        const block_t blockIndex = m_block_stack.top()->m_index;
+        m_block_offsets[blockIndex] = (m_block_offsets[blockIndex] + align - 1) / align * align;
+    }
+}
+
+inline void XBlockInputStream::PushBlock(const block_t block)
+{
+    assert(block >= 0 && block < static_cast<block_t>(m_blocks.size()));
+
+    XBlock* newBlock = m_blocks[block];
+
+    assert(newBlock->m_index == block);
+
+    m_block_stack.push(newBlock);
+
+    if (newBlock->m_type == XBlock::Type::BLOCK_TYPE_TEMP)
+    {
+        m_temp_offsets.push(m_block_offsets[newBlock->m_index]);
+    }
+}
+
+inline block_t XBlockInputStream::PopBlock()
+{
+    assert(!m_block_stack.empty());
+
+    if (m_block_stack.empty())
+        return -1;
+
+    XBlock* poppedBlock = m_block_stack.top();
+
+    m_block_stack.pop();
+
+    // If the temp block is not used anymore right now, reset it to the buffer start since as the name suggests, the data inside is temporary.
+    if (poppedBlock->m_type == XBlock::Type::BLOCK_TYPE_TEMP)
+    {
+        poppedBlock->m_used_size = std::max(poppedBlock->m_used_size, m_block_offsets[poppedBlock->m_index]);
+        m_block_offsets[poppedBlock->m_index] = m_temp_offsets.top();
+        m_temp_offsets.pop();
+    }
+
+    return poppedBlock->m_index;
+}
+
+inline void* XBlockInputStream::Alloc(const unsigned align)
+{
+    assert(!m_block_stack.empty());
+
+    if (m_block_stack.empty())
+        return nullptr;
+
+    XBlock* block = m_block_stack.top();
+
+    Align(align);
+
+    if (m_block_offsets[block->m_index] > block->m_buffer_size)
+    {
+        throw BlockOverflowException(block);
+    }
+
+    return &block->m_buffer[m_block_offsets[block->m_index]];
+}
+
+inline void XBlockInputStream::LoadDataInBlock(void* dst, const size_t size)
+{
+    assert(!m_block_stack.empty());
+
+    if (m_block_stack.empty())
+        return;
+
+    XBlock* block = m_block_stack.top();
+
+    if (block->m_buffer > dst || block->m_buffer + block->m_buffer_size < dst)
+    {
+        throw OutOfBlockBoundsException(block);
+    }
+
+    if (static_cast<uint8_t*>(dst) + size > block->m_buffer + block->m_buffer_size)
+    {
+        throw BlockOverflowException(block);
+    }
+
+    // Theoretically ptr should always be at the current block offset.
+    assert(dst == &block->m_buffer[m_block_offsets[block->m_index]]);
+
+    switch (block->m_type)
+    {
+    case XBlock::Type::BLOCK_TYPE_TEMP:
+    case XBlock::Type::BLOCK_TYPE_NORMAL:
+        m_stream->Load(dst, size);
+        m_stream_offset += size;
+        if (m_hash_content)
+            HashContent(dst, size);
+        break;
+
+    case XBlock::Type::BLOCK_TYPE_RUNTIME:
+        // Runtime blocks are only ever appended to, so a buffer that started out zeroed is still zero here.
+        // Clearing it anyway would make reserved memory take physical pages.
+        if (!block->m_buffer_zero_initialized)
+            memset(dst, 0, size);
+        break;
+
+    case XBlock::Type::BLOCK_TYPE_DELAY:
+        assert(false);
+        break;
+    }
+
+    IncBlockPos(size);
+}
+
+inline void XBlockInputStream::IncBlockPos(const size_t size)
+{
+    assert(!m_block_stack.empty());
+
+    if (m_block_stack.empty())
+        return;
+
+    XBlock* block = m_block_stack.top();
+    m_block_offsets[block->m_index] += size;
+}
+
+inline void** XBlockInputStream::InsertPointer()
+{
+    m_block_stack.push(m_insert_block);
+
+    Align(alignof(void*));
+
+    if (m_block_offsets[m_insert_block->m_index] + sizeof(void*) > m_insert_block->m_buffer_size)
+    {
+        throw BlockOverflowException(m_insert_block);
+    }
+
+    void** ptr = reinterpret_cast<void**>(&m_insert_block->m_buffer[m_block_offsets[m_insert_block->m_index]]);
+
+    IncBlockPos(sizeof(void*));
+
+    m_block_stack.pop();
+
+    return ptr;
+}
+
+inline void* XBlockInputStream::ConvertOffsetToPointer(const void* offset)
+{
+    // -1 because otherwise Block 0 Offset 0 would be just 0 which is already used to signalize a nullptr.
+    // So all offsets are moved by 1.
+    auto offsetInt = reinterpret_cast<uintptr_t>(offset) - 1;
+
+    const block_t blockNum = offsetInt >> (sizeof(offsetInt) * 8 - m_block_bit_count);
+    const size_t blockOffset = offsetInt & (UINTPTR_MAX >> m_block_bit_count);
+
+    if (blockNum < 0 || blockNum >= static_cast<block_t>(m_blocks.size()))
+    {
+        throw InvalidOffsetBlockException(blockNum);
+    }
+
+    XBlock* block = m_blocks[blockNum];
+
+    if (block->m_buffer_size <= blockOffset)
+    {
+        throw InvalidOffsetBlockOffsetException(block, blockOffset);
+    }
+
+    return &block->m_buffer[blockOffset];
+}
+
+inline void* XBlockInputStream::ConvertOffsetToAlias(const void* offset)
+{
+    // For details see ConvertOffsetToPointer
+    auto offsetInt = reinterpret_cast<uintptr_t>(offset) - 1;
+
+    const block_t blockNum = offsetInt >> (sizeof(offsetInt) * 8 - m_block_bit_count);
+    const size_t blockOffset = offsetInt & (UINTPTR_MAX >> m_block_bit_count);
+
+    if (blockNum < 0 || blockNum >= static_cast<block_t>(m_blocks.size()))
+    {
+        throw InvalidOffsetBlockException(blockNum);
+    }
+
+    XBlock* block = m_blocks[blockNum];
+
+    if (block->m_buffer_size <= blockOffset + sizeof(void*))
+    {
+        throw InvalidOffsetBlockOffsetException(block, blockOffset);
+    }
+
+    return *reinterpret_cast<void**>(&block->m_buffer[blockOffset]);
+}
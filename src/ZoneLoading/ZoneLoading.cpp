@@ -5,6 +5,10 @@
 #include "Game/IW5/ZoneLoaderFactoryIW5.h"
 #include "Game/T5/ZoneLoaderFactoryT5.h"
 #include "Game/T6/ZoneLoaderFactoryT6.h"
+#include "Loading/LoadingFileStream.h"
+#include "Loading/LoadingMemoryStream.h"
+#include "Loading/LoadingProgressStream.h"
+#include "Utils/MemoryMappedFile.h"
 #include "Utils/ObjFileStream.h"
 
 #include <filesystem>
@@ -13,6 +17,8 @@
 
 namespace fs = std::filesystem;
 
+ZoneLoading::Configuration_t ZoneLoading::Configuration;
+
 IZoneLoaderFactory* ZoneLoaderFactories[]{
     new IW3::ZoneLoaderFactory(),
     new IW4::ZoneLoaderFactory(),
@@ -21,43 +27,134 @@ IZoneLoaderFactory* ZoneLoaderFactories[]{
     new T6::ZoneLoaderFactory(),
 };
 
-std::unique_ptr<Zone> ZoneLoading::LoadZone(const std::string& path)
+namespace
 {
-    auto zoneName = fs::path(path).filename().replace_extension("").string();
-    std::ifstream file(path, std::fstream::in | std::fstream::binary);
+    std::unique_ptr<ZoneLoader> CreateLoaderForStream(ILoadingStream& stream, const std::string& path, std::string& zoneName, ZoneHeader& header)
+    {
+        if (stream.Load(&header, sizeof(header)) != sizeof(header))
+        {
+            std::cout << "Failed to read zone header from file '" << path << "'.\n";
+            return nullptr;
+        }
 
-    if (!file.is_open())
+        ZoneLoader* zoneLoader = nullptr;
+        for (auto* factory : ZoneLoaderFactories)
+        {
+            zoneLoader = factory->CreateLoaderForHeader(header, zoneName);
+
+            if (zoneLoader != nullptr)
+                break;
+        }
+
+        if (zoneLoader == nullptr)
+        {
+            printf("Could not create factory for zone '%s'.\n", zoneName.c_str());
+            return nullptr;
+        }
+
+        return std::unique_ptr<ZoneLoader>(zoneLoader);
+    }
+
+    std::unique_ptr<Zone> LoadZoneFromStream(ILoadingStream& stream, const std::string& path, std::string& zoneName)
     {
-        printf("Could not open file '%s'.\n", path.c_str());
-        return nullptr;
+        ZoneHeader header{};
+        const auto zoneLoader = CreateLoaderForStream(stream, path, zoneName, header);
+        if (!zoneLoader)
+            return nullptr;
+
+        return zoneLoader->LoadZone(stream);
     }
 
-    ZoneHeader header{};
-    file.read(reinterpret_cast<char*>(&header), sizeof(header));
-    if (file.gcount() != sizeof(header))
+    bool ProbeZoneFromStream(ILoadingStream& stream, const std::string& path, std::string& zoneName, ZoneProbe& probe)
     {
-        std::cout << "Failed to read zone header from file '" << path << "'.\n";
-        return nullptr;
+        ZoneHeader header{};
+        const auto zoneLoader = CreateLoaderForStream(stream, path, zoneName, header);
+        if (!zoneLoader)
+            return false;
+
+        probe.m_version = header.m_version;
+        return zoneLoader->ProbeZone(stream, probe);
     }
 
-    ZoneLoader* zoneLoader = nullptr;
-    for (auto* factory : ZoneLoaderFactories)
+    std::unique_ptr<Zone> LoadZoneFromStreamWithProgress(ILoadingStream& stream, const std::string& path, std::string& zoneName, const uint64_t totalSize)
     {
-        zoneLoader = factory->CreateLoaderForHeader(header, zoneName);
+        auto* reporter = ZoneLoading::Configuration.ProgressReporter;
+        if (!reporter)
+            return LoadZoneFromStream(stream, path, zoneName);
+
+        const auto reportedZoneName = zoneName;
+        reporter->OnZoneLoadStarted(reportedZoneName, totalSize);
 
-        if (zoneLoader != nullptr)
-            break;
+        LoadingProgressStream progressStream(stream, *reporter, reportedZoneName, totalSize);
+        auto loadedZone = LoadZoneFromStream(progressStream, path, zoneName);
+
+        reporter->OnZoneLoadFinished(reportedZoneName, loadedZone != nullptr, loadedZone ? loadedZone->m_pools->GetTotalAssetCount() : 0u);
+
+        return loadedZone;
+    }
+} // namespace
+
+std::unique_ptr<Zone> ZoneLoading::LoadZone(const std::string& path)
+{
+    auto zoneName = fs::path(path).filename().replace_extension("").string();
+
+    // Regular files are mapped into memory if possible to be able to read them without copying
+    MemoryMappedFile mappedFile;
+    if (fs::is_regular_file(path) && mappedFile.Open(path))
+    {
+        LoadingMemoryStream mappedStream(mappedFile.GetData(), mappedFile.GetSize());
+        return LoadZoneFromStreamWithProgress(mappedStream, path, zoneName, mappedFile.GetSize());
     }
 
-    if (zoneLoader == nullptr)
+    std::ifstream file(path, std::fstream::in | std::fstream::binary);
+
+    if (!file.is_open())
     {
-        printf("Could not create factory for zone '%s'.\n", zoneName.c_str());
+        printf("Could not open file '%s'.\n", path.c_str());
         return nullptr;
     }
 
-    auto loadedZone = zoneLoader->LoadZone(file);
-    delete zoneLoader;
+    std::error_code ec;
+    const auto fileSize = fs::file_size(path, ec);
+
+    LoadingFileStream fileStream(file);
+    auto loadedZone = LoadZoneFromStreamWithProgress(fileStream, path, zoneName, ec ? 0u : fileSize);
 
     file.close();
-    return std::move(loadedZone);
+    return loadedZone;
+}
+
+std::unique_ptr<Zone> ZoneLoading::LoadZone(const std::span<const uint8_t> data, const std::string& zoneName)
+{
+    LoadingMemoryStream memoryStream(data.data(), data.size());
+    return LoadZone(memoryStream, zoneName, data.size());
+}
+
+std::unique_ptr<Zone> ZoneLoading::LoadZone(ILoadingStream& stream, const std::string& zoneName, const uint64_t totalSize)
+{
+    auto loadedZoneName = zoneName;
+    return LoadZoneFromStreamWithProgress(stream, zoneName, loadedZoneName, totalSize);
+}
+
+bool ZoneLoading::ProbeZone(const std::string& path, ZoneProbe& probe)
+{
+    auto zoneName = fs::path(path).filename().replace_extension("").string();
+
+    // Only the start of the file is read so it is not mapped into memory
+    std::ifstream file(path, std::fstream::in | std::fstream::binary);
+
+    if (!file.is_open())
+    {
+        printf("Could not open file '%s'.\n", path.c_str());
+        return false;
+    }
+
+    LoadingFileStream fileStream(file);
+    return ProbeZoneFromStream(fileStream, path, zoneName, probe);
+}
+
+bool ZoneLoading::ProbeZone(ILoadingStream& stream, const std::string& zoneName, ZoneProbe& probe)
+{
+    auto probedZoneName = zoneName;
+    return ProbeZoneFromStream(stream, zoneName, probedZoneName, probe);
 }
@@ -1,10 +1,97 @@
 #pragma once
+#include "Loading/ILoadingStream.h"
+#include "Loading/ZoneProbe.h"
+#include "Utils/ProgressReporter.h"
+#include "Zone/XBlockAllocator.h"
 #include "Zone/Zone.h"
 
+#include <cstdint>
+#include <memory>
+#include <span>
 #include <string>
 
 class ZoneLoading
 {
 public:
+    static class Configuration_t
+    {
+    public:
+        // The amount of worker threads decoding XChunks. A value of 0 uses one worker per stream.
+        unsigned XChunkWorkerCount = 0u;
+
+        // The amount of XChunks that are read ahead per stream. A value of 0 uses the default depth.
+        unsigned XChunkReadAheadDepth = 0u;
+
+        // Whether to decompress zones that are not made of XChunks on a background thread ahead of loading their content.
+        bool DecompressAhead = true;
+
+        // The amount of worker threads hashing authed chunks ahead of time. A value of 0 hashes each chunk when it is reached.
+        unsigned AuthedBlockWorkerCount = 0u;
+
+        // Whether to verify the hashes of authed chunks. Can be disabled for trusted input.
+        bool VerifyAuthedBlocks = true;
+
+        // Whether to verify the signatures of signed zones. Can be disabled for trusted input.
+        bool VerifySignatures = true;
+
+        // Whether to collect the assets, script strings and indirect references used by each loaded asset.
+        // Can be disabled when only the names and types of the assets are needed.
+        bool MarkAssetReferences = true;
+
+        // Whether to hash the zone data each asset is loaded from to be able to tell which assets changed between zones.
+        bool HashAssetContent = false;
+
+        // Whether to record where the data of each asset is located in the inflated zone content in the asset offset index of the zone.
+        bool RecordAssetOffsets = false;
+
+        // Allocates the memory blocks of loaded zones if set, otherwise they are allocated on the heap. Must outlive all loaded zones.
+        IXBlockAllocator* XBlockAllocator = nullptr;
+
+        // Whether to only reserve address space for blocks that are not loaded from the zone file, like runtime blocks, instead of allocating them.
+        // Their memory stays readable and zeroed but only takes physical memory once it is written to.
+        bool ReserveUnloadedBlocks = false;
+
+        // Receives the progress of loading zones if set.
+        progress::IProgressReporter* ProgressReporter = nullptr;
+
+        // Whether to register loaded zones with their game. Can be disabled to load zones concurrently and register them in a fixed order afterwards.
+        bool RegisterLoadedZones = true;
+    } Configuration;
+
     static std::unique_ptr<Zone> LoadZone(const std::string& path);
+
+    /**
+     * \brief Loads a zone that is already in memory without accessing the disk.
+     * \param data The data of the zone file. Must stay valid until the zone is loaded.
+     * \param zoneName The name of the zone, usually the file name without extension.
+     * \return The loaded zone or \c nullptr if it could not be loaded.
+     */
+    static std::unique_ptr<Zone> LoadZone(std::span<const uint8_t> data, const std::string& zoneName);
+
+    /**
+     * \brief Loads a zone from an arbitrary stream that is positioned at the start of the zone file.
+     * \param stream The stream to load the zone from.
+     * \param zoneName The name of the zone, usually the file name without extension.
+     * \param totalSize The size of the zone file in bytes if known, otherwise \c 0. Only used for reporting progress.
+     * \return The loaded zone or \c nullptr if it could not be loaded.
+     */
+    static std::unique_ptr<Zone> LoadZone(ILoadingStream& stream, const std::string& zoneName, uint64_t totalSize = 0u);
+
+    /**
+     * \brief Reads the metadata of a zone like its game, version and block sizes without allocating its blocks or loading any asset.
+     * Only the header and the start of the zone content are read.
+     * \param path The path to the zone file.
+     * \param probe The metadata of the zone.
+     * \return \c true if the zone could be probed, otherwise \c false.
+     */
+    static bool ProbeZone(const std::string& path, ZoneProbe& probe);
+
+    /**
+     * \brief Reads the metadata of a zone from an arbitrary stream that is positioned at the start of the zone file.
+     * \param stream The stream to probe the zone from.
+     * \param zoneName The name of the zone, usually the file name without extension.
+     * \param probe The metadata of the zone.
+     * \return \c true if the zone could be probed, otherwise \c false.
+     */
+    static bool ProbeZone(ILoadingStream& stream, const std::string& zoneName, ZoneProbe& probe);
 };
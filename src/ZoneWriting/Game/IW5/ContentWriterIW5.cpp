@@ -40,7 +40,9 @@
 #include "Game/IW5/XAssets/xanimparts/xanimparts_write_db.h"
 #include "Game/IW5/XAssets/xmodel/xmodel_write_db.h"
 #include "Game/IW5/XAssets/xmodelsurfs/xmodelsurfs_write_db.h"
+#include "Pool/AssetWriteOrder.h"
 #include "Writing/WritingException.h"
+#include "ZoneWriting.h"
 
 #include <cassert>
 #include <sstream>
@@ -77,13 +79,12 @@ void ContentWriter::CreateXAssetList(XAssetList& xAssetList, MemoryManager& memo
         xAssetList.assetCount = static_cast<int>(assetCount);
         xAssetList.assets = memory.Alloc<XAsset>(assetCount);
 
-        const auto end = m_zone->m_pools->end();
         auto index = 0u;
-        for (auto i = m_zone->m_pools->begin(); i != end; ++i)
+        for (const auto* assetInfo : AssetWriteOrder::GetAssets(*m_zone->m_pools, ZoneWriting::Configuration.AssetOrder))
         {
             auto& asset = xAssetList.assets[index++];
-            asset.type = static_cast<XAssetType>((*i)->m_type);
-            asset.header.data = (*i)->m_ptr;
+            asset.type = static_cast<XAssetType>(assetInfo->m_type);
+            asset.header.data = assetInfo->m_ptr;
         }
     }
     else
@@ -194,7 +195,9 @@ void ContentWriter::WriteXAssetArray(const bool atStreamStart, const size_t coun
 
     for (size_t index = 0; index < count; index++)
     {
+        m_stream->BeginAsset(varXAsset->type);
         WriteXAsset(false);
+        m_stream->EndAsset();
         varXAsset++;
     }
 }
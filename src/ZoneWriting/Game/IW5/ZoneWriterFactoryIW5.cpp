@@ -5,7 +5,9 @@
 #include "Game/IW5/IW5.h"
 #include "Game/IW5/ZoneConstantsIW5.h"
 #include "Writing/Processor/OutputProcessorDeflate.h"
+#include "Writing/Processor/OutputProcessorParallelDeflate.h"
 #include "Writing/Steps/StepAddOutputProcessor.h"
+#include "Writing/Steps/StepCountZoneContentSizes.h"
 #include "Writing/Steps/StepWriteTimestamp.h"
 #include "Writing/Steps/StepWriteXBlockSizes.h"
 #include "Writing/Steps/StepWriteZero.h"
@@ -13,6 +15,7 @@
 #include "Writing/Steps/StepWriteZoneContentToMemory.h"
 #include "Writing/Steps/StepWriteZoneHeader.h"
 #include "Writing/Steps/StepWriteZoneSizes.h"
+#include "ZoneWriting.h"
 
 #include <cstring>
 
@@ -67,7 +70,17 @@ public:
         return header;
     }
 
-    std::unique_ptr<ZoneWriter> CreateWriter()
+    std::unique_ptr<ZoneWriter> CreateSizeCountingWriter(ZoneContentSizes& sizes)
+    {
+        SetupBlocks();
+
+        m_writer->AddWritingStep(std::make_unique<StepCountZoneContentSizes>(
+            std::make_unique<ContentWriter>(), m_zone, ZoneConstants::OFFSET_BLOCK_BIT_COUNT, ZoneConstants::INSERT_BLOCK, sizes));
+
+        return std::move(m_writer);
+    }
+
+    std::unique_ptr<ZoneWriter> CreateWriter(const ZoneWritingOptions& options)
     {
         // TODO Support signed fastfiles
         bool isSecure = false;
@@ -88,7 +101,13 @@ public:
         // Write timestamp
         m_writer->AddWritingStep(std::make_unique<StepWriteTimestamp>());
 
-        m_writer->AddWritingStep(std::make_unique<StepAddOutputProcessor>(std::make_unique<OutputProcessorDeflate>()));
+        if (ZoneWriting::Configuration.DeflateWorkerCount > 0u)
+            m_writer->AddWritingStep(std::make_unique<StepAddOutputProcessor>(
+                std::make_unique<OutputProcessorParallelDeflate>(ZoneWriting::Configuration.DeflateWorkerCount,
+                                                                 options.m_compression_level,
+                                                                 static_cast<int>(options.m_compression_strategy))));
+        else
+            m_writer->AddWritingStep(std::make_unique<StepAddOutputProcessor>(std::make_unique<OutputProcessorDeflate>(options.m_compression_level, static_cast<int>(options.m_compression_strategy))));
 
         // Start of the XFile struct
         m_writer->AddWritingStep(std::make_unique<StepWriteZoneSizes>(contentInMemoryPtr));
@@ -107,8 +126,14 @@ bool ZoneWriterFactory::SupportsZone(Zone* zone) const
     return zone->m_game == &g_GameIW5;
 }
 
-std::unique_ptr<ZoneWriter> ZoneWriterFactory::CreateWriter(Zone* zone) const
+std::unique_ptr<ZoneWriter> ZoneWriterFactory::CreateWriter(Zone* zone, const ZoneWritingOptions& options) const
+{
+    Impl impl(zone);
+    return impl.CreateWriter(options);
+}
+
+std::unique_ptr<ZoneWriter> ZoneWriterFactory::CreateSizeCountingWriter(Zone* zone, ZoneContentSizes& sizes) const
 {
     Impl impl(zone);
-    return impl.CreateWriter();
+    return impl.CreateSizeCountingWriter(sizes);
 }
@@ -7,6 +7,7 @@
 #include "Utils/ICapturedDataProvider.h"
 #include "Writing/Processor/OutputProcessorXChunks.h"
 #include "Writing/Steps/StepAddOutputProcessor.h"
+#include "Writing/Steps/StepCountZoneContentSizes.h"
 #include "Writing/Steps/StepAlign.h"
 #include "Writing/Steps/StepRemoveOutputProcessor.h"
 #include "Writing/Steps/StepWriteXBlockSizes.h"
@@ -74,7 +75,10 @@ public:
         return header;
     }
 
-    void AddXChunkProcessor(const bool isEncrypted, ICapturedDataProvider** dataToSignProviderPtr, OutputProcessorXChunks** xChunkProcessorPtr) const
+    void AddXChunkProcessor(const bool isEncrypted,
+                            const ZoneWritingOptions& options,
+                            ICapturedDataProvider** dataToSignProviderPtr,
+                            OutputProcessorXChunks** xChunkProcessorPtr) const
     {
         auto xChunkProcessor = std::make_unique<OutputProcessorXChunks>(
             ZoneConstants::STREAM_COUNT, ZoneConstants::XCHUNK_SIZE, ZoneConstants::XCHUNK_MAX_WRITE_SIZE, ZoneConstants::VANILLA_BUFFER_SIZE);
@@ -82,7 +86,7 @@ public:
             *xChunkProcessorPtr = xChunkProcessor.get();
 
         // Decompress the chunks using zlib
-        xChunkProcessor->AddChunkProcessor(std::make_unique<XChunkProcessorDeflate>());
+        xChunkProcessor->AddChunkProcessor(std::make_unique<XChunkProcessorDeflate>(options.m_compression_level, static_cast<int>(options.m_compression_strategy)));
 
         if (isEncrypted)
         {
@@ -100,7 +104,17 @@ public:
         m_writer->AddWritingStep(std::make_unique<StepAddOutputProcessor>(std::move(xChunkProcessor)));
     }
 
-    std::unique_ptr<ZoneWriter> CreateWriter()
+    std::unique_ptr<ZoneWriter> CreateSizeCountingWriter(ZoneContentSizes& sizes)
+    {
+        SetupBlocks();
+
+        m_writer->AddWritingStep(std::make_unique<StepCountZoneContentSizes>(
+            std::make_unique<ContentWriter>(), m_zone, ZoneConstants::OFFSET_BLOCK_BIT_COUNT, ZoneConstants::INSERT_BLOCK, sizes));
+
+        return std::move(m_writer);
+    }
+
+    std::unique_ptr<ZoneWriter> CreateWriter(const ZoneWritingOptions& options)
     {
         // TODO Support signed fastfiles
         bool isSecure = false;
@@ -119,7 +133,7 @@ public:
         // Setup loading XChunks from the zone from this point on.
         ICapturedDataProvider* dataToSignProvider;
         OutputProcessorXChunks* xChunksProcessor;
-        AddXChunkProcessor(isEncrypted, &dataToSignProvider, &xChunksProcessor);
+        AddXChunkProcessor(isEncrypted, options, &dataToSignProvider, &xChunksProcessor);
 
         // Start of the XFile struct
         // m_writer->AddWritingStep(std::make_unique<StepSkipBytes>(8)); // Skip size and externalSize fields since they are not interesting for us
@@ -129,7 +143,9 @@ public:
         // Start of the zone content
         m_writer->AddWritingStep(std::make_unique<StepWriteZoneContentToFile>(contentInMemoryPtr));
 
-        // Stop writing in XChunks
+        // Stop writing in XChunks.
+        // Chunks are encrypted and hashed per stream on the worker pool of the XChunk processor. Only once it was removed all chunks are processed
+        // and the hash blocks of the data to sign are final, so steps that sign them have to come after this one.
         m_writer->AddWritingStep(std::make_unique<StepRemoveOutputProcessor>(xChunksProcessor));
 
         // Pad ending with zeros like the original linker does it. The game's reader needs it for some reason.
@@ -147,8 +163,14 @@ bool ZoneWriterFactory::SupportsZone(Zone* zone) const
     return zone->m_game == &g_GameT6;
 }
 
-std::unique_ptr<ZoneWriter> ZoneWriterFactory::CreateWriter(Zone* zone) const
+std::unique_ptr<ZoneWriter> ZoneWriterFactory::CreateWriter(Zone* zone, const ZoneWritingOptions& options) const
+{
+    Impl impl(zone);
+    return impl.CreateWriter(options);
+}
+
+std::unique_ptr<ZoneWriter> ZoneWriterFactory::CreateSizeCountingWriter(Zone* zone, ZoneContentSizes& sizes) const
 {
     Impl impl(zone);
-    return impl.CreateWriter();
+    return impl.CreateSizeCountingWriter(sizes);
 }
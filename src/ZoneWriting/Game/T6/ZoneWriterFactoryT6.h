@@ -12,6 +12,7 @@ namespace T6
 
     public:
         _NODISCARD bool SupportsZone(Zone* zone) const override;
-        _NODISCARD std::unique_ptr<ZoneWriter> CreateWriter(Zone* zone) const override;
+        _NODISCARD std::unique_ptr<ZoneWriter> CreateWriter(Zone* zone, const ZoneWritingOptions& options) const override;
+        _NODISCARD std::unique_ptr<ZoneWriter> CreateSizeCountingWriter(Zone* zone, ZoneContentSizes& sizes) const override;
     };
 } // namespace T6
@@ -31,6 +31,10 @@ void AssetWriter::WriteScriptStringArray(const bool atStreamStart, const size_t
 
     assert(varScriptStringWritten != nullptr);
 
+    // Script strings of assets of the written zone already have the correct values
+    if (m_asset->m_zone == m_zone)
+        return;
+
     auto* ptr = varScriptStringWritten;
     for (size_t index = 0; index < count; index++)
     {
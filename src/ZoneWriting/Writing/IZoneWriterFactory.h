@@ -2,7 +2,9 @@
 
 #include "Utils/ClassUtils.h"
 #include "Zone/Zone.h"
+#include "ZoneContentSizes.h"
 #include "ZoneWriter.h"
+#include "ZoneWritingOptions.h"
 
 class IZoneWriterFactory
 {
@@ -15,5 +17,12 @@ public:
     IZoneWriterFactory& operator=(IZoneWriterFactory&& other) noexcept = default;
 
     _NODISCARD virtual bool SupportsZone(Zone* zone) const = 0;
-    _NODISCARD virtual std::unique_ptr<ZoneWriter> CreateWriter(Zone* zone) const = 0;
+    _NODISCARD virtual std::unique_ptr<ZoneWriter> CreateWriter(Zone* zone, const ZoneWritingOptions& options) const = 0;
+
+    /**
+     * \brief Creates a writer that does not output anything and only determines the sizes of the zone content.
+     * \param zone The zone to determine the sizes of.
+     * \param sizes The sizes that are set when the writer runs.
+     */
+    _NODISCARD virtual std::unique_ptr<ZoneWriter> CreateSizeCountingWriter(Zone* zone, ZoneContentSizes& sizes) const = 0;
 };
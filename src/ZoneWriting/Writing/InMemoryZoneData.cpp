@@ -8,8 +8,9 @@ InMemoryZoneData::InMemoryZoneData()
     m_buffers.emplace_back(BUFFER_SIZE);
 }
 
+// Every byte of a buffer is written before it is used so it does not need to be zeroed
 InMemoryZoneData::MemoryBuffer::MemoryBuffer(const size_t size)
-    : m_data(std::make_unique<char[]>(size)),
+    : m_data(std::make_unique_for_overwrite<char[]>(size)),
       m_size(0)
 {
     if (!m_data)
@@ -36,3 +37,15 @@ void* InMemoryZoneData::GetBufferOfSize(const size_t size)
     m_total_size += size;
     return result;
 }
+
+InMemoryZoneData::Position InMemoryZoneData::GetPosition() const
+{
+    return Position{m_buffers.size(), m_buffers.back().m_size, m_total_size};
+}
+
+void InMemoryZoneData::Rewind(const Position& position)
+{
+    m_buffers.erase(m_buffers.begin() + static_cast<std::ptrdiff_t>(position.m_buffer_count), m_buffers.end());
+    m_buffers.back().m_size = position.m_back_buffer_size;
+    m_total_size = position.m_total_size;
+}
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "Utils/ClassUtils.h"
+
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -17,9 +21,25 @@ public:
         explicit MemoryBuffer(size_t size);
     };
 
+    class Position
+    {
+    public:
+        size_t m_buffer_count;
+        size_t m_back_buffer_size;
+        int64_t m_total_size;
+    };
+
     int64_t m_total_size;
     std::vector<MemoryBuffer> m_buffers;
 
     InMemoryZoneData();
     void* GetBufferOfSize(size_t size);
+
+    _NODISCARD Position GetPosition() const;
+
+    /**
+     * \brief Discards all data that was added after the specified position. Pointers to discarded data must not be used anymore.
+     * \param position A position that was returned by \c GetPosition before.
+     */
+    void Rewind(const Position& position);
 };
@@ -17,7 +17,7 @@ class OutputProcessorDeflate::Impl
     size_t m_buffer_size;
 
 public:
-    Impl(OutputProcessorDeflate* baseClass, const size_t bufferSize)
+    Impl(OutputProcessorDeflate* baseClass, const size_t bufferSize, const int compressionLevel, const int compressionStrategy)
         : m_buffer(std::make_unique<uint8_t[]>(bufferSize)),
           m_buffer_size(bufferSize)
     {
@@ -31,7 +31,8 @@ public:
         m_stream.next_out = m_buffer.get();
         m_stream.avail_out = m_buffer_size;
 
-        const int ret = deflateInit(&m_stream, Z_DEFAULT_COMPRESSION);
+        const int ret =
+            deflateInit2(&m_stream, compressionLevel < 0 ? Z_DEFAULT_COMPRESSION : compressionLevel, Z_DEFLATED, MAX_WBITS, 8, compressionStrategy);
 
         if (ret != Z_OK)
         {
@@ -107,12 +108,17 @@ public:
 };
 
 OutputProcessorDeflate::OutputProcessorDeflate()
-    : m_impl(new Impl(this, DEFAULT_BUFFER_SIZE))
+    : m_impl(new Impl(this, DEFAULT_BUFFER_SIZE, Z_DEFAULT_COMPRESSION, Z_DEFAULT_STRATEGY))
 {
 }
 
-OutputProcessorDeflate::OutputProcessorDeflate(const size_t bufferSize)
-    : m_impl(new Impl(this, bufferSize))
+OutputProcessorDeflate::OutputProcessorDeflate(const int compressionLevel, const int compressionStrategy)
+    : m_impl(new Impl(this, DEFAULT_BUFFER_SIZE, compressionLevel, compressionStrategy))
+{
+}
+
+OutputProcessorDeflate::OutputProcessorDeflate(const size_t bufferSize, const int compressionLevel, const int compressionStrategy)
+    : m_impl(new Impl(this, bufferSize, compressionLevel, compressionStrategy))
 {
 }
 
@@ -13,7 +13,14 @@ class OutputProcessorDeflate final : public OutputStreamProcessor
 
 public:
     OutputProcessorDeflate();
-    OutputProcessorDeflate(size_t bufferSize);
+
+    /**
+     * \brief Creates a processor that compresses with the specified zlib compression level and strategy.
+     * \param compressionLevel The zlib compression level. A negative value uses the default level of zlib.
+     * \param compressionStrategy The zlib compression strategy.
+     */
+    OutputProcessorDeflate(int compressionLevel, int compressionStrategy);
+    OutputProcessorDeflate(size_t bufferSize, int compressionLevel, int compressionStrategy);
     ~OutputProcessorDeflate() override;
     OutputProcessorDeflate(const OutputProcessorDeflate& other) = delete;
     OutputProcessorDeflate(OutputProcessorDeflate&& other) noexcept = default;
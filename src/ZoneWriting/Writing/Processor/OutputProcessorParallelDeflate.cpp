@@ -0,0 +1,177 @@
+#include "OutputProcessorParallelDeflate.h"
+
+#include "Writing/WritingException.h"
+
+#include <algorithm>
+#include <cstring>
+#include <zlib.h>
+
+namespace
+{
+    // Header of a zlib stream with a 32KiB window. The compression level it specifies is only informative.
+    constexpr uint8_t ZLIB_HEADER[]{0x78, 0x9C};
+
+    class DeflateStream
+    {
+    public:
+        z_stream m_stream{};
+
+        DeflateStream(const int compressionLevel, const int compressionStrategy)
+        {
+            // Blocks are compressed without zlib header and trailer since those are written once for the whole stream
+            if (deflateInit2(&m_stream, compressionLevel, Z_DEFLATED, -MAX_WBITS, 8, compressionStrategy) != Z_OK)
+                throw WritingException("Initializing deflate failed");
+        }
+
+        ~DeflateStream()
+        {
+            deflateEnd(&m_stream);
+        }
+
+        DeflateStream(const DeflateStream& other) = delete;
+        DeflateStream(DeflateStream&& other) noexcept = delete;
+        DeflateStream& operator=(const DeflateStream& other) = delete;
+        DeflateStream& operator=(DeflateStream&& other) noexcept = delete;
+    };
+} // namespace
+
+OutputProcessorParallelDeflate::OutputProcessorParallelDeflate(const unsigned workerCount, const int compressionLevel, const int compressionStrategy)
+    : m_compression_level(compressionLevel < 0 ? Z_DEFAULT_COMPRESSION : compressionLevel),
+      m_compression_strategy(compressionStrategy),
+      m_max_blocks_in_flight(std::max(workerCount, 1u) * 2u),
+      m_worker_pool(std::max(workerCount, 1u)),
+      m_wrote_header(false),
+      m_adler(static_cast<uint32_t>(adler32(0L, Z_NULL, 0)))
+{
+    m_current_block.reserve(BLOCK_SIZE);
+}
+
+OutputProcessorParallelDeflate::CompressedBlock
+    OutputProcessorParallelDeflate::CompressBlock(const block_data_t& block,
+                                                  const block_data_t& previousBlock,
+                                                  const bool isLastBlock,
+                                                  const int compressionLevel,
+                                                  const int compressionStrategy)
+{
+    DeflateStream deflateStream(compressionLevel, compressionStrategy);
+    auto& stream = deflateStream.m_stream;
+
+    // Data of the previous block is still in the window of the decompressor so it can be referenced like with a single stream
+    if (previousBlock && !previousBlock->empty())
+    {
+        const auto dictionarySize = std::min(previousBlock->size(), DICTIONARY_SIZE);
+        if (deflateSetDictionary(&stream, &(*previousBlock)[previousBlock->size() - dictionarySize], static_cast<uInt>(dictionarySize)) != Z_OK)
+            throw WritingException("Failed to set deflate dictionary.");
+    }
+
+    CompressedBlock result;
+    result.m_input_size = block->size();
+    result.m_adler = static_cast<uint32_t>(adler32(adler32(0L, Z_NULL, 0), block->data(), static_cast<uInt>(block->size())));
+
+    // A sync flush ends the compressed data on a byte boundary with a non-final block so the next block can be appended right after it
+    const auto flush = isLastBlock ? Z_FINISH : Z_SYNC_FLUSH;
+    result.m_data.resize(deflateBound(&stream, static_cast<uLong>(block->size())) + 16u);
+
+    stream.next_in = const_cast<Bytef*>(block->data());
+    stream.avail_in = static_cast<uInt>(block->size());
+    size_t outputSize = 0u;
+    while (true)
+    {
+        stream.next_out = &result.m_data[outputSize];
+        stream.avail_out = static_cast<uInt>(result.m_data.size() - outputSize);
+
+        const auto ret = deflate(&stream, flush);
+        outputSize = result.m_data.size() - stream.avail_out;
+
+        if (ret == Z_STREAM_END || (flush == Z_SYNC_FLUSH && ret == Z_OK && stream.avail_in == 0 && stream.avail_out > 0))
+            break;
+
+        if (ret != Z_OK && ret != Z_BUF_ERROR)
+            throw WritingException("Failed to deflate memory of zone.");
+
+        result.m_data.resize(result.m_data.size() * 2u);
+    }
+
+    result.m_data.resize(outputSize);
+    return result;
+}
+
+void OutputProcessorParallelDeflate::SubmitBlock(const bool isLastBlock)
+{
+    auto block = std::make_shared<const std::vector<uint8_t>>(std::move(m_current_block));
+    m_current_block = std::vector<uint8_t>();
+    m_current_block.reserve(BLOCK_SIZE);
+
+    auto task = std::make_shared<std::packaged_task<CompressedBlock()>>(
+        [block, previousBlock = m_previous_block, isLastBlock, compressionLevel = m_compression_level, compressionStrategy = m_compression_strategy]
+        {
+            return CompressBlock(block, previousBlock, isLastBlock, compressionLevel, compressionStrategy);
+        });
+
+    m_previous_block = std::move(block);
+    m_compressing_blocks.emplace_back(task->get_future());
+    m_worker_pool.Enqueue(
+        [task]
+        {
+            (*task)();
+        });
+
+    while (m_compressing_blocks.size() > m_max_blocks_in_flight)
+        WriteCompressedBlock();
+}
+
+void OutputProcessorParallelDeflate::WriteCompressedBlock()
+{
+    // Blocks are written in the order they were submitted regardless of the order they finished compressing in
+    auto compressingBlock = std::move(m_compressing_blocks.front());
+    m_compressing_blocks.pop_front();
+
+    const auto compressedBlock = compressingBlock.get();
+
+    if (!m_wrote_header)
+    {
+        m_base_stream->Write(ZLIB_HEADER, sizeof(ZLIB_HEADER));
+        m_wrote_header = true;
+    }
+
+    m_base_stream->Write(compressedBlock.m_data.data(), compressedBlock.m_data.size());
+    m_adler = static_cast<uint32_t>(adler32_combine(m_adler, compressedBlock.m_adler, static_cast<z_off_t>(compressedBlock.m_input_size)));
+}
+
+void OutputProcessorParallelDeflate::Write(const void* buffer, const size_t length)
+{
+    const auto* data = static_cast<const uint8_t*>(buffer);
+    auto remaining = length;
+    while (remaining > 0u)
+    {
+        const auto toCopy = std::min(remaining, BLOCK_SIZE - m_current_block.size());
+        m_current_block.insert(m_current_block.end(), data, data + toCopy);
+        data += toCopy;
+        remaining -= toCopy;
+
+        if (m_current_block.size() >= BLOCK_SIZE)
+            SubmitBlock(false);
+    }
+}
+
+void OutputProcessorParallelDeflate::Flush()
+{
+    // The last block is always submitted, even when empty, since it carries the final deflate block
+    SubmitBlock(true);
+
+    while (!m_compressing_blocks.empty())
+        WriteCompressedBlock();
+
+    const uint8_t trailer[]{
+        static_cast<uint8_t>(m_adler >> 24u),
+        static_cast<uint8_t>(m_adler >> 16u),
+        static_cast<uint8_t>(m_adler >> 8u),
+        static_cast<uint8_t>(m_adler),
+    };
+    m_base_stream->Write(trailer, sizeof(trailer));
+}
+
+int64_t OutputProcessorParallelDeflate::Pos()
+{
+    return m_base_stream->Pos();
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Utils/ThreadPool.h"
+#include "Writing/OutputStreamProcessor.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <vector>
+
+/**
+ * \brief Compresses written data to a single zlib stream, compressing independent blocks of it on worker threads.
+ * Every block uses the end of the previous block as dictionary and is ended with a sync flush so the compressed blocks can simply be joined.
+ * The resulting stream is slightly larger than the one of \c OutputProcessorDeflate but can be inflated the same way.
+ */
+class OutputProcessorParallelDeflate final : public OutputStreamProcessor
+{
+    static constexpr size_t BLOCK_SIZE = 0x40000;
+    static constexpr size_t DICTIONARY_SIZE = 0x8000;
+
+    class CompressedBlock
+    {
+    public:
+        std::vector<uint8_t> m_data;
+        uint32_t m_adler;
+        size_t m_input_size;
+    };
+
+    using block_data_t = std::shared_ptr<const std::vector<uint8_t>>;
+
+    int m_compression_level;
+    int m_compression_strategy;
+    size_t m_max_blocks_in_flight;
+    ThreadPool m_worker_pool;
+
+    std::vector<uint8_t> m_current_block;
+    block_data_t m_previous_block;
+    std::deque<std::future<CompressedBlock>> m_compressing_blocks;
+
+    bool m_wrote_header;
+    uint32_t m_adler;
+
+    static CompressedBlock CompressBlock(const block_data_t& block, const block_data_t& previousBlock, bool isLastBlock, int compressionLevel, int compressionStrategy);
+
+    void SubmitBlock(bool isLastBlock);
+    void WriteCompressedBlock();
+
+public:
+    /**
+     * \brief Creates a processor that compresses on the specified amount of worker threads.
+     * \param workerCount The amount of worker threads. Must be at least \c 1.
+     * \param compressionLevel The zlib compression level. A negative value uses the default level of zlib.
+     * \param compressionStrategy The zlib compression strategy.
+     */
+    OutputProcessorParallelDeflate(unsigned workerCount, int compressionLevel, int compressionStrategy);
+    ~OutputProcessorParallelDeflate() override = default;
+
+    OutputProcessorParallelDeflate(const OutputProcessorParallelDeflate& other) = delete;
+    OutputProcessorParallelDeflate(OutputProcessorParallelDeflate&& other) noexcept = delete;
+    OutputProcessorParallelDeflate& operator=(const OutputProcessorParallelDeflate& other) = delete;
+    OutputProcessorParallelDeflate& operator=(OutputProcessorParallelDeflate&& other) noexcept = delete;
+
+    void Write(const void* buffer, size_t length) override;
+    void Flush() override;
+    int64_t Pos() override;
+};
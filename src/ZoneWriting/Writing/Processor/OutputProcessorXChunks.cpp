@@ -7,53 +7,205 @@
 #include <cassert>
 #include <cstring>
 
+OutputProcessorXChunks::ChunkSlot::ChunkSlot(const size_t chunkSize)
+    : m_output(nullptr),
+      m_input_size(0),
+      m_output_size(0),
+      m_state(ChunkState::FREE)
+{
+    for (auto& buffer : m_buffers)
+        buffer = std::make_unique<uint8_t[]>(chunkSize);
+}
+
+OutputProcessorXChunks::ChunkSlot& OutputProcessorXChunks::SlotAt(const size_t index)
+{
+    return m_slots[index % m_slots.size()];
+}
+
 void OutputProcessorXChunks::Init()
 {
     if (m_vanilla_buffer_size > 0)
         m_vanilla_buffer_offset = static_cast<size_t>(m_base_stream->Pos()) % m_vanilla_buffer_size;
 
     m_initialized = true;
+    m_write_thread = std::thread(&OutputProcessorXChunks::WriteChunks, this);
 }
 
-void OutputProcessorXChunks::WriteChunk()
+void OutputProcessorXChunks::AcquireChunk()
 {
-    if (m_vanilla_buffer_size > 0)
+    std::unique_lock lock(m_mutex);
+    auto& slot = SlotAt(m_fill_index);
+    m_state_changed.wait(lock,
+                         [this, &slot]
+                         {
+                             return m_exception || slot.m_state == ChunkState::FREE;
+                         });
+
+    if (m_exception)
+        std::rethrow_exception(m_exception);
+
+    slot.m_state = ChunkState::FILLING;
+    slot.m_input_size = 0;
+    m_is_filling = true;
+}
+
+void OutputProcessorXChunks::SubmitChunk()
+{
+    const auto streamNumber = static_cast<int>(m_fill_index % m_stream_count);
+    m_is_filling = false;
+
     {
-        if (m_vanilla_buffer_offset + sizeof(xchunk_size_t) > m_vanilla_buffer_size)
+        std::lock_guard lock(m_mutex);
+
+        SlotAt(m_fill_index).m_state = ChunkState::QUEUED;
+        m_fill_index++;
+
+        if (m_stream_is_processing[streamNumber])
+            return;
+
+        m_stream_is_processing[streamNumber] = true;
+    }
+
+    m_worker_pool.Enqueue(
+        [this, streamNumber]
         {
-            xchunk_size_t zeroMem = 0;
-            m_base_stream->Write(&zeroMem, m_vanilla_buffer_size - m_vanilla_buffer_offset);
-            m_vanilla_buffer_offset = 0;
+            ProcessStream(streamNumber);
+        });
+}
+
+void OutputProcessorXChunks::ProcessStream(const int streamNumber)
+{
+    // Chunks of one stream depend on each other so only one job per stream runs at a time and it works through the queued chunks in order
+    std::unique_lock lock(m_mutex);
+    while (SlotAt(m_stream_process_indices[streamNumber]).m_state == ChunkState::QUEUED)
+    {
+        auto& slot = SlotAt(m_stream_process_indices[streamNumber]);
+        lock.unlock();
+
+        std::exception_ptr processException;
+        try
+        {
+            ProcessChunk(streamNumber, slot);
+        }
+        catch (XChunkException& e)
+        {
+            processException = std::make_exception_ptr(WritingException(e.Message()));
+        }
+        catch (...)
+        {
+            processException = std::current_exception();
         }
+
+        lock.lock();
+        slot.m_exception = std::move(processException);
+        slot.m_state = slot.m_exception ? ChunkState::FAILED : ChunkState::PROCESSED;
+        m_stream_process_indices[streamNumber] += m_stream_count;
+        m_state_changed.notify_all();
     }
 
-    try
+    m_stream_is_processing[streamNumber] = false;
+    m_state_changed.notify_all();
+}
+
+void OutputProcessorXChunks::ProcessChunk(const int streamNumber, ChunkSlot& slot) const
+{
+    auto* input = slot.m_buffers[0].get();
+    auto* output = slot.m_buffers[1].get();
+    auto size = slot.m_input_size;
+
+    for (const auto& processor : m_chunk_processors)
     {
-        for (const auto& processor : m_chunk_processors)
+        size = processor->Process(streamNumber, input, size, output, m_chunk_size);
+        std::swap(input, output);
+    }
+
+    slot.m_output = input;
+    slot.m_output_size = size;
+}
+
+void OutputProcessorXChunks::WriteChunks()
+{
+    // Chunks are written to the base stream in the order they were filled regardless of the order they finished processing in
+    std::unique_lock lock(m_mutex);
+    while (true)
+    {
+        auto& slot = SlotAt(m_write_index);
+        m_state_changed.wait(lock,
+                             [this, &slot]
+                             {
+                                 return m_is_stopping || slot.m_state == ChunkState::PROCESSED || slot.m_state == ChunkState::FAILED;
+                             });
+
+        if (m_is_stopping)
+            return;
+
+        if (slot.m_state == ChunkState::FAILED)
+        {
+            m_exception = slot.m_exception;
+            m_state_changed.notify_all();
+            return;
+        }
+
+        lock.unlock();
+
+        std::exception_ptr writeException;
+        try
+        {
+            WriteChunk(slot);
+        }
+        catch (...)
         {
-            m_input_size = processor->Process(m_current_stream, m_input_buffer, m_input_size, m_output_buffer, m_chunk_size);
-            auto* swap = m_input_buffer;
-            m_input_buffer = m_output_buffer;
-            m_output_buffer = swap;
+            writeException = std::current_exception();
         }
+
+        lock.lock();
+        if (writeException)
+        {
+            m_exception = std::move(writeException);
+            m_state_changed.notify_all();
+            return;
+        }
+
+        slot.m_state = ChunkState::FREE;
+        m_write_index++;
+        m_state_changed.notify_all();
     }
-    catch (XChunkException& e)
+}
+
+void OutputProcessorXChunks::WriteChunk(const ChunkSlot& slot)
+{
+    if (m_vanilla_buffer_size > 0)
     {
-        throw WritingException(e.Message());
+        if (m_vanilla_buffer_offset + sizeof(xchunk_size_t) > m_vanilla_buffer_size)
+        {
+            xchunk_size_t zeroMem = 0;
+            m_base_stream->Write(&zeroMem, m_vanilla_buffer_size - m_vanilla_buffer_offset);
+            m_vanilla_buffer_offset = 0;
+        }
     }
 
-    auto chunkSize = static_cast<xchunk_size_t>(m_input_size);
+    auto chunkSize = static_cast<xchunk_size_t>(slot.m_output_size);
     m_base_stream->Write(&chunkSize, sizeof(chunkSize));
-    m_base_stream->Write(m_input_buffer, m_input_size);
+    m_base_stream->Write(slot.m_output, slot.m_output_size);
 
     if (m_vanilla_buffer_size > 0)
     {
-        m_vanilla_buffer_offset += sizeof(chunkSize) + m_input_size;
+        m_vanilla_buffer_offset += sizeof(chunkSize) + slot.m_output_size;
         m_vanilla_buffer_offset %= m_vanilla_buffer_size;
     }
+}
 
-    m_current_stream = (m_current_stream + 1) % m_stream_count;
-    m_input_size = 0;
+void OutputProcessorXChunks::WaitForWrittenChunks()
+{
+    std::unique_lock lock(m_mutex);
+    m_state_changed.wait(lock,
+                         [this]
+                         {
+                             return m_exception || m_write_index == m_fill_index;
+                         });
+
+    if (m_exception)
+        std::rethrow_exception(m_exception);
 }
 
 OutputProcessorXChunks::OutputProcessorXChunks(const int numStreams, const size_t xChunkSize, const size_t xChunkWriteSize)
@@ -62,21 +214,26 @@ OutputProcessorXChunks::OutputProcessorXChunks(const int numStreams, const size_
       m_chunk_write_size(xChunkWriteSize),
       m_vanilla_buffer_size(0),
       m_initialized(false),
-      m_current_stream(0),
       m_vanilla_buffer_offset(0),
-      m_input_buffer(nullptr),
-      m_output_buffer(nullptr),
-      m_input_size(0)
+      m_fill_index(0),
+      m_is_filling(false),
+      m_write_index(0),
+      m_stream_process_indices(numStreams),
+      m_stream_is_processing(numStreams),
+      m_is_stopping(false),
+      m_worker_pool(static_cast<size_t>(numStreams), static_cast<size_t>(numStreams))
 {
     assert(numStreams > 0);
     assert(xChunkSize > 0);
     assert(m_chunk_size >= m_chunk_write_size);
 
-    for (auto i = 0u; i < 2u; i++)
-        m_buffers.emplace_back(std::make_unique<uint8_t[]>(xChunkSize));
+    const auto slotCount = static_cast<size_t>(numStreams) * CHUNKS_IN_FLIGHT_PER_STREAM;
+    m_slots.reserve(slotCount);
+    for (auto i = 0u; i < slotCount; i++)
+        m_slots.emplace_back(xChunkSize);
 
-    m_input_buffer = m_buffers[0].get();
-    m_output_buffer = m_buffers[1].get();
+    for (auto streamNumber = 0; streamNumber < numStreams; streamNumber++)
+        m_stream_process_indices[streamNumber] = static_cast<size_t>(streamNumber);
 }
 
 OutputProcessorXChunks::OutputProcessorXChunks(const int numStreams, const size_t xChunkSize, const size_t xChunkWriteSize, const size_t vanillaBufferSize)
@@ -85,9 +242,26 @@ OutputProcessorXChunks::OutputProcessorXChunks(const int numStreams, const size_
     m_vanilla_buffer_size = vanillaBufferSize;
 }
 
+OutputProcessorXChunks::~OutputProcessorXChunks()
+{
+    // Jobs reference the slots and chunk processors so they must be finished before those can be destroyed
+    m_worker_pool.WaitForIdle();
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_is_stopping = true;
+    }
+
+    m_state_changed.notify_all();
+
+    if (m_write_thread.joinable())
+        m_write_thread.join();
+}
+
 void OutputProcessorXChunks::AddChunkProcessor(std::unique_ptr<IXChunkProcessor> chunkProcessor)
 {
     assert(chunkProcessor != nullptr);
+    assert(!m_initialized);
 
     m_chunk_processors.emplace_back(std::move(chunkProcessor));
 }
@@ -102,12 +276,16 @@ void OutputProcessorXChunks::Write(const void* buffer, const size_t length)
     auto sizeRemaining = length;
     while (sizeRemaining > 0)
     {
-        const auto toWrite = std::min(m_chunk_write_size - m_input_size, sizeRemaining);
+        if (!m_is_filling)
+            AcquireChunk();
 
-        memcpy(&m_input_buffer[m_input_size], &static_cast<const char*>(buffer)[length - sizeRemaining], toWrite);
-        m_input_size += toWrite;
-        if (m_input_size >= m_chunk_write_size)
-            WriteChunk();
+        auto& slot = SlotAt(m_fill_index);
+        const auto toWrite = std::min(m_chunk_write_size - slot.m_input_size, sizeRemaining);
+
+        memcpy(&slot.m_buffers[0][slot.m_input_size], &static_cast<const char*>(buffer)[length - sizeRemaining], toWrite);
+        slot.m_input_size += toWrite;
+        if (slot.m_input_size >= m_chunk_write_size)
+            SubmitChunk();
 
         sizeRemaining -= toWrite;
     }
@@ -115,13 +293,22 @@ void OutputProcessorXChunks::Write(const void* buffer, const size_t length)
 
 void OutputProcessorXChunks::Flush()
 {
-    if (m_input_size)
-        WriteChunk();
+    if (m_initialized)
+    {
+        if (m_is_filling && SlotAt(m_fill_index).m_input_size > 0)
+            SubmitChunk();
+
+        WaitForWrittenChunks();
+    }
 
     m_base_stream->Flush();
 }
 
 int64_t OutputProcessorXChunks::Pos()
 {
+    // The base stream is only up to date once all submitted chunks were written
+    if (m_initialized)
+        WaitForWrittenChunks();
+
     return m_base_stream->Pos();
 }
@@ -1,14 +1,43 @@
 #pragma once
+#include "Utils/ThreadPool.h"
 #include "Writing/OutputStreamProcessor.h"
 #include "Zone/XChunk/IXChunkProcessor.h"
 
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 class OutputProcessorXChunks final : public OutputStreamProcessor
 {
+    static constexpr size_t CHUNKS_IN_FLIGHT_PER_STREAM = 2u;
+
+    enum class ChunkState
+    {
+        FREE,
+        FILLING,
+        QUEUED,
+        PROCESSED,
+        FAILED
+    };
+
+    class ChunkSlot
+    {
+    public:
+        std::unique_ptr<uint8_t[]> m_buffers[2];
+        const uint8_t* m_output;
+        size_t m_input_size;
+        size_t m_output_size;
+        ChunkState m_state;
+        std::exception_ptr m_exception;
+
+        explicit ChunkSlot(size_t chunkSize);
+    };
+
     std::vector<std::unique_ptr<IXChunkProcessor>> m_chunk_processors;
 
     int m_stream_count;
@@ -17,26 +46,44 @@ class OutputProcessorXChunks final : public OutputStreamProcessor
     size_t m_vanilla_buffer_size;
 
     bool m_initialized;
-    int m_current_stream;
     size_t m_vanilla_buffer_offset;
 
-    std::vector<std::unique_ptr<uint8_t[]>> m_buffers;
-    uint8_t* m_input_buffer;
-    uint8_t* m_output_buffer;
-    size_t m_input_size;
+    // Chunks are numbered in the order they were filled. Chunk n belongs to stream n % m_stream_count and lives in slot n % m_slots.size().
+    std::vector<ChunkSlot> m_slots;
+    size_t m_fill_index;
+    bool m_is_filling;
+    size_t m_write_index;
+    std::vector<size_t> m_stream_process_indices;
+    std::vector<bool> m_stream_is_processing;
+
+    bool m_is_stopping;
+    std::exception_ptr m_exception;
+    std::mutex m_mutex;
+    std::condition_variable m_state_changed;
+
+    ThreadPool m_worker_pool;
+    std::thread m_write_thread;
+
+    ChunkSlot& SlotAt(size_t index);
 
     void Init();
-    void WriteChunk();
+    void AcquireChunk();
+    void SubmitChunk();
+    void ProcessStream(int streamNumber);
+    void ProcessChunk(int streamNumber, ChunkSlot& slot) const;
+    void WriteChunks();
+    void WriteChunk(const ChunkSlot& slot);
+    void WaitForWrittenChunks();
 
 public:
     OutputProcessorXChunks(int numStreams, size_t xChunkSize, size_t xChunkWriteSize);
     OutputProcessorXChunks(int numStreams, size_t xChunkSize, size_t xChunkWriteSize, size_t vanillaBufferSize);
-    ~OutputProcessorXChunks() override = default;
+    ~OutputProcessorXChunks() override;
 
     OutputProcessorXChunks(const OutputProcessorXChunks& other) = delete;
-    OutputProcessorXChunks(OutputProcessorXChunks&& other) noexcept = default;
+    OutputProcessorXChunks(OutputProcessorXChunks&& other) noexcept = delete;
     OutputProcessorXChunks& operator=(const OutputProcessorXChunks& other) = delete;
-    OutputProcessorXChunks& operator=(OutputProcessorXChunks&& other) noexcept = default;
+    OutputProcessorXChunks& operator=(OutputProcessorXChunks&& other) noexcept = delete;
 
     void AddChunkProcessor(std::unique_ptr<IXChunkProcessor> chunkProcessor);
 
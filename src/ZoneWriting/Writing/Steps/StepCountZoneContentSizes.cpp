@@ -0,0 +1,30 @@
+#include "StepCountZoneContentSizes.h"
+
+#include "Zone/Stream/Impl/InMemoryZoneOutputStream.h"
+
+StepCountZoneContentSizes::StepCountZoneContentSizes(
+    std::unique_ptr<IContentWritingEntryPoint> entryPoint, Zone* zone, const int offsetBlockBitCount, const block_t insertBlock, ZoneContentSizes& sizes)
+    : m_content_loader(std::move(entryPoint)),
+      m_zone(zone),
+      m_offset_block_bit_count(offsetBlockBitCount),
+      m_insert_block(insertBlock),
+      m_sizes(sizes)
+{
+}
+
+void StepCountZoneContentSizes::PerformStep(ZoneWriter* zoneWriter, IWritingStream* stream)
+{
+    std::vector<XBlock*> blocks;
+    for (const auto& block : zoneWriter->m_blocks)
+        blocks.push_back(block.get());
+
+    InMemoryZoneData zoneData;
+    InMemoryZoneOutputStream zoneOutputStream(&zoneData, std::move(blocks), m_offset_block_bit_count, m_insert_block, true);
+    m_content_loader->WriteContent(m_zone, &zoneOutputStream);
+
+    m_sizes.m_block_sizes.clear();
+    for (const auto& block : zoneWriter->m_blocks)
+        m_sizes.m_block_sizes.emplace_back(ZoneContentSizes::BlockSize{block->m_name, block->m_type, block->m_buffer_size});
+
+    m_sizes.m_asset_type_sizes = zoneOutputStream.GetAssetTypeSizes();
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Writing/IContentWritingEntryPoint.h"
+#include "Writing/IWritingStep.h"
+#include "Writing/ZoneContentSizes.h"
+
+#include <memory>
+
+/**
+ * \brief Writes the zone content without keeping it to only determine the sizes of its blocks and assets.
+ */
+class StepCountZoneContentSizes final : public IWritingStep
+{
+    std::unique_ptr<IContentWritingEntryPoint> m_content_loader;
+    Zone* m_zone;
+    int m_offset_block_bit_count;
+    block_t m_insert_block;
+    ZoneContentSizes& m_sizes;
+
+public:
+    StepCountZoneContentSizes(
+        std::unique_ptr<IContentWritingEntryPoint> entryPoint, Zone* zone, int offsetBlockBitCount, block_t insertBlock, ZoneContentSizes& sizes);
+
+    void PerformStep(ZoneWriter* zoneWriter, IWritingStream* stream) override;
+};
@@ -7,8 +7,12 @@ StepWriteZoneContentToFile::StepWriteZoneContentToFile(StepWriteZoneContentToMem
 
 void StepWriteZoneContentToFile::PerformStep(ZoneWriter* zoneWriter, IWritingStream* stream)
 {
-    for (const auto& dataBuffer : m_memory->GetData()->m_buffers)
+    // The content has been completely written at this point so buffers can be released as soon as the output processors took them
+    // which keeps the memory of the uncompressed content from adding up with the memory used while compressing it
+    for (auto& dataBuffer : m_memory->GetData()->m_buffers)
     {
         stream->Write(dataBuffer.m_data.get(), dataBuffer.m_size);
+        dataBuffer.m_data.reset();
+        dataBuffer.m_size = 0;
     }
 }
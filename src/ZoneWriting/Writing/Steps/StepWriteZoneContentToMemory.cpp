@@ -20,7 +20,7 @@ void StepWriteZoneContentToMemory::PerformStep(ZoneWriter* zoneWriter, IWritingS
     for (const auto& block : zoneWriter->m_blocks)
         blocks.push_back(block.get());
 
-    const auto zoneOutputStream = std::make_unique<InMemoryZoneOutputStream>(m_zone_data.get(), std::move(blocks), m_offset_block_bit_count, m_insert_block);
+    const auto zoneOutputStream = std::make_unique<InMemoryZoneOutputStream>(m_zone_data.get(), std::move(blocks), m_offset_block_bit_count, m_insert_block, false);
     m_content_loader->WriteContent(m_zone, zoneOutputStream.get());
 }
 
@@ -0,0 +1,22 @@
+#include "WritingMemoryStream.h"
+
+WritingMemoryStream::WritingMemoryStream(std::vector<uint8_t>& buffer)
+    : m_buffer(buffer),
+      m_start_offset(buffer.size())
+{
+}
+
+void WritingMemoryStream::Write(const void* buffer, const size_t length)
+{
+    const auto* data = static_cast<const uint8_t*>(buffer);
+    m_buffer.insert(m_buffer.end(), data, data + length);
+}
+
+void WritingMemoryStream::Flush()
+{
+}
+
+int64_t WritingMemoryStream::Pos()
+{
+    return static_cast<int64_t>(m_buffer.size() - m_start_offset);
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "IWritingStream.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * \brief Appends all written data to a buffer owned by the caller.
+ */
+class WritingMemoryStream final : public IWritingStream
+{
+    std::vector<uint8_t>& m_buffer;
+    size_t m_start_offset;
+
+public:
+    /**
+     * \brief Creates a stream that appends to the specified buffer. Data already in the buffer is kept and does not count towards the position.
+     * \param buffer The buffer to append to.
+     */
+    explicit WritingMemoryStream(std::vector<uint8_t>& buffer);
+
+    void Write(const void* buffer, size_t length) override;
+    void Flush() override;
+    int64_t Pos() override;
+};
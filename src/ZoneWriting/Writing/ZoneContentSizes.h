@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Zone/XBlock.h"
+#include "Zone/ZoneTypes.h"
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * \brief The sizes a zone's content takes up when writing it.
+ */
+class ZoneContentSizes
+{
+public:
+    class BlockSize
+    {
+    public:
+        std::string m_name;
+        XBlock::Type m_type;
+        size_t m_size;
+    };
+
+    std::vector<BlockSize> m_block_sizes;
+
+    // The amount of bytes the assets of each type add to all blocks except temp blocks.
+    // Assets that are written as part of another asset count towards the type of that asset.
+    std::map<asset_type_t, size_t> m_asset_type_sizes;
+};
@@ -1,5 +1,6 @@
 #include "ZoneWriter.h"
 
+#include "Utils/Tracing.h"
 #include "WritingException.h"
 #include "WritingFileStream.h"
 
@@ -26,6 +27,13 @@ IWritingStream* ZoneWriter::BuildWritingChain(IWritingStream* rootStream)
     return currentStream;
 }
 
+void ZoneWriter::ReleaseStreamProcessors()
+{
+    // Processors may still access the file stream from background threads and must therefore be released before it goes out of scope
+    m_processors.clear();
+    m_processor_chain_dirty = true;
+}
+
 void ZoneWriter::AddXBlock(std::unique_ptr<XBlock> block)
 {
     m_blocks.emplace_back(std::move(block));
@@ -58,30 +66,39 @@ void ZoneWriter::RemoveStreamProcessor(OutputStreamProcessor* streamProcessor)
 bool ZoneWriter::WriteZone(std::ostream& stream)
 {
     WritingFileStream fileStream(stream);
-    auto* endStream = BuildWritingChain(&fileStream);
+    return WriteZone(fileStream);
+}
+
+bool ZoneWriter::WriteZone(IWritingStream& stream)
+{
+    auto* endStream = BuildWritingChain(&stream);
 
     try
     {
         for (const auto& step : m_steps)
         {
+            TRACE_SCOPE("ZoneWriting", tracing::Tracer::GetDynamicTypeName(*step));
             step->PerformStep(this, endStream);
 
             if (m_processor_chain_dirty)
-                endStream = BuildWritingChain(&fileStream);
+                endStream = BuildWritingChain(&stream);
         }
     }
     catch (WritingException& e)
     {
         std::cout << "Writing fastfile failed: " << e.Message() << "\n";
+        ReleaseStreamProcessors();
         return false;
     }
     catch (std::runtime_error& e)
     {
         std::cout << "Writing fastfile failed: " << e.what() << "\n";
+        ReleaseStreamProcessors();
         return false;
     }
 
     endStream->Flush();
+    ReleaseStreamProcessors();
 
     return true;
 }
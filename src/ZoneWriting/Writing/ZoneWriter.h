@@ -17,6 +17,7 @@ class ZoneWriter
     bool m_processor_chain_dirty;
 
     IWritingStream* BuildWritingChain(IWritingStream* rootStream);
+    void ReleaseStreamProcessors();
 
 public:
     std::vector<std::unique_ptr<XBlock>> m_blocks;
@@ -30,4 +31,5 @@ public:
     void RemoveStreamProcessor(OutputStreamProcessor* streamProcessor);
 
     bool WriteZone(std::ostream& stream);
+    bool WriteZone(IWritingStream& stream);
 };
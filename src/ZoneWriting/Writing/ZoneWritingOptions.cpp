@@ -0,0 +1,31 @@
+#include "ZoneWritingOptions.h"
+
+#include "Utils/StringUtils.h"
+
+#include <zlib.h>
+
+static_assert(static_cast<int>(CompressionStrategy::DEFAULT) == Z_DEFAULT_STRATEGY);
+static_assert(static_cast<int>(CompressionStrategy::FILTERED) == Z_FILTERED);
+static_assert(static_cast<int>(CompressionStrategy::HUFFMAN_ONLY) == Z_HUFFMAN_ONLY);
+static_assert(static_cast<int>(CompressionStrategy::RLE) == Z_RLE);
+static_assert(static_cast<int>(CompressionStrategy::FIXED) == Z_FIXED);
+
+bool ZoneWritingOptions::ParseCompressionStrategy(std::string value, CompressionStrategy& strategy)
+{
+    utils::MakeStringLowerCase(value);
+
+    if (value == "default")
+        strategy = CompressionStrategy::DEFAULT;
+    else if (value == "filtered")
+        strategy = CompressionStrategy::FILTERED;
+    else if (value == "huffman-only")
+        strategy = CompressionStrategy::HUFFMAN_ONLY;
+    else if (value == "rle")
+        strategy = CompressionStrategy::RLE;
+    else if (value == "fixed")
+        strategy = CompressionStrategy::FIXED;
+    else
+        return false;
+
+    return true;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+
+/**
+ * \brief The deflate strategies zlib can compress zones with. The values match the zlib strategy constants.
+ */
+enum class CompressionStrategy
+{
+    DEFAULT = 0,
+    FILTERED = 1,
+    HUFFMAN_ONLY = 2,
+    RLE = 3,
+    FIXED = 4
+};
+
+/**
+ * \brief Options for writing a single zone that can differ between the zones that are written.
+ */
+class ZoneWritingOptions
+{
+public:
+    static constexpr int DEFAULT_COMPRESSION_LEVEL = -1;
+
+    // The zlib compression level from 0 (no compression) to 9 (best compression).
+    // A negative value uses the level the zones of the game are compressed with by default.
+    int m_compression_level = DEFAULT_COMPRESSION_LEVEL;
+
+    CompressionStrategy m_compression_strategy = CompressionStrategy::DEFAULT;
+
+    /**
+     * \brief Parses the name of a compression strategy: default, filtered, huffman-only, rle or fixed. Case is ignored.
+     * \param value The name of the strategy.
+     * \param strategy The parsed strategy.
+     * \return \c true if the name is a valid strategy, \c false otherwise.
+     */
+    static bool ParseCompressionStrategy(std::string value, CompressionStrategy& strategy);
+};
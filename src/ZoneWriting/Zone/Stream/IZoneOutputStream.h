@@ -23,6 +23,17 @@ public:
     virtual void ReusableAddOffset(void* ptr, size_t size, size_t count, std::type_index type) = 0;
     virtual void MarkFollowing(void** pPtr) = 0;
 
+    /**
+     * \brief Marks the start of writing the content of an asset. Data written until \c EndAsset counts towards the size of the specified asset type.
+     * \param assetType The type of the asset that is written next.
+     */
+    virtual void BeginAsset(asset_type_t assetType) = 0;
+
+    /**
+     * \brief Marks the end of writing the content of the asset that was started with \c BeginAsset.
+     */
+    virtual void EndAsset() = 0;
+
     template<typename T> bool ReusableShouldWrite(T** pPtr)
     {
         return ReusableShouldWrite(reinterpret_cast<void**>(reinterpret_cast<uintptr_t>(pPtr)), sizeof(T), std::type_index(typeid(T)));
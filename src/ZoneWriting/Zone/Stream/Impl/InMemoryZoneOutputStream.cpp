@@ -1,13 +1,19 @@
 #include "InMemoryZoneOutputStream.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
-InMemoryZoneOutputStream::InMemoryZoneOutputStream(InMemoryZoneData* zoneData, std::vector<XBlock*> blocks, const int blockBitCount, const block_t insertBlock)
+InMemoryZoneOutputStream::InMemoryZoneOutputStream(
+    InMemoryZoneData* zoneData, std::vector<XBlock*> blocks, const int blockBitCount, const block_t insertBlock, const bool discardAssetData)
     : m_zone_data(zoneData),
       m_blocks(std::move(blocks)),
       m_block_bit_count(blockBitCount),
-      m_insert_block(m_blocks[insertBlock])
+      m_insert_block(m_blocks[insertBlock]),
+      m_discard_asset_data(discardAssetData),
+      m_current_asset_type(-1),
+      m_current_asset_start_size(0u),
+      m_current_asset_start_position{}
 {
 }
 
@@ -185,17 +191,20 @@ bool InMemoryZoneOutputStream::ReusableShouldWrite(void** pPtr, const size_t ent
         return true;
     }
 
-    for (const auto& entry : foundEntriesForType->second)
-    {
-        if (*pPtr >= entry.m_start_ptr && *pPtr < entry.m_end_ptr)
-        {
-            assert((reinterpret_cast<uintptr_t>(*pPtr) - reinterpret_cast<uintptr_t>(entry.m_start_ptr)) % entrySize == 0);
-            *pPtr = reinterpret_cast<void*>(entry.m_start_zone_ptr + (reinterpret_cast<uintptr_t>(*pPtr) - reinterpret_cast<uintptr_t>(entry.m_start_ptr)));
-            return false;
-        }
-    }
+    const auto& ranges = foundEntriesForType->second.m_ranges;
+    const auto ptr = reinterpret_cast<uintptr_t>(*pPtr);
+    auto range = ranges.upper_bound(ptr);
+    if (range == ranges.begin())
+        return true;
 
-    return true;
+    --range;
+    if (ptr >= range->second.m_end)
+        return true;
+
+    const auto& entry = foundEntriesForType->second.m_entries[range->second.m_entry_index];
+    assert((ptr - reinterpret_cast<uintptr_t>(entry.m_start_ptr)) % entrySize == 0);
+    *pPtr = reinterpret_cast<void*>(entry.m_start_zone_ptr + (ptr - reinterpret_cast<uintptr_t>(entry.m_start_ptr)));
+    return false;
 }
 
 void InMemoryZoneOutputStream::ReusableAddOffset(void* ptr, size_t size, size_t count, std::type_index type)
@@ -204,15 +213,64 @@ void InMemoryZoneOutputStream::ReusableAddOffset(void* ptr, size_t size, size_t
 
     const auto inTemp = m_block_stack.top()->m_type == XBlock::Type::BLOCK_TYPE_TEMP;
     auto zoneOffset = inTemp ? InsertPointer() : GetCurrentZonePointer();
-    const auto foundEntriesForType = m_reusable_entries.find(type);
-    if (foundEntriesForType == m_reusable_entries.end())
+    auto& entries = m_reusable_entries[type];
+    const auto entryIndex = entries.m_entries.size();
+    const auto& entry = entries.m_entries.emplace_back(ptr, size, count, zoneOffset);
+
+    // Only add the parts of the entry that are not covered by a previous entry to keep resolving pointers to the entry that was added first
+    auto& ranges = entries.m_ranges;
+    auto current = reinterpret_cast<uintptr_t>(entry.m_start_ptr);
+    const auto end = reinterpret_cast<uintptr_t>(entry.m_end_ptr);
+    auto next = ranges.upper_bound(current);
+    if (next != ranges.begin())
+        current = std::max(current, std::prev(next)->second.m_end);
+
+    while (current < end)
     {
-        std::vector<ReusableEntry> entries;
-        entries.emplace_back(ptr, size, count, zoneOffset);
-        m_reusable_entries.emplace(std::make_pair(type, std::move(entries)));
+        const auto nextStartsInEntry = next != ranges.end() && next->first < end;
+        const auto gapEnd = nextStartsInEntry ? next->first : end;
+        if (current < gapEnd)
+            ranges.emplace_hint(next, current, ReusableRange{gapEnd, entryIndex});
+
+        if (!nextStartsInEntry)
+            break;
+
+        current = std::max(current, next->second.m_end);
+        ++next;
     }
-    else
+}
+
+size_t InMemoryZoneOutputStream::GetNonTempBlockSize() const
+{
+    size_t size = 0u;
+    for (const auto* block : m_blocks)
     {
-        foundEntriesForType->second.emplace_back(ptr, size, count, zoneOffset);
+        if (block->m_type != XBlock::Type::BLOCK_TYPE_TEMP)
+            size += block->m_buffer_size;
     }
+
+    return size;
+}
+
+void InMemoryZoneOutputStream::BeginAsset(const asset_type_t assetType)
+{
+    m_current_asset_type = assetType;
+    m_current_asset_start_size = GetNonTempBlockSize();
+
+    if (m_discard_asset_data)
+        m_current_asset_start_position = m_zone_data->GetPosition();
+}
+
+void InMemoryZoneOutputStream::EndAsset()
+{
+    m_asset_type_sizes[m_current_asset_type] += GetNonTempBlockSize() - m_current_asset_start_size;
+
+    // Written data is only accessed while writing the asset it belongs to, later assets only refer to it by its zone pointer
+    if (m_discard_asset_data)
+        m_zone_data->Rewind(m_current_asset_start_position);
+}
+
+const std::map<asset_type_t, size_t>& InMemoryZoneOutputStream::GetAssetTypeSizes() const
+{
+    return m_asset_type_sizes;
 }
@@ -1,8 +1,10 @@
 #pragma once
+#include "Utils/ClassUtils.h"
 #include "Writing/InMemoryZoneData.h"
 #include "Zone/Stream/IZoneOutputStream.h"
 #include "Zone/XBlock.h"
 
+#include <map>
 #include <stack>
 #include <unordered_map>
 #include <vector>
@@ -21,6 +23,25 @@ class InMemoryZoneOutputStream final : public IZoneOutputStream
         ReusableEntry(void* startPtr, size_t entrySize, size_t entryCount, uintptr_t startZonePtr);
     };
 
+    class ReusableRange
+    {
+    public:
+        uintptr_t m_end;
+        size_t m_entry_index;
+    };
+
+    /**
+     * \brief The reusable entries of a single type.
+     * Ranges are sorted by their start and do not overlap, so the entry containing a pointer can be found with a binary search.
+     * Parts of an entry that overlap with an entry that was added before are resolved to the earlier entry.
+     */
+    class ReusableEntries
+    {
+    public:
+        std::vector<ReusableEntry> m_entries;
+        std::map<uintptr_t, ReusableRange> m_ranges;
+    };
+
     InMemoryZoneData* m_zone_data;
     std::vector<XBlock*> m_blocks;
 
@@ -30,13 +51,29 @@ class InMemoryZoneOutputStream final : public IZoneOutputStream
     int m_block_bit_count;
     XBlock* m_insert_block;
 
-    std::unordered_map<std::type_index, std::vector<ReusableEntry>> m_reusable_entries;
+    std::unordered_map<std::type_index, ReusableEntries> m_reusable_entries;
+
+    bool m_discard_asset_data;
+    asset_type_t m_current_asset_type;
+    size_t m_current_asset_start_size;
+    InMemoryZoneData::Position m_current_asset_start_position;
+    std::map<asset_type_t, size_t> m_asset_type_sizes;
 
     uintptr_t GetCurrentZonePointer();
     uintptr_t InsertPointer();
+    _NODISCARD size_t GetNonTempBlockSize() const;
 
 public:
-    InMemoryZoneOutputStream(InMemoryZoneData* zoneData, std::vector<XBlock*> blocks, int blockBitCount, block_t insertBlock);
+    /**
+     * \brief Creates a stream that writes zone content to memory.
+     * \param zoneData The memory to write the content to.
+     * \param blocks The blocks of the zone.
+     * \param blockBitCount The amount of bits of a zone pointer that specify the block.
+     * \param insertBlock The block to insert pointers into.
+     * \param discardAssetData Whether to discard the data of every asset once it has been written completely.
+     * The zone data is incomplete then but block sizes are the same, which makes counting sizes take a lot less memory.
+     */
+    InMemoryZoneOutputStream(InMemoryZoneData* zoneData, std::vector<XBlock*> blocks, int blockBitCount, block_t insertBlock, bool discardAssetData);
 
     void PushBlock(block_t block) override;
     block_t PopBlock() override;
@@ -48,4 +85,12 @@ public:
     void MarkFollowing(void** pPtr) override;
     bool ReusableShouldWrite(void** pPtr, size_t entrySize, std::type_index type) override;
     void ReusableAddOffset(void* ptr, size_t size, size_t count, std::type_index type) override;
+    void BeginAsset(asset_type_t assetType) override;
+    void EndAsset() override;
+
+    /**
+     * \brief Returns the amount of bytes that were added to all blocks except temp blocks by the assets of each type.
+     * Assets that were written as part of another asset count towards the type of that asset.
+     */
+    _NODISCARD const std::map<asset_type_t, size_t>& GetAssetTypeSizes() const;
 };
@@ -6,6 +6,8 @@
 #include "Game/T5/ZoneWriterFactoryT5.h"
 #include "Game/T6/ZoneWriterFactoryT6.h"
 #include "Writing/IZoneWriterFactory.h"
+#include "Writing/WritingFileStream.h"
+#include "Writing/WritingMemoryStream.h"
 
 IZoneWriterFactory* ZoneWriterFactories[]{
     new IW3::ZoneWriterFactory(),
@@ -15,14 +17,28 @@ IZoneWriterFactory* ZoneWriterFactories[]{
     new T6::ZoneWriterFactory(),
 };
 
-bool ZoneWriting::WriteZone(std::ostream& stream, Zone* zone)
+ZoneWriting::Configuration_t ZoneWriting::Configuration;
+
+bool ZoneWriting::WriteZone(std::ostream& stream, Zone* zone, const ZoneWritingOptions& options)
+{
+    WritingFileStream fileStream(stream);
+    return WriteZone(fileStream, zone, options);
+}
+
+bool ZoneWriting::WriteZone(std::vector<uint8_t>& buffer, Zone* zone, const ZoneWritingOptions& options)
+{
+    WritingMemoryStream memoryStream(buffer);
+    return WriteZone(memoryStream, zone, options);
+}
+
+bool ZoneWriting::WriteZone(IWritingStream& stream, Zone* zone, const ZoneWritingOptions& options)
 {
     std::unique_ptr<ZoneWriter> zoneWriter;
     for (auto* factory : ZoneWriterFactories)
     {
         if (factory->SupportsZone(zone))
         {
-            zoneWriter = factory->CreateWriter(zone);
+            zoneWriter = factory->CreateWriter(zone, options);
             break;
         }
     }
@@ -35,3 +51,26 @@ bool ZoneWriting::WriteZone(std::ostream& stream, Zone* zone)
 
     return zoneWriter->WriteZone(stream);
 }
+
+bool ZoneWriting::CountZoneContentSizes(Zone* zone, ZoneContentSizes& sizes)
+{
+    std::unique_ptr<ZoneWriter> zoneWriter;
+    for (auto* factory : ZoneWriterFactories)
+    {
+        if (factory->SupportsZone(zone))
+        {
+            zoneWriter = factory->CreateSizeCountingWriter(zone, sizes);
+            break;
+        }
+    }
+
+    if (zoneWriter == nullptr)
+    {
+        printf("Could not create ZoneWriter for zone '%s'.\n", zone->m_name.c_str());
+        return false;
+    }
+
+    // Nothing is written to the stream when only counting sizes
+    std::ostream nullStream(nullptr);
+    return zoneWriter->WriteZone(nullStream);
+}
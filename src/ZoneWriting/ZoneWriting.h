@@ -1,11 +1,53 @@
 #pragma once
+#include "Pool/AssetWriteOrder.h"
+#include "Writing/IWritingStream.h"
+#include "Writing/ZoneContentSizes.h"
+#include "Writing/ZoneWritingOptions.h"
 #include "Zone/Zone.h"
 
+#include <cstdint>
 #include <ostream>
 #include <string>
+#include <vector>
 
 class ZoneWriting
 {
 public:
-    static bool WriteZone(std::ostream& stream, Zone* zone);
+    static class Configuration_t
+    {
+    public:
+        // The amount of worker threads compressing zones that use deflate. A value of 0 compresses with a single zlib stream on the writing thread.
+        unsigned DeflateWorkerCount = 0u;
+
+        // The order assets are written in. Dependencies are always written before the assets that use them.
+        AssetWriteOrderMode AssetOrder = AssetWriteOrderMode::DEFINITION;
+    } Configuration;
+
+    static bool WriteZone(std::ostream& stream, Zone* zone, const ZoneWritingOptions& options);
+
+    /**
+     * \brief Writes a zone to a sink supplied by the caller, for example to pass it on without writing it to disk.
+     * \param stream The stream to write the zone to.
+     * \param zone The zone to write.
+     * \param options The options to write the zone with.
+     * \return \c true if the zone could be written, otherwise \c false.
+     */
+    static bool WriteZone(IWritingStream& stream, Zone* zone, const ZoneWritingOptions& options);
+
+    /**
+     * \brief Writes a zone to memory.
+     * \param buffer The buffer to append the written zone to.
+     * \param zone The zone to write.
+     * \param options The options to write the zone with.
+     * \return \c true if the zone could be written, otherwise \c false. The buffer may contain part of the zone on failure.
+     */
+    static bool WriteZone(std::vector<uint8_t>& buffer, Zone* zone, const ZoneWritingOptions& options);
+
+    /**
+     * \brief Determines the sizes of the zone content without writing the zone anywhere.
+     * \param zone The zone to determine the sizes of.
+     * \param sizes The sizes of the zone content.
+     * \return \c true if the sizes could be determined, otherwise \c false.
+     */
+    static bool CountZoneContentSizes(Zone* zone, ZoneContentSizes& sizes);
 };
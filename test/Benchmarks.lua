@@ -0,0 +1,62 @@
+Benchmarks = {}
+
+function Benchmarks:include(includes)
+	if includes:handle(self:name()) then
+		includedirs {
+			path.join(TestFolder(), "Benchmarks")
+		}
+	end
+end
+
+function Benchmarks:link(links)
+	
+end
+
+function Benchmarks:use()
+	
+end
+
+function Benchmarks:name()
+    return "Benchmarks"
+end
+
+function Benchmarks:project()
+	local folder = TestFolder()
+	local includes = Includes:create()
+	local links = Links:create()
+
+	project(self:name())
+        targetdir(TargetDirectoryTest)
+		location "%{wks.location}/test/%{prj.name}"
+		kind "ConsoleApp"
+		language "C++"
+		
+		files {
+			path.join(folder, "Benchmarks/**.h"), 
+			path.join(folder, "Benchmarks/**.cpp"),
+			ZoneCode:allBenchmarkFiles()
+		}
+		
+        vpaths {
+			["*"] = {
+				path.join(folder, "Benchmarks"),
+				path.join(BuildFolder(), "src/ZoneCode")
+			}
+		}
+		
+		self:include(includes)
+		ParserTestUtils:include(includes)
+		ZoneLoading:include(includes)
+		ZoneWriting:include(includes)
+		ZoneCode:include(includes)
+		zlib:include(includes)
+		catch2:include(includes)
+
+		links:linkto(ParserTestUtils)
+		links:linkto(ZoneLoading)
+		links:linkto(ZoneWriting)
+		links:linkto(catch2)
+		links:linkall()
+
+		ZoneCode:use()
+end
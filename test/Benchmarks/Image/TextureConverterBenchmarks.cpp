@@ -0,0 +1,66 @@
+#include "Image/Texture.h"
+#include "Image/TextureConverter.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace benchmarks::image::texture_converter
+{
+    constexpr unsigned TEXTURE_SIZE = 1024u;
+
+    class FormatConversion
+    {
+    public:
+        const char* m_name;
+        const ImageFormat* m_input_format;
+        const ImageFormat* m_output_format;
+    };
+
+    const FormatConversion CONVERSIONS[]{
+        {"R8G8B8A8 to B8G8R8A8", &ImageFormat::FORMAT_R8_G8_B8_A8, &ImageFormat::FORMAT_B8_G8_R8_A8},
+        {"B8G8R8X8 to R8G8B8A8", &ImageFormat::FORMAT_B8_G8_R8_X8, &ImageFormat::FORMAT_R8_G8_B8_A8},
+        {"R8G8B8 to R8G8B8A8",   &ImageFormat::FORMAT_R8_G8_B8,    &ImageFormat::FORMAT_R8_G8_B8_A8},
+        {"R8G8B8A8 to R8G8B8",   &ImageFormat::FORMAT_R8_G8_B8_A8, &ImageFormat::FORMAT_R8_G8_B8   },
+        {"A8 to R8G8B8A8",       &ImageFormat::FORMAT_A8,          &ImageFormat::FORMAT_R8_G8_B8_A8},
+        {"R8A8 to R8G8B8A8",     &ImageFormat::FORMAT_R8_A8,       &ImageFormat::FORMAT_R8_G8_B8_A8},
+        {"R8G8B8A8 to BC1",      &ImageFormat::FORMAT_R8_G8_B8_A8, &ImageFormat::FORMAT_BC1        },
+        {"R8G8B8A8 to BC3",      &ImageFormat::FORMAT_R8_G8_B8_A8, &ImageFormat::FORMAT_BC3        },
+        {"BC1 to R8G8B8A8",      &ImageFormat::FORMAT_BC1,         &ImageFormat::FORMAT_R8_G8_B8_A8},
+        {"BC5 to R8G8B8A8",      &ImageFormat::FORMAT_BC5,         &ImageFormat::FORMAT_R8_G8_B8_A8},
+    };
+
+    std::unique_ptr<Texture2D> CreateInputTexture(const ImageFormat* format)
+    {
+        auto texture = std::make_unique<Texture2D>(format, TEXTURE_SIZE, TEXTURE_SIZE, true);
+        texture->Allocate();
+
+        for (auto mipLevel = 0; mipLevel < texture->GetMipMapCount(); mipLevel++)
+        {
+            auto* buffer = texture->GetBufferForMipLevel(mipLevel, 0);
+            const auto size = texture->GetSizeOfMipLevel(mipLevel);
+            for (auto i = 0u; i < size; i++)
+                buffer[i] = static_cast<uint8_t>(i * 7u + mipLevel);
+        }
+
+        return texture;
+    }
+
+    TEST_CASE("TextureConverter: Conversion throughput", "[benchmark][image]")
+    {
+        for (const auto& conversion : CONVERSIONS)
+        {
+            const auto inputTexture = CreateInputTexture(conversion.m_input_format);
+
+            BENCHMARK(std::string(conversion.m_name) + " 1024x1024 with mipmaps")
+            {
+                TextureConverter converter(inputTexture.get(), conversion.m_output_format);
+                const std::unique_ptr<Texture> outputTexture(converter.Convert());
+
+                return outputTexture->GetBufferForMipLevel(0)[0];
+            };
+        }
+    }
+} // namespace benchmarks::image::texture_converter
@@ -0,0 +1,80 @@
+#include "Parsing/Impl/DefinesStreamProxy.h"
+#include "Parsing/Mock/MockParserLineStream.h"
+#include "Parsing/Simple/SimpleLexer.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+
+namespace benchmarks::parsing
+{
+    // Resembles menu files which are the largest files that are parsed with these components
+    std::vector<std::string> CreateMenuLikeLines()
+    {
+        std::vector<std::string> lines{
+            "#define COLOR(r, g, b, a) r g b a",
+            "#define RECT(x, y, w, h, align) x y w h align 0",
+            "#define ITEM(name, x, y) itemDef { name name rect RECT(x, y, 100, 20, 1) forecolor COLOR(1, 1, 1, 1) }",
+        };
+        for (auto i = 0; i < 1000; i++)
+        {
+            lines.emplace_back("ITEM(\"item\", 10, 20) ITEM(\"other\", RECT(1, 2, 3, 4, 5), 20)");
+            lines.emplace_back("menuDef { name \"menu\" visible 1 }");
+        }
+
+        return lines;
+    }
+
+    std::vector<std::string> CreateExpandedMenuLines()
+    {
+        std::vector<std::string> lines;
+        for (auto i = 0; i < 1000; i++)
+        {
+            lines.emplace_back("itemDef { name \"item\" rect 10 20 100 20 1 0 forecolor 1 1 1 1 visible when(dvarInt(\"ui_item\") >= 2) }");
+            lines.emplace_back("menuDef { name \"menu\" visible 1 onOpen { setdvar ui_value 0.5; exec \"set x 1\"; } }");
+        }
+
+        return lines;
+    }
+
+    TEST_CASE("DefinesStreamProxy: Preprocessing throughput", "[benchmark][parsing]")
+    {
+        const auto lines = CreateMenuLikeLines();
+
+        BENCHMARK("Nested parameterized macros")
+        {
+            MockParserLineStream mockStream(lines);
+            DefinesStreamProxy proxy(&mockStream);
+
+            size_t totalLength = 0;
+            while (!proxy.Eof())
+                totalLength += proxy.NextLine().m_line.size();
+
+            return totalLength;
+        };
+    }
+
+    TEST_CASE("SimpleLexer: Tokenizing throughput", "[benchmark][parsing]")
+    {
+        const auto lines = CreateExpandedMenuLines();
+
+        BENCHMARK("Menu like tokens")
+        {
+            MockParserLineStream mockStream(lines);
+            SimpleLexer::Config config;
+            config.m_multi_character_tokens.emplace_back(1, ">=");
+            config.m_multi_character_tokens.emplace_back(2, "<=");
+            SimpleLexer lexer(&mockStream, std::move(config));
+
+            size_t tokenCount = 0;
+            while (!lexer.GetToken(0).IsEof())
+            {
+                tokenCount++;
+                lexer.PopTokens(1);
+            }
+
+            return tokenCount;
+        };
+    }
+} // namespace benchmarks::parsing
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "Loading/LoadingMemoryStream.h"
+#include "Utils/ClassUtils.h"
+#include "Writing/InMemoryZoneData.h"
+#include "Zone/Stream/Impl/InMemoryZoneOutputStream.h"
+#include "Zone/Stream/Impl/XBlockInputStream.h"
+#include "Zone/XBlock.h"
+#include "Zone/Zone.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace asset_benchmark
+{
+    constexpr const char* ASSET_NAME = "benchmark_asset";
+
+    /**
+     * \brief One block for each block index of a game. Blocks that are only allocated at runtime are treated like normal blocks,
+     * which keeps writing and loading symmetric without depending on the block layout of a game.
+     */
+    template<typename TTraits> class BlockSet
+    {
+    public:
+        std::vector<std::unique_ptr<XBlock>> m_blocks;
+        std::vector<XBlock*> m_block_ptrs;
+
+        BlockSet()
+        {
+            for (block_t index = 0; index < TTraits::BLOCK_COUNT; index++)
+            {
+                const auto type = index == TTraits::TEMP_BLOCK ? XBlock::Type::BLOCK_TYPE_TEMP : XBlock::Type::BLOCK_TYPE_NORMAL;
+                m_blocks.emplace_back(std::make_unique<XBlock>("block" + std::to_string(index), index, type));
+                m_block_ptrs.emplace_back(m_blocks.back().get());
+            }
+        }
+    };
+
+    template<typename TTraits> std::unique_ptr<Zone> CreateZone()
+    {
+        auto zone = std::make_unique<Zone>("benchmark", 0, TTraits::Game());
+        zone->m_pools = std::make_unique<typename TTraits::pool_t>(zone.get(), 0);
+        for (asset_type_t assetType = 0; assetType < zone->m_pools->GetAssetTypeCount(); assetType++)
+            zone->m_pools->InitPoolDynamic(assetType);
+
+        // Script strings of the zero initialized asset refer to the first script string
+        zone->m_script_strings.AddOrGetScriptString("");
+
+        return zone;
+    }
+
+    /**
+     * \brief The data of an asset like it is written to the content of a zone, together with the sizes of the blocks it needs.
+     */
+    class WrittenAsset
+    {
+    public:
+        std::vector<uint8_t> m_data;
+        std::vector<size_t> m_block_sizes;
+    };
+
+    /**
+     * \brief Everything writing an asset needs. The asset is zero initialized and only has a name, which works for every asset type without captured asset data.
+     */
+    template<typename TTraits> class WriteRun
+    {
+    public:
+        std::unique_ptr<Zone> m_zone;
+        std::unique_ptr<typename TTraits::asset_t> m_asset;
+        BlockSet<TTraits> m_blocks;
+        InMemoryZoneData m_zone_data;
+
+        WriteRun()
+            : m_zone(CreateZone<TTraits>()),
+              m_asset(std::make_unique<typename TTraits::asset_t>())
+        {
+            TTraits::SetName(*m_asset, ASSET_NAME);
+            m_zone->m_pools->AddAsset(TTraits::ASSET_TYPE, TTraits::writer_t::GetAssetName(m_asset.get()), m_asset.get(), {}, {}, {});
+        }
+
+        int64_t Write()
+        {
+            InMemoryZoneOutputStream stream(&m_zone_data, m_blocks.m_block_ptrs, TTraits::OFFSET_BLOCK_BIT_COUNT, TTraits::INSERT_BLOCK, false);
+            stream.PushBlock(TTraits::INSERT_BLOCK);
+
+            auto* assetPtr = m_asset.get();
+            auto** writtenAssetPtr = static_cast<typename TTraits::asset_t**>(stream.WriteDataRaw(&assetPtr, sizeof(assetPtr)));
+            typename TTraits::writer_t writer(assetPtr, m_zone.get(), &stream);
+            writer.Write(writtenAssetPtr);
+
+            stream.PopBlock();
+            return m_zone_data.m_total_size;
+        }
+
+        _NODISCARD WrittenAsset GetWrittenAsset() const
+        {
+            WrittenAsset writtenAsset;
+            for (const auto& buffer : m_zone_data.m_buffers)
+                writtenAsset.m_data.insert(writtenAsset.m_data.end(), buffer.m_data.get(), buffer.m_data.get() + buffer.m_size);
+            for (const auto& block : m_blocks.m_blocks)
+                writtenAsset.m_block_sizes.emplace_back(block->m_buffer_size);
+
+            return writtenAsset;
+        }
+    };
+
+    /**
+     * \brief Everything loading an asset needs. Loading adds the asset to the zone, so every load needs its own.
+     */
+    template<typename TTraits> class LoadRun
+    {
+    public:
+        std::unique_ptr<Zone> m_zone;
+        BlockSet<TTraits> m_blocks;
+        const WrittenAsset* m_written_asset;
+
+        explicit LoadRun(const WrittenAsset& writtenAsset)
+            : m_zone(CreateZone<TTraits>()),
+              m_written_asset(&writtenAsset)
+        {
+            for (auto i = 0u; i < m_blocks.m_blocks.size(); i++)
+                m_blocks.m_blocks[i]->Alloc(writtenAsset.m_block_sizes[i]);
+        }
+
+        XAssetInfoGeneric* Load()
+        {
+            LoadingMemoryStream memoryStream(m_written_asset->m_data.data(), m_written_asset->m_data.size());
+            XBlockInputStream stream(m_blocks.m_block_ptrs, &memoryStream, TTraits::OFFSET_BLOCK_BIT_COUNT, TTraits::INSERT_BLOCK);
+            stream.PushBlock(TTraits::INSERT_BLOCK);
+
+            typename TTraits::asset_t* assetPtr;
+            stream.LoadDataRaw(&assetPtr, sizeof(assetPtr));
+            typename TTraits::loader_t loader(m_zone.get(), &stream);
+            auto* assetInfo = loader.Load(&assetPtr);
+
+            stream.PopBlock();
+            return assetInfo;
+        }
+    };
+
+    /**
+     * \brief Benchmarks the generated writer and loader of an asset type. The names of the benchmarks contain the size of the written data to compare the time per byte.
+     * ZoneCodeGenerator generates a call for every asset type with a traits class that provides the types and constants of its game.
+     */
+    template<typename TTraits> void Run()
+    {
+        WriteRun<TTraits> firstWrite;
+        firstWrite.Write();
+        const auto writtenAsset = firstWrite.GetWrittenAsset();
+        const auto sizeSuffix = " (" + std::to_string(writtenAsset.m_data.size()) + " bytes)";
+
+        // Makes sure the benchmark measures a successful round trip
+        {
+            LoadRun<TTraits> run(writtenAsset);
+            REQUIRE(run.Load() != nullptr);
+        }
+
+        BENCHMARK_ADVANCED("Write" + sizeSuffix)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<std::unique_ptr<WriteRun<TTraits>>> runs;
+            runs.reserve(meter.runs());
+            for (auto i = 0; i < meter.runs(); i++)
+                runs.emplace_back(std::make_unique<WriteRun<TTraits>>());
+
+            meter.measure(
+                [&runs](const int i)
+                {
+                    return runs[i]->Write();
+                });
+        };
+
+        BENCHMARK_ADVANCED("Load" + sizeSuffix)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<std::unique_ptr<LoadRun<TTraits>>> runs;
+            runs.reserve(meter.runs());
+            for (auto i = 0; i < meter.runs(); i++)
+                runs.emplace_back(std::make_unique<LoadRun<TTraits>>(writtenAsset));
+
+            meter.measure(
+                [&runs](const int i)
+                {
+                    return runs[i]->Load();
+                });
+        };
+    }
+} // namespace asset_benchmark
@@ -0,0 +1,104 @@
+#include "Writing/InMemoryZoneData.h"
+#include "Zone/Stream/Impl/InMemoryZoneOutputStream.h"
+#include "Zone/XBlock.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace benchmarks::zone::in_memory_zone_output_stream
+{
+    constexpr int BLOCK_BIT_COUNT = 4;
+    constexpr size_t ENTRY_COUNT = 20000u;
+    constexpr size_t ELEMENTS_PER_ENTRY = 4u;
+
+    struct SyntheticElement
+    {
+        int32_t values[4];
+    };
+
+    class StreamFixture
+    {
+    public:
+        InMemoryZoneData m_zone_data;
+        XBlock m_block;
+        InMemoryZoneOutputStream m_stream;
+
+        StreamFixture()
+            : m_block("normal", 0, XBlock::Type::BLOCK_TYPE_NORMAL),
+              m_stream(&m_zone_data, std::vector<XBlock*>{&m_block}, BLOCK_BIT_COUNT, 0, false)
+        {
+            m_stream.PushBlock(0);
+        }
+
+        ~StreamFixture()
+        {
+            m_stream.PopBlock();
+        }
+
+        StreamFixture(const StreamFixture& other) = delete;
+        StreamFixture(StreamFixture&& other) noexcept = delete;
+        StreamFixture& operator=(const StreamFixture& other) = delete;
+        StreamFixture& operator=(StreamFixture&& other) noexcept = delete;
+
+        // Writers only know the interface, which also provides the typed helpers
+        IZoneOutputStream& Stream()
+        {
+            return m_stream;
+        }
+
+        void AddEntries(std::vector<SyntheticElement>& elements)
+        {
+            for (auto i = 0u; i < ENTRY_COUNT; i++)
+            {
+                auto* entry = &elements[i * ELEMENTS_PER_ENTRY];
+                Stream().ReusableAddOffset(entry, ELEMENTS_PER_ENTRY);
+                Stream().Write(entry, ELEMENTS_PER_ENTRY);
+            }
+        }
+    };
+
+    TEST_CASE("InMemoryZoneOutputStream: Reusable entries", "[benchmark][zone][reusable]")
+    {
+        std::vector<SyntheticElement> elements(ENTRY_COUNT * ELEMENTS_PER_ENTRY);
+
+        BENCHMARK("Add 20000 reusable entries")
+        {
+            StreamFixture fixture;
+            fixture.AddEntries(elements);
+
+            return fixture.m_block.m_buffer_size;
+        };
+
+        StreamFixture fixture;
+        fixture.AddEntries(elements);
+
+        BENCHMARK("Resolve 80000 reused pointers")
+        {
+            uintptr_t checksum = 0u;
+            for (auto& element : elements)
+            {
+                auto* ptr = &element;
+                if (!fixture.Stream().ReusableShouldWrite(&ptr))
+                    checksum += reinterpret_cast<uintptr_t>(ptr);
+            }
+
+            return checksum;
+        };
+
+        std::vector<SyntheticElement> otherElements(ENTRY_COUNT * ELEMENTS_PER_ENTRY);
+        BENCHMARK("Miss 80000 pointers")
+        {
+            size_t missCount = 0u;
+            for (auto& element : otherElements)
+            {
+                auto* ptr = &element;
+                if (fixture.Stream().ReusableShouldWrite(&ptr))
+                    missCount++;
+            }
+
+            return missCount;
+        };
+    }
+} // namespace benchmarks::zone::in_memory_zone_output_stream
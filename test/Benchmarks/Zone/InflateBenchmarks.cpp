@@ -0,0 +1,104 @@
+#include "Loading/LoadingMemoryStream.h"
+#include "Loading/Processor/ProcessorInflate.h"
+#include "Loading/Processor/ProcessorReadAhead.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+#include <zlib.h>
+
+namespace benchmarks::zone::inflate
+{
+    constexpr size_t DATA_SIZE = 0x1000000;
+    constexpr size_t INFLATE_BUFFER_SIZE = 0x2000;
+
+    // Content loaders mostly load single members, so the data is loaded in small pieces of varying size
+    constexpr size_t LOAD_SIZES[]{4u, 8u, 2u, 16u, 4u, 64u, 1u, 12u, 256u, 4u};
+
+    std::vector<uint8_t> CreateZoneLikeData()
+    {
+        std::vector<uint8_t> data(DATA_SIZE);
+        std::mt19937 random(1337u);
+        std::uniform_int_distribution<unsigned> distribution(0u, 15u);
+        for (auto i = 0u; i < DATA_SIZE; i++)
+            data[i] = static_cast<uint8_t>(i % 64u < 48u ? distribution(random) : i % 251u);
+
+        return data;
+    }
+
+    std::vector<uint8_t> Deflate(const std::vector<uint8_t>& data)
+    {
+        auto compressedSize = compressBound(static_cast<uLong>(data.size()));
+        std::vector<uint8_t> compressedData(compressedSize);
+        compress(compressedData.data(), &compressedSize, data.data(), static_cast<uLong>(data.size()));
+        compressedData.resize(compressedSize);
+
+        return compressedData;
+    }
+
+    size_t LoadInPieces(ILoadingStream& stream, std::vector<uint8_t>& output)
+    {
+        size_t offset = 0u;
+        for (auto i = 0u; offset < output.size(); i++)
+        {
+            const auto loadSize = std::min(LOAD_SIZES[i % std::extent_v<decltype(LOAD_SIZES)>], output.size() - offset);
+            const auto loadedSize = stream.Load(&output[offset], loadSize);
+            offset += loadedSize;
+
+            if (loadedSize < loadSize)
+                break;
+        }
+
+        return offset;
+    }
+
+    TEST_CASE("Inflate: Decode throughput", "[benchmark][zone][inflate]")
+    {
+        const auto data = CreateZoneLikeData();
+        const auto compressedData = Deflate(data);
+        std::vector<uint8_t> inflatedData(data.size());
+
+        BENCHMARK("Inflate 16MiB inline")
+        {
+            LoadingMemoryStream input(compressedData.data(), compressedData.size());
+            ProcessorInflate inflate(INFLATE_BUFFER_SIZE);
+            inflate.SetBaseStream(&input);
+
+            return LoadInPieces(inflate, inflatedData);
+        };
+
+        REQUIRE(inflatedData == data);
+
+        std::ranges::fill(inflatedData, 0u);
+
+        BENCHMARK("Inflate 16MiB ahead")
+        {
+            LoadingMemoryStream input(compressedData.data(), compressedData.size());
+            ProcessorInflate inflate(INFLATE_BUFFER_SIZE);
+            inflate.SetBaseStream(&input);
+            ProcessorReadAhead readAhead;
+            readAhead.SetBaseStream(&inflate);
+
+            return LoadInPieces(readAhead, inflatedData);
+        };
+
+        REQUIRE(inflatedData == data);
+    }
+
+    TEST_CASE("Inflate: Reading ahead stops at the end of the stream", "[zone][inflate]")
+    {
+        const std::vector<uint8_t> data{1u, 2u, 3u, 4u, 5u};
+        LoadingMemoryStream input(data.data(), data.size());
+        ProcessorReadAhead readAhead(2u, 2u);
+        readAhead.SetBaseStream(&input);
+
+        std::vector<uint8_t> loadedData(8u);
+        REQUIRE(readAhead.Load(loadedData.data(), loadedData.size()) == data.size());
+        REQUIRE(std::equal(data.begin(), data.end(), loadedData.begin()));
+        REQUIRE(readAhead.Load(loadedData.data(), 1u) == 0u);
+    }
+} // namespace benchmarks::zone::inflate
@@ -0,0 +1,94 @@
+#include "Loading/LoadingMemoryStream.h"
+#include "Zone/Stream/Impl/XBlockInputStream.h"
+#include "Zone/XBlock.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace benchmarks::zone::xblock_input_stream
+{
+    constexpr int BLOCK_BIT_COUNT = 4;
+    constexpr size_t ASSET_COUNT = 50000u;
+    constexpr size_t NAME_LENGTH = 24u;
+
+    // Roughly resembles a small asset with a name, a few members and a reference to an array
+    struct SyntheticAsset
+    {
+        const char* name;
+        int32_t values[6];
+        float floats[4];
+        uint32_t count;
+        uint32_t* elements;
+    };
+
+    constexpr size_t ELEMENT_COUNT = 8u;
+    constexpr size_t ASSET_DATA_SIZE = sizeof(SyntheticAsset) + NAME_LENGTH + 1u + ELEMENT_COUNT * sizeof(uint32_t);
+
+    std::vector<uint8_t> CreateStreamData()
+    {
+        std::vector<uint8_t> data(ASSET_COUNT * ASSET_DATA_SIZE);
+        auto* pos = data.data();
+        for (auto i = 0u; i < ASSET_COUNT; i++)
+        {
+            SyntheticAsset asset{};
+            asset.values[0] = static_cast<int32_t>(i);
+            asset.count = ELEMENT_COUNT;
+            memcpy(pos, &asset, sizeof(asset));
+            pos += sizeof(asset);
+
+            memset(pos, 'a' + static_cast<int>(i % 26u), NAME_LENGTH);
+            pos[NAME_LENGTH] = 0u;
+            pos += NAME_LENGTH + 1u;
+
+            for (auto j = 0u; j < ELEMENT_COUNT; j++)
+            {
+                const auto element = static_cast<uint32_t>(i * ELEMENT_COUNT + j);
+                memcpy(pos, &element, sizeof(element));
+                pos += sizeof(element);
+            }
+        }
+
+        return data;
+    }
+
+    TEST_CASE("XBlockInputStream: Load throughput", "[benchmark][zone][xblock]")
+    {
+        const auto data = CreateStreamData();
+
+        XBlock tempBlock("temp", 0, XBlock::Type::BLOCK_TYPE_TEMP);
+        XBlock normalBlock("normal", 1, XBlock::Type::BLOCK_TYPE_NORMAL);
+        tempBlock.Alloc(sizeof(SyntheticAsset) + NAME_LENGTH + 1u);
+        normalBlock.Alloc(ASSET_COUNT * (ASSET_DATA_SIZE + alignof(SyntheticAsset)) + sizeof(void*));
+        std::vector<XBlock*> blocks{&tempBlock, &normalBlock};
+
+        BENCHMARK("Load 50000 synthetic assets")
+        {
+            LoadingMemoryStream memoryStream(data.data(), data.size());
+            XBlockInputStream stream(blocks, &memoryStream, BLOCK_BIT_COUNT, 1);
+
+            uint32_t checksum = 0u;
+            stream.PushBlock(1);
+            for (auto i = 0u; i < ASSET_COUNT; i++)
+            {
+                auto* asset = stream.Alloc<SyntheticAsset>(alignof(SyntheticAsset));
+                stream.Load<SyntheticAsset>(asset);
+
+                stream.PushBlock(0);
+                auto* name = stream.Alloc<char>(1);
+                stream.LoadNullTerminated(name);
+                stream.PopBlock();
+
+                asset->elements = stream.Alloc<uint32_t>(alignof(uint32_t));
+                stream.Load<uint32_t>(asset->elements, asset->count);
+                checksum += asset->elements[asset->count - 1u];
+            }
+            stream.PopBlock();
+
+            return checksum;
+        };
+    }
+} // namespace benchmarks::zone::xblock_input_stream
@@ -0,0 +1,95 @@
+#include "Loading/LoadingMemoryStream.h"
+#include "Loading/Processor/ProcessorXChunks.h"
+#include "Writing/IWritingStream.h"
+#include "Writing/Processor/OutputProcessorXChunks.h"
+#include "Zone/XChunk/XChunkProcessorDeflate.h"
+#include "Zone/XChunk/XChunkProcessorInflate.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace benchmarks::zone::xchunks
+{
+    constexpr int STREAM_COUNT = 4;
+    constexpr size_t XCHUNK_SIZE = 0x8000;
+    constexpr size_t XCHUNK_MAX_WRITE_SIZE = XCHUNK_SIZE - 0x40;
+    constexpr size_t DATA_SIZE = 0x1000000;
+
+    class MemoryWritingStream final : public IWritingStream
+    {
+    public:
+        std::vector<uint8_t> m_data;
+
+        void Write(const void* buffer, const size_t length) override
+        {
+            const auto* bytes = static_cast<const uint8_t*>(buffer);
+            m_data.insert(m_data.end(), bytes, bytes + length);
+        }
+
+        void Flush() override {}
+
+        int64_t Pos() override
+        {
+            return static_cast<int64_t>(m_data.size());
+        }
+    };
+
+    // Zone content compresses well but is not trivial, so the data consists of small values with some noise
+    std::vector<uint8_t> CreateZoneLikeData()
+    {
+        std::vector<uint8_t> data(DATA_SIZE);
+        std::mt19937 random(1337u);
+        std::uniform_int_distribution<unsigned> distribution(0u, 15u);
+        for (auto i = 0u; i < DATA_SIZE; i++)
+            data[i] = static_cast<uint8_t>(i % 64u < 48u ? distribution(random) : i % 251u);
+
+        return data;
+    }
+
+    std::vector<uint8_t> Encode(const std::vector<uint8_t>& data)
+    {
+        MemoryWritingStream output;
+        {
+            OutputProcessorXChunks processor(STREAM_COUNT, XCHUNK_SIZE, XCHUNK_MAX_WRITE_SIZE);
+            processor.AddChunkProcessor(std::make_unique<XChunkProcessorDeflate>());
+            processor.SetBaseStream(&output);
+            processor.Write(data.data(), data.size());
+            processor.Flush();
+        }
+
+        return std::move(output.m_data);
+    }
+
+    TEST_CASE("XChunks: Encode throughput", "[benchmark][zone][xchunks]")
+    {
+        const auto data = CreateZoneLikeData();
+
+        BENCHMARK("Deflate 16MiB in 4 streams")
+        {
+            return Encode(data).size();
+        };
+    }
+
+    TEST_CASE("XChunks: Decode throughput", "[benchmark][zone][xchunks]")
+    {
+        const auto data = CreateZoneLikeData();
+        const auto encodedData = Encode(data);
+        std::vector<uint8_t> decodedData(data.size());
+
+        BENCHMARK("Inflate 16MiB in 4 streams")
+        {
+            LoadingMemoryStream input(encodedData.data(), encodedData.size());
+            ProcessorXChunks processor(STREAM_COUNT, XCHUNK_SIZE);
+            processor.AddChunkProcessor(std::make_unique<XChunkProcessorInflate>(STREAM_COUNT));
+            processor.SetBaseStream(&input);
+
+            return processor.Load(decodedData.data(), decodedData.size());
+        };
+
+        REQUIRE(decodedData == data);
+    }
+} // namespace benchmarks::zone::xchunks
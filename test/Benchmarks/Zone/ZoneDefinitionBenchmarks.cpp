@@ -0,0 +1,73 @@
+#include "Zone/Definition/ZoneDefinitionStream.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <format>
+#include <sstream>
+#include <string>
+
+namespace benchmarks::zone::zone_definition
+{
+    constexpr size_t ASSET_COUNT = 100000u;
+
+    // Resembles a zone definition that was generated by dumping a large zone
+    std::string CreateZoneDefinition()
+    {
+        std::ostringstream ss;
+        ss << "// Generated zone definition\n";
+        ss << ">game,IW4\n";
+        ss << "include,common_assets\n";
+        ss << "\n";
+
+        for (auto i = 0u; i < ASSET_COUNT; i++)
+        {
+            switch (i % 8u)
+            {
+            case 0:
+                ss << std::format("material,,mc/asset_{}\n", i);
+                break;
+            case 1:
+                ss << std::format("xmodel,\"asset with // comment {}\"\n", i);
+                break;
+            default:
+                ss << std::format("rawfile,maps/asset_{}.gsc\n", i);
+                break;
+            }
+        }
+
+        return ss.str();
+    }
+
+    std::unique_ptr<ZoneDefinition> ReadZoneDefinition(const std::string& data)
+    {
+        std::istringstream stream(data);
+        ZoneDefinitionInputStream zoneDefinitionStream(stream, "benchmark.zone", false);
+        return zoneDefinitionStream.ReadDefinition();
+    }
+
+    TEST_CASE("ZoneDefinitionInputStream: Parsing throughput", "[benchmark][zone]")
+    {
+        const auto data = CreateZoneDefinition();
+
+        const auto definition = ReadZoneDefinition(data);
+        REQUIRE(definition);
+        REQUIRE(definition->m_assets.size() == ASSET_COUNT);
+        REQUIRE(definition->m_includes.size() == 1u);
+        REQUIRE(definition->m_metadata.size() == 1u);
+
+        REQUIRE(definition->m_assets[0].m_asset_type == "material");
+        REQUIRE(definition->m_assets[0].m_asset_name == "mc/asset_0");
+        REQUIRE(definition->m_assets[0].m_is_reference);
+        REQUIRE(definition->m_assets[1].m_asset_type == "xmodel");
+        REQUIRE(definition->m_assets[1].m_asset_name == "asset with // comment 1");
+        REQUIRE(!definition->m_assets[1].m_is_reference);
+        REQUIRE(definition->m_assets[2].m_asset_type == "rawfile");
+        REQUIRE(definition->m_assets[2].m_asset_name == "maps/asset_2.gsc");
+        REQUIRE(!definition->m_assets[2].m_is_reference);
+
+        BENCHMARK("Generated zone definition")
+        {
+            return ReadZoneDefinition(data)->m_assets.size();
+        };
+    }
+} // namespace benchmarks::zone::zone_definition
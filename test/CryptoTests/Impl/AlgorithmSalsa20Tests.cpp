@@ -0,0 +1,144 @@
+#include "Impl/AlgorithmSalsa20.h"
+#include "Impl/CpuFeatures.h"
+#include "salsa20.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    constexpr size_t BLOCK_SIZE = 64;
+
+    constexpr uint8_t KEY[]{0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+                            0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F};
+    constexpr uint8_t IV[]{0x3D, 0x9A, 0x07, 0xC2, 0x51, 0xE8, 0x6F, 0x14};
+
+    enum class Implementation
+    {
+        SCALAR,
+        SSE2,
+        AVX2
+    };
+
+    class ForcedImplementation
+    {
+    public:
+        explicit ForcedImplementation(const Implementation implementation)
+        {
+            switch (implementation)
+            {
+            case Implementation::SCALAR:
+                m_available = true;
+                CpuFeatures::SetDisabledFeatures(CpuFeatures::FEATURE_SSE2 | CpuFeatures::FEATURE_AVX2);
+                break;
+            case Implementation::SSE2:
+                m_available = CpuFeatures::HasSse2();
+                CpuFeatures::SetDisabledFeatures(CpuFeatures::FEATURE_AVX2);
+                break;
+            case Implementation::AVX2:
+                m_available = CpuFeatures::HasAvx2();
+                break;
+            }
+        }
+
+        ~ForcedImplementation()
+        {
+            CpuFeatures::SetDisabledFeatures(0u);
+        }
+
+        ForcedImplementation(const ForcedImplementation& other) = delete;
+        ForcedImplementation(ForcedImplementation&& other) noexcept = delete;
+        ForcedImplementation& operator=(const ForcedImplementation& other) = delete;
+        ForcedImplementation& operator=(ForcedImplementation&& other) noexcept = delete;
+
+        bool m_available = false;
+    };
+
+    std::vector<uint8_t> CreatePlainText(const size_t size)
+    {
+        std::vector<uint8_t> plainText(size);
+        for (auto i = 0u; i < size; i++)
+            plainText[i] = static_cast<uint8_t>(i * 31u + 7u);
+
+        return plainText;
+    }
+
+    // Encrypts the same plain text with thirdparty/salsa20 and AlgorithmSalsa20 using the same sequence of Process calls
+    void RequireSameAsReference(const std::vector<size_t>& callSizes, const uint64_t startCounter = 0u)
+    {
+        size_t totalSize = 0u;
+        for (const auto callSize : callSizes)
+            totalSize += callSize;
+
+        const auto plainText = CreatePlainText(totalSize);
+
+        salsa20_ctx_t referenceContext{};
+        Salsa20_KeySetup(&referenceContext, KEY, sizeof(KEY) * 8);
+        Salsa20_IVSetup(&referenceContext, IV);
+        referenceContext.m_input[8] = static_cast<uint32_t>(startCounter);
+        referenceContext.m_input[9] = static_cast<uint32_t>(startCounter >> 32);
+
+        AlgorithmSalsa20 salsa20(KEY, sizeof(KEY));
+        salsa20.SetIV(IV, sizeof(IV));
+        salsa20.SetBlockCounter(startCounter);
+
+        std::vector<uint8_t> expected(totalSize);
+        std::vector<uint8_t> actual(totalSize);
+        size_t offset = 0u;
+        for (const auto callSize : callSizes)
+        {
+            Salsa20_Encrypt_Bytes(&referenceContext, &plainText[offset], &expected[offset], static_cast<uint32_t>(callSize));
+            salsa20.Process(&plainText[offset], &actual[offset], callSize);
+            offset += callSize;
+        }
+
+        REQUIRE(actual == expected);
+    }
+
+    TEST_CASE("AlgorithmSalsa20: Produces the same output as the reference implementation", "[crypto][salsa20]")
+    {
+        const auto implementation = GENERATE(Implementation::SCALAR, Implementation::SSE2, Implementation::AVX2);
+        const ForcedImplementation forcedImplementation(implementation);
+        if (!forcedImplementation.m_available)
+            SKIP("Implementation is not supported by this CPU");
+
+        SECTION("Partial blocks")
+        {
+            RequireSameAsReference({1u});
+            RequireSameAsReference({BLOCK_SIZE - 1u});
+            RequireSameAsReference({BLOCK_SIZE + 1u});
+        }
+
+        SECTION("Whole blocks")
+        {
+            RequireSameAsReference({BLOCK_SIZE});
+            RequireSameAsReference({4u * BLOCK_SIZE});
+            RequireSameAsReference({8u * BLOCK_SIZE});
+            RequireSameAsReference({16u * BLOCK_SIZE});
+        }
+
+        SECTION("Block counts that are not a multiple of 4 or 8")
+        {
+            RequireSameAsReference({3u * BLOCK_SIZE + 17u});
+            RequireSameAsReference({5u * BLOCK_SIZE + 3u});
+            RequireSameAsReference({13u * BLOCK_SIZE + 31u});
+            RequireSameAsReference({15u * BLOCK_SIZE});
+        }
+
+        SECTION("Multiple calls that each start a new block")
+        {
+            RequireSameAsReference({5u, 4u * BLOCK_SIZE + 1u, 9u * BLOCK_SIZE, BLOCK_SIZE - 7u, 12u * BLOCK_SIZE + 40u});
+        }
+
+        SECTION("Counter carrying from word 8 into word 9")
+        {
+            RequireSameAsReference({13u * BLOCK_SIZE + 31u}, 0xFFFFFFFFull - 5u);
+            RequireSameAsReference({8u * BLOCK_SIZE}, 0xFFFFFFFFull - 3u);
+            RequireSameAsReference({4u * BLOCK_SIZE}, 0xFFFFFFFFull - 1u);
+            RequireSameAsReference({BLOCK_SIZE + 1u}, 0xFFFFFFFFull);
+            RequireSameAsReference({3u * BLOCK_SIZE, 2u * BLOCK_SIZE + 9u, 8u * BLOCK_SIZE}, 0x1FFFFFFFEull);
+        }
+    }
+} // namespace
@@ -0,0 +1,164 @@
+#include "Impl/AlgorithmSHA1.h"
+#include "Impl/AlgorithmSHA256.h"
+#include "Impl/CpuFeatures.h"
+#include "Impl/ShaExtensionsHash.h"
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // FIPS 180 example messages
+    const std::string MESSAGE_ABC = "abc";
+    const std::string MESSAGE_56_BYTES = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    const std::string MESSAGE_112_BYTES =
+        "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu";
+
+    enum class Implementation
+    {
+        LIBTOMCRYPT,
+        SHA_EXTENSIONS
+    };
+
+    class ForcedImplementation
+    {
+    public:
+        explicit ForcedImplementation(const Implementation implementation)
+        {
+            if (implementation == Implementation::LIBTOMCRYPT)
+            {
+                m_available = true;
+                CpuFeatures::SetDisabledFeatures(CpuFeatures::FEATURE_SHA);
+            }
+            else
+                m_available = ShaExtensionsHash::IsSupported();
+        }
+
+        ~ForcedImplementation()
+        {
+            CpuFeatures::SetDisabledFeatures(0u);
+        }
+
+        ForcedImplementation(const ForcedImplementation& other) = delete;
+        ForcedImplementation(ForcedImplementation&& other) noexcept = delete;
+        ForcedImplementation& operator=(const ForcedImplementation& other) = delete;
+        ForcedImplementation& operator=(ForcedImplementation&& other) noexcept = delete;
+
+        bool m_available = false;
+    };
+
+    template<typename THash> std::unique_ptr<IHashFunction> CreateHash(const Implementation implementation)
+    {
+        const ForcedImplementation forcedImplementation(implementation);
+        return std::make_unique<THash>();
+    }
+
+    // Feeds the input in chunks of the specified size to also cover hashing input that is not passed at once
+    std::string ComputeHash(IHashFunction& hash, const void* input, const size_t inputSize, const size_t chunkSize)
+    {
+        const auto* inputBytes = static_cast<const uint8_t*>(input);
+
+        hash.Init();
+        for (size_t offset = 0u; offset < inputSize; offset += chunkSize)
+            hash.Process(&inputBytes[offset], std::min(chunkSize, inputSize - offset));
+
+        std::vector<uint8_t> hashBuffer(hash.GetHashSize());
+        hash.Finish(hashBuffer.data());
+
+        std::string hexHash;
+        char hexByte[3];
+        for (const auto hashByte : hashBuffer)
+        {
+            snprintf(hexByte, sizeof(hexByte), "%02x", hashByte);
+            hexHash += hexByte;
+        }
+
+        return hexHash;
+    }
+
+    std::string ComputeHash(IHashFunction& hash, const std::string& input)
+    {
+        return ComputeHash(hash, input.data(), input.size(), input.empty() ? 1u : input.size());
+    }
+
+    std::string ComputeMillionTimesA(IHashFunction& hash)
+    {
+        const std::string input(1000000u, 'a');
+        return ComputeHash(hash, input.data(), input.size(), 1000u);
+    }
+
+    std::vector<uint8_t> CreateInput(const size_t size)
+    {
+        std::vector<uint8_t> input(size);
+        for (auto i = 0u; i < size; i++)
+            input[i] = static_cast<uint8_t>(i * 131u + 17u);
+
+        return input;
+    }
+
+    TEST_CASE("ShaExtensionsHash: Computes SHA1 test vectors", "[crypto][sha1]")
+    {
+        const auto implementation = GENERATE(Implementation::LIBTOMCRYPT, Implementation::SHA_EXTENSIONS);
+        if (!ForcedImplementation(implementation).m_available)
+            SKIP("Implementation is not supported by this CPU");
+
+        const auto hash = CreateHash<AlgorithmSHA1>(implementation);
+
+        REQUIRE(ComputeHash(*hash, "") == "da39a3ee5e6b4b0d3255bfef95601890afd80709");
+        REQUIRE(ComputeHash(*hash, MESSAGE_ABC) == "a9993e364706816aba3e25717850c26c9cd0d89d");
+        REQUIRE(ComputeHash(*hash, MESSAGE_56_BYTES) == "84983e441c3bd26ebaae4aa1f95129e5e54670f1");
+        REQUIRE(ComputeHash(*hash, MESSAGE_112_BYTES) == "a49b2446a02c645bf419f995b67091253a04a259");
+        REQUIRE(ComputeMillionTimesA(*hash) == "34aa973cd4c4daa4f61eeb2bdbad27316534016f");
+    }
+
+    TEST_CASE("ShaExtensionsHash: Computes SHA256 test vectors", "[crypto][sha256]")
+    {
+        const auto implementation = GENERATE(Implementation::LIBTOMCRYPT, Implementation::SHA_EXTENSIONS);
+        if (!ForcedImplementation(implementation).m_available)
+            SKIP("Implementation is not supported by this CPU");
+
+        const auto hash = CreateHash<AlgorithmSHA256>(implementation);
+
+        REQUIRE(ComputeHash(*hash, "") == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+        REQUIRE(ComputeHash(*hash, MESSAGE_ABC) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+        REQUIRE(ComputeHash(*hash, MESSAGE_56_BYTES) == "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+        REQUIRE(ComputeHash(*hash, MESSAGE_112_BYTES) == "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1");
+        REQUIRE(ComputeMillionTimesA(*hash) == "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+    }
+
+    template<typename THash> void RequireSameAsLibtomcrypt()
+    {
+        const auto accelerated = CreateHash<THash>(Implementation::SHA_EXTENSIONS);
+        const auto reference = CreateHash<THash>(Implementation::LIBTOMCRYPT);
+
+        // Covers every length around the padding boundary at 56 bytes and the block boundary at 64 bytes for up to three blocks
+        const auto input = CreateInput(3u * 64u + 1u);
+        for (auto inputSize = 0u; inputSize <= input.size(); inputSize++)
+        {
+            for (const auto chunkSize : {1u, 7u, 55u, 56u, 63u, 64u, 65u, 200u})
+                REQUIRE(ComputeHash(*accelerated, input.data(), inputSize, chunkSize) == ComputeHash(*reference, input.data(), inputSize, chunkSize));
+        }
+    }
+
+    TEST_CASE("ShaExtensionsHash: Produces the same SHA1 hashes as libtomcrypt", "[crypto][sha1]")
+    {
+        if (!ShaExtensionsHash::IsSupported())
+            SKIP("SHA extensions are not supported by this CPU");
+
+        RequireSameAsLibtomcrypt<AlgorithmSHA1>();
+    }
+
+    TEST_CASE("ShaExtensionsHash: Produces the same SHA256 hashes as libtomcrypt", "[crypto][sha256]")
+    {
+        if (!ShaExtensionsHash::IsSupported())
+            SKIP("SHA extensions are not supported by this CPU");
+
+        RequireSameAsLibtomcrypt<AlgorithmSHA256>();
+    }
+} // namespace
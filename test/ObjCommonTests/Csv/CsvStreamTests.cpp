@@ -0,0 +1,69 @@
+#include "Csv/CsvStream.h"
+#include "Utils/MemoryManager.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <string>
+
+using namespace std::literals;
+
+namespace
+{
+    TEST_CASE("CsvInputStream: Reading all rows pads missing cells", "[csv]")
+    {
+        std::istringstream stream("test,data,lol\r\n"
+                                  "lorem,ipsum\n"
+                                  "\n"
+                                  "a,,b,c\n");
+        const CsvInputStream csv(stream);
+        MemoryManager memory;
+
+        CsvCells cells;
+        csv.ReadAllRows(cells, memory);
+
+        REQUIRE(cells.m_row_count == 4u);
+        REQUIRE(cells.m_column_count == 4u);
+        REQUIRE(cells.m_cells.size() == 16u);
+
+        CHECK(cells.m_cells[0] == "test"s);
+        CHECK(cells.m_cells[1] == "data"s);
+        CHECK(cells.m_cells[2] == "lol"s);
+        CHECK(cells.m_cells[3] == ""s);
+        CHECK(cells.m_cells[4] == "lorem"s);
+        CHECK(cells.m_cells[5] == "ipsum"s);
+        CHECK(cells.m_cells[6] == ""s);
+        CHECK(cells.m_cells[8] == ""s);
+        CHECK(cells.m_cells[12] == "a"s);
+        CHECK(cells.m_cells[13] == ""s);
+        CHECK(cells.m_cells[14] == "b"s);
+        CHECK(cells.m_cells[15] == "c"s);
+    }
+
+    TEST_CASE("CsvInputStream: Reading all rows unescapes cells written by CsvOutputStream", "[csv]")
+    {
+        std::ostringstream output;
+        CsvOutputStream csvOutput(output);
+        csvOutput.WriteColumn("plain");
+        csvOutput.WriteColumn("with,separator");
+        csvOutput.WriteColumn("with \"quote\"");
+        csvOutput.NextRow();
+        csvOutput.WriteColumn("mid\"dle");
+        csvOutput.NextRow();
+
+        std::istringstream input(output.str());
+        const CsvInputStream csvInput(input);
+
+        std::vector<std::vector<std::string>> rows;
+        csvInput.ReadAllRows(rows);
+
+        REQUIRE(rows.size() == 2u);
+        REQUIRE(rows[0].size() == 3u);
+        CHECK(rows[0][0] == "plain");
+        CHECK(rows[0][1] == "with,separator");
+        CHECK(rows[0][2] == "with \"quote\"");
+        REQUIRE(rows[1].size() == 3u);
+        CHECK(rows[1][0] == "mid\"dle");
+        CHECK(rows[1][1].empty());
+        CHECK(rows[1][2].empty());
+    }
+} // namespace
@@ -0,0 +1,125 @@
+#include "Image/BlockCompression.h"
+#include "Image/TextureConverter.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+
+namespace image::block_compression
+{
+    TEST_CASE("BlockCompression: Ensure known BC1 blocks are decoded", "[image]")
+    {
+        // Red and blue endpoints with the indices 0, 1, 2 and 3 in every row
+        constexpr uint8_t block[]{0x00, 0xF8, 0x1F, 0x00, 0xE4, 0xE4, 0xE4, 0xE4};
+
+        ::block_compression::BlockPixels pixels{};
+        ::block_compression::DecodeBlock(ImageFormatId::BC1, block, pixels);
+
+        REQUIRE(pixels[0] == 255);
+        REQUIRE(pixels[2] == 0);
+        REQUIRE(pixels[4] == 0);
+        REQUIRE(pixels[6] == 255);
+        REQUIRE(pixels[8] == 170);
+        REQUIRE(pixels[10] == 85);
+        REQUIRE(pixels[12] == 85);
+        REQUIRE(pixels[14] == 170);
+        REQUIRE(pixels[15] == 255);
+    }
+
+    TEST_CASE("BlockCompression: Ensure BC1 encodes transparent pixels with punch through alpha", "[image]")
+    {
+        ::block_compression::BlockPixels pixels{};
+        for (auto pixel = 0u; pixel < ::block_compression::BLOCK_PIXEL_COUNT; pixel++)
+        {
+            pixels[pixel * 4u + 0u] = 200;
+            pixels[pixel * 4u + 1u] = 100;
+            pixels[pixel * 4u + 2u] = 50;
+            pixels[pixel * 4u + 3u] = pixel % 2u == 0u ? 255 : 0;
+        }
+
+        uint8_t block[8]{};
+        ::block_compression::EncodeBlock(ImageFormatId::BC1, pixels, block);
+
+        ::block_compression::BlockPixels decoded{};
+        ::block_compression::DecodeBlock(ImageFormatId::BC1, block, decoded);
+
+        for (auto pixel = 0u; pixel < ::block_compression::BLOCK_PIXEL_COUNT; pixel++)
+        {
+            REQUIRE(decoded[pixel * 4u + 3u] == pixels[pixel * 4u + 3u]);
+            if (pixels[pixel * 4u + 3u] != 0)
+            {
+                REQUIRE(std::abs(decoded[pixel * 4u + 0u] - 200) <= 4);
+                REQUIRE(std::abs(decoded[pixel * 4u + 1u] - 100) <= 2);
+                REQUIRE(std::abs(decoded[pixel * 4u + 2u] - 50) <= 4);
+            }
+        }
+    }
+
+    TEST_CASE("BlockCompression: Ensure BC4 keeps the extremes of a channel exactly", "[image]")
+    {
+        ::block_compression::BlockPixels pixels{};
+        for (auto pixel = 0u; pixel < ::block_compression::BLOCK_PIXEL_COUNT; pixel++)
+            pixels[pixel * 4u] = static_cast<uint8_t>(pixel * 17u);
+
+        uint8_t block[8]{};
+        ::block_compression::EncodeBlock(ImageFormatId::BC4, pixels, block);
+
+        ::block_compression::BlockPixels decoded{};
+        ::block_compression::DecodeBlock(ImageFormatId::BC4, block, decoded);
+
+        REQUIRE(decoded[0] == 0);
+        REQUIRE(decoded[15u * 4u] == 255);
+        for (auto pixel = 0u; pixel < ::block_compression::BLOCK_PIXEL_COUNT; pixel++)
+        {
+            REQUIRE(std::abs(decoded[pixel * 4u] - pixels[pixel * 4u]) <= 19);
+            REQUIRE(decoded[pixel * 4u + 3u] == 255);
+        }
+    }
+
+    TEST_CASE("BlockCompression: Ensure textures round trip through TextureConverter", "[image]")
+    {
+        constexpr auto width = 7u;
+        constexpr auto height = 5u;
+
+        for (const auto* format : {&ImageFormat::FORMAT_BC1, &ImageFormat::FORMAT_BC2, &ImageFormat::FORMAT_BC3})
+        {
+            Texture2D input(&ImageFormat::FORMAT_B8_G8_R8_A8, width, height, true);
+            input.Allocate();
+
+            for (auto mipLevel = 0; mipLevel < input.GetMipMapCount(); mipLevel++)
+            {
+                auto* buffer = input.GetBufferForMipLevel(mipLevel, 0);
+                const auto size = input.GetSizeOfMipLevel(mipLevel);
+                for (auto i = 0u; i < size; i += 4u)
+                {
+                    buffer[i + 0u] = 40;
+                    buffer[i + 1u] = 120;
+                    buffer[i + 2u] = 240;
+                    buffer[i + 3u] = 255;
+                }
+            }
+
+            TextureConverter encoder(&input, format);
+            const std::unique_ptr<Texture> compressed(encoder.Convert());
+            REQUIRE(compressed->GetFormat() == format);
+            REQUIRE(compressed->GetMipMapCount() == input.GetMipMapCount());
+
+            TextureConverter decoder(compressed.get(), &ImageFormat::FORMAT_B8_G8_R8_A8);
+            const std::unique_ptr<Texture> output(decoder.Convert());
+
+            for (auto mipLevel = 0; mipLevel < output->GetMipMapCount(); mipLevel++)
+            {
+                const auto* buffer = output->GetBufferForMipLevel(mipLevel);
+                const auto size = output->GetSizeOfMipLevel(mipLevel);
+                for (auto i = 0u; i < size; i += 4u)
+                {
+                    REQUIRE(std::abs(buffer[i + 0u] - 40) <= 4);
+                    REQUIRE(std::abs(buffer[i + 1u] - 120) <= 2);
+                    REQUIRE(std::abs(buffer[i + 2u] - 240) <= 4);
+                    REQUIRE(buffer[i + 3u] == 255);
+                }
+            }
+        }
+    }
+} // namespace image::block_compression
@@ -0,0 +1,112 @@
+#include "Image/MipMapGenerator.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace image::mip_map_generator
+{
+    TEST_CASE("MipMapGenerator: Ensure box filter averages pixels of 2D textures", "[image]")
+    {
+        Texture2D input(&ImageFormat::FORMAT_R8, 4u, 2u);
+        input.Allocate();
+
+        constexpr uint8_t pixels[]{0, 100, 200, 200, 100, 200, 0, 200};
+        auto* buffer = input.GetBufferForMipLevel(0, 0);
+        for (auto i = 0u; i < std::extent_v<decltype(pixels)>; i++)
+            buffer[i] = pixels[i];
+
+        const MipMapGenerator generator(&input, MipMapFilter::BOX, false);
+        const std::unique_ptr<Texture> output(generator.Generate());
+
+        REQUIRE(output);
+        REQUIRE(output->HasMipMaps());
+        REQUIRE(output->GetMipMapCount() == 3);
+
+        const auto* mip0 = output->GetBufferForMipLevel(0);
+        for (auto i = 0u; i < std::extent_v<decltype(pixels)>; i++)
+            REQUIRE(mip0[i] == pixels[i]);
+
+        const auto* mip1 = output->GetBufferForMipLevel(1);
+        REQUIRE(mip1[0] == 100);
+        REQUIRE(mip1[1] == 150);
+
+        const auto* mip2 = output->GetBufferForMipLevel(2);
+        REQUIRE(mip2[0] == 125);
+    }
+
+    TEST_CASE("MipMapGenerator: Ensure srgb color is filtered in linear space but alpha is not", "[image]")
+    {
+        Texture2D input(&ImageFormat::FORMAT_R8_G8_B8_A8, 2u, 1u);
+        input.Allocate();
+
+        auto* buffer = input.GetBufferForMipLevel(0, 0);
+        constexpr uint8_t pixels[]{0, 0, 0, 0, 255, 255, 255, 255};
+        for (auto i = 0u; i < std::extent_v<decltype(pixels)>; i++)
+            buffer[i] = pixels[i];
+
+        const MipMapGenerator generator(&input, MipMapFilter::BOX, true);
+        const std::unique_ptr<Texture> output(generator.Generate());
+
+        REQUIRE(output);
+        const auto* mip1 = output->GetBufferForMipLevel(1);
+
+        // Half of linear white is 188 in srgb
+        REQUIRE(mip1[0] == 188);
+        REQUIRE(mip1[1] == 188);
+        REQUIRE(mip1[2] == 188);
+        REQUIRE(mip1[3] == 128);
+    }
+
+    TEST_CASE("MipMapGenerator: Ensure every face of cube textures is filtered on its own", "[image]")
+    {
+        TextureCube input(&ImageFormat::FORMAT_A8, 2u, 2u);
+        input.Allocate();
+
+        for (auto face = 0; face < input.GetFaceCount(); face++)
+        {
+            auto* buffer = input.GetBufferForMipLevel(0, face);
+            for (auto i = 0u; i < 4u; i++)
+                buffer[i] = static_cast<uint8_t>(face * 40);
+        }
+
+        const MipMapGenerator generator(&input, MipMapFilter::KAISER, false);
+        const std::unique_ptr<Texture> output(generator.Generate());
+
+        REQUIRE(output);
+        REQUIRE(output->GetTextureType() == TextureType::T_CUBE);
+        for (auto face = 0; face < output->GetFaceCount(); face++)
+            REQUIRE(output->GetBufferForMipLevel(1, face)[0] == face * 40);
+    }
+
+    TEST_CASE("MipMapGenerator: Ensure 3D textures are filtered along their depth", "[image]")
+    {
+        Texture3D input(&ImageFormat::FORMAT_R8, 1u, 1u, 2u);
+        input.Allocate();
+
+        auto* buffer = input.GetBufferForMipLevel(0, 0);
+        buffer[0] = 10;
+        buffer[1] = 30;
+
+        const MipMapGenerator generator(&input, MipMapFilter::BOX, false);
+        const std::unique_ptr<Texture> output(generator.Generate());
+
+        REQUIRE(output);
+        REQUIRE(output->GetMipMapCount() == 2);
+        REQUIRE(output->GetBufferForMipLevel(1)[0] == 20);
+    }
+
+    TEST_CASE("MipMapGenerator: Ensure block compressed formats are not supported", "[image]")
+    {
+        REQUIRE(MipMapGenerator::SupportsFormat(&ImageFormat::FORMAT_B8_G8_R8_X8));
+        REQUIRE(!MipMapGenerator::SupportsFormat(&ImageFormat::FORMAT_BC1));
+        REQUIRE(!MipMapGenerator::SupportsFormat(&ImageFormat::FORMAT_R16_G16_B16_A16_FLOAT));
+
+        Texture2D input(&ImageFormat::FORMAT_BC3, 4u, 4u);
+        input.Allocate();
+
+        const MipMapGenerator generator(&input, MipMapFilter::BOX, false);
+        REQUIRE(generator.Generate() == nullptr);
+    }
+} // namespace image::mip_map_generator
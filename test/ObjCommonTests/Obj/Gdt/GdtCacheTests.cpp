@@ -0,0 +1,92 @@
+#include "Obj/Gdt/GdtCache.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace obj::gdt
+{
+    const char* TEST_GDT = "{\n"
+                           "\t\"test_entry\" ( \"test.gdf\" )\n"
+                           "\t{\n"
+                           "\t\t\"testkey\" \"testvalue\"\n"
+                           "\t}\n"
+                           "\t\"child_entry\" [ \"test_entry\" ]\n"
+                           "\t{\n"
+                           "\t\t\"childkey\" \"childvalue\"\n"
+                           "\t}\n"
+                           "}";
+
+    void VerifyTestGdt(const Gdt& gdt)
+    {
+        REQUIRE(gdt.m_entries.size() == 2);
+
+        const auto& entry = *gdt.m_entries[0];
+        REQUIRE(entry.m_name == "test_entry");
+        REQUIRE(entry.m_gdf_name == "test.gdf");
+        REQUIRE(entry.m_parent == nullptr);
+        REQUIRE(entry.m_properties.size() == 1);
+        REQUIRE(entry.m_properties.at("testkey") == "testvalue");
+
+        const auto& childEntry = *gdt.m_entries[1];
+        REQUIRE(childEntry.m_name == "child_entry");
+        REQUIRE(childEntry.m_gdf_name == "test.gdf");
+        REQUIRE(childEntry.m_parent == gdt.m_entries[0].get());
+        REQUIRE(childEntry.m_properties.size() == 1);
+        REQUIRE(childEntry.m_properties.at("childkey") == "childvalue");
+    }
+
+    TEST_CASE("GdtCache: Returns the same gdt when reading it from the cache", "[gdt][cache]")
+    {
+        GdtCache cache;
+
+        std::istringstream ss0(TEST_GDT);
+        const auto gdt0 = cache.ReadGdt("test", ss0);
+        REQUIRE(gdt0);
+        VerifyTestGdt(*gdt0);
+
+        std::istringstream ss1(TEST_GDT);
+        const auto gdt1 = cache.ReadGdt("test", ss1);
+        REQUIRE(gdt1);
+        REQUIRE(gdt1 != gdt0);
+        VerifyTestGdt(*gdt1);
+    }
+
+    TEST_CASE("GdtCache: Does not return gdts that failed to parse", "[gdt][cache]")
+    {
+        GdtCache cache;
+
+        std::istringstream ss("{\n\t\"test_entry\" [ \"unknown_parent\" ]\n\t{\n\t}\n}");
+        REQUIRE(!cache.ReadGdt("test", ss));
+    }
+
+    TEST_CASE("GdtCache: Keeps gdts when saving and loading the cache", "[gdt][cache]")
+    {
+        const auto cacheFilePath = (fs::temp_directory_path() / "oat_gdt_cache_test.bin").string();
+        const auto secondCacheFilePath = (fs::temp_directory_path() / "oat_gdt_cache_test_2.bin").string();
+        fs::remove(secondCacheFilePath);
+
+        {
+            GdtCache cache;
+            std::istringstream ss(TEST_GDT);
+            REQUIRE(cache.ReadGdt("test", ss));
+            REQUIRE(cache.Save(cacheFilePath));
+        }
+
+        GdtCache cache;
+        REQUIRE(cache.Load(cacheFilePath));
+
+        std::istringstream ss(TEST_GDT);
+        const auto gdt = cache.ReadGdt("test", ss);
+        REQUIRE(gdt);
+        VerifyTestGdt(*gdt);
+
+        // The gdt was read from the loaded cache so there is nothing new to save
+        REQUIRE(cache.Save(secondCacheFilePath));
+        REQUIRE(!fs::exists(secondCacheFilePath));
+
+        fs::remove(cacheFilePath);
+    }
+} // namespace obj::gdt
@@ -0,0 +1,105 @@
+#include "Shader/D3D11ShaderAnalyser.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace d3d11;
+
+namespace
+{
+    void AppendU32(std::vector<uint8_t>& data, const uint32_t value)
+    {
+        const auto offset = data.size();
+        data.resize(offset + sizeof(value));
+        std::memcpy(&data[offset], &value, sizeof(value));
+    }
+
+    // Builds a ps_4_0 shader with one constant buffer containing one variable and one bound texture
+    std::vector<uint8_t> CreatePixelShader()
+    {
+        constexpr uint32_t CONSTANT_BUFFER_OFFSET = 28u;
+        constexpr uint32_t VARIABLE_OFFSET = CONSTANT_BUFFER_OFFSET + 24u;
+        constexpr uint32_t BOUND_RESOURCE_OFFSET = VARIABLE_OFFSET + 24u;
+        constexpr uint32_t STRINGS_OFFSET = BOUND_RESOURCE_OFFSET + 32u;
+
+        std::vector<uint8_t> rdef;
+        for (const auto value : {1u, CONSTANT_BUFFER_OFFSET, 1u, BOUND_RESOURCE_OFFSET, 0xFFFF0400u, 0u, STRINGS_OFFSET})
+            AppendU32(rdef, value);
+        for (const auto value : {STRINGS_OFFSET + 4u, 1u, VARIABLE_OFFSET, 16u, 0u, 0u})
+            AppendU32(rdef, value);
+        for (const auto value : {STRINGS_OFFSET + 15u, 0u, 16u, 2u, 0u, 0u})
+            AppendU32(rdef, value);
+        for (const auto value : {STRINGS_OFFSET + 25u, 2u, 5u, 4u, 0xFFFFFFFFu, 3u, 1u, 0u})
+            AppendU32(rdef, value);
+
+        constexpr char STRINGS[] = "OAT\0$Globals\0\0\0colorTint\0colorMap";
+        rdef.insert(rdef.end(), std::begin(STRINGS), std::end(STRINGS));
+        rdef.resize((rdef.size() + 3u) & ~3u);
+
+        std::vector<uint8_t> shader;
+        for (const auto value : {0x43425844u, 0u, 0u, 0u, 0u, 1u, 0u, 2u, 40u, 0u})
+            AppendU32(shader, value);
+        AppendU32(shader, 'R' | 'D' << 8 | 'E' << 16 | 'F' << 24);
+        AppendU32(shader, static_cast<uint32_t>(rdef.size()));
+        shader.insert(shader.end(), rdef.begin(), rdef.end());
+
+        const auto shdrOffset = static_cast<uint32_t>(shader.size());
+        std::memcpy(&shader[36], &shdrOffset, sizeof(shdrOffset));
+        AppendU32(shader, 'S' | 'H' << 8 | 'D' << 16 | 'R' << 24);
+        AppendU32(shader, 4u);
+        AppendU32(shader, 0x40u);
+
+        return shader;
+    }
+
+    TEST_CASE("D3D11ShaderAnalyser: Reads views into the bytecode", "[shader][d3d11]")
+    {
+        const auto shader = CreatePixelShader();
+
+        ShaderInfoView view;
+        REQUIRE(ShaderAnalyser::GetShaderInfoView(shader.data(), shader.size(), view));
+        REQUIRE(view.m_type == ShaderType::PIXEL_SHADER);
+        REQUIRE(view.m_version_major == 4u);
+        REQUIRE(view.m_creator == "OAT");
+
+        REQUIRE(view.GetConstantBufferCount() == 1u);
+        const auto constantBuffer = view.GetConstantBuffer(0u);
+        REQUIRE(constantBuffer.m_name == "$Globals");
+        REQUIRE(constantBuffer.m_size == 16u);
+        REQUIRE(constantBuffer.GetVariableCount() == 1u);
+        REQUIRE(constantBuffer.GetVariable(0u).m_name == "colorTint");
+        REQUIRE(constantBuffer.GetVariable(0u).m_size == 16u);
+
+        REQUIRE(view.GetBoundResourceCount() == 1u);
+        const auto boundResource = view.GetBoundResource(0u);
+        REQUIRE(boundResource.m_name == "colorMap");
+        REQUIRE(boundResource.m_type == BoundResourceType::TEXTURE);
+        REQUIRE(boundResource.m_dimension == BoundResourceDimension::TEXTURE_2D);
+        REQUIRE(boundResource.m_bind_point == 3u);
+    }
+
+    TEST_CASE("D3D11ShaderAnalyser: Copies views into shader info", "[shader][d3d11]")
+    {
+        const auto shader = CreatePixelShader();
+        const auto shaderInfo = ShaderAnalyser::GetShaderInfo(shader.data(), shader.size());
+
+        REQUIRE(shaderInfo);
+        REQUIRE(shaderInfo->m_constant_buffers.size() == 1u);
+        REQUIRE(shaderInfo->m_constant_buffers[0].m_variables.size() == 1u);
+        REQUIRE(shaderInfo->m_constant_buffers[0].m_variables[0].m_name == "colorTint");
+        REQUIRE(shaderInfo->m_bound_resources.size() == 1u);
+        REQUIRE(shaderInfo->m_bound_resources[0].m_name == "colorMap");
+    }
+
+    TEST_CASE("D3D11ShaderAnalyser: Rejects variables outside of the resource definitions", "[shader][d3d11]")
+    {
+        auto shader = CreatePixelShader();
+        const uint32_t variableCount = 0x10000u;
+        std::memcpy(&shader[48 + 28 + 4], &variableCount, sizeof(variableCount));
+
+        ShaderInfoView view;
+        REQUIRE(!ShaderAnalyser::GetShaderInfoView(shader.data(), shader.size(), view));
+    }
+} // namespace
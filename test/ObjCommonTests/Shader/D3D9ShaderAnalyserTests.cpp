@@ -0,0 +1,89 @@
+#include "Shader/D3D9ShaderAnalyser.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace d3d9;
+
+namespace
+{
+    // Builds a ps_3_0 shader with a constant table containing a single sampler constant
+    std::vector<uint32_t> CreatePixelShader()
+    {
+        std::vector<uint8_t> table(28u + 20u + 16u);
+        const auto appendString = [&table](const std::string& str)
+        {
+            const auto offset = static_cast<uint32_t>(table.size());
+            table.insert(table.end(), str.begin(), str.end());
+            table.push_back(0u);
+            return offset;
+        };
+
+        const auto creatorOffset = appendString("OAT");
+        const auto targetOffset = appendString("ps_3_0");
+        const auto nameOffset = appendString("colorMapSampler");
+        table.resize((table.size() + 3u) & ~3u);
+
+        const uint32_t constantTable[]{28u, creatorOffset, 0xFFFF0300u, 1u, 28u, 0u, targetOffset};
+        const uint32_t constantInfo[]{nameOffset, 3u | 2u << 16, 1u | 0u << 16, 28u + 20u, 0u};
+        const uint16_t typeInfo[]{4u, 12u, 1u, 1u, 1u, 0u, 0u, 0u};
+        std::memcpy(&table[0], constantTable, sizeof(constantTable));
+        std::memcpy(&table[28], constantInfo, sizeof(constantInfo));
+        std::memcpy(&table[48], typeInfo, sizeof(typeInfo));
+
+        const auto tableDwordCount = static_cast<uint32_t>(table.size() / sizeof(uint32_t));
+        std::vector<uint32_t> shader{0xFFFF0300u, 0xFFFEu | (tableDwordCount + 1u) << 16, 'C' | 'T' << 8 | 'A' << 16 | 'B' << 24};
+        shader.resize(shader.size() + tableDwordCount);
+        std::memcpy(&shader[3], table.data(), table.size());
+        shader.emplace_back(0xFFFFu);
+
+        return shader;
+    }
+
+    TEST_CASE("D3D9ShaderAnalyser: Reads views into the bytecode", "[shader][d3d9]")
+    {
+        const auto shader = CreatePixelShader();
+        const auto shaderSize = shader.size() * sizeof(uint32_t);
+
+        ShaderInfoView view;
+        REQUIRE(ShaderAnalyser::GetShaderInfoView(shader.data(), shaderSize, view));
+        REQUIRE(view.m_type == ShaderType::PIXEL_SHADER);
+        REQUIRE(view.m_version_major == 3u);
+        REQUIRE(view.m_creator == "OAT");
+        REQUIRE(view.m_target == "ps_3_0");
+        REQUIRE(view.GetConstantCount() == 1u);
+
+        const auto constant = view.GetConstant(0u);
+        REQUIRE(constant.m_name == "colorMapSampler");
+        REQUIRE(constant.m_register_set == RegisterSet::SAMPLER);
+        REQUIRE(constant.m_register_index == 2u);
+        REQUIRE(constant.m_type == ParameterType::SAMPLER_2D);
+
+        const auto* bytes = reinterpret_cast<const char*>(shader.data());
+        REQUIRE(constant.m_name.data() > bytes);
+        REQUIRE(constant.m_name.data() < bytes + shaderSize);
+    }
+
+    TEST_CASE("D3D9ShaderAnalyser: Copies views into shader info", "[shader][d3d9]")
+    {
+        const auto shader = CreatePixelShader();
+        const auto shaderInfo = ShaderAnalyser::GetShaderInfo(shader.data(), shader.size() * sizeof(uint32_t));
+
+        REQUIRE(shaderInfo);
+        REQUIRE(shaderInfo->m_target == "ps_3_0");
+        REQUIRE(shaderInfo->m_constants.size() == 1u);
+        REQUIRE(shaderInfo->m_constants[0].m_name == "colorMapSampler");
+        REQUIRE(shaderInfo->m_constants[0].m_class == ParameterClass::OBJECT);
+    }
+
+    TEST_CASE("D3D9ShaderAnalyser: Rejects names outside of the constant table", "[shader][d3d9]")
+    {
+        auto shader = CreatePixelShader();
+        shader[3 + 7] = 0xFFFFu;
+
+        ShaderInfoView view;
+        REQUIRE(!ShaderAnalyser::GetShaderInfoView(shader.data(), shader.size() * sizeof(uint32_t), view));
+    }
+} // namespace
@@ -36,4 +36,44 @@ namespace flac
         REQUIRE(metaData.m_bits_per_sample == 16);
         REQUIRE(metaData.m_total_samples == 194870);
     }
+
+    TEST_CASE("FlacDecoder: Ensure lists frames of flac data", "[sound][flac]")
+    {
+        // clang-format off
+        constexpr uint8_t testData[]
+        {
+            // Magic
+            'f', 'L', 'a', 'C',
+
+            // Block header
+            0x80, 0x00, 0x00, 0x22,
+
+            // StreamInfo block
+            0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xC4, 0x40, 0xF0, 0x00,
+            0x00, 0x10, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00,
+
+            // Frame with 4096 samples that contains a valid frame header within its data
+            0xFF, 0xF8, 0xC9, 0x08, 0x00, 0x95, 0x00, 0x11, 0xFF, 0xF8, 0xC9, 0x08, 0x00, 0x95, 0x33, 0x11, 0x84,
+
+            // Frame with 100 samples
+            0xFF, 0xF8, 0x69, 0x08, 0x01, 0x63, 0x26, 0x44, 0x55, 0x28, 0xEE,
+        };
+        // clang-format on
+
+        FlacMetaData metaData;
+        std::vector<FlacFrame> frames;
+        const auto result = GetFlacFrames(testData, sizeof(testData), metaData, frames);
+
+        REQUIRE(result == true);
+        REQUIRE(metaData.m_sample_rate == 44100);
+        REQUIRE(metaData.m_total_samples == 4196);
+        REQUIRE(frames.size() == 2);
+        REQUIRE(frames[0].m_offset == 42);
+        REQUIRE(frames[0].m_size == 17);
+        REQUIRE(frames[0].m_sample_count == 4096);
+        REQUIRE(frames[1].m_offset == 59);
+        REQUIRE(frames[1].m_size == 11);
+        REQUIRE(frames[1].m_sample_count == 100);
+    }
 } // namespace flac
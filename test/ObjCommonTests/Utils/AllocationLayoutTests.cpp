@@ -0,0 +1,61 @@
+#include "Utils/AllocationLayout.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace
+{
+    template<typename T> bool IsAligned(const T* ptr)
+    {
+        return reinterpret_cast<uintptr_t>(ptr) % alignof(T) == 0u;
+    }
+
+    TEST_CASE("AllocationLayout: Hands out aligned parts of a single allocation", "[memory]")
+    {
+        MemoryManager memory;
+
+        AllocationLayout layout;
+        layout.Reserve<char>(3u);
+        layout.Reserve<double>(2u);
+        layout.Reserve<uint16_t>(5u);
+        layout.ReserveString("name");
+        layout.Allocate(memory);
+
+        REQUIRE(memory.GetAllocatedSize() == layout.GetSize());
+        REQUIRE(layout.GetSize() % alignof(double) == 0u);
+
+        auto* chars = layout.Take<char>(3u);
+        auto* doubles = layout.Take<double>(2u);
+        auto* shorts = layout.Take<uint16_t>(5u);
+        const auto* name = layout.TakeString("name");
+
+        REQUIRE(IsAligned(doubles));
+        REQUIRE(IsAligned(shorts));
+        REQUIRE(reinterpret_cast<char*>(doubles) > chars);
+        REQUIRE(reinterpret_cast<char*>(shorts) >= reinterpret_cast<char*>(doubles + 2));
+        REQUIRE(name >= reinterpret_cast<const char*>(shorts + 5));
+        REQUIRE(std::strcmp(name, "name") == 0);
+        REQUIRE(name + 5 <= chars + layout.GetSize());
+
+        // Parts are zeroed like other memory of the memory manager
+        REQUIRE(doubles[1] == 0.0);
+        REQUIRE(shorts[4] == 0u);
+    }
+
+    TEST_CASE("AllocationLayout: Keeps parts aligned when allocating from an arena", "[memory]")
+    {
+        MemoryManager memory(0x1000u);
+        memory.AllocRaw(1u);
+
+        AllocationLayout layout;
+        layout.Reserve<char>(1u);
+        layout.Reserve<uint64_t>(1u);
+        layout.Allocate(memory);
+
+        layout.Take<char>();
+        const auto* value = layout.Take<uint64_t>();
+        REQUIRE(IsAligned(value));
+    }
+} // namespace
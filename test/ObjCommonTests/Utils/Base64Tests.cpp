@@ -0,0 +1,44 @@
+#include "Utils/Base64.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::string Encode(const std::string& data)
+    {
+        std::string result(base64::GetEncodedLength(data.size()), '\0');
+        base64::Encode(data.data(), data.size(), result.data());
+
+        return result;
+    }
+} // namespace
+
+TEST_CASE("Base64: Ensure encoding matches the standard test vectors", "[base64]")
+{
+    REQUIRE(Encode("").empty());
+    REQUIRE(Encode("f") == "Zg==");
+    REQUIRE(Encode("fo") == "Zm8=");
+    REQUIRE(Encode("foo") == "Zm9v");
+    REQUIRE(Encode("foob") == "Zm9vYg==");
+    REQUIRE(Encode("fooba") == "Zm9vYmE=");
+    REQUIRE(Encode("foobar") == "Zm9vYmFy");
+}
+
+TEST_CASE("Base64: Ensure encoding large data matches encoding it in groups", "[base64]")
+{
+    std::string data(1000u, '\0');
+    for (auto i = 0u; i < data.size(); i++)
+        data[i] = static_cast<char>(i * 7u + i / 256u);
+
+    const auto encoded = Encode(data);
+    REQUIRE(encoded.size() == 1336u);
+
+    std::string groupEncoded;
+    for (auto i = 0u; i < data.size(); i += 3u)
+        groupEncoded += Encode(data.substr(i, 3u));
+
+    REQUIRE(encoded == groupEncoded);
+    REQUIRE(encoded.find_first_not_of("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/=") == std::string::npos);
+}
@@ -0,0 +1,59 @@
+#include "Utils/Endianness.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    template<typename T> std::vector<T> CreateValues(const size_t count)
+    {
+        std::vector<T> values(count);
+        for (auto i = 0u; i < count; i++)
+            values[i] = static_cast<T>(0x0123456789ABCDEFull * (i + 1u));
+
+        return values;
+    }
+
+    template<typename T> void RequireSwapsLikeSingleValues(const size_t count)
+    {
+        auto values = CreateValues<T>(count);
+        const auto expected = CreateValues<T>(count);
+
+        endianness::SwapBytes(std::span(values));
+
+        for (auto i = 0u; i < count; i++)
+            REQUIRE(values[i] == endianness::FromBigEndian(expected[i]));
+    }
+} // namespace
+
+TEST_CASE("Endianness: Ensure swapping multiple values matches swapping them one at a time", "[endianness]")
+{
+    // Counts that are not a multiple of a vector size also swap the remaining values one at a time
+    for (const auto count : {0u, 1u, 7u, 16u, 33u, 100u})
+    {
+        RequireSwapsLikeSingleValues<uint16_t>(count);
+        RequireSwapsLikeSingleValues<int16_t>(count);
+        RequireSwapsLikeSingleValues<uint32_t>(count);
+        RequireSwapsLikeSingleValues<int32_t>(count);
+        RequireSwapsLikeSingleValues<uint64_t>(count);
+        RequireSwapsLikeSingleValues<int64_t>(count);
+    }
+}
+
+TEST_CASE("Endianness: Ensure floats are swapped bitwise", "[endianness]")
+{
+    const std::vector<float> expected{1.0f, -2.5f, 1234.5678f};
+    auto values = expected;
+    endianness::SwapBytes(std::span(values));
+    endianness::SwapBytes(std::span(values));
+
+    REQUIRE(values == expected);
+
+    float value = 1.0f;
+    endianness::SwapBytes(std::span(&value, 1u));
+
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    REQUIRE(bits == 0x0000803Fu);
+}
@@ -0,0 +1,58 @@
+#include "Utils/FileToZlibWrapper.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    std::string CreateData()
+    {
+        std::string data(1000u, '\0');
+        for (auto i = 0u; i < data.size(); i++)
+            data[i] = static_cast<char>(i * 31u);
+
+        return data;
+    }
+
+    template<typename T> void RequireReadsData(T& input, const std::string& data)
+    {
+        char buffer[300];
+        REQUIRE(input.Seek(990u, ZLIB_FILEFUNC_SEEK_SET) == 0);
+        REQUIRE(input.Read(buffer, 20u) == 10u);
+        REQUIRE(std::string(buffer, 10u) == data.substr(990u, 10u));
+
+        REQUIRE(input.Seek(0u, ZLIB_FILEFUNC_SEEK_END) == 0);
+        REQUIRE(input.Tell() == 1000);
+
+        REQUIRE(input.Seek(10u, ZLIB_FILEFUNC_SEEK_SET) == 0);
+        REQUIRE(input.Read(buffer, 4u) == 4u);
+        REQUIRE(std::string(buffer, 4u) == data.substr(10u, 4u));
+        REQUIRE(input.Seek(6u, ZLIB_FILEFUNC_SEEK_CUR) == 0);
+        REQUIRE(input.Tell() == 20);
+
+        REQUIRE(input.Read(buffer, 300u) == 300u);
+        REQUIRE(std::string(buffer, 300u) == data.substr(20u, 300u));
+        REQUIRE(input.Read(buffer, 70u) == 70u);
+        REQUIRE(std::string(buffer, 70u) == data.substr(320u, 70u));
+        REQUIRE(input.Tell() == 390);
+    }
+} // namespace
+
+TEST_CASE("FileToZlibWrapper: Buffered input reads like the stream it wraps", "[zlib]")
+{
+    const auto data = CreateData();
+    std::istringstream stream(data);
+
+    // A small buffer makes reads cross buffer boundaries and bypass the buffer
+    BufferedZlibInput input(stream, 64u);
+    RequireReadsData(input, data);
+}
+
+TEST_CASE("FileToZlibWrapper: Memory input reads like a stream", "[zlib]")
+{
+    const auto data = CreateData();
+
+    MemoryZlibInput input(data.data(), data.size());
+    RequireReadsData(input, data);
+}
@@ -0,0 +1,63 @@
+#include "Utils/FileWatcher.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    void WriteFile(const fs::path& path, const std::string& content)
+    {
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        stream << content;
+    }
+
+    TEST_CASE("FileWatcher: Reports files being added, changed and removed in watched folders", "[filewatcher]")
+    {
+        const auto folder = fs::temp_directory_path() / "oat_file_watcher_test";
+        fs::remove_all(folder);
+        fs::create_directories(folder / "sub");
+        WriteFile(folder / "sub" / "existing.txt", "existing");
+
+        FileWatcher watcher;
+        watcher.Watch(folder.string());
+        REQUIRE(!watcher.Poll());
+
+        WriteFile(folder / "sub" / "added.txt", "added");
+        REQUIRE(watcher.Poll());
+        REQUIRE(!watcher.Poll());
+
+        WriteFile(folder / "sub" / "existing.txt", "changed content");
+        REQUIRE(watcher.Poll());
+        REQUIRE(!watcher.Poll());
+
+        fs::remove(folder / "sub" / "added.txt");
+        REQUIRE(watcher.Poll());
+        REQUIRE(!watcher.Poll());
+
+        fs::remove_all(folder);
+        REQUIRE(watcher.Poll());
+    }
+
+    TEST_CASE("FileWatcher: Reports watched paths being created", "[filewatcher]")
+    {
+        const auto filePath = fs::temp_directory_path() / "oat_file_watcher_test.txt";
+        fs::remove(filePath);
+
+        FileWatcher watcher;
+        watcher.Watch(filePath.string());
+        watcher.Watch(filePath.string());
+        REQUIRE(watcher.GetWatchedPathCount() == 1u);
+        REQUIRE(!watcher.Poll());
+
+        WriteFile(filePath, "created");
+        REQUIRE(watcher.Poll());
+        REQUIRE(!watcher.Poll());
+
+        fs::remove(filePath);
+        REQUIRE(watcher.Poll());
+    }
+} // namespace
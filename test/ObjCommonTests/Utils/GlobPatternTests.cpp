@@ -0,0 +1,45 @@
+#include "Utils/GlobPattern.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    TEST_CASE("GlobPattern: Matches names without wildcards exactly", "[utils][glob]")
+    {
+        const GlobPattern pattern("mp_nuketown");
+
+        REQUIRE(pattern.Matches("mp_nuketown"));
+        REQUIRE(pattern.Matches("MP_Nuketown"));
+        REQUIRE(!pattern.Matches("mp_nuketown_2020"));
+        REQUIRE(!pattern.Matches("mp_nuke"));
+    }
+
+    TEST_CASE("GlobPattern: Matches stars with any amount of characters", "[utils][glob]")
+    {
+        const GlobPattern pattern("ui/*.png");
+
+        REQUIRE(pattern.Matches("ui/.png"));
+        REQUIRE(pattern.Matches("ui/menu/background.png"));
+        REQUIRE(!pattern.Matches("ui/background.iwi"));
+        REQUIRE(!pattern.Matches("images/ui/background.png"));
+    }
+
+    TEST_CASE("GlobPattern: Retries stars when later parts do not match", "[utils][glob]")
+    {
+        const GlobPattern pattern("*_a*_b?");
+
+        REQUIRE(pattern.Matches("x_ay_a_b1"));
+        REQUIRE(pattern.Matches("_a_bz"));
+        REQUIRE(!pattern.Matches("x_ay_a_b"));
+        REQUIRE(!pattern.Matches("x_by_a1"));
+    }
+
+    TEST_CASE("GlobPattern: Matches question marks with exactly one character", "[utils][glob]")
+    {
+        const GlobPattern pattern("sound_??");
+
+        REQUIRE(pattern.Matches("sound_01"));
+        REQUIRE(!pattern.Matches("sound_1"));
+        REQUIRE(!pattern.Matches("sound_001"));
+    }
+} // namespace
@@ -0,0 +1,91 @@
+#include "Utils/JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    TEST_CASE("JobSystem: Runs all jobs of a task group", "[utils][jobs]")
+    {
+        JobSystem jobSystem(4u);
+        std::atomic<unsigned> executedJobs = 0u;
+
+        JobSystem::TaskGroup group(jobSystem);
+        for (auto i = 0u; i < 1000u; i++)
+        {
+            group.Run(
+                [&executedJobs]
+                {
+                    ++executedJobs;
+                });
+        }
+
+        group.Wait();
+        REQUIRE(executedJobs == 1000u);
+    }
+
+    TEST_CASE("JobSystem: Jobs can wait for jobs they started themselves", "[utils][jobs]")
+    {
+        // Waiting threads execute jobs so nested groups do not need more workers than there are levels of nesting
+        JobSystem jobSystem(1u);
+        std::atomic<unsigned> executedJobs = 0u;
+
+        JobSystem::TaskGroup outerGroup(jobSystem);
+        for (auto i = 0u; i < 8u; i++)
+        {
+            outerGroup.Run(
+                [&jobSystem, &executedJobs]
+                {
+                    JobSystem::TaskGroup innerGroup(jobSystem);
+                    for (auto j = 0u; j < 8u; j++)
+                    {
+                        innerGroup.Run(
+                            [&executedJobs]
+                            {
+                                ++executedJobs;
+                            });
+                    }
+
+                    innerGroup.Wait();
+                });
+        }
+
+        outerGroup.Wait();
+        REQUIRE(executedJobs == 64u);
+    }
+
+    TEST_CASE("JobSystem: Rethrows exceptions of jobs when waiting", "[utils][jobs]")
+    {
+        JobSystem jobSystem(2u);
+
+        JobSystem::TaskGroup group(jobSystem);
+        group.Run(
+            []
+            {
+                throw std::runtime_error("test");
+            });
+
+        REQUIRE_THROWS_AS(group.Wait(), std::runtime_error);
+    }
+
+    TEST_CASE("JobSystem: Processes every element exactly once in a parallel for", "[utils][jobs]")
+    {
+        JobSystem jobSystem(4u);
+        std::vector<unsigned> values(10000u, 0u);
+
+        jobSystem.ParallelFor(values.size(),
+                              16u,
+                              [&values](const size_t begin, const size_t end)
+                              {
+                                  for (auto i = begin; i < end; i++)
+                                      values[i]++;
+                              });
+
+        REQUIRE(std::accumulate(values.begin(), values.end(), 0u) == 10000u);
+        REQUIRE(*std::ranges::min_element(values) == 1u);
+    }
+} // namespace
@@ -0,0 +1,109 @@
+#include "Utils/MemoryBudget.h"
+
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    TEST_CASE("MemoryBudget: Admits work while it fits into the budget", "[utils][memory]")
+    {
+        MemoryBudget budget(100u);
+
+        budget.Acquire(40u);
+        budget.Acquire(60u);
+        REQUIRE(budget.GetUsed() == 100u);
+
+        budget.Release(40u);
+        budget.Release(60u);
+        REQUIRE(budget.GetUsed() == 0u);
+    }
+
+    TEST_CASE("MemoryBudget: Admits work larger than the budget when nothing else runs", "[utils][memory]")
+    {
+        MemoryBudget budget(100u);
+
+        {
+            const MemoryBudget::Reservation reservation(budget, 500u);
+            REQUIRE(budget.GetUsed() == 500u);
+        }
+
+        REQUIRE(budget.GetUsed() == 0u);
+    }
+
+    TEST_CASE("MemoryBudget: Never exceeds the budget with concurrent work", "[utils][memory]")
+    {
+        constexpr auto BUDGET = 100u;
+        MemoryBudget budget(BUDGET);
+        std::atomic<size_t> used = 0u;
+        std::atomic<size_t> maxUsed = 0u;
+
+        std::vector<std::thread> threads;
+        for (auto i = 0u; i < 8u; i++)
+        {
+            threads.emplace_back(
+                [&budget, &used, &maxUsed, i]
+                {
+                    const auto size = 20u + (i % 3u) * 20u;
+                    const MemoryBudget::Reservation reservation(budget, size);
+
+                    const auto nowUsed = used += size;
+                    auto previousMax = maxUsed.load();
+                    while (nowUsed > previousMax && !maxUsed.compare_exchange_weak(previousMax, nowUsed))
+                    {
+                    }
+
+                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                    used -= size;
+                });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        REQUIRE(maxUsed <= BUDGET);
+        REQUIRE(budget.GetUsed() == 0u);
+    }
+
+    TEST_CASE("MemoryBudget: Admits work in the order it was requested", "[utils][memory]")
+    {
+        MemoryBudget budget(100u);
+        budget.Acquire(60u);
+
+        // The large request waits for the first one, the small request that would fit has to wait for the large one
+        std::atomic<unsigned> order = 0u;
+        unsigned largeOrder = 0u;
+        unsigned smallOrder = 0u;
+
+        std::thread large(
+            [&]
+            {
+                budget.Acquire(80u);
+                largeOrder = ++order;
+                budget.Release(80u);
+            });
+
+        // Gives the large request time to start waiting before the small one asks
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        std::thread small(
+            [&]
+            {
+                budget.Acquire(20u);
+                smallOrder = ++order;
+                budget.Release(20u);
+            });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        REQUIRE(order == 0u);
+
+        budget.Release(60u);
+        large.join();
+        small.join();
+
+        REQUIRE(largeOrder == 1u);
+        REQUIRE(smallOrder == 2u);
+    }
+} // namespace
@@ -0,0 +1,48 @@
+#include "Utils/MemoryManager.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <utility>
+
+namespace
+{
+    TEST_CASE("MemoryManager: Moved-from memory manager does not allocate from the arena of the moved-to one", "[memory]")
+    {
+        MemoryManager source(0x1000);
+        auto* first = source.Alloc<char>(16u);
+        std::memset(first, 'a', 16u);
+
+        MemoryManager target(std::move(source));
+        auto* second = source.Alloc<char>(16u);
+        std::memset(second, 'b', 16u);
+        auto* third = target.Alloc<char>(16u);
+        std::memset(third, 'c', 16u);
+
+        REQUIRE(second != first + 16);
+        REQUIRE(third == first + 16);
+        REQUIRE(first[15] == 'a');
+        REQUIRE(target.GetAllocatedSize() == 32u);
+        REQUIRE(source.GetAllocatedSize() == 16u);
+    }
+
+    TEST_CASE("MemoryManager: Move assignment releases memory and takes over the arena", "[memory]")
+    {
+        MemoryManager source(0x1000);
+        auto* first = source.Alloc<char>(16u);
+        std::memset(first, 'a', 16u);
+
+        MemoryManager target(0x1000);
+        target.Alloc<char>(64u);
+
+        target = std::move(source);
+        auto* second = source.Alloc<char>(16u);
+        std::memset(second, 'b', 16u);
+        auto* third = target.Alloc<char>(16u);
+        std::memset(third, 'c', 16u);
+
+        REQUIRE(third == first + 16);
+        REQUIRE(first[15] == 'a');
+        REQUIRE(target.GetAllocatedSize() == 32u);
+        REQUIRE(source.GetAllocatedSize() == 16u);
+    }
+} // namespace
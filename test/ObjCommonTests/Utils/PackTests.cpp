@@ -0,0 +1,66 @@
+#include "Utils/HalfFloat.h"
+#include "Utils/Pack.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+namespace
+{
+    std::vector<float> CreateValues(const size_t count)
+    {
+        std::vector<float> values(count);
+        for (auto i = 0u; i < count; i++)
+            values[i] = static_cast<float>(static_cast<int>(i % 37u) - 18) / 7.0f;
+
+        return values;
+    }
+} // namespace
+
+TEST_CASE("HalfFloat: Ensure converting multiple floats matches converting them one at a time", "[pack]")
+{
+    auto values = CreateValues(23u);
+    values.emplace_back(65504.0f);
+    values.emplace_back(-0.0f);
+    values.emplace_back(1e-8f);
+
+    std::vector<half_float_t> halves(values.size());
+    HalfFloat::ToHalf(values.data(), halves.data(), values.size());
+
+    for (auto i = 0u; i < values.size(); i++)
+        REQUIRE(halves[i] == HalfFloat::ToHalf(values[i]));
+}
+
+TEST_CASE("Pack: Ensure packing multiple values matches packing them one at a time", "[pack]")
+{
+    constexpr auto count = 301u;
+    const auto values = CreateValues(count * 4u);
+    std::vector<uint32_t> packed(count);
+
+    pack32::Vec2PackTexCoordsUV(values.data(), packed.data(), count);
+    for (auto i = 0u; i < count; i++)
+    {
+        const float uv[2]{values[i * 2u], values[i * 2u + 1u]};
+        REQUIRE(packed[i] == pack32::Vec2PackTexCoordsUV(uv));
+    }
+
+    pack32::Vec2PackTexCoordsVU(values.data(), packed.data(), count);
+    for (auto i = 0u; i < count; i++)
+    {
+        const float uv[2]{values[i * 2u], values[i * 2u + 1u]};
+        REQUIRE(packed[i] == pack32::Vec2PackTexCoordsVU(uv));
+    }
+
+    pack32::Vec3PackUnitVecThirdBased(values.data(), packed.data(), count);
+    for (auto i = 0u; i < count; i++)
+    {
+        const float vec[3]{values[i * 3u], values[i * 3u + 1u], values[i * 3u + 2u]};
+        REQUIRE(packed[i] == pack32::Vec3PackUnitVecThirdBased(vec));
+    }
+
+    pack32::Vec4PackGfxColor(values.data(), packed.data(), count);
+    for (auto i = 0u; i < count; i++)
+    {
+        const float color[4]{values[i * 4u], values[i * 4u + 1u], values[i * 4u + 2u], values[i * 4u + 3u]};
+        REQUIRE(packed[i] == pack32::Vec4PackGfxColor(color));
+    }
+}
@@ -0,0 +1,31 @@
+#include "Utils/PathTemplate.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    TEST_CASE("PathTemplate: Substitutes all placeholders", "[utils][path]")
+    {
+        const PathTemplate pathTemplate("?base?/zone_raw/?project?/?game?/?project?", {"?project?", "?game?", "?base?"});
+
+        REQUIRE(pathTemplate.Uses(0u));
+        REQUIRE(pathTemplate.Uses(1u));
+        REQUIRE(pathTemplate.Uses(2u));
+        REQUIRE(pathTemplate.Resolve({"mod", "t6", "/base"}) == "/base/zone_raw/mod/t6/mod");
+    }
+
+    TEST_CASE("PathTemplate: Keeps paths without placeholders", "[utils][path]")
+    {
+        const PathTemplate pathTemplate("zone_dump/raw", {"?zone?"});
+
+        REQUIRE(!pathTemplate.Uses(0u));
+        REQUIRE(pathTemplate.Resolve({"common_mp"}) == "zone_dump/raw");
+    }
+
+    TEST_CASE("PathTemplate: Does not substitute placeholders in values", "[utils][path]")
+    {
+        const PathTemplate pathTemplate("?project?/?base?", {"?project?", "?base?"});
+
+        REQUIRE(pathTemplate.Resolve({"?base?", "base"}) == "?base?/base");
+    }
+} // namespace
@@ -0,0 +1,74 @@
+#include "Utils/ProgressReporter.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<std::string> SplitLines(const std::string& text)
+    {
+        std::vector<std::string> lines;
+        std::istringstream stream(text);
+        std::string line;
+        while (std::getline(stream, line))
+            lines.emplace_back(line);
+
+        return lines;
+    }
+} // namespace
+
+TEST_CASE("ProgressReporter: Ensure json reporter writes one object per event", "[progress]")
+{
+    std::ostringstream stream;
+    progress::JsonProgressReporter reporter(stream);
+
+    reporter.OnZoneLoadStarted("test\"zone", 200u);
+    reporter.OnZoneLoadProgress("test\"zone", 100u, 200u);
+    reporter.OnZoneLoadFinished("test\"zone", true, 3u);
+    reporter.OnFileWritten("out.ff", 42u);
+
+    const auto lines = SplitLines(stream.str());
+    REQUIRE(lines.size() == 4u);
+
+    for (const auto& line : lines)
+    {
+        REQUIRE(line.starts_with("{\"event\":\""));
+        REQUIRE(line.ends_with("}"));
+    }
+
+    REQUIRE(lines[0].find("\"zone\":\"test\\\"zone\",\"totalBytes\":200") != std::string::npos);
+    REQUIRE(lines[1].find("\"consumedBytes\":100,\"totalBytes\":200") != std::string::npos);
+    REQUIRE(lines[2].find("\"success\":true,\"assets\":3") != std::string::npos);
+    REQUIRE(lines[3].find("\"event\":\"fileWritten\"") != std::string::npos);
+    REQUIRE(lines[3].find("\"file\":\"out.ff\",\"bytes\":42") != std::string::npos);
+}
+
+TEST_CASE("ProgressReporter: Ensure text reporter only prints dump progress in steps of ten percent", "[progress]")
+{
+    std::ostringstream stream;
+    progress::TextProgressReporter reporter(stream);
+
+    reporter.OnZoneDumpStarted("zone", 40u);
+    for (auto i = 0u; i < 40u; i++)
+        reporter.OnAssetDumped("zone", "asset");
+    reporter.OnZoneDumpFinished("zone", true, 0u);
+
+    const auto lines = SplitLines(stream.str());
+
+    // Start, 10% to 90% and the finish
+    REQUIRE(lines.size() == 11u);
+    REQUIRE(lines[1] == "Dumping zone \"zone\": 10%");
+    REQUIRE(lines[9] == "Dumping zone \"zone\": 90%");
+    REQUIRE(lines[10].starts_with("Dumped 40 assets of zone \"zone\""));
+}
+
+TEST_CASE("ProgressReporter: Ensure reporters can be created by format name", "[progress]")
+{
+    std::ostringstream stream;
+
+    REQUIRE(progress::CreateProgressReporter("text", stream) != nullptr);
+    REQUIRE(progress::CreateProgressReporter("json", stream) != nullptr);
+    REQUIRE(progress::CreateProgressReporter("xml", stream) == nullptr);
+}
@@ -0,0 +1,42 @@
+#include "Utils/WorkClaims.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    TEST_CASE("WorkClaims: Claims every work item only once", "[workclaims]")
+    {
+        const auto folder = fs::temp_directory_path() / "oat_work_claims_test";
+        fs::remove_all(folder);
+
+        const WorkClaims claims(folder.string());
+        REQUIRE(claims.IsUsable());
+
+        std::error_code ec;
+        REQUIRE(claims.Claim("zone_a", ec) == WorkClaims::ClaimResult::CLAIMED);
+        REQUIRE(claims.Claim("zone_b", ec) == WorkClaims::ClaimResult::CLAIMED);
+        REQUIRE(claims.Claim("zone_a", ec) == WorkClaims::ClaimResult::CLAIMED_BY_OTHER);
+
+        const WorkClaims otherClaims(folder.string());
+        REQUIRE(otherClaims.Claim("zone_b", ec) == WorkClaims::ClaimResult::CLAIMED_BY_OTHER);
+
+        fs::remove_all(folder);
+    }
+
+    TEST_CASE("WorkClaims: Fails claiming when the claim folder is gone", "[workclaims]")
+    {
+        const auto folder = fs::temp_directory_path() / "oat_work_claims_missing_test";
+        fs::remove_all(folder);
+
+        const WorkClaims claims(folder.string());
+        REQUIRE(claims.IsUsable());
+        fs::remove_all(folder);
+
+        std::error_code ec;
+        REQUIRE(claims.Claim("zone_a", ec) == WorkClaims::ClaimResult::FAILED);
+        REQUIRE(ec);
+    }
+} // namespace
@@ -0,0 +1,104 @@
+#include "XModel/XModelCommon.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    XModelVertex CreateVertex(const float x, const float y, const float z, const float u, const float v)
+    {
+        return XModelVertex{
+            {x, y, z},
+            {0.0f, 0.0f, 1.0f},
+            {1.0f, 1.0f, 1.0f, 1.0f},
+            {u, v},
+        };
+    }
+
+    XModelFace CreateFace(const unsigned v0, const unsigned v1, const unsigned v2)
+    {
+        return XModelFace{
+            {v0, v1, v2}
+        };
+    }
+} // namespace
+
+TEST_CASE("XModelCommon: Ensure welding merges identical vertices", "[xmodel]")
+{
+    XModelCommon common;
+    common.m_vertices = {
+        CreateVertex(0.0f, 0.0f, 0.0f, 0.0f, 0.0f),
+        CreateVertex(1.0f, 0.0f, 0.0f, 1.0f, 0.0f),
+        CreateVertex(0.0f, 1.0f, 0.0f, 0.0f, 1.0f),
+        CreateVertex(1.0f, 0.0f, 0.0f, 1.0f, 0.0f),
+        CreateVertex(0.0f, 1.0f, 0.0f, 0.0f, 1.0f),
+        CreateVertex(1.0f, 1.0f, 0.0f, 1.0f, 1.0f),
+    };
+    common.m_objects.emplace_back(XModelObject{"object", 0u, {CreateFace(0, 1, 2), CreateFace(3, 4, 5)}});
+
+    common.WeldVertices();
+
+    REQUIRE(common.m_vertices.size() == 4u);
+
+    const auto& faces = common.m_objects[0].m_faces;
+    REQUIRE(faces.size() == 2u);
+    REQUIRE(faces[0].vertexIndex[0] == 0u);
+    REQUIRE(faces[0].vertexIndex[1] == 1u);
+    REQUIRE(faces[0].vertexIndex[2] == 2u);
+    REQUIRE(faces[1].vertexIndex[0] == 1u);
+    REQUIRE(faces[1].vertexIndex[1] == 2u);
+    REQUIRE(faces[1].vertexIndex[2] == 3u);
+    REQUIRE(common.m_vertices[3].coordinates[0] == 1.0f);
+    REQUIRE(common.m_vertices[3].coordinates[1] == 1.0f);
+}
+
+TEST_CASE("XModelCommon: Ensure welding keeps vertices with different uvs", "[xmodel]")
+{
+    XModelCommon common;
+    common.m_vertices = {
+        CreateVertex(0.0f, 0.0f, 0.0f, 0.0f, 0.0f),
+        CreateVertex(0.0f, 0.0f, 0.0f, 0.5f, 0.0f),
+        CreateVertex(0.0f, 0.0f, 0.0f, 0.0f, 0.0f),
+    };
+    common.m_objects.emplace_back(XModelObject{"object", 0u, {CreateFace(0, 1, 2)}});
+
+    common.WeldVertices();
+
+    REQUIRE(common.m_vertices.size() == 2u);
+
+    const auto& face = common.m_objects[0].m_faces[0];
+    REQUIRE(face.vertexIndex[0] == 0u);
+    REQUIRE(face.vertexIndex[1] == 1u);
+    REQUIRE(face.vertexIndex[2] == 0u);
+}
+
+TEST_CASE("XModelCommon: Ensure welding keeps vertices with different bone weights", "[xmodel]")
+{
+    XModelCommon common;
+    common.m_vertices = {
+        CreateVertex(0.0f, 0.0f, 0.0f, 0.0f, 0.0f),
+        CreateVertex(0.0f, 0.0f, 0.0f, 0.0f, 0.0f),
+        CreateVertex(0.0f, 0.0f, 0.0f, 0.0f, 0.0f),
+    };
+    common.m_bone_weight_data.weights = {
+        XModelBoneWeight{0u, 1.0f},
+        XModelBoneWeight{1u, 1.0f},
+        XModelBoneWeight{0u, 1.0f},
+    };
+    common.m_vertex_bone_weights = {
+        XModelVertexBoneWeights{0u, 1u},
+        XModelVertexBoneWeights{1u, 1u},
+        XModelVertexBoneWeights{2u, 1u},
+    };
+    common.m_objects.emplace_back(XModelObject{"object", 0u, {CreateFace(0, 1, 2)}});
+
+    common.WeldVertices();
+
+    REQUIRE(common.m_vertices.size() == 2u);
+    REQUIRE(common.m_vertex_bone_weights.size() == 2u);
+    REQUIRE(common.m_vertex_bone_weights[1].weightOffset == 1u);
+
+    const auto& face = common.m_objects[0].m_faces[0];
+    REQUIRE(face.vertexIndex[0] == 0u);
+    REQUIRE(face.vertexIndex[1] == 1u);
+    REQUIRE(face.vertexIndex[2] == 0u);
+}
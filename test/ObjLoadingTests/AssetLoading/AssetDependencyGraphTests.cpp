@@ -0,0 +1,41 @@
+#include "AssetLoading/AssetDependencyGraph.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    TEST_CASE("AssetDependencyGraph: Groups assets by their dependencies", "[assetloading][dependencies]")
+    {
+        AssetDependencyGraph graph;
+        const auto material = graph.AddAsset(0, "material");
+        graph.AddDependency(0, "material", 1, "image");
+        graph.AddDependency(2, "model", 0, "material");
+        graph.AddDependency(2, "model", 1, "image");
+        const auto rawFile = graph.AddAsset(3, "rawfile");
+
+        REQUIRE(graph.GetNodes().size() == 4u);
+        REQUIRE(graph.AddAsset(0, "material") == material);
+
+        const auto levels = graph.GetLevels();
+        REQUIRE(levels.size() == 3u);
+        REQUIRE(levels[0].size() == 2u);
+        REQUIRE(graph.GetNodes()[levels[0][0]].m_name == "image");
+        REQUIRE(levels[0][1] == rawFile);
+        REQUIRE(levels[1] == std::vector<size_t>{material});
+        REQUIRE(graph.GetNodes()[levels[2][0]].m_name == "model");
+    }
+
+    TEST_CASE("AssetDependencyGraph: Puts dependency cycles into the last level", "[assetloading][dependencies]")
+    {
+        AssetDependencyGraph graph;
+        graph.AddDependency(0, "a", 0, "b");
+        graph.AddDependency(0, "b", 0, "a");
+        graph.AddAsset(0, "c");
+
+        const auto levels = graph.GetLevels();
+        REQUIRE(levels.size() == 2u);
+        REQUIRE(levels[0].size() == 1u);
+        REQUIRE(graph.GetNodes()[levels[0][0]].m_name == "c");
+        REQUIRE(levels[1].size() == 2u);
+    }
+} // namespace
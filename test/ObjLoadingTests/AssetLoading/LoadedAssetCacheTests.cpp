@@ -0,0 +1,89 @@
+#include "AssetLoading/LoadedAssetCache.h"
+
+#include "Mock/MockSearchPath.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+namespace
+{
+    std::unique_ptr<LoadedAssetCache::Entry> LoadEntry(ISearchPath& searchPath, const std::string& fileName)
+    {
+        LoadedAssetCache::RecordingSearchPath recordingSearchPath(searchPath);
+        const auto file = recordingSearchPath.Open(fileName);
+
+        std::string content;
+        if (file.IsOpen())
+            std::getline(*file.m_stream, content);
+
+        auto entry = std::make_unique<LoadedAssetCache::Entry>();
+        entry->m_memory = std::make_unique<MemoryManager>();
+        entry->m_assets.emplace_back(std::make_unique<XAssetInfoGeneric>(0, fileName, entry->m_memory->Dup(content.c_str())));
+        entry->m_files = std::move(recordingSearchPath.m_files);
+
+        return entry;
+    }
+
+    TEST_CASE("LoadedAssetCache: Finds assets whose files are unchanged", "[assetloading][cache]")
+    {
+        MockSearchPath searchPath;
+        searchPath.AddFileData("rawfile.txt", "hello");
+        MockSearchPath otherSearchPath;
+        otherSearchPath.AddFileData("rawfile.txt", "hello");
+
+        LoadedAssetCache cache;
+        REQUIRE(cache.Find(nullptr, 0, "rawfile.txt", searchPath) == nullptr);
+
+        const auto* addedEntry = cache.Add(nullptr, 0, "rawfile.txt", LoadEntry(searchPath, "rawfile.txt"));
+        REQUIRE(addedEntry != nullptr);
+        REQUIRE(addedEntry->m_assets.size() == 1u);
+        REQUIRE(std::string(static_cast<const char*>(addedEntry->m_assets[0]->m_ptr)) == "hello");
+
+        REQUIRE(cache.Find(nullptr, 0, "rawfile.txt", searchPath) == addedEntry);
+        REQUIRE(cache.Find(nullptr, 0, "rawfile.txt", otherSearchPath) == addedEntry);
+        REQUIRE(cache.Find(nullptr, 1, "rawfile.txt", searchPath) == nullptr);
+    }
+
+    TEST_CASE("LoadedAssetCache: Does not find assets whose files changed", "[assetloading][cache]")
+    {
+        MockSearchPath searchPath;
+        searchPath.AddFileData("rawfile.txt", "hello");
+        MockSearchPath changedSearchPath;
+        changedSearchPath.AddFileData("rawfile.txt", "world");
+        MockSearchPath emptySearchPath;
+
+        LoadedAssetCache cache;
+        const auto* addedEntry = cache.Add(nullptr, 0, "rawfile.txt", LoadEntry(searchPath, "rawfile.txt"));
+
+        REQUIRE(cache.Find(nullptr, 0, "rawfile.txt", changedSearchPath) == nullptr);
+        REQUIRE(cache.Find(nullptr, 0, "rawfile.txt", emptySearchPath) == nullptr);
+
+        // Replaced entries stay valid for zones that still use their assets
+        const auto* changedEntry = cache.Add(nullptr, 0, "rawfile.txt", LoadEntry(changedSearchPath, "rawfile.txt"));
+        REQUIRE(changedEntry != addedEntry);
+        REQUIRE(std::string(static_cast<const char*>(addedEntry->m_assets[0]->m_ptr)) == "hello");
+        REQUIRE(std::string(static_cast<const char*>(changedEntry->m_assets[0]->m_ptr)) == "world");
+        REQUIRE(cache.Find(nullptr, 0, "rawfile.txt", changedSearchPath) == changedEntry);
+    }
+
+    TEST_CASE("LoadedAssetCache: Keeps the cached entry when adding the same files again", "[assetloading][cache]")
+    {
+        MockSearchPath searchPath;
+        searchPath.AddFileData("rawfile.txt", "hello");
+
+        LoadedAssetCache cache;
+        const auto* addedEntry = cache.Add(nullptr, 0, "rawfile.txt", LoadEntry(searchPath, "rawfile.txt"));
+
+        REQUIRE(cache.Add(nullptr, 0, "rawfile.txt", LoadEntry(searchPath, "rawfile.txt")) == addedEntry);
+    }
+
+    TEST_CASE("LoadedAssetCache: Searching files makes loaded assets not cacheable", "[assetloading][cache]")
+    {
+        MockSearchPath searchPath;
+        LoadedAssetCache::RecordingSearchPath recordingSearchPath(searchPath);
+        REQUIRE(recordingSearchPath.IsCacheable());
+
+        recordingSearchPath.Find(SearchPathSearchOptions(), [](const std::string&) {});
+        REQUIRE(!recordingSearchPath.IsCacheable());
+    }
+} // namespace
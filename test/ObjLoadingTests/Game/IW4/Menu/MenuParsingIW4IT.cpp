@@ -382,4 +382,105 @@ namespace test::game::iw4::menu::parsing::it
         REQUIRE(item->action->eventHandlers[1]->eventData.unconditionalScript != nullptr);
         REQUIRE(item->action->eventHandlers[1]->eventData.unconditionalScript == R"("play" "lol" ; )"s);
     }
+
+    TEST_CASE("MenuParsingIW4IT: Can use functions of menu files that were loaded before", "[parsing][converting][menu][it]")
+    {
+        MenuParsingItHelper helper;
+
+        helper.AddFile(R"testmenu(
+{
+	loadMenu { "ui/functions.menu" }
+	loadMenu { "ui/main.menu" }
+	loadMenu { "ui/options.menu" }
+}
+			)testmenu");
+
+        helper.AddFile("ui/functions.menu", R"testmenu(
+{
+	functionDef
+	{
+		name "IsEnabled"
+		value ( dvarBool( "ui_enabled" ) )
+	}
+
+	menuDef
+	{
+		name "Functions"
+	}
+}
+			)testmenu");
+
+        helper.AddFile("ui/main.menu", R"testmenu(
+{
+	menuDef
+	{
+		name "Main"
+		visible when( IsEnabled() )
+	}
+}
+			)testmenu");
+
+        helper.AddFile("ui/options.menu", R"testmenu(
+{
+	menuDef
+	{
+		name "Options"
+	}
+}
+			)testmenu");
+
+        const auto result = helper.RunIntegrationTest();
+        REQUIRE(result);
+
+        const auto* menuList = helper.GetMenuListAsset();
+        const auto* functionsMenu = helper.GetMenuAsset("Functions");
+        const auto* mainMenu = helper.GetMenuAsset("Main");
+        const auto* optionsMenu = helper.GetMenuAsset("Options");
+
+        REQUIRE(menuList->menuCount == 3);
+        REQUIRE(menuList->menus);
+
+        REQUIRE(menuList->menus[0] == functionsMenu);
+        REQUIRE(menuList->menus[1] == mainMenu);
+        REQUIRE(menuList->menus[2] == optionsMenu);
+
+        REQUIRE(mainMenu->visibleExp != nullptr);
+    }
+
+    TEST_CASE("MenuParsingIW4IT: Equal expressions share the same statement", "[parsing][converting][menu][it]")
+    {
+        MenuParsingItHelper helper;
+
+        helper.AddFile(R"testmenu(
+{
+	menuDef
+	{
+		name "Blab"
+		visible when( dvarBool( "ui_enabled" ) && dvarInt( "ui_mode" ) == 2 )
+
+		itemDef
+		{
+			visible when( dvarBool( "ui_enabled" ) && dvarInt( "ui_mode" ) == 2 )
+		}
+		itemDef
+		{
+			visible when( dvarBool( "ui_enabled" ) && dvarInt( "ui_mode" ) == 3 )
+		}
+	}
+}
+			)testmenu");
+
+        const auto result = helper.RunIntegrationTest();
+        REQUIRE(result);
+
+        const auto* menu = helper.GetMenuAsset("Blab");
+
+        REQUIRE(menu->itemCount == 2);
+        REQUIRE(menu->items != nullptr);
+
+        REQUIRE(menu->visibleExp != nullptr);
+        REQUIRE(menu->items[0]->visibleExp == menu->visibleExp);
+        REQUIRE(menu->items[1]->visibleExp != nullptr);
+        REQUIRE(menu->items[1]->visibleExp != menu->visibleExp);
+    }
 } // namespace test::game::iw4::menu::parsing::it
@@ -0,0 +1,99 @@
+#include "Image/IwiLoader.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // A 4x4 rgba iwi of IW4 with all three mip levels, which are stored from the smallest to the biggest one
+    std::vector<uint8_t> CreateIwi8()
+    {
+        constexpr auto headerSize = sizeof(IwiVersion) + sizeof(iwi8::IwiHeader);
+
+        IwiVersion version{};
+        version.tag[0] = 'I';
+        version.tag[1] = 'W';
+        version.tag[2] = 'i';
+        version.version = 8;
+
+        iwi8::IwiHeader header{};
+        header.flags = iwi8::IwiFlags::IMG_FLAG_MAPTYPE_2D;
+        header.format = static_cast<int8_t>(iwi8::IwiFormat::IMG_FORMAT_BITMAP_RGBA);
+        header.dimensions[0] = 4;
+        header.dimensions[1] = 4;
+        header.dimensions[2] = 1;
+        header.fileSizeForPicmip[0] = headerSize + 4 + 16 + 64;
+        header.fileSizeForPicmip[1] = headerSize + 4 + 16;
+        header.fileSizeForPicmip[2] = headerSize + 4;
+        header.fileSizeForPicmip[3] = headerSize + 4;
+
+        std::vector<uint8_t> data(headerSize + 4 + 16 + 64);
+        std::memcpy(data.data(), &version, sizeof(version));
+        std::memcpy(&data[sizeof(version)], &header, sizeof(header));
+        for (auto i = headerSize; i < data.size(); i++)
+            data[i] = static_cast<uint8_t>(i);
+
+        return data;
+    }
+} // namespace
+
+TEST_CASE("IwiLoader: Ensure loading from a buffer reads the mip levels from the buffer without copying", "[image][iwi]")
+{
+    const auto iwiData = CreateIwi8();
+    constexpr auto headerSize = sizeof(IwiVersion) + sizeof(iwi8::IwiHeader);
+
+    MemoryManager memory;
+    IwiLoader loader(&memory);
+    auto* texture = loader.LoadIwi(std::span(iwiData.data(), iwiData.size()));
+
+    REQUIRE(texture != nullptr);
+    REQUIRE(texture->GetWidth() == 4u);
+    REQUIRE(texture->GetHeight() == 4u);
+    REQUIRE(texture->HasMipMaps());
+    REQUIRE(texture->GetMipMapCount() == 3);
+
+    REQUIRE(texture->GetBufferForMipLevel(2) == &iwiData[headerSize]);
+    REQUIRE(texture->GetBufferForMipLevel(1) == &iwiData[headerSize + 4]);
+    REQUIRE(texture->GetBufferForMipLevel(0) == &iwiData[headerSize + 4 + 16]);
+}
+
+TEST_CASE("IwiLoader: Ensure loading from a buffer and from a stream produces the same texture", "[image][iwi]")
+{
+    const auto iwiData = CreateIwi8();
+
+    MemoryManager memory;
+    IwiLoader loader(&memory);
+
+    std::istringstream stream(std::string(reinterpret_cast<const char*>(iwiData.data()), iwiData.size()));
+    auto* streamTexture = loader.LoadIwi(stream);
+
+    auto ownedData = std::make_unique<uint8_t[]>(iwiData.size());
+    std::memcpy(ownedData.get(), iwiData.data(), iwiData.size());
+    auto* bufferTexture = loader.LoadIwi(std::move(ownedData), iwiData.size());
+
+    REQUIRE(streamTexture != nullptr);
+    REQUIRE(bufferTexture != nullptr);
+    REQUIRE(streamTexture->GetMipMapCount() == bufferTexture->GetMipMapCount());
+
+    for (auto mipLevel = 0; mipLevel < streamTexture->GetMipMapCount(); mipLevel++)
+    {
+        const auto mipSize = streamTexture->GetSizeOfMipLevel(mipLevel);
+        REQUIRE(bufferTexture->GetSizeOfMipLevel(mipLevel) == mipSize);
+        REQUIRE(std::memcmp(streamTexture->GetBufferForMipLevel(mipLevel), bufferTexture->GetBufferForMipLevel(mipLevel), mipSize) == 0);
+    }
+}
+
+TEST_CASE("IwiLoader: Ensure truncated buffers are rejected", "[image][iwi]")
+{
+    const auto iwiData = CreateIwi8();
+
+    MemoryManager memory;
+    IwiLoader loader(&memory);
+
+    REQUIRE(loader.LoadIwi(std::span(iwiData.data(), iwiData.size() - 1)) == nullptr);
+    REQUIRE(loader.LoadIwi(std::span(iwiData.data(), 6u)) == nullptr);
+}
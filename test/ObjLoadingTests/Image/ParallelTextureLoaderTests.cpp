@@ -0,0 +1,68 @@
+#include "Image/ParallelTextureLoader.h"
+
+#include "ObjLoading.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    void LoadTexturesWithWorkers(const unsigned workerCount)
+    {
+        const auto previousWorkerCount = ObjLoading::Configuration.ImageLoadWorkerCount;
+        ObjLoading::Configuration.ImageLoadWorkerCount = workerCount;
+
+        MemoryManager memory;
+        std::vector<size_t> loadedIndices;
+        std::vector<Texture*> loadedTextures;
+        parallel_texture_loader::LoadTextures(
+            memory,
+            20u,
+            [](const size_t index, MemoryManager& textureMemory) -> Texture*
+            {
+                // Every third texture cannot be found
+                if (index % 3u == 0u)
+                    return nullptr;
+
+                auto* texture = textureMemory.Create<Texture2D>(&ImageFormat::FORMAT_R8_G8_B8_A8, static_cast<unsigned>(index), 1u, false);
+                texture->Allocate();
+                return texture;
+            },
+            [&loadedIndices, &loadedTextures](const size_t index, Texture* texture)
+            {
+                loadedIndices.emplace_back(index);
+                loadedTextures.emplace_back(texture);
+            });
+
+        ObjLoading::Configuration.ImageLoadWorkerCount = previousWorkerCount;
+
+        REQUIRE(loadedIndices.size() == 20u);
+        for (auto index = 0u; index < 20u; index++)
+        {
+            REQUIRE(loadedIndices[index] == index);
+            if (index % 3u == 0u)
+            {
+                REQUIRE(loadedTextures[index] == nullptr);
+            }
+            else
+            {
+                REQUIRE(loadedTextures[index] != nullptr);
+                REQUIRE(loadedTextures[index]->GetWidth() == index);
+            }
+        }
+
+        // The textures were handed over to the memory that was passed in
+        REQUIRE(memory.GetAllocatedSize() > 0u);
+    }
+
+    TEST_CASE("ParallelTextureLoader: Loads textures one after another", "[image]")
+    {
+        LoadTexturesWithWorkers(0u);
+    }
+
+    TEST_CASE("ParallelTextureLoader: Loads textures on workers in order", "[image]")
+    {
+        LoadTexturesWithWorkers(4u);
+    }
+} // namespace
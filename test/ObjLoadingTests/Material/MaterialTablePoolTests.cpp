@@ -0,0 +1,46 @@
+#include "Material/MaterialTablePool.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+
+using namespace material;
+
+namespace
+{
+    TEST_CASE("MaterialTablePool: Returns the same table for identical entries", "[material]")
+    {
+        MemoryManager memory;
+        MaterialTablePool<uint32_t> pool;
+
+        const uint32_t entries0[]{1u, 2u, 3u};
+        const uint32_t entries1[]{1u, 2u, 3u};
+
+        auto* table0 = pool.GetTable(memory, entries0, std::extent_v<decltype(entries0)>);
+        auto* table1 = pool.GetTable(memory, entries1, std::extent_v<decltype(entries1)>);
+
+        REQUIRE(table0 != nullptr);
+        REQUIRE(table0 == table1);
+        REQUIRE(table0 != entries0);
+        REQUIRE(table0[0] == 1u);
+        REQUIRE(table0[1] == 2u);
+        REQUIRE(table0[2] == 3u);
+    }
+
+    TEST_CASE("MaterialTablePool: Returns different tables for different entries", "[material]")
+    {
+        MemoryManager memory;
+        MaterialTablePool<uint32_t> pool;
+
+        const uint32_t entries0[]{1u, 2u, 3u};
+        const uint32_t entries1[]{1u, 2u, 4u};
+
+        auto* table0 = pool.GetTable(memory, entries0, std::extent_v<decltype(entries0)>);
+        auto* table1 = pool.GetTable(memory, entries1, std::extent_v<decltype(entries1)>);
+        auto* table2 = pool.GetTable(memory, entries0, 2u);
+
+        REQUIRE(table0 != table1);
+        REQUIRE(table0 != table2);
+        REQUIRE(table1 != table2);
+        REQUIRE(pool.GetTable(memory, entries0, 0u) == nullptr);
+    }
+} // namespace
@@ -0,0 +1,134 @@
+#include "ObjContainer/ObjContainerRepository.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    class TestContainer final : public IObjContainer
+    {
+    public:
+        explicit TestContainer(std::string name)
+            : m_name(std::move(name))
+        {
+        }
+
+        std::string GetName() override
+        {
+            return m_name;
+        }
+
+    private:
+        std::string m_name;
+    };
+
+    class TestReferencer
+    {
+    };
+
+    std::vector<std::string> GetContainerNames(ObjContainerRepository<TestContainer, TestReferencer>& repository)
+    {
+        std::vector<std::string> names;
+        for (auto* container : repository)
+            names.emplace_back(container->GetName());
+
+        return names;
+    }
+} // namespace
+
+TEST_CASE("ObjContainerRepository: Ensure containers can be found by name", "[objcontainer]")
+{
+    ObjContainerRepository<TestContainer, TestReferencer> repository;
+    TestReferencer referencer;
+
+    repository.AddContainer(std::make_unique<TestContainer>("first"), &referencer);
+    repository.AddContainer(std::make_unique<TestContainer>("second"), &referencer);
+
+    REQUIRE(repository.GetContainerByName("first") != nullptr);
+    REQUIRE(repository.GetContainerByName("first")->GetName() == "first");
+    REQUIRE(repository.GetContainerByName("second")->GetName() == "second");
+    REQUIRE(repository.GetContainerByName("third") == nullptr);
+}
+
+TEST_CASE("ObjContainerRepository: Ensure containers are only removed when they are no longer referenced", "[objcontainer]")
+{
+    ObjContainerRepository<TestContainer, TestReferencer> repository;
+    TestReferencer referencer0;
+    TestReferencer referencer1;
+
+    repository.AddContainer(std::make_unique<TestContainer>("shared"), &referencer0);
+    repository.AddContainer(std::make_unique<TestContainer>("own"), &referencer0);
+    REQUIRE(repository.AddContainerReference(repository.GetContainerByName("shared"), &referencer1));
+
+    repository.RemoveContainerReferences(&referencer0);
+    REQUIRE(repository.GetContainerByName("own") == nullptr);
+    REQUIRE(repository.GetContainerByName("shared") != nullptr);
+    REQUIRE(GetContainerNames(repository) == std::vector<std::string>{"shared"});
+
+    repository.RemoveContainerReferences(&referencer1);
+    REQUIRE(repository.GetContainerByName("shared") == nullptr);
+    REQUIRE(GetContainerNames(repository).empty());
+}
+
+TEST_CASE("ObjContainerRepository: Ensure the first added container is found when names are duplicated", "[objcontainer]")
+{
+    ObjContainerRepository<TestContainer, TestReferencer> repository;
+    TestReferencer referencer0;
+    TestReferencer referencer1;
+
+    repository.AddContainer(std::make_unique<TestContainer>("name"), &referencer0);
+    auto* firstContainer = repository.GetContainerByName("name");
+    repository.AddContainer(std::make_unique<TestContainer>("name"), &referencer1);
+
+    REQUIRE(repository.GetContainerByName("name") == firstContainer);
+    REQUIRE(GetContainerNames(repository).size() == 2u);
+
+    repository.RemoveContainerReferences(&referencer0);
+    REQUIRE(repository.GetContainerByName("name") != nullptr);
+    REQUIRE(repository.GetContainerByName("name") != firstContainer);
+}
+
+TEST_CASE("ObjContainerRepository: Ensure references to unknown containers are rejected", "[objcontainer]")
+{
+    ObjContainerRepository<TestContainer, TestReferencer> repository;
+    TestReferencer referencer;
+    TestContainer unknownContainer("unknown");
+
+    REQUIRE(!repository.AddContainerReference(&unknownContainer, &referencer));
+    repository.RemoveContainerReferences(&referencer);
+    REQUIRE(GetContainerNames(repository).empty());
+}
+
+TEST_CASE("ObjContainerRepository: Ensure callbacks are called when containers are added and removed", "[objcontainer]")
+{
+    std::vector<std::string> addedNames;
+    std::vector<std::string> removedNames;
+    ObjContainerRepository<TestContainer, TestReferencer> repository(
+        [&addedNames](TestContainer* container)
+        {
+            addedNames.emplace_back(container->GetName());
+        },
+        [&removedNames, &repository](TestContainer* container)
+        {
+            // Removed containers are still part of the repository while the callback is called
+            REQUIRE(repository.GetContainerByName(container->GetName()) == container);
+            removedNames.emplace_back(container->GetName());
+        });
+    TestReferencer referencer0;
+    TestReferencer referencer1;
+
+    repository.AddContainer(std::make_unique<TestContainer>("shared"), &referencer0);
+    repository.AddContainer(std::make_unique<TestContainer>("own"), &referencer0);
+    REQUIRE(repository.AddContainerReference(repository.GetContainerByName("shared"), &referencer1));
+    const std::vector<std::string> expectedAddedNames{"shared", "own"};
+    REQUIRE(addedNames == expectedAddedNames);
+
+    repository.RemoveContainerReferences(&referencer0);
+    REQUIRE(removedNames == std::vector<std::string>{"own"});
+
+    repository.RemoveContainerReferences(&referencer1);
+    const std::vector<std::string> expectedRemovedNames{"own", "shared"};
+    REQUIRE(removedNames == expectedRemovedNames);
+}
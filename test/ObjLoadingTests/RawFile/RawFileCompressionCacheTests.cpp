@@ -0,0 +1,145 @@
+#include "RawFile/RawFileCompressionCache.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    std::string CreateTestData(const char first)
+    {
+        std::string data(0x1000, '\0');
+        for (auto i = 0u; i < data.size(); i++)
+            data[i] = static_cast<char>(first + i % 7u);
+
+        return data;
+    }
+
+    TEST_CASE("RawFileCompressionCache: Returns the same data when compressing an unchanged raw file again", "[rawfile][cache]")
+    {
+        RawFileCompressionCache cache;
+        cache.Enable();
+        MemoryManager memory;
+        const auto data = CreateTestData('a');
+
+        size_t compressedSize0 = 0u;
+        const auto* compressed0 = cache.Compress("test.gsc", data.data(), data.size(), memory, compressedSize0);
+        REQUIRE(compressed0);
+        REQUIRE(compressedSize0 > 0u);
+        REQUIRE(compressedSize0 < data.size());
+
+        size_t compressedSize1 = 0u;
+        const auto* compressed1 = cache.Compress("test.gsc", data.data(), data.size(), memory, compressedSize1);
+        REQUIRE(compressed1);
+        REQUIRE(compressed1 != compressed0);
+        REQUIRE(compressedSize1 == compressedSize0);
+        REQUIRE(std::memcmp(compressed0, compressed1, compressedSize0) == 0);
+    }
+
+    TEST_CASE("RawFileCompressionCache: Compresses changed raw files again", "[rawfile][cache]")
+    {
+        RawFileCompressionCache cache;
+        cache.Enable();
+        MemoryManager memory;
+        const auto data = CreateTestData('a');
+        const auto changedData = CreateTestData('k') + "changed";
+
+        size_t compressedSize0 = 0u;
+        const auto* compressed0 = cache.Compress("test.gsc", data.data(), data.size(), memory, compressedSize0);
+        REQUIRE(compressed0);
+
+        size_t compressedSize1 = 0u;
+        const auto* compressed1 = cache.Compress("test.gsc", changedData.data(), changedData.size(), memory, compressedSize1);
+        REQUIRE(compressed1);
+        REQUIRE((compressedSize1 != compressedSize0 || std::memcmp(compressed0, compressed1, compressedSize0) != 0));
+    }
+
+    TEST_CASE("RawFileCompressionCache: Keeps compressed raw files when saving and loading the cache", "[rawfile][cache]")
+    {
+        const auto cacheFilePath = (fs::temp_directory_path() / "oat_rawfile_cache_test.bin").string();
+        const auto secondCacheFilePath = (fs::temp_directory_path() / "oat_rawfile_cache_test_2.bin").string();
+        fs::remove(secondCacheFilePath);
+
+        MemoryManager memory;
+        const auto data = CreateTestData('a');
+        std::string expectedCompressedData;
+
+        {
+            RawFileCompressionCache cache;
+            cache.Enable();
+            size_t compressedSize = 0u;
+            const auto* compressed = cache.Compress("test.gsc", data.data(), data.size(), memory, compressedSize);
+            REQUIRE(compressed);
+            expectedCompressedData.assign(compressed, compressedSize);
+            REQUIRE(cache.Save(cacheFilePath));
+        }
+
+        RawFileCompressionCache cache;
+        cache.Enable();
+        REQUIRE(cache.Load(cacheFilePath));
+
+        size_t compressedSize = 0u;
+        const auto* compressed = cache.Compress("test.gsc", data.data(), data.size(), memory, compressedSize);
+        REQUIRE(compressed);
+        REQUIRE(std::string(compressed, compressedSize) == expectedCompressedData);
+
+        // The raw file was taken from the loaded cache so there is nothing new to save
+        REQUIRE(cache.Save(secondCacheFilePath));
+        REQUIRE(!fs::exists(secondCacheFilePath));
+
+        fs::remove(cacheFilePath);
+    }
+
+    TEST_CASE("RawFileCompressionCache: Does not keep raw files unless enabled", "[rawfile][cache]")
+    {
+        const auto cacheFilePath = (fs::temp_directory_path() / "oat_rawfile_cache_disabled_test.bin").string();
+        fs::remove(cacheFilePath);
+
+        RawFileCompressionCache cache;
+        MemoryManager memory;
+        const auto data = CreateTestData('a');
+
+        size_t compressedSize = 0u;
+        REQUIRE(cache.Compress("test.gsc", data.data(), data.size(), memory, compressedSize));
+        REQUIRE(compressedSize > 0u);
+        REQUIRE(cache.GetCompressedDataSize() == 0u);
+
+        REQUIRE(cache.Save(cacheFilePath));
+        REQUIRE(!fs::exists(cacheFilePath));
+    }
+
+    TEST_CASE("RawFileCompressionCache: Only keeps raw files while they fit into the size limit", "[rawfile][cache]")
+    {
+        MemoryManager memory;
+        const auto data = CreateTestData('a');
+        const auto changedData = CreateTestData('k') + "changed";
+
+        size_t compressedSize = 0u;
+        {
+            RawFileCompressionCache cache;
+            REQUIRE(cache.Compress("test.gsc", data.data(), data.size(), memory, compressedSize));
+        }
+
+        const auto maxCompressedDataSize = compressedSize + compressedSize / 2u;
+        RawFileCompressionCache cache;
+        cache.Enable(maxCompressedDataSize);
+
+        size_t compressedSize0 = 0u;
+        REQUIRE(cache.Compress("test0.gsc", data.data(), data.size(), memory, compressedSize0));
+        REQUIRE(cache.GetCompressedDataSize() == compressedSize0);
+
+        size_t compressedSize1 = 0u;
+        REQUIRE(cache.Compress("test1.gsc", data.data(), data.size(), memory, compressedSize1));
+        REQUIRE(compressedSize1 == compressedSize0);
+        REQUIRE(cache.GetCompressedDataSize() == compressedSize0);
+
+        // Replacing the outdated version of a kept raw file frees its space
+        size_t compressedSize2 = 0u;
+        REQUIRE(cache.Compress("test0.gsc", changedData.data(), changedData.size(), memory, compressedSize2));
+        REQUIRE(compressedSize2 <= maxCompressedDataSize);
+        REQUIRE(cache.GetCompressedDataSize() == compressedSize2);
+    }
+} // namespace
@@ -0,0 +1,87 @@
+#include "StateMap/StateMapHandler.h"
+#include "StateMap/StateMapReader.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+
+using namespace state_map;
+
+namespace
+{
+    const StateMapLayoutEntries testEntryLayout({
+        {"blend", 0, 0xF, {"mtlSrcBlend"}},
+    });
+
+    const StateMapLayoutVars testVarLayout({
+        {"mtlSrcBlend",
+         0, {
+             {"One", 0x1},
+             {"Two", 0x2},
+         }},
+        {"mtlBlendOp",
+         0, {
+             {"Add", 0x10},
+             {"Sub", 0x20},
+         }},
+    });
+
+    const StateMapLayout testLayout(1, testEntryLayout, testVarLayout);
+
+    constexpr auto TEST_STATE_MAP = "blend\n"
+                                    "{\n"
+                                    "  mtlBlendOp == Add && mtlSrcBlend == Two:\n"
+                                    "    One;\n"
+                                    "  mtlBlendOp == Sub:\n"
+                                    "    Two;\n"
+                                    "  default:\n"
+                                    "    passthrough;\n"
+                                    "}\n";
+
+    std::unique_ptr<StateMapDefinition> ReadTestStateMap()
+    {
+        std::istringstream stream(TEST_STATE_MAP);
+        const StateMapReader reader(stream, "test.sm", "test", testLayout);
+
+        return reader.ReadStateMapDefinition();
+    }
+
+    uint32_t ApplyTestStateMap(const StateMapDefinition& stateMap, const uint32_t baseStateBits)
+    {
+        const StateMapHandler handler(testLayout, stateMap);
+        uint32_t outStateBits = 0;
+        handler.ApplyStateMap(&baseStateBits, &outStateBits);
+
+        return outStateBits;
+    }
+
+    TEST_CASE("StateMapHandler: Compiles decision tables when reading state maps", "[statemap]")
+    {
+        const auto stateMap = ReadTestStateMap();
+        REQUIRE(stateMap);
+        REQUIRE(stateMap->m_state_map_entries.size() == 1u);
+        REQUIRE(stateMap->m_state_map_entries[0].m_decision_table.IsCompiled());
+
+        // Both vars have two values and can also have none of them
+        REQUIRE(stateMap->m_state_map_entries[0].m_decision_table.m_rule_indices.size() == 9u);
+    }
+
+    TEST_CASE("StateMapHandler: Decision tables select the same rules as evaluating conditions", "[statemap]")
+    {
+        const auto compiledStateMap = ReadTestStateMap();
+        REQUIRE(compiledStateMap);
+
+        const auto evaluatedStateMap = ReadTestStateMap();
+        REQUIRE(evaluatedStateMap);
+        evaluatedStateMap->m_state_map_entries[0].m_decision_table = StateMapEntryDecisionTable();
+
+        for (const auto baseStateBits : {0x12u, 0x11u, 0x21u, 0x22u, 0x02u, 0x10u, 0x00u})
+        {
+            INFO("Base state bits: " << baseStateBits);
+            REQUIRE(ApplyTestStateMap(*compiledStateMap, baseStateBits) == ApplyTestStateMap(*evaluatedStateMap, baseStateBits));
+        }
+
+        REQUIRE(ApplyTestStateMap(*compiledStateMap, 0x12u) == 0x11u);
+        REQUIRE(ApplyTestStateMap(*compiledStateMap, 0x21u) == 0x22u);
+        REQUIRE(ApplyTestStateMap(*compiledStateMap, 0x11u) == 0x11u);
+    }
+} // namespace
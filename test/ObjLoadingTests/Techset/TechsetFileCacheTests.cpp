@@ -0,0 +1,73 @@
+#include "Techset/TechsetFileCache.h"
+
+#include "Mock/MockSearchPath.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+using namespace techset;
+
+namespace
+{
+    class ParsedFile
+    {
+    public:
+        std::string m_content;
+    };
+
+    std::unique_ptr<ParsedFile> ParseFile(std::istream& stream, int& parseCount)
+    {
+        parseCount++;
+        auto parsedFile = std::make_unique<ParsedFile>();
+        std::getline(stream, parsedFile->m_content);
+
+        return parsedFile;
+    }
+
+    TEST_CASE("TechsetFileCache: Only parses files with the same content once", "[techset][cache]")
+    {
+        MockSearchPath searchPath;
+        searchPath.AddFileData("techsets/test.techset", "hello");
+        MockSearchPath otherSearchPath;
+        otherSearchPath.AddFileData("techsets/test.techset", "hello");
+
+        TechsetFileCache<ParsedFile> cache;
+        auto parseCount = 0;
+        const auto parse = [&parseCount](std::istream& stream)
+        {
+            return ParseFile(stream, parseCount);
+        };
+
+        const auto first = cache.GetDefinition(&searchPath, "techsets/test.techset", parse);
+        const auto second = cache.GetDefinition(&otherSearchPath, "techsets/test.techset", parse);
+
+        REQUIRE(first);
+        REQUIRE(first == second);
+        REQUIRE(first->m_content == "hello");
+        REQUIRE(parseCount == 1);
+    }
+
+    TEST_CASE("TechsetFileCache: Parses files again when their content changed", "[techset][cache]")
+    {
+        MockSearchPath searchPath;
+        searchPath.AddFileData("techsets/test.techset", "hello");
+        MockSearchPath changedSearchPath;
+        changedSearchPath.AddFileData("techsets/test.techset", "world");
+
+        TechsetFileCache<ParsedFile> cache;
+        auto parseCount = 0;
+        const auto parse = [&parseCount](std::istream& stream)
+        {
+            return ParseFile(stream, parseCount);
+        };
+
+        const auto first = cache.GetDefinition(&searchPath, "techsets/test.techset", parse);
+        const auto changed = cache.GetDefinition(&changedSearchPath, "techsets/test.techset", parse);
+        const auto missing = cache.GetDefinition(&searchPath, "techsets/missing.techset", parse);
+
+        REQUIRE(first->m_content == "hello");
+        REQUIRE(changed->m_content == "world");
+        REQUIRE(!missing);
+        REQUIRE(parseCount == 2);
+    }
+} // namespace
@@ -0,0 +1,125 @@
+#include "XModel/MeshOptimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr size_t GRID_SIZE = 32u;
+
+    std::vector<uint16_t> CreateShuffledGrid()
+    {
+        std::vector<std::array<uint16_t, 3>> tris;
+        for (auto y = 0u; y < GRID_SIZE; y++)
+        {
+            for (auto x = 0u; x < GRID_SIZE; x++)
+            {
+                const auto v0 = static_cast<uint16_t>(y * (GRID_SIZE + 1u) + x);
+                const auto v1 = static_cast<uint16_t>(v0 + 1u);
+                const auto v2 = static_cast<uint16_t>(v0 + GRID_SIZE + 1u);
+                const auto v3 = static_cast<uint16_t>(v2 + 1u);
+                tris.push_back({v0, v1, v2});
+                tris.push_back({v1, v3, v2});
+            }
+        }
+
+        std::mt19937 random(1337u);
+        std::ranges::shuffle(tris, random);
+
+        std::vector<uint16_t> triData;
+        for (const auto& tri : tris)
+            triData.insert(triData.end(), tri.begin(), tri.end());
+
+        return triData;
+    }
+
+    size_t CountFifoCacheMisses(const std::vector<uint16_t>& triData, const size_t cacheSize)
+    {
+        std::vector<uint16_t> cache;
+        size_t misses = 0u;
+        for (const auto vertexIndex : triData)
+        {
+            if (std::ranges::find(cache, vertexIndex) != cache.end())
+                continue;
+
+            misses++;
+            cache.insert(cache.begin(), vertexIndex);
+            if (cache.size() > cacheSize)
+                cache.pop_back();
+        }
+
+        return misses;
+    }
+
+    std::vector<std::array<uint16_t, 3>> GetSortedTris(const std::vector<uint16_t>& triData)
+    {
+        std::vector<std::array<uint16_t, 3>> tris;
+        for (auto i = 0u; i < triData.size(); i += 3u)
+            tris.push_back({triData[i], triData[i + 1u], triData[i + 2u]});
+        std::ranges::sort(tris);
+
+        return tris;
+    }
+
+    TEST_CASE("MeshOptimizer: Vertex cache optimisation reduces cache misses", "[xmodel][mesh]")
+    {
+        auto triData = CreateShuffledGrid();
+        const auto originalTris = GetSortedTris(triData);
+        const auto originalMisses = CountFifoCacheMisses(triData, 16u);
+
+        constexpr auto vertexCount = (GRID_SIZE + 1u) * (GRID_SIZE + 1u);
+        mesh_optimizer::OptimizeVertexCache(triData.data(), triData.size() / 3u, vertexCount);
+
+        // The same tris with the same winding are kept
+        REQUIRE(GetSortedTris(triData) == originalTris);
+        REQUIRE(CountFifoCacheMisses(triData, 16u) * 2u < originalMisses);
+    }
+
+    TEST_CASE("MeshOptimizer: Overdraw optimisation draws clusters facing away from the center first", "[xmodel][mesh]")
+    {
+        // Two separate quads facing the same direction, only the second one is facing away from the center
+        const std::vector<float> positions{
+            0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 5.0f, 1.0f, 0.0f, 5.0f, 0.0f, 1.0f, 5.0f, 1.0f, 1.0f, 5.0f,
+        };
+        std::vector<uint16_t> triData{
+            0, 1, 2, 1, 3, 2, // Facing +z at z=0
+            4, 5, 6, 5, 7, 6, // Facing +z at z=5
+        };
+        const auto originalTris = GetSortedTris(triData);
+
+        mesh_optimizer::OptimizeOverdraw(triData.data(), triData.size() / 3u, positions.data(), sizeof(float) * 3u);
+
+        REQUIRE(GetSortedTris(triData) == originalTris);
+        REQUIRE(triData[0] == 4u);
+        REQUIRE(triData[6] == 0u);
+    }
+
+    TEST_CASE("MeshOptimizer: Vertex fetch order follows the first use within ranges", "[xmodel][mesh]")
+    {
+        const std::vector<uint16_t> triData{
+            2, 1, 0, 5, 4, 3,
+        };
+        const std::vector<size_t> rangeEnds{3u};
+
+        const auto vertexOrder = mesh_optimizer::CreateVertexFetchOrder(triData.data(), triData.size() / 3u, 7u, rangeEnds);
+
+        const std::vector<size_t> expectedOrder{2u, 1u, 0u, 5u, 4u, 3u, 6u};
+        REQUIRE(vertexOrder == expectedOrder);
+    }
+
+    TEST_CASE("MeshOptimizer: Vertex fetch order does not move vertices out of their range", "[xmodel][mesh]")
+    {
+        const std::vector<uint16_t> triData{
+            4, 3, 1, 0, 2, 3,
+        };
+        const std::vector<size_t> rangeEnds{2u, 5u};
+
+        const auto vertexOrder = mesh_optimizer::CreateVertexFetchOrder(triData.data(), triData.size() / 3u, 5u, rangeEnds);
+
+        const std::vector<size_t> expectedOrder{1u, 0u, 4u, 3u, 2u};
+        REQUIRE(vertexOrder == expectedOrder);
+    }
+} // namespace
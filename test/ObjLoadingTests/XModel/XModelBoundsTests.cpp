@@ -0,0 +1,110 @@
+#include "XModel/XModelBounds.h"
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+namespace
+{
+    TEST_CASE("XModelBounds: Calculates bounds of vertices", "[xmodel][bounds]")
+    {
+        // Every vertex is followed by a float that is not part of the position
+        std::vector<float> vertexData;
+        for (auto i = 0u; i < 40000u; i++)
+        {
+            const auto value = static_cast<float>(i % 1000u) - 500.0f;
+            vertexData.insert(vertexData.end(), {value, -value * 2.0f, 1.0f, 12345.0f});
+        }
+
+        const auto bounds = xmodel_bounds::CalculateVertexBounds(vertexData.data(), sizeof(float) * 4u, 40000u);
+
+        REQUIRE(bounds.mins[0] == -500.0f);
+        REQUIRE(bounds.maxs[0] == 499.0f);
+        REQUIRE(bounds.mins[1] == -998.0f);
+        REQUIRE(bounds.maxs[1] == 1000.0f);
+        REQUIRE(bounds.mins[2] == 1.0f);
+        REQUIRE(bounds.maxs[2] == 1.0f);
+    }
+
+    TEST_CASE("XModelBounds: Collision tree leafs cover all tris within their bounds", "[xmodel][bounds]")
+    {
+        // A strip of quads along the x axis
+        constexpr auto quadCount = 64u;
+        std::vector<float> positions;
+        for (auto i = 0u; i <= quadCount; i++)
+            positions.insert(positions.end(), {static_cast<float>(i), 0.0f, 0.0f, static_cast<float>(i), 1.0f, 0.0f});
+
+        std::vector<uint16_t> triData;
+        for (auto i = 0u; i < quadCount; i++)
+        {
+            const auto v0 = static_cast<uint16_t>(i * 2u);
+            triData.insert(triData.end(), {v0, static_cast<uint16_t>(v0 + 2u), static_cast<uint16_t>(v0 + 1u)});
+            triData.insert(triData.end(), {static_cast<uint16_t>(v0 + 1u), static_cast<uint16_t>(v0 + 2u), static_cast<uint16_t>(v0 + 3u)});
+        }
+
+        const auto originalTris = triData;
+        const auto triCount = triData.size() / 3u;
+        const auto nodes = xmodel_bounds::BuildCollisionTree(triData.data(), triCount, positions.data(), sizeof(float) * 3u, 4u);
+
+        REQUIRE(!nodes.empty());
+        REQUIRE(nodes[0].bounds.mins[0] == 0.0f);
+        REQUIRE(nodes[0].bounds.maxs[0] == static_cast<float>(quadCount));
+
+        std::vector<bool> triCovered(triCount, false);
+        for (const auto& node : nodes)
+        {
+            if (node.childCount > 0u)
+            {
+                REQUIRE(node.firstIndex + node.childCount <= nodes.size());
+                continue;
+            }
+
+            REQUIRE(node.triCount <= 4u);
+            for (auto triIndex = node.firstIndex; triIndex < node.firstIndex + node.triCount; triIndex++)
+            {
+                REQUIRE(!triCovered[triIndex]);
+                triCovered[triIndex] = true;
+
+                for (auto triVertexIndex = 0u; triVertexIndex < 3u; triVertexIndex++)
+                {
+                    const auto x = positions[triData[triIndex * 3u + triVertexIndex] * 3u];
+                    REQUIRE(x >= node.bounds.mins[0]);
+                    REQUIRE(x <= node.bounds.maxs[0]);
+                }
+            }
+        }
+
+        REQUIRE(std::ranges::all_of(triCovered,
+                                    [](const bool covered)
+                                    {
+                                        return covered;
+                                    }));
+
+        // Tris are only reordered
+        std::vector<std::array<uint16_t, 3>> sortedOriginal;
+        std::vector<std::array<uint16_t, 3>> sortedResult;
+        for (auto i = 0u; i < triData.size(); i += 3u)
+        {
+            sortedOriginal.push_back({originalTris[i], originalTris[i + 1u], originalTris[i + 2u]});
+            sortedResult.push_back({triData[i], triData[i + 1u], triData[i + 2u]});
+        }
+        std::ranges::sort(sortedOriginal);
+        std::ranges::sort(sortedResult);
+        REQUIRE(sortedOriginal == sortedResult);
+    }
+
+    TEST_CASE("XModelBounds: Tris in the same spot are not split", "[xmodel][bounds]")
+    {
+        const std::vector<float> positions{0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+        std::vector<uint16_t> triData;
+        for (auto i = 0u; i < 10u; i++)
+            triData.insert(triData.end(), {0u, 1u, 2u});
+
+        const auto nodes = xmodel_bounds::BuildCollisionTree(triData.data(), 10u, positions.data(), sizeof(float) * 3u, 4u);
+
+        REQUIRE(nodes.size() == 1u);
+        REQUIRE(nodes[0].childCount == 0u);
+        REQUIRE(nodes[0].triCount == 10u);
+    }
+} // namespace
@@ -216,4 +216,36 @@ namespace test::parsing::impl::comment_removing_stream_proxy
 
         REQUIRE(proxy.Eof());
     }
+
+    TEST_CASE("CommentRemovingStreamProxy: Ignores comments inside of strings", "[parsing][parsingstream]")
+    {
+        const std::vector<std::string> lines{
+            R"(url "http://test" // comment)",
+            R"(text "quote \" /* not a comment */" /* comment */ end)",
+            R"(path "C:\\" // comment)",
+        };
+
+        MockParserLineStream mockStream(lines);
+        CommentRemovingStreamProxy proxy(&mockStream);
+
+        {
+            auto line = proxy.NextLine();
+            REQUIRE(line.m_line_number == 1);
+            REQUIRE(line.m_line == R"(url "http://test" )");
+        }
+
+        {
+            auto line = proxy.NextLine();
+            REQUIRE(line.m_line_number == 2);
+            REQUIRE(line.m_line == R"(text "quote \" /* not a comment */"  end)");
+        }
+
+        {
+            auto line = proxy.NextLine();
+            REQUIRE(line.m_line_number == 3);
+            REQUIRE(line.m_line == R"(path "C:\\" )");
+        }
+
+        REQUIRE(proxy.Eof());
+    }
 } // namespace test::parsing::impl::comment_removing_stream_proxy
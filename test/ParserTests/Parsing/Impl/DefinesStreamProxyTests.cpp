@@ -1226,4 +1226,26 @@ namespace test::parsing::impl::defines_stream_proxy
 
         REQUIRE(proxy.Eof());
     }
+
+    TEST_CASE("DefinesStreamProxy: Ensure nested parameterized macros are expanded in a single line", "[parsing][parsingstream]")
+    {
+        const std::vector<std::string> lines{
+            "#define ADD(a, b) (a + b)",
+            "#define MUL(a, b) (a * b)",
+            "#define CALC(x, y) MUL(ADD(x, y), ADD(y, x))",
+            "#define SQUARE(a) (a * a)",
+            "val CALC(1, 2) CALC(SQUARE(3), 5) end",
+        };
+
+        MockParserLineStream mockStream(lines);
+        DefinesStreamProxy proxy(&mockStream);
+
+        ExpectLine(&proxy, 1, "");
+        ExpectLine(&proxy, 2, "");
+        ExpectLine(&proxy, 3, "");
+        ExpectLine(&proxy, 4, "");
+        ExpectLine(&proxy, 5, "val ((1 + 2) * (2 + 1)) (((3 * 3) + 5) * (5 + (3 * 3))) end");
+
+        REQUIRE(proxy.Eof());
+    }
 } // namespace test::parsing::impl::defines_stream_proxy
@@ -0,0 +1,69 @@
+#include "Pool/AssetClosure.h"
+
+#include "Game/T6/GameAssetPoolT6.h"
+#include "Game/T6/GameT6.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace T6;
+
+namespace
+{
+    TEST_CASE("AssetClosure: Contains assets reachable through dependencies and indirect references", "[zonecommon][pool]")
+    {
+        Zone zone("test", 0, &g_GameT6);
+        GameAssetPoolT6 pools(&zone, 0);
+        pools.InitPoolDynamic(ASSET_TYPE_IMAGE);
+        pools.InitPoolDynamic(ASSET_TYPE_MATERIAL);
+        pools.InitPoolDynamic(ASSET_TYPE_RAWFILE);
+        pools.InitPoolDynamic(ASSET_TYPE_STRINGTABLE);
+
+        GfxImage image{};
+        Material material{};
+        Material otherMaterial{};
+        RawFile script{};
+        StringTable table{};
+        StringTable otherTable{};
+
+        auto* imageInfo = pools.AddAsset(ASSET_TYPE_IMAGE, "image", &image, {}, {}, {});
+        auto* materialInfo = pools.AddAsset(ASSET_TYPE_MATERIAL, "material", &material, {imageInfo}, {}, {});
+        auto* otherMaterialInfo = pools.AddAsset(ASSET_TYPE_MATERIAL, "other_material", &otherMaterial, {imageInfo}, {}, {});
+        auto* tableInfo = pools.AddAsset(ASSET_TYPE_STRINGTABLE, "table.csv", &table, {}, {}, {});
+        auto* otherTableInfo = pools.AddAsset(ASSET_TYPE_STRINGTABLE, "other_table.csv", &otherTable, {}, {}, {});
+        auto* scriptInfo =
+            pools.AddAsset(ASSET_TYPE_RAWFILE, "script.gsc", &script, {materialInfo}, {}, {IndirectAssetReference(ASSET_TYPE_STRINGTABLE, "table.csv")});
+
+        AssetClosure closure(pools);
+        closure.AddRoot(scriptInfo);
+
+        REQUIRE(closure.GetAssetCount() == 4u);
+        REQUIRE(closure.Contains(scriptInfo));
+        REQUIRE(closure.Contains(materialInfo));
+        REQUIRE(closure.Contains(imageInfo));
+        REQUIRE(closure.Contains(tableInfo));
+        REQUIRE(!closure.Contains(otherMaterialInfo));
+        REQUIRE(!closure.Contains(otherTableInfo));
+
+        REQUIRE(closure.ContainsAssetType(ASSET_TYPE_IMAGE));
+        REQUIRE(closure.ContainsAssetType(ASSET_TYPE_STRINGTABLE));
+        REQUIRE(!closure.ContainsAssetType(ASSET_TYPE_SOUND));
+    }
+
+    TEST_CASE("AssetClosure: Visits assets that are reachable in multiple ways once", "[zonecommon][pool]")
+    {
+        Zone zone("test", 0, &g_GameT6);
+        GameAssetPoolT6 pools(&zone, 0);
+        pools.InitPoolDynamic(ASSET_TYPE_RAWFILE);
+
+        RawFile first{};
+        RawFile second{};
+        auto* firstInfo = pools.AddAsset(ASSET_TYPE_RAWFILE, "first", &first, {}, {}, {IndirectAssetReference(ASSET_TYPE_RAWFILE, "second")});
+        auto* secondInfo = pools.AddAsset(ASSET_TYPE_RAWFILE, "second", &second, {firstInfo}, {}, {});
+
+        AssetClosure closure(pools);
+        closure.AddRoot(firstInfo);
+        closure.AddRoot(secondInfo);
+
+        REQUIRE(closure.GetAssetCount() == 2u);
+    }
+} // namespace
@@ -0,0 +1,108 @@
+#include "Pool/AssetWriteOrder.h"
+
+#include "Game/T6/GameAssetPoolT6.h"
+#include "Game/T6/GameT6.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace T6;
+
+namespace
+{
+    class AssetWriteOrderFixture
+    {
+    public:
+        AssetWriteOrderFixture()
+            : m_zone("test", 0, &g_GameT6),
+              m_pools(&m_zone, 0),
+              m_image{},
+              m_other_image{},
+              m_material{},
+              m_other_material{},
+              m_script{},
+              m_table{}
+        {
+            m_pools.InitPoolDynamic(ASSET_TYPE_IMAGE);
+            m_pools.InitPoolDynamic(ASSET_TYPE_MATERIAL);
+            m_pools.InitPoolDynamic(ASSET_TYPE_RAWFILE);
+            m_pools.InitPoolDynamic(ASSET_TYPE_STRINGTABLE);
+
+            // Definition order: image, material, table, other_image, other_material, script
+            m_image_info = m_pools.AddAsset(ASSET_TYPE_IMAGE, "image", &m_image, {}, {}, {});
+            m_material_info = m_pools.AddAsset(ASSET_TYPE_MATERIAL, "material", &m_material, {m_image_info}, {}, {});
+            m_table_info = m_pools.AddAsset(ASSET_TYPE_STRINGTABLE, "table.csv", &m_table, {}, {}, {});
+            m_other_image_info = m_pools.AddAsset(ASSET_TYPE_IMAGE, "other_image", &m_other_image, {}, {}, {});
+            m_other_material_info = m_pools.AddAsset(ASSET_TYPE_MATERIAL, "other_material", &m_other_material, {m_other_image_info}, {}, {});
+            m_script_info = m_pools.AddAsset(ASSET_TYPE_RAWFILE, "script.gsc", &m_script, {m_table_info}, {}, {});
+        }
+
+        Zone m_zone;
+        GameAssetPoolT6 m_pools;
+
+        GfxImage m_image;
+        GfxImage m_other_image;
+        Material m_material;
+        Material m_other_material;
+        RawFile m_script;
+        StringTable m_table;
+
+        XAssetInfoGeneric* m_image_info;
+        XAssetInfoGeneric* m_other_image_info;
+        XAssetInfoGeneric* m_material_info;
+        XAssetInfoGeneric* m_other_material_info;
+        XAssetInfoGeneric* m_script_info;
+        XAssetInfoGeneric* m_table_info;
+    };
+
+    TEST_CASE("AssetWriteOrder: Keeps the definition order", "[zonecommon][pool]")
+    {
+        const AssetWriteOrderFixture fixture;
+
+        const auto assets = AssetWriteOrder::GetAssets(fixture.m_pools, AssetWriteOrderMode::DEFINITION);
+
+        const std::vector<XAssetInfoGeneric*> expectedAssets{
+            fixture.m_image_info,
+            fixture.m_material_info,
+            fixture.m_table_info,
+            fixture.m_other_image_info,
+            fixture.m_other_material_info,
+            fixture.m_script_info,
+        };
+        REQUIRE(assets == expectedAssets);
+    }
+
+    TEST_CASE("AssetWriteOrder: Groups assets by type while keeping dependencies first", "[zonecommon][pool]")
+    {
+        const AssetWriteOrderFixture fixture;
+
+        const auto assets = AssetWriteOrder::GetAssets(fixture.m_pools, AssetWriteOrderMode::TYPE);
+
+        // Materials have a lower type than images, but need their images first
+        const std::vector<XAssetInfoGeneric*> expectedAssets{
+            fixture.m_image_info,
+            fixture.m_other_image_info,
+            fixture.m_material_info,
+            fixture.m_other_material_info,
+            fixture.m_table_info,
+            fixture.m_script_info,
+        };
+        REQUIRE(assets == expectedAssets);
+    }
+
+    TEST_CASE("AssetWriteOrder: Writes every asset right after its dependencies", "[zonecommon][pool]")
+    {
+        const AssetWriteOrderFixture fixture;
+
+        const auto assets = AssetWriteOrder::GetAssets(fixture.m_pools, AssetWriteOrderMode::DEPENDENCY);
+
+        const std::vector<XAssetInfoGeneric*> expectedAssets{
+            fixture.m_image_info,
+            fixture.m_material_info,
+            fixture.m_other_image_info,
+            fixture.m_other_material_info,
+            fixture.m_table_info,
+            fixture.m_script_info,
+        };
+        REQUIRE(assets == expectedAssets);
+    }
+} // namespace
@@ -0,0 +1,72 @@
+#include "Pool/GlobalAssetPool.h"
+
+#include "Game/T6/GameAssetPoolT6.h"
+#include "Game/T6/GameT6.h"
+#include "Pool/GlobalAssetPoolLinkOrder.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+
+using namespace T6;
+
+namespace
+{
+    std::unique_ptr<GameAssetPoolT6> CreatePoolsWithRawFile(Zone& zone, RawFile& rawFile)
+    {
+        auto pools = std::make_unique<GameAssetPoolT6>(&zone, 0);
+        pools->InitPoolDynamic(ASSET_TYPE_RAWFILE);
+        pools->AddAsset(ASSET_TYPE_RAWFILE, "shared_rawfile", &rawFile, {}, {}, {});
+
+        return pools;
+    }
+
+    TEST_CASE("GlobalAssetPool: Resolves assets of pools with the same priority in link order", "[zonecommon][pool]")
+    {
+        Zone firstZone("first", 0, &g_GameT6);
+        Zone secondZone("second", 0, &g_GameT6);
+        RawFile firstRawFile{};
+        RawFile secondRawFile{};
+
+        const auto firstPools = CreatePoolsWithRawFile(firstZone, firstRawFile);
+        const auto secondPools = CreatePoolsWithRawFile(secondZone, secondRawFile);
+
+        const auto* resolvedAsset = GlobalAssetPool<RawFile>::GetAssetByName("shared_rawfile");
+        REQUIRE(resolvedAsset != nullptr);
+        REQUIRE(resolvedAsset->m_zone == &firstZone);
+    }
+
+    TEST_CASE("GlobalAssetPool: Resolves assets of pools linked in a batch in batch order", "[zonecommon][pool]")
+    {
+        Zone firstZone("first", 0, &g_GameT6);
+        Zone secondZone("second", 0, &g_GameT6);
+        RawFile firstRawFile{};
+        RawFile secondRawFile{};
+
+        // The second zone is linked before the first one like it can happen when loading both at once
+        const auto batch = GlobalAssetPoolLinkOrder::BeginBatch();
+        std::unique_ptr<GameAssetPoolT6> secondPools;
+        std::unique_ptr<GameAssetPoolT6> firstPools;
+        {
+            const GlobalAssetPoolLinkOrder::BatchScope scope(batch, 1u);
+            secondPools = CreatePoolsWithRawFile(secondZone, secondRawFile);
+        }
+        {
+            const GlobalAssetPoolLinkOrder::BatchScope scope(batch, 0u);
+            firstPools = CreatePoolsWithRawFile(firstZone, firstRawFile);
+        }
+
+        // Pools linked after the batch come after all pools of the batch
+        Zone laterZone("later", 0, &g_GameT6);
+        RawFile laterRawFile{};
+        const auto laterPools = CreatePoolsWithRawFile(laterZone, laterRawFile);
+
+        const auto* resolvedAsset = GlobalAssetPool<RawFile>::GetAssetByName("shared_rawfile");
+        REQUIRE(resolvedAsset != nullptr);
+        REQUIRE(resolvedAsset->m_zone == &firstZone);
+
+        firstPools.reset();
+        resolvedAsset = GlobalAssetPool<RawFile>::GetAssetByName("shared_rawfile");
+        REQUIRE(resolvedAsset != nullptr);
+        REQUIRE(resolvedAsset->m_zone == &secondZone);
+    }
+} // namespace
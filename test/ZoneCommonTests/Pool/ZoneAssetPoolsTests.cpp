@@ -0,0 +1,42 @@
+#include "Pool/ZoneAssetPools.h"
+
+#include "Game/T6/GameAssetPoolT6.h"
+#include "Game/T6/GameT6.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace T6;
+
+namespace
+{
+    TEST_CASE("ZoneAssetPools: Looks up multiple assets and asset references at once", "[zonecommon][pool]")
+    {
+        Zone zone("test", 0, &g_GameT6);
+        GameAssetPoolT6 pools(&zone, 0);
+        pools.InitPoolDynamic(ASSET_TYPE_RAWFILE);
+        pools.InitPoolDynamic(ASSET_TYPE_STRINGTABLE);
+
+        RawFile rawFile{};
+        StringTable stringTable{};
+        auto* rawFileAsset = pools.AddAsset(std::make_unique<XAssetInfo<RawFile>>(ASSET_TYPE_RAWFILE, "rawfile", &rawFile));
+        auto* stringTableReference = pools.AddAsset(std::make_unique<XAssetInfo<StringTable>>(ASSET_TYPE_STRINGTABLE, ",stringtable", &stringTable));
+
+        const std::vector<std::pair<asset_type_t, std::string>> assets{
+            {ASSET_TYPE_RAWFILE,     "rawfile"    },
+            {ASSET_TYPE_STRINGTABLE, "stringtable"},
+            {ASSET_TYPE_RAWFILE,     "stringtable"},
+            {ASSET_TYPE_RAWFILE,     ",rawfile"   },
+        };
+
+        const auto result = pools.GetAssetsOrAssetReferences(assets);
+        REQUIRE(result.size() == 4u);
+        REQUIRE(result[0] == rawFileAsset);
+        REQUIRE(result[1] == stringTableReference);
+        REQUIRE(result[2] == nullptr);
+        REQUIRE(result[3] == nullptr);
+    }
+} // namespace
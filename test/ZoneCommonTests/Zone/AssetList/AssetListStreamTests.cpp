@@ -0,0 +1,52 @@
+#include "Zone/AssetList/AssetListStream.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+
+namespace
+{
+    TEST_CASE("AssetListInputStream: Reads all entries at once", "[zonecommon][assetlist]")
+    {
+        std::istringstream input("material,mc/mtl_test\r\n"
+                                 "\n"
+                                 "image,,referenced_image\n"
+                                 "rawfile,\"maps/test,with,separators.gsc\"\n"
+                                 "xmodel,test_model");
+
+        AssetList assetList;
+        assetList.m_entries.emplace_back("localize", "existing", false);
+
+        const AssetListInputStream stream(input);
+        stream.ReadAllEntries(assetList);
+
+        REQUIRE(assetList.m_entries.size() == 5u);
+        REQUIRE(assetList.m_entries[0].m_name == "existing");
+
+        REQUIRE(assetList.m_entries[1].m_type == "material");
+        REQUIRE(assetList.m_entries[1].m_name == "mc/mtl_test");
+        REQUIRE(!assetList.m_entries[1].m_is_reference);
+
+        REQUIRE(assetList.m_entries[2].m_type == "image");
+        REQUIRE(assetList.m_entries[2].m_name == "referenced_image");
+        REQUIRE(assetList.m_entries[2].m_is_reference);
+
+        REQUIRE(assetList.m_entries[3].m_type == "rawfile");
+        REQUIRE(assetList.m_entries[3].m_name == "maps/test,with,separators.gsc");
+        REQUIRE(!assetList.m_entries[3].m_is_reference);
+
+        REQUIRE(assetList.m_entries[4].m_type == "xmodel");
+        REQUIRE(assetList.m_entries[4].m_name == "test_model");
+        REQUIRE(!assetList.m_entries[4].m_is_reference);
+    }
+
+    TEST_CASE("AssetListInputStream: Reads empty asset lists", "[zonecommon][assetlist]")
+    {
+        std::istringstream input("");
+
+        AssetList assetList;
+        const AssetListInputStream stream(input);
+        stream.ReadAllEntries(assetList);
+
+        REQUIRE(assetList.m_entries.empty());
+    }
+} // namespace
@@ -0,0 +1,54 @@
+ZoneTests = {}
+
+function ZoneTests:include(includes)
+	if includes:handle(self:name()) then
+		includedirs {
+			path.join(TestFolder(), "ZoneTests")
+		}
+	end
+end
+
+function ZoneTests:link(links)
+	
+end
+
+function ZoneTests:use()
+	
+end
+
+function ZoneTests:name()
+    return "ZoneTests"
+end
+
+function ZoneTests:project()
+	local folder = TestFolder()
+	local includes = Includes:create()
+	local links = Links:create()
+
+	project(self:name())
+        targetdir(TargetDirectoryTest)
+		location "%{wks.location}/test/%{prj.name}"
+		kind "ConsoleApp"
+		language "C++"
+		
+		files {
+			path.join(folder, "ZoneTests/**.h"), 
+			path.join(folder, "ZoneTests/**.cpp")
+		}
+		
+        vpaths {
+			["*"] = {
+				path.join(folder, "ZoneTests")
+			}
+		}
+		
+		self:include(includes)
+		ZoneLoading:include(includes)
+		ZoneWriting:include(includes)
+		catch2:include(includes)
+
+		links:linkto(ZoneLoading)
+		links:linkto(ZoneWriting)
+		links:linkto(catch2)
+		links:linkall()
+end
@@ -0,0 +1,303 @@
+#include "Game/IW3/GameAssetPoolIW3.h"
+#include "Game/IW3/GameIW3.h"
+#include "Game/IW4/GameAssetPoolIW4.h"
+#include "Game/IW4/GameIW4.h"
+#include "Game/IW5/GameAssetPoolIW5.h"
+#include "Game/IW5/GameIW5.h"
+#include "Game/T5/GameAssetPoolT5.h"
+#include "Game/T5/GameT5.h"
+#include "Game/T6/GameAssetPoolT6.h"
+#include "Game/T6/GameT6.h"
+#include "ZoneLoading.h"
+#include "ZoneWriting.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace test::zone::round_trip
+{
+    constexpr auto ZONE_NAME = "round_trip";
+    constexpr auto RAW_FILE_COUNT = 256u;
+    constexpr auto MIN_RAW_FILE_SIZE = 64u;
+    constexpr auto MAX_RAW_FILE_SIZE = 0x4000u;
+
+    class TraitsIW3
+    {
+    public:
+        using pool_t = GameAssetPoolIW3;
+        using raw_file_t = IW3::RawFile;
+        static constexpr asset_type_t RAW_FILE_ASSET_TYPE = IW3::ASSET_TYPE_RAWFILE;
+
+        static IGame* Game()
+        {
+            return &g_GameIW3;
+        }
+    };
+
+    class TraitsIW4
+    {
+    public:
+        using pool_t = GameAssetPoolIW4;
+        using raw_file_t = IW4::RawFile;
+        static constexpr asset_type_t RAW_FILE_ASSET_TYPE = IW4::ASSET_TYPE_RAWFILE;
+
+        static IGame* Game()
+        {
+            return &g_GameIW4;
+        }
+    };
+
+    class TraitsIW5
+    {
+    public:
+        using pool_t = GameAssetPoolIW5;
+        using raw_file_t = IW5::RawFile;
+        static constexpr asset_type_t RAW_FILE_ASSET_TYPE = IW5::ASSET_TYPE_RAWFILE;
+
+        static IGame* Game()
+        {
+            return &g_GameIW5;
+        }
+    };
+
+    class TraitsT5
+    {
+    public:
+        using pool_t = GameAssetPoolT5;
+        using raw_file_t = T5::RawFile;
+        static constexpr asset_type_t RAW_FILE_ASSET_TYPE = T5::ASSET_TYPE_RAWFILE;
+
+        static IGame* Game()
+        {
+            return &g_GameT5;
+        }
+    };
+
+    class TraitsT6
+    {
+    public:
+        using pool_t = GameAssetPoolT6;
+        using raw_file_t = T6::RawFile;
+        static constexpr asset_type_t RAW_FILE_ASSET_TYPE = T6::ASSET_TYPE_RAWFILE;
+
+        static IGame* Game()
+        {
+            return &g_GameT6;
+        }
+    };
+
+    // IW4 keeps the buffer in a union with the compressed buffer, all other games have a plain buffer
+    template<typename TRawFile> auto& RawFileBuffer(TRawFile& rawFile)
+    {
+        if constexpr (requires { rawFile.data.buffer; })
+            return rawFile.data.buffer;
+        else
+            return rawFile.buffer;
+    }
+
+    template<typename TRawFile> size_t RawFileBufferSize(TRawFile& rawFile)
+    {
+        // The null terminator is part of the written buffer
+        return (static_cast<size_t>(rawFile.len) + 1u) * sizeof(*RawFileBuffer(rawFile));
+    }
+
+    uint64_t Fnv1a(uint64_t hash, const void* data, const size_t size)
+    {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        for (auto i = 0u; i < size; i++)
+        {
+            hash ^= bytes[i];
+            hash *= 0x100000001B3u;
+        }
+
+        return hash;
+    }
+
+    template<typename TTraits> uint64_t HashRawFile(typename TTraits::raw_file_t& rawFile)
+    {
+        auto hash = Fnv1a(0xCBF29CE484222325u, rawFile.name, std::strlen(rawFile.name));
+        hash = Fnv1a(hash, &rawFile.len, sizeof(rawFile.len));
+
+        return Fnv1a(hash, RawFileBuffer(rawFile), RawFileBufferSize(rawFile));
+    }
+
+    /**
+     * \brief Creates a zone of raw files with random text. Raw files exist in every game and write variable amounts of data,
+     * which makes them a simple way to test the whole pipeline of writing and loading zones.
+     */
+    template<typename TTraits> std::unique_ptr<Zone> CreateZone()
+    {
+        using raw_file_t = typename TTraits::raw_file_t;
+
+        std::unique_ptr<Zone> zone = std::make_unique<Zone>(ZONE_NAME, 0, TTraits::Game());
+        zone->m_pools = std::make_unique<typename TTraits::pool_t>(zone.get(), 0);
+        for (asset_type_t assetType = 0; assetType < zone->m_pools->GetAssetTypeCount(); assetType++)
+            zone->m_pools->InitPoolDynamic(assetType);
+        zone->m_script_strings.AddOrGetScriptString("");
+
+        auto* memory = zone->GetMemory();
+        std::mt19937 random(1337u);
+        std::uniform_int_distribution<unsigned> sizeDistribution(MIN_RAW_FILE_SIZE, MAX_RAW_FILE_SIZE);
+        std::uniform_int_distribution<unsigned> charDistribution('a', 'z');
+        for (auto rawFileIndex = 0u; rawFileIndex < RAW_FILE_COUNT; rawFileIndex++)
+        {
+            const auto name = "raw/round_trip_" + std::to_string(rawFileIndex) + ".txt";
+
+            auto* rawFile = memory->Alloc<raw_file_t>();
+            rawFile->name = memory->Dup(name.c_str());
+            rawFile->len = static_cast<int>(sizeDistribution(random));
+
+            using buffer_element_t = std::remove_const_t<std::remove_pointer_t<std::remove_reference_t<decltype(RawFileBuffer(*rawFile))>>>;
+            auto* buffer = memory->Alloc<buffer_element_t>(static_cast<size_t>(rawFile->len) + 1u);
+            for (auto i = 0; i < rawFile->len; i++)
+                buffer[i] = static_cast<buffer_element_t>(i % 64 == 63 ? '\n' : charDistribution(random));
+            RawFileBuffer(*rawFile) = buffer;
+
+            // IW5 writes as many bytes as the compressed length, regardless of whether the data is compressed
+            if constexpr (requires { rawFile->compressedLen; rawFile->buffer; })
+                rawFile->compressedLen = static_cast<int>(RawFileBufferSize(*rawFile));
+
+            zone->m_pools->AddAsset(TTraits::RAW_FILE_ASSET_TYPE, name, rawFile, {}, {}, {});
+        }
+
+        return zone;
+    }
+
+    template<typename TTraits> std::map<std::string, uint64_t> HashRawFiles(const Zone& zone)
+    {
+        std::map<std::string, uint64_t> hashes;
+        for (const auto* assetInfo : *zone.m_pools)
+        {
+            if (assetInfo->m_type == TTraits::RAW_FILE_ASSET_TYPE)
+                hashes.emplace(assetInfo->m_name, HashRawFile<TTraits>(*static_cast<typename TTraits::raw_file_t*>(assetInfo->m_ptr)));
+        }
+
+        return hashes;
+    }
+
+    /**
+     * \brief Loads zones without registering them with their game, so tests do not leave loaded zones behind.
+     */
+    class UnregisteredZoneLoading
+    {
+    public:
+        UnregisteredZoneLoading()
+            : m_register_loaded_zones(ZoneLoading::Configuration.RegisterLoadedZones)
+        {
+            ZoneLoading::Configuration.RegisterLoadedZones = false;
+        }
+
+        ~UnregisteredZoneLoading()
+        {
+            ZoneLoading::Configuration.RegisterLoadedZones = m_register_loaded_zones;
+        }
+
+        UnregisteredZoneLoading(const UnregisteredZoneLoading& other) = delete;
+        UnregisteredZoneLoading(UnregisteredZoneLoading&& other) noexcept = delete;
+        UnregisteredZoneLoading& operator=(const UnregisteredZoneLoading& other) = delete;
+        UnregisteredZoneLoading& operator=(UnregisteredZoneLoading&& other) noexcept = delete;
+
+    private:
+        bool m_register_loaded_zones;
+    };
+
+    template<typename TTraits> void RunRoundTrip()
+    {
+        const UnregisteredZoneLoading unregisteredZoneLoading;
+        const auto zone = CreateZone<TTraits>();
+
+        std::vector<uint8_t> zoneData;
+        REQUIRE(ZoneWriting::WriteZone(zoneData, zone.get(), ZoneWritingOptions()));
+
+        const auto loadedZone = ZoneLoading::LoadZone(zoneData, ZONE_NAME);
+        REQUIRE(loadedZone);
+
+        const auto hashes = HashRawFiles<TTraits>(*zone);
+        const auto loadedHashes = HashRawFiles<TTraits>(*loadedZone);
+        REQUIRE(hashes.size() == RAW_FILE_COUNT);
+        REQUIRE(loadedHashes == hashes);
+    }
+
+    /**
+     * \brief Measures writing and loading a whole zone. The names of the benchmarks contain the size of the zone to compare the throughput.
+     */
+    template<typename TTraits> void RunThroughput()
+    {
+        const UnregisteredZoneLoading unregisteredZoneLoading;
+        const auto zone = CreateZone<TTraits>();
+
+        std::vector<uint8_t> zoneData;
+        REQUIRE(ZoneWriting::WriteZone(zoneData, zone.get(), ZoneWritingOptions()));
+        const auto sizeSuffix = " (" + std::to_string(zoneData.size()) + " bytes)";
+
+        BENCHMARK("Write" + sizeSuffix)
+        {
+            std::vector<uint8_t> buffer;
+            ZoneWriting::WriteZone(buffer, zone.get(), ZoneWritingOptions());
+            return buffer.size();
+        };
+
+        BENCHMARK("Load" + sizeSuffix)
+        {
+            return ZoneLoading::LoadZone(zoneData, ZONE_NAME) != nullptr;
+        };
+    }
+
+    TEST_CASE("ZoneRoundTrip: Loads written IW3 zones", "[zone][roundtrip]")
+    {
+        RunRoundTrip<TraitsIW3>();
+    }
+
+    TEST_CASE("ZoneRoundTrip: Loads written IW4 zones", "[zone][roundtrip]")
+    {
+        RunRoundTrip<TraitsIW4>();
+    }
+
+    TEST_CASE("ZoneRoundTrip: Loads written IW5 zones", "[zone][roundtrip]")
+    {
+        RunRoundTrip<TraitsIW5>();
+    }
+
+    TEST_CASE("ZoneRoundTrip: Loads written T5 zones", "[zone][roundtrip]")
+    {
+        RunRoundTrip<TraitsT5>();
+    }
+
+    TEST_CASE("ZoneRoundTrip: Loads written T6 zones", "[zone][roundtrip]")
+    {
+        RunRoundTrip<TraitsT6>();
+    }
+
+    // Benchmarks are hidden so they only run when they are selected, e.g. with the [benchmark] tag
+    TEST_CASE("ZoneRoundTrip: IW3 throughput", "[.][benchmark][zone][roundtrip]")
+    {
+        RunThroughput<TraitsIW3>();
+    }
+
+    TEST_CASE("ZoneRoundTrip: IW4 throughput", "[.][benchmark][zone][roundtrip]")
+    {
+        RunThroughput<TraitsIW4>();
+    }
+
+    TEST_CASE("ZoneRoundTrip: IW5 throughput", "[.][benchmark][zone][roundtrip]")
+    {
+        RunThroughput<TraitsIW5>();
+    }
+
+    TEST_CASE("ZoneRoundTrip: T5 throughput", "[.][benchmark][zone][roundtrip]")
+    {
+        RunThroughput<TraitsT5>();
+    }
+
+    TEST_CASE("ZoneRoundTrip: T6 throughput", "[.][benchmark][zone][roundtrip]")
+    {
+        RunThroughput<TraitsT6>();
+    }
+} // namespace test::zone::round_trip
@@ -5,4 +5,9 @@ newoption {
 newoption {
     trigger = "debug-techset",
     description = "Activate additional debugging logic for Techset assets"
-}
\ No newline at end of file
+}
+
+newoption {
+    trigger = "disable-tracing",
+    description = "Remove the timing and counter instrumentation that is recorded with --trace from the build"
+}